@@ -0,0 +1,535 @@
+//! Benchmarks over the example files, timing lexing, parsing, type inference, evaluation and
+//! quotation separately, for both [`zenith::kernel`] and [`zenith::ir`] (with [`zenith::elab`]).
+//! Evaluation and quotation are also timed on the compact node layout in [`zenith::kernel::compact`].
+//! Quotation with and without memoisation is also timed on a value with much sharing.
+//!
+//! Run with `cargo bench --bench examples [--features type_in_type] [-- <filter>]`. Cases whose
+//! names do not contain the filter are skipped. `tree_eval.zkt` only type checks with the
+//! `type_in_type` feature. Arena counters after the last run of each case are reported alongside
+//! the timings. Lookup counters are only recorded with the `profiling` feature.
+//!
+//! Randomly generated terms are also checked by both [`zenith::kernel`] and the core checker of
+//! [`zenith::ir`] (on the same core terms), which must agree on them, and cases where one is much
+//! slower than the other are flagged.
+
+use std::fmt::Display;
+use std::fs::read_to_string;
+use std::thread;
+use std::time::{Duration, Instant};
+
+/// Example files, and whether they are also accepted by the kernel.
+const EXAMPLES: [(&str, bool); 5] = [
+  ("tree_eval.zkt", true),
+  ("long_env_eval.zkt", true),
+  ("long_tuple_eval.zkt", true),
+  ("first_order_logic.zkt", true),
+  ("first_order_logic.zt", false),
+];
+
+/// Each case is repeated until it has run for this long...
+const TARGET_TIME: Duration = Duration::from_secs(2);
+
+/// ...or this many times, whichever comes first.
+const MAX_RUNS: usize = 100;
+
+/// Runs `f` repeatedly and prints the fastest and median times, together with the counters
+/// returned by the last run. Returns the result of the last run.
+fn bench<T>(name: &str, filter: &str, mut f: impl FnMut() -> (T, String)) -> Option<T> {
+  if !name.contains(filter) {
+    return None;
+  }
+  let mut times = Vec::new();
+  let start = Instant::now();
+  let mut last = None;
+  while times.is_empty() || (start.elapsed() < TARGET_TIME && times.len() < MAX_RUNS) {
+    let now = Instant::now();
+    let res = f();
+    times.push(now.elapsed());
+    last = Some(res);
+  }
+  times.sort();
+  let (res, counters) = last.unwrap();
+  let (min, median) = (times[0], times[times.len() / 2]);
+  println!("{name:<40} {min:>12.3?} {median:>12.3?} {:>6}  {counters}", times.len());
+  Some(res)
+}
+
+/// Unwraps results of parsing and checking, printing a skip message on errors.
+fn ok<T>(name: &str, res: Result<T, impl Display>) -> Option<T> {
+  res.map_err(|e| println!("{name:<40} skipped: {e}")).ok()
+}
+
+mod kernel {
+  use super::*;
+  use std::mem::size_of;
+  use zenith::kernel::{compact, Arena, Clos, Span, Stack, Term, Val};
+
+  /// Bytes taken by the nodes in the arena, for comparison with [`compact::Arena::byte_count`].
+  fn byte_count(ar: &Arena) -> usize {
+    ar.term_count() * size_of::<Term>()
+      + ar.val_count() * size_of::<Val>()
+      + ar.clos_count() * size_of::<Clos>()
+      + ar.frame_count() * size_of::<Stack>()
+  }
+
+  fn counters(ar: &Arena) -> String {
+    format!(
+      "{} terms, {} values, {} closures, {} frames, {} bytes, {} lookups, {:.2} average lookup length",
+      ar.term_count(),
+      ar.val_count(),
+      ar.clos_count(),
+      ar.frame_count(),
+      byte_count(ar),
+      ar.lookup_count(),
+      ar.average_link_count()
+    )
+  }
+
+  /// Runs `f` and releases the objects it allocates, returning the number of bytes they took.
+  fn released(ar: &mut compact::Arena, f: impl FnOnce(&mut compact::Arena) -> bool) -> (bool, String) {
+    let (mark, bytes) = (ar.mark(), ar.byte_count());
+    let res = f(ar);
+    let counters = format!("{} bytes", ar.byte_count() - bytes);
+    ar.release(mark);
+    (res, counters)
+  }
+
+  pub fn run(file: &str, src: &str, filter: &str) {
+    let name = |phase: &str| format!("{file}/kernel/{phase}");
+    let lex = || (Span::lex(src.chars()), String::new());
+    let spans = bench(&name("lex"), filter, lex).unwrap_or_else(|| Span::lex(src.chars()));
+    let Some(spans) = ok(&name("lex"), spans) else { return };
+    let pr = Arena::new();
+    let parse = || {
+      let ar = Arena::new();
+      (Term::parse(spans.clone().into_iter(), &ar).is_ok(), counters(&ar))
+    };
+    bench(&name("parse"), filter, parse);
+    let Some(x) = ok(&name("parse"), Term::parse(spans.into_iter(), &pr)) else { return };
+    let infer = || {
+      let ar = Arena::new();
+      (x.infer(&Stack::new(&ar), &Stack::new(&ar), &ar).is_ok(), counters(&ar))
+    };
+    bench(&name("infer"), filter, infer);
+    let Some(_) = ok(&name("infer"), x.infer(&Stack::new(&pr), &Stack::new(&pr), &pr)) else { return };
+    let eval = || {
+      let ar = Arena::new();
+      (x.eval(&Stack::new(&ar), &ar).is_ok(), counters(&ar))
+    };
+    bench(&name("eval"), filter, eval);
+    let v = x.eval(&Stack::new(&pr), &pr).unwrap();
+    let quote = || {
+      let ar = Arena::new();
+      (v.quote(0, &ar).is_ok(), counters(&ar))
+    };
+    bench(&name("quote"), filter, quote);
+    // The compact layout starts from a lowered copy of the term, and objects allocated by each run
+    // are released afterwards.
+    let name = |phase: &str| format!("{file}/compact/{phase}");
+    let mut cr = compact::Arena::new();
+    let cx = compact::Term::lower(x, &mut cr);
+    let eval = || released(&mut cr, |ar| cx.eval(compact::Stack::new(ar), ar).is_ok());
+    bench(&name("eval"), filter, eval);
+    let v = cx.eval(compact::Stack::new(&cr), &mut cr).unwrap();
+    let quote = || released(&mut cr, |ar| v.quote(0, ar).is_ok());
+    bench(&name("quote"), filter, quote);
+  }
+}
+
+mod ir {
+  use super::*;
+  use zenith::arena::Arena;
+  use zenith::io::Span;
+  use zenith::ir::{Stack, Term, Val};
+
+  /// Depth of the value quoted by [`sharing`], whose tree form has `2^DEPTH` leaves.
+  const DEPTH: usize = 18;
+
+  fn counters(ar: &Arena) -> String {
+    format!(
+      "{} terms, {} values, {} closures, {} frames, {} bytes, {} lookups, {:.2} average lookup length",
+      ar.term_count(),
+      ar.val_count(),
+      ar.clos_count(),
+      ar.frame_count(),
+      ar.byte_count(),
+      ar.lookup_count(),
+      ar.average_link_count()
+    )
+  }
+
+  pub fn run(file: &str, src: &str, filter: &str) {
+    let name = |phase: &str| format!("{file}/ir/{phase}");
+    let lex = || (Span::lex(src), String::new());
+    let spans = bench(&name("lex"), filter, lex).unwrap_or_else(|| Span::lex(src));
+    let Some(spans) = ok(&name("lex"), spans) else { return };
+    let pr = Arena::new();
+    let parse = || {
+      let ar = Arena::new();
+      (Term::parse(spans.iter().copied(), &ar).is_ok(), counters(&ar))
+    };
+    bench(&name("parse"), filter, parse);
+    let Some(x) = ok(&name("parse"), Term::parse(spans.into_iter(), &pr)) else { return };
+    let infer = || {
+      let ar = Arena::new();
+      (x.infer(&Stack::new(&ar), &Stack::new(&ar), &ar).is_ok(), counters(&ar))
+    };
+    bench(&name("infer"), filter, infer);
+    let Some((x, _)) = ok(&name("infer"), x.infer(&Stack::new(&pr), &Stack::new(&pr), &pr)) else { return };
+    let eval = || {
+      let ar = Arena::new();
+      (x.eval(&Stack::new(&ar), &ar).is_ok(), counters(&ar))
+    };
+    bench(&name("eval"), filter, eval);
+    let v = x.eval(&Stack::new(&pr), &pr).unwrap();
+    let quote = || {
+      let ar = Arena::new();
+      (v.quote(0, &ar).is_ok(), counters(&ar))
+    };
+    bench(&name("quote"), filter, quote);
+    let quote_memo = || {
+      let ar = Arena::new();
+      // SAFETY: `v` is allocated in `pr`, which outlives `ar`.
+      unsafe { ar.set_memoising(true) };
+      (v.quote(0, &ar).is_ok(), format!("{}, {:.2} memo hit rate", counters(&ar), ar.memo_hit_rate()))
+    };
+    bench(&name("quote-memo"), filter, quote_memo);
+  }
+
+  /// Times quotation of a value with much sharing, i.e. a complete binary tree of applications
+  /// with [`DEPTH`] distinct nodes, with and without memoisation. Values from the examples have
+  /// little sharing, so memoisation only adds table lookups there.
+  pub fn sharing(filter: &str) {
+    let pr = Arena::new();
+    let mut v = Val::Free(0);
+    for _ in 0..DEPTH {
+      v = Val::App(pr.val(v), pr.val(v), false);
+    }
+    for memoising in [false, true] {
+      let quote = || {
+        let ar = Arena::new();
+        // SAFETY: `v` is allocated in `pr`, which outlives `ar`.
+        unsafe { ar.set_memoising(memoising) };
+        (v.quote(1, &ar).is_ok(), format!("{}, {:.2} memo hit rate", counters(&ar), ar.memo_hit_rate()))
+      };
+      bench(if memoising { "sharing/ir/quote-memo" } else { "sharing/ir/quote" }, filter, quote);
+    }
+  }
+}
+
+mod discr {
+  use super::*;
+  use std::fmt::Write;
+  use zenith::arena::Arena;
+  use zenith::elab::DiscrTree;
+  use zenith::io::Lexer;
+  use zenith::ir::{Bound, Stack, Term, Val};
+
+  /// Number of postulates in the generated signature.
+  const POSTULATES: usize = 2000;
+
+  /// Number of goals retrieved per run.
+  const GOALS: usize = 100;
+
+  /// Times retrieval of candidates for goals of the form `⊢ (f c)` among postulates of the form
+  /// `[p : Prop, h : ⊢ p] → ⊢ (f p)`, with a different `f` for each, against trying the conclusion
+  /// of every postulate by unification.
+  pub fn run(filter: &str) {
+    let name = |phase: &str| format!("discr/{phase}");
+    let mut src = String::from("{ Prop : Type, ⊢ : [p : Prop] → Type, c : Prop");
+    for i in 0..POSTULATES {
+      write!(src, ", f{i} : [p : Prop] → Prop, l{i} : [p : Prop, h : ⊢ p] → ⊢ (f{i} p)").unwrap();
+    }
+    src.push('}');
+    let pr = Arena::new();
+    let (nil, env) = (Stack::new(&pr), Stack::new(&pr).extend(Bound::empty(), Val::Free(0), &pr));
+    let sig = Term::parse(Lexer::new(&src), &pr).unwrap().infer(&nil, &nil, &pr).unwrap().0;
+    let Val::Sig(us) = sig.eval(&nil, &pr).unwrap() else { unreachable!() };
+    let ctx = nil.bind(Bound::empty(), Val::Sig(us), &pr);
+    // Postulates `l{i}` are the fields after `Prop`, `⊢`, `c` and `f{i}`.
+    let tys = us.iter().skip(4).step_by(2).map(|(info, _)| ctx.get_by_name(info.name, &env, &pr).unwrap().2);
+    let tys = tys.collect::<Vec<_>>();
+    let goals = (0..GOALS).map(|i| {
+      let goal = format!("⊢ (f{} c)", i * POSTULATES / GOALS);
+      let goal = Term::parse(Lexer::new(&goal), &pr).unwrap().infer(&ctx, &env, &pr).unwrap().0;
+      goal.eval(&env, &pr).unwrap()
+    });
+    let goals = goals.collect::<Vec<_>>();
+    let insert = || {
+      let ar = Arena::new();
+      let mut tree = DiscrTree::new();
+      for (i, ty) in tys.iter().enumerate() {
+        tree.insert(*ty, &ctx, i, &ar).unwrap();
+      }
+      (tree, format!("{} postulates", tys.len()))
+    };
+    let tree = bench(&name("insert"), filter, insert).unwrap_or_else(|| insert().0);
+    let get = || {
+      let ar = Arena::new();
+      let n = goals.iter().map(|goal| tree.get(*goal, &ctx, &ar).unwrap().len()).sum::<usize>();
+      ((), format!("{n} candidates for {GOALS} goals"))
+    };
+    bench(&name("get"), filter, get);
+    let linear = || {
+      let ar = Arena::new();
+      let mut n = 0;
+      for goal in &goals {
+        for ty in &tys {
+          let mut ty = *ty;
+          while let Val::Pi(t, u) = ty.force() {
+            let m = ar.meta(ctx.len(), ar.term(t.quote(ctx.len(), &ar).unwrap()));
+            ty = u.apply(Term::Meta(m).eval(&env, &ar).unwrap(), &ar).unwrap();
+          }
+          n += ty.conv(goal, ctx.len(), &ar).unwrap() as usize;
+        }
+      }
+      ((), format!("{n} unifiers for {GOALS} goals"))
+    };
+    bench(&name("linear"), filter, linear);
+  }
+}
+
+mod differential {
+  use super::*;
+  use std::fmt::Write;
+  use zenith::io::Span;
+  use zenith::ir::{Bound, Core};
+  use zenith::{arena, ir, kernel};
+
+  /// Definitions shared by all generated terms.
+  const PRELUDE: &str = "Bool ≔ [B : Type, t : B, f : B] → B, \
+    true ≔ [B, t, f] ↦ t : Bool, \
+    false ≔ [B, t, f] ↦ f : Bool, \
+    not ≔ [a, B, t, f] ↦ a B f t : [a : Bool] → Bool, \
+    and ≔ [a, b, B, t, f] ↦ a B (b B t f) f : [a : Bool, b : Bool] → Bool, \
+    Nat ≔ [N : Type, s : [n : N] → N, z : N] → N, \
+    zero ≔ [N, s, z] ↦ z : Nat, \
+    suc ≔ [a, N, s, z] ↦ s (a N s z) : [a : Nat] → Nat, \
+    add ≔ [a, b, N, s, z] ↦ a N s (b N s z) : [a : Nat, b : Nat] → Nat, \
+    mul ≔ [a, b, N, s] ↦ a N (b N s) : [a : Nat, b : Nat] → Nat";
+
+  /// Generates the definitions of a term, given a size, whether to make it ill-typed, and a source
+  /// of randomness. The term is the definition named `goal`.
+  type Generator = fn(usize, bool, &mut Rng) -> String;
+
+  /// Families of generated terms.
+  const FAMILIES: [(&str, Generator); 3] = [("numerals", numerals), ("lets", lets), ("tuples", tuples)];
+
+  /// Sizes of generated terms, in definitions or fields.
+  const SIZES: [usize; 4] = [16, 64, 256, 1024];
+
+  /// Number of seeds per family and size. Each seed gives a well-typed and an ill-typed case.
+  const SEEDS: u64 = 4;
+
+  /// Largest numeral computed by generated definitions, which bounds the size of normal forms.
+  const MAX_NUMERAL: u64 = 1000;
+
+  /// Cases where one checker takes this many times as long as the other are flagged...
+  const SLOWDOWN: u32 = 10;
+
+  /// ...unless the slower one still takes less than this.
+  const MIN_FLAGGED: Duration = Duration::from_millis(1);
+
+  /// A xorshift generator, so that cases can be reproduced from their seeds.
+  struct Rng(u64);
+
+  impl Rng {
+    fn new(seed: u64) -> Self {
+      Self(seed.wrapping_add(1).wrapping_mul(0x9e37_79b9_7f4a_7c15))
+    }
+
+    /// Returns a number in `0..n`.
+    fn below(&mut self, n: usize) -> usize {
+      self.0 ^= self.0 << 13;
+      self.0 ^= self.0 >> 7;
+      self.0 ^= self.0 << 17;
+      (self.0 % n as u64) as usize
+    }
+  }
+
+  /// Church numerals built by random additions and multiplications of earlier ones, and a cast
+  /// between properties of one of them and of the same operation with its arguments swapped (or of
+  /// its successor, if ill-typed), which is checked by comparing normal forms.
+  fn numerals(n: usize, ill: bool, rng: &mut Rng) -> String {
+    let mut src = String::from("n0 ≔ suc zero");
+    let (mut vals, mut alts) = (vec![1], vec!["suc zero".to_string()]);
+    for i in 1..n {
+      let (j, k) = (rng.below(i), rng.below(i));
+      let (a, b) = (vals[j], vals[k]);
+      let (val, def, alt) = match rng.below(3) {
+        0 if a * b <= MAX_NUMERAL => (a * b, format!("mul n{j} n{k}"), format!("mul n{k} n{j}")),
+        1 if a + b <= MAX_NUMERAL => (a + b, format!("add n{j} n{k}"), format!("add n{k} n{j}")),
+        _ => (a + 1, format!("suc n{j}"), format!("add n{j} (suc zero)")),
+      };
+      write!(src, ", n{i} ≔ {def}").unwrap();
+      vals.push(val);
+      alts.push(alt);
+    }
+    let i = rng.below(n);
+    let alt = if ill { format!("suc ({})", alts[i]) } else { alts[i].clone() };
+    write!(src, ", goal ≔ [P, h] ↦ h : [P : [a : Nat] → Type, h : P n{i}] → P ({alt})").unwrap();
+    src
+  }
+
+  /// A deep chain of boolean definitions, each referring to random earlier ones, and a cast between
+  /// properties of the last one and of its computed value (or the other value, if ill-typed).
+  fn lets(n: usize, ill: bool, rng: &mut Rng) -> String {
+    let mut src = String::from("b0 ≔ true");
+    let mut vals = vec![true];
+    for i in 1..n {
+      let (j, k) = (rng.below(i), rng.below(i));
+      let (val, def) = match rng.below(2) {
+        0 => (vals[j] && vals[k], format!("and b{j} b{k}")),
+        _ => (!vals[j], format!("not b{j}")),
+      };
+      write!(src, ", b{i} ≔ {def}").unwrap();
+      vals.push(val);
+    }
+    let val = vals[n - 1] != ill;
+    write!(src, ", goal ≔ [P, h] ↦ h : [P : [a : Bool] → Type, h : P b{}] → P {val}", n - 1).unwrap();
+    src
+  }
+
+  /// A wide tuple of booleans and numerals, each field computed from random earlier ones, checked
+  /// against its type. If ill-typed, one of the fields is given a numeral where a boolean is
+  /// expected.
+  fn tuples(n: usize, ill: bool, rng: &mut Rng) -> String {
+    let (mut src, mut ty) = (String::from("goal ≔ {f0 ≔ true, f1 ≔ zero"), String::from("{f0 : Bool, f1 : Nat"));
+    let (mut bools, mut nats) = (vec![0], vec![1]);
+    let bad = ill.then(|| 2 + rng.below(n - 2));
+    for i in 2..n {
+      let pick = |fields: &[usize], rng: &mut Rng| fields[rng.below(fields.len())];
+      let (def, nat) = match rng.below(3) {
+        _ if bad == Some(i) => ("and f0 f1".to_string(), false),
+        0 => (format!("and f{} f{}", pick(&bools, rng), pick(&bools, rng)), false),
+        1 => (format!("suc f{}", pick(&nats, rng)), true),
+        _ => (format!("add f{} f{}", pick(&nats, rng), pick(&nats, rng)), true),
+      };
+      if nat {
+        nats.push(i)
+      } else {
+        bools.push(i)
+      }
+      write!(src, ", f{i} ≔ {def}").unwrap();
+      write!(ty, ", f{i} : {}", if nat { "Nat" } else { "Bool" }).unwrap();
+    }
+    write!(src, "}} : {ty}}}").unwrap();
+    src
+  }
+
+  /// Converts a kernel term into the same term of the ir core calculus, with empty binder and
+  /// field information.
+  fn lower<'a>(x: &kernel::Term, ar: &'a arena::Arena) -> ir::Term<'a, 'static, Core> {
+    let lower_ref = |x| ar.term(lower(x, ar));
+    let lower_all = |xs: &[kernel::Term]| {
+      let terms = ar.terms(xs.len());
+      for (term, x) in terms.iter_mut().zip(xs) {
+        term.1 = lower(x, ar);
+      }
+      &*terms
+    };
+    match *x {
+      kernel::Term::Gc(x) => ir::Term::Gc(lower_ref(x)),
+      kernel::Term::Univ(v) => ir::Term::Univ(v),
+      kernel::Term::Var(ix) => ir::Term::Var(ix),
+      kernel::Term::Ann(x, t) => ir::Term::Ann(lower_ref(x), lower_ref(t)),
+      kernel::Term::Let(v, x) => ir::Term::Let(Bound::empty(), lower_ref(v), lower_ref(x)),
+      kernel::Term::Pi(t, u) => ir::Term::Pi(Bound::empty(), lower_ref(t), lower_ref(u)),
+      kernel::Term::Fun(b) => ir::Term::Fun(Bound::empty(), lower_ref(b)),
+      kernel::Term::App(f, x) => ir::Term::App(lower_ref(f), lower_ref(x), false),
+      kernel::Term::Sig(us) => ir::Term::Sig(lower_all(us)),
+      kernel::Term::Tup(bs) => ir::Term::Tup(lower_all(bs)),
+      kernel::Term::Init(n, x) => ir::Term::Init(n, lower_ref(x)),
+      kernel::Term::Proj(n, x) => ir::Term::Proj(n, lower_ref(x)),
+    }
+  }
+
+  /// Infers the type of `src` with both checkers on the same core term, returning whether each
+  /// accepted it, and the time and peak arena bytes each took. Parsing and conversion are not
+  /// timed. Also returns whether the elaborator accepted `src`, which is checked but not timed.
+  fn check(src: &str) -> ([(bool, Duration, usize); 2], bool) {
+    let pr = kernel::Arena::new();
+    let x = kernel::Term::parse(kernel::Span::lex(src.chars()).unwrap().into_iter(), &pr).unwrap();
+    let kernel = {
+      let ar = kernel::Arena::new();
+      let now = Instant::now();
+      let ok = x.infer(&kernel::Stack::new(&ar), &kernel::Stack::new(&ar), &ar).is_ok();
+      (ok, now.elapsed(), ar.peak_bytes())
+    };
+    let ir = {
+      let pr = arena::Arena::new();
+      let x = lower(x, &pr);
+      let ar = arena::Arena::new();
+      let now = Instant::now();
+      let ok = x.infer(&ir::Stack::new(&ar), &ir::Stack::new(&ar), &ar).is_ok();
+      (ok, now.elapsed(), ar.peak_bytes())
+    };
+    let elab = {
+      let ar = arena::Arena::new();
+      let x = ir::Term::parse(Span::lex(src).unwrap().into_iter(), &ar).unwrap();
+      x.infer(&ir::Stack::new(&ar), &ir::Stack::new(&ar), &ar).is_ok()
+    };
+    ([kernel, ir], elab)
+  }
+
+  /// Checks random terms of each family and size with both [`zenith::kernel`] and the core checker
+  /// of [`zenith::ir`], asserting that they agree with each other, with [`zenith::elab`] and with
+  /// the generator on whether each term is well-typed. Prints the total times and largest peak arena bytes of each checker, and flags
+  /// cases where one is [`SLOWDOWN`] times slower than the other. Growing sizes make a scaling
+  /// corpus: times rising much faster than the size point to performance cliffs.
+  pub fn run(filter: &str) {
+    for (family, generate) in FAMILIES {
+      for size in SIZES {
+        let name = format!("differential/{family}/{size}");
+        if !name.contains(filter) {
+          continue;
+        }
+        let (mut times, mut bytes, mut flagged) = ([Duration::ZERO; 2], [0; 2], 0);
+        for seed in 0..SEEDS {
+          for ill in [false, true] {
+            let case = format!("{name}/{seed}{}", if ill { "/ill" } else { "" });
+            let src = format!("[{PRELUDE}, {}] goal", generate(size, ill, &mut Rng::new(seed)));
+            let ([(k, kt, kb), (i, it, ib)], e) = check(&src);
+            assert_eq!(k, i, "{case}: kernel and ir disagree");
+            assert_eq!(k, e, "{case}: kernel and elaborator disagree");
+            assert_eq!(k, !ill, "{case}: generated term is {}well-typed", if k { "" } else { "not " });
+            let (fast, slow) = (kt.min(it), kt.max(it));
+            if slow >= MIN_FLAGGED && slow > fast * SLOWDOWN {
+              println!("{case:<40} flagged: kernel {kt:.3?}, ir {it:.3?}");
+              flagged += 1;
+            }
+            (times[0], times[1]) = (times[0] + kt, times[1] + it);
+            (bytes[0], bytes[1]) = (bytes[0].max(kb), bytes[1].max(ib));
+          }
+        }
+        let ([kt, it], [kb, ib]) = (times, bytes);
+        println!(
+          "{name:<40} {kt:>12.3?} {it:>12.3?} {:>6}  {kb} kernel bytes, {ib} ir bytes, {flagged} flagged",
+          2 * SEEDS
+        );
+      }
+    }
+  }
+}
+
+fn main() {
+  // Arguments starting with `--` (e.g. `--bench`) are passed by Cargo, not by the user.
+  let filter = std::env::args().skip(1).find(|arg| !arg.starts_with("--")).unwrap_or_default();
+  // Deeply nested binders recurse deeply in the evaluator, so run on a big stack, just like the
+  // REPL does.
+  let run = move || {
+    println!("{:<40} {:>12} {:>12} {:>6}  counters", "case", "min", "median", "runs");
+    for (file, kernel) in EXAMPLES {
+      let src = read_to_string(format!("{}/examples/{file}", env!("CARGO_MANIFEST_DIR"))).unwrap();
+      if kernel {
+        kernel::run(file, &src, &filter);
+      }
+      ir::run(file, &src, &filter);
+    }
+    ir::sharing(&filter);
+    discr::run(&filter);
+    println!("{:<40} {:>12} {:>12} {:>6}  counters", "case", "kernel", "ir", "cases");
+    differential::run(&filter);
+  };
+  thread::Builder::new().stack_size(1024 * 1024 * 1024).spawn(run).unwrap().join().unwrap();
+}
@@ -1,22 +1,203 @@
 use bumpalo::Bump;
-use std::cell::Cell;
+use std::any::TypeId;
+use std::cell::{Cell, RefCell};
+use std::collections::{HashMap, HashSet};
+use std::mem::{size_of_val, take};
+use std::ops::Deref;
 
-use crate::ir::{Bound, Clos, Decoration, Field, Stack, Term, Val};
+use crate::common::{Forwarding, Usage};
+use crate::ir::{Bound, Clos, Core, Decoration, Field, Global, Index, Slot, Stack, Term, Val};
+use crate::profile::{Op, Profile};
 
 /// # Arena allocators
 ///
 /// Mixed-type arena allocators for [`Term`], [`Val`], [`Clos`] and [`Stack`]. These types never
 /// allocate memory or manage resources outside the arena, so there is no need to call destructors.
-/// It also stores mutable performance counters for debugging and profiling purposes.
+/// It also stores mutable performance counters for debugging and profiling purposes. Counters on
+/// hot paths (stack lookups) and the [`Profile`] are only recorded with the `profiling` feature.
+///
+/// Optionally, [`Term`] and [`Val`] nodes can be hash-consed, so that structurally identical nodes
+/// (whose children are already shared) are allocated only once. See [`Arena::set_interning`].
+///
+/// Names and attributes are interned in a per-arena symbol table, so that each identifier is
+/// stored once and equal names compare by address. See [`Arena::symbol`].
+///
+/// Gluing of `let`-bound definitions during evaluation is also configured here. See
+/// [`Arena::set_gluing`]. So is memoisation of quoted values, see [`Arena::set_memoising`], and the
+/// limits on evaluation steps and memory, see [`Arena::set_fuel`] and [`Arena::set_byte_limit`].
+///
+/// The arena also holds the metacontext, i.e. the types and solutions of holes by id. See
+/// [`Arena::meta`].
+///
+/// Short-lived allocations can be confined to a [`Region`], whose memory is reused by later
+/// regions of the same arena.
+///
+/// An arena can be moved to another thread, but not shared between threads. Objects allocated in
+/// it contain no interior mutability, so they can be shared freely once allocated. Parallel
+/// checking works on [`Arena::worker`] arenas, one per thread, see [`Arena::set_threads`].
 #[derive(Debug, Default)]
 pub struct Arena {
   data: Bump,
+  spare: RefCell<Vec<Bump>>,
+  gluing: Cell<bool>,
+  interning: Cell<bool>,
+  memoising: Cell<bool>,
+  threads: Cell<usize>,
+  fuel: Cell<Option<usize>>,
+  interned: RefCell<HashMap<Key, usize>>,
+  quoted: RefCell<HashMap<(usize, usize), usize>>,
+  metas: RefCell<Metas>,
+  regions: Cell<usize>,
+  symbols: RefCell<HashSet<&'static str>>,
+  symbol_parent: Option<usize>,
+  forwarded: Forwarding,
+  usage: Usage,
   term_count: Cell<usize>,
   val_count: Cell<usize>,
   clos_count: Cell<usize>,
   frame_count: Cell<usize>,
   lookup_count: Cell<usize>,
   link_count: Cell<usize>,
+  intern_count: Cell<usize>,
+  intern_hit_count: Cell<usize>,
+  memo_count: Cell<usize>,
+  memo_hit_count: Cell<usize>,
+  step_count: Cell<usize>,
+  copied_bytes: Cell<usize>,
+  freed_bytes: Cell<usize>,
+  #[cfg(feature = "profiling")]
+  profile: Profile,
+}
+
+/// # Arena regions
+///
+/// A scoped sub-arena which dereferences to an [`Arena`]. Dropping a region frees all objects
+/// inside at once, and its memory is handed back to the parent arena for reuse by later regions,
+/// instead of being returned to the system allocator. Surviving objects must be relocated into
+/// the parent before that, see [`Arena::copy_in`].
+///
+/// Settings (gluing, interning, memoisation and the byte limit), the remaining fuel and the
+/// metacontext are inherited from the parent, and names are interned in its symbol table. Lookup and step counters, and holes created or solved in the region, are merged into the parent when the
+/// region is dropped, unless they are rolled back before.
+#[derive(Debug)]
+pub struct Region<'p> {
+  parent: &'p Arena,
+  arena: Arena,
+}
+
+/// # Metacontext entries
+///
+/// A hole created by the elaborator: the size of the context it was created in (its *scope*), and
+/// the addresses of its type and solution, which are terms under that context. The solution is
+/// evaluated under the environment carried by each [`Val::Meta`], so that
+/// the environment acts as the substitution of the hole.
+#[derive(Debug, Clone, Copy)]
+struct Meta {
+  scope: usize,
+  ty: usize,
+  sol: Option<usize>,
+}
+
+/// # Metacontexts
+///
+/// Holes created in an arena, with ids starting from `base`, and the number of unsolved holes. A
+/// region refers to the metacontext of its parent (at address `parent`) for holes below `base`, and
+/// records solutions to them separately until it is dropped, so that creating a region does not
+/// copy the parent's metacontext. Holes solved since creation are listed in `trail`, in order.
+#[derive(Debug, Default)]
+struct Metas {
+  parent: Option<usize>,
+  base: usize,
+  entries: Vec<Meta>,
+  solved: HashMap<usize, usize>,
+  unsolved: usize,
+  trail: Vec<usize>,
+}
+
+/// # Interning keys
+///
+/// Shallow structure of a hash-consed node: variant tag, scalars and the addresses of children.
+/// Two nodes with equal keys are bitwise identical, so either one can stand for the other.
+#[derive(Debug, Clone, Copy, PartialEq, Eq, Hash)]
+enum Key {
+  Term(TypeId, u8, usize, usize, usize),
+  Val(u8, usize, usize, usize),
+}
+
+/// Number of preallocated universes, see [`Arena::term`] and [`Arena::val`].
+const SMALL_UNIVS: usize = 4;
+
+/// Number of preallocated variables, see [`Arena::term`] and [`Arena::val`].
+const SMALL_VARS: usize = 256;
+
+/// Universe and variable core terms with small levels and indices.
+static SMALL_TERMS: ([Term<Core>; SMALL_UNIVS], [Term<Core>; SMALL_VARS]) = {
+  let (mut univs, mut vars) = ([Term::Univ(0); SMALL_UNIVS], [Term::Var(0); SMALL_VARS]);
+  let mut i = 0;
+  while i < SMALL_VARS {
+    if i < SMALL_UNIVS {
+      univs[i] = Term::Univ(i);
+    }
+    vars[i] = Term::Var(i);
+    i += 1;
+  }
+  (univs, vars)
+};
+
+/// Universe and free variable values with small levels.
+static SMALL_VALS: ([Val; SMALL_UNIVS], [Val; SMALL_VARS]) = {
+  let (mut univs, mut frees) = ([Val::Univ(0); SMALL_UNIVS], [Val::Free(0); SMALL_VARS]);
+  let mut i = 0;
+  while i < SMALL_VARS {
+    if i < SMALL_UNIVS {
+      univs[i] = Val::Univ(i);
+    }
+    frees[i] = Val::Free(i);
+    i += 1;
+  }
+  (univs, frees)
+};
+
+/// Returns the address of a reference, for use in interning and forwarding keys.
+fn addr<T: ?Sized>(x: &T) -> usize {
+  x as *const T as *const () as usize
+}
+
+impl Key {
+  /// Returns the key of an internable term, or [`None`] if it should always be freshly allocated.
+  fn term<T: Decoration>(term: &Term<'_, '_, T>) -> Option<Self> {
+    let key = |tag, x, y, z| Some(Key::Term(TypeId::of::<T>(), tag, x, y, z));
+    match term {
+      Term::Univ(v) => key(0, *v, 0, 0),
+      Term::Var(ix) => key(1, *ix, 0, 0),
+      Term::Ann(x, t) => key(2, addr(*x), addr(*t), 0),
+      Term::Let(info, v, x) => key(3, addr(*info), addr(*v), addr(*x)),
+      Term::Pi(info, t, u) => key(4, addr(*info), addr(*t), addr(*u)),
+      Term::Fun(info, b) => key(5, addr(*info), addr(*b), 0),
+      Term::App(f, x, dot) => key(6, addr(*f), addr(*x), *dot as usize),
+      Term::Init(n, x) => key(7, *n, addr(*x), 0),
+      Term::Proj(n, x) => key(8, *n, addr(*x), 0),
+      Term::Const(g) => key(9, addr(*g), 0, 0),
+      Term::Gc(_) | Term::Sig(_) | Term::Tup(_) | Term::Meta(_) | Term::NamedVar(..) | Term::NamedProj(..) => None,
+    }
+  }
+
+  /// Returns the key of an internable value, or [`None`] if it should always be freshly allocated.
+  fn val(val: &Val) -> Option<Self> {
+    let key = |tag, x, y, z| Some(Key::Val(tag, x, y, z));
+    match val {
+      Val::Univ(v) => key(0, *v, 0, 0),
+      Val::Free(i) => key(1, *i, 0, 0),
+      Val::Pi(t, u) => key(2, addr(*t), addr(*u), 0),
+      Val::Fun(b) => key(3, addr(*b), 0, 0),
+      Val::App(f, x, dot) => key(4, addr(*f), addr(*x), *dot as usize),
+      Val::Init(n, x) => key(5, *n, addr(*x), 0),
+      Val::Proj(n, x) => key(6, *n, addr(*x), 0),
+      Val::Def(x) => key(7, addr(*x), 0, 0),
+      Val::Glued(f, u) => key(8, addr(*f), addr(*u), 0),
+      Val::Sig(_) | Val::Tup(_) | Val::Meta(..) => None,
+    }
+  }
 }
 
 /// # Relocation trait
@@ -36,77 +217,686 @@ impl Arena {
     Self::default()
   }
 
+  /// Records the size of a new allocation.
+  fn counted<'b, T: ?Sized>(&self, x: &'b mut T) -> &'b mut T {
+    self.usage.add(size_of_val(x));
+    x
+  }
+
+  /// Creates a new region, reusing memory of previously dropped regions if possible.
+  pub fn region(&self) -> Region<'_> {
+    let mut arena = self.child();
+    arena.symbol_parent = Some(addr(self));
+    let metas = Metas {
+      parent: Some(addr(self)),
+      base: self.meta_count(),
+      unsolved: self.unsolved_meta_count(),
+      ..Metas::default()
+    };
+    arena.metas.replace(metas);
+    // Regions run on the same thread, so they may use workers as well.
+    arena.set_threads(self.threads());
+    self.regions.set(self.regions.get() + 1);
+    Region { parent: self, arena }
+  }
+
+  /// Creates a new arena for use by another thread, reusing memory of previously dropped regions
+  /// if possible. Gluing, interning, memoisation and byte limit settings, the remaining fuel and the
+  /// metacontext are inherited, but nested parallelism is not. The worker counts the bytes live in
+  /// `self` towards its limit, but not those of other workers.
+  /// Surviving objects must be relocated into `self` before returning it with [`Arena::reclaim`].
+  pub fn worker(&self) -> Arena {
+    let arena = self.child();
+    // Workers run on other threads, so they get their own copy of the metacontext.
+    let entries = (0..self.meta_count()).map(|m| self.meta_entry(m).unwrap()).collect();
+    arena.metas.replace(Metas { entries, unsolved: self.unsolved_meta_count(), ..Metas::default() });
+    arena
+  }
+
+  /// Creates a new arena with the settings of `self`, reusing memory of previously dropped regions
+  /// if possible.
+  fn child(&self) -> Arena {
+    let arena = Arena {
+      data: self.spare.borrow_mut().pop().unwrap_or_default(),
+      usage: self.usage.child(),
+      #[cfg(feature = "profiling")]
+      profile: self.profile.child(),
+      ..Arena::default()
+    };
+    arena.set_gluing(self.gluing());
+    arena.set_interning(self.interning.get());
+    // SAFETY: values quoted into the child are allocated in it or outlive it, since it borrows them
+    // from `self` or allocates them itself, and its table is dropped along with it.
+    unsafe { arena.set_memoising(self.memoising.get()) };
+    arena.set_fuel(self.fuel());
+    arena
+  }
+
+  /// Frees all objects in a region or worker arena, keeping its memory for reuse and merging its
+  /// lookup and step counters into `self`. Steps taken in `arena` are charged to the fuel of `self`. Holes created or solved in `arena` are relocated into `self`.
+  pub fn reclaim(&self, mut arena: Arena) {
+    if arena.metas.borrow().parent == Some(addr(self)) {
+      self.regions.set(self.regions.get() - 1);
+    }
+    self.merge_metas(&arena);
+    // Recorded addresses may point into the reclaimed memory.
+    self.quoted.borrow_mut().clear();
+    let mut data = take(&mut arena.data);
+    data.reset();
+    let mut spare = self.spare.borrow_mut();
+    spare.push(data);
+    spare.append(arena.spare.get_mut());
+    self.usage.merge(&arena.usage);
+    self.freed_bytes.set(self.freed_bytes.get() + arena.usage.bytes() + arena.freed_bytes.get());
+    self.lookup_count.set(self.lookup_count.get() + arena.lookup_count.get());
+    self.link_count.set(self.link_count.get() + arena.link_count.get());
+    self.step_count.set(self.step_count.get() + arena.step_count.get());
+    self.fuel.set(self.fuel.get().map(|fuel| fuel.saturating_sub(arena.step_count.get())));
+    #[cfg(feature = "profiling")]
+    self.profile.merge(take(&mut arena.profile));
+  }
+
+  /// Runs `f`, which relocates objects from a region into `self`, and records the number of bytes
+  /// copied in the process.
+  ///
+  /// During `f`, relocated objects are recorded in a forwarding table, so that objects reachable
+  /// along several paths (e.g. shared stack prefixes of closures) are copied only once. Without
+  /// the table, relocating a DAG would unfold it into a tree, in the worst case exponentially
+  /// larger. See [`Arena::relocate_term`] and friends.
+  pub fn copy_in<T>(&self, f: impl FnOnce() -> T) -> T {
+    let before = self.usage.bytes();
+    let res = self.forwarded.scope(f);
+    self.copied_bytes.set(self.copied_bytes.get() + (self.usage.bytes() - before));
+    res
+  }
+
+  /// Returns the existing copy of a relocated object, or makes a new copy (and records it if
+  /// inside [`Arena::copy_in`]).
+  fn forward<'a, S, T>(&'a self, tag: u8, x: &S, copy: impl FnOnce() -> &'a T) -> &'a T {
+    // SAFETY: each tag is only used for one type of copies, which are allocated in this arena.
+    unsafe { self.forwarded.forward(tag, x, copy) }
+  }
+
+  /// Returns the existing copy of a relocated slice, or makes a new copy (and records it if
+  /// inside [`Arena::copy_in`]).
+  fn forward_slice<'a, S, T>(&'a self, tag: u8, xs: &[S], copy: impl FnOnce() -> &'a [T]) -> &'a [T] {
+    // SAFETY: as in `forward()`, copies of slices have the same lengths as their originals.
+    unsafe { self.forwarded.forward_slice(tag, xs, copy) }
+  }
+
+  /// Relocates a term into the arena, copying it only once inside [`Arena::copy_in`].
+  pub fn relocate_term<'a, 'b, T: Decoration>(&'a self, term: &Term<'_, 'b, T>) -> &'a Term<'a, 'b, T> {
+    self.forward(0, term, || self.term(term.relocate(self)))
+  }
+
+  /// Relocates a value into the arena, copying it only once inside [`Arena::copy_in`].
+  pub fn relocate_val<'a, 'b>(&'a self, val: &Val<'_, 'b>) -> &'a Val<'a, 'b> {
+    self.forward(1, val, || self.val(val.relocate(self)))
+  }
+
+  /// Relocates a closure into the arena, copying it only once inside [`Arena::copy_in`].
+  pub fn relocate_clos<'a, 'b>(&'a self, clos: &Clos<'_, 'b>) -> &'a Clos<'a, 'b> {
+    self.forward(2, clos, || self.clos(clos.relocate(self)))
+  }
+
+  /// Relocates a stack item into the arena, copying it only once inside [`Arena::copy_in`].
+  pub fn relocate_frame<'a, 'b>(&'a self, stack: &Stack<'_, 'b>) -> &'a Stack<'a, 'b> {
+    self.forward(3, stack, || self.frame(stack.relocate(self)))
+  }
+
   /// Allocates a new string.
   pub fn string<'b>(&'b self, string: &str) -> &'b str {
-    self.data.alloc_str(string)
+    self.counted(self.data.alloc_str(string))
   }
 
-  /// Allocates a new array of strings.
+  /// Returns the interned copy of a string, allocating it on first use. The table is freed along
+  /// with the arena (or when it is reset). Regions intern in the table of their parent, so that
+  /// their names compare equal to those of the parent (see [`crate::ir::Name`]), and so do not
+  /// free their names when dropped. Workers have a table of their own, since they run on other
+  /// threads: checking does not create names, so they intern none in practice.
+  pub fn symbol<'b>(&'b self, string: &str) -> &'b str {
+    if let Some(parent) = self.symbol_parent {
+      // SAFETY: as in `meta_entry()`, the parent of a region outlives it and is not reset while
+      // the region is alive.
+      return unsafe { &*(parent as *const Arena) }.symbol(string);
+    }
+    if let Some(symbol) = self.symbols.borrow().get(string) {
+      return symbol;
+    }
+    let symbol = self.string(string);
+    // SAFETY: the string lives in this arena, and is removed from the table on reset. It is only
+    // handed out with the lifetime of the borrow of the arena.
+    self.symbols.borrow_mut().insert(unsafe { &*(symbol as *const str) });
+    symbol
+  }
+
+  /// Allocates a new array of interned strings.
   pub fn strings<'b>(&'b self, strings: &[&str]) -> &'b [&'b str] {
-    self.data.alloc_slice_copy(&strings.iter().map(|s| self.string(s)).collect::<Vec<_>>())
+    self.counted(self.data.alloc_slice_copy(&strings.iter().map(|s| self.symbol(s)).collect::<Vec<_>>()))
   }
 
   /// Allocates a new bound variable info.
   pub fn bound<'b>(&'b self, bound: Bound<'b>) -> &'b Bound<'b> {
-    self.data.alloc(bound)
+    self.counted(self.data.alloc(bound))
   }
 
   /// Allocates a new field variable info.
   pub fn field<'b>(&'b self, field: Field<'b>) -> &'b Field<'b> {
-    self.data.alloc(field)
+    self.counted(self.data.alloc(field))
+  }
+
+  /// Enables or disables glued evaluation of `let`-bound definitions. This speeds up conversion
+  /// checking of types mentioning definitions, at the cost of extra allocations on every
+  /// application headed by a definition, so it is best enabled only during elaboration.
+  pub fn set_gluing(&self, gluing: bool) {
+    self.gluing.set(gluing);
+  }
+
+  /// Returns if glued evaluation is enabled.
+  pub fn gluing(&self) -> bool {
+    self.gluing.get()
+  }
+
+  /// Sets the number of worker threads for checking the fields of large tuple constructors, in
+  /// elaboration and in [`Term::check`], as soon as the earlier fields they mention are checked.
+  /// Each thread allocates in its own [`Arena::worker`]. Regions inherit the setting, but workers
+  /// do not. Values below 2 disable parallel checking, which is the default.
+  pub fn set_threads(&self, threads: usize) {
+    self.threads.set(threads);
+  }
+
+  /// Returns the number of worker threads for parallel checking.
+  pub fn threads(&self) -> usize {
+    self.threads.get()
+  }
+
+  /// Limits the number of (β) steps (see [`Arena::step`]) which evaluation, conversion checking and
+  /// type checking in the arena may take from now on, or removes the limit if [`None`], which is the
+  /// default. Once the limit is reached, they fail with [`crate::ir::EvalError::OutOfFuel`].
+  ///
+  /// Regions and workers start with the remaining fuel of their parent, and are charged to it when
+  /// reclaimed, so workers running in parallel may together exceed the limit by a factor of
+  /// [`Arena::threads`].
+  pub fn set_fuel(&self, fuel: Option<usize>) {
+    self.fuel.set(fuel);
   }
 
-  /// Allocates a new term.
+  /// Returns the remaining number of (β) steps, or [`None`] if unlimited.
+  pub fn fuel(&self) -> Option<usize> {
+    self.fuel.get()
+  }
+
+  /// Records a (β) step, i.e. a function body or binder instantiated with an argument, consuming
+  /// one unit of fuel. Returns `false` (without recording) if the fuel is exhausted.
+  pub fn step(&self) -> bool {
+    match self.fuel.get() {
+      Some(0) => return false,
+      Some(fuel) => self.fuel.set(Some(fuel - 1)),
+      None => {}
+    }
+    self.step_count.set(self.step_count.get() + 1);
+    true
+  }
+
+  /// Sets or removes the limit on the number of bytes live in the arena and the arenas it is nested
+  /// in, which is inherited by regions and workers created afterwards. There is no limit by
+  /// default. Allocations do not fail, but once over the limit, evaluation, conversion checking and
+  /// type checking fail with [`crate::ir::EvalError::OutOfMemory`] at the next (β) step or quoted
+  /// value.
+  pub fn set_byte_limit(&self, limit: Option<usize>) {
+    self.usage.set_limit(limit);
+  }
+
+  /// Returns the limit on the number of bytes live in the arena and the arenas it is nested in.
+  pub fn byte_limit(&self) -> Option<usize> {
+    self.usage.limit()
+  }
+
+  /// Returns if the bytes live in the arena and the arenas it is nested in are over the limit.
+  #[inline]
+  pub fn over_byte_limit(&self) -> bool {
+    self.usage.exceeded()
+  }
+
+  /// Enables or disables hash-consing in [`Arena::term`] and [`Arena::val`].
+  pub fn set_interning(&self, interning: bool) {
+    self.interning.set(interning);
+  }
+
+  /// Enables or disables memoisation of [`Val::quote`] (and [`crate::ir::Machine::quote`]): the
+  /// quoted forms of values allocated in the arena are recorded by address and context size, so
+  /// that shared subvalues are quoted only once. This speeds up quoting of values with much
+  /// sharing (e.g. tree-like results of evaluation), at the cost of a table lookup per subvalue,
+  /// which roughly doubles the time of quoting values without sharing. Disabled by default.
+  ///
+  /// The table is cleared whenever a region or worker is reclaimed, since the addresses of values
+  /// freed with it are reused by later regions, and whenever a hole is solved or forgotten, since
+  /// quoted forms inline the solutions of holes. See the `sharing` cases of the `examples`
+  /// benchmark for the trade-off.
+  ///
+  /// # Safety
+  ///
+  /// The table is keyed by address, so a value freed while it is recorded would make a later value
+  /// at the same address be quoted as the former, with references to freed memory. Until
+  /// memoisation is disabled again or the arena is reset, every value quoted into the arena must
+  /// therefore stay allocated, unless it is allocated in the arena itself or in one of its regions
+  /// or workers. Values of an arena outliving `self` satisfy this.
+  pub unsafe fn set_memoising(&self, memoising: bool) {
+    self.memoising.set(memoising);
+    if !memoising {
+      self.quoted.borrow_mut().clear();
+    }
+  }
+
+  /// Returns if memoisation of quoted values is enabled.
+  pub fn memoising(&self) -> bool {
+    self.memoising.get()
+  }
+
+  /// Returns the recorded quoted form of a value under a context with given size, if memoisation
+  /// is enabled and there is one.
+  pub(crate) fn quoted<'a, 'b>(&'a self, val: &'a Val<'a, 'b>, len: usize) -> Option<&'a Term<'a, 'b, Core>> {
+    if !self.memoising.get() {
+      return None;
+    }
+    self.memo_count.set(self.memo_count.get() + 1);
+    let addr = *self.quoted.borrow().get(&(addr(val), len))?;
+    self.memo_hit_count.set(self.memo_hit_count.get() + 1);
+    // SAFETY: the address points to a term in this arena which is not freed until the table is
+    // cleared, see `memo_quoted()`. It was quoted from `val` itself rather than from an earlier
+    // value at the same address, see `set_memoising()`.
+    Some(unsafe { &*(addr as *const Term<'a, 'b, Core>) })
+  }
+
+  /// Allocates the quoted form of a value under a context with given size, and records it if
+  /// memoisation is enabled. The term must have been quoted into this arena, so that all its
+  /// nodes live as long as the table entry.
+  pub(crate) fn memo_quoted<'a, 'b>(
+    &'a self,
+    val: &'a Val<'a, 'b>,
+    len: usize,
+    term: Term<'a, 'b, Core>,
+  ) -> &'a Term<'a, 'b, Core> {
+    let term = self.term(term);
+    if self.memoising.get() {
+      self.quoted.borrow_mut().insert((addr(val), len), addr(term));
+    }
+    term
+  }
+
+  /// Creates a new hole of type `ty` under a context with size `scope`, and returns its id. The
+  /// type is relocated into the arena, so it may be allocated in a shorter-lived one.
+  ///
+  /// Panics if a region of the arena is alive, since the region numbers its own holes from the
+  /// current count (see [`Arena::region`]).
+  pub fn meta<'b>(&self, scope: usize, ty: &Term<'_, 'b, Core>) -> usize {
+    assert_eq!(self.regions.get(), 0, "holes created while a region is alive");
+    let ty = addr(self.copy_in(|| self.relocate_term(ty)));
+    let mut metas = self.metas.borrow_mut();
+    metas.entries.push(Meta { scope, ty, sol: None });
+    metas.unsolved += 1;
+    metas.base + metas.entries.len() - 1
+  }
+
+  /// Returns the metacontext entry of a hole, if it exists.
+  fn meta_entry(&self, m: usize) -> Option<Meta> {
+    let metas = self.metas.borrow();
+    if m >= metas.base {
+      return metas.entries.get(m - metas.base).copied();
+    }
+    // SAFETY: regions are created by `region()`, and the `Region` borrows the parent for as long
+    // as the region's arena is alive, so the parent is neither moved nor reset. While the region
+    // is alive, the parent's holes below `base` are neither removed nor renumbered, see the
+    // assertions in `meta()` and `rollback_metas()`.
+    let parent = unsafe { &*(metas.parent? as *const Arena) };
+    let meta = parent.meta_entry(m)?;
+    Some(Meta { sol: metas.solved.get(&m).copied().or(meta.sol), ..meta })
+  }
+
+  /// Returns the size of the context a hole was created in, if it exists.
+  pub fn meta_scope(&self, m: usize) -> Option<usize> {
+    self.meta_entry(m).map(|meta| meta.scope)
+  }
+
+  /// Returns the type of a hole, which is a term under its scope, if it exists.
+  ///
+  /// # Safety
+  ///
+  /// The binder information and global definitions referred to by terms in the metacontext are
+  /// not relocated, so `'b` must not outlive those the hole was created with (see [`Arena::meta`]).
+  /// Checkers keep the same `'b` for all holes in an arena, which satisfies this.
+  pub unsafe fn meta_type<'a, 'b: 'a>(&'a self, m: usize) -> Option<&'a Term<'a, 'b, Core>> {
+    let addr = self.meta_entry(m)?.ty;
+    // SAFETY: the address points to a live term in this arena or an arena outliving it, see
+    // `meta()` and `merge_metas()`. The caller guarantees that `'b` is valid.
+    Some(unsafe { &*(addr as *const Term<'a, 'b, Core>) })
+  }
+
+  /// Returns the solution of a hole, which is a term under its scope, if it has been solved.
+  ///
+  /// # Safety
+  ///
+  /// As in [`Arena::meta_type`], `'b` must not outlive the binder information and global
+  /// definitions the solution was created with (see [`Arena::solve_meta`]).
+  pub unsafe fn meta_solution<'a, 'b: 'a>(&'a self, m: usize) -> Option<&'a Term<'a, 'b, Core>> {
+    let addr = self.meta_entry(m)?.sol?;
+    // SAFETY: as in `meta_type()`.
+    Some(unsafe { &*(addr as *const Term<'a, 'b, Core>) })
+  }
+
+  /// Returns if a hole exists and has been solved.
+  pub fn meta_solved(&self, m: usize) -> bool {
+    self.meta_entry(m).is_some_and(|meta| meta.sol.is_some())
+  }
+
+  /// Returns if any hole in the metacontext has been solved.
+  pub(crate) fn any_meta_solved(&self) -> bool {
+    let metas = self.metas.borrow();
+    metas.unsolved < metas.base + metas.entries.len()
+  }
+
+  /// Records the solution of an unsolved hole. Unlike [`Arena::meta`], the solution is not
+  /// relocated, since the search restores earlier solutions often: it must be allocated in this
+  /// arena or an arena outliving it.
+  pub(crate) fn solve_meta<'a, 'b>(&'a self, m: usize, sol: &'a Term<'a, 'b, Core>) {
+    debug_assert!(self.meta_entry(m).is_some_and(|meta| meta.sol.is_none()), "hole ?{m} solved twice");
+    self.set_meta_solution(m, Some(addr(sol)));
+  }
+
+  /// Forgets the solution of a solved hole.
+  pub(crate) fn unsolve_meta(&self, m: usize) {
+    debug_assert!(self.meta_entry(m).is_some_and(|meta| meta.sol.is_some()), "hole ?{m} not solved");
+    self.set_meta_solution(m, None);
+  }
+
+  /// Sets or clears the solution of a hole, updating the count of unsolved holes and the trail.
+  fn set_meta_solution(&self, m: usize, sol: Option<usize>) {
+    // Quoted forms of values mentioning the hole are no longer valid.
+    self.quoted.borrow_mut().clear();
+    let mut metas = self.metas.borrow_mut();
+    if sol.is_some() {
+      metas.unsolved -= 1;
+      metas.trail.push(m);
+    } else {
+      metas.unsolved += 1;
+    }
+    let base = metas.base;
+    match (m.checked_sub(base), sol) {
+      (Some(i), _) => metas.entries[i].sol = sol,
+      (None, Some(sol)) => drop(metas.solved.insert(m, sol)),
+      (None, None) => drop(metas.solved.remove(&m)),
+    }
+  }
+
+  /// Returns the number of holes in the metacontext.
+  pub fn meta_count(&self) -> usize {
+    let metas = self.metas.borrow();
+    metas.base + metas.entries.len()
+  }
+
+  /// Returns the number of unsolved holes in the metacontext.
+  pub fn unsolved_meta_count(&self) -> usize {
+    self.metas.borrow().unsolved
+  }
+
+  /// Returns a mark of the current metacontext, i.e. the number of holes and the length of the
+  /// trail of solved holes, for use with [`Arena::solved_since`] and [`Arena::rollback_metas`].
+  pub(crate) fn meta_mark(&self) -> (usize, usize) {
+    let metas = self.metas.borrow();
+    (metas.base + metas.entries.len(), metas.trail.len())
+  }
+
+  /// Returns the holes solved since `mark`, in order, including those which were solved and then
+  /// forgotten.
+  pub(crate) fn solved_since(&self, mark: (usize, usize)) -> Vec<usize> {
+    self.metas.borrow().trail[mark.1..].to_vec()
+  }
+
+  /// Restores the metacontext to `mark`: forgets solutions found since then, and removes holes
+  /// created since then. Holes created before `mark` must not be forgotten since then.
+  ///
+  /// Panics if holes would be removed while a region of the arena is alive, as in [`Arena::meta`].
+  pub(crate) fn rollback_metas(&self, mark: (usize, usize)) {
+    let (count, len) = mark;
+    let solved = self.metas.borrow_mut().trail.split_off(len);
+    for m in solved.into_iter().rev().filter(|m| *m < count) {
+      if self.meta_entry(m).is_some_and(|meta| meta.sol.is_some()) {
+        self.set_meta_solution(m, None);
+      }
+    }
+    let mut metas = self.metas.borrow_mut();
+    assert!(count >= metas.base, "cannot remove holes of the parent arena");
+    assert!(
+      self.regions.get() == 0 || count == metas.base + metas.entries.len(),
+      "holes removed while a region is alive"
+    );
+    let base = metas.base;
+    let removed = metas.entries.split_off(count - base);
+    metas.unsolved -= removed.iter().filter(|meta| meta.sol.is_none()).count();
+    metas.trail.truncate(len);
+  }
+
+  /// Relocates holes created or solved in a region or worker arena into `self`.
+  fn merge_metas(&self, arena: &Arena) {
+    let theirs = take(&mut *arena.metas.borrow_mut());
+    // SAFETY: the addresses point to live terms in `arena` or arenas outliving it. The lifetime
+    // `'static` of their references to binder information and global definitions is only used to
+    // copy them over unchanged.
+    let term = |addr: usize| unsafe { &*(addr as *const Term<'_, 'static, Core>) };
+    let push = |meta: &Meta| {
+      let ty = addr(self.relocate_term(term(meta.ty)));
+      let sol = meta.sol.map(|sol| addr(self.relocate_term(term(sol))));
+      let mut metas = self.metas.borrow_mut();
+      metas.entries.push(Meta { scope: meta.scope, ty, sol });
+      metas.unsolved += sol.is_none() as usize;
+    };
+    if theirs.parent == Some(addr(self)) {
+      // Regions only record changes.
+      if theirs.solved.is_empty() && theirs.entries.is_empty() {
+        return;
+      }
+      assert_eq!(theirs.base, self.meta_count(), "holes created while a region is alive");
+      self.copy_in(|| {
+        for (m, sol) in theirs.solved {
+          self.set_meta_solution(m, Some(addr(self.relocate_term(term(sol)))));
+        }
+        theirs.entries.iter().for_each(push);
+      });
+      return;
+    }
+    if theirs.entries.len() == self.meta_count() && theirs.unsolved == self.unsolved_meta_count() {
+      return;
+    }
+    self.copy_in(|| {
+      for (m, meta) in theirs.entries.iter().enumerate() {
+        match (self.meta_entry(m).map(|ours| ours.sol.is_some()), meta.sol) {
+          (Some(false), Some(sol)) => self.set_meta_solution(m, Some(addr(self.relocate_term(term(sol))))),
+          (Some(_), _) => {}
+          (None, _) => push(meta),
+        }
+      }
+    });
+  }
+
+  /// Looks up `key` in the interning table, or inserts the address returned by `alloc`.
+  fn intern(&self, key: Key, alloc: impl FnOnce() -> usize) -> usize {
+    self.intern_count.set(self.intern_count.get() + 1);
+    if let Some(addr) = self.interned.borrow().get(&key) {
+      self.intern_hit_count.set(self.intern_hit_count.get() + 1);
+      return *addr;
+    }
+    let addr = alloc();
+    self.interned.borrow_mut().insert(key, addr);
+    addr
+  }
+
+  /// Allocates a new global definition.
+  pub fn global<'b>(&'b self, global: Global<'b>) -> &'b Global<'b> {
+    self.counted(self.data.alloc(global))
+  }
+
+  /// Allocates a new term, reusing an identical one if interning is enabled. Core universes and
+  /// variables with small levels and indices are shared instead, and not counted.
   pub fn term<'a, 'b, T: Decoration>(&'a self, term: Term<'a, 'b, T>) -> &'a Term<'a, 'b, T> {
+    if TypeId::of::<T>() == TypeId::of::<Core>() {
+      let small = match term {
+        Term::Univ(v) if v < SMALL_UNIVS => Some(&SMALL_TERMS.0[v]),
+        Term::Var(ix) if ix < SMALL_VARS => Some(&SMALL_TERMS.1[ix]),
+        _ => None,
+      };
+      if let Some(small) = small {
+        // SAFETY: `T` is `Core`, and the static term has no references, so it is valid for any
+        // lifetimes.
+        return unsafe { &*(small as *const Term<Core> as *const Term<'a, 'b, T>) };
+      }
+    }
+    if self.interning.get() {
+      return self.term_interned(term);
+    }
     self.term_count.set(self.term_count.get() + 1);
-    self.data.alloc(term)
+    self.counted(self.data.alloc(term))
+  }
+
+  /// Allocates a new term, reusing an identical one if it has been interned before.
+  pub fn term_interned<'a, 'b, T: Decoration>(&'a self, term: Term<'a, 'b, T>) -> &'a Term<'a, 'b, T> {
+    let Some(key) = Key::term(&term) else {
+      self.term_count.set(self.term_count.get() + 1);
+      return self.counted(self.data.alloc(term));
+    };
+    let addr = self.intern(key, || {
+      self.term_count.set(self.term_count.get() + 1);
+      addr(self.counted(self.data.alloc(term)))
+    });
+    // SAFETY: the address points to a live term in this arena. Since keys include the decoration
+    // type and all child addresses, it is bitwise identical to `term`, whose references are valid
+    // for the requested lifetimes.
+    unsafe { &*(addr as *const Term<'a, 'b, T>) }
   }
 
   /// Allocates a new array of terms with field info for writing.
   pub fn terms<'b, T: Decoration>(&self, len: usize) -> &mut [(&'b Field<'b>, Term<'_, 'b, T>)] {
     self.term_count.set(self.term_count.get() + len);
-    self.data.alloc_slice_fill_copy(len, (Field::empty(), Term::Univ(0)))
+    self.counted(self.data.alloc_slice_fill_copy(len, (Field::empty(), Term::Univ(0))))
   }
 
-  /// Allocates a new value.
+  /// Allocates a new value, reusing an identical one if interning is enabled. Universes and free
+  /// variables with small levels are shared instead, and not counted.
   pub fn val<'a, 'b>(&'a self, val: Val<'a, 'b>) -> &'a Val<'a, 'b> {
+    match val {
+      Val::Univ(v) if v < SMALL_UNIVS => return &SMALL_VALS.0[v],
+      Val::Free(i) if i < SMALL_VARS => return &SMALL_VALS.1[i],
+      _ => {}
+    }
+    if self.interning.get() {
+      return self.val_interned(val);
+    }
     self.val_count.set(self.val_count.get() + 1);
-    self.data.alloc(val)
+    self.counted(self.data.alloc(val))
+  }
+
+  /// Allocates a new value, reusing an identical one if it has been interned before.
+  pub fn val_interned<'a, 'b>(&'a self, val: Val<'a, 'b>) -> &'a Val<'a, 'b> {
+    let Some(key) = Key::val(&val) else {
+      self.val_count.set(self.val_count.get() + 1);
+      return self.counted(self.data.alloc(val));
+    };
+    let addr = self.intern(key, || {
+      self.val_count.set(self.val_count.get() + 1);
+      addr(self.counted(self.data.alloc(val)))
+    });
+    // SAFETY: the address points to a live value in this arena. Since keys include all child
+    // addresses, it is bitwise identical to `val`, whose references are valid for the requested
+    // lifetimes.
+    unsafe { &*(addr as *const Val<'a, 'b>) }
   }
 
   /// Allocates a new array of values with field info for writing.
   pub fn values<'b>(&self, len: usize) -> &mut [(&'b Field<'b>, Val<'_, 'b>)] {
     self.val_count.set(self.val_count.get() + len);
-    self.data.alloc_slice_fill_copy(len, (Field::empty(), Val::Univ(0)))
+    self.counted(self.data.alloc_slice_fill_copy(len, (Field::empty(), Val::Univ(0))))
   }
 
   /// Allocates a new closure.
   pub fn clos<'a, 'b>(&'a self, clos: Clos<'a, 'b>) -> &'a Clos<'a, 'b> {
     self.clos_count.set(self.clos_count.get() + 1);
-    self.data.alloc(clos)
+    self.counted(self.data.alloc(clos))
   }
 
   /// Allocates a new array of closures with field info for writing.
   pub fn closures<'b>(&self, len: usize) -> &mut [(&'b Field<'b>, Clos<'_, 'b>)] {
     let empty = (Field::empty(), Clos { info: Bound::empty(), env: Stack::Nil, body: &Term::Univ(0) });
     self.clos_count.set(self.clos_count.get() + len);
-    self.data.alloc_slice_fill_clone(len, &empty)
+    self.counted(self.data.alloc_slice_fill_clone(len, &empty))
   }
 
   /// Allocates a new stack item.
   pub fn frame<'a, 'b>(&'a self, stack: Stack<'a, 'b>) -> &'a Stack<'a, 'b> {
     self.frame_count.set(self.frame_count.get() + 1);
-    self.data.alloc(stack)
+    self.counted(self.data.alloc(stack))
   }
 
-  /// Increments the stack lookup counter for profiling.
+  /// Allocates a new name index node.
+  pub fn name_index<'a, 'b>(&'a self, index: Index<'a, 'b>) -> &'a Index<'a, 'b> {
+    self.counted(self.data.alloc(index))
+  }
+
+  /// Allocates a new array of name index slots.
+  pub(crate) fn slots<'a, 'b>(&'a self, slots: &[Slot<'a, 'b>]) -> &'a [Slot<'a, 'b>] {
+    self.counted(self.data.alloc_slice_copy(slots))
+  }
+
+  /// Allocates other plain data (e.g. proof search states), which must not need dropping.
+  pub(crate) fn alloc<T: Copy>(&self, value: T) -> &T {
+    self.counted(self.data.alloc(value))
+  }
+
+  /// Increments the stack lookup counter for profiling, if enabled.
+  #[inline(always)]
   pub fn inc_lookup_count(&self) {
-    self.lookup_count.set(self.lookup_count.get() + 1);
+    #[cfg(feature = "profiling")]
+    {
+      self.lookup_count.set(self.lookup_count.get() + 1);
+      self.profile.lookup();
+    }
   }
 
-  /// Increments the stack lookup length counter for profiling.
+  /// Increments the stack lookup length counter for profiling, if enabled.
+  #[inline(always)]
   pub fn inc_link_count(&self) {
-    self.link_count.set(self.link_count.get() + 1);
+    #[cfg(feature = "profiling")]
+    {
+      self.link_count.set(self.link_count.get() + 1);
+      self.profile.link();
+    }
+  }
+
+  /// Records an application of operation `op` to a term or value, whose variant name is returned
+  /// by `variant`, if profiling is enabled.
+  #[inline(always)]
+  #[cfg_attr(not(feature = "profiling"), allow(unused_variables))]
+  pub fn profile_rule(&self, op: Op, variant: impl FnOnce() -> &'static str) {
+    #[cfg(feature = "profiling")]
+    self.profile.rule(op, variant());
+  }
+
+  /// Runs `f` in a timing scope named `name`, if profiling is enabled.
+  #[inline(always)]
+  #[cfg_attr(not(feature = "profiling"), allow(unused_variables))]
+  pub fn profile_scope<T>(&self, name: &str, f: impl FnOnce() -> T) -> T {
+    #[cfg(feature = "profiling")]
+    self.profile.enter(name);
+    let res = f();
+    #[cfg(feature = "profiling")]
+    self.profile.exit();
+    res
+  }
+
+  /// Returns the profile, if profiling is enabled.
+  pub fn profile(&self) -> Option<&Profile> {
+    #[cfg(feature = "profiling")]
+    return Some(&self.profile);
+    #[cfg(not(feature = "profiling"))]
+    None
   }
 
   /// Returns the number of terms in the arena.
@@ -139,15 +929,88 @@ impl Arena {
     self.link_count.get() as f32 / self.lookup_count.get().max(1) as f32
   }
 
+  /// Returns the number of (β) steps taken, see [`Arena::step`].
+  pub fn step_count(&self) -> usize {
+    self.step_count.get()
+  }
+
+  /// Returns the number of bytes allocated in the arena.
+  pub fn byte_count(&self) -> usize {
+    self.usage.bytes()
+  }
+
+  /// Returns the peak number of bytes live in the arena, the arenas it is nested in and regions
+  /// nested in it (including workers, one at a time).
+  pub fn peak_bytes(&self) -> usize {
+    self.usage.peak()
+  }
+
+  /// Returns the number of bytes relocated from regions into the arena.
+  pub fn copied_bytes(&self) -> usize {
+    self.copied_bytes.get()
+  }
+
+  /// Returns the number of bytes freed by dropping regions of the arena.
+  pub fn freed_bytes(&self) -> usize {
+    self.freed_bytes.get()
+  }
+
+  /// Returns the number of interning lookups.
+  pub fn intern_count(&self) -> usize {
+    self.intern_count.get()
+  }
+
+  /// Returns the fraction of interning lookups which reused an existing node.
+  pub fn intern_hit_rate(&self) -> f32 {
+    self.intern_hit_count.get() as f32 / self.intern_count.get().max(1) as f32
+  }
+
+  /// Returns the number of lookups in the memoisation table of quoted values.
+  pub fn memo_count(&self) -> usize {
+    self.memo_count.get()
+  }
+
+  /// Returns the fraction of memoisation lookups which reused an existing quoted form.
+  pub fn memo_hit_rate(&self) -> f32 {
+    self.memo_hit_count.get() as f32 / self.memo_count.get().max(1) as f32
+  }
+
   /// Deallocates all objects and resets all performance counters.
   pub fn reset(&mut self) {
     self.data.reset();
+    self.interned.get_mut().clear();
+    self.quoted.get_mut().clear();
+    *self.metas.get_mut() = Metas::default();
+    self.symbols.get_mut().clear();
     self.term_count.set(0);
     self.val_count.set(0);
     self.clos_count.set(0);
     self.frame_count.set(0);
     self.lookup_count.set(0);
     self.link_count.set(0);
+    self.intern_count.set(0);
+    self.intern_hit_count.set(0);
+    self.memo_count.set(0);
+    self.memo_hit_count.set(0);
+    self.usage.reset();
+    self.copied_bytes.set(0);
+    self.freed_bytes.set(0);
+    #[cfg(feature = "profiling")]
+    self.profile.reset();
+  }
+}
+
+impl Deref for Region<'_> {
+  type Target = Arena;
+
+  fn deref(&self) -> &Arena {
+    &self.arena
+  }
+}
+
+impl Drop for Region<'_> {
+  fn drop(&mut self) {
+    self.parent.reclaim(take(&mut self.arena));
   }
 }
 
@@ -166,33 +1029,34 @@ impl<'a> Relocate<'a, &'a str> for &str {
 impl<'a, 'b, T: Decoration> Relocate<'a, Term<'a, 'b, T>> for Term<'_, 'b, T> {
   fn relocate(&self, ar: &'a Arena) -> Term<'a, 'b, T> {
     match self {
-      Term::Gc(x) => Term::Gc(ar.term(x.relocate(ar))),
+      Term::Gc(x) => Term::Gc(ar.relocate_term(x)),
       Term::Univ(v) => Term::Univ(*v),
       Term::Var(ix) => Term::Var(*ix),
-      Term::Ann(x, t) => Term::Ann(ar.term(x.relocate(ar)), ar.term(t.relocate(ar))),
-      Term::Let(info, v, x) => Term::Let(info, ar.term(v.relocate(ar)), ar.term(x.relocate(ar))),
-      Term::Pi(info, t, u) => Term::Pi(info, ar.term(t.relocate(ar)), ar.term(u.relocate(ar))),
-      Term::Fun(info, b) => Term::Fun(info, ar.term(b.relocate(ar))),
-      Term::App(f, x, dot) => Term::App(ar.term(f.relocate(ar)), ar.term(x.relocate(ar)), *dot),
-      Term::Sig(us) => {
+      Term::Ann(x, t) => Term::Ann(ar.relocate_term(x), ar.relocate_term(t)),
+      Term::Let(info, v, x) => Term::Let(info, ar.relocate_term(v), ar.relocate_term(x)),
+      Term::Pi(info, t, u) => Term::Pi(info, ar.relocate_term(t), ar.relocate_term(u)),
+      Term::Fun(info, b) => Term::Fun(info, ar.relocate_term(b)),
+      Term::App(f, x, dot) => Term::App(ar.relocate_term(f), ar.relocate_term(x), *dot),
+      Term::Sig(us) => Term::Sig(ar.forward_slice(4, us, || {
         let terms = ar.terms(us.len());
         for (term, (info, u)) in terms.iter_mut().zip(us.iter()) {
           *term = (info, u.relocate(ar));
         }
-        Term::Sig(terms)
-      }
-      Term::Tup(bs) => {
+        terms
+      })),
+      Term::Tup(bs) => Term::Tup(ar.forward_slice(4, bs, || {
         let terms = ar.terms(bs.len());
         for (term, (info, b)) in terms.iter_mut().zip(bs.iter()) {
           *term = (info, b.relocate(ar));
         }
-        Term::Tup(terms)
-      }
-      Term::Init(n, x) => Term::Init(*n, ar.term(x.relocate(ar))),
-      Term::Proj(n, x) => Term::Proj(*n, ar.term(x.relocate(ar))),
+        terms
+      })),
+      Term::Init(n, x) => Term::Init(*n, ar.relocate_term(x)),
+      Term::Proj(n, x) => Term::Proj(*n, ar.relocate_term(x)),
       Term::Meta(m) => Term::Meta(*m),
       Term::NamedVar(s, ext) => Term::NamedVar(*s, *ext),
-      Term::NamedProj(s, x, ext) => Term::NamedProj(*s, ar.term(x.relocate(ar)), *ext),
+      Term::NamedProj(s, x, ext) => Term::NamedProj(*s, ar.relocate_term(x), *ext),
+      Term::Const(g) => Term::Const(g),
     }
   }
 }
@@ -202,26 +1066,28 @@ impl<'a, 'b> Relocate<'a, Val<'a, 'b>> for Val<'_, 'b> {
     match self {
       Val::Univ(v) => Val::Univ(*v),
       Val::Free(i) => Val::Free(*i),
-      Val::Pi(t, u) => Val::Pi(ar.val(t.relocate(ar)), ar.clos(u.relocate(ar))),
-      Val::Fun(b) => Val::Fun(ar.clos(b.relocate(ar))),
-      Val::App(f, x, dot) => Val::App(ar.val(f.relocate(ar)), ar.val(x.relocate(ar)), *dot),
-      Val::Sig(us) => {
+      Val::Pi(t, u) => Val::Pi(ar.relocate_val(t), ar.relocate_clos(u)),
+      Val::Fun(b) => Val::Fun(ar.relocate_clos(b)),
+      Val::App(f, x, dot) => Val::App(ar.relocate_val(f), ar.relocate_val(x), *dot),
+      Val::Sig(us) => Val::Sig(ar.forward_slice(5, us, || {
         let closures = ar.closures(us.len());
         for (closure, (info, u)) in closures.iter_mut().zip(us.iter()) {
           *closure = (info, u.relocate(ar));
         }
-        Val::Sig(closures)
-      }
-      Val::Tup(bs) => {
+        closures
+      })),
+      Val::Tup(bs) => Val::Tup(ar.forward_slice(6, bs, || {
         let values = ar.values(bs.len());
         for (value, (info, b)) in values.iter_mut().zip(bs.iter()) {
           *value = (info, b.relocate(ar));
         }
-        Val::Tup(values)
-      }
-      Val::Init(n, x) => Val::Init(*n, ar.val(x.relocate(ar))),
-      Val::Proj(n, x) => Val::Proj(*n, ar.val(x.relocate(ar))),
-      Val::Meta(env, m) => Val::Meta(ar.frame(env.relocate(ar)), *m),
+        values
+      })),
+      Val::Init(n, x) => Val::Init(*n, ar.relocate_val(x)),
+      Val::Proj(n, x) => Val::Proj(*n, ar.relocate_val(x)),
+      Val::Def(x) => Val::Def(ar.relocate_val(x)),
+      Val::Glued(f, u) => Val::Glued(ar.relocate_val(f), ar.relocate_val(u)),
+      Val::Meta(env, m) => Val::Meta(ar.relocate_frame(env), *m),
     }
   }
 }
@@ -229,7 +1095,7 @@ impl<'a, 'b> Relocate<'a, Val<'a, 'b>> for Val<'_, 'b> {
 impl<'a, 'b> Relocate<'a, Clos<'a, 'b>> for Clos<'_, 'b> {
   fn relocate(&self, ar: &'a Arena) -> Clos<'a, 'b> {
     let Self { info, env, body } = self;
-    Clos { info, env: env.relocate(ar), body: ar.term(body.relocate(ar)) }
+    Clos { info, env: env.relocate(ar), body: ar.relocate_term(body) }
   }
 }
 
@@ -237,9 +1103,7 @@ impl<'a, 'b> Relocate<'a, Stack<'a, 'b>> for Stack<'_, 'b> {
   fn relocate(&self, ar: &'a Arena) -> Stack<'a, 'b> {
     match self {
       Stack::Nil => Stack::Nil,
-      Stack::Cons { info, prev, value } => {
-        Stack::Cons { info, prev: ar.frame(prev.relocate(ar)), value: value.relocate(ar) }
-      }
+      Stack::Cons { prev, info, value, .. } => Stack::cons(ar.relocate_frame(prev), info, value.relocate(ar)),
     }
   }
 }
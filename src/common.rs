@@ -0,0 +1,305 @@
+//! # Shared machinery
+//!
+//! Parts of the evaluators and arenas which do not depend on the term language, shared by
+//! [`crate::kernel`] and [`crate::ir`]. Everything here is generic and monomorphised for each of
+//! them, so that the kernel pays nothing for the extra information carried by the ir (e.g. binder
+//! and field info), and improvements (e.g. to stack lookups) apply to both at once.
+//!
+//! This includes the evaluator itself (evaluation, quoting and conversion checking), which is
+//! written once against [`Calculus`].
+
+mod calculus;
+
+pub use calculus::{apply, conv, eval, quote, Calculus, TermView, ValView};
+
+use std::cell::{Cell, RefCell};
+use std::cmp::max;
+use std::collections::HashMap;
+use std::slice::from_raw_parts;
+
+/// # Linked list stack frames
+///
+/// The shape of the linked list stacks used as evaluation environments, see [`crate::ir::Stack`]
+/// and [`crate::kernel::Stack`]. Each frame caches its depth, and with the `skew_stack` feature,
+/// also stores a jump pointer arranged in skew-binary fashion.
+///
+/// - See: <https://doi.org/10.1016/0020-0190(83)90106-0> (Myers' applicative random-access stack)
+pub trait Frames: Sized {
+  /// Returns the previous frame, or [`None`] if `self` is the empty stack.
+  fn prev(&self) -> Option<&Self>;
+
+  /// Returns the length of the stack.
+  fn depth(&self) -> usize;
+
+  /// Returns the jump pointer. Only called on non-empty stacks.
+  #[cfg(feature = "skew_stack")]
+  fn jump(&self) -> &Self;
+}
+
+/// Returns the frame at the given de Bruijn index, if it exists. Calls `link` on each frame
+/// traversed.
+#[cfg(not(feature = "skew_stack"))]
+#[inline]
+pub fn find<S: Frames>(top: &S, ix: usize, mut link: impl FnMut()) -> Option<&S> {
+  let mut curr = top;
+  let mut ix = ix;
+  while let Some(prev) = curr.prev() {
+    link();
+    if ix == 0 {
+      return Some(curr);
+    }
+    ix -= 1;
+    curr = prev;
+  }
+  None
+}
+
+/// Returns the frame at the given de Bruijn index, if it exists. Calls `link` on each frame
+/// traversed.
+#[cfg(feature = "skew_stack")]
+#[inline]
+pub fn find<S: Frames>(top: &S, ix: usize, mut link: impl FnMut()) -> Option<&S> {
+  let mut curr = top;
+  let target = top.depth().checked_sub(ix)?;
+  while let Some(prev) = curr.prev() {
+    link();
+    if curr.depth() == target {
+      return Some(curr);
+    }
+    let jump = curr.jump();
+    curr = if jump.depth() >= target { jump } else { prev };
+  }
+  None
+}
+
+/// Returns the jump pointer of a new frame on top of `prev`: it skips over two equally-sized
+/// blocks if possible, otherwise it points to `prev`. This maintains the skew-binary decomposition
+/// of the stack.
+#[cfg(feature = "skew_stack")]
+#[inline]
+pub fn jump<S: Frames>(prev: &S) -> &S {
+  if prev.prev().is_some() {
+    let mid = prev.jump();
+    if mid.prev().is_some() {
+      let top = mid.jump();
+      if prev.depth() - mid.depth() == mid.depth() - top.depth() {
+        return top;
+      }
+    }
+  }
+  prev
+}
+
+/// # Forwarding tables
+///
+/// Maps (tag, address, length) of relocated objects to addresses of their copies, while a
+/// relocation is in progress (see [`Forwarding::scope`]), so that objects reachable along several
+/// paths (e.g. shared stack prefixes of closures) are copied only once.
+#[derive(Debug, Default)]
+pub struct Forwarding {
+  table: RefCell<Option<Table>>,
+}
+
+/// Forwarding table from (tag, address, length) of relocated objects to addresses of their copies.
+type Table = HashMap<(u8, usize, usize), usize>;
+
+impl Forwarding {
+  /// Runs `f` with a fresh table.
+  pub fn scope<T>(&self, f: impl FnOnce() -> T) -> T {
+    let prev = self.table.replace(Some(HashMap::new()));
+    let res = f();
+    self.table.replace(prev);
+    res
+  }
+
+  /// Returns the existing copy of `x`, or makes a new copy (and records it if inside
+  /// [`Forwarding::scope`]).
+  ///
+  /// # Safety
+  ///
+  /// All copies recorded under `tag` in the current scope must be of type `T` and live for `'a`.
+  pub unsafe fn forward<'a, S, T>(&self, tag: u8, x: &S, copy: impl FnOnce() -> &'a T) -> &'a T {
+    let key = (tag, x as *const S as usize, 0);
+    if let Some(&y) = self.table.borrow().as_ref().and_then(|map| map.get(&key)) {
+      // SAFETY: by pre-conditions, the address points to a live copy made from `x`. Since `x` is
+      // borrowed for the whole relocation, its address cannot be reused by another object.
+      return unsafe { &*(y as *const T) };
+    }
+    let y = copy();
+    if let Some(map) = self.table.borrow_mut().as_mut() {
+      map.insert(key, y as *const T as usize);
+    }
+    y
+  }
+
+  /// Returns the existing copy of slice `xs`, or makes a new copy (and records it if inside
+  /// [`Forwarding::scope`]).
+  ///
+  /// # Safety
+  ///
+  /// All copies recorded under `tag` in the current scope must be slices of type `T` with the same
+  /// lengths as their originals, and live for `'a`.
+  pub unsafe fn forward_slice<'a, S, T>(&self, tag: u8, xs: &[S], copy: impl FnOnce() -> &'a [T]) -> &'a [T] {
+    let key = (tag, xs.as_ptr() as usize, xs.len());
+    if let Some(&ys) = self.table.borrow().as_ref().and_then(|map| map.get(&key)) {
+      // SAFETY: as in `forward()`, the copy has the same length as `xs`.
+      return unsafe { from_raw_parts(ys as *const T, xs.len()) };
+    }
+    let ys = copy();
+    if let Some(map) = self.table.borrow_mut().as_mut() {
+      map.insert(key, ys.as_ptr() as usize);
+    }
+    ys
+  }
+}
+
+/// # Memory usage
+///
+/// Bytes allocated in an arena, on top of the bytes live in the arenas it is nested in (its base),
+/// and an optional limit on their sum. Allocations themselves never fail: evaluators check
+/// [`Usage::exceeded`] at each (β) step and each value quoted, and stop with an error instead, so a
+/// query can only overrun the limit by the allocations between two checks.
+///
+/// Arenas only grow until they are reset, so the peak of the sum is either the current sum or the
+/// peak reached inside a nested arena which has since been dropped, see [`Usage::merge`].
+#[derive(Debug, Default)]
+pub struct Usage {
+  base: usize,
+  bytes: Cell<usize>,
+  limit: Cell<Option<usize>>,
+  nested: Cell<usize>,
+}
+
+impl Usage {
+  /// Returns the usage of a new arena nested in `self`, with the same limit.
+  pub fn child(&self) -> Self {
+    let base = self.base + self.bytes.get();
+    Self { base, limit: Cell::new(self.limit.get()), nested: Cell::new(base), ..Self::default() }
+  }
+
+  /// Records a new allocation of `n` bytes.
+  #[inline]
+  pub fn add(&self, n: usize) {
+    self.bytes.set(self.bytes.get() + n);
+  }
+
+  /// Records the peak of a nested arena which is about to be dropped.
+  pub fn merge(&self, child: &Self) {
+    self.nested.set(max(self.nested.get(), child.peak()));
+  }
+
+  /// Returns the number of bytes allocated in the arena itself.
+  pub fn bytes(&self) -> usize {
+    self.bytes.get()
+  }
+
+  /// Returns the peak number of bytes live in the arena, its base and nested arenas.
+  pub fn peak(&self) -> usize {
+    max(self.nested.get(), self.base + self.bytes.get())
+  }
+
+  /// Sets or removes the limit on the number of bytes live in the arena and its base.
+  pub fn set_limit(&self, limit: Option<usize>) {
+    self.limit.set(limit);
+  }
+
+  /// Returns the limit on the number of bytes live in the arena and its base.
+  pub fn limit(&self) -> Option<usize> {
+    self.limit.get()
+  }
+
+  /// Returns if the bytes live in the arena and its base are over the limit.
+  #[inline]
+  pub fn exceeded(&self) -> bool {
+    self.limit.get().is_some_and(|limit| self.base + self.bytes.get() > limit)
+  }
+
+  /// Forgets all allocations in the arena and nested arenas, keeping the base and the limit.
+  pub fn reset(&self) {
+    self.bytes.set(0);
+    self.nested.set(self.base);
+  }
+}
+
+/// Number of arguments of a [`Spine`] stored inline.
+const SPINE_INLINE: usize = 8;
+
+/// # Application spines
+///
+/// Arguments of a nested application, collected from the outside in while looking for its head,
+/// so that the evaluators can then take them in order in constant time each. The first few are
+/// stored inline, so that only long spines allocate.
+#[derive(Debug)]
+pub struct Spine<T> {
+  inline: [Option<T>; SPINE_INLINE],
+  rest: Vec<T>,
+  len: usize,
+}
+
+impl<T: Copy> Spine<T> {
+  /// Creates an empty spine. This does not allocate.
+  pub fn new() -> Self {
+    Self { inline: [None; SPINE_INLINE], rest: Vec::new(), len: 0 }
+  }
+
+  /// Adds the argument of the next application inwards.
+  #[inline]
+  pub fn push(&mut self, x: T) {
+    match self.inline.get_mut(self.len) {
+      Some(slot) => *slot = Some(x),
+      None => self.rest.push(x),
+    }
+    self.len += 1;
+  }
+
+  /// Returns the number of arguments.
+  pub fn len(&self) -> usize {
+    self.len
+  }
+
+  /// Returns if there are no arguments.
+  pub fn is_empty(&self) -> bool {
+    self.len == 0
+  }
+
+  /// Returns the argument of the `k`-th application from the outside.
+  #[inline]
+  pub fn get(&self, k: usize) -> T {
+    match self.inline.get(k) {
+      Some(x) => x.unwrap(),
+      None => self.rest[k - SPINE_INLINE],
+    }
+  }
+}
+
+impl<T: Copy> Default for Spine<T> {
+  fn default() -> Self {
+    Self::new()
+  }
+}
+
+/// Given universe `u`, returns the universe of its type, if it exists.
+pub fn univ_univ(u: usize) -> Option<usize> {
+  match u {
+    #[cfg(feature = "type_in_type")]
+    0 => Some(0),
+    #[cfg(not(feature = "type_in_type"))]
+    0 => Some(1),
+    _ => None,
+  }
+}
+
+/// Given universes `v` and `w`, returns the universe of Pi types from `v` to `w`.
+pub fn pi_univ(v: usize, w: usize) -> usize {
+  max(v, w)
+}
+
+/// Given universes `v` and `w`, returns the universe of Sigma types containing `v` and `w`.
+pub fn sig_univ(v: usize, w: usize) -> usize {
+  max(v, w)
+}
+
+/// Returns the universe of the unit type.
+pub fn unit_univ() -> usize {
+  0
+}
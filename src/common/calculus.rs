@@ -0,0 +1,501 @@
+use std::slice::from_raw_parts;
+
+use super::Spine;
+
+/// # Calculi
+///
+/// A term language as seen by the shared evaluator, i.e. [`eval`], [`apply`], [`quote`] and
+/// [`conv`]: its terms, values, closures, environments and arenas, how to view them as (and build
+/// them from) the fragment common to all calculi, and hooks for everything else. It is implemented
+/// by zero-sized marker types in [`crate::kernel`] and [`crate::ir`], so that the evaluator is
+/// monomorphised for each of them.
+///
+/// Binder, field and application information (e.g. names, attributes and dot-syntax flags in the
+/// ir) are associated types, which are `()` in the kernel, so that it carries none of them.
+pub trait Calculus<'a>: Sized + 'a {
+  /// Terms.
+  type Term: Copy + 'a;
+  /// Values.
+  type Val: Copy + 'a;
+  /// Closures.
+  type Clos: Clone + 'a;
+  /// Evaluation environments.
+  type Stack: Clone + 'a;
+  /// Arenas.
+  type Arena: 'a;
+  /// Evaluation errors.
+  type Error;
+  /// Binder information of `let`s, function types and function abstractions.
+  type Bound: Copy + 'a;
+  /// Field information of tuple types and constructors.
+  type Field: Copy + 'a;
+  /// Application information.
+  type Dot: Copy + 'a;
+  /// Elements of tuple types and constructors, together with their field information.
+  type Entry<X: 'a>: 'a;
+  /// Arguments of neutral applications, see [`ValView::App`].
+  type Args: Copy + 'a;
+  /// Terms outside the common fragment (e.g. holes).
+  type TermExt;
+  /// Values outside the common fragment (e.g. glued definitions).
+  type ValExt;
+
+  /// Views `x` as a term of the common fragment.
+  fn view(x: &Self::Term) -> TermView<'a, Self>;
+
+  /// Builds a term of the common fragment.
+  fn make(x: TermView<'a, Self>) -> Self::Term;
+
+  /// Views `v` as a value of the common fragment.
+  fn view_val(v: &Self::Val) -> ValView<'a, Self>;
+
+  /// Builds a value of the common fragment.
+  fn make_val(v: ValView<'a, Self>) -> Self::Val;
+
+  /// Builds a tuple element.
+  fn entry<X: 'a>(info: Self::Field, x: X) -> Self::Entry<X>;
+
+  /// Splits a tuple element into its field information and contents.
+  fn split<X: 'a>(e: &Self::Entry<X>) -> (Self::Field, &X);
+
+  /// Returns if two fields have the same name.
+  fn field_eq(i: Self::Field, j: Self::Field) -> bool;
+
+  /// Returns the arguments of a neutral application, outermost last.
+  fn args(xs: Self::Args) -> impl ExactSizeIterator<Item = (&'a Self::Val, Self::Dot)>;
+
+  /// Returns the binder information of variables bound by tuples.
+  fn empty() -> Self::Bound;
+
+  /// Builds a closure.
+  fn clos(info: Self::Bound, env: Self::Stack, body: &'a Self::Term) -> Self::Clos;
+
+  /// Returns the binder information, environment and body of a closure.
+  fn open(c: &'a Self::Clos) -> (Self::Bound, &'a Self::Stack, &'a Self::Term);
+
+  /// Returns the length of an environment.
+  fn len(env: &Self::Stack) -> usize;
+
+  /// Returns the value at the given de Bruijn index, if it exists.
+  fn get(env: &Self::Stack, ix: usize, ar: &'a Self::Arena) -> Option<Self::Val>;
+
+  /// Creates a new frame on top of `prev`. This does not allocate.
+  fn cons(prev: &'a Self::Stack, info: Self::Bound, v: Self::Val) -> Self::Stack;
+
+  /// Extends an environment with a new value.
+  fn extend(env: &Self::Stack, info: Self::Bound, v: Self::Val, ar: &'a Self::Arena) -> Self::Stack;
+
+  /// Allocates a term.
+  fn term(ar: &'a Self::Arena, x: Self::Term) -> &'a Self::Term;
+
+  /// Allocates tuple elements of terms.
+  #[allow(clippy::mut_from_ref)]
+  fn terms(ar: &'a Self::Arena, len: usize) -> &'a mut [Self::Entry<Self::Term>];
+
+  /// Allocates a value.
+  fn val(ar: &'a Self::Arena, v: Self::Val) -> &'a Self::Val;
+
+  /// Allocates tuple elements of values.
+  #[allow(clippy::mut_from_ref)]
+  fn values(ar: &'a Self::Arena, len: usize) -> &'a mut [Self::Entry<Self::Val>];
+
+  /// Allocates a closure.
+  fn closure(ar: &'a Self::Arena, c: Self::Clos) -> &'a Self::Clos;
+
+  /// Allocates tuple elements of closures.
+  #[allow(clippy::mut_from_ref)]
+  fn closures(ar: &'a Self::Arena, len: usize) -> &'a mut [Self::Entry<Self::Clos>];
+
+  /// Records a (β) step, failing if the evaluation has to stop (e.g. it is over the byte limit).
+  fn beta(ar: &'a Self::Arena) -> Result<(), Self::Error>;
+
+  /// Checks the byte limit, before each value quoted.
+  fn within_byte_limit(ar: &'a Self::Arena) -> Result<(), Self::Error>;
+
+  /// Returns the error for an out-of-range de Bruijn index.
+  fn env_index(ix: usize, len: usize) -> Self::Error;
+
+  /// Returns the error for an out-of-range de Bruijn level.
+  fn gen_level(lvl: usize, len: usize) -> Self::Error;
+
+  /// Returns the error for an initial segment longer than the tuple.
+  fn tup_init(n: usize, v: Self::Val, env: &Self::Stack, ar: &'a Self::Arena) -> Self::Error;
+
+  /// Returns the error for a projection out of the tuple.
+  fn tup_proj(n: usize, v: Self::Val, env: &Self::Stack, ar: &'a Self::Arena) -> Self::Error;
+
+  /// Wraps the value of a `let` before it is collected into the environment.
+  #[inline]
+  fn define(v: Self::Val, _ar: &'a Self::Arena) -> Self::Val {
+    v
+  }
+
+  /// Unfolds definitions at the head of `v`, before it is eliminated.
+  #[inline]
+  fn force(v: Self::Val) -> Self::Val {
+    v
+  }
+
+  /// Records a rule used by [`eval`], for profiling.
+  #[inline]
+  fn profile_eval(_x: &Self::Term, _ar: &'a Self::Arena) {}
+
+  /// Records a rule used by [`conv`], for profiling.
+  #[inline]
+  fn profile_conv(_v: &Self::Val, _ar: &'a Self::Arena) {}
+
+  /// Reduces a garbage collection mark, evaluating `x` inside a new arena region.
+  fn eval_gc(x: &'a Self::Term, env: &Self::Stack, ar: &'a Self::Arena) -> Result<Self::Val, Self::Error>;
+
+  /// Reduces a term outside the common fragment.
+  fn eval_ext(x: Self::TermExt, env: &Self::Stack, ar: &'a Self::Arena) -> Result<Self::Val, Self::Error>;
+
+  /// Applies `f`, which is not a function abstraction, to `n` arguments given by `arg` in order.
+  fn app(
+    f: Self::Val,
+    n: usize,
+    arg: impl FnMut(usize) -> Result<(Self::Val, Self::Dot), Self::Error>,
+    ar: &'a Self::Arena,
+  ) -> Result<Self::Val, Self::Error>;
+
+  /// Same as [`quote`] for values allocated in the arena, where the result is also allocated.
+  #[inline]
+  fn quote_ref(v: &'a Self::Val, len: usize, ar: &'a Self::Arena) -> Result<&'a Self::Term, Self::Error> {
+    Ok(Self::term(ar, quote::<Self>(v, len, ar)?))
+  }
+
+  /// Quotes a value outside the common fragment.
+  fn quote_ext(v: Self::ValExt, len: usize, ar: &'a Self::Arena) -> Result<Self::Term, Self::Error>;
+
+  /// Returns if `x` and `y` are shallowly identical, which implies definitional equality.
+  fn ptr_eq(x: &Self::Val, y: &Self::Val) -> bool;
+
+  /// Decides conversion of `x` and `y` before they are compared as values of the common fragment,
+  /// if either is outside of it. Returns [`None`] to fall through.
+  #[inline]
+  fn conv_ext(_x: &Self::Val, _y: &Self::Val, _len: usize, _ar: &'a Self::Arena) -> Result<Option<bool>, Self::Error> {
+    Ok(None)
+  }
+}
+
+/// # Terms of the common fragment
+///
+/// See [`Calculus::view`].
+pub enum TermView<'a, C: Calculus<'a>> {
+  Gc(&'a C::Term),
+  Univ(usize),
+  Var(usize),
+  Ann(&'a C::Term, &'a C::Term),
+  Let(C::Bound, &'a C::Term, &'a C::Term),
+  Pi(C::Bound, &'a C::Term, &'a C::Term),
+  Fun(C::Bound, &'a C::Term),
+  App(&'a C::Term, &'a C::Term, C::Dot),
+  Sig(&'a [C::Entry<C::Term>]),
+  Tup(&'a [C::Entry<C::Term>]),
+  Init(usize, &'a C::Term),
+  Proj(usize, &'a C::Term),
+  Ext(C::TermExt),
+}
+
+/// # Values of the common fragment
+///
+/// See [`Calculus::view_val`].
+pub enum ValView<'a, C: Calculus<'a>> {
+  Univ(usize),
+  Free(usize),
+  Pi(&'a C::Val, &'a C::Clos),
+  Fun(&'a C::Clos),
+  App(&'a C::Val, C::Args),
+  Sig(&'a [C::Entry<C::Clos>]),
+  Tup(&'a [C::Entry<C::Val>]),
+  Init(usize, &'a C::Val),
+  Proj(usize, &'a C::Val),
+  Ext(C::ValExt),
+}
+
+/// Reduces `x` so that all `let`s are collected into the environment and then frozen at binders.
+/// This is mutually recursive with [`apply`], forming an eval-apply loop.
+///
+/// Pre-conditions:
+///
+/// - `x` is well-typed under a context and environment `env` (to ensure termination).
+pub fn eval<'a, C: Calculus<'a>>(x: &C::Term, env: &C::Stack, ar: &'a C::Arena) -> Result<C::Val, C::Error> {
+  C::profile_eval(x, ar);
+  match C::view(x) {
+    // The garbage collection mark forces the subterm to be evaluated inside a new arena region.
+    TermView::Gc(x) => C::eval_gc(x, env, ar),
+    // Universes are already in normal form.
+    TermView::Univ(v) => Ok(C::make_val(ValView::Univ(v))),
+    // The (δ) rule is always applied.
+    // Variables of values are in de Bruijn levels, so weakening is no-op.
+    TermView::Var(ix) => C::get(env, ix, ar).ok_or_else(|| C::env_index(ix, C::len(env))),
+    // The (τ) rule is always applied.
+    TermView::Ann(x, _) => eval::<C>(x, env, ar),
+    // For `let`s, we reduce the value, collect it into the environment to reduce the body.
+    TermView::Let(i, v, x) => {
+      let v = C::define(eval::<C>(v, env, ar)?, ar);
+      eval::<C>(x, &C::extend(env, i, v, ar), ar)
+    }
+    // For binders, we freeze the whole environment and store the body as a closure.
+    TermView::Pi(i, t, u) => {
+      let t = C::val(ar, eval::<C>(t, env, ar)?);
+      Ok(C::make_val(ValView::Pi(t, C::closure(ar, C::clos(i, env.clone(), u)))))
+    }
+    TermView::Fun(i, b) => Ok(C::make_val(ValView::Fun(C::closure(ar, C::clos(i, env.clone(), b))))),
+    TermView::App(f, x, dot) => eval_app::<C>(f, x, dot, env, ar),
+    // For binders, we freeze the whole environment and store the body as a closure.
+    TermView::Sig(us) => {
+      let cs = C::closures(ar, us.len());
+      for (c, u) in cs.iter_mut().zip(us) {
+        let (info, u) = C::split(u);
+        *c = C::entry(info, C::clos(C::empty(), env.clone(), u));
+      }
+      Ok(C::make_val(ValView::Sig(cs)))
+    }
+    TermView::Tup(bs) => {
+      let vs = C::values(ar, bs.len()).as_mut_ptr();
+      for (i, b) in bs.iter().enumerate() {
+        let (info, b) = C::split(b);
+        // SAFETY: the borrowed range `&vs[..i]` is no longer modified.
+        let a = C::make_val(ValView::Tup(unsafe { from_raw_parts(vs, i) }));
+        let b = eval::<C>(b, &C::extend(env, C::empty(), a, ar), ar)?;
+        // SAFETY: `i < bs.len()` which is the valid size of `vs`.
+        unsafe { *vs.add(i) = C::entry(info, b) };
+      }
+      // SAFETY: the borrowed slice `&vs` has valid size `bs.len()` and is no longer modified.
+      Ok(C::make_val(ValView::Tup(unsafe { from_raw_parts(vs, bs.len()) })))
+    }
+    // For initials (i.e. iterated first projections), we reduce the operand and combine it back.
+    // In the case of a redex, the (π init) rule is applied.
+    TermView::Init(n, x) => {
+      let x = C::force(eval::<C>(x, env, ar)?);
+      match C::view_val(&x) {
+        ValView::Init(m, y) => Ok(C::make_val(ValView::Init(n + m, y))),
+        ValView::Tup(bs) => {
+          let m = bs.len().checked_sub(n).ok_or_else(|| C::tup_init(n, x, env, ar))?;
+          Ok(C::make_val(ValView::Tup(&bs[..m])))
+        }
+        _ => Ok(C::make_val(ValView::Init(n, C::val(ar, x)))),
+      }
+    }
+    // For projections (i.e. second projections after iterated first projections), we reduce the
+    // operand and combine it back.
+    // In the case of a redex, the (π proj) rule is applied.
+    TermView::Proj(n, x) => {
+      let x = C::force(eval::<C>(x, env, ar)?);
+      match C::view_val(&x) {
+        ValView::Init(m, y) => Ok(C::make_val(ValView::Proj(n + m, y))),
+        ValView::Tup(bs) => {
+          let i = bs.len().checked_sub(n + 1).ok_or_else(|| C::tup_proj(n, x, env, ar))?;
+          Ok(*C::split(&bs[i]).1)
+        }
+        _ => Ok(C::make_val(ValView::Proj(n, C::val(ar, x)))),
+      }
+    }
+    TermView::Ext(x) => C::eval_ext(x, env, ar),
+  }
+}
+
+/// See [`eval`]. For applications, we reduce the head and the arguments in order. In the case of a
+/// redex, the (β) rule is applied, binding the arguments of nested function abstractions all at
+/// once without building the intermediate closures. Otherwise the remaining arguments are combined
+/// with the head at once, see [`Calculus::app`].
+fn eval_app<'a, C: Calculus<'a>>(
+  f: &'a C::Term,
+  x: &'a C::Term,
+  dot: C::Dot,
+  env: &C::Stack,
+  ar: &'a C::Arena,
+) -> Result<C::Val, C::Error> {
+  let (mut head, mut args) = (f, Spine::new());
+  args.push((x, dot));
+  while let TermView::App(f, x, dot) = C::view(head) {
+    args.push((x, dot));
+    head = f;
+  }
+  let n = args.len();
+  let (mut f, mut i) = (eval::<C>(head, env, ar)?, 0);
+  while i < n {
+    let ValView::Fun(b) = C::view_val(&f) else { break };
+    C::beta(ar)?;
+    let (info, b_env, mut body) = C::open(b);
+    let mut inner = C::cons(b_env, info, eval::<C>(args.get(n - 1 - i).0, env, ar)?);
+    i += 1;
+    while let (TermView::Fun(info, c), true) = (C::view(body), i < n) {
+      C::beta(ar)?;
+      inner = C::extend(&inner, info, eval::<C>(args.get(n - 1 - i).0, env, ar)?, ar);
+      (body, i) = (c, i + 1);
+    }
+    f = eval::<C>(body, &inner, ar)?;
+  }
+  if i == n {
+    return Ok(f);
+  }
+  let arg = |j| {
+    let (x, dot) = args.get(n - 1 - i - j);
+    Ok((eval::<C>(x, env, ar)?, dot))
+  };
+  C::app(f, n - i, arg, ar)
+}
+
+/// Inserts a new `let` around the body of `c` after the frozen `let`s, and reduces the body under
+/// the empty environment populated with all `let`s. This is mutually recursive with [`eval`],
+/// forming an eval-apply loop.
+pub fn apply<'a, C: Calculus<'a>>(c: &'a C::Clos, x: C::Val, ar: &'a C::Arena) -> Result<C::Val, C::Error> {
+  C::beta(ar)?;
+  let (info, env, body) = C::open(c);
+  eval::<C>(body, &C::cons(env, info, x), ar)
+}
+
+/// Reduces well-typed `v` to eliminate `let`s and convert it back into a term.
+/// Can be an expensive operation. Expected to be used for outputs and error reporting.
+///
+/// Pre-conditions:
+///
+/// - `v` is well-typed under a context with size `len` (to ensure termination).
+pub fn quote<'a, C: Calculus<'a>>(v: &C::Val, len: usize, ar: &'a C::Arena) -> Result<C::Term, C::Error> {
+  C::within_byte_limit(ar)?;
+  let free = C::make_val(ValView::Free(len));
+  let body = |c: &'a C::Clos| -> Result<&'a C::Term, C::Error> {
+    Ok(C::term(ar, quote::<C>(&apply::<C>(c, free, ar)?, len + 1, ar)?))
+  };
+  Ok(C::make(match C::view_val(v) {
+    ValView::Univ(v) => TermView::Univ(v),
+    ValView::Free(i) => TermView::Var(len.checked_sub(i + 1).ok_or_else(|| C::gen_level(i, len))?),
+    ValView::Pi(t, u) => TermView::Pi(C::open(u).0, C::quote_ref(t, len, ar)?, body(u)?),
+    ValView::Fun(b) => TermView::Fun(C::open(b).0, body(b)?),
+    ValView::App(f, xs) => {
+      // Only the inner applications are allocated, the outermost one is returned.
+      let (mut f, mut app) = (C::quote_ref(f, len, ar)?, None);
+      for (x, dot) in C::args(xs) {
+        if let Some(app) = app.take() {
+          f = C::term(ar, C::make(app));
+        }
+        app = Some(TermView::App(f, C::quote_ref(x, len, ar)?, dot));
+      }
+      match app {
+        Some(app) => app,
+        None => return Ok(*f),
+      }
+    }
+    ValView::Sig(us) => {
+      let terms = C::terms(ar, us.len());
+      for (term, u) in terms.iter_mut().zip(us) {
+        let (info, u) = C::split(u);
+        *term = C::entry(info, quote::<C>(&apply::<C>(u, free, ar)?, len + 1, ar)?);
+      }
+      TermView::Sig(terms)
+    }
+    ValView::Tup(bs) => {
+      let terms = C::terms(ar, bs.len());
+      for (term, b) in terms.iter_mut().zip(bs) {
+        let (info, b) = C::split(b);
+        *term = C::entry(info, quote::<C>(b, len + 1, ar)?);
+      }
+      TermView::Tup(terms)
+    }
+    ValView::Init(n, x) => TermView::Init(n, C::quote_ref(x, len, ar)?),
+    ValView::Proj(n, x) => TermView::Proj(n, C::quote_ref(x, len, ar)?),
+    ValView::Ext(v) => return C::quote_ext(v, len, ar),
+  }))
+}
+
+/// Returns if `x` and `y` are definitionally equal. Can be an expensive operation if they are
+/// indeed definitionally equal.
+///
+/// Pre-conditions:
+///
+/// - `x` and `y` are well-typed under a context with size `len` (to ensure termination).
+pub fn conv<'a, C: Calculus<'a>>(x: &C::Val, y: &C::Val, len: usize, ar: &'a C::Arena) -> Result<bool, C::Error> {
+  C::profile_conv(x, ar);
+  if C::ptr_eq(x, y) {
+    return Ok(true);
+  }
+  if let Some(res) = C::conv_ext(x, y, len, ar)? {
+    return Ok(res);
+  }
+  let free = C::make_val(ValView::Free(len));
+  let bodies =
+    |c: &'a C::Clos, d: &'a C::Clos| conv::<C>(&apply::<C>(c, free, ar)?, &apply::<C>(d, free, ar)?, len + 1, ar);
+  match (C::view_val(x), C::view_val(y)) {
+    (ValView::Univ(v), ValView::Univ(w)) => Ok(v == w),
+    (ValView::Free(i), ValView::Free(j)) => Ok(i == j),
+    // Closures are only instantiated after the cheap checks (parameter types, field names and
+    // shapes of the bodies) succeed, see [`apart`].
+    (ValView::Pi(t, v), ValView::Pi(u, w)) => Ok(!apart::<C>(v, w) && conv::<C>(t, u, len, ar)? && bodies(v, w)?),
+    (ValView::Fun(b), ValView::Fun(c)) => Ok(!apart::<C>(b, c) && bodies(b, c)?),
+    (ValView::App(f, xs), ValView::App(g, ys)) => {
+      let (xs, ys) = (C::args(xs), C::args(ys));
+      if xs.len() != ys.len() || !conv::<C>(f, g, len, ar)? {
+        return Ok(false);
+      }
+      for ((x, _), (y, _)) in xs.zip(ys) {
+        if !conv::<C>(x, y, len, ar)? {
+          return Ok(false);
+        }
+      }
+      Ok(true)
+    }
+    (ValView::Sig(us), ValView::Sig(vs)) if us.len() == vs.len() => {
+      let (us, vs) = (us.iter().map(C::split), vs.iter().map(C::split));
+      if us.clone().zip(vs.clone()).any(|((i, u), (j, v))| !C::field_eq(i, j) || apart::<C>(u, v)) {
+        return Ok(false);
+      }
+      for ((_, u), (_, v)) in us.zip(vs) {
+        if !bodies(u, v)? {
+          return Ok(false);
+        }
+      }
+      Ok(true)
+    }
+    (ValView::Tup(bs), ValView::Tup(cs)) if bs.len() == cs.len() => {
+      let (bs, cs) = (bs.iter().map(C::split), cs.iter().map(C::split));
+      if bs.clone().zip(cs.clone()).any(|((i, _), (j, _))| !C::field_eq(i, j)) {
+        return Ok(false);
+      }
+      for ((_, b), (_, c)) in bs.zip(cs) {
+        if !conv::<C>(b, c, len, ar)? {
+          return Ok(false);
+        }
+      }
+      Ok(true)
+    }
+    (ValView::Init(n, x), ValView::Init(m, y)) => Ok(n == m && conv::<C>(x, y, len, ar)?),
+    (ValView::Proj(n, x), ValView::Proj(m, y)) => Ok(n == m && conv::<C>(x, y, len, ar)?),
+    _ => Ok(false),
+  }
+}
+
+/// # Shapes of canonical forms
+///
+/// Outermost constructors of terms which are kept by evaluation (together with universe levels
+/// and tuple sizes), used to refute conversion of binder bodies cheaply. See [`apart`].
+#[derive(Debug, Clone, Copy, PartialEq, Eq)]
+enum Shape {
+  Univ(usize),
+  Pi,
+  Fun,
+  Sig(usize),
+  Tup(usize),
+}
+
+/// Returns the shape of the value of `x` under any environment, if it can be told from the syntax
+/// alone.
+fn shape<'a, C: Calculus<'a>>(x: &C::Term) -> Option<Shape> {
+  match C::view(x) {
+    TermView::Gc(x) | TermView::Ann(x, _) | TermView::Let(_, _, x) => shape::<C>(x),
+    TermView::Univ(v) => Some(Shape::Univ(v)),
+    TermView::Pi(..) => Some(Shape::Pi),
+    TermView::Fun(..) => Some(Shape::Fun),
+    TermView::Sig(us) => Some(Shape::Sig(us.len())),
+    TermView::Tup(bs) => Some(Shape::Tup(bs.len())),
+    _ => None,
+  }
+}
+
+/// Returns if the bodies of closures `c` and `d` are syntactically headed by different canonical
+/// forms, so that they are definitionally unequal under any arguments. This only looks at the
+/// terms, without instantiating either closure.
+fn apart<'a, C: Calculus<'a>>(c: &'a C::Clos, d: &'a C::Clos) -> bool {
+  matches!((shape::<C>(C::open(c).2), shape::<C>(C::open(d).2)), (Some(s), Some(t)) if s != t)
+}
@@ -1,4 +1,12 @@
+mod discr;
 mod errors;
+mod globals;
+mod search;
+mod session;
 mod term;
 
+pub use discr::DiscrTree;
 pub use errors::ElabError;
+pub use globals::Globals;
+pub use search::{Hyp, Limits, Search, Stats};
+pub use session::Session;
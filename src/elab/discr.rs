@@ -0,0 +1,215 @@
+use std::collections::HashMap;
+
+use crate::arena::Arena;
+use crate::ir::{Core, EvalError, Global, Stack, Term, Val};
+
+/// # Discrimination trees
+///
+/// Indexes values (e.g. postulates or lemmas) by the conclusions of their types, so that the
+/// candidates whose conclusions may unify with a goal are retrieved without trying all of them.
+/// Conclusions and goals are quoted and flattened into sequences of keys in prefix order, which
+/// are stored in a trie. Parameters of indexed types and holes in goals become wildcards, and terms
+/// which are not applications (e.g. binders) are only indexed by their outermost node. Retrieval is
+/// conservative: all candidates which may unify with the goal are returned, possibly with others.
+///
+/// Variables are keyed by de Bruijn levels, and fields of transparent binders by their indices from
+/// the start of the tuple type, so that keys stay valid as the context is extended and as fields
+/// are added to the tuple type (e.g. while checking the fields of a tuple in order). The tree can
+/// therefore be updated incrementally with [`DiscrTree::insert`] as new fields become available.
+///
+/// - See: <https://doi.org/10.1007/BF00245458> (discrimination-tree indexing)
+#[derive(Debug)]
+pub struct DiscrTree<T> {
+  root: Node<T>,
+  len: usize,
+}
+
+/// # Discrimination tree nodes
+///
+/// Children by the next key, and values whose keys end here.
+#[derive(Debug)]
+struct Node<T> {
+  children: HashMap<Key, Node<T>>,
+  values: Vec<T>,
+}
+
+/// # Discrimination tree keys
+///
+/// Nodes of flattened terms, with the number of subterms following them.
+#[derive(Debug, Clone, Copy, PartialEq, Eq, Hash)]
+enum Key {
+  /// Wildcards, which match any term.
+  Star,
+  /// Universes in levels.
+  Univ(usize),
+  /// Applications headed by variables (de Bruijn level, number of arguments).
+  Var(usize, usize),
+  /// Applications headed by fields of variables (de Bruijn level, field index, number of arguments).
+  Field(usize, usize, usize),
+  /// Applications headed by global definitions (address, number of arguments).
+  Const(usize, usize),
+  /// Other rigid terms (e.g. binders), whose contents are not indexed.
+  Other,
+}
+
+impl Key {
+  /// Returns the number of subterms following the key.
+  fn arity(&self) -> usize {
+    match self {
+      Key::Var(_, n) | Key::Field(_, _, n) | Key::Const(_, n) => *n,
+      Key::Star | Key::Univ(_) | Key::Other => 0,
+    }
+  }
+
+  /// Flattens `term` into keys in prefix order. The term is under context `ctx` extended with
+  /// `depth` binders, whose variables become wildcards.
+  fn flatten<'a, 'b>(term: &Term<'_, 'b, Core>, depth: usize, ctx: &Stack<'a, 'b>, ar: &'a Arena, res: &mut Vec<Key>) {
+    let mut head = term;
+    let mut args = Vec::new();
+    while let Term::App(f, x, _) = head {
+      args.push(*x);
+      head = f;
+    }
+    let len = ctx.len() + depth;
+    let key = match head {
+      Term::Var(ix) if *ix >= depth => Key::Var(len - 1 - ix, args.len()),
+      // Fields are counted from the start of the tuple type, which does not change as it grows.
+      Term::Proj(n, Term::Var(ix)) if *ix >= depth => match ctx.get(ix - depth, ar).map(|(_, t)| t.force()) {
+        Some(Val::Sig(us)) if *n < us.len() => Key::Field(len - 1 - ix, us.len() - 1 - n, args.len()),
+        _ => Key::Star,
+      },
+      Term::Const(g) => Key::Const(*g as *const Global as usize, args.len()),
+      Term::Gc(x) | Term::Ann(x, _) if args.is_empty() => return Key::flatten(x, depth, ctx, ar, res),
+      Term::Univ(v) if args.is_empty() => Key::Univ(*v),
+      Term::Pi(..) | Term::Fun(..) | Term::Sig(_) | Term::Tup(_) | Term::Init(..) if args.is_empty() => Key::Other,
+      // Parameters, holes (possibly under `let`s) and anything else may unify with any term.
+      _ => Key::Star,
+    };
+    res.push(key);
+    if key.arity() > 0 {
+      for x in args.iter().rev() {
+        Key::flatten(x, depth, ctx, ar, res);
+      }
+    }
+  }
+
+  /// Returns the number of keys in the subterm starting at `keys[0]`.
+  fn subterm_len(keys: &[Key]) -> usize {
+    let (mut i, mut need) = (0, 1);
+    while need > 0 {
+      need = need - 1 + keys[i].arity();
+      i += 1;
+    }
+    i
+  }
+}
+
+impl<T> Default for Node<T> {
+  fn default() -> Self {
+    Self { children: HashMap::new(), values: Vec::new() }
+  }
+}
+
+impl<T> Node<T> {
+  /// Calls `f` on all nodes reached from `self` by skipping `n` subterms.
+  fn skip<'s>(&'s self, n: usize, f: &mut impl FnMut(&'s Self)) {
+    match n {
+      0 => f(self),
+      _ => self.children.iter().for_each(|(key, child)| child.skip(n - 1 + key.arity(), f)),
+    }
+  }
+
+  /// Collects values whose keys match `keys`.
+  fn get<'s>(&'s self, keys: &[Key], res: &mut Vec<&'s T>) {
+    let Some((key, rest)) = keys.split_first() else {
+      res.extend(self.values.iter());
+      return;
+    };
+    // A wildcard in the tree matches a whole subterm of the goal.
+    if let Some(child) = self.children.get(&Key::Star) {
+      child.get(&keys[Key::subterm_len(keys)..], res);
+    }
+    match key {
+      // A wildcard in the goal matches a whole subterm in the tree, other than the wildcard above.
+      Key::Star => {
+        for (key, child) in self.children.iter().filter(|(key, _)| **key != Key::Star) {
+          child.skip(key.arity(), &mut |node| node.get(rest, res));
+        }
+      }
+      key => {
+        if let Some(child) = self.children.get(key) {
+          child.get(rest, res);
+        }
+      }
+    }
+  }
+}
+
+impl<T> Default for DiscrTree<T> {
+  fn default() -> Self {
+    Self::new()
+  }
+}
+
+impl<T> DiscrTree<T> {
+  /// Creates an empty tree.
+  pub fn new() -> Self {
+    Self { root: Node::default(), len: 0 }
+  }
+
+  /// Returns the number of values in the tree.
+  pub fn len(&self) -> usize {
+    self.len
+  }
+
+  /// Returns if the tree is empty.
+  pub fn is_empty(&self) -> bool {
+    self.len == 0
+  }
+
+  /// Inserts `value` indexed by the conclusion of type `ty` under context `ctx`, i.e. the type
+  /// with its outermost function types stripped. Their parameters become wildcards.
+  pub fn insert<'a, 'b>(
+    &mut self,
+    ty: Val<'a, 'b>,
+    ctx: &Stack<'a, 'b>,
+    value: T,
+    ar: &'a Arena,
+  ) -> Result<(), EvalError<'a, 'b>> {
+    self.insert_term(&ty.quote(ctx.len(), ar)?, ctx, value, ar);
+    Ok(())
+  }
+
+  /// Same as [`DiscrTree::insert`], but with a type already quoted under context `ctx`.
+  pub fn insert_term<'a, 'b>(&mut self, ty: &Term<'_, 'b, Core>, ctx: &Stack<'a, 'b>, value: T, ar: &'a Arena) {
+    let (mut concl, mut depth) = (ty, 0);
+    while let Term::Pi(_, _, u) = concl {
+      (concl, depth) = (u, depth + 1);
+    }
+    let mut keys = Vec::new();
+    Key::flatten(concl, depth, ctx, ar, &mut keys);
+    let node = keys.into_iter().fold(&mut self.root, |node, key| node.children.entry(key).or_default());
+    node.values.push(value);
+    self.len += 1;
+  }
+
+  /// Returns the values whose conclusions may unify with `goal`, which is a type under context
+  /// `ctx`. Unsolved holes in `goal` match anything.
+  pub fn get<'a, 'b>(
+    &self,
+    goal: Val<'a, 'b>,
+    ctx: &Stack<'a, 'b>,
+    ar: &'a Arena,
+  ) -> Result<Vec<&T>, EvalError<'a, 'b>> {
+    Ok(self.get_term(&goal.quote(ctx.len(), ar)?, ctx, ar))
+  }
+
+  /// Same as [`DiscrTree::get`], but with a goal already quoted under context `ctx`.
+  pub fn get_term<'a, 'b>(&self, goal: &Term<'_, 'b, Core>, ctx: &Stack<'a, 'b>, ar: &'a Arena) -> Vec<&T> {
+    let mut keys = Vec::new();
+    Key::flatten(goal, 0, ctx, ar, &mut keys);
+    let mut res = Vec::new();
+    self.root.get(&keys, &mut res);
+    res
+  }
+}
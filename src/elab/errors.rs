@@ -1,5 +1,5 @@
 use crate::arena::{Arena, Relocate};
-use crate::ir::{Core, EvalError, Name, Named, Stack, Term, TypeError, Val};
+use crate::ir::{EvalError, Name, Named, Quoted, Stack, Term, TypeError, Val};
 
 /// # Elaboration errors
 ///
@@ -8,8 +8,9 @@ use crate::ir::{Core, EvalError, Name, Named, Stack, Term, TypeError, Val};
 pub enum ElabError<'a, 'b> {
   TypeError { err: TypeError<'a, 'b, Named> },
   CtxName { name: Name<'b> },
-  SigExpected { name: Name<'b>, term: &'a Term<'a, 'b, Named>, ty: &'a Term<'a, 'b, Core> },
-  SigName { name: Name<'b>, term: &'a Term<'a, 'b, Named>, ty: &'a Term<'a, 'b, Core> },
+  SigExpected { name: Name<'b>, term: &'a Term<'a, 'b, Named>, ty: Quoted<'a, 'b> },
+  SigName { name: Name<'b>, term: &'a Term<'a, 'b, Named>, ty: Quoted<'a, 'b> },
+  UnsolvedMeta { id: usize },
 }
 
 impl<'a, 'b> ElabError<'a, 'b> {
@@ -23,12 +24,9 @@ impl<'a, 'b> ElabError<'a, 'b> {
     ty: Val<'a, 'b>,
     ctx: &Stack<'a, 'b>,
     _env: &Stack<'a, 'b>,
-    ar: &'a Arena,
+    _ar: &'a Arena,
   ) -> Self {
-    match ar.val(ty).quote(ctx.len(), ar) {
-      Ok(ty) => Self::SigExpected { name, term, ty: ar.term(ty) },
-      Err(err) => err.into(),
-    }
+    Self::SigExpected { name, term, ty: Quoted::new(ty, ctx.len()) }
   }
 
   pub fn sig_name(
@@ -37,12 +35,13 @@ impl<'a, 'b> ElabError<'a, 'b> {
     ty: Val<'a, 'b>,
     ctx: &Stack<'a, 'b>,
     _env: &Stack<'a, 'b>,
-    ar: &'a Arena,
+    _ar: &'a Arena,
   ) -> Self {
-    match ar.val(ty).quote(ctx.len(), ar) {
-      Ok(ty) => Self::SigName { name, term, ty: ar.term(ty) },
-      Err(err) => err.into(),
-    }
+    Self::SigName { name, term, ty: Quoted::new(ty, ctx.len()) }
+  }
+
+  pub fn unsolved_meta(id: usize) -> Self {
+    Self::UnsolvedMeta { id }
   }
 }
 
@@ -64,11 +63,12 @@ impl<'a, 'b> Relocate<'a, ElabError<'a, 'b>> for ElabError<'_, 'b> {
       Self::TypeError { err } => ElabError::TypeError { err: err.relocate(ar) },
       Self::CtxName { name } => ElabError::CtxName { name: *name },
       Self::SigExpected { name, term, ty } => {
-        ElabError::SigExpected { name: *name, term: ar.term(term.relocate(ar)), ty: ar.term(ty.relocate(ar)) }
+        ElabError::SigExpected { name: *name, term: ar.relocate_term(term), ty: ty.relocate(ar) }
       }
       Self::SigName { name, term, ty } => {
-        ElabError::SigName { name: *name, term: ar.term(term.relocate(ar)), ty: ar.term(ty.relocate(ar)) }
+        ElabError::SigName { name: *name, term: ar.relocate_term(term), ty: ty.relocate(ar) }
       }
+      Self::UnsolvedMeta { id } => ElabError::UnsolvedMeta { id: *id },
     }
   }
 }
@@ -84,6 +84,7 @@ impl std::fmt::Display for ElabError<'_, '_> {
       Self::SigName { name, term, ty } => {
         write!(f, "invalid field access {name} to term {term}, field not found in tuple type {ty}")
       }
+      Self::UnsolvedMeta { id } => write!(f, "unsolved hole ?{id}"),
     }
   }
 }
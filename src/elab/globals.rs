@@ -0,0 +1,53 @@
+use std::collections::HashMap;
+
+use crate::ir::{Global, Name};
+
+/// # Global definitions table
+///
+/// Maps names to checked top-level definitions, which are typically allocated in a long-lived
+/// arena. During elaboration, names not bound in the context are resolved here in O(1) time, to
+/// [`crate::ir::Term::Const`] references which need no de Bruijn lookup. Later definitions shadow
+/// earlier ones with the same name, but remain reachable through [`Globals::iter`].
+///
+/// Names compare by address, so terms referring to the definitions must be parsed in the arena
+/// their names are interned in, or in one of its regions (see [`Name`]).
+#[derive(Debug, Default)]
+pub struct Globals<'b> {
+  defs: HashMap<Name<'b>, &'b Global<'b>>,
+  order: Vec<&'b Global<'b>>,
+}
+
+impl<'b> Globals<'b> {
+  /// Creates an empty table.
+  pub fn new() -> Self {
+    Self::default()
+  }
+
+  /// Returns the global definition with the given name, if it exists.
+  pub fn get(&self, name: Name<'_>) -> Option<&'b Global<'b>> {
+    self.defs.get(&name).copied()
+  }
+
+  /// Adds a global definition, shadowing any existing one with the same name.
+  pub fn insert(&mut self, global: &'b Global<'b>) {
+    self.defs.insert(global.info.name, global);
+    self.order.push(global);
+  }
+
+  /// Returns all global definitions (including shadowed ones) in insertion order, so that each
+  /// definition comes after those it refers to.
+  pub fn iter(&self) -> impl Iterator<Item = &'b Global<'b>> + '_ {
+    self.order.iter().copied()
+  }
+
+  /// Returns the number of global definitions (including shadowed ones), as yielded by
+  /// [`Globals::iter`].
+  pub fn len(&self) -> usize {
+    self.order.len()
+  }
+
+  /// Returns if there are no global definitions.
+  pub fn is_empty(&self) -> bool {
+    self.order.is_empty()
+  }
+}
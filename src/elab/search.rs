@@ -0,0 +1,427 @@
+use std::collections::{BTreeMap, HashSet};
+use std::hash::{DefaultHasher, Hash, Hasher};
+use std::mem::discriminant;
+use std::ptr;
+
+use super::{DiscrTree, ElabError};
+use crate::arena::Arena;
+use crate::ir::{Core, EvalError, Global, Stack, Term, TypeError, Val};
+
+/// # Proof search
+///
+/// Best-first search for terms of given types (i.e. proofs of goals), built from the hypotheses in
+/// a [`DiscrTree`], in the style of Aesop. A search state is a list of open goals, each of which is
+/// an unsolved hole, together with the solutions of holes found on the way. The first open goal of
+/// each expanded state is worked on: if it is a function type, a function is introduced and its
+/// body becomes the new goal; otherwise, each candidate whose conclusion may unify with the goal is
+/// applied to fresh holes for its parameters, and the parameters left unsolved by unification
+/// become new goals (the last parameter first). States with fewer steps and open goals are expanded
+/// first.
+///
+/// States are allocated in the search arena and share structure with their parents: open goals and
+/// solutions are persistent lists, and solutions are recorded in the metacontext of the arena only
+/// while their state is being expanded. Each application is first attempted in a region, which is
+/// dropped together with everything allocated by the attempt, and only applications which succeed
+/// are replayed in the search arena. States whose open goals have the same quoted types as those of
+/// an earlier state are dropped as transpositions. The search gives up once any of the budgets in
+/// [`Limits`] is exhausted.
+///
+/// - See: <https://doi.org/10.1145/3573105.3575671> (Aesop)
+#[derive(Debug)]
+pub struct Search<'t, 'a> {
+  hyps: &'t DiscrTree<Hyp>,
+  limits: Limits,
+  stats: Stats,
+  ar: &'a Arena,
+}
+
+/// # Proof search budgets
+///
+/// The maximum numbers of states expanded and kept in the frontier (the worst states are dropped
+/// first), and the maximum number of bytes allocated in the search arena.
+#[derive(Debug, Clone, Copy)]
+pub struct Limits {
+  pub nodes: usize,
+  pub frontier: usize,
+  pub bytes: usize,
+}
+
+/// # Proof search statistics
+///
+/// Numbers of states expanded and generated, and of states dropped as transpositions or because
+/// the frontier is full.
+#[derive(Debug, Default, Clone, Copy)]
+pub struct Stats {
+  pub expanded: usize,
+  pub generated: usize,
+  pub transpositions: usize,
+  pub dropped: usize,
+}
+
+/// # Hypotheses
+///
+/// Variables in de Bruijn levels, and fields of transparent binders in de Bruijn levels and
+/// indices from the start of the tuple type, which stay valid as the context is extended.
+#[derive(Debug, Clone, Copy, PartialEq, Eq, Hash)]
+pub enum Hyp {
+  Var(usize),
+  Field(usize, usize),
+}
+
+/// # Persistent lists
+#[derive(Debug, Clone, Copy)]
+struct List<'a, T> {
+  head: T,
+  tail: Option<&'a List<'a, T>>,
+  len: usize,
+}
+
+/// # Open goals
+///
+/// An unsolved hole, with the typing context and the identity environment of its scope.
+#[derive(Debug, Clone, Copy)]
+struct Goal<'a, 'b> {
+  meta: usize,
+  ctx: &'a Stack<'a, 'b>,
+  env: &'a Stack<'a, 'b>,
+}
+
+/// Solutions of holes found on the way to a state, most recent first.
+type Sols<'a, 'b> = Option<&'a List<'a, (usize, &'a Term<'a, 'b, Core>)>>;
+
+/// Applications of hypotheses to fresh holes, and the holes.
+type Applied<'a, 'b> = (Term<'a, 'b, Core>, Vec<usize>);
+
+/// # Search states
+#[derive(Debug, Clone, Copy)]
+struct State<'a, 'b> {
+  goals: Option<&'a List<'a, Goal<'a, 'b>>>,
+  sols: Sols<'a, 'b>,
+  steps: usize,
+}
+
+impl Default for Limits {
+  fn default() -> Self {
+    Self { nodes: 10000, frontier: 10000, bytes: 64 << 20 }
+  }
+}
+
+impl<'a, T: Copy> List<'a, T> {
+  /// Allocates `head` in front of `tail`.
+  fn cons(head: T, tail: Option<&'a Self>, ar: &'a Arena) -> Option<&'a Self> {
+    Some(ar.alloc(List { head, tail, len: tail.map_or(0, |tail| tail.len) + 1 }))
+  }
+
+  /// Iterates over the list from the front.
+  fn iter(list: Option<&'a Self>) -> impl Iterator<Item = T> + 'a {
+    let mut curr = list;
+    std::iter::from_fn(move || {
+      let node = curr?;
+      curr = node.tail;
+      Some(node.head)
+    })
+  }
+}
+
+impl Hyp {
+  /// Returns the core term and type of the hypothesis under context `ctx`, if it exists.
+  fn resolve<'a, 'b>(
+    self,
+    ctx: &Stack<'a, 'b>,
+    env: &Stack<'a, 'b>,
+    ar: &'a Arena,
+  ) -> Result<Option<(Term<'a, 'b, Core>, Val<'a, 'b>)>, EvalError<'a, 'b>> {
+    let (Hyp::Var(lvl) | Hyp::Field(lvl, _)) = self;
+    let Some((_, t)) = ctx.len().checked_sub(lvl + 1).and_then(|ix| ctx.get(ix, ar)) else { return Ok(None) };
+    let ix = ctx.len() - 1 - lvl;
+    match (self, t.force()) {
+      (Hyp::Var(_), _) => Ok(Some((Term::Var(ix), t))),
+      // The (Σ proj) rule is used, as in `Stack::get_by_name()`.
+      (Hyp::Field(_, i), Val::Sig(us)) if i < us.len() => {
+        let n = us.len() - 1 - i;
+        let x = ar.term(Term::Var(ix));
+        let u = us[i].1.apply(Term::Init(n + 1, x).eval(env, ar)?, ar)?;
+        Ok(Some((Term::Proj(n, x), u)))
+      }
+      _ => Ok(None),
+    }
+  }
+}
+
+impl DiscrTree<Hyp> {
+  /// Indexes the variables of context `ctx` and the fields of its transparent binders.
+  pub fn hyps<'a, 'b>(ctx: &Stack<'a, 'b>, env: &Stack<'a, 'b>, ar: &'a Arena) -> Result<Self, EvalError<'a, 'b>> {
+    let mut res = DiscrTree::new();
+    for lvl in 0..ctx.len() {
+      let (info, t) = ctx.get(ctx.len() - 1 - lvl, ar).unwrap();
+      let hyps = match t.force() {
+        Val::Sig(us) if info.name.is_empty() => (0..us.len()).map(|i| Hyp::Field(lvl, i)).collect(),
+        _ => vec![Hyp::Var(lvl)],
+      };
+      for hyp in hyps {
+        let (_, ty) = hyp.resolve(ctx, env, ar)?.unwrap();
+        res.insert(ty, ctx, hyp, ar)?;
+      }
+    }
+    Ok(res)
+  }
+}
+
+/// Hashes a quoted goal, numbering holes by their first occurrences in `metas`, so that hashes
+/// do not depend on the ids of fresh holes. Binder information is ignored.
+fn hash_term(term: &Term<'_, '_, Core>, metas: &mut Vec<usize>, h: &mut DefaultHasher) {
+  discriminant(term).hash(h);
+  match term {
+    Term::Univ(v) | Term::Var(v) => v.hash(h),
+    Term::Gc(x) | Term::Fun(_, x) => hash_term(x, metas, h),
+    Term::Ann(x, y) | Term::Let(_, x, y) | Term::Pi(_, x, y) | Term::App(x, y, _) => {
+      hash_term(x, metas, h);
+      hash_term(y, metas, h);
+    }
+    Term::Sig(us) | Term::Tup(us) => {
+      us.len().hash(h);
+      us.iter().for_each(|(_, u)| hash_term(u, metas, h));
+    }
+    Term::Init(n, x) | Term::Proj(n, x) => {
+      n.hash(h);
+      hash_term(x, metas, h);
+    }
+    Term::Meta(m) => {
+      let i = metas.iter().position(|n| n == m).unwrap_or(metas.len());
+      if i == metas.len() {
+        metas.push(*m);
+      }
+      i.hash(h);
+    }
+    Term::Const(g) => ptr::hash(*g as *const Global, h),
+  }
+}
+
+impl<'t, 'a> Search<'t, 'a> {
+  /// Creates a search over hypotheses `hyps`, allocating states in `ar`.
+  pub fn new(hyps: &'t DiscrTree<Hyp>, limits: Limits, ar: &'a Arena) -> Self {
+    Self { hyps, limits, stats: Stats::default(), ar }
+  }
+
+  /// Returns the statistics of all searches so far.
+  pub fn stats(&self) -> Stats {
+    self.stats
+  }
+
+  /// Searches for a term of type `goal` under context `ctx`. Variables introduced by the search are
+  /// also tried as hypotheses, in addition to those in the tree. Returns [`None`] if the frontier or
+  /// any of the budgets is exhausted, including the fuel and byte limit of the arena (see
+  /// [`Arena::set_fuel`] and [`Arena::set_byte_limit`]).
+  ///
+  /// The metacontext is restored afterwards, so holes in `goal` are left unsolved even if the proof
+  /// instantiates them.
+  pub fn prove<'b>(
+    &mut self,
+    goal: Val<'a, 'b>,
+    ctx: &Stack<'a, 'b>,
+    env: &Stack<'a, 'b>,
+  ) -> Result<Option<Term<'a, 'b, Core>>, ElabError<'a, 'b>> {
+    let ar = self.ar;
+    let (mark, bytes) = (ar.meta_mark(), ar.byte_count());
+    let res = match self.run(goal, ctx, env, bytes) {
+      Err(ElabError::TypeError {
+        err: TypeError::EvalError { err: EvalError::OutOfFuel | EvalError::OutOfMemory { .. } },
+      }) => Ok(None),
+      res => res,
+    };
+    ar.rollback_metas(mark);
+    res
+  }
+
+  fn run<'b>(
+    &mut self,
+    goal: Val<'a, 'b>,
+    ctx: &Stack<'a, 'b>,
+    env: &Stack<'a, 'b>,
+    bytes: usize,
+  ) -> Result<Option<Term<'a, 'b, Core>>, ElabError<'a, 'b>> {
+    let ar = self.ar;
+    let root = ar.meta(ctx.len(), ar.term(goal.quote(ctx.len(), ar)?));
+    let goal = Goal { meta: root, ctx: ar.frame(ctx.clone()), env: ar.frame(env.clone()) };
+    let state = State { goals: List::cons(goal, None, ar), sols: None, steps: 0 };
+    let mut seen = HashSet::from([self.hash(&state)?]);
+    let mut frontier = BTreeMap::from([((0, 0), state)]);
+    let mut curr = None;
+    let mut seq = 1;
+    while let Some((_, state)) = frontier.pop_first() {
+      if self.stats.expanded >= self.limits.nodes || ar.byte_count() - bytes > self.limits.bytes {
+        break;
+      }
+      self.switch(curr, state.sols);
+      curr = state.sols;
+      let mut goals = state.goals;
+      while let Some(node) = goals.filter(|node| ar.meta_solved(node.head.meta)) {
+        goals = node.tail;
+      }
+      let Some(node) = goals else { return Ok(Some(Term::Meta(root).zonk(ar)?)) };
+      self.stats.expanded += 1;
+      for child in self.expand(node.head, node.tail, state, ctx.len())? {
+        self.stats.generated += 1;
+        // Solutions of the child are needed to quote and count its goals.
+        self.switch(curr, child.sols);
+        curr = child.sols;
+        if !seen.insert(self.hash(&child)?) {
+          self.stats.transpositions += 1;
+          continue;
+        }
+        let open = List::iter(child.goals).filter(|goal| !ar.meta_solved(goal.meta)).count();
+        frontier.insert((child.steps + open, seq), child);
+        seq += 1;
+        if frontier.len() > self.limits.frontier {
+          frontier.pop_last();
+          self.stats.dropped += 1;
+        }
+      }
+    }
+    Ok(None)
+  }
+
+  /// Replaces solutions `from` in the metacontext by solutions `to`, which share a common tail.
+  fn switch<'b>(&self, from: Sols<'a, 'b>, to: Sols<'a, 'b>) {
+    let len = |sols: Sols<'a, 'b>| sols.map_or(0, |node| node.len);
+    let (mut from, mut to) = (from, to);
+    let mut pending = Vec::new();
+    while !(len(from) == len(to) && from.zip(to).is_none_or(|(x, y)| ptr::eq(x, y))) {
+      if len(from) >= len(to) {
+        let node = from.unwrap();
+        self.ar.unsolve_meta(node.head.0);
+        from = node.tail;
+      } else {
+        let node = to.unwrap();
+        pending.push(node.head);
+        to = node.tail;
+      }
+    }
+    for (m, sol) in pending.into_iter().rev() {
+      self.ar.solve_meta(m, sol);
+    }
+  }
+
+  /// Hashes the quoted types of the open goals of a state, whose solutions are in the metacontext.
+  /// Goals are quoted in a region, which is dropped afterwards.
+  fn hash<'b>(&self, state: &State<'a, 'b>) -> Result<u64, EvalError<'a, 'b>> {
+    let temp = self.ar.region();
+    let mark = temp.meta_mark();
+    let res = self.hash_in(state, &temp).ok();
+    temp.rollback_metas(mark);
+    drop(temp);
+    match res {
+      Some(res) => Ok(res),
+      // Errors are reported from the search arena.
+      None => self.hash_in(state, self.ar),
+    }
+  }
+
+  fn hash_in<'r, 'b>(&self, state: &State<'r, 'b>, ar: &'r Arena) -> Result<u64, EvalError<'r, 'b>> {
+    let (mut h, mut metas) = (DefaultHasher::new(), Vec::new());
+    for goal in List::iter(state.goals).filter(|goal| !ar.meta_solved(goal.meta)) {
+      let len = goal.ctx.len();
+      // SAFETY: holes in `ar` are created and read with the same `'b`, see `Arena::meta_type()`.
+      let ty = unsafe { ar.meta_type(goal.meta) }.unwrap().eval(goal.env, ar)?.quote(len, ar)?;
+      len.hash(&mut h);
+      metas.push(goal.meta);
+      hash_term(&ty, &mut metas, &mut h);
+    }
+    Ok(h.finish())
+  }
+
+  /// Works on `goal`, returning the successors of `state` whose other open goals are `rest`. The
+  /// metacontext is left with the solutions of `state`. Variables from level `base` on were
+  /// introduced by the search.
+  fn expand<'b>(
+    &self,
+    goal: Goal<'a, 'b>,
+    rest: Option<&'a List<'a, Goal<'a, 'b>>>,
+    state: State<'a, 'b>,
+    base: usize,
+  ) -> Result<Vec<State<'a, 'b>>, EvalError<'a, 'b>> {
+    let ar = self.ar;
+    let Goal { meta, ctx, env } = goal;
+    let len = ctx.len();
+    // SAFETY: holes in `ar` are created and read with the same `'b`, see `Arena::meta_type()`.
+    let ty = unsafe { ar.meta_type(meta) }.unwrap().eval(env, ar)?.force_meta(ar)?;
+    // Function types are always introduced.
+    if let Val::Pi(t, u) = ty.force() {
+      let mark = ar.meta_mark();
+      let (ctx, env) = (ar.frame(ctx.extend(u.info, *t, ar)), ar.frame(env.extend(u.info, Val::Free(len), ar)));
+      let body = ar.meta(len + 1, ar.term(u.apply(Val::Free(len), ar)?.quote(len + 1, ar)?));
+      ar.solve_meta(meta, ar.term(Term::Fun(u.info, ar.term(Term::Meta(body)))));
+      let goals = List::cons(Goal { meta: body, ctx, env }, rest, ar);
+      return Ok(vec![self.commit(mark, goals, state)]);
+    }
+    let goal_ty = ty.quote(len, ar)?;
+    let locals = (base..len).map(Hyp::Var);
+    let mut res = Vec::new();
+    for hyp in self.hyps.get_term(&goal_ty, ctx, ar).into_iter().copied().chain(locals) {
+      let temp = ar.region();
+      let temp_mark = temp.meta_mark();
+      let attempt = self.apply(hyp, goal, ty, &temp).map(|res| res.is_some()).ok();
+      temp.rollback_metas(temp_mark);
+      drop(temp);
+      // Errors are reported from the search arena.
+      if attempt == Some(false) {
+        continue;
+      }
+      let mark = ar.meta_mark();
+      let Some((sol, args)) = self.apply(hyp, goal, ty, ar)? else {
+        ar.rollback_metas(mark);
+        continue;
+      };
+      ar.solve_meta(meta, ar.term(sol));
+      let mut goals = rest;
+      for m in args.into_iter().filter(|m| !ar.meta_solved(*m)) {
+        goals = List::cons(Goal { meta: m, ctx, env }, goals, ar);
+      }
+      res.push(self.commit(mark, goals, state));
+    }
+    Ok(res)
+  }
+
+  /// Applies hypothesis `hyp` to fresh holes for all its parameters, and unifies its conclusion
+  /// with `ty`, the type of `goal`. Returns the application and the holes if successful.
+  fn apply<'r, 'b>(
+    &self,
+    hyp: Hyp,
+    goal: Goal<'r, 'b>,
+    ty: Val<'r, 'b>,
+    ar: &'r Arena,
+  ) -> Result<Option<Applied<'r, 'b>>, EvalError<'r, 'b>> {
+    let Goal { ctx, env, .. } = goal;
+    let len = ctx.len();
+    let Some((mut sol, mut hyp_ty)) = hyp.resolve(ctx, env, ar)? else { return Ok(None) };
+    let mut args = Vec::new();
+    while let Val::Pi(t, u) = hyp_ty.force_meta(ar)?.force() {
+      let m = ar.meta(len, ar.term(t.quote(len, ar)?));
+      sol = Term::App(ar.term(sol), ar.term(Term::Meta(m)), false);
+      hyp_ty = u.apply(Term::Meta(m).eval(env, ar)?, ar)?;
+      args.push(m);
+    }
+    Ok(hyp_ty.conv(&ty, len, ar)?.then_some((sol, args)))
+  }
+
+  /// Records the holes solved since `mark` as solutions of a successor of `state`, and removes them
+  /// from the metacontext again.
+  fn commit<'b>(
+    &self,
+    mark: (usize, usize),
+    goals: Option<&'a List<'a, Goal<'a, 'b>>>,
+    state: State<'a, 'b>,
+  ) -> State<'a, 'b> {
+    let ar = self.ar;
+    let mut sols = state.sols;
+    let solved = ar.solved_since(mark);
+    for m in &solved {
+      // SAFETY: holes in `ar` are created and read with the same `'b`, see `Arena::meta_type()`.
+      sols = List::cons((*m, unsafe { ar.meta_solution(*m) }.unwrap()), sols, ar);
+    }
+    for m in solved.into_iter().rev() {
+      ar.unsolve_meta(m);
+    }
+    State { goals, sols, steps: state.steps + 1 }
+  }
+}
@@ -0,0 +1,148 @@
+use std::collections::{HashMap, HashSet};
+use std::ptr;
+
+use super::*;
+use crate::arena::{Arena, Relocate};
+use crate::ir::{Bound, Core, Field, Global, Name, Named, Stack, Term};
+
+/// # Incremental checking sessions
+///
+/// Checks blocks of top-level definitions (i.e. the fields of a top-level tuple) as global
+/// definitions, keeping the results between edits of the block. Each definition records the
+/// global definitions that its names resolved to; when the block is checked again, a definition is
+/// reused if its preterm is unchanged and all these names still resolve to the same definitions.
+/// Otherwise, it is checked again, which in turn invalidates its dependents. Checking an edited
+/// block therefore takes time proportional to the edited definitions and their dependents, rather
+/// than to the whole block.
+///
+/// Cache entries of definitions which are no longer in the block are dropped. Preterms, results
+/// and errors are allocated in a long-lived arena, which is never reset, so their memory is not
+/// freed along with them: callers which keep a session across many edits must drop it together
+/// with its arena from time to time (e.g. when [`Arena::byte_count`] grows too large), and check
+/// the block again with a new session on a fresh arena.
+#[derive(Debug)]
+pub struct Session<'b> {
+  ar: &'b Arena,
+  globals: Globals<'b>,
+  cache: HashMap<(Name<'b>, usize), Entry<'b>>,
+  checked: usize,
+}
+
+/// A checked definition, its preterm and the global definitions it refers to.
+#[derive(Debug)]
+struct Entry<'b> {
+  term: &'b Term<'b, 'b, Named>,
+  global: &'b Global<'b>,
+  deps: Vec<&'b Global<'b>>,
+}
+
+impl<'b> Session<'b> {
+  /// Creates an empty session allocating in the given arena.
+  pub fn new(ar: &'b Arena) -> Self {
+    Self { ar, globals: Globals::new(), cache: HashMap::new(), checked: 0 }
+  }
+
+  /// Checks a block of definitions in order, each of which can refer to earlier ones by name.
+  /// Returns the resulting global definitions if all of them are well-typed, or the first error.
+  /// Definitions of the previous block are reused where possible, and the others are forgotten.
+  pub fn check(&mut self, defs: &[(&'b Field<'b>, Term<'b, 'b, Named>)]) -> Result<&Globals<'b>, ElabError<'b, 'b>> {
+    let ar = self.ar;
+    self.globals = Globals::new();
+    self.checked = 0;
+    // Definitions are identified by name and the number of earlier definitions of the same name.
+    let mut seen = HashMap::new();
+    let keys = defs.iter().map(|(info, _)| (info.name, *seen.entry(info.name).and_modify(|n| *n += 1).or_insert(0)));
+    let keys = keys.collect::<Vec<_>>();
+    let present = keys.iter().copied().collect::<HashSet<_>>();
+    self.cache.retain(|key, _| present.contains(key));
+    for ((info, term), key) in defs.iter().zip(keys) {
+      let reused = self.cache.get(&key).filter(|entry| {
+        same(entry.term, term)
+          && entry.deps.iter().all(|g| self.globals.get(g.info.name).is_some_and(|h| ptr::eq(*g, h)))
+      });
+      if let Some(entry) = reused {
+        self.globals.insert(entry.global);
+        continue;
+      }
+      // Intermediate objects are allocated in a region, only the results are kept.
+      let temp = ar.region();
+      let (ctx, env) = (Stack::new(&temp), Stack::new(&temp));
+      temp.set_gluing(true);
+      let res = term.infer_with(&self.globals, &ctx, &env, &temp);
+      temp.set_gluing(false);
+      // Globals outlive the metacontext of the region, so holes are replaced by their solutions.
+      let res = res.and_then(|(x, ty)| Ok((x.zonk(&temp)?, ty.zonk(&env, &temp)?)));
+      let (x, ty) = res.map_err(|e| ar.copy_in(|| e.relocate(ar)))?;
+      let val = x.eval(&env, &temp).map_err(|e| ar.copy_in(|| ElabError::from(e.relocate(ar))))?;
+      let global = ar.copy_in(|| Global {
+        info: ar.bound(Bound { name: info.name, attrs: info.attrs }),
+        term: ar.relocate_term(&x),
+        ty: ty.relocate(ar),
+        val: val.relocate(ar),
+      });
+      let global = ar.global(global);
+      let mut deps = Vec::new();
+      consts(global.term, &mut deps);
+      self.cache.insert(key, Entry { term: ar.term(*term), global, deps });
+      self.globals.insert(global);
+      self.checked += 1;
+    }
+    Ok(&self.globals)
+  }
+
+  /// Returns the global definitions of the last successfully checked prefix of the block.
+  pub fn globals(&self) -> &Globals<'b> {
+    &self.globals
+  }
+
+  /// Returns the number of definitions checked (i.e. not reused) by the last call to
+  /// [`Session::check`].
+  pub fn checked_count(&self) -> usize {
+    self.checked
+  }
+}
+
+/// Collects the global definitions referred to by a core term.
+fn consts<'b>(term: &Term<'_, 'b, Core>, res: &mut Vec<&'b Global<'b>>) {
+  match term {
+    Term::Univ(_) | Term::Var(_) | Term::Meta(_) => {}
+    Term::Gc(x) | Term::Fun(_, x) | Term::Init(_, x) | Term::Proj(_, x) => consts(x, res),
+    Term::Ann(x, y) | Term::Let(_, x, y) | Term::Pi(_, x, y) | Term::App(x, y, _) => {
+      consts(x, res);
+      consts(y, res);
+    }
+    Term::Sig(us) | Term::Tup(us) => us.iter().for_each(|(_, u)| consts(u, res)),
+    Term::Const(g) => {
+      if !res.iter().any(|h| ptr::eq(*g, *h)) {
+        res.push(g);
+      }
+    }
+  }
+}
+
+/// Checks if two preterms are syntactically identical.
+fn same(x: &Term<'_, '_, Named>, y: &Term<'_, '_, Named>) -> bool {
+  // Reused preterms (e.g. of unchanged definitions in the language server) are shared.
+  if std::ptr::eq(x, y) {
+    return true;
+  }
+  match (x, y) {
+    (Term::Gc(x), Term::Gc(y)) => same(x, y),
+    (Term::Univ(i), Term::Univ(j)) | (Term::Var(i), Term::Var(j)) | (Term::Meta(i), Term::Meta(j)) => i == j,
+    (Term::Ann(x, t), Term::Ann(y, u)) => same(x, y) && same(t, u),
+    (Term::Let(i, v, x), Term::Let(j, w, y)) | (Term::Pi(i, v, x), Term::Pi(j, w, y)) => {
+      (i.name, i.attrs) == (j.name, j.attrs) && same(v, w) && same(x, y)
+    }
+    (Term::Fun(i, x), Term::Fun(j, y)) => (i.name, i.attrs) == (j.name, j.attrs) && same(x, y),
+    (Term::App(f, x, d), Term::App(g, y, e)) => d == e && same(f, g) && same(x, y),
+    (Term::Sig(us), Term::Sig(vs)) | (Term::Tup(us), Term::Tup(vs)) => {
+      us.len() == vs.len()
+        && us.iter().zip(vs.iter()).all(|((i, u), (j, v))| (i.name, i.attrs) == (j.name, j.attrs) && same(u, v))
+    }
+    (Term::Init(n, x), Term::Init(m, y)) | (Term::Proj(n, x), Term::Proj(m, y)) => n == m && same(x, y),
+    (Term::NamedVar(x, _), Term::NamedVar(y, _)) => x == y,
+    (Term::NamedProj(x, a, _), Term::NamedProj(y, b, _)) => x == y && same(a, b),
+    (Term::Const(g), Term::Const(h)) => ptr::eq(*g, *h),
+    _ => false,
+  }
+}
@@ -1,35 +1,87 @@
+use std::collections::HashMap;
 use std::slice::from_raw_parts;
 
 use super::*;
 use crate::arena::{Arena, Relocate};
-use crate::ir::{Bound, Clos, Core, Name, Named, Stack, Term, TypeError, Val};
+use crate::ir::{Bound, Clos, Core, Field, Index, Name, Named, Schedule, Sink, Stack, Term, TypeError, Val};
+use crate::profile::Op;
+
+/// Results of checking and evaluating a tuple field.
+type FieldResult<'a, 'b> = Result<(Term<'a, 'b, Core>, Val<'a, 'b>), ElabError<'a, 'b>>;
 
 impl<'a, 'b> Stack<'a, 'b> {
-  /// Returns the value with the given name, if it exists.
+  /// Returns the index of fields of transparent binders in the context. Only contexts built by
+  /// [`Stack::bind`] have one.
+  pub fn index(&self) -> Option<&'a Index<'a, 'b>> {
+    match self {
+      Stack::Nil => Some(Index::empty()),
+      Stack::Cons { index, .. } => *index,
+    }
+  }
+
+  /// Extends the context with a new binder, updating the index if `self` has one. If the binder is
+  /// transparent, the names of all fields of its type are indexed.
+  pub fn bind(&self, info: &'b Bound<'b>, value: Val<'a, 'b>, ar: &'a Arena) -> Self {
+    let lvl = self.len();
+    let index = self.index().map(|index| match (info.name.is_empty(), value.force()) {
+      (true, Val::Sig(us)) => {
+        ar.name_index(index.insert(us.iter().enumerate().map(|(i, (info, _))| (info.name, (lvl, i))), ar))
+      }
+      _ => index,
+    });
+    self.bind_indexed(info, value, index, ar)
+  }
+
+  /// Extends the context with a new binder, using the given index for the extended context. This
+  /// allows indices of transparent binders to be built incrementally, one field at a time.
+  pub fn bind_indexed(
+    &self,
+    info: &'b Bound<'b>,
+    value: Val<'a, 'b>,
+    index: Option<&'a Index<'a, 'b>>,
+    ar: &'a Arena,
+  ) -> Self {
+    let mut res = self.extend(info, value, ar);
+    if let Stack::Cons { index: res_index, .. } = &mut res {
+      *res_index = index;
+    }
+    res
+  }
+
+  /// Returns the de Bruijn index, projection index and binder type of the given name, if it
+  /// exists.
   ///
   /// Pre-conditions:
   ///
   /// - `self` is well-formed context.
-  pub fn get_by_name(&self, name: Name<'b>, env: &Self, ar: &'a Arena) -> Option<(usize, Option<usize>, Val<'a, 'b>)> {
+  fn position(&self, name: Name<'b>, ar: &'a Arena) -> Option<(usize, Option<usize>, Val<'a, 'b>)> {
     let mut curr = self;
     let mut ix = 0;
+    // The most recent field with the given name, once an indexed frame is reached.
+    let mut field = None;
     ar.inc_lookup_count();
-    while let Stack::Cons { prev, info, value: t } = curr {
+    while let Stack::Cons { prev, info, value: t, index, len, .. } = curr {
       ar.inc_link_count();
+      // Fields of all transparent bindings at or below an indexed frame are indexed.
+      if let (None, Some(index)) = (field, index) {
+        field = Some(index.get(name));
+      }
+      if let Some(Some((lvl, i))) = field {
+        if lvl + 1 == *len {
+          let Val::Sig(us) = t.force() else { return None };
+          return Some((ix, Some(us.len() - 1 - i), *t));
+        }
+      }
       // Check for direct bindings.
       if info.name == name {
         // The (var) rule is used.
         return Some((ix, None, *t));
       }
       // Check for direct transparent bindings.
-      if info.name.is_empty() {
-        if let Val::Sig(us) = t {
-          for (n, (info, u)) in us.iter().rev().enumerate() {
-            if info.name == name {
-              // The (var) and (Σ proj) rules are used.
-              let u = u.apply(Term::Init(n + 1, ar.term(Term::Var(ix))).eval(env, ar).unwrap(), ar).unwrap();
-              return Some((ix, Some(n), u));
-            }
+      if field.is_none() && info.name.is_empty() {
+        if let Val::Sig(us) = t.force() {
+          if let Some(n) = us.iter().rev().position(|(info, _)| info.name == name) {
+            return Some((ix, Some(n), *t));
           }
         }
       }
@@ -39,71 +91,50 @@ impl<'a, 'b> Stack<'a, 'b> {
     None
   }
 
-  /// Checks if a name can be directly used as a named variable.
+  /// Returns the value with the given name, if it exists.
   ///
   /// Pre-conditions:
   ///
   /// - `self` is well-formed context.
-  pub fn is_name_valid(&self, ix: usize, proj: Option<usize>, name: Name<'b>, _env: &Self, ar: &'a Arena) -> bool {
-    // Only non-empty names may be used.
-    if !name.is_empty() {
-      let mut curr = self;
-      let mut ix = ix;
-      ar.inc_lookup_count();
-      while let Stack::Cons { prev, info, value } = curr {
-        ar.inc_link_count();
-        // Already reached the desired index.
-        if ix == 0 {
-          return match proj {
-            None => info.name == name,
-            Some(n) => {
-              if let Val::Sig(us) = value {
-                let mut n = n;
-                for (info, _) in us.iter().rev() {
-                  // Already reached the desired index.
-                  if n == 0 {
-                    return info.name == name;
-                  }
-                  // Check for shadowing in direct fields.
-                  if info.name == name {
-                    return false;
-                  }
-                  n -= 1;
-                }
-              }
-              false
-            }
-          };
-        }
-        // Check for shadowing in direct bindings.
-        if info.name == name {
-          return false;
-        }
-        // Check for shadowing in direct transparent bindings.
-        if info.name.is_empty() {
-          if let Val::Sig(us) = value {
-            if us.iter().any(|(info, _)| info.name == name) {
-              return false;
-            }
-          }
-        }
-        ix -= 1;
-        curr = prev;
+  pub fn get_by_name(&self, name: Name<'b>, env: &Self, ar: &'a Arena) -> Option<(usize, Option<usize>, Val<'a, 'b>)> {
+    match self.position(name, ar)? {
+      // The (var) rule is used.
+      (ix, None, t) => Some((ix, None, t)),
+      // The (var) and (Σ proj) rules are used.
+      (ix, Some(n), t) => {
+        let Val::Sig(us) = t.force() else { unreachable!() };
+        let (_, u) = &us[us.len() - 1 - n];
+        let u = u.apply(Term::Init(n + 1, ar.term(Term::Var(ix))).eval(env, ar).unwrap(), ar).unwrap();
+        Some((ix, Some(n), u))
       }
     }
-    false
+  }
+
+  /// Checks if a name can be directly used as a named variable, i.e. it is non-empty and resolves
+  /// to the given variable without being shadowed.
+  ///
+  /// Pre-conditions:
+  ///
+  /// - `self` is well-formed context.
+  pub fn is_name_valid(&self, ix: usize, proj: Option<usize>, name: Name<'b>, _env: &Self, ar: &'a Arena) -> bool {
+    !name.is_empty() && self.position(name, ar).is_some_and(|(i, p, _)| (i, p) == (ix, proj))
   }
 }
 
 impl<'b> Name<'b> {
-  /// Resolves a named variable to a core term and its type.
+  /// Resolves a named variable to a core term and its type. Names not bound in `ctx` are looked up
+  /// in `globals`.
   pub fn resolve_named_var<'a>(
     &self,
+    globals: &Globals<'b>,
     ctx: &Stack<'a, 'b>,
     env: &Stack<'a, 'b>,
     ar: &'a Arena,
   ) -> Result<(Term<'a, 'b, Core>, Val<'a, 'b>), ElabError<'a, 'b>> {
-    let (ix, proj, x_type) = ctx.get_by_name(*self, env, ar).ok_or_else(|| ElabError::ctx_name(*self))?;
+    let Some((ix, proj, x_type)) = ctx.get_by_name(*self, env, ar) else {
+      let g = globals.get(*self).ok_or_else(|| ElabError::ctx_name(*self))?;
+      return Ok((Term::Const(g), g.ty));
+    };
     match proj {
       None => Ok((Term::Var(ix), x_type)),
       Some(n) => Ok((Term::Proj(n, ar.term(Term::Var(ix))), x_type)),
@@ -120,7 +151,7 @@ impl<'b> Name<'b> {
     env: &Stack<'a, 'b>,
     ar: &'a Arena,
   ) -> Result<(Term<'a, 'b, Core>, Val<'a, 'b>), ElabError<'a, 'b>> {
-    match x_type {
+    match x_type.force() {
       Val::Sig(us) => {
         for (n, (info, u)) in us.iter().rev().enumerate() {
           // Check for direct fields.
@@ -137,23 +168,26 @@ impl<'b> Name<'b> {
   }
 
   /// Presents a variable as a named variable and returns its type.
-  pub fn present_named_var<'a>(
+  pub fn present_named_var<'a, S: Sink>(
     ix: usize,
     proj: Option<usize>,
     ctx: &Stack<'a, 'b>,
     env: &Stack<'a, 'b>,
     ar: &'a Arena,
-  ) -> Result<(Term<'a, 'b, Named>, Val<'a, 'b>), TypeError<'a, 'b, Core>> {
-    let (info, t_val) = ctx.get(ix, ar).ok_or_else(|| TypeError::ctx_index(ix, ctx.len()))?;
+  ) -> Result<(Term<'a, 'b, Named>, Val<'a, 'b>), S::Error<'a, 'b>> {
+    let (info, t_val) = ctx.get(ix, ar).ok_or_else(|| S::error(|| TypeError::ctx_index(ix, ctx.len())))?;
     match proj {
       None => match ctx.is_name_valid(ix, proj, info.name, env, ar) {
         true => Ok((Term::NamedVar(info.name, ()), t_val)),
         false => Ok((Term::Var(ix), t_val)),
       },
       Some(n) => {
-        let us_val = t_val.as_sig(|t_val| TypeError::sig_expected(ar.term(Term::Var(ix)), t_val, ctx, env, ar))?;
-        let i =
-          us_val.len().checked_sub(n + 1).ok_or_else(|| TypeError::sig_proj(n, Val::Sig(us_val), ctx, env, ar))?;
+        let us_val =
+          t_val.as_sig(|t_val| S::error(|| TypeError::sig_expected(ar.term(Term::Var(ix)), t_val, ctx, env, ar)))?;
+        let i = us_val
+          .len()
+          .checked_sub(n + 1)
+          .ok_or_else(|| S::error(|| TypeError::sig_proj(n, Val::Sig(us_val), ctx, env, ar)))?;
         let (info, u_val) = &us_val[i];
         let u_val = u_val.apply(Term::Init(n + 1, ar.term(Term::Var(ix))).eval(env, ar)?, ar)?;
         match ctx.is_name_valid(ix, proj, info.name, env, ar) {
@@ -165,7 +199,7 @@ impl<'b> Name<'b> {
   }
 
   /// Presents a projection as a named projection and returns its type.
-  pub fn present_named_proj<'a>(
+  pub fn present_named_proj<'a, S: Sink>(
     n: usize,
     x_old: &'a Term<'a, 'b, Core>,
     x_new: Term<'a, 'b, Named>,
@@ -173,9 +207,12 @@ impl<'b> Name<'b> {
     ctx: &Stack<'a, 'b>,
     env: &Stack<'a, 'b>,
     ar: &'a Arena,
-  ) -> Result<(Term<'a, 'b, Named>, Val<'a, 'b>), TypeError<'a, 'b, Core>> {
-    let us_val = x_type.as_sig(|x_type| TypeError::sig_expected(x_old, x_type, ctx, env, ar))?;
-    let i = us_val.len().checked_sub(n + 1).ok_or_else(|| TypeError::sig_proj(n, Val::Sig(us_val), ctx, env, ar))?;
+  ) -> Result<(Term<'a, 'b, Named>, Val<'a, 'b>), S::Error<'a, 'b>> {
+    let us_val = x_type.as_sig(|x_type| S::error(|| TypeError::sig_expected(x_old, x_type, ctx, env, ar)))?;
+    let i = us_val
+      .len()
+      .checked_sub(n + 1)
+      .ok_or_else(|| S::error(|| TypeError::sig_proj(n, Val::Sig(us_val), ctx, env, ar)))?;
     let (info, u_val) = &us_val[i];
     let u_val = u_val.apply(Term::Init(n + 1, x_old).eval(env, ar)?, ar)?;
     match !info.name.is_empty() && !us_val.iter().rev().take(n).any(|(i, _)| i.name == info.name) {
@@ -185,6 +222,46 @@ impl<'b> Name<'b> {
   }
 }
 
+impl<'a, 'b> Term<'a, 'b, Core> {
+  /// Replaces holes in elaborated term `self` by their solutions, so that the result no longer
+  /// depends on the metacontext. Returns an error on the first unsolved hole.
+  pub fn zonk(&self, ar: &'a Arena) -> Result<Self, ElabError<'a, 'b>> {
+    let zonk = |x: &Self| x.zonk(ar).map(|x| ar.term(x));
+    Ok(match self {
+      Term::Univ(_) | Term::Var(_) | Term::Const(_) => *self,
+      Term::Gc(x) => Term::Gc(zonk(x)?),
+      Term::Ann(x, t) => Term::Ann(zonk(x)?, zonk(t)?),
+      Term::Let(info, v, x) => Term::Let(info, zonk(v)?, zonk(x)?),
+      Term::Pi(info, t, u) => Term::Pi(info, zonk(t)?, zonk(u)?),
+      Term::Fun(info, b) => Term::Fun(info, zonk(b)?),
+      Term::App(f, x, dot) => Term::App(zonk(f)?, zonk(x)?, *dot),
+      Term::Sig(us) | Term::Tup(us) => {
+        let terms = ar.terms(us.len());
+        for (term, (info, u)) in terms.iter_mut().zip(us.iter()) {
+          *term = (info, u.zonk(ar)?);
+        }
+        match self {
+          Term::Sig(_) => Term::Sig(terms),
+          _ => Term::Tup(terms),
+        }
+      }
+      Term::Init(n, x) => Term::Init(*n, zonk(x)?),
+      Term::Proj(n, x) => Term::Proj(*n, zonk(x)?),
+      // SAFETY: holes in `ar` are created and read with the same `'b`, see `Arena::meta_type()`.
+      Term::Meta(m) => unsafe { ar.meta_solution(*m) }.ok_or_else(|| ElabError::unsolved_meta(*m))?.zonk(ar)?,
+    })
+  }
+}
+
+impl<'a, 'b> Val<'a, 'b> {
+  /// Replaces holes in value `self` under environment `env` by their solutions, by quoting,
+  /// zonking (see [`Term::zonk`]) and evaluating it again. Returns an error on the first unsolved
+  /// hole.
+  pub fn zonk(&self, env: &Stack<'a, 'b>, ar: &'a Arena) -> Result<Self, ElabError<'a, 'b>> {
+    Ok(self.quote(env.len(), ar)?.zonk(ar)?.eval(env, ar)?)
+  }
+}
+
 impl<'a, 'b> Term<'a, 'b, Named> {
   /// Given preterm `self`, returns the type of `self`. This is mutually recursive with
   /// [`Term::check`], and is the entry point of Coquand’s type checking algorithm.
@@ -202,39 +279,54 @@ impl<'a, 'b> Term<'a, 'b, Named> {
     env: &Stack<'a, 'b>,
     ar: &'a Arena,
   ) -> Result<(Term<'a, 'b, Core>, Val<'a, 'b>), ElabError<'a, 'b>> {
+    self.infer_with(&Globals::new(), ctx, env, ar)
+  }
+
+  /// Same as [`Term::infer`], but names not bound in `ctx` are resolved to global definitions in
+  /// `globals`.
+  pub fn infer_with(
+    &self,
+    globals: &Globals<'b>,
+    ctx: &Stack<'a, 'b>,
+    env: &Stack<'a, 'b>,
+    ar: &'a Arena,
+  ) -> Result<(Term<'a, 'b, Core>, Val<'a, 'b>), ElabError<'a, 'b>> {
+    ar.profile_rule(Op::Infer, || self.variant());
     match self {
-      // The garbage collection mark forces the subterm to be inferred inside a new arena.
+      // The garbage collection mark forces the subterm to be inferred inside a new arena region.
       Term::Gc(x) => {
-        x.infer(ctx, env, &Arena::new()).map(|(x, v)| (x.relocate(ar), v.relocate(ar))).map_err(|e| e.relocate(ar))
+        let temp = ar.region();
+        let res = x.infer_with(globals, ctx, env, &temp);
+        ar.copy_in(|| res.map(|(x, v)| (x.relocate(ar), v.relocate(ar))).map_err(|e| e.relocate(ar)))
       }
       // The (univ) rule is used.
       Term::Univ(v) => Ok(((Term::Univ(*v)), Val::Univ(Term::univ_univ(*v)?))),
       // The (ann) rule is used.
       // To establish pre-conditions for `eval()` and `check()`, the type of `t` is checked first.
       Term::Ann(x_old, t_old) => {
-        let (t_new, t_type) = t_old.infer(ctx, env, ar)?;
+        let (t_new, t_type) = t_old.infer_with(globals, ctx, env, ar)?;
         let _ = t_type.as_univ(|t_type| TypeError::type_expected(t_old, t_type, ctx, env, ar))?;
         let t_val = t_new.eval(env, ar)?;
-        let x_new = x_old.check(t_val, ctx, env, ar)?;
+        let x_new = x_old.check_with(t_val, globals, ctx, env, ar)?;
         Ok(((Term::Ann(ar.term(x_new), ar.term(t_new))), t_val))
       }
       // The (let) and (extend) rules are used.
       // The (ζ) rule is implicitly used on the value (in normal form) from the recursive call.
       Term::Let(info, v_old, x_old) => {
-        let (v_new, v_type) = v_old.infer(ctx, env, ar)?;
-        let v_val = v_new.eval(env, ar)?;
-        let ctx_ext = ctx.extend(info, v_type, ar);
+        let (v_new, v_type) = ar.profile_scope(info.name.as_str(), || v_old.infer_with(globals, ctx, env, ar))?;
+        let v_val = v_new.eval(env, ar)?.define(ar);
+        let ctx_ext = ctx.bind(info, v_type, ar);
         let env_ext = env.extend(info, v_val, ar);
-        let (x_new, x_type) = x_old.infer(&ctx_ext, &env_ext, ar)?;
+        let (x_new, x_type) = x_old.infer_with(globals, &ctx_ext, &env_ext, ar)?;
         Ok(((Term::Let(info, ar.term(v_new), ar.term(x_new))), x_type))
       }
       // The (Π form) and (extend) rules are used.
       Term::Pi(info, t_old, u_old) => {
-        let (t_new, t_type) = t_old.infer(ctx, env, ar)?;
+        let (t_new, t_type) = t_old.infer_with(globals, ctx, env, ar)?;
         let t_lvl = t_type.as_univ(|t_type| TypeError::type_expected(t_old, t_type, ctx, env, ar))?;
-        let ctx_ext = ctx.extend(info, t_new.eval(env, ar)?, ar);
+        let ctx_ext = ctx.bind(info, t_new.eval(env, ar)?, ar);
         let env_ext = env.extend(info, Val::Free(env.len()), ar);
-        let (u_new, u_type) = u_old.infer(&ctx_ext, &env_ext, ar)?;
+        let (u_new, u_type) = u_old.infer_with(globals, &ctx_ext, &env_ext, ar)?;
         let u_lvl = u_type.as_univ(|u_type| TypeError::type_expected(u_old, u_type, ctx, env, ar))?;
         Ok(((Term::Pi(info, ar.term(t_new), ar.term(u_new))), Val::Univ(Term::pi_univ(t_lvl, u_lvl)?)))
       }
@@ -242,9 +334,9 @@ impl<'a, 'b> Term<'a, 'b, Named> {
       Term::Fun(_, _) => Err(TypeError::ann_expected(ar.term(*self)).into()),
       // The (Π elim) rule is used.
       Term::App(f_old, x_old, dot) => {
-        let (f_new, f_type) = f_old.infer(ctx, env, ar)?;
+        let (f_new, f_type) = f_old.infer_with(globals, ctx, env, ar)?;
         let (t_val, u_val) = f_type.as_pi(|f_type| TypeError::pi_expected(f_old, f_type, ctx, env, ar))?;
-        let x_new = x_old.check(*t_val, ctx, env, ar)?;
+        let x_new = x_old.check_with(*t_val, globals, ctx, env, ar)?;
         Ok(((Term::App(ar.term(f_new), ar.term(x_new), *dot)), u_val.apply(x_new.eval(env, ar)?, ar)?))
       }
       // The (Σ form), (⊤ form) and (extend) rules are used.
@@ -252,19 +344,22 @@ impl<'a, 'b> Term<'a, 'b, Named> {
         let mut lvl = Term::unit_univ()?;
         let us_new = ar.terms(us_old.len());
         let us_val = ar.closures(us_old.len()).as_mut_ptr();
+        let mut index = ctx.index();
         for (i, (info, u_old)) in us_old.iter().enumerate() {
           // SAFETY: the borrowed range `&us_val[..i]` is no longer modified.
           let t_val = Val::Sig(unsafe { from_raw_parts(us_val, i) });
           let x_val = Val::Free(env.len());
-          let ctx_ext = ctx.extend(Bound::empty(), t_val, ar);
+          let ctx_ext = ctx.bind_indexed(Bound::empty(), t_val, index, ar);
           let env_ext = env.extend(Bound::empty(), x_val, ar);
-          let (u_new, u_type) = u_old.infer(&ctx_ext, &env_ext, ar)?;
+          let (u_new, u_type) =
+            ar.profile_scope(info.name.as_str(), || u_old.infer_with(globals, &ctx_ext, &env_ext, ar))?;
           let u_lvl = u_type.as_univ(|u_type| TypeError::type_expected(u_old, u_type, ctx, env, ar))?;
           lvl = Term::sig_univ(lvl, u_lvl)?;
           us_new[i] = (*info, u_new);
           let u_val = Clos { info: Bound::empty(), env: env.clone(), body: ar.term(u_new) };
           // SAFETY: `i < us_old.len()` which is the valid size of `us_val`.
           unsafe { *us_val.add(i) = (info, u_val) };
+          index = index.map(|index| ar.name_index(index.insert([(info.name, (ctx.len(), i))], ar)));
         }
         Ok(((Term::Sig(us_new)), Val::Univ(lvl)))
       }
@@ -272,7 +367,7 @@ impl<'a, 'b> Term<'a, 'b, Named> {
       Term::Tup(_) => Err(TypeError::ann_expected(ar.term(*self)).into()),
       // The (Σ init) rule is used.
       Term::Init(n, x_old) => {
-        let (x_new, x_type) = x_old.infer(ctx, env, ar)?;
+        let (x_new, x_type) = x_old.infer_with(globals, ctx, env, ar)?;
         let us_val = x_type.as_sig(|x_type| TypeError::sig_expected(x_old, x_type, ctx, env, ar))?;
         let m = us_val.len().checked_sub(*n).ok_or_else(|| TypeError::sig_init(*n, Val::Sig(us_val), ctx, env, ar))?;
         Ok(((Term::Init(*n, ar.term(x_new))), Val::Sig(&us_val[..m])))
@@ -286,15 +381,17 @@ impl<'a, 'b> Term<'a, 'b, Named> {
         Ok(((Term::Var(*ix)), t_val))
       }
       Term::Proj(n, x_old) => {
-        let (x_new, x_type) = x_old.infer(ctx, env, ar)?;
+        let (x_new, x_type) = x_old.infer_with(globals, ctx, env, ar)?;
         let us_val = x_type.as_sig(|x_type| TypeError::sig_expected(x_old, x_type, ctx, env, ar))?;
         let i =
           us_val.len().checked_sub(n + 1).ok_or_else(|| TypeError::sig_proj(*n, Val::Sig(us_val), ctx, env, ar))?;
         Ok(((Term::Proj(*n, ar.term(x_new))), us_val[i].1.apply(Term::Init(n + 1, ar.term(x_new)).eval(env, ar)?, ar)?))
       }
-      Term::NamedVar(name, _) => name.resolve_named_var(ctx, env, ar),
+      Term::NamedVar(name, _) => name.resolve_named_var(globals, ctx, env, ar),
+      // Global definitions are already checked.
+      Term::Const(g) => Ok((Term::Const(g), g.ty)),
       Term::NamedProj(name, x_old, _) => {
-        let (x_new, x_type) = x_old.infer(ctx, env, ar)?;
+        let (x_new, x_type) = x_old.infer_with(globals, ctx, env, ar)?;
         name.resolve_named_proj(x_old, x_new, x_type, ctx, env, ar)
       }
     }
@@ -316,15 +413,29 @@ impl<'a, 'b> Term<'a, 'b, Named> {
     env: &Stack<'a, 'b>,
     ar: &'a Arena,
   ) -> Result<Term<'a, 'b, Core>, ElabError<'a, 'b>> {
+    self.check_with(t, &Globals::new(), ctx, env, ar)
+  }
+
+  /// Same as [`Term::check`], but names not bound in `ctx` are resolved to global definitions in
+  /// `globals`.
+  pub fn check_with(
+    &self,
+    t: Val<'a, 'b>,
+    globals: &Globals<'b>,
+    ctx: &Stack<'a, 'b>,
+    env: &Stack<'a, 'b>,
+    ar: &'a Arena,
+  ) -> Result<Term<'a, 'b, Core>, ElabError<'a, 'b>> {
+    ar.profile_rule(Op::Check, || self.variant());
     match self {
       // The (let) and (extend) rules are used.
       // The (ζ) rule is implicitly inversely used on the `t` passed into the recursive call.
       Term::Let(info, v_old, x_old) => {
-        let (v_new, v_type) = v_old.infer(ctx, env, ar)?;
-        let v_val = v_new.eval(env, ar)?;
-        let ctx_ext = ctx.extend(info, v_type, ar);
+        let (v_new, v_type) = ar.profile_scope(info.name.as_str(), || v_old.infer_with(globals, ctx, env, ar))?;
+        let v_val = v_new.eval(env, ar)?.define(ar);
+        let ctx_ext = ctx.bind(info, v_type, ar);
         let env_ext = env.extend(info, v_val, ar);
-        let x_new = x_old.check(t, &ctx_ext, &env_ext, ar)?;
+        let x_new = x_old.check_with(t, globals, &ctx_ext, &env_ext, ar)?;
         Ok(Term::Let(info, ar.term(v_new), ar.term(x_new)))
       }
       // The (Π intro) and (extend) rules is used.
@@ -332,9 +443,9 @@ impl<'a, 'b> Term<'a, 'b, Named> {
       Term::Fun(info, b_old) => {
         let (t_val, u_val) = t.as_pi(|t| TypeError::pi_ann_expected(t, ctx, env, ar))?;
         let x_val = Val::Free(env.len());
-        let ctx_ext = ctx.extend(info, *t_val, ar);
+        let ctx_ext = ctx.bind(info, *t_val, ar);
         let env_ext = env.extend(info, x_val, ar);
-        let b_new = b_old.check(u_val.apply(x_val, ar)?, &ctx_ext, &env_ext, ar)?;
+        let b_new = b_old.check_with(u_val.apply(x_val, ar)?, globals, &ctx_ext, &env_ext, ar)?;
         Ok(Term::Fun(info, ar.term(b_new)))
       }
       // The (∑ intro) and (extend) rules are used.
@@ -342,6 +453,15 @@ impl<'a, 'b> Term<'a, 'b, Named> {
       Term::Tup(bs_old) => {
         let us_val = t.as_sig(|t| TypeError::sig_ann_expected(t, ctx, env, ar))?;
         if bs_old.len() == us_val.len() {
+          let mut indices = vec![ctx.index()];
+          for (i, (info, _)) in bs_old.iter().enumerate() {
+            let index = indices[i].map(|index| ar.name_index(index.insert([(info.name, (ctx.len(), i))], ar)));
+            indices.push(index);
+          }
+          let mut done = match ar.threads() {
+            0 | 1 => Vec::new(),
+            _ => Term::check_fields_parallel(bs_old, us_val, &indices, globals, ctx, env, ar),
+          };
           let bs_new = ar.terms(bs_old.len());
           let bs_val = ar.values(bs_old.len()).as_mut_ptr();
           for (i, (info, b_old)) in bs_old.iter().enumerate() {
@@ -349,14 +469,21 @@ impl<'a, 'b> Term<'a, 'b, Named> {
             if info.name != u_info.name {
               return Err(TypeError::tup_field_mismatch(ar.term(*self), info.name, u_info.name).into());
             }
-            let t_val = Val::Sig(&us_val[..i]);
-            // SAFETY: the borrowed range `&bs_val[..i]` is no longer modified.
-            let a_val = Val::Tup(unsafe { from_raw_parts(bs_val, i) });
-            let ctx_ext = ctx.extend(Bound::empty(), t_val, ar);
-            let env_ext = env.extend(Bound::empty(), a_val, ar);
-            let b_new = b_old.check(u_val.apply(a_val, ar)?, &ctx_ext, &env_ext, ar)?;
+            let (b_new, b_val) = match done.get_mut(i).and_then(Option::take) {
+              Some(res) => res?,
+              None => {
+                let t_val = Val::Sig(&us_val[..i]);
+                // SAFETY: the borrowed range `&bs_val[..i]` is no longer modified.
+                let a_val = Val::Tup(unsafe { from_raw_parts(bs_val, i) });
+                let ctx_ext = ctx.bind_indexed(Bound::empty(), t_val, indices[i], ar);
+                let env_ext = env.extend(Bound::empty(), a_val, ar);
+                let u_val = u_val.apply(a_val, ar)?;
+                let b_new =
+                  ar.profile_scope(info.name.as_str(), || b_old.check_with(u_val, globals, &ctx_ext, &env_ext, ar))?;
+                (b_new, b_new.eval(&env_ext, ar)?)
+              }
+            };
             bs_new[i] = (info, b_new);
-            let b_val = b_new.eval(&env_ext, ar)?;
             // SAFETY: `i < bs_old.len()` which is the valid size of `bs_val`.
             unsafe { *bs_val.add(i) = (info, b_val) };
           }
@@ -365,15 +492,92 @@ impl<'a, 'b> Term<'a, 'b, Named> {
           Err(TypeError::tup_size_mismatch(ar.term(*self), bs_old.len(), us_val.len()).into())
         }
       }
-      // TODO
-      Term::Meta(_) => todo!(),
+      // Holes are added to the metacontext, to be solved by unification in later conversion checks.
+      Term::Meta(_) => {
+        let t_new = t.quote(ctx.len(), ar)?;
+        Ok(Term::Meta(ar.meta(ctx.len(), ar.term(t_new))))
+      }
       // The (conv) rule is used.
       // By pre-conditions, `t` is already known to have universe type.
       x_old => {
-        let (x_new, x_type) = x_old.infer(ctx, env, ar)?;
+        let (x_new, x_type) = x_old.infer_with(globals, ctx, env, ar)?;
         let res = Val::conv(&x_type, &t, env.len(), ar)?.then_some(x_new);
         res.ok_or_else(|| TypeError::type_mismatch(ar.term(*x_old), x_type, t, ctx, env, ar).into())
       }
     }
   }
+
+  /// Checks and evaluates the fields of a tuple constructor on worker threads with their own
+  /// arenas if worthwhile (see [`Schedule`]), where `indices[i]` is the index of the context of
+  /// field `i`. Fields refer to earlier fields by name, and fields containing holes are left to the
+  /// caller. Returns results relocated to `ar`, by field index. Fields which are skipped (`None`)
+  /// have to be checked by the caller.
+  fn check_fields_parallel(
+    bs_old: &[(&'b Field<'b>, Term<'a, 'b, Named>)],
+    us_val: &'a [(&'b Field<'b>, Clos<'a, 'b>)],
+    indices: &[Option<&'a Index<'a, 'b>>],
+    globals: &Globals<'b>,
+    ctx: &Stack<'a, 'b>,
+    env: &Stack<'a, 'b>,
+    ar: &'a Arena,
+  ) -> Vec<Option<FieldResult<'a, 'b>>> {
+    let mut fields = HashMap::<_, Vec<_>>::new();
+    bs_old.iter().enumerate().for_each(|(i, (info, _))| fields.entry(info.name).or_default().push(i));
+    let mut schedule = Schedule::new();
+    for (i, ((info, b_old), (u_info, u_val))) in bs_old.iter().zip(us_val).enumerate() {
+      let mut mentioned = Vec::new();
+      let eligible = info.name == u_info.name && b_old.mentioned_names(&fields, i, &mut mentioned);
+      u_val.body.mentioned_fields(0, i, &mut mentioned);
+      schedule.push(b_old, eligible.then_some(mentioned));
+    }
+    let n = schedule.workers(ar);
+    if n == 0 {
+      return Vec::new();
+    }
+    let mut workers = (0..n).map(|_| ar.worker()).collect::<Vec<_>>();
+    let mut prefix = bs_old.iter().map(|(info, _)| (*info, Val::Free(env.len()))).collect::<Vec<_>>();
+    let res = schedule.run(&mut prefix, &mut workers, |i, a_val, w| -> FieldResult<'_, 'b> {
+      let ((info, b_old), (_, u_val)) = (&bs_old[i], &us_val[i]);
+      let ctx_ext = ctx.bind_indexed(Bound::empty(), Val::Sig(&us_val[..i]), indices[i], w);
+      let env_ext = env.extend(Bound::empty(), a_val, w);
+      let u_val = u_val.apply(a_val, w)?;
+      let b_new = w.profile_scope(info.name.as_str(), || b_old.check_with(u_val, globals, &ctx_ext, &env_ext, w))?;
+      Ok((b_new, b_new.eval(&env_ext, w)?))
+    });
+    // Results share the values of the fields they mention, so they are relocated together.
+    let res = ar.copy_in(|| {
+      let relocate =
+        |r: FieldResult<'_, 'b>| r.map(|(x, v)| (x.relocate(ar), v.relocate(ar))).map_err(|e| e.relocate(ar));
+      res.into_iter().map(|r| r.map(relocate)).collect()
+    });
+    for w in workers {
+      ar.reclaim(w);
+    }
+    res
+  }
+
+  /// Adds to `res` the first `len` fields of a tuple constructor which preterm `self` may refer to
+  /// by name, where `fields` maps names to the fields of that name. Variables by de Bruijn index
+  /// conservatively add all of them. Returns `false` if `self` contains holes.
+  fn mentioned_names(&self, fields: &HashMap<Name<'b>, Vec<usize>>, len: usize, res: &mut Vec<usize>) -> bool {
+    match self {
+      Term::Univ(_) | Term::Const(_) => true,
+      Term::Var(_) => {
+        res.extend(0..len);
+        true
+      }
+      Term::Meta(_) => false,
+      Term::NamedVar(name, _) => {
+        res.extend(fields.get(name).into_iter().flatten().take_while(|&&i| i < len));
+        true
+      }
+      Term::Gc(x) | Term::Fun(_, x) | Term::Init(_, x) | Term::Proj(_, x) | Term::NamedProj(_, x, _) => {
+        x.mentioned_names(fields, len, res)
+      }
+      Term::Ann(x, y) | Term::Let(_, x, y) | Term::Pi(_, x, y) | Term::App(x, y, _) => {
+        x.mentioned_names(fields, len, res) && y.mentioned_names(fields, len, res)
+      }
+      Term::Sig(us) | Term::Tup(us) => us.iter().all(|(_, u)| u.mentioned_names(fields, len, res)),
+    }
+  }
 }
@@ -1,7 +1,11 @@
 mod errors;
+mod json;
 mod parser;
 mod printer;
+mod snapshot;
 
-pub use errors::{LexError, ParseError};
-pub use parser::{Span, Token};
+pub use errors::{JsonError, LexError, ParseError, SnapshotError};
+pub use json::Json;
+pub use parser::{Lexer, Span, Token};
 pub use printer::Prec;
+pub use snapshot::SNAPSHOT_VERSION;
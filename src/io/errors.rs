@@ -2,7 +2,7 @@ use super::*;
 
 /// # Lexing errors
 ///
-/// Errors produced by the simple lexer. Positions are in numbers of characters instead of bytes.
+/// Errors produced by the simple lexer. Positions are byte offsets.
 #[derive(Debug, Clone)]
 pub enum LexError {
   UnexpectedChar { ch: char, pos: usize },
@@ -11,15 +11,38 @@ pub enum LexError {
 
 /// # Parsing errors
 ///
-/// Errors produced by the simple parser. Positions are in numbers of characters instead of bytes.
+/// Errors produced by the simple parser. Positions are byte offsets.
 #[derive(Debug, Clone)]
 pub enum ParseError {
   Lex { err: LexError },
   UndefinedIdent { name: String, start: usize, end: usize },
-  UnexpectedToken { tok: Token, start: usize, end: usize },
+  UnexpectedToken { tok: String, start: usize, end: usize },
   UnexpectedEof,
 }
 
+/// # JSON errors
+///
+/// Errors produced when parsing JSON documents, see [`Json::parse`]. Positions are byte offsets.
+#[derive(Debug, Clone)]
+pub enum JsonError {
+  UnexpectedChar { ch: char, pos: usize },
+  UnexpectedEof,
+  Number { start: usize, end: usize },
+}
+
+/// # Snapshot errors
+///
+/// Errors produced when saving or loading snapshots. Positions are byte offsets.
+#[derive(Debug, Clone)]
+pub enum SnapshotError {
+  BadMagic,
+  BadVersion { version: u32 },
+  Malformed { pos: usize },
+  UnexpectedEof,
+  UnknownGlobal { name: String },
+  Rejected { name: String, err: String },
+}
+
 impl LexError {
   pub fn unexpected(next: Option<(usize, char)>) -> Self {
     match next {
@@ -28,10 +51,10 @@ impl LexError {
     }
   }
 
-  pub fn position(&self, chars: usize) -> (usize, usize) {
+  pub fn position(&self, len: usize) -> (usize, usize) {
     match self {
       Self::UnexpectedChar { ch: _, pos } => (*pos, *pos),
-      Self::UnexpectedEof => (chars, chars),
+      Self::UnexpectedEof => (len, len),
     }
   }
 }
@@ -43,17 +66,26 @@ impl ParseError {
 
   pub fn unexpected(next: Option<Span>) -> Self {
     match next {
-      Some(span) => Self::UnexpectedToken { tok: span.tok, start: span.start, end: span.end },
+      Some(span) => Self::UnexpectedToken { tok: format!("{:?}", span.tok), start: span.start, end: span.end },
       None => Self::UnexpectedEof,
     }
   }
 
-  pub fn position(&self, chars: usize) -> (usize, usize) {
+  pub fn position(&self, len: usize) -> (usize, usize) {
     match self {
-      Self::Lex { err } => err.position(chars),
+      Self::Lex { err } => err.position(len),
       Self::UndefinedIdent { start, end, .. } => (*start, *end),
       Self::UnexpectedToken { start, end, .. } => (*start, *end),
-      Self::UnexpectedEof => (chars, chars),
+      Self::UnexpectedEof => (len, len),
+    }
+  }
+}
+
+impl JsonError {
+  pub fn unexpected(next: Option<(usize, char)>) -> Self {
+    match next {
+      Some((pos, ch)) => Self::UnexpectedChar { ch, pos },
+      None => Self::UnexpectedEof,
     }
   }
 }
@@ -78,11 +110,38 @@ impl std::fmt::Display for ParseError {
     match self {
       Self::Lex { err } => write!(f, "{err}"),
       Self::UndefinedIdent { name, start: _, end: _ } => write!(f, "undefined identifier {name}"),
-      Self::UnexpectedToken { tok, start: _, end: _ } => write!(f, "unexpected token {tok:?}"),
+      Self::UnexpectedToken { tok, start: _, end: _ } => write!(f, "unexpected token {tok}"),
+      Self::UnexpectedEof => write!(f, "unexpected end of input"),
+    }
+  }
+}
+
+impl std::fmt::Display for JsonError {
+  fn fmt(&self, f: &mut std::fmt::Formatter<'_>) -> std::fmt::Result {
+    match self {
+      Self::UnexpectedChar { ch, pos } => write!(f, "unexpected character {ch} at byte {pos}"),
       Self::UnexpectedEof => write!(f, "unexpected end of input"),
+      Self::Number { start, end } => write!(f, "malformed number at bytes {start}..{end}"),
+    }
+  }
+}
+
+impl std::fmt::Display for SnapshotError {
+  fn fmt(&self, f: &mut std::fmt::Formatter<'_>) -> std::fmt::Result {
+    match self {
+      Self::BadMagic => write!(f, "not a snapshot file"),
+      Self::BadVersion { version } => {
+        write!(f, "snapshot has format version {version}, but the supported version is {SNAPSHOT_VERSION}")
+      }
+      Self::Malformed { pos } => write!(f, "malformed snapshot at byte {pos}"),
+      Self::UnexpectedEof => write!(f, "unexpected end of snapshot"),
+      Self::UnknownGlobal { name } => write!(f, "reference to global definition {name} not in table"),
+      Self::Rejected { name, err } => write!(f, "definition {name} rejected: {err}"),
     }
   }
 }
 
 impl std::error::Error for LexError {}
 impl std::error::Error for ParseError {}
+impl std::error::Error for JsonError {}
+impl std::error::Error for SnapshotError {}
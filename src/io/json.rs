@@ -0,0 +1,236 @@
+use std::fmt::Write;
+use std::iter::Peekable;
+use std::str::CharIndices;
+
+use super::*;
+
+/// # JSON values
+///
+/// A minimal JSON document model for the language server (see [`crate::server`]) and the reports
+/// of `zenith check`. Objects keep their keys in order, and numbers are kept as [`f64`], which is
+/// enough for the integers in JSON-RPC messages.
+///
+/// - See: <https://www.rfc-editor.org/rfc/rfc8259>
+#[derive(Debug, Clone, PartialEq)]
+pub enum Json {
+  Null,
+  Bool(bool),
+  Number(f64),
+  String(String),
+  Array(Vec<Json>),
+  Object(Vec<(String, Json)>),
+}
+
+impl Json {
+  /// Creates an object from key-value pairs.
+  pub fn object<'k>(entries: impl IntoIterator<Item = (&'k str, Json)>) -> Self {
+    Self::Object(entries.into_iter().map(|(k, v)| (k.to_string(), v)).collect())
+  }
+
+  /// Returns the value of field `key` if `self` is an object containing it.
+  pub fn get(&self, key: &str) -> Option<&Self> {
+    match self {
+      Self::Object(entries) => entries.iter().find_map(|(k, v)| (k == key).then_some(v)),
+      _ => None,
+    }
+  }
+
+  /// Returns the string if `self` is a string.
+  pub fn as_str(&self) -> Option<&str> {
+    match self {
+      Self::String(s) => Some(s),
+      _ => None,
+    }
+  }
+
+  /// Returns the number as a [`usize`] if `self` is a non-negative integer.
+  pub fn as_usize(&self) -> Option<usize> {
+    match self {
+      Self::Number(n) if *n >= 0.0 && n.fract() == 0.0 => Some(*n as usize),
+      _ => None,
+    }
+  }
+
+  /// Returns the elements if `self` is an array.
+  pub fn as_array(&self) -> Option<&[Self]> {
+    match self {
+      Self::Array(xs) => Some(xs),
+      _ => None,
+    }
+  }
+
+  /// Parses a JSON document, which may be surrounded by whitespace.
+  pub fn parse(src: &str) -> Result<Self, JsonError> {
+    let mut it = src.char_indices().peekable();
+    let res = parse_value(src, &mut it)?;
+    skip_whitespace(&mut it);
+    match it.next() {
+      None => Ok(res),
+      next => Err(JsonError::unexpected(next)),
+    }
+  }
+}
+
+type Chars<'s> = Peekable<CharIndices<'s>>;
+
+/// Skips whitespace characters.
+fn skip_whitespace(it: &mut Chars) {
+  while it.next_if(|(_, c)| matches!(c, ' ' | '\t' | '\n' | '\r')).is_some() {}
+}
+
+/// Expects the next characters to be `word`.
+fn expect(it: &mut Chars, word: &str) -> Result<(), JsonError> {
+  for c in word.chars() {
+    match it.next() {
+      Some((_, d)) if d == c => {}
+      next => return Err(JsonError::unexpected(next)),
+    }
+  }
+  Ok(())
+}
+
+/// Parses a value after optional whitespace.
+fn parse_value(src: &str, it: &mut Chars) -> Result<Json, JsonError> {
+  skip_whitespace(it);
+  match it.peek().copied() {
+    Some((_, 'n')) => expect(it, "null").map(|_| Json::Null),
+    Some((_, 't')) => expect(it, "true").map(|_| Json::Bool(true)),
+    Some((_, 'f')) => expect(it, "false").map(|_| Json::Bool(false)),
+    Some((_, '"')) => parse_string(it).map(Json::String),
+    Some((_, '[')) => {
+      it.next();
+      let mut xs = Vec::new();
+      skip_whitespace(it);
+      if it.next_if(|(_, c)| *c == ']').is_some() {
+        return Ok(Json::Array(xs));
+      }
+      loop {
+        xs.push(parse_value(src, it)?);
+        skip_whitespace(it);
+        match it.next() {
+          Some((_, ',')) => {}
+          Some((_, ']')) => return Ok(Json::Array(xs)),
+          next => return Err(JsonError::unexpected(next)),
+        }
+      }
+    }
+    Some((_, '{')) => {
+      it.next();
+      let mut entries = Vec::new();
+      skip_whitespace(it);
+      if it.next_if(|(_, c)| *c == '}').is_some() {
+        return Ok(Json::Object(entries));
+      }
+      loop {
+        skip_whitespace(it);
+        let key = parse_string(it)?;
+        skip_whitespace(it);
+        expect(it, ":")?;
+        entries.push((key, parse_value(src, it)?));
+        skip_whitespace(it);
+        match it.next() {
+          Some((_, ',')) => {}
+          Some((_, '}')) => return Ok(Json::Object(entries)),
+          next => return Err(JsonError::unexpected(next)),
+        }
+      }
+    }
+    Some((start, c)) if c == '-' || c.is_ascii_digit() => {
+      let mut end = start;
+      while let Some((i, _)) = it.next_if(|(_, c)| c.is_ascii_digit() || "+-.eE".contains(*c)) {
+        end = i + 1;
+      }
+      src[start..end].parse().map(Json::Number).map_err(|_| JsonError::Number { start, end })
+    }
+    next => Err(JsonError::unexpected(next)),
+  }
+}
+
+/// Parses four hexadecimal digits of a `\u` escape.
+fn parse_hex(it: &mut Chars) -> Result<u16, JsonError> {
+  let mut n = 0;
+  for _ in 0..4 {
+    match it.next() {
+      Some((_, c)) if c.is_ascii_hexdigit() => n = n * 16 + c.to_digit(16).unwrap() as u16,
+      next => return Err(JsonError::unexpected(next)),
+    }
+  }
+  Ok(n)
+}
+
+/// Parses a string literal.
+fn parse_string(it: &mut Chars) -> Result<String, JsonError> {
+  expect(it, "\"")?;
+  let mut res = String::new();
+  loop {
+    match it.next() {
+      Some((_, '"')) => return Ok(res),
+      Some((_, '\\')) => match it.next() {
+        Some((_, '"')) => res.push('"'),
+        Some((_, '\\')) => res.push('\\'),
+        Some((_, '/')) => res.push('/'),
+        Some((_, 'b')) => res.push('\u{8}'),
+        Some((_, 'f')) => res.push('\u{c}'),
+        Some((_, 'n')) => res.push('\n'),
+        Some((_, 'r')) => res.push('\r'),
+        Some((_, 't')) => res.push('\t'),
+        Some((pos, 'u')) => {
+          // Characters outside the basic multilingual plane are escaped as surrogate pairs.
+          let mut units = vec![parse_hex(it)?];
+          if (0xd800..0xdc00).contains(&units[0]) {
+            expect(it, "\\u")?;
+            units.push(parse_hex(it)?);
+          }
+          let c = char::decode_utf16(units).next().and_then(|c| c.ok());
+          res.push(c.ok_or(JsonError::UnexpectedChar { ch: 'u', pos })?);
+        }
+        next => return Err(JsonError::unexpected(next)),
+      },
+      Some((_, c)) => res.push(c),
+      None => return Err(JsonError::UnexpectedEof),
+    }
+  }
+}
+
+impl std::fmt::Display for Json {
+  fn fmt(&self, f: &mut std::fmt::Formatter<'_>) -> std::fmt::Result {
+    match self {
+      Self::Null => write!(f, "null"),
+      Self::Bool(b) => write!(f, "{b}"),
+      Self::Number(n) if n.is_finite() => write!(f, "{n}"),
+      Self::Number(_) => write!(f, "null"),
+      Self::String(s) => write_string(f, s),
+      Self::Array(xs) => {
+        f.write_char('[')?;
+        for (i, x) in xs.iter().enumerate() {
+          write!(f, "{}{x}", if i == 0 { "" } else { "," })?;
+        }
+        f.write_char(']')
+      }
+      Self::Object(entries) => {
+        f.write_char('{')?;
+        for (i, (k, v)) in entries.iter().enumerate() {
+          f.write_str(if i == 0 { "" } else { "," })?;
+          write_string(f, k)?;
+          write!(f, ":{v}")?;
+        }
+        f.write_char('}')
+      }
+    }
+  }
+}
+
+/// Writes a string literal, escaping quotes, backslashes and control characters.
+fn write_string(f: &mut impl Write, s: &str) -> std::fmt::Result {
+  f.write_char('"')?;
+  for c in s.chars() {
+    match c {
+      '"' => f.write_str("\\\"")?,
+      '\\' => f.write_str("\\\\")?,
+      '\n' => f.write_str("\\n")?,
+      c if c < ' ' => write!(f, "\\u{:04x}", c as u32)?,
+      c => f.write_char(c)?,
+    }
+  }
+  f.write_char('"')
+}
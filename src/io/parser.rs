@@ -6,9 +6,9 @@ use crate::ir::{Bound, Field, Name, Named, Term};
 
 /// # Lexer tokens
 ///
-/// Produced by the simple lexer.
-#[derive(Debug, Clone, PartialEq, Eq)]
-pub enum Token {
+/// Produced by the simple lexer. Identifiers borrow from the input.
+#[derive(Debug, Clone, Copy, PartialEq, Eq)]
+pub enum Token<'s> {
   LeftParen,
   RightParen,
   LeftBracket,
@@ -27,96 +27,110 @@ pub enum Token {
   Type,
   Kind,
   Ix(usize),
-  Id(String),
+  Id(&'s str),
 }
 
 /// # Lexer spans
 ///
-/// Tokens together with their positions in the input string.
-#[derive(Debug, Clone)]
-pub struct Span {
-  pub tok: Token,
+/// Tokens together with their positions in the input string. Positions are byte offsets.
+#[derive(Debug, Clone, Copy)]
+pub struct Span<'s> {
+  pub tok: Token<'s>,
   pub start: usize,
   pub end: usize,
 }
 
-impl Span {
-  /// Tokenises `input` into a list of [`Span`].
-  pub fn lex(chars: impl Iterator<Item = char>) -> Result<Vec<Span>, LexError> {
+/// # Lexers
+///
+/// A streaming lexer over a string slice, which is also an iterator of [`Span`]. Nothing is
+/// allocated per token, and [`Term::parse`] pulls tokens from it lazily, so the input never needs
+/// to be tokenised up front. Any string slice can be lexed, including memory-mapped files.
+#[derive(Debug, Clone)]
+pub struct Lexer<'s> {
+  src: &'s str,
+  pos: usize,
+}
+
+impl<'s> Lexer<'s> {
+  /// Creates a lexer at the start of `src`.
+  pub fn new(src: &'s str) -> Self {
+    Self { src, pos: 0 }
+  }
+}
+
+impl<'s> Iterator for Lexer<'s> {
+  type Item = Span<'s>;
+
+  fn next(&mut self) -> Option<Span<'s>> {
     // The token grammar is almost LL(1).
-    let mut it = chars.enumerate().peekable();
-    let mut res = Vec::new();
-    // The first character can be taken unconditionally.
-    while let Some((pos, c)) = it.next() {
-      match c {
-        '(' => res.push(Span { tok: Token::LeftParen, start: pos, end: pos + 1 }),
-        ')' => res.push(Span { tok: Token::RightParen, start: pos, end: pos + 1 }),
-        '[' => res.push(Span { tok: Token::LeftBracket, start: pos, end: pos + 1 }),
-        ']' => res.push(Span { tok: Token::RightBracket, start: pos, end: pos + 1 }),
-        '{' => res.push(Span { tok: Token::LeftBrace, start: pos, end: pos + 1 }),
-        '}' => res.push(Span { tok: Token::RightBrace, start: pos, end: pos + 1 }),
-        ',' => res.push(Span { tok: Token::Sep, start: pos, end: pos + 1 }),
-        '.' => res.push(Span { tok: Token::Dot, start: pos, end: pos + 1 }),
-        '@' => res.push(Span { tok: Token::Env, start: pos, end: pos + 1 }),
-        '→' => res.push(Span { tok: Token::Pi, start: pos, end: pos + 1 }),
-        '↦' => res.push(Span { tok: Token::Fun, start: pos, end: pos + 1 }),
-        '≔' => res.push(Span { tok: Token::Def, start: pos, end: pos + 1 }),
-        ':' => match it.peek() {
-          Some((_, '=')) => {
-            it.next();
-            res.push(Span { tok: Token::Def, start: pos, end: pos + 2 });
+    let bytes = self.src.as_bytes();
+    loop {
+      let start = self.pos;
+      // ASCII characters are taken without decoding.
+      let c = match *bytes.get(start)? {
+        b if b.is_ascii() => b as char,
+        _ => self.src[start..].chars().next()?,
+      };
+      self.pos += c.len_utf8();
+      let tok = match c {
+        '(' => Token::LeftParen,
+        ')' => Token::RightParen,
+        '[' => Token::LeftBracket,
+        ']' => Token::RightBracket,
+        '{' => Token::LeftBrace,
+        '}' => Token::RightBrace,
+        ',' => Token::Sep,
+        '.' => Token::Dot,
+        '@' => Token::Env,
+        '→' => Token::Pi,
+        '↦' => Token::Fun,
+        '≔' => Token::Def,
+        ':' => match bytes.get(self.pos) {
+          Some(b'=') => {
+            self.pos += 1;
+            Token::Def
           }
-          Some((_, ':')) => {
-            it.next();
-            res.push(Span { tok: Token::Proj, start: pos, end: pos + 2 });
+          Some(b':') => {
+            self.pos += 1;
+            Token::Proj
           }
-          _ => res.push(Span { tok: Token::Ann, start: pos, end: pos + 1 }),
+          _ => Token::Ann,
         },
         '^' => {
-          let mut len = 1;
-          let mut n = 0;
-          while let Some((_, d)) = it.peek().cloned() {
-            if !d.is_ascii_digit() {
-              break;
-            }
-            it.next();
-            len += 1;
-            n = n * 10 + d.to_digit(10).unwrap() as usize;
-          }
-          let tok = Token::Ix(n);
-          res.push(Span { tok, start: pos, end: pos + len });
+          let digits = &bytes[self.pos..];
+          let digits = &digits[..digits.iter().take_while(|d| d.is_ascii_digit()).count()];
+          self.pos += digits.len();
+          Token::Ix(digits.iter().fold(0, |n, d| n * 10 + (d - b'0') as usize))
         }
-        c if !c.is_whitespace() => {
-          let mut len = 1;
-          let mut s = String::new();
-          s.push(c);
-          while let Some((_, d)) = it.peek().cloned() {
-            if d.is_whitespace() || "()[]{},.@→↦≔:^".chars().any(|x| x == d) {
-              break;
-            }
-            it.next();
-            len += 1;
-            s.push(d);
-          }
-          let tok = match s.as_str() {
+        c if c.is_whitespace() => continue,
+        _ => {
+          let rest = &self.src[self.pos..];
+          self.pos += rest.find(|d: char| d.is_whitespace() || "()[]{},.@→↦≔:^".contains(d)).unwrap_or(rest.len());
+          match &self.src[start..self.pos] {
             "->" => Token::Pi,
             "=>" => Token::Fun,
             "Unit" => Token::Unit,
             "Type" => Token::Type,
             "Kind" => Token::Kind,
-            _ => Token::Id(s),
-          };
-          res.push(Span { tok, start: pos, end: pos + len });
+            s => Token::Id(s),
+          }
         }
-        _ => {}
-      }
+      };
+      return Some(Span { tok, start, end: self.pos });
     }
-    Ok(res)
+  }
+}
+
+impl Span<'_> {
+  /// Tokenises `input` into a list of [`Span`]. The list is only needed for lookahead beyond one
+  /// token, otherwise [`Lexer`] can be passed to [`Term::parse`] directly.
+  pub fn lex(input: &str) -> Result<Vec<Span<'_>>, LexError> {
+    Ok(Lexer::new(input).collect())
   }
 }
 
 impl<'a> Term<'a, 'a, Named> {
-  /// Parses a list of [`Span`] into a [`Term`].
+  /// Parses a sequence of [`Span`] into a [`Term`].
   ///
   /// The grammar is given by the following BNF:
   ///
@@ -138,42 +152,45 @@ impl<'a> Term<'a, 'a, Named> {
   ///   | <proj> "." <atom>
   ///
   /// <atom> ::=
-  ///   | "{" "}" | "Unit" | "Type" | "Kind" | "@" <index> | <id>
+  ///   | "{" "}" | "Unit" | "Type" | "Kind" | "@" <index> | "_" | <id>
   ///   | "(" <term> ")"
   ///   | "{" <id> ":" <term> ("," <id> ":" <term>)* "}"
   ///   | "{" <id> "≔" <term> ("," <id> "≔" <term>)* "}"
   /// ```
-  pub fn parse(spans: impl Iterator<Item = Span>, ar: &'a Arena) -> Result<&'a Term<'a, 'a, Named>, ParseError> {
+  pub fn parse<'s>(
+    spans: impl Iterator<Item = Span<'s>>,
+    ar: &'a Arena,
+  ) -> Result<&'a Term<'a, 'a, Named>, ParseError> {
     /// Expects the next token to have the same kind as `tok`.
-    fn expect(it: &mut impl Iterator<Item = Span>, tok: Token) -> Result<(), ParseError> {
+    fn expect<'s>(it: &mut impl Iterator<Item = Span<'s>>, tok: Token) -> Result<(), ParseError> {
       match it.next() {
         Some(s) if std::mem::discriminant(&s.tok) == std::mem::discriminant(&tok) => Ok(()),
         other => Err(ParseError::unexpected(other)),
       }
     }
     /// Expects the next token to be a de Bruijn index.
-    fn expect_ix(it: &mut impl Iterator<Item = Span>) -> Result<usize, ParseError> {
+    fn expect_ix<'s>(it: &mut impl Iterator<Item = Span<'s>>) -> Result<usize, ParseError> {
       match it.next() {
         Some(Span { tok: Token::Ix(n), .. }) => Ok(n),
         other => Err(ParseError::unexpected(other)),
       }
     }
     /// Expects the next token to be a name.
-    fn expect_name<'a>(it: &mut impl Iterator<Item = Span>, ar: &'a Arena) -> Result<Name<'a>, ParseError> {
+    fn expect_name<'a, 's>(it: &mut impl Iterator<Item = Span<'s>>, ar: &'a Arena) -> Result<Name<'a>, ParseError> {
       match it.next() {
         Some(Span { tok: Token::Id(x), .. }) => {
           if x == "_" {
-            Ok(Name(""))
+            Ok(Name::EMPTY)
           } else {
-            Ok(Name(ar.string(&x)))
+            Ok(Name::new(x, ar))
           }
         }
         other => Err(ParseError::unexpected(other)),
       }
     }
     /// Parses a term.
-    fn parse_term<'a>(
-      it: &mut Peekable<impl Iterator<Item = Span>>,
+    fn parse_term<'a, 's>(
+      it: &mut Peekable<impl Iterator<Item = Span<'s>>>,
       ar: &'a Arena,
     ) -> Result<&'a Term<'a, 'a, Named>, ParseError> {
       // Parsing a term body.
@@ -188,8 +205,8 @@ impl<'a> Term<'a, 'a, Named> {
       }
     }
     /// Parses a term body.
-    fn parse_body<'a>(
-      it: &mut Peekable<impl Iterator<Item = Span>>,
+    fn parse_body<'a, 's>(
+      it: &mut Peekable<impl Iterator<Item = Span<'s>>>,
       ar: &'a Arena,
     ) -> Result<&'a Term<'a, 'a, Named>, ParseError> {
       match it.peek() {
@@ -281,8 +298,8 @@ impl<'a> Term<'a, 'a, Named> {
       }
     }
     /// Parses an atomic term followed by a sequence of projections and dot-applications.
-    fn parse_proj<'a>(
-      it: &mut Peekable<impl Iterator<Item = Span>>,
+    fn parse_proj<'a, 's>(
+      it: &mut Peekable<impl Iterator<Item = Span<'s>>>,
       ar: &'a Arena,
     ) -> Result<&'a Term<'a, 'a, Named>, ParseError> {
       let mut res = parse_atom(it, ar)?;
@@ -306,8 +323,8 @@ impl<'a> Term<'a, 'a, Named> {
       }
     }
     /// Parses an atomic term.
-    fn parse_atom<'a>(
-      it: &mut Peekable<impl Iterator<Item = Span>>,
+    fn parse_atom<'a, 's>(
+      it: &mut Peekable<impl Iterator<Item = Span<'s>>>,
       ar: &'a Arena,
     ) -> Result<&'a Term<'a, 'a, Named>, ParseError> {
       match it.peek() {
@@ -328,6 +345,11 @@ impl<'a> Term<'a, 'a, Named> {
           it.next();
           Ok(ar.term(Term::Var(expect_ix(it)?)))
         }
+        // Holes are numbered by the elaborator.
+        Some(Span { tok: Token::Id("_"), .. }) => {
+          it.next();
+          Ok(ar.term(Term::Meta(0)))
+        }
         Some(Span { tok: Token::Id(_), .. }) => {
           let name = expect_name(it, ar)?;
           Ok(ar.term(Term::NamedVar(name, ())))
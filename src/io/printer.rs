@@ -13,7 +13,7 @@ pub enum Prec {
 
 impl std::fmt::Display for Name<'_> {
   fn fmt(&self, f: &mut Formatter<'_>) -> std::fmt::Result {
-    let Self(name) = self;
+    let name = self.as_str();
     if name.is_empty() {
       write!(f, "_")?;
     } else {
@@ -211,6 +211,12 @@ impl<T: Decoration> Term<'_, '_, T> {
         right_paren(f, Prec::Atom, prec)?;
         Ok(())
       }
+      Term::Const(g) => {
+        left_paren(f, Prec::Atom, prec)?;
+        write!(f, "{}", g.info.name)?;
+        right_paren(f, Prec::Atom, prec)?;
+        Ok(())
+      }
       Term::NamedProj(name, x, _) => {
         left_paren(f, Prec::Proj, prec)?;
         x.print(f, Prec::Proj)?;
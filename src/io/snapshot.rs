@@ -0,0 +1,383 @@
+use std::collections::HashMap;
+use std::str::from_utf8;
+
+use super::*;
+use crate::arena::Arena;
+use crate::common::univ_univ;
+use crate::elab::Globals;
+use crate::ir::{Bound, Core, Field, Global, Name, Stack, Term, TypeError};
+
+/// Magic bytes at the start of every snapshot.
+const MAGIC: &[u8; 4] = b"ZSNP";
+
+/// Version of the snapshot format. Snapshots of other versions are rejected.
+pub const SNAPSHOT_VERSION: u32 = 1;
+
+// Record tags. Each term node is written after its children, and is referred to by later records
+// through its index in the sequence of nodes (so that shared subterms are only written once).
+const GC: u8 = 0;
+const UNIV: u8 = 1;
+const VAR: u8 = 2;
+const ANN: u8 = 3;
+const LET: u8 = 4;
+const PI: u8 = 5;
+const FUN: u8 = 6;
+const APP: u8 = 7;
+const SIG: u8 = 8;
+const TUP: u8 = 9;
+const INIT: u8 = 10;
+const PROJ: u8 = 11;
+const META: u8 = 12;
+const CONST: u8 = 13;
+const GLOBAL: u8 = 14;
+
+/// Serialises terms into the snapshot format.
+struct Writer<'a> {
+  buf: Vec<u8>,
+  nodes: HashMap<*const (), usize>,
+  strings: HashMap<&'a str, usize>,
+  globals: HashMap<*const (), usize>,
+}
+
+impl<'a> Writer<'a> {
+  fn new() -> Self {
+    Self { buf: Vec::new(), nodes: HashMap::new(), strings: HashMap::new(), globals: HashMap::new() }
+  }
+
+  /// Writes an unsigned LEB128 integer.
+  fn varint(&mut self, mut n: usize) {
+    while n >= 0x80 {
+      self.buf.push((n & 0x7f) as u8 | 0x80);
+      n >>= 7;
+    }
+    self.buf.push(n as u8);
+  }
+
+  /// Writes a string: either `0` followed by its contents (first occurrence), or `k + 1` where `k`
+  /// is the index of its first occurrence.
+  fn string(&mut self, s: &'a str) {
+    match self.strings.get(s) {
+      Some(k) => self.varint(k + 1),
+      None => {
+        self.strings.insert(s, self.strings.len());
+        self.varint(0);
+        self.varint(s.len());
+        self.buf.extend_from_slice(s.as_bytes());
+      }
+    }
+  }
+
+  /// Writes binder or field information.
+  fn info(&mut self, name: Name<'a>, attrs: &'a [&'a str]) {
+    let name = name.as_str();
+    self.string(name);
+    self.varint(attrs.len());
+    for attr in attrs {
+      self.string(attr);
+    }
+  }
+
+  /// Writes a term node (after all its children, if not already written) and returns its index.
+  fn term<'b: 'a>(&mut self, term: &'a Term<'a, 'b, Core>) -> Result<usize, SnapshotError> {
+    let addr = term as *const _ as *const ();
+    if let Some(id) = self.nodes.get(&addr) {
+      return Ok(*id);
+    }
+    match term {
+      Term::Gc(x) => {
+        let x = self.term(x)?;
+        self.buf.push(GC);
+        self.varint(x);
+      }
+      Term::Univ(lvl) => {
+        self.buf.push(UNIV);
+        self.varint(*lvl);
+      }
+      Term::Var(ix) => {
+        self.buf.push(VAR);
+        self.varint(*ix);
+      }
+      Term::Ann(x, t) => {
+        let (x, t) = (self.term(x)?, self.term(t)?);
+        self.buf.push(ANN);
+        self.varint(x);
+        self.varint(t);
+      }
+      Term::Let(info, v, x) | Term::Pi(info, v, x) => {
+        let tag = if matches!(term, Term::Let(..)) { LET } else { PI };
+        let (v, x) = (self.term(v)?, self.term(x)?);
+        self.buf.push(tag);
+        self.info(info.name, info.attrs);
+        self.varint(v);
+        self.varint(x);
+      }
+      Term::Fun(info, x) => {
+        let x = self.term(x)?;
+        self.buf.push(FUN);
+        self.info(info.name, info.attrs);
+        self.varint(x);
+      }
+      Term::App(f, x, dot) => {
+        let (f, x) = (self.term(f)?, self.term(x)?);
+        self.buf.push(APP);
+        self.varint(f);
+        self.varint(x);
+        self.buf.push(*dot as u8);
+      }
+      Term::Sig(us) | Term::Tup(us) => {
+        let tag = if matches!(term, Term::Sig(_)) { SIG } else { TUP };
+        let ids = us.iter().map(|(_, u)| self.term(u)).collect::<Result<Vec<_>, _>>()?;
+        self.buf.push(tag);
+        self.varint(us.len());
+        for ((info, _), id) in us.iter().zip(ids) {
+          self.info(info.name, info.attrs);
+          self.varint(id);
+        }
+      }
+      Term::Init(n, x) | Term::Proj(n, x) => {
+        let tag = if matches!(term, Term::Init(..)) { INIT } else { PROJ };
+        let x = self.term(x)?;
+        self.buf.push(tag);
+        self.varint(*n);
+        self.varint(x);
+      }
+      Term::Meta(id) => {
+        self.buf.push(META);
+        self.varint(*id);
+      }
+      Term::Const(g) => {
+        let name = g.info.name.as_str();
+        let k = self.globals.get(&(*g as *const _ as *const ()));
+        let k = *k.ok_or_else(|| SnapshotError::UnknownGlobal { name: name.to_owned() })?;
+        self.buf.push(CONST);
+        self.varint(k);
+      }
+    }
+    let id = self.nodes.len();
+    self.nodes.insert(addr, id);
+    Ok(id)
+  }
+}
+
+/// Deserialises records of the snapshot format.
+struct Reader<'s> {
+  bytes: &'s [u8],
+  pos: usize,
+}
+
+impl<'s> Reader<'s> {
+  fn malformed(&self) -> SnapshotError {
+    SnapshotError::Malformed { pos: self.pos }
+  }
+
+  fn byte(&mut self) -> Result<u8, SnapshotError> {
+    let byte = *self.bytes.get(self.pos).ok_or(SnapshotError::UnexpectedEof)?;
+    self.pos += 1;
+    Ok(byte)
+  }
+
+  fn bytes(&mut self, len: usize) -> Result<&'s [u8], SnapshotError> {
+    let res = self.bytes.get(self.pos..).and_then(|rest| rest.get(..len)).ok_or(SnapshotError::UnexpectedEof)?;
+    self.pos += len;
+    Ok(res)
+  }
+
+  /// Reads an unsigned LEB128 integer.
+  fn varint(&mut self) -> Result<usize, SnapshotError> {
+    let mut res = 0usize;
+    let mut shift = 0;
+    loop {
+      let byte = self.byte()?;
+      let bits = (byte & 0x7f) as usize;
+      if shift >= usize::BITS || (bits << shift) >> shift != bits {
+        return Err(self.malformed());
+      }
+      res |= bits << shift;
+      if byte & 0x80 == 0 {
+        return Ok(res);
+      }
+      shift += 7;
+    }
+  }
+
+  /// Reads a reference into `table`, bounds-checked.
+  fn index<T: Copy>(&mut self, table: &[T]) -> Result<T, SnapshotError> {
+    let start = self.pos;
+    let k = self.varint()?;
+    table.get(k).copied().ok_or(SnapshotError::Malformed { pos: start })
+  }
+}
+
+/// Deserialises a snapshot into an arena.
+struct Loader<'s, 'b> {
+  reader: Reader<'s>,
+  strings: Vec<&'b str>,
+  nodes: Vec<&'b Term<'b, 'b, Core>>,
+  globals: Vec<&'b Global<'b>>,
+  ar: &'b Arena,
+}
+
+impl<'s, 'b> Loader<'s, 'b> {
+  fn string(&mut self) -> Result<&'b str, SnapshotError> {
+    match self.reader.varint()? {
+      0 => {
+        let start = self.reader.pos;
+        let len = self.reader.varint()?;
+        let bytes = self.reader.bytes(len)?;
+        let s = self.ar.symbol(from_utf8(bytes).map_err(|_| SnapshotError::Malformed { pos: start })?);
+        self.strings.push(s);
+        Ok(s)
+      }
+      k => self.strings.get(k - 1).copied().ok_or_else(|| self.reader.malformed()),
+    }
+  }
+
+  fn info(&mut self) -> Result<(Name<'b>, &'b [&'b str]), SnapshotError> {
+    let name = Name::new(self.string()?, self.ar);
+    let len = self.reader.varint()?;
+    // Every attribute takes at least one byte.
+    if len > self.reader.bytes.len() - self.reader.pos {
+      return Err(SnapshotError::UnexpectedEof);
+    }
+    let attrs = (0..len).map(|_| self.string()).collect::<Result<Vec<_>, _>>()?;
+    Ok((name, self.ar.strings(&attrs)))
+  }
+
+  fn bound(&mut self) -> Result<&'b Bound<'b>, SnapshotError> {
+    let (name, attrs) = self.info()?;
+    Ok(self.ar.bound(Bound { name, attrs }))
+  }
+
+  fn field(&mut self) -> Result<&'b Field<'b>, SnapshotError> {
+    let (name, attrs) = self.info()?;
+    Ok(self.ar.field(Field { name, attrs }))
+  }
+
+  fn node(&mut self) -> Result<&'b Term<'b, 'b, Core>, SnapshotError> {
+    self.reader.index(&self.nodes)
+  }
+
+  /// Reads the record with the given tag, which must be a term node.
+  fn term(&mut self, tag: u8) -> Result<Term<'b, 'b, Core>, SnapshotError> {
+    Ok(match tag {
+      GC => Term::Gc(self.node()?),
+      UNIV => Term::Univ(self.reader.varint()?),
+      VAR => Term::Var(self.reader.varint()?),
+      ANN => Term::Ann(self.node()?, self.node()?),
+      LET => Term::Let(self.bound()?, self.node()?, self.node()?),
+      PI => Term::Pi(self.bound()?, self.node()?, self.node()?),
+      FUN => Term::Fun(self.bound()?, self.node()?),
+      APP => Term::App(
+        self.node()?,
+        self.node()?,
+        match self.reader.byte()? {
+          0 => false,
+          1 => true,
+          _ => return Err(self.reader.malformed()),
+        },
+      ),
+      SIG | TUP => {
+        let len = self.reader.varint()?;
+        // Every field takes at least two bytes.
+        if len > self.reader.bytes.len() - self.reader.pos {
+          return Err(SnapshotError::UnexpectedEof);
+        }
+        let us = self.ar.terms(len);
+        for u in us.iter_mut() {
+          *u = (self.field()?, *self.node()?);
+        }
+        if tag == SIG {
+          Term::Sig(us)
+        } else {
+          Term::Tup(us)
+        }
+      }
+      INIT => Term::Init(self.reader.varint()?, self.node()?),
+      PROJ => Term::Proj(self.reader.varint()?, self.node()?),
+      META => Term::Meta(self.reader.varint()?),
+      CONST => Term::Const(self.reader.index(&self.globals)?),
+      _ => return Err(SnapshotError::Malformed { pos: self.reader.pos - 1 }),
+    })
+  }
+
+  /// Reads a global definition record. Unless `trusted`, the stored type is checked to be a type
+  /// before it is evaluated (it may not be well-formed), and the term is checked against it, so
+  /// that the definition is the same as when loaded trusted. The type of `Type` is accepted as is,
+  /// since it has no type itself.
+  fn global(&mut self, trusted: bool) -> Result<&'b Global<'b>, SnapshotError> {
+    let ar = self.ar;
+    let info = self.bound()?;
+    let (term, ty) = (self.node()?, self.node()?);
+    let name = info.name.as_str();
+    let rejected = |err: String| SnapshotError::Rejected { name: name.to_owned(), err };
+    let (ctx, env) = (Stack::new(ar), Stack::new(ar));
+    if !trusted && !matches!(ty, Term::Univ(v) if univ_univ(0) == Some(*v)) {
+      let (_, tt) = ty.infer(&ctx, &env, ar).map_err(|e| rejected(e.to_string()))?;
+      let _ = tt.as_univ(|tt| rejected(TypeError::type_expected(ty, tt, &ctx, &env, ar).to_string()))?;
+    }
+    let ty = ty.eval(&env, ar).map_err(|e| rejected(e.to_string()))?;
+    if !trusted {
+      let _ = term.check(ty, &ctx, &env, ar).map_err(|e| rejected(e.to_string()))?;
+    }
+    let val = term.eval(&env, ar).map_err(|e| rejected(e.to_string()))?;
+    Ok(ar.global(Global { info, term, ty, val }))
+  }
+}
+
+impl<'b> Globals<'b> {
+  /// Serialises all global definitions (including shadowed ones) into a snapshot: a versioned
+  /// binary format holding the definitions with their binder and field information, and their
+  /// types in normal form. Shared subterms and repeated strings are only written once.
+  ///
+  /// Fails if a definition refers to a global definition not in this table.
+  pub fn save(&self) -> Result<Vec<u8>, SnapshotError> {
+    let temp = Arena::new();
+    let mut writer = Writer::new();
+    writer.buf.extend_from_slice(MAGIC);
+    writer.buf.extend_from_slice(&SNAPSHOT_VERSION.to_le_bytes());
+    for (k, global) in self.iter().enumerate() {
+      let name = global.info.name.as_str();
+      let ty = global.ty.quote(0, &temp);
+      let ty = ty.map_err(|e| SnapshotError::Rejected { name: name.to_owned(), err: e.to_string() })?;
+      let (term, ty) = (writer.term(global.term)?, writer.term(temp.term(ty))?);
+      writer.buf.push(GLOBAL);
+      writer.info(global.info.name, global.info.attrs);
+      writer.varint(term);
+      writer.varint(ty);
+      writer.globals.insert(global as *const _ as *const (), k);
+    }
+    Ok(writer.buf)
+  }
+
+  /// Loads all global definitions from a snapshot produced by [`Globals::save`], allocating them
+  /// directly in `ar` in a single pass. Returns the number of definitions loaded.
+  ///
+  /// Unless `trusted` is set, each definition is checked again against its stored type and the
+  /// definitions before it, so that corrupted or forged snapshots cannot introduce ill-typed
+  /// definitions. On failure, the definitions before the offending record remain loaded.
+  pub fn load(&mut self, bytes: &[u8], trusted: bool, ar: &'b Arena) -> Result<usize, SnapshotError> {
+    let mut reader = Reader { bytes, pos: 0 };
+    if reader.bytes(MAGIC.len()).ok() != Some(MAGIC) {
+      return Err(SnapshotError::BadMagic);
+    }
+    let version = u32::from_le_bytes(reader.bytes(4)?.try_into().unwrap());
+    if version != SNAPSHOT_VERSION {
+      return Err(SnapshotError::BadVersion { version });
+    }
+    let mut loader = Loader { reader, strings: Vec::new(), nodes: Vec::new(), globals: Vec::new(), ar };
+    while loader.reader.pos < bytes.len() {
+      match loader.reader.byte()? {
+        GLOBAL => {
+          let global = loader.global(trusted)?;
+          loader.globals.push(global);
+          self.insert(global);
+        }
+        tag => {
+          let term = loader.term(tag)?;
+          loader.nodes.push(ar.term(term));
+        }
+      }
+    }
+    Ok(loader.globals.len())
+  }
+}
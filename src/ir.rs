@@ -1,5 +1,12 @@
 mod errors;
+mod index;
+mod machine;
+mod schedule;
 mod term;
 
-pub use errors::{EvalError, TypeError};
-pub use term::{Bound, Clos, Core, Decoration, Field, Name, Named, Stack, Term, Val};
+pub use errors::{EvalError, Quoted, Sink, TypeError};
+pub(crate) use index::Slot;
+pub use index::{Index, Pos};
+pub use machine::Machine;
+pub(crate) use schedule::Schedule;
+pub use term::{Bound, Clos, Core, Decoration, Field, Global, Name, Named, Stack, Term, Val};
@@ -8,8 +8,20 @@ use crate::arena::{Arena, Relocate};
 pub enum EvalError<'a, 'b> {
   EnvIndex { ix: usize, len: usize },
   GenLevel { lvl: usize, len: usize },
-  TupInit { n: usize, val: &'a Term<'a, 'b, Core> },
-  TupProj { n: usize, val: &'a Term<'a, 'b, Core> },
+  TupInit { n: usize, val: Quoted<'a, 'b> },
+  TupProj { n: usize, val: Quoted<'a, 'b> },
+  OutOfFuel,
+  OutOfMemory { limit: usize },
+}
+
+/// # Lazily quoted values
+///
+/// Values in error payloads, together with the sizes of their contexts. They are quoted only when
+/// the error is displayed, so that failed checks which are recovered from do not pay for quoting.
+#[derive(Debug, Clone, Copy)]
+pub struct Quoted<'a, 'b> {
+  pub val: Val<'a, 'b>,
+  pub len: usize,
 }
 
 /// # Typing errors
@@ -22,19 +34,59 @@ pub enum TypeError<'a, 'b, T: Decoration> {
   PiForm { from: usize, to: usize },
   SigForm { fst: usize, snd: usize },
   CtxIndex { ix: usize, len: usize },
-  SigInit { n: usize, ty: &'a Term<'a, 'b, Core> },
-  SigProj { n: usize, ty: &'a Term<'a, 'b, Core> },
+  SigInit { n: usize, ty: Quoted<'a, 'b> },
+  SigProj { n: usize, ty: Quoted<'a, 'b> },
   AnnExpected { term: &'a Term<'a, 'b, T> },
-  TypeExpected { term: &'a Term<'a, 'b, T>, ty: &'a Term<'a, 'b, Core> },
-  PiExpected { term: &'a Term<'a, 'b, T>, ty: &'a Term<'a, 'b, Core> },
-  SigExpected { term: &'a Term<'a, 'b, T>, ty: &'a Term<'a, 'b, Core> },
-  PiAnnExpected { ty: &'a Term<'a, 'b, Core> },
-  SigAnnExpected { ty: &'a Term<'a, 'b, Core> },
-  TypeMismatch { term: &'a Term<'a, 'b, T>, ty: &'a Term<'a, 'b, Core>, ety: &'a Term<'a, 'b, Core> },
+  TypeExpected { term: &'a Term<'a, 'b, T>, ty: Quoted<'a, 'b> },
+  PiExpected { term: &'a Term<'a, 'b, T>, ty: Quoted<'a, 'b> },
+  SigExpected { term: &'a Term<'a, 'b, T>, ty: Quoted<'a, 'b> },
+  PiAnnExpected { ty: Quoted<'a, 'b> },
+  SigAnnExpected { ty: Quoted<'a, 'b> },
+  TypeMismatch { term: &'a Term<'a, 'b, T>, ty: Quoted<'a, 'b>, ety: Quoted<'a, 'b> },
   TupSizeMismatch { term: &'a Term<'a, 'b, T>, sz: usize, esz: usize },
   TupFieldMismatch { term: &'a Term<'a, 'b, T>, name: Name<'b>, ename: Name<'b> },
 }
 
+/// # Error sinks
+///
+/// How [`Term::infer_into`] and [`Term::check_into`] report failures of the typing rules: as
+/// [`TypeError`]s, or as `()` for checks which only need to know whether they succeed. Errors are
+/// passed as constructors, which the `()` sink never calls, so failed checks construct (and
+/// allocate) no errors at all. Evaluation errors are cheap, and are discarded when converted.
+pub trait Sink {
+  type Error<'a, 'b: 'a>: From<EvalError<'a, 'b>> + Send;
+
+  /// Makes an error from the constructor of a typing error.
+  fn error<'a, 'b: 'a>(err: impl FnOnce() -> TypeError<'a, 'b, Core>) -> Self::Error<'a, 'b>;
+
+  /// Clones an error to the given arena.
+  fn relocate<'a, 'c, 'b: 'a + 'c>(err: &Self::Error<'c, 'b>, ar: &'a Arena) -> Self::Error<'a, 'b>;
+}
+
+impl Sink for TypeError<'_, '_, Core> {
+  type Error<'a, 'b: 'a> = TypeError<'a, 'b, Core>;
+
+  fn error<'a, 'b: 'a>(err: impl FnOnce() -> TypeError<'a, 'b, Core>) -> Self::Error<'a, 'b> {
+    err()
+  }
+
+  fn relocate<'a, 'c, 'b: 'a + 'c>(err: &Self::Error<'c, 'b>, ar: &'a Arena) -> Self::Error<'a, 'b> {
+    err.relocate(ar)
+  }
+}
+
+impl Sink for () {
+  type Error<'a, 'b: 'a> = ();
+
+  fn error<'a, 'b: 'a>(_: impl FnOnce() -> TypeError<'a, 'b, Core>) -> Self::Error<'a, 'b> {}
+
+  fn relocate<'a, 'c, 'b: 'a + 'c>(_: &Self::Error<'c, 'b>, _: &'a Arena) -> Self::Error<'a, 'b> {}
+}
+
+impl From<EvalError<'_, '_>> for () {
+  fn from(_: EvalError<'_, '_>) {}
+}
+
 impl<'a, 'b> EvalError<'a, 'b> {
   pub fn env_index(ix: usize, len: usize) -> Self {
     Self::EnvIndex { ix, len }
@@ -44,18 +96,20 @@ impl<'a, 'b> EvalError<'a, 'b> {
     Self::GenLevel { lvl, len }
   }
 
-  pub fn tup_init(n: usize, val: Val<'a, 'b>, env: &Stack<'a, 'b>, ar: &'a Arena) -> Self {
-    match ar.val(val).quote(env.len(), ar) {
-      Ok(val) => Self::TupInit { n, val: ar.term(val) },
-      Err(err) => err,
-    }
+  pub fn tup_init(n: usize, val: Val<'a, 'b>, env: &Stack<'a, 'b>, _ar: &'a Arena) -> Self {
+    Self::TupInit { n, val: Quoted::new(val, env.len()) }
   }
 
-  pub fn tup_proj(n: usize, val: Val<'a, 'b>, env: &Stack<'a, 'b>, ar: &'a Arena) -> Self {
-    match ar.val(val).quote(env.len(), ar) {
-      Ok(val) => Self::TupProj { n, val: ar.term(val) },
-      Err(err) => err,
-    }
+  pub fn tup_proj(n: usize, val: Val<'a, 'b>, env: &Stack<'a, 'b>, _ar: &'a Arena) -> Self {
+    Self::TupProj { n, val: Quoted::new(val, env.len()) }
+  }
+
+  pub fn out_of_fuel() -> Self {
+    Self::OutOfFuel
+  }
+
+  pub fn out_of_memory(limit: usize) -> Self {
+    Self::OutOfMemory { limit }
   }
 }
 
@@ -76,18 +130,12 @@ impl<'a, 'b, T: Decoration> TypeError<'a, 'b, T> {
     Self::CtxIndex { ix, len }
   }
 
-  pub fn sig_init(n: usize, ty: Val<'a, 'b>, ctx: &Stack<'a, 'b>, _env: &Stack<'a, 'b>, ar: &'a Arena) -> Self {
-    match ar.val(ty).quote(ctx.len(), ar) {
-      Ok(ty) => Self::SigInit { n, ty: ar.term(ty) },
-      Err(err) => err.into(),
-    }
+  pub fn sig_init(n: usize, ty: Val<'a, 'b>, ctx: &Stack<'a, 'b>, _env: &Stack<'a, 'b>, _ar: &'a Arena) -> Self {
+    Self::SigInit { n, ty: Quoted::new(ty, ctx.len()) }
   }
 
-  pub fn sig_proj(n: usize, ty: Val<'a, 'b>, ctx: &Stack<'a, 'b>, _env: &Stack<'a, 'b>, ar: &'a Arena) -> Self {
-    match ar.val(ty).quote(ctx.len(), ar) {
-      Ok(ty) => Self::SigProj { n, ty: ar.term(ty) },
-      Err(err) => err.into(),
-    }
+  pub fn sig_proj(n: usize, ty: Val<'a, 'b>, ctx: &Stack<'a, 'b>, _env: &Stack<'a, 'b>, _ar: &'a Arena) -> Self {
+    Self::SigProj { n, ty: Quoted::new(ty, ctx.len()) }
   }
 
   pub fn ann_expected(term: &'a Term<'a, 'b, T>) -> Self {
@@ -99,12 +147,9 @@ impl<'a, 'b, T: Decoration> TypeError<'a, 'b, T> {
     ty: Val<'a, 'b>,
     ctx: &Stack<'a, 'b>,
     _env: &Stack<'a, 'b>,
-    ar: &'a Arena,
+    _ar: &'a Arena,
   ) -> Self {
-    match ar.val(ty).quote(ctx.len(), ar) {
-      Ok(ty) => Self::TypeExpected { term, ty: ar.term(ty) },
-      Err(err) => err.into(),
-    }
+    Self::TypeExpected { term, ty: Quoted::new(ty, ctx.len()) }
   }
 
   pub fn pi_expected(
@@ -112,12 +157,9 @@ impl<'a, 'b, T: Decoration> TypeError<'a, 'b, T> {
     ty: Val<'a, 'b>,
     ctx: &Stack<'a, 'b>,
     _env: &Stack<'a, 'b>,
-    ar: &'a Arena,
+    _ar: &'a Arena,
   ) -> Self {
-    match ar.val(ty).quote(ctx.len(), ar) {
-      Ok(ty) => Self::PiExpected { term, ty: ar.term(ty) },
-      Err(err) => err.into(),
-    }
+    Self::PiExpected { term, ty: Quoted::new(ty, ctx.len()) }
   }
 
   pub fn sig_expected(
@@ -125,26 +167,17 @@ impl<'a, 'b, T: Decoration> TypeError<'a, 'b, T> {
     ty: Val<'a, 'b>,
     ctx: &Stack<'a, 'b>,
     _env: &Stack<'a, 'b>,
-    ar: &'a Arena,
+    _ar: &'a Arena,
   ) -> Self {
-    match ar.val(ty).quote(ctx.len(), ar) {
-      Ok(ty) => Self::SigExpected { term, ty: ar.term(ty) },
-      Err(err) => err.into(),
-    }
+    Self::SigExpected { term, ty: Quoted::new(ty, ctx.len()) }
   }
 
-  pub fn pi_ann_expected(ty: Val<'a, 'b>, ctx: &Stack<'a, 'b>, _env: &Stack<'a, 'b>, ar: &'a Arena) -> Self {
-    match ar.val(ty).quote(ctx.len(), ar) {
-      Ok(ty) => Self::PiAnnExpected { ty: ar.term(ty) },
-      Err(err) => err.into(),
-    }
+  pub fn pi_ann_expected(ty: Val<'a, 'b>, ctx: &Stack<'a, 'b>, _env: &Stack<'a, 'b>, _ar: &'a Arena) -> Self {
+    Self::PiAnnExpected { ty: Quoted::new(ty, ctx.len()) }
   }
 
-  pub fn sig_ann_expected(ty: Val<'a, 'b>, ctx: &Stack<'a, 'b>, _env: &Stack<'a, 'b>, ar: &'a Arena) -> Self {
-    match ar.val(ty).quote(ctx.len(), ar) {
-      Ok(ty) => Self::SigAnnExpected { ty: ar.term(ty) },
-      Err(err) => err.into(),
-    }
+  pub fn sig_ann_expected(ty: Val<'a, 'b>, ctx: &Stack<'a, 'b>, _env: &Stack<'a, 'b>, _ar: &'a Arena) -> Self {
+    Self::SigAnnExpected { ty: Quoted::new(ty, ctx.len()) }
   }
 
   pub fn type_mismatch(
@@ -153,15 +186,9 @@ impl<'a, 'b, T: Decoration> TypeError<'a, 'b, T> {
     ety: Val<'a, 'b>,
     ctx: &Stack<'a, 'b>,
     _env: &Stack<'a, 'b>,
-    ar: &'a Arena,
+    _ar: &'a Arena,
   ) -> Self {
-    match ar.val(ty).quote(ctx.len(), ar) {
-      Ok(ty) => match ar.val(ety).quote(ctx.len(), ar) {
-        Ok(ety) => Self::TypeMismatch { term, ty: ar.term(ty), ety: ar.term(ety) },
-        Err(err) => err.into(),
-      },
-      Err(err) => err.into(),
-    }
+    Self::TypeMismatch { term, ty: Quoted::new(ty, ctx.len()), ety: Quoted::new(ety, ctx.len()) }
   }
 
   pub fn tup_size_mismatch(term: &'a Term<'a, 'b, T>, sz: usize, esz: usize) -> Self {
@@ -173,19 +200,38 @@ impl<'a, 'b, T: Decoration> TypeError<'a, 'b, T> {
   }
 }
 
+impl<'a, 'b> Quoted<'a, 'b> {
+  pub fn new(val: Val<'a, 'b>, len: usize) -> Self {
+    Self { val, len }
+  }
+
+  /// Quotes the value into the given arena.
+  pub fn quote(&self, ar: &'a Arena) -> Result<Term<'a, 'b, Core>, EvalError<'a, 'b>> {
+    self.val.quote(self.len, ar)
+  }
+}
+
 impl<'a, 'b, T: Decoration> std::convert::From<EvalError<'a, 'b>> for TypeError<'a, 'b, T> {
   fn from(err: EvalError<'a, 'b>) -> Self {
     Self::EvalError { err }
   }
 }
 
+impl<'a, 'b> Relocate<'a, Quoted<'a, 'b>> for Quoted<'_, 'b> {
+  fn relocate(&self, ar: &'a Arena) -> Quoted<'a, 'b> {
+    Quoted { val: self.val.relocate(ar), len: self.len }
+  }
+}
+
 impl<'a, 'b> Relocate<'a, EvalError<'a, 'b>> for EvalError<'_, 'b> {
   fn relocate(&self, ar: &'a Arena) -> EvalError<'a, 'b> {
     match self {
       Self::EnvIndex { ix, len } => EvalError::EnvIndex { ix: *ix, len: *len },
       Self::GenLevel { lvl, len } => EvalError::GenLevel { lvl: *lvl, len: *len },
-      Self::TupInit { n, val } => EvalError::TupInit { n: *n, val: ar.term(val.relocate(ar)) },
-      Self::TupProj { n, val } => EvalError::TupProj { n: *n, val: ar.term(val.relocate(ar)) },
+      Self::TupInit { n, val } => EvalError::TupInit { n: *n, val: val.relocate(ar) },
+      Self::TupProj { n, val } => EvalError::TupProj { n: *n, val: val.relocate(ar) },
+      Self::OutOfFuel => EvalError::OutOfFuel,
+      Self::OutOfMemory { limit } => EvalError::OutOfMemory { limit: *limit },
     }
   }
 }
@@ -198,35 +244,38 @@ impl<'a, 'b, T: Decoration> Relocate<'a, TypeError<'a, 'b, T>> for TypeError<'_,
       Self::PiForm { from, to } => TypeError::PiForm { from: *from, to: *to },
       Self::SigForm { fst, snd } => TypeError::SigForm { fst: *fst, snd: *snd },
       Self::CtxIndex { ix, len } => TypeError::CtxIndex { ix: *ix, len: *len },
-      Self::SigInit { n, ty } => TypeError::SigInit { n: *n, ty: ar.term(ty.relocate(ar)) },
-      Self::SigProj { n, ty } => TypeError::SigProj { n: *n, ty: ar.term(ty.relocate(ar)) },
-      Self::AnnExpected { term } => TypeError::AnnExpected { term: ar.term(term.relocate(ar)) },
-      Self::TypeExpected { term, ty } => {
-        TypeError::TypeExpected { term: ar.term(term.relocate(ar)), ty: ar.term(ty.relocate(ar)) }
-      }
-      Self::PiExpected { term, ty } => {
-        TypeError::PiExpected { term: ar.term(term.relocate(ar)), ty: ar.term(ty.relocate(ar)) }
+      Self::SigInit { n, ty } => TypeError::SigInit { n: *n, ty: ty.relocate(ar) },
+      Self::SigProj { n, ty } => TypeError::SigProj { n: *n, ty: ty.relocate(ar) },
+      Self::AnnExpected { term } => TypeError::AnnExpected { term: ar.relocate_term(term) },
+      Self::TypeExpected { term, ty } => TypeError::TypeExpected { term: ar.relocate_term(term), ty: ty.relocate(ar) },
+      Self::PiExpected { term, ty } => TypeError::PiExpected { term: ar.relocate_term(term), ty: ty.relocate(ar) },
+      Self::SigExpected { term, ty } => TypeError::SigExpected { term: ar.relocate_term(term), ty: ty.relocate(ar) },
+      Self::PiAnnExpected { ty } => TypeError::PiAnnExpected { ty: ty.relocate(ar) },
+      Self::SigAnnExpected { ty } => TypeError::SigAnnExpected { ty: ty.relocate(ar) },
+      Self::TypeMismatch { term, ty, ety } => {
+        TypeError::TypeMismatch { term: ar.relocate_term(term), ty: ty.relocate(ar), ety: ety.relocate(ar) }
       }
-      Self::SigExpected { term, ty } => {
-        TypeError::SigExpected { term: ar.term(term.relocate(ar)), ty: ar.term(ty.relocate(ar)) }
-      }
-      Self::PiAnnExpected { ty } => TypeError::PiAnnExpected { ty: ar.term(ty.relocate(ar)) },
-      Self::SigAnnExpected { ty } => TypeError::SigAnnExpected { ty: ar.term(ty.relocate(ar)) },
-      Self::TypeMismatch { term, ty, ety } => TypeError::TypeMismatch {
-        term: ar.term(term.relocate(ar)),
-        ty: ar.term(ty.relocate(ar)),
-        ety: ar.term(ety.relocate(ar)),
-      },
       Self::TupSizeMismatch { term, sz, esz } => {
-        TypeError::TupSizeMismatch { term: ar.term(term.relocate(ar)), sz: *sz, esz: *esz }
+        TypeError::TupSizeMismatch { term: ar.relocate_term(term), sz: *sz, esz: *esz }
       }
       Self::TupFieldMismatch { term, name, ename } => {
-        TypeError::TupFieldMismatch { term: ar.term(term.relocate(ar)), name: *name, ename: *ename }
+        TypeError::TupFieldMismatch { term: ar.relocate_term(term), name: *name, ename: *ename }
       }
     }
   }
 }
 
+impl std::fmt::Display for Quoted<'_, '_> {
+  fn fmt(&self, f: &mut std::fmt::Formatter<'_>) -> std::fmt::Result {
+    // The quoted term is only needed for printing, so it is allocated in a temporary arena.
+    let ar = Arena::new();
+    match self.quote(&ar) {
+      Ok(term) => write!(f, "{term}"),
+      Err(err) => write!(f, "<{err}>"),
+    }
+  }
+}
+
 impl std::fmt::Display for EvalError<'_, '_> {
   fn fmt(&self, f: &mut std::fmt::Formatter<'_>) -> std::fmt::Result {
     match self {
@@ -234,6 +283,8 @@ impl std::fmt::Display for EvalError<'_, '_> {
       Self::GenLevel { lvl, len } => write!(f, "generic variable level {lvl} out of bound, environment has size {len}"),
       Self::TupInit { n, val } => write!(f, "tuple prefix length {n} out of bound, tuple has value {val}"),
       Self::TupProj { n, val } => write!(f, "tuple index {n} out of bound, tuple has value {val}"),
+      Self::OutOfFuel => write!(f, "evaluation step limit reached"),
+      Self::OutOfMemory { limit } => write!(f, "arena byte limit {limit} exceeded"),
     }
   }
 }
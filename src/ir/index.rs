@@ -0,0 +1,161 @@
+use crate::arena::Arena;
+use crate::ir::Name;
+
+/// # Name indices
+///
+/// A persistent hash array mapped trie from names to the most recent fields of transparent
+/// binders that they refer to, so that named variables can be resolved without scanning every
+/// field of every transparent binder in the context. Updating returns a new index sharing all
+/// untouched nodes with the old one.
+///
+/// Each node is a 32-bit occupancy bitmap followed by a packed array of its occupied slots. Five
+/// bits of the hash are consumed per level, starting from the most significant ones (so that
+/// entries sorted by hash are also grouped by child); full hash collisions are kept in a flat list
+/// at the bottom.
+///
+/// - See: <https://infoscience.epfl.ch/record/64398> (Bagwell's ideal hash trees)
+#[derive(Debug, Clone, Copy)]
+pub struct Index<'a, 'b> {
+  map: u32,
+  slots: &'a [Slot<'a, 'b>],
+}
+
+/// Position of a field of a transparent binder: de Bruijn level of the binder, and index of the
+/// field counted from the start. The binder may still grow while elaborating a tuple, so the
+/// projection index (counted from the end) is only computed on lookup.
+pub type Pos = (usize, usize);
+
+/// A slot in an index node: either a single entry with its hash, or a child node.
+#[derive(Debug, Clone, Copy)]
+pub(crate) enum Slot<'a, 'b> {
+  Entry(u64, Name<'b>, Pos),
+  Node(Index<'a, 'b>),
+}
+
+/// Number of hash bits consumed per level.
+const BITS: u32 = 5;
+
+/// Returns the chunk of `hash` selecting the child at the level starting from bit `shift`.
+fn chunk(hash: u64, shift: u32) -> u32 {
+  (hash.rotate_left(shift + BITS) & ((1 << BITS) - 1)) as u32
+}
+
+/// FNV-1a hash of a name.
+fn hash(name: Name) -> u64 {
+  let name = name.as_str();
+  name.bytes().fold(0xcbf29ce484222325, |h, b| (h ^ b as u64).wrapping_mul(0x100000001b3))
+}
+
+impl<'a, 'b> Index<'a, 'b> {
+  /// Creates an empty index. This does not allocate.
+  pub fn new() -> Self {
+    Self { map: 0, slots: &[] }
+  }
+
+  /// Returns a reference to an empty index. This does not allocate.
+  pub fn empty() -> &'a Self {
+    &Self { map: 0, slots: &[] }
+  }
+
+  /// Returns the position of the given name, if it exists.
+  pub fn get(&self, name: Name<'b>) -> Option<Pos> {
+    let hash = hash(name);
+    let mut curr = self;
+    let mut shift = 0;
+    while shift < u64::BITS {
+      let bit = 1 << chunk(hash, shift);
+      if curr.map & bit == 0 {
+        return None;
+      }
+      match &curr.slots[(curr.map & (bit - 1)).count_ones() as usize] {
+        Slot::Entry(_, n, pos) => return (*n == name).then_some(*pos),
+        Slot::Node(child) => curr = child,
+      }
+      shift += BITS;
+    }
+    // Below the last level, all hashes are equal.
+    curr.slots.iter().find_map(|slot| match slot {
+      Slot::Entry(_, n, pos) if *n == name => Some(*pos),
+      _ => None,
+    })
+  }
+
+  /// Returns a new index with the given entries added. Later entries shadow earlier entries and
+  /// existing entries of the same name. Empty names are skipped.
+  pub fn insert(&self, entries: impl IntoIterator<Item = (Name<'b>, Pos)>, ar: &'a Arena) -> Self {
+    let entries = entries.into_iter().filter(|(name, _)| !name.is_empty());
+    let mut entries = entries.map(|(name, pos)| (hash(name), name, pos)).collect::<Vec<_>>();
+    // Sort by hash so that each child receives a contiguous run, keeping only the last of each name.
+    entries.reverse();
+    entries.sort_by_key(|(hash, name, _)| (*hash, *name));
+    entries.dedup_by_key(|(_, name, _)| *name);
+    self.merge(&entries, 0, ar)
+  }
+
+  /// Merges sorted and deduplicated entries into the subtrie at the given level, copying only the
+  /// nodes along the affected paths.
+  fn merge(&self, entries: &[(u64, Name<'b>, Pos)], shift: u32, ar: &'a Arena) -> Self {
+    if entries.is_empty() {
+      return *self;
+    }
+    // Below the last level, all hashes are equal, so the entries are kept in a flat list.
+    if shift >= u64::BITS {
+      let shadowed = |n: &Name| entries.iter().any(|(_, name, _)| name == n);
+      let old = self.slots.iter().filter(|slot| !matches!(slot, Slot::Entry(_, n, _) if shadowed(n)));
+      let new = entries.iter().map(|(hash, name, pos)| Slot::Entry(*hash, *name, *pos));
+      return Self { map: 0, slots: ar.slots(&old.copied().chain(new).collect::<Vec<_>>()) };
+    }
+    // Fast path for single insertions, which only touch one slot per level.
+    if let [(hash, name, pos)] = entries {
+      let bit = 1 << chunk(*hash, shift);
+      let k = (self.map & (bit - 1)).count_ones() as usize;
+      let mut slots = self.slots.to_vec();
+      let slot = Slot::Entry(*hash, *name, *pos);
+      if self.map & bit == 0 {
+        slots.insert(k, slot);
+      } else {
+        slots[k] = match slots[k] {
+          Slot::Entry(_, n, _) if n == *name => slot,
+          Slot::Entry(hash, name, pos) => {
+            let child = Self::new().merge(&[(hash, name, pos)], shift + BITS, ar);
+            Slot::Node(child.merge(entries, shift + BITS, ar))
+          }
+          Slot::Node(child) => Slot::Node(child.merge(entries, shift + BITS, ar)),
+        };
+      }
+      return Self { map: self.map | bit, slots: ar.slots(&slots) };
+    }
+    let mut map = 0;
+    let mut slots = Vec::new();
+    let mut old = self.slots.iter();
+    let mut rest = entries;
+    for i in 0..(1 << BITS) {
+      let bit = 1 << i;
+      let old_slot = if self.map & bit != 0 { old.next().copied() } else { None };
+      let (group, tail) = rest.split_at(rest.iter().take_while(|(hash, _, _)| chunk(*hash, shift) == i).count());
+      rest = tail;
+      let slot = match (old_slot, group) {
+        (slot, []) => slot,
+        (None, [(hash, name, pos)]) => Some(Slot::Entry(*hash, *name, *pos)),
+        (Some(Slot::Entry(_, n, _)), [(hash, name, pos)]) if n == *name => Some(Slot::Entry(*hash, *name, *pos)),
+        (Some(Slot::Entry(hash, name, pos)), group) => {
+          let child = Self::new().merge(&[(hash, name, pos)], shift + BITS, ar);
+          Some(Slot::Node(child.merge(group, shift + BITS, ar)))
+        }
+        (Some(Slot::Node(child)), group) => Some(Slot::Node(child.merge(group, shift + BITS, ar))),
+        (None, group) => Some(Slot::Node(Self::new().merge(group, shift + BITS, ar))),
+      };
+      if let Some(slot) = slot {
+        map |= bit;
+        slots.push(slot);
+      }
+    }
+    Self { map, slots: ar.slots(&slots) }
+  }
+}
+
+impl Default for Index<'_, '_> {
+  fn default() -> Self {
+    Self::new()
+  }
+}
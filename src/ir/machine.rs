@@ -0,0 +1,510 @@
+use std::ptr;
+use std::slice::from_raw_parts;
+
+use super::term::{beta, within_byte_limit};
+use super::*;
+use crate::arena::{Arena, Relocate};
+
+/// # Abstract machines
+///
+/// Explicit-stack counterparts of [`Term::eval`], [`Clos::apply`], [`Val::quote`] and
+/// [`Val::conv`], computing identical results. Pending work is kept in vectors owned by the
+/// machine instead of the native stack, so the native stack depth stays constant regardless of
+/// the depth of terms and values. The vectors are reused across calls on the same machine.
+///
+/// Calls may be nested (e.g. quoting applies closures, which evaluates their bodies): each call
+/// only consumes the entries it has pushed itself.
+///
+/// As in the recursive functions, every closure instantiated takes one (β) step and every value
+/// quoted checks the byte limit, see [`Arena::set_fuel`] and [`Arena::set_byte_limit`].
+#[derive(Debug, Default)]
+pub struct Machine<'a, 'b> {
+  evals: Vec<EvalFrame<'a, 'b>>,
+  quotes: Vec<QuoteFrame<'a, 'b>>,
+  convs: Vec<ConvTask<'a, 'b>>,
+}
+
+/// # Evaluator states
+#[derive(Debug)]
+enum EvalState<'a, 'b> {
+  /// Evaluating a term under an environment.
+  Eval(&'a Term<'a, 'b, Core>, Stack<'a, 'b>),
+  /// Applying a function to an argument (function, argument, dot-syntax flag).
+  Apply(Val<'a, 'b>, Val<'a, 'b>, bool),
+  /// Returning a value to the topmost frame.
+  Return(Val<'a, 'b>),
+}
+
+/// # Evaluator frames
+///
+/// Each frame waits for the value of a subterm.
+#[derive(Debug)]
+enum EvalFrame<'a, 'b> {
+  /// Waiting for the value to be bound (bound variable info, *body*, environment).
+  Let(&'b Bound<'b>, &'a Term<'a, 'b, Core>, Stack<'a, 'b>),
+  /// Waiting for the parameter type (bound variable info, *return type*, environment).
+  Pi(&'b Bound<'b>, &'a Term<'a, 'b, Core>, Stack<'a, 'b>),
+  /// Waiting for the function (argument, environment, dot-syntax flag).
+  AppFun(&'a Term<'a, 'b, Core>, Stack<'a, 'b>, bool),
+  /// Waiting for the argument (function, dot-syntax flag).
+  AppArg(Val<'a, 'b>, bool),
+  /// Waiting for the unfolded form of a glued application (folded spine).
+  Glue(&'a Val<'a, 'b>),
+  /// Waiting for a tuple element (element terms, element values, index, environment).
+  Tup(&'a [(&'b Field<'b>, Term<'a, 'b, Core>)], *mut (&'b Field<'b>, Val<'a, 'b>), usize, Stack<'a, 'b>),
+  /// Waiting for the tuple (truncation, environment).
+  Init(usize, Stack<'a, 'b>),
+  /// Waiting for the tuple (index, environment).
+  Proj(usize, Stack<'a, 'b>),
+}
+
+/// # Quoter states
+#[derive(Debug)]
+enum QuoteState<'a, 'b> {
+  /// Quoting a value under a context with given size.
+  Quote(Val<'a, 'b>, usize),
+  /// Quoting a value allocated in the arena, which may be memoised (see [`Arena::set_memoising`]).
+  QuoteRef(&'a Val<'a, 'b>, usize),
+  /// Returning a term to the topmost frame.
+  Return(Term<'a, 'b, Core>),
+}
+
+/// # Quoter frames
+///
+/// Each frame waits for the term of a subvalue.
+#[derive(Debug)]
+enum QuoteFrame<'a, 'b> {
+  /// Waiting for the parameter type (*return type*, context size).
+  PiDom(&'a Clos<'a, 'b>, usize),
+  /// Waiting for the return type (bound variable info, parameter type).
+  PiCod(&'b Bound<'b>, &'a Term<'a, 'b, Core>),
+  /// Waiting for the body (bound variable info).
+  Fun(&'b Bound<'b>),
+  /// Waiting for the function (argument, dot-syntax flag, context size).
+  AppFun(&'a Val<'a, 'b>, bool, usize),
+  /// Waiting for the argument (function, dot-syntax flag).
+  AppArg(&'a Term<'a, 'b, Core>, bool),
+  /// Waiting for an element type (element closures, element terms, index, context size).
+  Sig(&'a [(&'b Field<'b>, Clos<'a, 'b>)], &'a mut [(&'b Field<'b>, Term<'a, 'b, Core>)], usize, usize),
+  /// Waiting for an element value (element values, element terms, index, context size).
+  Tup(&'a [(&'b Field<'b>, Val<'a, 'b>)], &'a mut [(&'b Field<'b>, Term<'a, 'b, Core>)], usize, usize),
+  /// Waiting for the tuple (truncation).
+  Init(usize),
+  /// Waiting for the tuple (index).
+  Proj(usize),
+  /// Waiting for a value allocated in the arena, to record its quoted form (value, context size).
+  Memo(&'a Val<'a, 'b>, usize),
+}
+
+/// # Conversion tasks
+///
+/// Pending pairs which must all be definitionally equal.
+#[derive(Debug)]
+enum ConvTask<'a, 'b> {
+  /// Values under a context with given size.
+  Vals(Val<'a, 'b>, Val<'a, 'b>, usize),
+  /// Closure bodies, to be applied to a fresh variable under a context with given size.
+  Clos(&'a Clos<'a, 'b>, &'a Clos<'a, 'b>, usize),
+}
+
+impl<'a, 'b> Machine<'a, 'b> {
+  /// Creates a new machine with empty stacks.
+  pub fn new() -> Self {
+    Self::default()
+  }
+
+  /// See [`Term::eval`].
+  pub fn eval(
+    &mut self,
+    term: &'a Term<'a, 'b, Core>,
+    env: &Stack<'a, 'b>,
+    ar: &'a Arena,
+  ) -> Result<Val<'a, 'b>, EvalError<'a, 'b>> {
+    self.run_eval(EvalState::Eval(term, env.clone()), ar)
+  }
+
+  /// See [`Clos::apply`].
+  pub fn apply(
+    &mut self,
+    clos: &'a Clos<'a, 'b>,
+    x: Val<'a, 'b>,
+    ar: &'a Arena,
+  ) -> Result<Val<'a, 'b>, EvalError<'a, 'b>> {
+    beta(ar)?;
+    let Clos { info, env, body } = clos;
+    self.run_eval(EvalState::Eval(body, Stack::cons(env, info, x)), ar)
+  }
+
+  /// See [`Val::quote`].
+  pub fn quote(
+    &mut self,
+    val: &Val<'a, 'b>,
+    len: usize,
+    ar: &'a Arena,
+  ) -> Result<Term<'a, 'b, Core>, EvalError<'a, 'b>> {
+    let base = self.quotes.len();
+    let res = self.run_quote(base, *val, len, ar);
+    self.quotes.truncate(base);
+    res
+  }
+
+  /// See [`Val::conv`].
+  pub fn conv(
+    &mut self,
+    val: &Val<'a, 'b>,
+    other: &Val<'a, 'b>,
+    len: usize,
+    ar: &'a Arena,
+  ) -> Result<bool, EvalError<'a, 'b>> {
+    let (base, mark) = (self.convs.len(), ar.meta_mark());
+    self.convs.push(ConvTask::Vals(*val, *other, len));
+    let res = self.run_conv(base, ar);
+    self.convs.truncate(base);
+    if !matches!(res, Ok(true)) {
+      ar.rollback_metas(mark);
+    }
+    res
+  }
+
+  fn run_eval(&mut self, init: EvalState<'a, 'b>, ar: &'a Arena) -> Result<Val<'a, 'b>, EvalError<'a, 'b>> {
+    let base = self.evals.len();
+    let res = self.run_eval_from(base, init, ar);
+    self.evals.truncate(base);
+    res
+  }
+
+  fn run_eval_from(
+    &mut self,
+    base: usize,
+    init: EvalState<'a, 'b>,
+    ar: &'a Arena,
+  ) -> Result<Val<'a, 'b>, EvalError<'a, 'b>> {
+    let mut state = init;
+    loop {
+      state = match state {
+        EvalState::Eval(term, env) => match term {
+          // The garbage collection mark forces the subterm to be evaluated inside a new arena region.
+          Term::Gc(x) => {
+            let temp = ar.region();
+            let res = Machine::new().eval(x, &env, &temp);
+            EvalState::Return(ar.copy_in(|| res.map(|v| v.relocate(ar)).map_err(|e| e.relocate(ar)))?)
+          }
+          Term::Univ(v) => EvalState::Return(Val::Univ(*v)),
+          Term::Var(ix) => EvalState::Return(env.get(*ix, ar).ok_or_else(|| EvalError::env_index(*ix, env.len()))?.1),
+          Term::Ann(x, _) => EvalState::Eval(x, env),
+          Term::Let(i, v, x) => {
+            self.evals.push(EvalFrame::Let(i, x, env.clone()));
+            EvalState::Eval(v, env)
+          }
+          Term::Pi(i, t, u) => {
+            self.evals.push(EvalFrame::Pi(i, u, env.clone()));
+            EvalState::Eval(t, env)
+          }
+          Term::Fun(i, b) => EvalState::Return(Val::Fun(ar.clos(Clos { info: i, env, body: b }))),
+          Term::App(f, x, dot) => {
+            self.evals.push(EvalFrame::AppFun(x, env.clone(), *dot));
+            EvalState::Eval(f, env)
+          }
+          Term::Sig(us) => {
+            let cs = ar.closures(us.len());
+            for (i, (info, u)) in us.iter().enumerate() {
+              cs[i] = (info, Clos { info: Bound::empty(), env: env.clone(), body: u });
+            }
+            EvalState::Return(Val::Sig(cs))
+          }
+          Term::Tup(bs) => match bs.first() {
+            None => EvalState::Return(Val::Tup(&[])),
+            Some((_, b)) => {
+              let vs = ar.values(bs.len()).as_mut_ptr();
+              self.evals.push(EvalFrame::Tup(bs, vs, 0, env.clone()));
+              EvalState::Eval(b, env.extend(Bound::empty(), Val::Tup(&[]), ar))
+            }
+          },
+          Term::Init(n, x) => {
+            self.evals.push(EvalFrame::Init(*n, env.clone()));
+            EvalState::Eval(x, env)
+          }
+          Term::Proj(n, x) => {
+            self.evals.push(EvalFrame::Proj(*n, env.clone()));
+            EvalState::Eval(x, env)
+          }
+          // SAFETY: as in `Term::eval()`.
+          Term::Meta(m) => match unsafe { ar.meta_solution(*m) } {
+            Some(x) => EvalState::Eval(x, env),
+            None => EvalState::Return(Val::Meta(ar.frame(env), *m)),
+          },
+          Term::Const(g) => EvalState::Return(g.value(ar)),
+        },
+        EvalState::Apply(f, x, dot) => match f {
+          Val::Fun(b) => {
+            beta(ar)?;
+            EvalState::Eval(b.body, Stack::cons(&b.env, b.info, x))
+          }
+          Val::Def(_) => {
+            self.evals.push(EvalFrame::Glue(ar.val(Val::App(ar.val(f), ar.val(x), dot))));
+            EvalState::Apply(f.force(), x, dot)
+          }
+          Val::Glued(g, u) => {
+            self.evals.push(EvalFrame::Glue(ar.val(Val::App(g, ar.val(x), dot))));
+            EvalState::Apply(*u, x, dot)
+          }
+          f => EvalState::Return(Val::App(ar.val(f), ar.val(x), dot)),
+        },
+        EvalState::Return(v) => {
+          if self.evals.len() == base {
+            return Ok(v);
+          }
+          match self.evals.pop().unwrap() {
+            EvalFrame::Let(i, x, env) => EvalState::Eval(x, env.extend(i, v.define(ar), ar)),
+            EvalFrame::Pi(i, u, env) => EvalState::Return(Val::Pi(ar.val(v), ar.clos(Clos { info: i, env, body: u }))),
+            EvalFrame::AppFun(x, env, dot) => {
+              self.evals.push(EvalFrame::AppArg(v, dot));
+              EvalState::Eval(x, env)
+            }
+            EvalFrame::AppArg(f, dot) => EvalState::Apply(f, v, dot),
+            EvalFrame::Glue(f) => EvalState::Return(Val::Glued(f, ar.val(v.force()))),
+            EvalFrame::Tup(bs, vs, i, env) => {
+              // SAFETY: `i < bs.len()` which is the valid size of `vs`.
+              unsafe { *vs.add(i) = (bs[i].0, v) };
+              let i = i + 1;
+              match bs.get(i) {
+                None => {
+                  // SAFETY: the borrowed slice `&vs` has valid size `bs.len()` and is no longer modified.
+                  EvalState::Return(Val::Tup(unsafe { from_raw_parts(vs, bs.len()) }))
+                }
+                Some((_, b)) => {
+                  // SAFETY: the borrowed range `&vs[..i]` is no longer modified.
+                  let a = Val::Tup(unsafe { from_raw_parts(vs, i) });
+                  let env_ext = env.extend(Bound::empty(), a, ar);
+                  self.evals.push(EvalFrame::Tup(bs, vs, i, env));
+                  EvalState::Eval(b, env_ext)
+                }
+              }
+            }
+            EvalFrame::Init(n, env) => match v.force() {
+              Val::Init(m, y) => EvalState::Return(Val::Init(n + m, y)),
+              Val::Tup(bs) => {
+                let m = bs.len().checked_sub(n).ok_or_else(|| EvalError::tup_init(n, Val::Tup(bs), &env, ar))?;
+                EvalState::Return(Val::Tup(&bs[..m]))
+              }
+              x => EvalState::Return(Val::Init(n, ar.val(x))),
+            },
+            EvalFrame::Proj(n, env) => match v.force() {
+              Val::Init(m, y) => EvalState::Return(Val::Proj(n + m, y)),
+              Val::Tup(bs) => {
+                let i = bs.len().checked_sub(n + 1).ok_or_else(|| EvalError::tup_proj(n, Val::Tup(bs), &env, ar))?;
+                EvalState::Return(bs[i].1)
+              }
+              x => EvalState::Return(Val::Proj(n, ar.val(x))),
+            },
+          }
+        }
+      }
+    }
+  }
+
+  fn run_quote(
+    &mut self,
+    base: usize,
+    val: Val<'a, 'b>,
+    len: usize,
+    ar: &'a Arena,
+  ) -> Result<Term<'a, 'b, Core>, EvalError<'a, 'b>> {
+    let mut state = QuoteState::Quote(val, len);
+    loop {
+      state = match state {
+        QuoteState::Quote(val, len) => {
+          within_byte_limit(ar)?;
+          match val {
+            Val::Univ(v) => QuoteState::Return(Term::Univ(v)),
+            Val::Free(i) => {
+              QuoteState::Return(Term::Var(len.checked_sub(i + 1).ok_or_else(|| EvalError::gen_level(i, len))?))
+            }
+            Val::Pi(t, u) => {
+              self.quotes.push(QuoteFrame::PiDom(u, len));
+              QuoteState::QuoteRef(t, len)
+            }
+            Val::Fun(b) => {
+              let x = self.apply(b, Val::Free(len), ar)?;
+              self.quotes.push(QuoteFrame::Fun(b.info));
+              QuoteState::Quote(x, len + 1)
+            }
+            Val::App(f, x, dot) => {
+              self.quotes.push(QuoteFrame::AppFun(x, dot, len));
+              QuoteState::QuoteRef(f, len)
+            }
+            Val::Sig(us) => match us.first() {
+              None => QuoteState::Return(Term::Sig(&[])),
+              Some((_, u)) => {
+                let x = self.apply(u, Val::Free(len), ar)?;
+                self.quotes.push(QuoteFrame::Sig(us, ar.terms(us.len()), 0, len));
+                QuoteState::Quote(x, len + 1)
+              }
+            },
+            Val::Tup(bs) => match bs.first() {
+              None => QuoteState::Return(Term::Tup(&[])),
+              Some((_, b)) => {
+                self.quotes.push(QuoteFrame::Tup(bs, ar.terms(bs.len()), 0, len));
+                QuoteState::Quote(*b, len + 1)
+              }
+            },
+            Val::Init(n, x) => {
+              self.quotes.push(QuoteFrame::Init(n));
+              QuoteState::QuoteRef(x, len)
+            }
+            Val::Proj(n, x) => {
+              self.quotes.push(QuoteFrame::Proj(n));
+              QuoteState::QuoteRef(x, len)
+            }
+            Val::Def(x) | Val::Glued(_, x) => QuoteState::Quote(*x, len),
+            // Holes are rare and their substitutions are shallow, so they are quoted natively.
+            Val::Meta(_, _) => QuoteState::Return(val.quote(len, ar)?),
+          }
+        }
+        QuoteState::QuoteRef(val, len) => match ar.quoted(val, len) {
+          Some(term) => QuoteState::Return(*term),
+          None if ar.memoising() => {
+            self.quotes.push(QuoteFrame::Memo(val, len));
+            QuoteState::Quote(*val, len)
+          }
+          None => QuoteState::Quote(*val, len),
+        },
+        QuoteState::Return(x) => {
+          if self.quotes.len() == base {
+            return Ok(x);
+          }
+          match self.quotes.pop().unwrap() {
+            QuoteFrame::PiDom(u, len) => {
+              let y = self.apply(u, Val::Free(len), ar)?;
+              self.quotes.push(QuoteFrame::PiCod(u.info, ar.term(x)));
+              QuoteState::Quote(y, len + 1)
+            }
+            QuoteFrame::PiCod(info, t) => QuoteState::Return(Term::Pi(info, t, ar.term(x))),
+            QuoteFrame::Fun(info) => QuoteState::Return(Term::Fun(info, ar.term(x))),
+            QuoteFrame::AppFun(y, dot, len) => {
+              self.quotes.push(QuoteFrame::AppArg(ar.term(x), dot));
+              QuoteState::QuoteRef(y, len)
+            }
+            QuoteFrame::AppArg(f, dot) => QuoteState::Return(Term::App(f, ar.term(x), dot)),
+            QuoteFrame::Sig(us, terms, i, len) => {
+              terms[i] = (us[i].0, x);
+              match us.get(i + 1) {
+                None => QuoteState::Return(Term::Sig(terms)),
+                Some((_, u)) => {
+                  let y = self.apply(u, Val::Free(len), ar)?;
+                  self.quotes.push(QuoteFrame::Sig(us, terms, i + 1, len));
+                  QuoteState::Quote(y, len + 1)
+                }
+              }
+            }
+            QuoteFrame::Tup(bs, terms, i, len) => {
+              terms[i] = (bs[i].0, x);
+              match bs.get(i + 1) {
+                None => QuoteState::Return(Term::Tup(terms)),
+                Some((_, b)) => {
+                  self.quotes.push(QuoteFrame::Tup(bs, terms, i + 1, len));
+                  QuoteState::Quote(*b, len + 1)
+                }
+              }
+            }
+            QuoteFrame::Init(n) => QuoteState::Return(Term::Init(n, ar.term(x))),
+            QuoteFrame::Proj(n) => QuoteState::Return(Term::Proj(n, ar.term(x))),
+            QuoteFrame::Memo(val, len) => QuoteState::Return(*ar.memo_quoted(val, len, x)),
+          }
+        }
+      }
+    }
+  }
+
+  fn run_conv(&mut self, base: usize, ar: &'a Arena) -> Result<bool, EvalError<'a, 'b>> {
+    while self.convs.len() > base {
+      let (val, other, len) = match self.convs.pop().unwrap() {
+        ConvTask::Vals(val, other, len) => (val, other, len),
+        ConvTask::Clos(v, w, len) => (self.apply(v, Val::Free(len), ar)?, self.apply(w, Val::Free(len), ar)?, len + 1),
+      };
+      if val.ptr_eq(&other) {
+        continue;
+      }
+      // Spines headed by solved holes are unfolded, see `Val::conv()`.
+      let (val, other) = match (val, other) {
+        (Val::App(_, _, _), _) | (_, Val::App(_, _, _)) if ar.any_meta_solved() => {
+          (val.force_spine(ar)?, other.force_spine(ar)?)
+        }
+        _ => (val, other),
+      };
+      match (val, other) {
+        // Holes are solved by unification, see `Val::conv()`.
+        (Val::Meta(_, _), _) | (_, Val::Meta(_, _)) => {
+          if !Val::conv(&val, &other, len, ar)? {
+            return Ok(false);
+          }
+        }
+        // Try comparing folded spines first, then unfold definitions one step at a time.
+        (Val::Glued(f, _), Val::Glued(g, _)) if self.conv_spine(f, g, len, ar)? => {}
+        (Val::Def(x), Val::Def(y)) => self.convs.push(ConvTask::Vals(*x, *y, len)),
+        (Val::Def(x), y) | (y, Val::Def(x)) => self.convs.push(ConvTask::Vals(*x, y, len)),
+        (Val::Glued(_, _), _) | (_, Val::Glued(_, _)) => {
+          self.convs.push(ConvTask::Vals(val.force(), other.force(), len))
+        }
+        (Val::Univ(v), Val::Univ(w)) if v == w => {}
+        (Val::Free(i), Val::Free(j)) if i == j => {}
+        // Pairs are pushed in reverse order, so that they are checked in the usual order.
+        (Val::Pi(t, v), Val::Pi(u, w)) => {
+          self.convs.push(ConvTask::Clos(v, w, len));
+          self.convs.push(ConvTask::Vals(*t, *u, len));
+        }
+        (Val::Fun(b), Val::Fun(c)) => self.convs.push(ConvTask::Clos(b, c, len)),
+        (Val::App(f, x, _), Val::App(g, y, _)) => {
+          self.convs.push(ConvTask::Vals(*x, *y, len));
+          self.convs.push(ConvTask::Vals(*f, *g, len));
+        }
+        (Val::Sig(us), Val::Sig(vs)) if us.len() == vs.len() => {
+          if us.iter().zip(vs.iter()).any(|((i, _), (j, _))| i.name != j.name) {
+            return Ok(false);
+          }
+          for ((_, u), (_, v)) in us.iter().zip(vs.iter()).rev() {
+            self.convs.push(ConvTask::Clos(u, v, len));
+          }
+        }
+        (Val::Tup(bs), Val::Tup(cs)) if bs.len() == cs.len() => {
+          if bs.iter().zip(cs.iter()).any(|((i, _), (j, _))| i.name != j.name) {
+            return Ok(false);
+          }
+          for ((_, b), (_, c)) in bs.iter().zip(cs.iter()).rev() {
+            self.convs.push(ConvTask::Vals(*b, *c, len));
+          }
+        }
+        (Val::Init(n, x), Val::Init(m, y)) | (Val::Proj(n, x), Val::Proj(m, y)) if n == m => {
+          self.convs.push(ConvTask::Vals(*x, *y, len))
+        }
+        _ => return Ok(false),
+      }
+    }
+    Ok(true)
+  }
+
+  /// See [`Val::conv`]. Walks both folded spines, then checks all argument pairs.
+  fn conv_spine(
+    &mut self,
+    val: &Val<'a, 'b>,
+    other: &Val<'a, 'b>,
+    len: usize,
+    ar: &'a Arena,
+  ) -> Result<bool, EvalError<'a, 'b>> {
+    let base = self.convs.len();
+    let (mut f, mut g) = (val, other);
+    let heads = loop {
+      match (f, g) {
+        (Val::Def(x), Val::Def(y)) => break ptr::eq(*x, *y),
+        (Val::App(f_prev, x, _), Val::App(g_prev, y, _)) => {
+          self.convs.push(ConvTask::Vals(**x, **y, len));
+          (f, g) = (f_prev, g_prev);
+        }
+        _ => break false,
+      }
+    };
+    let res = if heads { self.run_conv(base, ar) } else { Ok(false) };
+    self.convs.truncate(base);
+    res
+  }
+}
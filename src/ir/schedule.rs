@@ -0,0 +1,194 @@
+use std::any::Any;
+use std::cmp::Reverse;
+use std::collections::BinaryHeap;
+use std::panic::{catch_unwind, resume_unwind, AssertUnwindSafe};
+use std::slice::from_raw_parts;
+use std::sync::{Condvar, Mutex};
+use std::thread::{scope, Builder};
+
+use crate::arena::Arena;
+use crate::ir::{Decoration, Field, Term, Val};
+
+/// Minimum number of preterm nodes per worker thread, below which spawning it costs more than
+/// checking its fields on the calling thread.
+const PARALLEL_MIN_NODES: usize = 32;
+
+/// Stack size of worker threads, as for the main thread of most platforms.
+const WORKER_STACK_SIZE: usize = 8 * 1024 * 1024;
+
+/// Maximum nesting depth of preterms checked on worker threads, so that checking them recursively
+/// fits in [`WORKER_STACK_SIZE`]. Deeper fields are left to the calling thread.
+const WORKER_MAX_DEPTH: usize = 256;
+
+/// # Parallel checking of tuple fields
+///
+/// Schedules the fields of a tuple constructor on worker threads (see [`Arena::set_threads`]), each
+/// allocating in its own [`Arena::worker`]. A field is checked as soon as the earlier fields it
+/// mentions, directly or through its type, have been checked: they are passed in with their
+/// values, and the other earlier fields are replaced by a placeholder. The field never observes
+/// the placeholder, since the types of the fields it mentions only mention fields checked before
+/// them, so the results are the same as when checking in order.
+///
+/// Fields which are not eligible (e.g. because they contain holes), depend on one which is not, or
+/// whose check fails, are skipped and have to be checked by the caller.
+#[derive(Debug, Default)]
+pub(crate) struct Schedule {
+  deps: Vec<Option<Vec<usize>>>,
+  nodes: usize,
+  eligible: usize,
+}
+
+/// Shared state of the workers of [`Schedule::run`].
+struct State<'w, 'b, X, E> {
+  ready: BinaryHeap<Reverse<usize>>,
+  pending: Vec<usize>,
+  running: usize,
+  complete: usize,
+  vals: Vec<Option<Val<'w, 'b>>>,
+  res: Vec<Option<Result<(X, Val<'w, 'b>), E>>>,
+  panic: Option<Box<dyn Any + Send>>,
+}
+
+/// The fields of a tuple constructor, shared by all workers. Only the fields after its longest
+/// checked prefix are written, which no worker borrows.
+struct Prefix<'w, 'b>(*mut (&'b Field<'b>, Val<'w, 'b>));
+
+// SAFETY: fields are only written while holding the lock of the `State`, and only read after they
+// are written, by workers which take the lock after that.
+unsafe impl Send for Prefix<'_, '_> {}
+unsafe impl Sync for Prefix<'_, '_> {}
+
+impl Schedule {
+  /// Creates a schedule without fields.
+  pub fn new() -> Self {
+    Self::default()
+  }
+
+  /// Adds the next field with preterm `term`, which mentions the earlier fields in `mentioned`
+  /// (directly or through its type, possibly repeated), or is not eligible for parallel checking
+  /// if [`None`].
+  pub fn push<T: Decoration>(&mut self, term: &Term<'_, '_, T>, mentioned: Option<Vec<usize>>) {
+    let (nodes, depth) = term.extent();
+    let deps = mentioned.filter(|_| depth <= WORKER_MAX_DEPTH).and_then(|mut deps| {
+      deps.sort_unstable();
+      deps.dedup();
+      deps.iter().all(|&j| self.deps[j].is_some()).then_some(deps)
+    });
+    if deps.is_some() {
+      self.nodes += nodes;
+      self.eligible += 1;
+    }
+    self.deps.push(deps);
+  }
+
+  /// Returns the number of worker threads worth using for the fields in `ar`, or 0 if the fields
+  /// are better checked in order. Holes solved on different threads could conflict, so checking
+  /// is sequential while some are unsolved.
+  pub fn workers(&self, ar: &Arena) -> usize {
+    let n = ar.threads().min(self.eligible).min(self.nodes / PARALLEL_MIN_NODES);
+    if n < 2 || ar.unsolved_meta_count() > 0 {
+      0
+    } else {
+      n
+    }
+  }
+
+  /// Checks the eligible fields on one thread per worker arena. `prefix` holds the information of
+  /// every field along with the placeholder value, and `check` is called with the index of a field
+  /// and the tuple of the earlier fields, returning the result and the value of the field. Returns
+  /// results by field index, allocated in the workers. A panic in `check` is resumed once all
+  /// workers have stopped.
+  pub fn run<'w, 'b, X: Send, E: Send>(
+    &self,
+    prefix: &'w mut [(&'b Field<'b>, Val<'w, 'b>)],
+    workers: &'w mut [Arena],
+    check: impl Fn(usize, Val<'w, 'b>, &'w Arena) -> Result<(X, Val<'w, 'b>), E> + Sync,
+  ) -> Vec<Option<Result<(X, Val<'w, 'b>), E>>> {
+    let len = self.deps.len();
+    let mut dependents = vec![Vec::new(); len];
+    for (i, deps) in self.deps.iter().enumerate() {
+      deps.iter().flatten().for_each(|&j| dependents[j].push(i));
+    }
+    let state = State {
+      ready: (0..len).filter(|&i| self.deps[i].as_ref().is_some_and(Vec::is_empty)).map(Reverse).collect(),
+      pending: self.deps.iter().map(|deps| deps.as_ref().map_or(0, Vec::len)).collect(),
+      running: 0,
+      complete: 0,
+      vals: vec![None; len],
+      res: (0..len).map(|_| None).collect(),
+      panic: None,
+    };
+    let (state, wake) = (Mutex::new(state), Condvar::new());
+    let fields = prefix.to_vec();
+    let shared = Prefix(prefix.as_mut_ptr());
+    let worker = |w: &'w mut Arena| {
+      let (w, shared): (&'w Arena, _) = (w, &shared);
+      // Fields mentioning no earlier field only see placeholders.
+      let placeholders = w.values(len);
+      placeholders.copy_from_slice(&fields);
+      let mut st = state.lock().unwrap();
+      while st.panic.is_none() {
+        let Some(Reverse(i)) = st.ready.pop() else {
+          if st.running == 0 {
+            break;
+          }
+          st = wake.wait(st).unwrap();
+          continue;
+        };
+        let a_val = if self.deps[i].as_ref().is_some_and(Vec::is_empty) {
+          Val::Tup(&placeholders[..i])
+        } else if i <= st.complete {
+          // SAFETY: the checked prefix `[..st.complete]` is no longer modified.
+          Val::Tup(unsafe { from_raw_parts(shared.0, i) })
+        } else {
+          let copy = w.values(i);
+          copy.iter_mut().enumerate().for_each(|(j, b)| *b = (fields[j].0, st.vals[j].unwrap_or(fields[j].1)));
+          Val::Tup(copy)
+        };
+        st.running += 1;
+        drop(st);
+        let res = catch_unwind(AssertUnwindSafe(|| check(i, a_val, w)));
+        st = state.lock().unwrap();
+        st.running -= 1;
+        match res {
+          Ok(res) => {
+            if let Ok((_, b_val)) = &res {
+              st.vals[i] = Some(*b_val);
+              for &d in &dependents[i] {
+                st.pending[d] -= 1;
+                if st.pending[d] == 0 {
+                  st.ready.push(Reverse(d));
+                }
+              }
+              while let Some(Some(b_val)) = st.vals.get(st.complete).copied() {
+                // SAFETY: `st.complete < len`, and no worker borrows fields after the checked prefix.
+                unsafe { *shared.0.add(st.complete) = (fields[st.complete].0, b_val) };
+                st.complete += 1;
+              }
+            }
+            st.res[i] = Some(res);
+          }
+          Err(e) => st.panic = Some(e),
+        }
+        wake.notify_all();
+      }
+    };
+    scope(|s| {
+      let worker = &worker;
+      let handles = workers.iter_mut().map(|w| {
+        Builder::new()
+          .stack_size(WORKER_STACK_SIZE)
+          .spawn_scoped(s, move || worker(w))
+          .expect("failed to spawn worker thread")
+      });
+      for handle in handles.collect::<Vec<_>>() {
+        handle.join().unwrap_or_else(|e| resume_unwind(e));
+      }
+    });
+    let state = state.into_inner().unwrap();
+    if let Some(e) = state.panic {
+      resume_unwind(e);
+    }
+    state.res
+  }
+}
@@ -1,15 +1,43 @@
-use std::cmp::max;
 use std::fmt::Debug;
+use std::hash::{Hash, Hasher};
+use std::marker::PhantomData;
+use std::ptr;
 use std::slice::from_raw_parts;
 
 use super::*;
 use crate::arena::{Arena, Relocate};
+use crate::common::{self, Calculus, Frames, TermView, ValView};
+use crate::profile::Op;
 
 /// # Variable and field names
 ///
-/// This is simply a wrapper around a string reference.
-#[derive(Debug, Clone, Copy, PartialEq, Eq, PartialOrd, Ord, Hash)]
-pub struct Name<'a>(pub &'a str);
+/// An interned string reference. All names are created by [`Name::new`], which stores each
+/// distinct string once in the symbol table of an arena (see [`Arena::symbol`]), so names compare
+/// and hash by address in constant time. The empty name may be stored at several addresses, so it
+/// is recognised by its length instead.
+///
+/// Names interned in different arenas are never equal, so all names compared with each other must
+/// come from the same arena or its regions and workers, which share its table.
+#[derive(Debug, Clone, Copy, PartialOrd, Ord)]
+pub struct Name<'a>(&'a str);
+
+impl PartialEq for Name<'_> {
+  fn eq(&self, other: &Self) -> bool {
+    let (Self(x), Self(y)) = (self, other);
+    let eq = x.len() == y.len() && (x.is_empty() || ptr::eq(x.as_ptr(), y.as_ptr()));
+    debug_assert!(eq || x != y, "name {x} interned in unrelated arenas");
+    eq
+  }
+}
+
+impl Eq for Name<'_> {}
+
+impl Hash for Name<'_> {
+  fn hash<H: Hasher>(&self, state: &mut H) {
+    let Self(name) = self;
+    if name.is_empty() { 0 } else { name.as_ptr() as usize }.hash(state)
+  }
+}
 
 /// # Binder information
 ///
@@ -31,10 +59,11 @@ pub struct Field<'b> {
 
 /// # Term decorations
 ///
-/// Specifies decorations to the base [`Term`].
-pub trait Decoration: Debug + Clone + Copy {
-  type NamedVar<'b>: Debug + Clone + Copy;
-  type NamedProj<'b>: Debug + Clone + Copy;
+/// Specifies decorations to the base [`Term`]. To preserve covariance of [`Term`] w.r.t. `'b`, these
+/// cannot depend on lifetimes.
+pub trait Decoration: Debug + Clone + Copy + 'static {
+  type NamedVar: Debug + Clone + Copy;
+  type NamedProj: Debug + Clone + Copy;
 }
 
 /// # Core term decoration
@@ -50,13 +79,13 @@ pub struct Core;
 pub struct Named;
 
 impl Decoration for Core {
-  type NamedVar<'b> = !;
-  type NamedProj<'b> = !;
+  type NamedVar = !;
+  type NamedProj = !;
 }
 
 impl Decoration for Named {
-  type NamedVar<'b> = ();
-  type NamedProj<'b> = ();
+  type NamedVar = ();
+  type NamedProj = ();
 }
 
 /// # Terms
@@ -93,9 +122,23 @@ pub enum Term<'a, 'b, T: Decoration> {
   /// Holes in unique identifiers.
   Meta(usize),
   /// Named variables.
-  NamedVar(Name<'b>, T::NamedVar<'b>),
+  NamedVar(Name<'b>, T::NamedVar),
   /// Named projections. To preserve covariance w.r.t. `'a`, this has to be hard-coded.
-  NamedProj(Name<'b>, &'a Self, T::NamedProj<'b>),
+  NamedProj(Name<'b>, &'a Self, T::NamedProj),
+  /// References to global definitions.
+  Const(&'b Global<'b>),
+}
+
+/// # Global definitions
+///
+/// Checked top-level definitions, referred to by [`Term::Const`]. They are allocated with lifetime
+/// `'b` (i.e. alongside binder information), so that they outlive the arenas of later queries.
+#[derive(Debug)]
+pub struct Global<'b> {
+  pub info: &'b Bound<'b>,
+  pub term: &'b Term<'b, 'b, Core>,
+  pub ty: Val<'b, 'b>,
+  pub val: Val<'b, 'b>,
 }
 
 /// # Values
@@ -103,6 +146,12 @@ pub enum Term<'a, 'b, T: Decoration> {
 /// Values are terms whose outermost `let`s are already collected and frozen at binders.
 ///
 /// Can be understood as "runtime objects" produced by the evaluator.
+///
+/// If enabled by [`Arena::set_gluing`], references to `let`-bound definitions are glued: they keep
+/// a folded form (the definition itself, applied to some arguments) alongside the unfolded form,
+/// so that [`Val::conv`] can compare definitions by identity before resorting to unfolding.
+///
+/// - See: <https://github.com/AndrasKovacs/smalltt> (glued evaluation)
 #[derive(Debug, Clone, Copy)]
 pub enum Val<'a, 'b> {
   /// Universe in levels.
@@ -123,6 +172,10 @@ pub enum Val<'a, 'b> {
   Init(usize, &'a Self),
   /// Tuple projections (index, tuple).
   Proj(usize, &'a Self),
+  /// References to `let`-bound definitions (value).
+  Def(&'a Self),
+  /// Applications headed by definitions (folded spine, unfolded value).
+  Glued(&'a Self, &'a Self),
   /// Holes (environment, id).
   Meta(&'a Stack<'a, 'b>, usize),
 }
@@ -144,14 +197,53 @@ pub struct Clos<'a, 'b> {
 ///
 /// The baseline implementation of evaluation environments. Cheap to append and clone, but random
 /// access takes linear time. This is acceptable if most of the context is wrapped inside tuples,
-/// which have constant-time random access.
+/// which have constant-time random access. Each frame caches its depth, so the length is always
+/// available in constant time.
+///
+/// With the `skew_stack` feature, each frame additionally stores a jump pointer arranged in
+/// skew-binary fashion, so random access takes logarithmic time while appending stays
+/// constant-time and fully shared. Both lookups and jump pointers are implemented once for the
+/// kernel and the ir, see [`common::Frames`].
+///
+/// Contexts built by the elaborator also carry an [`Index`] of the fields of transparent binders,
+/// so that resolving named variables does not need to scan those fields. Frames created by
+/// [`Stack::cons`] have none, and lookups fall back to scanning fields of all binders.
+///
+/// - See: <https://doi.org/10.1016/0020-0190(83)90106-0> (Myers' applicative random-access stack)
 #[derive(Debug, Clone)]
 pub enum Stack<'a, 'b> {
   Nil,
-  Cons { prev: &'a Self, info: &'b Bound<'b>, value: Val<'a, 'b> },
+  Cons {
+    prev: &'a Self,
+    info: &'b Bound<'b>,
+    value: Val<'a, 'b>,
+    len: usize,
+    index: Option<&'a Index<'a, 'b>>,
+    #[cfg(feature = "skew_stack")]
+    jump: &'a Self,
+  },
+}
+
+impl Name<'static> {
+  /// The empty name (i.e. transparent).
+  pub const EMPTY: Self = Self("");
 }
 
-impl Name<'_> {
+impl<'a> Name<'a> {
+  /// Returns the name with given contents interned in the given arena, storing it on first use.
+  pub fn new(name: &str, ar: &'a Arena) -> Self {
+    match name.is_empty() {
+      true => Name::EMPTY,
+      false => Self(ar.symbol(name)),
+    }
+  }
+
+  /// Returns the contents of the name.
+  pub fn as_str(&self) -> &'a str {
+    let Self(name) = self;
+    name
+  }
+
   /// Returns if the name is empty (i.e. transparent).
   pub fn is_empty(&self) -> bool {
     let Self(name) = self;
@@ -162,7 +254,7 @@ impl Name<'_> {
 impl<'b> Bound<'b> {
   /// Creates a new bound variable info with empty name (i.e. transparent).
   pub fn empty() -> &'b Self {
-    &Self { name: Name(""), attrs: &[] }
+    &Self { name: Name::EMPTY, attrs: &[] }
   }
 
   /// Creates a new bound variable info in the given arena.
@@ -174,7 +266,7 @@ impl<'b> Bound<'b> {
 impl<'b> Field<'b> {
   /// Creates a new field variable info with empty name (for writing).
   pub fn empty() -> &'b Self {
-    &Self { name: Name(""), attrs: &[] }
+    &Self { name: Name::EMPTY, attrs: &[] }
   }
 
   /// Creates a new field variable info in the given arena.
@@ -189,119 +281,429 @@ impl<'a, 'b> Stack<'a, 'b> {
     Stack::Nil
   }
 
+  /// Creates a new frame on top of `prev`. This does not allocate.
+  #[cfg(not(feature = "skew_stack"))]
+  pub fn cons(prev: &'a Self, info: &'b Bound<'b>, value: Val<'a, 'b>) -> Self {
+    Stack::Cons { prev, info, value, len: prev.len() + 1, index: None }
+  }
+
+  /// Creates a new frame on top of `prev`. This does not allocate. See [`common::jump`] for the
+  /// jump pointer.
+  #[cfg(feature = "skew_stack")]
+  pub fn cons(prev: &'a Self, info: &'b Bound<'b>, value: Val<'a, 'b>) -> Self {
+    Stack::Cons { prev, info, value, len: prev.len() + 1, index: None, jump: common::jump(prev) }
+  }
+
   /// Returns if the stack is empty.
   pub fn is_empty(&self) -> bool {
     match self {
       Stack::Nil => true,
-      Stack::Cons { prev: _, info: _, value: _ } => false,
+      Stack::Cons { .. } => false,
     }
   }
 
   /// Returns the length of the stack.
   pub fn len(&self) -> usize {
-    let mut curr = self;
-    let mut len = 0;
-    while let Stack::Cons { prev, info: _, value: _ } = curr {
-      len += 1;
-      curr = prev;
+    match self {
+      Stack::Nil => 0,
+      Stack::Cons { len, .. } => *len,
     }
-    len
   }
 
   /// Returns the value at the given de Bruijn index, if it exists.
   pub fn get(&self, ix: usize, ar: &'a Arena) -> Option<(Bound<'b>, Val<'a, 'b>)> {
-    let mut curr = self;
-    let mut ix = ix;
     ar.inc_lookup_count();
-    while let Stack::Cons { prev, info, value } = curr {
-      ar.inc_link_count();
-      if ix == 0 {
-        return Some((**info, *value));
-      }
-      ix -= 1;
-      curr = prev;
+    match common::find(self, ix, || ar.inc_link_count())? {
+      Stack::Cons { info, value, .. } => Some((**info, *value)),
+      Stack::Nil => None,
     }
-    None
+  }
+
+  /// Returns the values in the stack from the top, i.e. in order of de Bruijn indices.
+  pub fn values(&self) -> impl Iterator<Item = Val<'a, 'b>> + '_ {
+    let mut curr = self;
+    std::iter::from_fn(move || match curr {
+      Stack::Nil => None,
+      Stack::Cons { prev, value, .. } => {
+        curr = prev;
+        Some(*value)
+      }
+    })
   }
 
   /// Extends the stack with a new value.
   pub fn extend(&self, info: &'b Bound<'b>, value: Val<'a, 'b>, ar: &'a Arena) -> Self {
-    Stack::Cons { prev: ar.frame(self.clone()), info, value }
+    Stack::cons(ar.frame(self.clone()), info, value)
+  }
+}
+
+impl<'a, 'b> Frames for Stack<'a, 'b> {
+  fn prev(&self) -> Option<&Self> {
+    match self {
+      Stack::Nil => None,
+      Stack::Cons { prev, .. } => Some(prev),
+    }
+  }
+
+  fn depth(&self) -> usize {
+    self.len()
+  }
+
+  #[cfg(feature = "skew_stack")]
+  fn jump(&self) -> &Self {
+    match self {
+      Stack::Nil => self,
+      Stack::Cons { jump, .. } => jump,
+    }
+  }
+}
+
+/// # Ir calculus
+///
+/// Core terms of the ir as seen by the shared evaluator, see [`Calculus`]. Beyond the common
+/// fragment, terms include holes and references to global definitions, and values include
+/// definitions, glued spines and holes.
+#[derive(Debug, Clone, Copy)]
+struct Ir<'b>(PhantomData<&'b ()>);
+
+impl<'a, 'b: 'a> Calculus<'a> for Ir<'b> {
+  type Term = Term<'a, 'b, Core>;
+  type Val = Val<'a, 'b>;
+  type Clos = Clos<'a, 'b>;
+  type Stack = Stack<'a, 'b>;
+  type Arena = Arena;
+  type Error = EvalError<'a, 'b>;
+  type Bound = &'b Bound<'b>;
+  type Field = &'b Field<'b>;
+  type Dot = bool;
+  type Entry<X: 'a> = (&'b Field<'b>, X);
+  type Args = (&'a Val<'a, 'b>, bool);
+  type TermExt = Term<'a, 'b, Core>;
+  type ValExt = Val<'a, 'b>;
+
+  #[inline]
+  fn view(x: &Term<'a, 'b, Core>) -> TermView<'a, Self> {
+    match *x {
+      Term::Gc(x) => TermView::Gc(x),
+      Term::Univ(v) => TermView::Univ(v),
+      Term::Var(ix) => TermView::Var(ix),
+      Term::Ann(x, t) => TermView::Ann(x, t),
+      Term::Let(i, v, x) => TermView::Let(i, v, x),
+      Term::Pi(i, t, u) => TermView::Pi(i, t, u),
+      Term::Fun(i, b) => TermView::Fun(i, b),
+      Term::App(f, x, dot) => TermView::App(f, x, dot),
+      Term::Sig(us) => TermView::Sig(us),
+      Term::Tup(bs) => TermView::Tup(bs),
+      Term::Init(n, x) => TermView::Init(n, x),
+      Term::Proj(n, x) => TermView::Proj(n, x),
+      Term::Meta(_) | Term::Const(_) => TermView::Ext(*x),
+    }
+  }
+
+  #[inline]
+  fn make(x: TermView<'a, Self>) -> Term<'a, 'b, Core> {
+    match x {
+      TermView::Gc(x) => Term::Gc(x),
+      TermView::Univ(v) => Term::Univ(v),
+      TermView::Var(ix) => Term::Var(ix),
+      TermView::Ann(x, t) => Term::Ann(x, t),
+      TermView::Let(i, v, x) => Term::Let(i, v, x),
+      TermView::Pi(i, t, u) => Term::Pi(i, t, u),
+      TermView::Fun(i, b) => Term::Fun(i, b),
+      TermView::App(f, x, dot) => Term::App(f, x, dot),
+      TermView::Sig(us) => Term::Sig(us),
+      TermView::Tup(bs) => Term::Tup(bs),
+      TermView::Init(n, x) => Term::Init(n, x),
+      TermView::Proj(n, x) => Term::Proj(n, x),
+      TermView::Ext(x) => x,
+    }
+  }
+
+  #[inline]
+  fn view_val(v: &Val<'a, 'b>) -> ValView<'a, Self> {
+    match *v {
+      Val::Univ(v) => ValView::Univ(v),
+      Val::Free(i) => ValView::Free(i),
+      Val::Pi(t, u) => ValView::Pi(t, u),
+      Val::Fun(b) => ValView::Fun(b),
+      Val::App(f, x, dot) => ValView::App(f, (x, dot)),
+      Val::Sig(us) => ValView::Sig(us),
+      Val::Tup(bs) => ValView::Tup(bs),
+      Val::Init(n, x) => ValView::Init(n, x),
+      Val::Proj(n, x) => ValView::Proj(n, x),
+      Val::Def(_) | Val::Glued(..) | Val::Meta(..) => ValView::Ext(*v),
+    }
+  }
+
+  #[inline]
+  fn make_val(v: ValView<'a, Self>) -> Val<'a, 'b> {
+    match v {
+      ValView::Univ(v) => Val::Univ(v),
+      ValView::Free(i) => Val::Free(i),
+      ValView::Pi(t, u) => Val::Pi(t, u),
+      ValView::Fun(b) => Val::Fun(b),
+      ValView::App(f, (x, dot)) => Val::App(f, x, dot),
+      ValView::Sig(us) => Val::Sig(us),
+      ValView::Tup(bs) => Val::Tup(bs),
+      ValView::Init(n, x) => Val::Init(n, x),
+      ValView::Proj(n, x) => Val::Proj(n, x),
+      ValView::Ext(v) => v,
+    }
+  }
+
+  #[inline]
+  fn entry<X: 'a>(info: &'b Field<'b>, x: X) -> (&'b Field<'b>, X) {
+    (info, x)
+  }
+
+  #[inline]
+  fn split<'e, X: 'a>(e: &'e (&'b Field<'b>, X)) -> (&'b Field<'b>, &'e X) {
+    (e.0, &e.1)
+  }
+
+  #[inline]
+  fn field_eq(i: &'b Field<'b>, j: &'b Field<'b>) -> bool {
+    i.name == j.name
+  }
+
+  #[inline]
+  fn args((x, dot): (&'a Val<'a, 'b>, bool)) -> impl ExactSizeIterator<Item = (&'a Val<'a, 'b>, bool)> {
+    std::iter::once((x, dot))
+  }
+
+  #[inline]
+  fn empty() -> &'b Bound<'b> {
+    Bound::empty()
+  }
+
+  #[inline]
+  fn clos(info: &'b Bound<'b>, env: Stack<'a, 'b>, body: &'a Term<'a, 'b, Core>) -> Clos<'a, 'b> {
+    Clos { info, env, body }
+  }
+
+  #[inline]
+  fn open(c: &'a Clos<'a, 'b>) -> (&'b Bound<'b>, &'a Stack<'a, 'b>, &'a Term<'a, 'b, Core>) {
+    (c.info, &c.env, c.body)
+  }
+
+  #[inline]
+  fn len(env: &Stack<'a, 'b>) -> usize {
+    env.len()
+  }
+
+  #[inline]
+  fn get(env: &Stack<'a, 'b>, ix: usize, ar: &'a Arena) -> Option<Val<'a, 'b>> {
+    env.get(ix, ar).map(|(_, v)| v)
+  }
+
+  #[inline]
+  fn cons(prev: &'a Stack<'a, 'b>, info: &'b Bound<'b>, v: Val<'a, 'b>) -> Stack<'a, 'b> {
+    Stack::cons(prev, info, v)
+  }
+
+  #[inline]
+  fn extend(env: &Stack<'a, 'b>, info: &'b Bound<'b>, v: Val<'a, 'b>, ar: &'a Arena) -> Stack<'a, 'b> {
+    env.extend(info, v, ar)
+  }
+
+  #[inline]
+  fn term(ar: &'a Arena, x: Term<'a, 'b, Core>) -> &'a Term<'a, 'b, Core> {
+    ar.term(x)
+  }
+
+  #[inline]
+  fn terms(ar: &'a Arena, len: usize) -> &'a mut [(&'b Field<'b>, Term<'a, 'b, Core>)] {
+    ar.terms(len)
+  }
+
+  #[inline]
+  fn val(ar: &'a Arena, v: Val<'a, 'b>) -> &'a Val<'a, 'b> {
+    ar.val(v)
+  }
+
+  #[inline]
+  fn values(ar: &'a Arena, len: usize) -> &'a mut [(&'b Field<'b>, Val<'a, 'b>)] {
+    ar.values(len)
+  }
+
+  #[inline]
+  fn closure(ar: &'a Arena, c: Clos<'a, 'b>) -> &'a Clos<'a, 'b> {
+    ar.clos(c)
+  }
+
+  #[inline]
+  fn closures(ar: &'a Arena, len: usize) -> &'a mut [(&'b Field<'b>, Clos<'a, 'b>)] {
+    ar.closures(len)
+  }
+
+  #[inline]
+  fn beta(ar: &'a Arena) -> Result<(), EvalError<'a, 'b>> {
+    beta(ar)
+  }
+
+  #[inline]
+  fn within_byte_limit(ar: &'a Arena) -> Result<(), EvalError<'a, 'b>> {
+    within_byte_limit(ar)
+  }
+
+  fn env_index(ix: usize, len: usize) -> EvalError<'a, 'b> {
+    EvalError::env_index(ix, len)
+  }
+
+  fn gen_level(lvl: usize, len: usize) -> EvalError<'a, 'b> {
+    EvalError::gen_level(lvl, len)
+  }
+
+  fn tup_init(n: usize, v: Val<'a, 'b>, env: &Stack<'a, 'b>, ar: &'a Arena) -> EvalError<'a, 'b> {
+    EvalError::tup_init(n, v, env, ar)
+  }
+
+  fn tup_proj(n: usize, v: Val<'a, 'b>, env: &Stack<'a, 'b>, ar: &'a Arena) -> EvalError<'a, 'b> {
+    EvalError::tup_proj(n, v, env, ar)
+  }
+
+  /// Definitions remain glued to their references.
+  #[inline]
+  fn define(v: Val<'a, 'b>, ar: &'a Arena) -> Val<'a, 'b> {
+    v.define(ar)
+  }
+
+  #[inline]
+  fn force(v: Val<'a, 'b>) -> Val<'a, 'b> {
+    v.force()
+  }
+
+  #[inline]
+  fn profile_eval(x: &Term<'a, 'b, Core>, ar: &'a Arena) {
+    ar.profile_rule(Op::Eval, || x.variant());
+  }
+
+  #[inline]
+  fn profile_conv(v: &Val<'a, 'b>, ar: &'a Arena) {
+    ar.profile_rule(Op::Conv, || v.variant());
+  }
+
+  fn eval_gc(x: &'a Term<'a, 'b, Core>, env: &Stack<'a, 'b>, ar: &'a Arena) -> Result<Val<'a, 'b>, EvalError<'a, 'b>> {
+    let temp = ar.region();
+    let res = x.eval(env, &temp);
+    ar.copy_in(|| res.map(|v| v.relocate(ar)).map_err(|e| e.relocate(ar)))
+  }
+
+  fn eval_ext(x: Term<'a, 'b, Core>, env: &Stack<'a, 'b>, ar: &'a Arena) -> Result<Val<'a, 'b>, EvalError<'a, 'b>> {
+    match x {
+      // Solved holes are replaced by their solutions.
+      // For unsolved holes, we freeze the whole environment around it, which becomes the
+      // substitution applied to its solution.
+      // SAFETY: holes in `ar` are created and read with the same `'b`, see `Arena::meta_type()`.
+      Term::Meta(m) => match unsafe { ar.meta_solution(m) } {
+        Some(x) => x.eval(env, ar),
+        None => Ok(Val::Meta(ar.frame(env.clone()), m)),
+      },
+      // Global definitions are already evaluated.
+      Term::Const(g) => Ok(g.value(ar)),
+      x => unreachable!("{} is in the common fragment", x.variant()),
+    }
+  }
+
+  /// The remaining arguments are applied one at a time, so that definitions at the head are glued
+  /// to the applications, see [`Val::app`].
+  #[inline]
+  fn app(
+    f: Val<'a, 'b>,
+    n: usize,
+    mut arg: impl FnMut(usize) -> Result<(Val<'a, 'b>, bool), EvalError<'a, 'b>>,
+    ar: &'a Arena,
+  ) -> Result<Val<'a, 'b>, EvalError<'a, 'b>> {
+    let mut f = f;
+    for j in 0..n {
+      let (x, dot) = arg(j)?;
+      f = f.app(x, dot, ar)?;
+    }
+    Ok(f)
+  }
+
+  /// Reuses the result of an earlier call on the same value if enabled by
+  /// [`Arena::set_memoising`].
+  #[inline]
+  fn quote_ref(v: &'a Val<'a, 'b>, len: usize, ar: &'a Arena) -> Result<&'a Term<'a, 'b, Core>, EvalError<'a, 'b>> {
+    if let Some(term) = ar.quoted(v, len) {
+      return Ok(term);
+    }
+    Ok(ar.memo_quoted(v, len, v.quote(len, ar)?))
+  }
+
+  fn quote_ext(v: Val<'a, 'b>, len: usize, ar: &'a Arena) -> Result<Term<'a, 'b, Core>, EvalError<'a, 'b>> {
+    match v {
+      Val::Def(x) | Val::Glued(_, x) => x.quote(len, ar),
+      // SAFETY: as in `Term::eval()`.
+      Val::Meta(env, m) => match unsafe { ar.meta_solution(m) } {
+        Some(x) => x.eval(env, ar)?.quote(len, ar),
+        None => {
+          let vals = env.values().take(ar.meta_scope(m).unwrap_or(0)).collect::<Vec<_>>();
+          if Val::is_identity(&vals, |i| len.checked_sub(i + 1)) {
+            return Ok(Term::Meta(m));
+          }
+          let mut terms = Vec::with_capacity(vals.len());
+          for (k, val) in vals.iter().rev().enumerate() {
+            terms.push(val.quote(len + k, ar)?);
+          }
+          Ok(Term::let_meta(m, terms, ar))
+        }
+      },
+      v => unreachable!("{} is in the common fragment", v.variant()),
+    }
+  }
+
+  #[inline]
+  fn ptr_eq(x: &Val<'a, 'b>, y: &Val<'a, 'b>) -> bool {
+    x.ptr_eq(y)
+  }
+
+  /// Holes are unified, see [`Val::conv_meta`]. Folded spines are compared first, then definitions
+  /// are unfolded one step at a time, so that folded spines exposed by unfolding also get a chance
+  /// to be compared.
+  fn conv_ext(x: &Val<'a, 'b>, y: &Val<'a, 'b>, len: usize, ar: &'a Arena) -> Result<Option<bool>, EvalError<'a, 'b>> {
+    if let (Val::Meta(_, _), _) | (_, Val::Meta(_, _)) = (x, y) {
+      return Ok(Some(Val::conv_meta(x, y, len, ar)?));
+    }
+    // Spines headed by solved holes are unfolded, so that they can be compared with the others.
+    if let ((Val::App(_, _, _), _) | (_, Val::App(_, _, _)), true) = ((x, y), ar.any_meta_solved()) {
+      let (u, v) = (x.force_spine(ar)?, y.force_spine(ar)?);
+      if !u.ptr_eq(x) || !v.ptr_eq(y) {
+        return Ok(Some(Val::conv_rec(&u, &v, len, ar)?));
+      }
+    }
+    match (x, y) {
+      (Val::Glued(f, _), Val::Glued(g, _)) if f.conv_spine(g, len, ar)? => Ok(Some(true)),
+      (Val::Def(u), Val::Def(v)) => Ok(Some(Val::conv_rec(u, v, len, ar)?)),
+      (Val::Def(u), v) | (v, Val::Def(u)) => Ok(Some(Val::conv_rec(u, v, len, ar)?)),
+      (Val::Glued(_, _), _) | (_, Val::Glued(_, _)) => Ok(Some(Val::conv_rec(&x.force(), &y.force(), len, ar)?)),
+      _ => Ok(None),
+    }
   }
 }
 
 impl<'a, 'b> Term<'a, 'b, Core> {
   /// Reduces `self` so that all `let`s are collected into the environment and then frozen at
-  /// binders. This is mutually recursive with [`Clos::apply`], forming an eval-apply loop.
+  /// binders. This is mutually recursive with [`Clos::apply`], forming an eval-apply loop. See
+  /// [`common::eval`] for the rules, which are shared with the kernel.
   ///
   /// Pre-conditions:
   ///
   /// - `self` is well-typed under a context and environment `env` (to ensure termination).
   pub fn eval(&self, env: &Stack<'a, 'b>, ar: &'a Arena) -> Result<Val<'a, 'b>, EvalError<'a, 'b>> {
-    match self {
-      // The garbage collection mark forces the subterm to be evaluated inside a new arena.
-      Term::Gc(x) => x.eval(env, &Arena::new()).map(|v| v.relocate(ar)).map_err(|e| e.relocate(ar)),
-      // Universes are already in normal form.
-      Term::Univ(v) => Ok(Val::Univ(*v)),
-      // The (δ) rule is always applied.
-      // Variables of values are in de Bruijn levels, so weakening is no-op.
-      Term::Var(ix) => Ok(env.get(*ix, ar).ok_or_else(|| EvalError::env_index(*ix, env.len()))?.1),
-      // The (τ) rule is always applied.
-      Term::Ann(x, _) => x.eval(env, ar),
-      // For `let`s, we reduce the value, collect it into the environment to reduce the body.
-      Term::Let(i, v, x) => x.eval(&env.extend(i, v.eval(env, ar)?, ar), ar),
-      // For binders, we freeze the whole environment and store the body as a closure.
-      Term::Pi(i, t, u) => Ok(Val::Pi(ar.val(t.eval(env, ar)?), ar.clos(Clos { info: i, env: env.clone(), body: u }))),
-      Term::Fun(i, b) => Ok(Val::Fun(ar.clos(Clos { info: i, env: env.clone(), body: b }))),
-      // For applications, we reduce both operands and combine them back.
-      // In the case of a redex, the (β) rule is applied.
-      Term::App(f, x, b) => match (f.eval(env, ar)?, x.eval(env, ar)?) {
-        (Val::Fun(b), x) => b.apply(x, ar),
-        (f, x) => Ok(Val::App(ar.val(f), ar.val(x), *b)),
-      },
-      // For binders, we freeze the whole environment and store the body as a closure.
-      Term::Sig(us) => {
-        let cs = ar.closures(us.len());
-        for (i, (info, u)) in us.iter().enumerate() {
-          cs[i] = (info, Clos { info: Bound::empty(), env: env.clone(), body: u });
-        }
-        Ok(Val::Sig(cs))
-      }
-      Term::Tup(bs) => {
-        let vs = ar.values(bs.len()).as_mut_ptr();
-        for (i, (info, b)) in bs.iter().enumerate() {
-          // SAFETY: the borrowed range `&vs[..i]` is no longer modified.
-          let a = Val::Tup(unsafe { from_raw_parts(vs, i) });
-          let b = b.eval(&env.extend(Bound::empty(), a, ar), ar)?;
-          // SAFETY: `i < bs.len()` which is the valid size of `vs`.
-          unsafe { *vs.add(i) = (info, b) };
-        }
-        // SAFETY: the borrowed slice `&vs` has valid size `bs.len()` and is no longer modified.
-        Ok(Val::Tup(unsafe { from_raw_parts(vs, bs.len()) }))
-      }
-      // For initials (i.e. iterated first projections), we reduce the operand and combine it back.
-      // In the case of a redex, the (π init) rule is applied.
-      Term::Init(n, x) => match x.eval(env, ar)? {
-        Val::Init(m, y) => Ok(Val::Init(n + m, y)),
-        Val::Tup(bs) => {
-          let m = bs.len().checked_sub(*n).ok_or_else(|| EvalError::tup_init(*n, Val::Tup(bs), env, ar))?;
-          Ok(Val::Tup(&bs[..m]))
-        }
-        x => Ok(Val::Init(*n, ar.val(x))),
-      },
-      // For projections (i.e. second projections after iterated first projections), we reduce the
-      // operand and combine it back.
-      // In the case of a redex, the (π proj) rule is applied.
-      Term::Proj(n, x) => match x.eval(env, ar)? {
-        Val::Init(m, y) => Ok(Val::Proj(n + m, y)),
-        Val::Tup(bs) => {
-          let i = bs.len().checked_sub(n + 1).ok_or_else(|| EvalError::tup_proj(*n, Val::Tup(bs), env, ar))?;
-          Ok(bs[i].1)
-        }
-        x => Ok(Val::Proj(*n, ar.val(x))),
-      },
-      // For holes, we freeze the whole environment around it.
-      Term::Meta(m) => Ok(Val::Meta(ar.frame(env.clone()), *m)),
+    common::eval::<Ir>(self, env, ar)
+  }
+}
+
+impl<'b> Global<'b> {
+  /// Returns the value of `self`. If gluing is enabled, it is wrapped as a definition whose
+  /// identity is the global itself, so that all references to it compare equal by address.
+  pub fn value<'a>(&'b self, ar: &'a Arena) -> Val<'a, 'b> {
+    match self.val {
+      Val::Univ(_) | Val::Free(_) | Val::Def(_) => self.val,
+      _ if ar.gluing() => Val::Def(&self.val),
+      _ => self.val,
     }
   }
 }
@@ -311,12 +713,114 @@ impl<'a, 'b> Clos<'a, 'b> {
   /// empty environment populated with all `let`s. This is mutually recursive with [`Term::eval`],
   /// forming an eval-apply loop.
   pub fn apply(&'a self, x: Val<'a, 'b>, ar: &'a Arena) -> Result<Val<'a, 'b>, EvalError<'a, 'b>> {
-    let Self { env, info, body } = self;
-    body.eval(&Stack::Cons { prev: env, info, value: x }, ar)
+    common::apply::<Ir>(self, x, ar)
+  }
+}
+
+/// Records a (β) step in `ar`, failing if its fuel is exhausted or it is over its byte limit. See
+/// [`Arena::set_fuel`] and [`Arena::set_byte_limit`].
+pub(super) fn beta<'a, 'b>(ar: &'a Arena) -> Result<(), EvalError<'a, 'b>> {
+  within_byte_limit(ar)?;
+  match ar.step() {
+    true => Ok(()),
+    false => Err(EvalError::out_of_fuel()),
+  }
+}
+
+/// Checks the byte limit of `ar`, before each (β) step and each value quoted. See
+/// [`Arena::set_byte_limit`].
+pub(super) fn within_byte_limit<'a, 'b>(ar: &'a Arena) -> Result<(), EvalError<'a, 'b>> {
+  match ar.over_byte_limit() {
+    false => Ok(()),
+    true => Err(EvalError::out_of_memory(ar.byte_limit().unwrap_or(0))),
   }
 }
 
 impl<'a, 'b> Val<'a, 'b> {
+  /// Wraps `self` as the value of a `let`-bound variable if gluing is enabled, so that its
+  /// references can be compared by identity. Values which are already cheap to compare are left as
+  /// they are.
+  pub fn define(self, ar: &'a Arena) -> Self {
+    match self {
+      Val::Univ(_) | Val::Free(_) | Val::Def(_) => self,
+      v if ar.gluing() => Val::Def(ar.val(v)),
+      v => v,
+    }
+  }
+
+  /// Returns the name of the variant of `self`, for profiling.
+  pub fn variant(&self) -> &'static str {
+    match self {
+      Val::Univ(_) => "Univ",
+      Val::Free(_) => "Free",
+      Val::Pi(..) => "Pi",
+      Val::Fun(_) => "Fun",
+      Val::App(..) => "App",
+      Val::Sig(_) => "Sig",
+      Val::Tup(_) => "Tup",
+      Val::Init(..) => "Init",
+      Val::Proj(..) => "Proj",
+      Val::Def(_) => "Def",
+      Val::Glued(..) => "Glued",
+      Val::Meta(..) => "Meta",
+    }
+  }
+
+  /// Unfolds all definitions at the head of `self`.
+  pub fn force(self) -> Self {
+    let mut curr = self;
+    while let Val::Def(x) | Val::Glued(_, x) = curr {
+      curr = *x;
+    }
+    curr
+  }
+
+  /// Replaces solved holes at the head of `self` by their solutions. Holes can be solved after
+  /// they are evaluated, so this is done on demand by [`Val::quote`] and [`Val::conv`].
+  pub fn force_meta(self, ar: &'a Arena) -> Result<Self, EvalError<'a, 'b>> {
+    let mut curr = self;
+    while let Val::Meta(env, m) = curr {
+      // SAFETY: as in `Term::eval()`.
+      match unsafe { ar.meta_solution(m) } {
+        Some(x) => curr = x.eval(env, ar)?,
+        None => break,
+      }
+    }
+    Ok(curr)
+  }
+
+  /// Replaces a solved hole at the head of spine `self` by its solution, applied to the arguments
+  /// of the spine. [`Val::force_meta`] only replaces holes at the head of `self` itself.
+  pub fn force_spine(self, ar: &'a Arena) -> Result<Self, EvalError<'a, 'b>> {
+    match self {
+      Val::Meta(_, _) => self.force_meta(ar),
+      Val::App(f, x, dot) => {
+        let g = f.force_spine(ar)?;
+        if g.ptr_eq(f) {
+          Ok(self)
+        } else {
+          g.app(*x, dot, ar)
+        }
+      }
+      _ => Ok(self),
+    }
+  }
+
+  /// Applies `self` to `x`. In the case of a redex, the (β) rule is applied. If `self` is headed
+  /// by a definition, the folded application is glued to the unfolded result.
+  ///
+  /// The unfolded form is computed eagerly, which is cheap as evaluation always stops at binders.
+  pub fn app(self, x: Self, dot: bool, ar: &'a Arena) -> Result<Self, EvalError<'a, 'b>> {
+    match self {
+      Val::Fun(b) => b.apply(x, ar),
+      Val::Def(_) => {
+        Ok(Val::Glued(ar.val(Val::App(ar.val(self), ar.val(x), dot)), ar.val(self.force().app(x, dot, ar)?.force())))
+      }
+      Val::Glued(f, u) => Ok(Val::Glued(ar.val(Val::App(f, ar.val(x), dot)), ar.val(u.app(x, dot, ar)?.force()))),
+      f => Ok(Val::App(ar.val(f), ar.val(x), dot)),
+    }
+  }
+
   /// Reduces well-typed `self` to eliminate `let`s and convert it back into a [`Term`].
   /// Can be an expensive operation. Expected to be used for outputs and error reporting.
   ///
@@ -324,31 +828,32 @@ impl<'a, 'b> Val<'a, 'b> {
   ///
   /// - `self` is well-typed under a context with size `len` (to ensure termination).
   pub fn quote(&self, len: usize, ar: &'a Arena) -> Result<Term<'a, 'b, Core>, EvalError<'a, 'b>> {
-    match self {
-      Val::Univ(v) => Ok(Term::Univ(*v)),
-      Val::Free(i) => Ok(Term::Var(len.checked_sub(i + 1).ok_or_else(|| EvalError::gen_level(*i, len))?)),
-      Val::Pi(t, u) => {
-        Ok(Term::Pi(u.info, ar.term(t.quote(len, ar)?), ar.term(u.apply(Val::Free(len), ar)?.quote(len + 1, ar)?)))
-      }
-      Val::Fun(b) => Ok(Term::Fun(b.info, ar.term(b.apply(Val::Free(len), ar)?.quote(len + 1, ar)?))),
-      Val::App(f, x, b) => Ok(Term::App(ar.term(f.quote(len, ar)?), ar.term(x.quote(len, ar)?), *b)),
-      Val::Sig(us) => {
-        let terms = ar.terms(us.len());
-        for (term, (info, u)) in terms.iter_mut().zip(us.iter()) {
-          *term = (info, u.apply(Val::Free(len), ar)?.quote(len + 1, ar)?);
-        }
-        Ok(Term::Sig(terms))
-      }
-      Val::Tup(bs) => {
-        let terms = ar.terms(bs.len());
-        for (term, (info, b)) in terms.iter_mut().zip(bs.iter()) {
-          *term = (info, b.quote(len + 1, ar)?);
-        }
-        Ok(Term::Tup(terms))
-      }
-      Val::Init(n, x) => Ok(Term::Init(*n, ar.term(x.quote(len, ar)?))),
-      Val::Proj(n, x) => Ok(Term::Proj(*n, ar.term(x.quote(len, ar)?))),
-      Val::Meta(_, _) => todo!(),
+    common::quote::<Ir>(self, len, ar)
+  }
+
+  /// Returns if the substitution of a hole (with entries `vals` from the top) consists of the
+  /// variables with de Bruijn indices 0, 1, 2, ..., as given by `index` on their levels. Such a hole
+  /// can be quoted as it is.
+  fn is_identity(vals: &[Self], index: impl Fn(usize) -> Option<usize>) -> bool {
+    vals.iter().enumerate().all(|(ix, val)| matches!(val.force(), Val::Free(i) if index(i) == Some(ix)))
+  }
+
+  /// Returns if `self` and `other` are shallowly identical, i.e. they are the same variant with
+  /// the same scalars and point to the same children. This implies definitional equality and is
+  /// used as a constant-time fast path in [`Val::conv`].
+  pub fn ptr_eq(&self, other: &Self) -> bool {
+    match (self, other) {
+      (Val::Univ(v), Val::Univ(w)) => v == w,
+      (Val::Free(i), Val::Free(j)) => i == j,
+      (Val::Pi(t, v), Val::Pi(u, w)) => ptr::eq(*t, *u) && ptr::eq(*v, *w),
+      (Val::Fun(b), Val::Fun(c)) => ptr::eq(*b, *c),
+      (Val::App(f, x, _), Val::App(g, y, _)) => ptr::eq(*f, *g) && ptr::eq(*x, *y),
+      (Val::Sig(us), Val::Sig(vs)) => ptr::eq(*us, *vs),
+      (Val::Tup(bs), Val::Tup(cs)) => ptr::eq(*bs, *cs),
+      (Val::Init(n, x), Val::Init(m, y)) | (Val::Proj(n, x), Val::Proj(m, y)) => n == m && ptr::eq(*x, *y),
+      (Val::Def(x), Val::Def(y)) | (Val::Glued(x, _), Val::Glued(y, _)) => ptr::eq(*x, *y),
+      (Val::Meta(e, m), Val::Meta(f, n)) => m == n && ptr::eq(*e, *f),
+      _ => false,
     }
   }
 
@@ -358,50 +863,157 @@ impl<'a, 'b> Val<'a, 'b> {
   /// Pre-conditions:
   ///
   /// - `self` and `other` are well-typed under a context with size `len` (to ensure termination).
+  ///
+  /// Holes solved along the way are kept only if the result is positive.
   pub fn conv(&self, other: &Self, len: usize, ar: &'a Arena) -> Result<bool, EvalError<'a, 'b>> {
-    match (self, other) {
-      (Val::Univ(v), Val::Univ(w)) => Ok(v == w),
-      (Val::Free(i), Val::Free(j)) => Ok(i == j),
-      (Val::Pi(t, v), Val::Pi(u, w)) => Ok(
-        Val::conv(t, u, len, ar)?
-          && Val::conv(&v.apply(Val::Free(len), ar)?, &w.apply(Val::Free(len), ar)?, len + 1, ar)?,
-      ),
-      (Val::Fun(b), Val::Fun(c)) => {
-        Ok(Val::conv(&b.apply(Val::Free(len), ar)?, &c.apply(Val::Free(len), ar)?, len + 1, ar)?)
-      }
-      (Val::App(f, x, _), Val::App(g, y, _)) => Ok(Val::conv(f, g, len, ar)? && Val::conv(x, y, len, ar)?),
-      (Val::Sig(us), Val::Sig(vs)) if us.len() == vs.len() => {
-        for ((i, u), (j, v)) in us.iter().zip(vs.iter()) {
-          if i.name != j.name {
-            return Ok(false);
-          }
-          if !Val::conv(&u.apply(Val::Free(len), ar)?, &v.apply(Val::Free(len), ar)?, len + 1, ar)? {
+    let mark = ar.meta_mark();
+    let res = self.conv_rec(other, len, ar);
+    if !matches!(res, Ok(true)) {
+      ar.rollback_metas(mark);
+    }
+    res
+  }
+
+  /// See [`Val::conv`].
+  fn conv_rec(&self, other: &Self, len: usize, ar: &'a Arena) -> Result<bool, EvalError<'a, 'b>> {
+    common::conv::<Ir>(self, other, len, ar)
+  }
+
+  /// See [`Val::conv`]. Replaces solved holes at the heads of `self` and `other` by their
+  /// solutions. If an unsolved hole remains on one side, tries solving it with the other side.
+  fn conv_meta(&self, other: &Self, len: usize, ar: &'a Arena) -> Result<bool, EvalError<'a, 'b>> {
+    match (self.force_meta(ar)?, other.force_meta(ar)?) {
+      (Val::Meta(e, m), Val::Meta(f, n)) if m == n => {
+        for (x, y) in e.values().zip(f.values()).take(ar.meta_scope(m).unwrap_or(0)) {
+          if !Val::conv_rec(&x, &y, len, ar)? {
             return Ok(false);
           }
         }
         Ok(true)
       }
-      (Val::Tup(bs), Val::Tup(cs)) if bs.len() == cs.len() => {
-        for ((i, b), (j, c)) in bs.iter().zip(cs.iter()) {
-          if i.name != j.name {
-            return Ok(false);
-          }
-          if !Val::conv(b, c, len, ar)? {
-            return Ok(false);
-          }
+      (Val::Meta(env, m), rhs) | (rhs, Val::Meta(env, m)) => Val::solve(env, m, &rhs, len, ar),
+      (x, y) => Val::conv_rec(&x, &y, len, ar),
+    }
+  }
+
+  /// Tries solving unsolved hole `m` under substitution `env`, such that it becomes definitionally
+  /// equal to `rhs`, by Miller pattern unification. Returns if a solution is found.
+  ///
+  /// Entries of `env` which are free variables occurring once are inverted into a table from their
+  /// de Bruijn levels to their indices in the scope of the hole, so that renaming `rhs` into the
+  /// scope takes constant time per variable. Other entries (e.g. `let`-bound values) cannot be
+  /// referred to by the solution. The occurs check is done in the same pass, which stops at the first variable out
+  /// of scope or occurrence of `m`, so no value is quoted more than once.
+  ///
+  /// - See: <https://doi.org/10.1093/logcom/1.4.497> (Miller's pattern fragment)
+  /// - See: <https://github.com/AndrasKovacs/elaboration-zoo/blob/master/03-holes/Main.hs>
+  fn solve(env: &Stack<'a, 'b>, m: usize, rhs: &Self, len: usize, ar: &'a Arena) -> Result<bool, EvalError<'a, 'b>> {
+    let Some(scope) = ar.meta_scope(m) else { return Ok(false) };
+    let (mut ren, mut seen) = (vec![None; len], vec![false; len]);
+    for (ix, val) in env.values().take(scope).enumerate() {
+      // If a variable occurs more than once, the solution cannot tell the occurrences apart, so it
+      // must not refer to that variable at all.
+      if let Val::Free(i) = val.force() {
+        if let (Some(slot), Some(seen)) = (ren.get_mut(i), seen.get_mut(i)) {
+          *slot = if *seen { None } else { Some(ix) };
+          *seen = true;
         }
+      }
+    }
+    match rhs.rename(m, &ren, 0, ar)? {
+      Some(x) => {
+        ar.solve_meta(m, ar.term(x));
         Ok(true)
       }
-      (Val::Init(n, x), Val::Init(m, y)) => Ok(n == m && Val::conv(x, y, len, ar)?),
-      (Val::Proj(n, x), Val::Proj(m, y)) => Ok(n == m && Val::conv(x, y, len, ar)?),
-      (Val::Meta(_, _), Val::Meta(_, _)) => todo!(),
+      None => Ok(false),
+    }
+  }
+
+  /// Converts `self` under a context with size `ren.len() + depth` into a term under the scope of
+  /// hole `m` extended with `depth` binders, where `ren` maps levels below `ren.len()` to indices in
+  /// the scope. Returns [`None`] if `self` refers to variables not in `ren`, or mentions `m` itself.
+  /// This is the counterpart of [`Val::quote`] used by [`Val::solve`].
+  fn rename(
+    &self,
+    m: usize,
+    ren: &[Option<usize>],
+    depth: usize,
+    ar: &'a Arena,
+  ) -> Result<Option<Term<'a, 'b, Core>>, EvalError<'a, 'b>> {
+    let len = ren.len();
+    let index = |i: usize| match ren.get(i) {
+      Some(ix) => ix.map(|ix| ix + depth),
+      None => (len + depth).checked_sub(i + 1),
+    };
+    let x = Val::Free(len + depth);
+    macro_rules! rename {
+      ($val:expr, $depth:expr) => {
+        match $val.rename(m, ren, $depth, ar)? {
+          Some(term) => term,
+          None => return Ok(None),
+        }
+      };
+    }
+    Ok(Some(match self {
+      Val::Univ(v) => Term::Univ(*v),
+      Val::Free(i) if *i < len => match ren[*i] {
+        Some(ix) => Term::Var(ix + depth),
+        None => return Ok(None),
+      },
+      Val::Free(i) => Term::Var(index(*i).ok_or_else(|| EvalError::gen_level(*i, len + depth))?),
+      Val::Pi(t, u) => Term::Pi(u.info, ar.term(rename!(t, depth)), ar.term(rename!(u.apply(x, ar)?, depth + 1))),
+      Val::Fun(b) => Term::Fun(b.info, ar.term(rename!(b.apply(x, ar)?, depth + 1))),
+      Val::App(f, x, b) => Term::App(ar.term(rename!(f, depth)), ar.term(rename!(x, depth)), *b),
+      Val::Sig(us) => {
+        let terms = ar.terms(us.len());
+        for (term, (info, u)) in terms.iter_mut().zip(us.iter()) {
+          *term = (info, rename!(u.apply(x, ar)?, depth + 1));
+        }
+        Term::Sig(terms)
+      }
+      Val::Tup(bs) => {
+        let terms = ar.terms(bs.len());
+        for (term, (info, b)) in terms.iter_mut().zip(bs.iter()) {
+          *term = (info, rename!(b, depth + 1));
+        }
+        Term::Tup(terms)
+      }
+      Val::Init(n, x) => Term::Init(*n, ar.term(rename!(x, depth))),
+      Val::Proj(n, x) => Term::Proj(*n, ar.term(rename!(x, depth))),
+      Val::Def(x) | Val::Glued(_, x) => rename!(x, depth),
+      // SAFETY: as in `Term::eval()`.
+      Val::Meta(env, k) => match unsafe { ar.meta_solution(*k) } {
+        Some(x) => rename!(x.eval(env, ar)?, depth),
+        None if *k == m => return Ok(None),
+        None => {
+          let vals = env.values().take(ar.meta_scope(*k).unwrap_or(0)).collect::<Vec<_>>();
+          if Val::is_identity(&vals, index) {
+            Term::Meta(*k)
+          } else {
+            let mut terms = Vec::with_capacity(vals.len());
+            for (i, val) in vals.iter().rev().enumerate() {
+              terms.push(rename!(val, depth + i));
+            }
+            Term::let_meta(*k, terms, ar)
+          }
+        }
+      },
+    }))
+  }
+
+  /// Returns if the folded spines `self` and `other` are headed by the same definition and have
+  /// definitionally equal arguments. A negative result does not imply inequality.
+  fn conv_spine(&self, other: &Self, len: usize, ar: &'a Arena) -> Result<bool, EvalError<'a, 'b>> {
+    match (self, other) {
+      (Val::Def(x), Val::Def(y)) => Ok(ptr::eq(*x, *y)),
+      (Val::App(f, x, _), Val::App(g, y, _)) => Ok(f.conv_spine(g, len, ar)? && Val::conv_rec(x, y, len, ar)?),
       _ => Ok(false),
     }
   }
 
   /// Given `self`, tries elimination as [`Val::Univ`].
   pub fn as_univ<E>(self, err: impl FnOnce(Self) -> E) -> Result<usize, E> {
-    match self {
+    match self.force() {
       Val::Univ(v) => Ok(v),
       ty => Err(err(ty)),
     }
@@ -409,7 +1021,7 @@ impl<'a, 'b> Val<'a, 'b> {
 
   /// Given `self`, tries elimination as [`Val::Pi`].
   pub fn as_pi<E>(self, err: impl FnOnce(Self) -> E) -> Result<(&'a Val<'a, 'b>, &'a Clos<'a, 'b>), E> {
-    match self {
+    match self.force() {
       Val::Pi(t, u) => Ok((t, u)),
       ty => Err(err(ty)),
     }
@@ -417,7 +1029,7 @@ impl<'a, 'b> Val<'a, 'b> {
 
   /// Given `self`, tries elimination as [`Val::Sig`].
   pub fn as_sig<E>(self, err: impl FnOnce(Self) -> E) -> Result<&'a [(&'b Field<'b>, Clos<'a, 'b>)], E> {
-    match self {
+    match self.force() {
       Val::Sig(us) => Ok(us),
       ty => Err(err(ty)),
     }
@@ -427,31 +1039,114 @@ impl<'a, 'b> Val<'a, 'b> {
 impl<'a, 'b, T: Decoration> Term<'a, 'b, T> {
   /// Given universe `u`, returns the universe of its type.
   pub fn univ_univ(u: usize) -> Result<usize, TypeError<'a, 'b, T>> {
-    match u {
-      #[cfg(feature = "type_in_type")]
-      0 => Ok(0),
-      #[cfg(not(feature = "type_in_type"))]
-      0 => Ok(1),
-      _ => Err(TypeError::univ_form(u)),
-    }
+    common::univ_univ(u).ok_or_else(|| TypeError::univ_form(u))
   }
 
   /// Given universes `v` and `w`, returns the universe of Pi types from `v` to `w`.
   pub fn pi_univ(v: usize, w: usize) -> Result<usize, TypeError<'a, 'b, T>> {
-    Ok(max(v, w))
+    Ok(common::pi_univ(v, w))
   }
 
   /// Given universes `v` and `w`, returns the universe of Sigma types containing `v` and `w`.
   pub fn sig_univ(v: usize, w: usize) -> Result<usize, TypeError<'a, 'b, T>> {
-    Ok(max(v, w))
+    Ok(common::sig_univ(v, w))
   }
 
   /// Returns the universe of the unit type.
   pub fn unit_univ() -> Result<usize, TypeError<'a, 'b, T>> {
-    Ok(0)
+    Ok(common::unit_univ())
+  }
+
+  /// Returns unsolved hole `m` under `let`s binding `terms` (outermost first), which replace the
+  /// entries of its scope. This is how holes under substitutions are quoted.
+  pub fn let_meta(m: usize, terms: Vec<Self>, ar: &'a Arena) -> Self {
+    terms.into_iter().rev().fold(Term::Meta(m), |x, v| Term::Let(Bound::empty(), ar.term(v), ar.term(x)))
+  }
+
+  /// Returns the name of the variant of `self`, for profiling.
+  pub fn variant(&self) -> &'static str {
+    match self {
+      Term::Gc(_) => "Gc",
+      Term::Univ(_) => "Univ",
+      Term::Var(_) => "Var",
+      Term::Ann(..) => "Ann",
+      Term::Let(..) => "Let",
+      Term::Pi(..) => "Pi",
+      Term::Fun(..) => "Fun",
+      Term::App(..) => "App",
+      Term::Sig(_) => "Sig",
+      Term::Tup(_) => "Tup",
+      Term::Init(..) => "Init",
+      Term::Proj(..) => "Proj",
+      Term::Meta(_) => "Meta",
+      Term::NamedVar(..) => "NamedVar",
+      Term::NamedProj(..) => "NamedProj",
+      Term::Const(_) => "Const",
+    }
+  }
+
+  /// Adds to `res` the fields of the tuple of `len` fields bound to the variable with de Bruijn
+  /// index `ix` which may occur in `self`, by index counted from the start. Fields are told apart
+  /// under projections; other occurrences of the variable, named variables and holes
+  /// conservatively add all fields.
+  pub fn mentioned_fields(&self, ix: usize, len: usize, res: &mut Vec<usize>) {
+    match self {
+      Term::Univ(_) | Term::Const(_) => {}
+      Term::Var(i) if *i != ix => {}
+      Term::Proj(n, x) => match x.visible_fields(ix, len) {
+        Some(m) if *n < m => res.push(m - 1 - n),
+        _ => x.mentioned_fields(ix, len, res),
+      },
+      Term::Init(_, x) => match self.visible_fields(ix, len) {
+        Some(m) => res.extend(0..m),
+        None => x.mentioned_fields(ix, len, res),
+      },
+      Term::Gc(x) => x.mentioned_fields(ix, len, res),
+      Term::Ann(x, y) | Term::App(x, y, _) => {
+        x.mentioned_fields(ix, len, res);
+        y.mentioned_fields(ix, len, res);
+      }
+      Term::Let(_, v, x) | Term::Pi(_, v, x) => {
+        v.mentioned_fields(ix, len, res);
+        x.mentioned_fields(ix + 1, len, res);
+      }
+      Term::Fun(_, b) => b.mentioned_fields(ix + 1, len, res),
+      Term::Sig(us) | Term::Tup(us) => us.iter().for_each(|(_, u)| u.mentioned_fields(ix + 1, len, res)),
+      Term::Var(_) | Term::Meta(_) | Term::NamedVar(..) | Term::NamedProj(..) => res.extend(0..len),
+    }
+  }
+
+  /// Returns the number of fields of the tuple of `len` fields bound to the variable with de
+  /// Bruijn index `ix` which are visible through `self`, if `self` is the variable or an initial
+  /// segment of it.
+  fn visible_fields(&self, ix: usize, len: usize) -> Option<usize> {
+    match self {
+      Term::Var(i) if *i == ix => Some(len),
+      Term::Init(n, x) => x.visible_fields(ix, len).map(|m| m.saturating_sub(*n)),
+      _ => None,
+    }
+  }
+
+  /// Returns the number of nodes of `self` and its nesting depth.
+  pub fn extent(&self) -> (usize, usize) {
+    let (nodes, depth) = match self {
+      Term::Univ(_) | Term::Var(_) | Term::Meta(_) | Term::NamedVar(..) | Term::Const(_) => (0, 0),
+      Term::Gc(x) | Term::Fun(_, x) | Term::Init(_, x) | Term::Proj(_, x) | Term::NamedProj(_, x, _) => x.extent(),
+      Term::Ann(x, y) | Term::Let(_, x, y) | Term::Pi(_, x, y) | Term::App(x, y, _) => {
+        let ((m, d), (n, e)) = (x.extent(), y.extent());
+        (m + n, d.max(e))
+      }
+      Term::Sig(us) | Term::Tup(us) => {
+        us.iter().map(|(_, u)| u.extent()).fold((0, 0), |(m, d), (n, e)| (m + n, d.max(e)))
+      }
+    };
+    (nodes + 1, depth + 1)
   }
 }
 
+/// Results of checking and evaluating a tuple field.
+type FieldResult<'a, 'b, S> = Result<(Term<'a, 'b, Named>, Val<'a, 'b>), <S as Sink>::Error<'a, 'b>>;
+
 impl<'a, 'b> Term<'a, 'b, Core> {
   /// Given preterm `self`, returns the type of `self`. This is mutually recursive with
   /// [`Term::check`], and is the entry point of Coquand’s type checking algorithm.
@@ -469,54 +1164,68 @@ impl<'a, 'b> Term<'a, 'b, Core> {
     env: &Stack<'a, 'b>,
     ar: &'a Arena,
   ) -> Result<(Term<'a, 'b, Named>, Val<'a, 'b>), TypeError<'a, 'b, Core>> {
+    self.infer_into::<TypeError<Core>>(ctx, env, ar)
+  }
+
+  /// Same as [`Term::infer`], but reports failures to the error sink `S`.
+  pub fn infer_into<S: Sink>(
+    &self,
+    ctx: &Stack<'a, 'b>,
+    env: &Stack<'a, 'b>,
+    ar: &'a Arena,
+  ) -> Result<(Term<'a, 'b, Named>, Val<'a, 'b>), S::Error<'a, 'b>> {
+    ar.profile_rule(Op::Infer, || self.variant());
     match self {
-      // The garbage collection mark forces the subterm to be inferred inside a new arena.
+      // The garbage collection mark forces the subterm to be inferred inside a new arena region.
       Term::Gc(x) => {
-        x.infer(ctx, env, &Arena::new()).map(|(x, v)| (x.relocate(ar), v.relocate(ar))).map_err(|e| e.relocate(ar))
+        let temp = ar.region();
+        let res = x.infer_into::<S>(ctx, env, &temp);
+        ar.copy_in(|| res.map(|(x, v)| (x.relocate(ar), v.relocate(ar))).map_err(|e| S::relocate(&e, ar)))
       }
       // The (univ) rule is used.
-      Term::Univ(lvl) => Ok(((Term::Univ(*lvl)), Val::Univ(Term::univ_univ(*lvl)?))),
+      Term::Univ(lvl) => Ok(((Term::Univ(*lvl)), Val::Univ(Term::univ_univ(*lvl).map_err(|e| S::error(|| e))?))),
       // The (ann) rule is used.
       // To establish pre-conditions for `eval()` and `check()`, the type of `t` is checked first.
       Term::Ann(x_old, t_old) => {
-        let (t_new, t_type) = t_old.infer(ctx, env, ar)?;
-        let _ = t_type.as_univ(|t_type| TypeError::type_expected(t_old, t_type, ctx, env, ar))?;
+        let (t_new, t_type) = t_old.infer_into::<S>(ctx, env, ar)?;
+        let _ = t_type.as_univ(|t_type| S::error(|| TypeError::type_expected(t_old, t_type, ctx, env, ar)))?;
         let t_val = t_old.eval(env, ar)?;
-        let x_new = x_old.check(t_val, ctx, env, ar)?;
+        let x_new = x_old.check_into::<S>(t_val, ctx, env, ar)?;
         Ok(((Term::Ann(ar.term(x_new), ar.term(t_new))), t_val))
       }
       // The (let) and (extend) rules are used.
       // The (ζ) rule is implicitly used on the value (in normal form) from the recursive call.
       Term::Let(info, v_old, x_old) => {
-        let (v_new, v_type) = v_old.infer(ctx, env, ar)?;
-        let v_val = v_old.eval(env, ar)?;
+        let (v_new, v_type) = v_old.infer_into::<S>(ctx, env, ar)?;
+        let v_val = v_old.eval(env, ar)?.define(ar);
         let ctx_ext = ctx.extend(info, v_type, ar);
         let env_ext = env.extend(info, v_val, ar);
-        let (x_new, x_type) = x_old.infer(&ctx_ext, &env_ext, ar)?;
+        let (x_new, x_type) = x_old.infer_into::<S>(&ctx_ext, &env_ext, ar)?;
         Ok(((Term::Let(info, ar.term(v_new), ar.term(x_new))), x_type))
       }
       // The (Π form) and (extend) rules are used.
       Term::Pi(info, t_old, u_old) => {
-        let (t_new, t_type) = t_old.infer(ctx, env, ar)?;
-        let t_lvl = t_type.as_univ(|t_type| TypeError::type_expected(t_old, t_type, ctx, env, ar))?;
+        let (t_new, t_type) = t_old.infer_into::<S>(ctx, env, ar)?;
+        let t_lvl = t_type.as_univ(|t_type| S::error(|| TypeError::type_expected(t_old, t_type, ctx, env, ar)))?;
         let ctx_ext = ctx.extend(info, t_old.eval(env, ar)?, ar);
         let env_ext = env.extend(info, Val::Free(env.len()), ar);
-        let (u_new, u_type) = u_old.infer(&ctx_ext, &env_ext, ar)?;
-        let u_lvl = u_type.as_univ(|u_type| TypeError::type_expected(u_old, u_type, ctx, env, ar))?;
-        Ok(((Term::Pi(info, ar.term(t_new), ar.term(u_new))), Val::Univ(Term::pi_univ(t_lvl, u_lvl)?)))
+        let (u_new, u_type) = u_old.infer_into::<S>(&ctx_ext, &env_ext, ar)?;
+        let u_lvl = u_type.as_univ(|u_type| S::error(|| TypeError::type_expected(u_old, u_type, ctx, env, ar)))?;
+        let lvl = Term::pi_univ(t_lvl, u_lvl).map_err(|e| S::error(|| e))?;
+        Ok(((Term::Pi(info, ar.term(t_new), ar.term(u_new))), Val::Univ(lvl)))
       }
       // Function abstractions must be enclosed in type annotations, or appear as an argument.
-      Term::Fun(_, _) => Err(TypeError::ann_expected(ar.term(*self))),
+      Term::Fun(_, _) => Err(S::error(|| TypeError::ann_expected(ar.term(*self)))),
       // The (Π elim) rule is used.
       Term::App(f_old, x_old, dot) => {
-        let (f_new, f_type) = f_old.infer(ctx, env, ar)?;
-        let (t_val, u_val) = f_type.as_pi(|f_type| TypeError::pi_expected(f_old, f_type, ctx, env, ar))?;
-        let x_new = x_old.check(*t_val, ctx, env, ar)?;
+        let (f_new, f_type) = f_old.infer_into::<S>(ctx, env, ar)?;
+        let (t_val, u_val) = f_type.as_pi(|f_type| S::error(|| TypeError::pi_expected(f_old, f_type, ctx, env, ar)))?;
+        let x_new = x_old.check_into::<S>(*t_val, ctx, env, ar)?;
         Ok(((Term::App(ar.term(f_new), ar.term(x_new), *dot)), u_val.apply(x_old.eval(env, ar)?, ar)?))
       }
       // The (Σ form), (⊤ form) and (extend) rules are used.
       Term::Sig(us_old) => {
-        let mut lvl = Term::unit_univ()?;
+        let mut lvl = Term::unit_univ().map_err(|e| S::error(|| e))?;
         let us_new = ar.terms(us_old.len());
         let us_val = ar.closures(us_old.len());
         for (i, (info, u_old)) in us_old.iter().enumerate() {
@@ -527,31 +1236,38 @@ impl<'a, 'b> Term<'a, 'b, Core> {
           let x_val = Val::Free(env.len());
           let ctx_ext = ctx.extend(Bound::empty(), t_val, ar);
           let env_ext = env.extend(Bound::empty(), x_val, ar);
-          let (u_new, u_type) = u_old.infer(&ctx_ext, &env_ext, ar)?;
-          let u_lvl = u_type.as_univ(|u_type| TypeError::type_expected(u_old, u_type, ctx, env, ar))?;
-          lvl = Term::sig_univ(lvl, u_lvl)?;
+          let (u_new, u_type) = u_old.infer_into::<S>(&ctx_ext, &env_ext, ar)?;
+          let u_lvl = u_type.as_univ(|u_type| S::error(|| TypeError::type_expected(u_old, u_type, ctx, env, ar)))?;
+          lvl = Term::sig_univ(lvl, u_lvl).map_err(|e| S::error(|| e))?;
           us_new[i] = (*info, u_new);
         }
         Ok(((Term::Sig(us_new)), Val::Univ(lvl)))
       }
       // Tuple constructors must be enclosed in type annotations, or appear as an argument.
-      Term::Tup(_) => Err(TypeError::ann_expected(ar.term(*self))),
+      Term::Tup(_) => Err(S::error(|| TypeError::ann_expected(ar.term(*self)))),
       // The (Σ init) rule is used.
       Term::Init(n, x_old) => {
-        let (x_new, x_type) = x_old.infer(ctx, env, ar)?;
-        let us_val = x_type.as_sig(|x_type| TypeError::sig_expected(x_old, x_type, ctx, env, ar))?;
-        let m = us_val.len().checked_sub(*n).ok_or_else(|| TypeError::sig_init(*n, Val::Sig(us_val), ctx, env, ar))?;
+        let (x_new, x_type) = x_old.infer_into::<S>(ctx, env, ar)?;
+        let us_val = x_type.as_sig(|x_type| S::error(|| TypeError::sig_expected(x_old, x_type, ctx, env, ar)))?;
+        let m = us_val.len().checked_sub(*n);
+        let m = m.ok_or_else(|| S::error(|| TypeError::sig_init(*n, Val::Sig(us_val), ctx, env, ar)))?;
         Ok(((Term::Init(*n, ar.term(x_new))), Val::Sig(&us_val[..m])))
       }
       // The (var) and (Σ proj) rules are used.
-      Term::Var(ix) => Name::present_named_var(*ix, None, ctx, env, ar),
-      Term::Proj(n, Term::Var(ix)) => Name::present_named_var(*ix, Some(*n), ctx, env, ar),
+      Term::Var(ix) => Name::present_named_var::<S>(*ix, None, ctx, env, ar),
+      Term::Proj(n, Term::Var(ix)) => Name::present_named_var::<S>(*ix, Some(*n), ctx, env, ar),
       Term::Proj(n, x_old) => {
-        let (x_new, x_type) = x_old.infer(ctx, env, ar)?;
-        Name::present_named_proj(*n, x_old, x_new, x_type, ctx, env, ar)
+        let (x_new, x_type) = x_old.infer_into::<S>(ctx, env, ar)?;
+        Name::present_named_proj::<S>(*n, x_old, x_new, x_type, ctx, env, ar)
       }
-      // Holes must be enclosed in type annotations, or appear as an argument.
-      Term::Meta(_) => Err(TypeError::ann_expected(ar.term(*self))),
+      // Holes are typed by the metacontext.
+      // SAFETY: as in `Term::eval()`.
+      Term::Meta(m) => match unsafe { ar.meta_type(*m) } {
+        Some(t) => Ok((Term::Meta(*m), t.eval(env, ar)?)),
+        None => Err(S::error(|| TypeError::ann_expected(ar.term(*self)))),
+      },
+      // Global definitions are already checked.
+      Term::Const(g) => Ok((Term::Const(g), g.ty)),
     }
   }
 
@@ -571,66 +1287,137 @@ impl<'a, 'b> Term<'a, 'b, Core> {
     env: &Stack<'a, 'b>,
     ar: &'a Arena,
   ) -> Result<Term<'a, 'b, Named>, TypeError<'a, 'b, Core>> {
+    self.check_into::<TypeError<Core>>(t, ctx, env, ar)
+  }
+
+  /// Same as [`Term::check`], but only returns if `self` has type `t`. Failures construct no
+  /// errors (see [`Sink`]), which suits searches trying many candidates that mostly fail.
+  pub fn check_ok(&self, t: Val<'a, 'b>, ctx: &Stack<'a, 'b>, env: &Stack<'a, 'b>, ar: &'a Arena) -> bool {
+    self.check_into::<()>(t, ctx, env, ar).is_ok()
+  }
+
+  /// Same as [`Term::check`], but reports failures to the error sink `S`.
+  pub fn check_into<S: Sink>(
+    &self,
+    t: Val<'a, 'b>,
+    ctx: &Stack<'a, 'b>,
+    env: &Stack<'a, 'b>,
+    ar: &'a Arena,
+  ) -> Result<Term<'a, 'b, Named>, S::Error<'a, 'b>> {
+    ar.profile_rule(Op::Check, || self.variant());
     match self {
-      // The garbage collection mark forces the subterm to be checked inside a new arena.
-      Term::Gc(x) => x.check(t, ctx, env, &Arena::new()).map(|x| x.relocate(ar)).map_err(|e| e.relocate(ar)),
+      // The garbage collection mark forces the subterm to be checked inside a new arena region.
+      Term::Gc(x) => {
+        let temp = ar.region();
+        let res = x.check_into::<S>(t, ctx, env, &temp);
+        ar.copy_in(|| res.map(|x| x.relocate(ar)).map_err(|e| S::relocate(&e, ar)))
+      }
       // The (let) and (extend) rules are used.
       // The (ζ) rule is implicitly inversely used on the `t` passed into the recursive call.
       Term::Let(info, v_old, x_old) => {
-        let (v_new, v_type) = v_old.infer(ctx, env, ar)?;
-        let v_val = v_old.eval(env, ar)?;
+        let (v_new, v_type) = v_old.infer_into::<S>(ctx, env, ar)?;
+        let v_val = v_old.eval(env, ar)?.define(ar);
         let ctx_ext = ctx.extend(info, v_type, ar);
         let env_ext = env.extend(info, v_val, ar);
-        let x_new = x_old.check(t, &ctx_ext, &env_ext, ar)?;
+        let x_new = x_old.check_into::<S>(t, &ctx_ext, &env_ext, ar)?;
         Ok(Term::Let(info, ar.term(v_new), ar.term(x_new)))
       }
       // The (Π intro) and (extend) rules used.
       // By pre-conditions, `t` is already known to have universe type.
       Term::Fun(info, b_old) => {
-        let (t_val, u_val) = t.as_pi(|t| TypeError::pi_ann_expected(t, ctx, env, ar))?;
+        let (t_val, u_val) = t.as_pi(|t| S::error(|| TypeError::pi_ann_expected(t, ctx, env, ar)))?;
         let x_val = Val::Free(env.len());
         let ctx_ext = ctx.extend(info, *t_val, ar);
         let env_ext = env.extend(info, x_val, ar);
-        let b_new = b_old.check(u_val.apply(x_val, ar)?, &ctx_ext, &env_ext, ar)?;
+        let b_new = b_old.check_into::<S>(u_val.apply(x_val, ar)?, &ctx_ext, &env_ext, ar)?;
         Ok(Term::Fun(info, ar.term(b_new)))
       }
       // The (∑ intro) and (extend) rules are used.
       // By pre-conditions, `t` is already known to have universe type.
       Term::Tup(bs_old) => {
-        let us_val = t.as_sig(|t| TypeError::sig_ann_expected(t, ctx, env, ar))?;
+        let us_val = t.as_sig(|t| S::error(|| TypeError::sig_ann_expected(t, ctx, env, ar)))?;
         if bs_old.len() == us_val.len() {
+          let mut done = match ar.threads() {
+            0 | 1 => Vec::new(),
+            _ => Term::check_fields_parallel::<S>(bs_old, us_val, ctx, env, ar),
+          };
           let bs_new = ar.terms(bs_old.len());
           let bs_val = ar.values(bs_old.len()).as_mut_ptr();
           for (i, (info, b_old)) in bs_old.iter().enumerate() {
             let (u_info, u_val) = &us_val[i];
             if info.name != u_info.name {
-              return Err(TypeError::tup_field_mismatch(ar.term(*self), info.name, u_info.name));
+              return Err(S::error(|| TypeError::tup_field_mismatch(ar.term(*self), info.name, u_info.name)));
             }
-            let t_val = Val::Sig(&us_val[..i]);
-            // SAFETY: the borrowed range `&bs_val[..i]` is no longer modified.
-            let a_val = Val::Tup(unsafe { from_raw_parts(bs_val, i) });
-            let ctx_ext = ctx.extend(Bound::empty(), t_val, ar);
-            let env_ext = env.extend(Bound::empty(), a_val, ar);
-            let b_new = b_old.check(u_val.apply(a_val, ar)?, &ctx_ext, &env_ext, ar)?;
+            let (b_new, b_val) = match done.get_mut(i).and_then(Option::take) {
+              Some(res) => res?,
+              None => {
+                let t_val = Val::Sig(&us_val[..i]);
+                // SAFETY: the borrowed range `&bs_val[..i]` is no longer modified.
+                let a_val = Val::Tup(unsafe { from_raw_parts(bs_val, i) });
+                let ctx_ext = ctx.extend(Bound::empty(), t_val, ar);
+                let env_ext = env.extend(Bound::empty(), a_val, ar);
+                let b_new = b_old.check_into::<S>(u_val.apply(a_val, ar)?, &ctx_ext, &env_ext, ar)?;
+                (b_new, b_old.eval(&env_ext, ar)?)
+              }
+            };
             bs_new[i] = (info, b_new);
-            let b_val = b_old.eval(&env_ext, ar)?;
             // SAFETY: `i < bs_old.len()` which is the valid size of `bs_val`.
             unsafe { *bs_val.add(i) = (info, b_val) };
           }
           Ok(Term::Tup(bs_new))
         } else {
-          Err(TypeError::tup_size_mismatch(ar.term(*self), bs_old.len(), us_val.len()))
+          Err(S::error(|| TypeError::tup_size_mismatch(ar.term(*self), bs_old.len(), us_val.len())))
         }
       }
-      // Holes in the core syntax cannot be checked.
-      Term::Meta(_) => todo!(),
       // The (conv) rule is used.
       // By pre-conditions, `t` is already known to have universe type.
       x_old => {
-        let (x_new, x_type) = x_old.infer(ctx, env, ar)?;
+        let (x_new, x_type) = x_old.infer_into::<S>(ctx, env, ar)?;
         let res = Val::conv(&x_type, &t, env.len(), ar)?.then_some(x_new);
-        res.ok_or_else(|| TypeError::type_mismatch(ar.term(*x_old), x_type, t, ctx, env, ar))
+        res.ok_or_else(|| S::error(|| TypeError::type_mismatch(ar.term(*x_old), x_type, t, ctx, env, ar)))
       }
     }
   }
+
+  /// Checks and evaluates the fields of a tuple constructor on worker threads with their own
+  /// arenas if worthwhile (see [`Schedule`]). Returns results relocated to `ar`, by field index.
+  /// Fields which are skipped (`None`) have to be checked by the caller.
+  fn check_fields_parallel<S: Sink>(
+    bs_old: &[(&'b Field<'b>, Term<'a, 'b, Core>)],
+    us_val: &'a [(&'b Field<'b>, Clos<'a, 'b>)],
+    ctx: &Stack<'a, 'b>,
+    env: &Stack<'a, 'b>,
+    ar: &'a Arena,
+  ) -> Vec<Option<FieldResult<'a, 'b, S>>> {
+    let mut schedule = Schedule::new();
+    for (i, ((info, b_old), (u_info, u_val))) in bs_old.iter().zip(us_val).enumerate() {
+      let mut mentioned = Vec::new();
+      b_old.mentioned_fields(0, i, &mut mentioned);
+      u_val.body.mentioned_fields(0, i, &mut mentioned);
+      schedule.push(b_old, (info.name == u_info.name).then_some(mentioned));
+    }
+    let n = schedule.workers(ar);
+    if n == 0 {
+      return Vec::new();
+    }
+    let mut workers = (0..n).map(|_| ar.worker()).collect::<Vec<_>>();
+    let mut prefix = bs_old.iter().map(|(info, _)| (*info, Val::Free(env.len()))).collect::<Vec<_>>();
+    let res = schedule.run(&mut prefix, &mut workers, |i, a_val, w| -> FieldResult<'_, 'b, S> {
+      let ((_, b_old), (_, u_val)) = (&bs_old[i], &us_val[i]);
+      let ctx_ext = ctx.extend(Bound::empty(), Val::Sig(&us_val[..i]), w);
+      let env_ext = env.extend(Bound::empty(), a_val, w);
+      let b_new = b_old.check_into::<S>(u_val.apply(a_val, w)?, &ctx_ext, &env_ext, w)?;
+      Ok((b_new, b_old.eval(&env_ext, w)?))
+    });
+    // Results share the values of the fields they mention, so they are relocated together.
+    let res = ar.copy_in(|| {
+      let relocate =
+        |r: FieldResult<'_, 'b, S>| r.map(|(x, v)| (x.relocate(ar), v.relocate(ar))).map_err(|e| S::relocate(&e, ar));
+      res.into_iter().map(|r| r.map(relocate)).collect()
+    });
+    for w in workers {
+      ar.reclaim(w);
+    }
+    res
+  }
 }
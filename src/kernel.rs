@@ -1,9 +1,10 @@
 mod arena;
+pub mod compact;
 mod errors;
 mod io;
 mod term;
 
 pub use arena::Arena;
-pub use errors::{EvalError, LexError, ParseError, TypeError};
+pub use errors::{EvalError, LexError, ParseError, Quoted, Sink, TypeError};
 pub use io::{Binding, Prec, Span, Token};
 pub use term::{Clos, Stack, Term, Val};
@@ -1,16 +1,66 @@
 use bumpalo::Bump;
-use std::cell::Cell;
+use std::cell::{Cell, RefCell};
+use std::mem::{size_of_val, take};
 
 use super::*;
+use crate::common::{Forwarding, Usage};
+
+/// Maximum number of spare chunks kept per thread, see [`Arena::region`].
+const SPARE_CHUNKS: usize = 8;
+
+thread_local! {
+  /// Reset chunks of dropped regions on this thread, for reuse by later regions.
+  static SPARE: RefCell<Vec<Bump>> = const { RefCell::new(Vec::new()) };
+}
+
+/// Number of preallocated universes, see [`Arena::term`] and [`Arena::val`].
+const SMALL_UNIVS: usize = 4;
+
+/// Number of preallocated variables, see [`Arena::term`] and [`Arena::val`].
+const SMALL_VARS: usize = 256;
+
+/// Universe and variable terms with small levels and indices.
+static SMALL_TERMS: ([Term; SMALL_UNIVS], [Term; SMALL_VARS]) = {
+  let (mut univs, mut vars) = ([Term::Univ(0); SMALL_UNIVS], [Term::Var(0); SMALL_VARS]);
+  let mut i = 0;
+  while i < SMALL_VARS {
+    if i < SMALL_UNIVS {
+      univs[i] = Term::Univ(i);
+    }
+    vars[i] = Term::Var(i);
+    i += 1;
+  }
+  (univs, vars)
+};
+
+/// Universe and free variable values with small levels.
+static SMALL_VALS: ([Val; SMALL_UNIVS], [Val; SMALL_VARS]) = {
+  let (mut univs, mut frees) = ([Val::Univ(0); SMALL_UNIVS], [Val::Free(0); SMALL_VARS]);
+  let mut i = 0;
+  while i < SMALL_VARS {
+    if i < SMALL_UNIVS {
+      univs[i] = Val::Univ(i);
+    }
+    frees[i] = Val::Free(i);
+    i += 1;
+  }
+  (univs, frees)
+};
 
 /// # Arena allocators
 ///
 /// Mixed-type arena allocators for [`Term`], [`Val`], [`Clos`] and [`Stack`]. These types never
 /// allocate memory or manage resources outside the arena, so there is no need to call destructors.
-/// It also stores mutable performance counters for debugging and profiling purposes.
+/// It also stores mutable performance counters for debugging and profiling purposes. Stack lookups
+/// are only counted with the `profiling` feature.
+///
+/// The number of bytes live in an arena and the regions it is nested in can be limited, see
+/// [`Arena::set_byte_limit`].
 #[derive(Debug, Default)]
 pub struct Arena {
   data: Bump,
+  forwarded: Forwarding,
+  usage: Usage,
   term_count: Cell<usize>,
   val_count: Cell<usize>,
   clos_count: Cell<usize>,
@@ -25,55 +75,135 @@ impl Arena {
     Self::default()
   }
 
-  /// Allocates a new term.
+  /// Runs `f` with a new region nested in `self`, which is freed afterwards. Surviving objects
+  /// must be relocated into `self` before returning. The chunks of freed regions are kept for
+  /// reuse by later regions on the same thread, instead of being returned to the system allocator.
+  pub fn region<T>(&self, f: impl FnOnce(&Arena) -> T) -> T {
+    let data = SPARE.with_borrow_mut(|spare| spare.pop()).unwrap_or_default();
+    let mut temp = Arena { data, usage: self.usage.child(), ..Arena::default() };
+    let res = f(&temp);
+    self.usage.merge(&temp.usage);
+    let mut data = take(&mut temp.data);
+    data.reset();
+    SPARE.with_borrow_mut(|spare| {
+      if spare.len() < SPARE_CHUNKS {
+        spare.push(data);
+      }
+    });
+    res
+  }
+
+  /// Records the size of a new allocation.
+  fn counted<'b, T: ?Sized>(&self, x: &'b mut T) -> &'b mut T {
+    self.usage.add(size_of_val(x));
+    x
+  }
+
+  /// Runs `f`, which relocates objects into `self`, copying objects reachable along several paths
+  /// only once. See [`Arena::relocate_term`] and friends.
+  pub fn copy_in<T>(&self, f: impl FnOnce() -> T) -> T {
+    self.forwarded.scope(f)
+  }
+
+  /// Returns the existing copy of a relocated object, or makes a new copy (and records it if
+  /// inside [`Arena::copy_in`]).
+  fn forward<'a, S, T>(&'a self, tag: u8, x: &S, copy: impl FnOnce() -> &'a T) -> &'a T {
+    // SAFETY: each tag is only used for one type of copies, which are allocated in this arena.
+    unsafe { self.forwarded.forward(tag, x, copy) }
+  }
+
+  /// Returns the existing copy of a relocated slice, or makes a new copy (and records it if
+  /// inside [`Arena::copy_in`]).
+  fn forward_slice<'a, S, T>(&'a self, tag: u8, xs: &[S], copy: impl FnOnce() -> &'a [T]) -> &'a [T] {
+    // SAFETY: as in `forward()`, copies of slices have the same lengths as their originals.
+    unsafe { self.forwarded.forward_slice(tag, xs, copy) }
+  }
+
+  /// Relocates a term into the arena, copying it only once inside [`Arena::copy_in`].
+  pub fn relocate_term<'a>(&'a self, term: &Term<'_>) -> &'a Term<'a> {
+    self.forward(0, term, || self.term(term.relocate(self)))
+  }
+
+  /// Relocates a value into the arena, copying it only once inside [`Arena::copy_in`].
+  pub fn relocate_val<'a>(&'a self, val: &Val<'_>) -> &'a Val<'a> {
+    self.forward(1, val, || self.val(val.relocate(self)))
+  }
+
+  /// Relocates a closure into the arena, copying it only once inside [`Arena::copy_in`].
+  pub fn relocate_clos<'a>(&'a self, clos: &Clos<'_>) -> &'a Clos<'a> {
+    self.forward(2, clos, || self.clos(clos.relocate(self)))
+  }
+
+  /// Relocates a stack item into the arena, copying it only once inside [`Arena::copy_in`].
+  pub fn relocate_frame<'a>(&'a self, stack: &Stack<'_>) -> &'a Stack<'a> {
+    self.forward(3, stack, || self.frame(stack.relocate(self)))
+  }
+
+  /// Allocates a new term. Universes and variables with small levels and indices are shared
+  /// instead, and not counted.
   pub fn term<'a>(&'a self, term: Term<'a>) -> &'a Term<'a> {
+    match term {
+      Term::Univ(v) if v < SMALL_UNIVS => return &SMALL_TERMS.0[v],
+      Term::Var(ix) if ix < SMALL_VARS => return &SMALL_TERMS.1[ix],
+      _ => {}
+    }
     self.term_count.set(self.term_count.get() + 1);
-    self.data.alloc(term)
+    self.counted(self.data.alloc(term))
   }
 
   /// Allocates a new array of terms for writing.
   pub fn terms(&self, len: usize) -> &mut [Term<'_>] {
     self.term_count.set(self.term_count.get() + len);
-    self.data.alloc_slice_fill_copy(len, Term::Univ(0))
+    self.counted(self.data.alloc_slice_fill_copy(len, Term::Univ(0)))
   }
 
-  /// Allocates a new value.
+  /// Allocates a new value. Universes and free variables with small levels are shared instead, and
+  /// not counted.
   pub fn val<'a>(&'a self, val: Val<'a>) -> &'a Val<'a> {
+    match val {
+      Val::Univ(v) if v < SMALL_UNIVS => return &SMALL_VALS.0[v],
+      Val::Free(i) if i < SMALL_VARS => return &SMALL_VALS.1[i],
+      _ => {}
+    }
     self.val_count.set(self.val_count.get() + 1);
-    self.data.alloc(val)
+    self.counted(self.data.alloc(val))
   }
 
   /// Allocates a new array of values for writing.
   pub fn values(&self, len: usize) -> &mut [Val<'_>] {
     self.val_count.set(self.val_count.get() + len);
-    self.data.alloc_slice_fill_copy(len, Val::Univ(0))
+    self.counted(self.data.alloc_slice_fill_copy(len, Val::Univ(0)))
   }
 
   /// Allocates a new closure.
   pub fn clos<'a>(&'a self, clos: Clos<'a>) -> &'a Clos<'a> {
     self.clos_count.set(self.clos_count.get() + 1);
-    self.data.alloc(clos)
+    self.counted(self.data.alloc(clos))
   }
 
   /// Allocates a new array of closures for writing.
   pub fn closures(&self, len: usize) -> &mut [Clos<'_>] {
     self.clos_count.set(self.clos_count.get() + len);
-    self.data.alloc_slice_fill_clone(len, &Clos { env: Stack::Nil, body: &Term::Univ(0) })
+    self.counted(self.data.alloc_slice_fill_clone(len, &Clos { env: Stack::Nil, body: &Term::Univ(0) }))
   }
 
   /// Allocates a new stack item.
   pub fn frame<'a>(&'a self, stack: Stack<'a>) -> &'a Stack<'a> {
     self.frame_count.set(self.frame_count.get() + 1);
-    self.data.alloc(stack)
+    self.counted(self.data.alloc(stack))
   }
 
-  /// Increments the stack lookup counter for profiling.
+  /// Increments the stack lookup counter for profiling, if enabled.
+  #[inline(always)]
   pub fn inc_lookup_count(&self) {
+    #[cfg(feature = "profiling")]
     self.lookup_count.set(self.lookup_count.get() + 1);
   }
 
-  /// Increments the stack lookup length counter for profiling.
+  /// Increments the stack lookup length counter for profiling, if enabled.
+  #[inline(always)]
   pub fn inc_link_count(&self) {
+    #[cfg(feature = "profiling")]
     self.link_count.set(self.link_count.get() + 1);
   }
 
@@ -107,9 +237,40 @@ impl Arena {
     self.link_count.get() as f32 / self.lookup_count.get().max(1) as f32
   }
 
+  /// Sets or removes the limit on the number of bytes live in the arena and the regions it is nested
+  /// in, which is inherited by regions created afterwards. There is no limit by default. Allocations
+  /// do not fail, but once over the limit, evaluation, inference and checking stop with
+  /// [`EvalError::OutOfMemory`] at the next (β) step or quoted value.
+  pub fn set_byte_limit(&self, limit: Option<usize>) {
+    self.usage.set_limit(limit);
+  }
+
+  /// Returns the limit on the number of bytes live in the arena and the regions it is nested in.
+  pub fn byte_limit(&self) -> Option<usize> {
+    self.usage.limit()
+  }
+
+  /// Returns if the bytes live in the arena and the regions it is nested in are over the limit.
+  #[inline]
+  pub fn over_byte_limit(&self) -> bool {
+    self.usage.exceeded()
+  }
+
+  /// Returns the number of bytes allocated in the arena.
+  pub fn byte_count(&self) -> usize {
+    self.usage.bytes()
+  }
+
+  /// Returns the peak number of bytes live in the arena, the regions it is nested in and regions
+  /// nested in it.
+  pub fn peak_bytes(&self) -> usize {
+    self.usage.peak()
+  }
+
   /// Deallocates all objects and resets all performance counters.
   pub fn reset(&mut self) {
     self.data.reset();
+    self.usage.reset();
     self.term_count.set(0);
     self.val_count.set(0);
     self.clos_count.set(0);
@@ -123,30 +284,30 @@ impl Term<'_> {
   /// Clones `self` to given arena.
   pub fn relocate<'a>(&self, ar: &'a Arena) -> Term<'a> {
     match self {
-      Term::Gc(x) => Term::Gc(ar.term(x.relocate(ar))),
+      Term::Gc(x) => Term::Gc(ar.relocate_term(x)),
       Term::Univ(v) => Term::Univ(*v),
       Term::Var(ix) => Term::Var(*ix),
-      Term::Ann(x, t) => Term::Ann(ar.term(x.relocate(ar)), ar.term(t.relocate(ar))),
-      Term::Let(v, x) => Term::Let(ar.term(v.relocate(ar)), ar.term(x.relocate(ar))),
-      Term::Pi(t, u) => Term::Pi(ar.term(t.relocate(ar)), ar.term(u.relocate(ar))),
-      Term::Fun(b) => Term::Fun(ar.term(b.relocate(ar))),
-      Term::App(f, x) => Term::App(ar.term(f.relocate(ar)), ar.term(x.relocate(ar))),
-      Term::Sig(us) => {
+      Term::Ann(x, t) => Term::Ann(ar.relocate_term(x), ar.relocate_term(t)),
+      Term::Let(v, x) => Term::Let(ar.relocate_term(v), ar.relocate_term(x)),
+      Term::Pi(t, u) => Term::Pi(ar.relocate_term(t), ar.relocate_term(u)),
+      Term::Fun(b) => Term::Fun(ar.relocate_term(b)),
+      Term::App(f, x) => Term::App(ar.relocate_term(f), ar.relocate_term(x)),
+      Term::Sig(us) => Term::Sig(ar.forward_slice(4, us, || {
         let terms = ar.terms(us.len());
         for (term, u) in terms.iter_mut().zip(us.iter()) {
           *term = u.relocate(ar);
         }
-        Term::Sig(terms)
-      }
-      Term::Tup(bs) => {
+        terms
+      })),
+      Term::Tup(bs) => Term::Tup(ar.forward_slice(4, bs, || {
         let terms = ar.terms(bs.len());
         for (term, b) in terms.iter_mut().zip(bs.iter()) {
           *term = b.relocate(ar);
         }
-        Term::Tup(terms)
-      }
-      Term::Init(n, x) => Term::Init(*n, ar.term(x.relocate(ar))),
-      Term::Proj(n, x) => Term::Proj(*n, ar.term(x.relocate(ar))),
+        terms
+      })),
+      Term::Init(n, x) => Term::Init(*n, ar.relocate_term(x)),
+      Term::Proj(n, x) => Term::Proj(*n, ar.relocate_term(x)),
     }
   }
 }
@@ -157,25 +318,34 @@ impl Val<'_> {
     match self {
       Val::Univ(v) => Val::Univ(*v),
       Val::Free(i) => Val::Free(*i),
-      Val::Pi(t, u) => Val::Pi(ar.val(t.relocate(ar)), ar.clos(u.relocate(ar))),
-      Val::Fun(b) => Val::Fun(ar.clos(b.relocate(ar))),
-      Val::App(f, x) => Val::App(ar.val(f.relocate(ar)), ar.val(x.relocate(ar))),
-      Val::Sig(us) => {
+      Val::Pi(t, u) => Val::Pi(ar.relocate_val(t), ar.relocate_clos(u)),
+      Val::Fun(b) => Val::Fun(ar.relocate_clos(b)),
+      Val::App(f, xs) => Val::App(
+        ar.relocate_val(f),
+        ar.forward_slice(6, xs, || {
+          let values = ar.values(xs.len());
+          for (value, x) in values.iter_mut().zip(xs.iter()) {
+            *value = x.relocate(ar);
+          }
+          values
+        }),
+      ),
+      Val::Sig(us) => Val::Sig(ar.forward_slice(5, us, || {
         let closures = ar.closures(us.len());
         for (closure, u) in closures.iter_mut().zip(us.iter()) {
           *closure = u.relocate(ar);
         }
-        Val::Sig(closures)
-      }
-      Val::Tup(bs) => {
+        closures
+      })),
+      Val::Tup(bs) => Val::Tup(ar.forward_slice(6, bs, || {
         let values = ar.values(bs.len());
         for (value, b) in values.iter_mut().zip(bs.iter()) {
           *value = b.relocate(ar);
         }
-        Val::Tup(values)
-      }
-      Val::Init(n, x) => Val::Init(*n, ar.val(x.relocate(ar))),
-      Val::Proj(n, x) => Val::Proj(*n, ar.val(x.relocate(ar))),
+        values
+      })),
+      Val::Init(n, x) => Val::Init(*n, ar.relocate_val(x)),
+      Val::Proj(n, x) => Val::Proj(*n, ar.relocate_val(x)),
     }
   }
 }
@@ -184,7 +354,7 @@ impl Clos<'_> {
   /// Clones `self` to given arena.
   pub fn relocate<'a>(&self, ar: &'a Arena) -> Clos<'a> {
     let Self { env, body } = self;
-    Clos { env: env.relocate(ar), body: ar.term(body.relocate(ar)) }
+    Clos { env: env.relocate(ar), body: ar.relocate_term(body) }
   }
 }
 
@@ -193,7 +363,7 @@ impl Stack<'_> {
   pub fn relocate<'a>(&self, ar: &'a Arena) -> Stack<'a> {
     match self {
       Stack::Nil => Stack::Nil,
-      Stack::Cons { prev, value } => Stack::Cons { prev: ar.frame(prev.relocate(ar)), value: value.relocate(ar) },
+      Stack::Cons { prev, value, .. } => Stack::cons(ar.relocate_frame(prev), value.relocate(ar)),
     }
   }
 }
@@ -0,0 +1,641 @@
+//! # Compact node layout
+//!
+//! An alternative representation of kernel terms and values, where nodes are `u32` indices into
+//! typed vectors inside an [`Arena`] instead of references, laid out as structs of arrays: one
+//! array for the tags and one for each operand. Universe levels, de Bruijn indices and levels, and
+//! tuple lengths are also `u32`. Each term or value node therefore takes 9 bytes, against 24 bytes
+//! for a [`kernel::Term`] or [`kernel::Val`], and conversion checking walks dense arrays.
+//!
+//! Only evaluation, quotation and conversion checking are implemented, which is where arena growth
+//! dominates. Terms are lowered from [`kernel::Term`] (dropping garbage collection marks, as nodes
+//! are never relocated) and raised back for printing and comparison against the reference kernel.
+
+use std::mem::size_of;
+
+use crate::kernel;
+
+/// # Term handles
+///
+/// Index of a term node in an [`Arena`].
+#[derive(Debug, Clone, Copy, PartialEq, Eq, Hash)]
+pub struct Term(u32);
+
+/// # Value handles
+///
+/// Index of a value node in an [`Arena`].
+#[derive(Debug, Clone, Copy, PartialEq, Eq, Hash)]
+pub struct Val(u32);
+
+/// # Closure handles
+///
+/// Index of a closure in an [`Arena`]. The closures of a tuple type are allocated contiguously.
+#[derive(Debug, Clone, Copy, PartialEq, Eq, Hash)]
+pub struct Clos(u32);
+
+/// # Stack handles
+///
+/// Index of the top frame of a linked list stack in an [`Arena`]. Frame `0` is the empty stack.
+#[derive(Debug, Clone, Copy, PartialEq, Eq, Hash)]
+pub struct Stack(u32);
+
+/// # Operand lists
+///
+/// Ranges of operands of tuple types and constructors, as (start, length).
+#[derive(Debug, Clone, Copy, PartialEq, Eq, Hash)]
+pub struct List(u32, u32);
+
+/// # Term nodes
+///
+/// Unpacked [`Term`] nodes, with the same variants as [`kernel::Term`] except garbage collection
+/// marks. Elements of tuple types and constructors are in [`Arena::term_at`].
+#[derive(Debug, Clone, Copy)]
+pub enum TermNode {
+  Univ(u32),
+  Var(u32),
+  Ann(Term, Term),
+  Let(Term, Term),
+  Pi(Term, Term),
+  Fun(Term),
+  App(Term, Term),
+  Sig(List),
+  Tup(List),
+  Init(u32, Term),
+  Proj(u32, Term),
+}
+
+/// # Value nodes
+///
+/// Unpacked [`Val`] nodes, with the same variants as [`kernel::Val`]. Element types of tuple types
+/// are consecutive closures starting at the given one, and element values of tuple constructors are
+/// in [`Arena::val_at`].
+#[derive(Debug, Clone, Copy)]
+pub enum ValNode {
+  Univ(u32),
+  Free(u32),
+  Pi(Val, Clos),
+  Fun(Clos),
+  App(Val, Val),
+  Sig(Clos, u32),
+  Tup(List),
+  Init(u32, Val),
+  Proj(u32, Val),
+}
+
+/// # Arena marks
+///
+/// Numbers of nodes in each vector of an [`Arena`] at some point, see [`Arena::release`].
+#[derive(Debug, Clone, Copy, PartialEq, Eq)]
+pub struct Mark([usize; 6]);
+
+/// # Tags
+#[derive(Debug, Clone, Copy, PartialEq, Eq)]
+#[repr(u8)]
+enum Tag {
+  Univ,
+  Var,
+  Ann,
+  Let,
+  Pi,
+  Fun,
+  App,
+  Sig,
+  Tup,
+  Init,
+  Proj,
+}
+
+/// # Evaluation errors
+///
+/// Same as [`kernel::EvalError`], but tuples are only described by their sizes.
+#[derive(Debug, Clone)]
+pub enum EvalError {
+  EnvIndex { ix: u32, len: u32 },
+  GenLevel { lvl: u32, len: u32 },
+  TupInit { n: u32, len: u32 },
+  TupProj { n: u32, len: u32 },
+}
+
+/// # Arena allocators
+///
+/// Typed vectors holding the nodes of [`Term`], [`Val`], [`Clos`] and [`Stack`]. Indices never
+/// exceed `u32::MAX`; allocating more nodes panics.
+#[derive(Debug)]
+pub struct Arena {
+  term_tags: Vec<Tag>,
+  term_lhs: Vec<u32>,
+  term_rhs: Vec<u32>,
+  term_lists: Vec<u32>,
+  val_tags: Vec<Tag>,
+  val_lhs: Vec<u32>,
+  val_rhs: Vec<u32>,
+  val_lists: Vec<u32>,
+  clos_env: Vec<u32>,
+  clos_body: Vec<u32>,
+  frame_prev: Vec<u32>,
+  frame_value: Vec<u32>,
+  frame_len: Vec<u32>,
+}
+
+/// Converts a vector length into an index.
+fn index(len: usize) -> u32 {
+  u32::try_from(len).expect("compact arena index overflow")
+}
+
+impl Default for Arena {
+  fn default() -> Self {
+    Self::new()
+  }
+}
+
+impl Arena {
+  /// Creates an empty arena.
+  pub fn new() -> Self {
+    Self {
+      term_tags: Vec::new(),
+      term_lhs: Vec::new(),
+      term_rhs: Vec::new(),
+      term_lists: Vec::new(),
+      val_tags: Vec::new(),
+      val_lhs: Vec::new(),
+      val_rhs: Vec::new(),
+      val_lists: Vec::new(),
+      clos_env: Vec::new(),
+      clos_body: Vec::new(),
+      frame_prev: vec![0],
+      frame_value: vec![0],
+      frame_len: vec![0],
+    }
+  }
+
+  /// Allocates a new term.
+  pub fn term(&mut self, node: TermNode) -> Term {
+    let (tag, lhs, rhs) = match node {
+      TermNode::Univ(v) => (Tag::Univ, v, 0),
+      TermNode::Var(ix) => (Tag::Var, ix, 0),
+      TermNode::Ann(x, t) => (Tag::Ann, x.0, t.0),
+      TermNode::Let(v, x) => (Tag::Let, v.0, x.0),
+      TermNode::Pi(t, u) => (Tag::Pi, t.0, u.0),
+      TermNode::Fun(b) => (Tag::Fun, b.0, 0),
+      TermNode::App(f, x) => (Tag::App, f.0, x.0),
+      TermNode::Sig(List(start, len)) => (Tag::Sig, start, len),
+      TermNode::Tup(List(start, len)) => (Tag::Tup, start, len),
+      TermNode::Init(n, x) => (Tag::Init, n, x.0),
+      TermNode::Proj(n, x) => (Tag::Proj, n, x.0),
+    };
+    let res = Term(index(self.term_tags.len()));
+    self.term_tags.push(tag);
+    self.term_lhs.push(lhs);
+    self.term_rhs.push(rhs);
+    res
+  }
+
+  /// Allocates a new list of terms for writing with [`Arena::set_term_at`].
+  pub fn terms(&mut self, len: u32) -> List {
+    let start = index(self.term_lists.len());
+    self.term_lists.resize(self.term_lists.len() + len as usize, 0);
+    List(start, len)
+  }
+
+  /// Returns the `i`-th term in a list.
+  pub fn term_at(&self, list: List, i: u32) -> Term {
+    Term(self.term_lists[(list.0 + i) as usize])
+  }
+
+  /// Sets the `i`-th term in a list.
+  pub fn set_term_at(&mut self, list: List, i: u32, term: Term) {
+    self.term_lists[(list.0 + i) as usize] = term.0;
+  }
+
+  /// Allocates a new value.
+  pub fn val(&mut self, node: ValNode) -> Val {
+    let (tag, lhs, rhs) = match node {
+      ValNode::Univ(v) => (Tag::Univ, v, 0),
+      ValNode::Free(i) => (Tag::Var, i, 0),
+      ValNode::Pi(t, u) => (Tag::Pi, t.0, u.0),
+      ValNode::Fun(b) => (Tag::Fun, b.0, 0),
+      ValNode::App(f, x) => (Tag::App, f.0, x.0),
+      ValNode::Sig(Clos(start), len) => (Tag::Sig, start, len),
+      ValNode::Tup(List(start, len)) => (Tag::Tup, start, len),
+      ValNode::Init(n, x) => (Tag::Init, n, x.0),
+      ValNode::Proj(n, x) => (Tag::Proj, n, x.0),
+    };
+    let res = Val(index(self.val_tags.len()));
+    self.val_tags.push(tag);
+    self.val_lhs.push(lhs);
+    self.val_rhs.push(rhs);
+    res
+  }
+
+  /// Allocates a new list of values for writing with [`Arena::set_val_at`].
+  pub fn values(&mut self, len: u32) -> List {
+    let start = index(self.val_lists.len());
+    self.val_lists.resize(self.val_lists.len() + len as usize, 0);
+    List(start, len)
+  }
+
+  /// Returns the `i`-th value in a list.
+  pub fn val_at(&self, list: List, i: u32) -> Val {
+    Val(self.val_lists[(list.0 + i) as usize])
+  }
+
+  /// Sets the `i`-th value in a list.
+  pub fn set_val_at(&mut self, list: List, i: u32, val: Val) {
+    self.val_lists[(list.0 + i) as usize] = val.0;
+  }
+
+  /// Allocates a new closure.
+  pub fn clos(&mut self, env: Stack, body: Term) -> Clos {
+    let res = Clos(index(self.clos_env.len()));
+    self.clos_env.push(env.0);
+    self.clos_body.push(body.0);
+    res
+  }
+
+  /// Allocates a new stack frame.
+  pub fn frame(&mut self, prev: Stack, value: Val) -> Stack {
+    let res = Stack(index(self.frame_prev.len()));
+    let len = self.frame_len[prev.0 as usize] + 1;
+    self.frame_prev.push(prev.0);
+    self.frame_value.push(value.0);
+    self.frame_len.push(len);
+    res
+  }
+
+  /// Returns the number of terms in the arena.
+  pub fn term_count(&self) -> usize {
+    self.term_tags.len() + self.term_lists.len()
+  }
+
+  /// Returns the number of values in the arena.
+  pub fn val_count(&self) -> usize {
+    self.val_tags.len() + self.val_lists.len()
+  }
+
+  /// Returns the number of closures in the arena.
+  pub fn clos_count(&self) -> usize {
+    self.clos_env.len()
+  }
+
+  /// Returns the number of frames in the arena, excluding the empty stack.
+  pub fn frame_count(&self) -> usize {
+    self.frame_prev.len() - 1
+  }
+
+  /// Returns the number of bytes used by all nodes in the arena.
+  pub fn byte_count(&self) -> usize {
+    let word = size_of::<u32>();
+    self.term_tags.len() * (size_of::<Tag>() + 2 * word)
+      + self.val_tags.len() * (size_of::<Tag>() + 2 * word)
+      + (self.term_lists.len() + self.val_lists.len()) * word
+      + self.clos_env.len() * 2 * word
+      + self.frame_prev.len() * 3 * word
+  }
+
+  /// Returns the current numbers of nodes.
+  pub fn mark(&self) -> Mark {
+    Mark([
+      self.term_tags.len(),
+      self.term_lists.len(),
+      self.val_tags.len(),
+      self.val_lists.len(),
+      self.clos_env.len(),
+      self.frame_prev.len(),
+    ])
+  }
+
+  /// Deallocates all objects allocated since `mark` was taken. Their handles become invalid.
+  pub fn release(&mut self, mark: Mark) {
+    let Mark([terms, term_lists, vals, val_lists, closures, frames]) = mark;
+    self.term_tags.truncate(terms);
+    self.term_lhs.truncate(terms);
+    self.term_rhs.truncate(terms);
+    self.term_lists.truncate(term_lists);
+    self.val_tags.truncate(vals);
+    self.val_lhs.truncate(vals);
+    self.val_rhs.truncate(vals);
+    self.val_lists.truncate(val_lists);
+    self.clos_env.truncate(closures);
+    self.clos_body.truncate(closures);
+    self.frame_prev.truncate(frames);
+    self.frame_value.truncate(frames);
+    self.frame_len.truncate(frames);
+  }
+
+  /// Deallocates all objects.
+  pub fn reset(&mut self) {
+    *self = Self::new();
+  }
+}
+
+impl Term {
+  /// Unpacks the node.
+  pub fn node(self, ar: &Arena) -> TermNode {
+    let i = self.0 as usize;
+    let (lhs, rhs) = (ar.term_lhs[i], ar.term_rhs[i]);
+    match ar.term_tags[i] {
+      Tag::Univ => TermNode::Univ(lhs),
+      Tag::Var => TermNode::Var(lhs),
+      Tag::Ann => TermNode::Ann(Term(lhs), Term(rhs)),
+      Tag::Let => TermNode::Let(Term(lhs), Term(rhs)),
+      Tag::Pi => TermNode::Pi(Term(lhs), Term(rhs)),
+      Tag::Fun => TermNode::Fun(Term(lhs)),
+      Tag::App => TermNode::App(Term(lhs), Term(rhs)),
+      Tag::Sig => TermNode::Sig(List(lhs, rhs)),
+      Tag::Tup => TermNode::Tup(List(lhs, rhs)),
+      Tag::Init => TermNode::Init(lhs, Term(rhs)),
+      Tag::Proj => TermNode::Proj(lhs, Term(rhs)),
+    }
+  }
+
+  /// Copies a reference-based term into the arena. Garbage collection marks are dropped.
+  pub fn lower(term: &kernel::Term<'_>, ar: &mut Arena) -> Term {
+    let node = match term {
+      kernel::Term::Gc(x) => return Term::lower(x, ar),
+      kernel::Term::Univ(v) => TermNode::Univ(index(*v)),
+      kernel::Term::Var(ix) => TermNode::Var(index(*ix)),
+      kernel::Term::Ann(x, t) => TermNode::Ann(Term::lower(x, ar), Term::lower(t, ar)),
+      kernel::Term::Let(v, x) => TermNode::Let(Term::lower(v, ar), Term::lower(x, ar)),
+      kernel::Term::Pi(t, u) => TermNode::Pi(Term::lower(t, ar), Term::lower(u, ar)),
+      kernel::Term::Fun(b) => TermNode::Fun(Term::lower(b, ar)),
+      kernel::Term::App(f, x) => TermNode::App(Term::lower(f, ar), Term::lower(x, ar)),
+      kernel::Term::Sig(us) => TermNode::Sig(Term::lower_list(us, ar)),
+      kernel::Term::Tup(bs) => TermNode::Tup(Term::lower_list(bs, ar)),
+      kernel::Term::Init(n, x) => TermNode::Init(index(*n), Term::lower(x, ar)),
+      kernel::Term::Proj(n, x) => TermNode::Proj(index(*n), Term::lower(x, ar)),
+    };
+    ar.term(node)
+  }
+
+  /// Copies reference-based terms into a list in the arena.
+  fn lower_list(terms: &[kernel::Term<'_>], ar: &mut Arena) -> List {
+    let list = ar.terms(index(terms.len()));
+    for (i, term) in terms.iter().enumerate() {
+      let term = Term::lower(term, ar);
+      ar.set_term_at(list, index(i), term);
+    }
+    list
+  }
+
+  /// Copies `self` into a reference-based term in arena `dst`.
+  pub fn raise<'b>(self, ar: &Arena, dst: &'b kernel::Arena) -> kernel::Term<'b> {
+    let raise_list = |list: List, dst: &'b kernel::Arena| {
+      let terms = dst.terms(list.1 as usize);
+      for (i, term) in terms.iter_mut().enumerate() {
+        *term = ar.term_at(list, index(i)).raise(ar, dst);
+      }
+      &*terms
+    };
+    match self.node(ar) {
+      TermNode::Univ(v) => kernel::Term::Univ(v as usize),
+      TermNode::Var(ix) => kernel::Term::Var(ix as usize),
+      TermNode::Ann(x, t) => kernel::Term::Ann(dst.term(x.raise(ar, dst)), dst.term(t.raise(ar, dst))),
+      TermNode::Let(v, x) => kernel::Term::Let(dst.term(v.raise(ar, dst)), dst.term(x.raise(ar, dst))),
+      TermNode::Pi(t, u) => kernel::Term::Pi(dst.term(t.raise(ar, dst)), dst.term(u.raise(ar, dst))),
+      TermNode::Fun(b) => kernel::Term::Fun(dst.term(b.raise(ar, dst))),
+      TermNode::App(f, x) => kernel::Term::App(dst.term(f.raise(ar, dst)), dst.term(x.raise(ar, dst))),
+      TermNode::Sig(us) => kernel::Term::Sig(raise_list(us, dst)),
+      TermNode::Tup(bs) => kernel::Term::Tup(raise_list(bs, dst)),
+      TermNode::Init(n, x) => kernel::Term::Init(n as usize, dst.term(x.raise(ar, dst))),
+      TermNode::Proj(n, x) => kernel::Term::Proj(n as usize, dst.term(x.raise(ar, dst))),
+    }
+  }
+
+  /// Reduces `self` so that all `let`s are collected into the environment and then frozen at
+  /// binders. Same as [`kernel::Term::eval`].
+  ///
+  /// Pre-conditions:
+  ///
+  /// - `self` is well-typed under a context and environment `env` (to ensure termination).
+  pub fn eval(self, env: Stack, ar: &mut Arena) -> Result<Val, EvalError> {
+    match self.node(ar) {
+      TermNode::Univ(v) => Ok(ar.val(ValNode::Univ(v))),
+      TermNode::Var(ix) => env.get(ix, ar).ok_or(EvalError::EnvIndex { ix, len: env.len(ar) }),
+      TermNode::Ann(x, _) => x.eval(env, ar),
+      TermNode::Let(v, x) => {
+        let v = v.eval(env, ar)?;
+        let env = ar.frame(env, v);
+        x.eval(env, ar)
+      }
+      TermNode::Pi(t, u) => {
+        let t = t.eval(env, ar)?;
+        let u = ar.clos(env, u);
+        Ok(ar.val(ValNode::Pi(t, u)))
+      }
+      TermNode::Fun(b) => {
+        let b = ar.clos(env, b);
+        Ok(ar.val(ValNode::Fun(b)))
+      }
+      TermNode::App(f, x) => {
+        let (f, x) = (f.eval(env, ar)?, x.eval(env, ar)?);
+        match f.node(ar) {
+          ValNode::Fun(b) => b.apply(x, ar),
+          _ => Ok(ar.val(ValNode::App(f, x))),
+        }
+      }
+      TermNode::Sig(us) => {
+        let start = Clos(index(ar.clos_env.len()));
+        for i in 0..us.1 {
+          let u = ar.term_at(us, i);
+          ar.clos(env, u);
+        }
+        Ok(ar.val(ValNode::Sig(start, us.1)))
+      }
+      TermNode::Tup(bs) => {
+        let vs = ar.values(bs.1);
+        for i in 0..bs.1 {
+          let a = ar.val(ValNode::Tup(List(vs.0, i)));
+          let env = ar.frame(env, a);
+          let b = ar.term_at(bs, i).eval(env, ar)?;
+          ar.set_val_at(vs, i, b);
+        }
+        Ok(ar.val(ValNode::Tup(vs)))
+      }
+      TermNode::Init(n, x) => {
+        let x = x.eval(env, ar)?;
+        match x.node(ar) {
+          ValNode::Init(m, y) => Ok(ar.val(ValNode::Init(n + m, y))),
+          ValNode::Tup(List(start, len)) => {
+            let m = len.checked_sub(n).ok_or(EvalError::TupInit { n, len })?;
+            Ok(ar.val(ValNode::Tup(List(start, m))))
+          }
+          _ => Ok(ar.val(ValNode::Init(n, x))),
+        }
+      }
+      TermNode::Proj(n, x) => {
+        let x = x.eval(env, ar)?;
+        match x.node(ar) {
+          ValNode::Init(m, y) => Ok(ar.val(ValNode::Proj(n + m, y))),
+          ValNode::Tup(bs) => {
+            let i = bs.1.checked_sub(n + 1).ok_or(EvalError::TupProj { n, len: bs.1 })?;
+            Ok(ar.val_at(bs, i))
+          }
+          _ => Ok(ar.val(ValNode::Proj(n, x))),
+        }
+      }
+    }
+  }
+}
+
+impl Clos {
+  /// Extends the frozen environment with `x` and reduces the body. Same as [`kernel::Clos::apply`].
+  pub fn apply(self, x: Val, ar: &mut Arena) -> Result<Val, EvalError> {
+    let i = self.0 as usize;
+    let (env, body) = (Stack(ar.clos_env[i]), Term(ar.clos_body[i]));
+    let env = ar.frame(env, x);
+    body.eval(env, ar)
+  }
+
+  /// Applies `self` to a fresh free variable at level `len`.
+  fn apply_free(self, len: u32, ar: &mut Arena) -> Result<Val, EvalError> {
+    let x = ar.val(ValNode::Free(len));
+    self.apply(x, ar)
+  }
+
+  /// Returns the `i`-th closure after `self`, for element types of tuple types.
+  fn offset(self, i: u32) -> Clos {
+    Clos(self.0 + i)
+  }
+}
+
+impl Stack {
+  /// Creates an empty stack.
+  pub fn new(_: &Arena) -> Self {
+    Stack(0)
+  }
+
+  /// Returns the length of the stack.
+  pub fn len(self, ar: &Arena) -> u32 {
+    ar.frame_len[self.0 as usize]
+  }
+
+  /// Returns if the stack is empty.
+  pub fn is_empty(self) -> bool {
+    self.0 == 0
+  }
+
+  /// Returns the value at the given de Bruijn index, if it exists.
+  pub fn get(self, ix: u32, ar: &Arena) -> Option<Val> {
+    let mut curr = self.0 as usize;
+    for _ in 0..ix {
+      if curr == 0 {
+        return None;
+      }
+      curr = ar.frame_prev[curr] as usize;
+    }
+    (curr != 0).then(|| Val(ar.frame_value[curr]))
+  }
+}
+
+impl Val {
+  /// Unpacks the node.
+  pub fn node(self, ar: &Arena) -> ValNode {
+    let i = self.0 as usize;
+    let (lhs, rhs) = (ar.val_lhs[i], ar.val_rhs[i]);
+    match ar.val_tags[i] {
+      Tag::Univ => ValNode::Univ(lhs),
+      Tag::Var => ValNode::Free(lhs),
+      Tag::Pi => ValNode::Pi(Val(lhs), Clos(rhs)),
+      Tag::Fun => ValNode::Fun(Clos(lhs)),
+      Tag::App => ValNode::App(Val(lhs), Val(rhs)),
+      Tag::Sig => ValNode::Sig(Clos(lhs), rhs),
+      Tag::Tup => ValNode::Tup(List(lhs, rhs)),
+      Tag::Init => ValNode::Init(lhs, Val(rhs)),
+      Tag::Proj => ValNode::Proj(lhs, Val(rhs)),
+      Tag::Ann | Tag::Let => unreachable!(),
+    }
+  }
+
+  /// Reduces well-typed `self` to eliminate `let`s and convert it back into a [`Term`]. Same as
+  /// [`kernel::Val::quote`].
+  ///
+  /// Pre-conditions:
+  ///
+  /// - `self` is well-typed under a context with size `len` (to ensure termination).
+  pub fn quote(self, len: u32, ar: &mut Arena) -> Result<Term, EvalError> {
+    let node = match self.node(ar) {
+      ValNode::Univ(v) => TermNode::Univ(v),
+      ValNode::Free(i) => TermNode::Var(len.checked_sub(i + 1).ok_or(EvalError::GenLevel { lvl: i, len })?),
+      ValNode::Pi(t, u) => {
+        let t = t.quote(len, ar)?;
+        let u = u.apply_free(len, ar)?.quote(len + 1, ar)?;
+        TermNode::Pi(t, u)
+      }
+      ValNode::Fun(b) => TermNode::Fun(b.apply_free(len, ar)?.quote(len + 1, ar)?),
+      ValNode::App(f, x) => {
+        let (f, x) = (f.quote(len, ar)?, x.quote(len, ar)?);
+        TermNode::App(f, x)
+      }
+      ValNode::Sig(us, n) => {
+        let terms = ar.terms(n);
+        for i in 0..n {
+          let u = us.offset(i).apply_free(len, ar)?.quote(len + 1, ar)?;
+          ar.set_term_at(terms, i, u);
+        }
+        TermNode::Sig(terms)
+      }
+      ValNode::Tup(bs) => {
+        let terms = ar.terms(bs.1);
+        for i in 0..bs.1 {
+          let b = ar.val_at(bs, i).quote(len + 1, ar)?;
+          ar.set_term_at(terms, i, b);
+        }
+        TermNode::Tup(terms)
+      }
+      ValNode::Init(n, x) => TermNode::Init(n, x.quote(len, ar)?),
+      ValNode::Proj(n, x) => TermNode::Proj(n, x.quote(len, ar)?),
+    };
+    Ok(ar.term(node))
+  }
+
+  /// Returns if `self` and `other` are definitionally equal. Same as [`kernel::Val::conv`], with
+  /// equal handles as the constant-time fast path.
+  ///
+  /// Pre-conditions:
+  ///
+  /// - `self` and `other` are well-typed under a context with size `len` (to ensure termination).
+  pub fn conv(self, other: Val, len: u32, ar: &mut Arena) -> Result<bool, EvalError> {
+    if self == other {
+      return Ok(true);
+    }
+    match (self.node(ar), other.node(ar)) {
+      (ValNode::Univ(v), ValNode::Univ(w)) => Ok(v == w),
+      (ValNode::Free(i), ValNode::Free(j)) => Ok(i == j),
+      (ValNode::Pi(t, v), ValNode::Pi(u, w)) => {
+        Ok(t.conv(u, len, ar)? && v.apply_free(len, ar)?.conv(w.apply_free(len, ar)?, len + 1, ar)?)
+      }
+      (ValNode::Fun(b), ValNode::Fun(c)) => b.apply_free(len, ar)?.conv(c.apply_free(len, ar)?, len + 1, ar),
+      (ValNode::App(f, x), ValNode::App(g, y)) => Ok(f.conv(g, len, ar)? && x.conv(y, len, ar)?),
+      (ValNode::Sig(us, n), ValNode::Sig(vs, m)) if n == m => {
+        for i in 0..n {
+          let (u, v) = (us.offset(i).apply_free(len, ar)?, vs.offset(i).apply_free(len, ar)?);
+          if !u.conv(v, len + 1, ar)? {
+            return Ok(false);
+          }
+        }
+        Ok(true)
+      }
+      (ValNode::Tup(bs), ValNode::Tup(cs)) if bs.1 == cs.1 => {
+        for i in 0..bs.1 {
+          if !ar.val_at(bs, i).conv(ar.val_at(cs, i), len, ar)? {
+            return Ok(false);
+          }
+        }
+        Ok(true)
+      }
+      (ValNode::Init(n, x), ValNode::Init(m, y)) => Ok(n == m && x.conv(y, len, ar)?),
+      (ValNode::Proj(n, x), ValNode::Proj(m, y)) => Ok(n == m && x.conv(y, len, ar)?),
+      _ => Ok(false),
+    }
+  }
+}
+
+impl std::fmt::Display for EvalError {
+  fn fmt(&self, f: &mut std::fmt::Formatter<'_>) -> std::fmt::Result {
+    match self {
+      Self::EnvIndex { ix, len } => write!(f, "variable index {ix} out of bound, environment has size {len}"),
+      Self::GenLevel { lvl, len } => write!(f, "generic variable level {lvl} out of bound, environment has size {len}"),
+      Self::TupInit { n, len } => write!(f, "tuple prefix length {n} out of bound, tuple has size {len}"),
+      Self::TupProj { n, len } => write!(f, "tuple index {n} out of bound, tuple has size {len}"),
+    }
+  }
+}
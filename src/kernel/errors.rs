@@ -7,8 +7,19 @@ use super::*;
 pub enum EvalError<'a> {
   EnvIndex { ix: usize, len: usize },
   GenLevel { lvl: usize, len: usize },
-  TupInit { n: usize, val: &'a Term<'a> },
-  TupProj { n: usize, val: &'a Term<'a> },
+  TupInit { n: usize, val: Quoted<'a> },
+  TupProj { n: usize, val: Quoted<'a> },
+  OutOfMemory { limit: usize },
+}
+
+/// # Lazily quoted values
+///
+/// Values in error payloads, together with the sizes of their contexts. They are quoted only when
+/// the error is displayed, so that failed checks which are recovered from do not pay for quoting.
+#[derive(Debug, Clone, Copy)]
+pub struct Quoted<'a> {
+  pub val: Val<'a>,
+  pub len: usize,
 }
 
 /// # Typing errors
@@ -21,15 +32,15 @@ pub enum TypeError<'a> {
   PiForm { from: usize, to: usize },
   SigForm { fst: usize, snd: usize },
   CtxIndex { ix: usize, len: usize },
-  SigInit { n: usize, ty: &'a Term<'a> },
-  SigProj { n: usize, ty: &'a Term<'a> },
+  SigInit { n: usize, ty: Quoted<'a> },
+  SigProj { n: usize, ty: Quoted<'a> },
   AnnExpected { term: &'a Term<'a> },
-  TypeExpected { term: &'a Term<'a>, ty: &'a Term<'a> },
-  PiExpected { term: &'a Term<'a>, ty: &'a Term<'a> },
-  SigExpected { term: &'a Term<'a>, ty: &'a Term<'a> },
-  PiAnnExpected { ty: &'a Term<'a> },
-  SigAnnExpected { ty: &'a Term<'a> },
-  TypeMismatch { term: &'a Term<'a>, ty: &'a Term<'a>, ety: &'a Term<'a> },
+  TypeExpected { term: &'a Term<'a>, ty: Quoted<'a> },
+  PiExpected { term: &'a Term<'a>, ty: Quoted<'a> },
+  SigExpected { term: &'a Term<'a>, ty: Quoted<'a> },
+  PiAnnExpected { ty: Quoted<'a> },
+  SigAnnExpected { ty: Quoted<'a> },
+  TypeMismatch { term: &'a Term<'a>, ty: Quoted<'a>, ety: Quoted<'a> },
   TupSizeMismatch { term: &'a Term<'a>, sz: usize, esz: usize },
 }
 
@@ -62,18 +73,16 @@ impl<'a> EvalError<'a> {
     Self::GenLevel { lvl, len }
   }
 
-  pub fn tup_init(n: usize, val: Val<'a>, env: &Stack<'a>, ar: &'a Arena) -> Self {
-    match ar.val(val).quote(env.len(), ar) {
-      Ok(val) => Self::TupInit { n, val: ar.term(val) },
-      Err(err) => err,
-    }
+  pub fn tup_init(n: usize, val: Val<'a>, env: &Stack<'a>, _ar: &'a Arena) -> Self {
+    Self::TupInit { n, val: Quoted::new(val, env.len()) }
   }
 
-  pub fn tup_proj(n: usize, val: Val<'a>, env: &Stack<'a>, ar: &'a Arena) -> Self {
-    match ar.val(val).quote(env.len(), ar) {
-      Ok(val) => Self::TupProj { n, val: ar.term(val) },
-      Err(err) => err,
-    }
+  pub fn tup_proj(n: usize, val: Val<'a>, env: &Stack<'a>, _ar: &'a Arena) -> Self {
+    Self::TupProj { n, val: Quoted::new(val, env.len()) }
+  }
+
+  pub fn out_of_memory(limit: usize) -> Self {
+    Self::OutOfMemory { limit }
   }
 
   /// Clones `self` to given arena.
@@ -81,12 +90,29 @@ impl<'a> EvalError<'a> {
     match self {
       Self::EnvIndex { ix, len } => EvalError::EnvIndex { ix, len },
       Self::GenLevel { lvl, len } => EvalError::GenLevel { lvl, len },
-      Self::TupInit { n, val } => EvalError::TupInit { n, val: ar.term(val.relocate(ar)) },
-      Self::TupProj { n, val } => EvalError::TupProj { n, val: ar.term(val.relocate(ar)) },
+      Self::TupInit { n, val } => EvalError::TupInit { n, val: val.relocate(ar) },
+      Self::TupProj { n, val } => EvalError::TupProj { n, val: val.relocate(ar) },
+      Self::OutOfMemory { limit } => EvalError::OutOfMemory { limit },
     }
   }
 }
 
+impl<'a> Quoted<'a> {
+  pub fn new(val: Val<'a>, len: usize) -> Self {
+    Self { val, len }
+  }
+
+  /// Quotes the value into the given arena.
+  pub fn quote(&self, ar: &'a Arena) -> Result<Term<'a>, EvalError<'a>> {
+    self.val.quote(self.len, ar)
+  }
+
+  /// Clones `self` to given arena.
+  pub fn relocate<'b>(&self, ar: &'b Arena) -> Quoted<'b> {
+    Quoted { val: self.val.relocate(ar), len: self.len }
+  }
+}
+
 impl<'a> TypeError<'a> {
   pub fn univ_form(univ: usize) -> Self {
     Self::UnivForm { univ }
@@ -104,57 +130,36 @@ impl<'a> TypeError<'a> {
     Self::CtxIndex { ix, len }
   }
 
-  pub fn sig_init(n: usize, ty: Val<'a>, ctx: &Stack<'a>, _env: &Stack<'a>, ar: &'a Arena) -> Self {
-    match ar.val(ty).quote(ctx.len(), ar) {
-      Ok(ty) => Self::SigInit { n, ty: ar.term(ty) },
-      Err(err) => err.into(),
-    }
+  pub fn sig_init(n: usize, ty: Val<'a>, ctx: &Stack<'a>, _env: &Stack<'a>, _ar: &'a Arena) -> Self {
+    Self::SigInit { n, ty: Quoted::new(ty, ctx.len()) }
   }
 
-  pub fn sig_proj(n: usize, ty: Val<'a>, ctx: &Stack<'a>, _env: &Stack<'a>, ar: &'a Arena) -> Self {
-    match ar.val(ty).quote(ctx.len(), ar) {
-      Ok(ty) => Self::SigProj { n, ty: ar.term(ty) },
-      Err(err) => err.into(),
-    }
+  pub fn sig_proj(n: usize, ty: Val<'a>, ctx: &Stack<'a>, _env: &Stack<'a>, _ar: &'a Arena) -> Self {
+    Self::SigProj { n, ty: Quoted::new(ty, ctx.len()) }
   }
 
   pub fn ann_expected(term: &'a Term<'a>) -> Self {
     Self::AnnExpected { term }
   }
 
-  pub fn type_expected(term: &'a Term<'a>, ty: Val<'a>, ctx: &Stack<'a>, _env: &Stack<'a>, ar: &'a Arena) -> Self {
-    match ar.val(ty).quote(ctx.len(), ar) {
-      Ok(ty) => Self::TypeExpected { term, ty: ar.term(ty) },
-      Err(err) => err.into(),
-    }
+  pub fn type_expected(term: &'a Term<'a>, ty: Val<'a>, ctx: &Stack<'a>, _env: &Stack<'a>, _ar: &'a Arena) -> Self {
+    Self::TypeExpected { term, ty: Quoted::new(ty, ctx.len()) }
   }
 
-  pub fn pi_expected(term: &'a Term<'a>, ty: Val<'a>, ctx: &Stack<'a>, _env: &Stack<'a>, ar: &'a Arena) -> Self {
-    match ar.val(ty).quote(ctx.len(), ar) {
-      Ok(ty) => Self::PiExpected { term, ty: ar.term(ty) },
-      Err(err) => err.into(),
-    }
+  pub fn pi_expected(term: &'a Term<'a>, ty: Val<'a>, ctx: &Stack<'a>, _env: &Stack<'a>, _ar: &'a Arena) -> Self {
+    Self::PiExpected { term, ty: Quoted::new(ty, ctx.len()) }
   }
 
-  pub fn sig_expected(term: &'a Term<'a>, ty: Val<'a>, ctx: &Stack<'a>, _env: &Stack<'a>, ar: &'a Arena) -> Self {
-    match ar.val(ty).quote(ctx.len(), ar) {
-      Ok(ty) => Self::SigExpected { term, ty: ar.term(ty) },
-      Err(err) => err.into(),
-    }
+  pub fn sig_expected(term: &'a Term<'a>, ty: Val<'a>, ctx: &Stack<'a>, _env: &Stack<'a>, _ar: &'a Arena) -> Self {
+    Self::SigExpected { term, ty: Quoted::new(ty, ctx.len()) }
   }
 
-  pub fn pi_ann_expected(ty: Val<'a>, ctx: &Stack<'a>, _env: &Stack<'a>, ar: &'a Arena) -> Self {
-    match ar.val(ty).quote(ctx.len(), ar) {
-      Ok(ty) => Self::PiAnnExpected { ty: ar.term(ty) },
-      Err(err) => err.into(),
-    }
+  pub fn pi_ann_expected(ty: Val<'a>, ctx: &Stack<'a>, _env: &Stack<'a>, _ar: &'a Arena) -> Self {
+    Self::PiAnnExpected { ty: Quoted::new(ty, ctx.len()) }
   }
 
-  pub fn sig_ann_expected(ty: Val<'a>, ctx: &Stack<'a>, _env: &Stack<'a>, ar: &'a Arena) -> Self {
-    match ar.val(ty).quote(ctx.len(), ar) {
-      Ok(ty) => Self::SigAnnExpected { ty: ar.term(ty) },
-      Err(err) => err.into(),
-    }
+  pub fn sig_ann_expected(ty: Val<'a>, ctx: &Stack<'a>, _env: &Stack<'a>, _ar: &'a Arena) -> Self {
+    Self::SigAnnExpected { ty: Quoted::new(ty, ctx.len()) }
   }
 
   pub fn type_mismatch(
@@ -163,15 +168,9 @@ impl<'a> TypeError<'a> {
     ety: Val<'a>,
     ctx: &Stack<'a>,
     _env: &Stack<'a>,
-    ar: &'a Arena,
+    _ar: &'a Arena,
   ) -> Self {
-    match ar.val(ty).quote(ctx.len(), ar) {
-      Ok(ty) => match ar.val(ety).quote(ctx.len(), ar) {
-        Ok(ety) => Self::TypeMismatch { term, ty: ar.term(ty), ety: ar.term(ety) },
-        Err(err) => err.into(),
-      },
-      Err(err) => err.into(),
-    }
+    Self::TypeMismatch { term, ty: Quoted::new(ty, ctx.len()), ety: Quoted::new(ety, ctx.len()) }
   }
 
   pub fn tup_size_mismatch(term: &'a Term<'a>, sz: usize, esz: usize) -> Self {
@@ -186,28 +185,18 @@ impl<'a> TypeError<'a> {
       Self::PiForm { from, to } => TypeError::PiForm { from, to },
       Self::SigForm { fst, snd } => TypeError::SigForm { fst, snd },
       Self::CtxIndex { ix, len } => TypeError::CtxIndex { ix, len },
-      Self::SigInit { n, ty } => TypeError::SigInit { n, ty: ar.term(ty.relocate(ar)) },
-      Self::SigProj { n, ty } => TypeError::SigProj { n, ty: ar.term(ty.relocate(ar)) },
-      Self::AnnExpected { term } => TypeError::AnnExpected { term: ar.term(term.relocate(ar)) },
-      Self::TypeExpected { term, ty } => {
-        TypeError::TypeExpected { term: ar.term(term.relocate(ar)), ty: ar.term(ty.relocate(ar)) }
-      }
-      Self::PiExpected { term, ty } => {
-        TypeError::PiExpected { term: ar.term(term.relocate(ar)), ty: ar.term(ty.relocate(ar)) }
-      }
-      Self::SigExpected { term, ty } => {
-        TypeError::SigExpected { term: ar.term(term.relocate(ar)), ty: ar.term(ty.relocate(ar)) }
-      }
-      Self::PiAnnExpected { ty } => TypeError::PiAnnExpected { ty: ar.term(ty.relocate(ar)) },
-      Self::SigAnnExpected { ty } => TypeError::SigAnnExpected { ty: ar.term(ty.relocate(ar)) },
-      Self::TypeMismatch { term, ty, ety } => TypeError::TypeMismatch {
-        term: ar.term(term.relocate(ar)),
-        ty: ar.term(ty.relocate(ar)),
-        ety: ar.term(ety.relocate(ar)),
-      },
-      Self::TupSizeMismatch { term, sz, esz } => {
-        TypeError::TupSizeMismatch { term: ar.term(term.relocate(ar)), sz, esz }
+      Self::SigInit { n, ty } => TypeError::SigInit { n, ty: ty.relocate(ar) },
+      Self::SigProj { n, ty } => TypeError::SigProj { n, ty: ty.relocate(ar) },
+      Self::AnnExpected { term } => TypeError::AnnExpected { term: ar.relocate_term(term) },
+      Self::TypeExpected { term, ty } => TypeError::TypeExpected { term: ar.relocate_term(term), ty: ty.relocate(ar) },
+      Self::PiExpected { term, ty } => TypeError::PiExpected { term: ar.relocate_term(term), ty: ty.relocate(ar) },
+      Self::SigExpected { term, ty } => TypeError::SigExpected { term: ar.relocate_term(term), ty: ty.relocate(ar) },
+      Self::PiAnnExpected { ty } => TypeError::PiAnnExpected { ty: ty.relocate(ar) },
+      Self::SigAnnExpected { ty } => TypeError::SigAnnExpected { ty: ty.relocate(ar) },
+      Self::TypeMismatch { term, ty, ety } => {
+        TypeError::TypeMismatch { term: ar.relocate_term(term), ty: ty.relocate(ar), ety: ety.relocate(ar) }
       }
+      Self::TupSizeMismatch { term, sz, esz } => TypeError::TupSizeMismatch { term: ar.relocate_term(term), sz, esz },
     }
   }
 }
@@ -218,6 +207,45 @@ impl<'a> std::convert::From<EvalError<'a>> for TypeError<'a> {
   }
 }
 
+/// # Error sinks
+///
+/// How [`Term::infer_into`] and [`Term::check_into`] report failures of the typing rules: as
+/// [`TypeError`]s, or as `()` for checks which only need to know whether they succeed. Errors are
+/// passed as constructors, which the `()` sink never calls, so failed checks construct no errors.
+pub trait Sink {
+  type Error<'a>: From<EvalError<'a>>;
+
+  /// Makes an error from the constructor of a typing error.
+  fn error<'a>(err: impl FnOnce() -> TypeError<'a>) -> Self::Error<'a>;
+
+  /// Clones an error to the given arena.
+  fn relocate<'a>(err: Self::Error<'_>, ar: &'a Arena) -> Self::Error<'a>;
+}
+
+impl Sink for TypeError<'_> {
+  type Error<'a> = TypeError<'a>;
+
+  fn error<'a>(err: impl FnOnce() -> TypeError<'a>) -> Self::Error<'a> {
+    err()
+  }
+
+  fn relocate<'a>(err: Self::Error<'_>, ar: &'a Arena) -> Self::Error<'a> {
+    err.relocate(ar)
+  }
+}
+
+impl Sink for () {
+  type Error<'a> = ();
+
+  fn error<'a>(_: impl FnOnce() -> TypeError<'a>) -> Self::Error<'a> {}
+
+  fn relocate<'a>(_: Self::Error<'_>, _: &'a Arena) -> Self::Error<'a> {}
+}
+
+impl std::convert::From<EvalError<'_>> for () {
+  fn from(_: EvalError<'_>) {}
+}
+
 impl LexError {
   pub fn unexpected(next: Option<(usize, char)>) -> Self {
     match next {
@@ -262,6 +290,17 @@ impl std::convert::From<LexError> for ParseError {
   }
 }
 
+impl std::fmt::Display for Quoted<'_> {
+  fn fmt(&self, f: &mut std::fmt::Formatter<'_>) -> std::fmt::Result {
+    // The quoted term is only needed for printing, so it is allocated in a temporary arena.
+    let ar = Arena::new();
+    match self.quote(&ar) {
+      Ok(term) => write!(f, "{term}"),
+      Err(err) => write!(f, "<{err}>"),
+    }
+  }
+}
+
 impl std::fmt::Display for EvalError<'_> {
   fn fmt(&self, f: &mut std::fmt::Formatter<'_>) -> std::fmt::Result {
     match self {
@@ -269,6 +308,7 @@ impl std::fmt::Display for EvalError<'_> {
       Self::GenLevel { lvl, len } => write!(f, "generic variable level {lvl} out of bound, environment has size {len}"),
       Self::TupInit { n, val } => write!(f, "tuple prefix length {n} out of bound, tuple has value {val}"),
       Self::TupProj { n, val } => write!(f, "tuple index {n} out of bound, tuple has value {val}"),
+      Self::OutOfMemory { limit } => write!(f, "arena byte limit {limit} exceeded"),
     }
   }
 }
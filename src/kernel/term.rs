@@ -1,7 +1,8 @@
-use std::cmp::max;
+use std::ptr;
 use std::slice::from_raw_parts;
 
 use super::*;
+use crate::common::{self, Calculus, Frames, TermView, ValView};
 
 /// # Terms
 ///
@@ -51,8 +52,9 @@ pub enum Val<'a> {
   Pi(&'a Self, &'a Clos<'a>),
   /// Function abstractions (*body*).
   Fun(&'a Clos<'a>),
-  /// Function applications (function, argument).
-  App(&'a Self, &'a Self),
+  /// Function applications (head, arguments), with the whole spine in one slice. The head is never
+  /// an application.
+  App(&'a Self, &'a [Self]),
   /// Tuple types (*element types*).
   Sig(&'a [Clos<'a>]),
   /// Tuple constructors (element values).
@@ -79,11 +81,25 @@ pub struct Clos<'a> {
 ///
 /// The baseline implementation of evaluation environments. Cheap to append and clone, but random
 /// access takes linear time. This is acceptable if most of the context is wrapped inside tuples,
-/// which have constant-time random access.
+/// which have constant-time random access. Each frame caches its depth, so the length is always
+/// available in constant time.
+///
+/// With the `skew_stack` feature, each frame additionally stores a jump pointer arranged in
+/// skew-binary fashion, so random access takes logarithmic time while appending stays
+/// constant-time and fully shared. Both lookups and jump pointers are implemented once for the
+/// kernel and the ir, see [`common::Frames`].
+///
+/// - See: <https://doi.org/10.1016/0020-0190(83)90106-0> (Myers' applicative random-access stack)
 #[derive(Debug, Clone)]
 pub enum Stack<'a> {
   Nil,
-  Cons { prev: &'a Self, value: Val<'a> },
+  Cons {
+    prev: &'a Self,
+    value: Val<'a>,
+    len: usize,
+    #[cfg(feature = "skew_stack")]
+    jump: &'a Self,
+  },
 }
 
 impl<'a> Stack<'a> {
@@ -92,118 +108,319 @@ impl<'a> Stack<'a> {
     Stack::Nil
   }
 
+  /// Creates a new frame on top of `prev`. This does not allocate.
+  #[cfg(not(feature = "skew_stack"))]
+  pub fn cons(prev: &'a Self, value: Val<'a>) -> Self {
+    Stack::Cons { prev, value, len: prev.len() + 1 }
+  }
+
+  /// Creates a new frame on top of `prev`. This does not allocate. See [`common::jump`] for the
+  /// jump pointer.
+  #[cfg(feature = "skew_stack")]
+  pub fn cons(prev: &'a Self, value: Val<'a>) -> Self {
+    Stack::Cons { prev, value, len: prev.len() + 1, jump: common::jump(prev) }
+  }
+
   /// Returns if the stack is empty.
   pub fn is_empty(&self) -> bool {
     match self {
       Stack::Nil => true,
-      Stack::Cons { prev: _, value: _ } => false,
+      Stack::Cons { .. } => false,
     }
   }
 
   /// Returns the length of the stack.
   pub fn len(&self) -> usize {
-    let mut curr = self;
-    let mut len = 0;
-    while let Stack::Cons { prev, value: _ } = curr {
-      len += 1;
-      curr = prev;
+    match self {
+      Stack::Nil => 0,
+      Stack::Cons { len, .. } => *len,
     }
-    len
   }
 
   /// Returns the value at the given de Bruijn index, if it exists.
   pub fn get(&self, ix: usize, ar: &'a Arena) -> Option<Val<'a>> {
-    let mut curr = self;
-    let mut ix = ix;
     ar.inc_lookup_count();
-    while let Stack::Cons { prev, value } = curr {
-      ar.inc_link_count();
-      if ix == 0 {
-        return Some(*value);
-      }
-      ix -= 1;
-      curr = prev;
+    match common::find(self, ix, || ar.inc_link_count())? {
+      Stack::Cons { value, .. } => Some(*value),
+      Stack::Nil => None,
     }
-    None
   }
 
   /// Extends the stack with a new value.
   pub fn extend(&self, value: Val<'a>, ar: &'a Arena) -> Self {
-    Stack::Cons { prev: ar.frame(self.clone()), value }
+    Stack::cons(ar.frame(self.clone()), value)
+  }
+}
+
+impl<'a> Frames for Stack<'a> {
+  fn prev(&self) -> Option<&Self> {
+    match self {
+      Stack::Nil => None,
+      Stack::Cons { prev, .. } => Some(prev),
+    }
+  }
+
+  fn depth(&self) -> usize {
+    self.len()
+  }
+
+  #[cfg(feature = "skew_stack")]
+  fn jump(&self) -> &Self {
+    match self {
+      Stack::Nil => self,
+      Stack::Cons { jump, .. } => jump,
+    }
+  }
+}
+
+/// # Kernel calculus
+///
+/// The kernel as seen by the shared evaluator, see [`Calculus`]. It has no binder, field or
+/// application information, and no terms or values outside the common fragment.
+#[derive(Debug, Clone, Copy)]
+struct Kernel;
+
+impl<'a> Calculus<'a> for Kernel {
+  type Term = Term<'a>;
+  type Val = Val<'a>;
+  type Clos = Clos<'a>;
+  type Stack = Stack<'a>;
+  type Arena = Arena;
+  type Error = EvalError<'a>;
+  type Bound = ();
+  type Field = ();
+  type Dot = ();
+  type Entry<X: 'a> = X;
+  type Args = &'a [Val<'a>];
+  type TermExt = !;
+  type ValExt = !;
+
+  #[inline]
+  fn view(x: &Term<'a>) -> TermView<'a, Self> {
+    match *x {
+      Term::Gc(x) => TermView::Gc(x),
+      Term::Univ(v) => TermView::Univ(v),
+      Term::Var(ix) => TermView::Var(ix),
+      Term::Ann(x, t) => TermView::Ann(x, t),
+      Term::Let(v, x) => TermView::Let((), v, x),
+      Term::Pi(t, u) => TermView::Pi((), t, u),
+      Term::Fun(b) => TermView::Fun((), b),
+      Term::App(f, x) => TermView::App(f, x, ()),
+      Term::Sig(us) => TermView::Sig(us),
+      Term::Tup(bs) => TermView::Tup(bs),
+      Term::Init(n, x) => TermView::Init(n, x),
+      Term::Proj(n, x) => TermView::Proj(n, x),
+    }
+  }
+
+  #[inline]
+  fn make(x: TermView<'a, Self>) -> Term<'a> {
+    match x {
+      TermView::Gc(x) => Term::Gc(x),
+      TermView::Univ(v) => Term::Univ(v),
+      TermView::Var(ix) => Term::Var(ix),
+      TermView::Ann(x, t) => Term::Ann(x, t),
+      TermView::Let((), v, x) => Term::Let(v, x),
+      TermView::Pi((), t, u) => Term::Pi(t, u),
+      TermView::Fun((), b) => Term::Fun(b),
+      TermView::App(f, x, ()) => Term::App(f, x),
+      TermView::Sig(us) => Term::Sig(us),
+      TermView::Tup(bs) => Term::Tup(bs),
+      TermView::Init(n, x) => Term::Init(n, x),
+      TermView::Proj(n, x) => Term::Proj(n, x),
+    }
+  }
+
+  #[inline]
+  fn view_val(v: &Val<'a>) -> ValView<'a, Self> {
+    match *v {
+      Val::Univ(v) => ValView::Univ(v),
+      Val::Free(i) => ValView::Free(i),
+      Val::Pi(t, u) => ValView::Pi(t, u),
+      Val::Fun(b) => ValView::Fun(b),
+      Val::App(h, xs) => ValView::App(h, xs),
+      Val::Sig(us) => ValView::Sig(us),
+      Val::Tup(bs) => ValView::Tup(bs),
+      Val::Init(n, x) => ValView::Init(n, x),
+      Val::Proj(n, x) => ValView::Proj(n, x),
+    }
+  }
+
+  #[inline]
+  fn make_val(v: ValView<'a, Self>) -> Val<'a> {
+    match v {
+      ValView::Univ(v) => Val::Univ(v),
+      ValView::Free(i) => Val::Free(i),
+      ValView::Pi(t, u) => Val::Pi(t, u),
+      ValView::Fun(b) => Val::Fun(b),
+      ValView::App(h, xs) => Val::App(h, xs),
+      ValView::Sig(us) => Val::Sig(us),
+      ValView::Tup(bs) => Val::Tup(bs),
+      ValView::Init(n, x) => Val::Init(n, x),
+      ValView::Proj(n, x) => Val::Proj(n, x),
+    }
+  }
+
+  #[inline]
+  fn entry<X: 'a>((): (), x: X) -> X {
+    x
+  }
+
+  #[inline]
+  fn split<X: 'a>(x: &X) -> ((), &X) {
+    ((), x)
+  }
+
+  #[inline]
+  fn field_eq((): (), (): ()) -> bool {
+    true
+  }
+
+  #[inline]
+  fn args(xs: &'a [Val<'a>]) -> impl ExactSizeIterator<Item = (&'a Val<'a>, ())> {
+    xs.iter().map(|x| (x, ()))
+  }
+
+  #[inline]
+  fn empty() {}
+
+  #[inline]
+  fn clos((): (), env: Stack<'a>, body: &'a Term<'a>) -> Clos<'a> {
+    Clos { env, body }
+  }
+
+  #[inline]
+  fn open(c: &'a Clos<'a>) -> ((), &'a Stack<'a>, &'a Term<'a>) {
+    ((), &c.env, c.body)
+  }
+
+  #[inline]
+  fn len(env: &Stack<'a>) -> usize {
+    env.len()
+  }
+
+  #[inline]
+  fn get(env: &Stack<'a>, ix: usize, ar: &'a Arena) -> Option<Val<'a>> {
+    env.get(ix, ar)
+  }
+
+  #[inline]
+  fn cons(prev: &'a Stack<'a>, (): (), v: Val<'a>) -> Stack<'a> {
+    Stack::cons(prev, v)
+  }
+
+  #[inline]
+  fn extend(env: &Stack<'a>, (): (), v: Val<'a>, ar: &'a Arena) -> Stack<'a> {
+    env.extend(v, ar)
+  }
+
+  #[inline]
+  fn term(ar: &'a Arena, x: Term<'a>) -> &'a Term<'a> {
+    ar.term(x)
+  }
+
+  #[inline]
+  fn terms(ar: &'a Arena, len: usize) -> &'a mut [Term<'a>] {
+    ar.terms(len)
+  }
+
+  #[inline]
+  fn val(ar: &'a Arena, v: Val<'a>) -> &'a Val<'a> {
+    ar.val(v)
+  }
+
+  #[inline]
+  fn values(ar: &'a Arena, len: usize) -> &'a mut [Val<'a>] {
+    ar.values(len)
+  }
+
+  #[inline]
+  fn closure(ar: &'a Arena, c: Clos<'a>) -> &'a Clos<'a> {
+    ar.clos(c)
+  }
+
+  #[inline]
+  fn closures(ar: &'a Arena, len: usize) -> &'a mut [Clos<'a>] {
+    ar.closures(len)
+  }
+
+  #[inline]
+  fn beta(ar: &'a Arena) -> Result<(), EvalError<'a>> {
+    within_byte_limit(ar)
+  }
+
+  #[inline]
+  fn within_byte_limit(ar: &'a Arena) -> Result<(), EvalError<'a>> {
+    within_byte_limit(ar)
+  }
+
+  fn env_index(ix: usize, len: usize) -> EvalError<'a> {
+    EvalError::env_index(ix, len)
+  }
+
+  fn gen_level(lvl: usize, len: usize) -> EvalError<'a> {
+    EvalError::gen_level(lvl, len)
+  }
+
+  fn tup_init(n: usize, v: Val<'a>, env: &Stack<'a>, ar: &'a Arena) -> EvalError<'a> {
+    EvalError::tup_init(n, v, env, ar)
+  }
+
+  fn tup_proj(n: usize, v: Val<'a>, env: &Stack<'a>, ar: &'a Arena) -> EvalError<'a> {
+    EvalError::tup_proj(n, v, env, ar)
+  }
+
+  fn eval_gc(x: &'a Term<'a>, env: &Stack<'a>, ar: &'a Arena) -> Result<Val<'a>, EvalError<'a>> {
+    ar.region(|temp| {
+      let res = x.eval(env, temp);
+      ar.copy_in(|| res.map(|v| v.relocate(ar)).map_err(|e| e.relocate(ar)))
+    })
+  }
+
+  fn eval_ext(x: !, _: &Stack<'a>, _: &'a Arena) -> Result<Val<'a>, EvalError<'a>> {
+    x
+  }
+
+  /// The remaining arguments are appended to the spine at once.
+  #[inline]
+  fn app(
+    f: Val<'a>,
+    n: usize,
+    mut arg: impl FnMut(usize) -> Result<(Val<'a>, ()), EvalError<'a>>,
+    ar: &'a Arena,
+  ) -> Result<Val<'a>, EvalError<'a>> {
+    let (h, xs) = match f {
+      Val::App(h, xs) => (h, xs),
+      h => (ar.val(h), &[][..]),
+    };
+    let vs = ar.values(xs.len() + n);
+    vs[..xs.len()].copy_from_slice(xs);
+    for (j, v) in vs[xs.len()..].iter_mut().enumerate() {
+      *v = arg(j)?.0;
+    }
+    Ok(Val::App(h, vs))
+  }
+
+  fn quote_ext(v: !, _: usize, _: &'a Arena) -> Result<Term<'a>, EvalError<'a>> {
+    v
+  }
+
+  #[inline]
+  fn ptr_eq(x: &Val<'a>, y: &Val<'a>) -> bool {
+    x.ptr_eq(y)
   }
 }
 
 impl<'a> Term<'a> {
   /// Reduces `self` so that all `let`s are collected into the environment and then frozen at
-  /// binders. This is mutually recursive with [`Clos::apply`], forming an eval-apply loop.
+  /// binders. This is mutually recursive with [`Clos::apply`], forming an eval-apply loop. See
+  /// [`common::eval`] for the rules, which are shared with the ir.
   ///
   /// Pre-conditions:
   ///
   /// - `self` is well-typed under a context and environment `env` (to ensure termination).
   pub fn eval(&self, env: &Stack<'a>, ar: &'a Arena) -> Result<Val<'a>, EvalError<'a>> {
-    match self {
-      // The garbage collection mark forces the subterm to be evaluated inside a new arena.
-      Term::Gc(x) => x.eval(env, &Arena::new()).map(|v| v.relocate(ar)).map_err(|e| e.relocate(ar)),
-      // Universes are already in normal form.
-      Term::Univ(v) => Ok(Val::Univ(*v)),
-      // The (δ) rule is always applied.
-      // Variables of values are in de Bruijn levels, so weakening is no-op.
-      Term::Var(ix) => env.get(*ix, ar).ok_or_else(|| EvalError::env_index(*ix, env.len())),
-      // The (τ) rule is always applied.
-      Term::Ann(x, _) => x.eval(env, ar),
-      // For `let`s, we reduce the value, collect it into the environment to reduce the body.
-      Term::Let(v, x) => x.eval(&env.extend(v.eval(env, ar)?, ar), ar),
-      // For binders, we freeze the whole environment and store the body as a closure.
-      Term::Pi(t, u) => Ok(Val::Pi(ar.val(t.eval(env, ar)?), ar.clos(Clos { env: env.clone(), body: u }))),
-      Term::Fun(b) => Ok(Val::Fun(ar.clos(Clos { env: env.clone(), body: b }))),
-      // For applications, we reduce both operands and combine them back.
-      // In the case of a redex, the (β) rule is applied.
-      Term::App(f, x) => match (f.eval(env, ar)?, x.eval(env, ar)?) {
-        (Val::Fun(b), x) => b.apply(x, ar),
-        (f, x) => Ok(Val::App(ar.val(f), ar.val(x))),
-      },
-      // For binders, we freeze the whole environment and store the body as a closure.
-      Term::Sig(us) => {
-        let cs = ar.closures(us.len());
-        for (i, u) in us.iter().enumerate() {
-          cs[i] = Clos { env: env.clone(), body: u };
-        }
-        Ok(Val::Sig(cs))
-      }
-      Term::Tup(bs) => {
-        let vs = ar.values(bs.len()).as_mut_ptr();
-        for (i, b) in bs.iter().enumerate() {
-          // SAFETY: the borrowed range `&vs[..i]` is no longer modified.
-          let a = Val::Tup(unsafe { from_raw_parts(vs, i) });
-          let b = b.eval(&env.extend(a, ar), ar)?;
-          // SAFETY: `i < bs.len()` which is the valid size of `vs`.
-          unsafe { *vs.add(i) = b };
-        }
-        // SAFETY: the borrowed slice `&vs` has valid size `bs.len()` and is no longer modified.
-        Ok(Val::Tup(unsafe { from_raw_parts(vs, bs.len()) }))
-      }
-      // For initials (i.e. iterated first projections), we reduce the operand and combine it back.
-      // In the case of a redex, the (π init) rule is applied.
-      Term::Init(n, x) => match x.eval(env, ar)? {
-        Val::Init(m, y) => Ok(Val::Init(n + m, y)),
-        Val::Tup(bs) => {
-          let m = bs.len().checked_sub(*n).ok_or_else(|| EvalError::tup_init(*n, Val::Tup(bs), env, ar))?;
-          Ok(Val::Tup(&bs[..m]))
-        }
-        x => Ok(Val::Init(*n, ar.val(x))),
-      },
-      // For projections (i.e. second projections after iterated first projections), we reduce the
-      // operand and combine it back.
-      // In the case of a redex, the (π last) rule is applied.
-      Term::Proj(n, x) => match x.eval(env, ar)? {
-        Val::Init(m, y) => Ok(Val::Proj(n + m, y)),
-        Val::Tup(bs) => {
-          let i = bs.len().checked_sub(n + 1).ok_or_else(|| EvalError::tup_proj(*n, Val::Tup(bs), env, ar))?;
-          Ok(bs[i])
-        }
-        x => Ok(Val::Proj(*n, ar.val(x))),
-      },
-    }
+    common::eval::<Kernel>(self, env, ar)
   }
 }
 
@@ -212,8 +429,16 @@ impl<'a> Clos<'a> {
   /// empty environment populated with all `let`s. This is mutually recursive with [`Term::eval`],
   /// forming an eval-apply loop.
   pub fn apply(&'a self, x: Val<'a>, ar: &'a Arena) -> Result<Val<'a>, EvalError<'a>> {
-    let Self { env, body } = self;
-    body.eval(&Stack::Cons { prev: env, value: x }, ar)
+    common::apply::<Kernel>(self, x, ar)
+  }
+}
+
+/// Checks the byte limit of `ar`, before each (β) step and each value quoted. See
+/// [`Arena::set_byte_limit`].
+fn within_byte_limit<'a>(ar: &'a Arena) -> Result<(), EvalError<'a>> {
+  match ar.over_byte_limit() {
+    false => Ok(()),
+    true => Err(EvalError::out_of_memory(ar.byte_limit().unwrap_or(0))),
   }
 }
 
@@ -225,30 +450,22 @@ impl<'a> Val<'a> {
   ///
   /// - `self` is well-typed under a context with size `len` (to ensure termination).
   pub fn quote(&self, len: usize, ar: &'a Arena) -> Result<Term<'a>, EvalError<'a>> {
-    match self {
-      Val::Univ(v) => Ok(Term::Univ(*v)),
-      Val::Free(i) => Ok(Term::Var(len.checked_sub(i + 1).ok_or_else(|| EvalError::gen_level(*i, len))?)),
-      Val::Pi(t, u) => {
-        Ok(Term::Pi(ar.term(t.quote(len, ar)?), ar.term(u.apply(Val::Free(len), ar)?.quote(len + 1, ar)?)))
-      }
-      Val::Fun(b) => Ok(Term::Fun(ar.term(b.apply(Val::Free(len), ar)?.quote(len + 1, ar)?))),
-      Val::App(f, x) => Ok(Term::App(ar.term(f.quote(len, ar)?), ar.term(x.quote(len, ar)?))),
-      Val::Sig(us) => {
-        let terms = ar.terms(us.len());
-        for (term, u) in terms.iter_mut().zip(us.iter()) {
-          *term = u.apply(Val::Free(len), ar)?.quote(len + 1, ar)?;
-        }
-        Ok(Term::Sig(terms))
-      }
-      Val::Tup(bs) => {
-        let terms = ar.terms(bs.len());
-        for (term, b) in terms.iter_mut().zip(bs.iter()) {
-          *term = b.quote(len + 1, ar)?;
-        }
-        Ok(Term::Tup(terms))
-      }
-      Val::Init(n, x) => Ok(Term::Init(*n, ar.term(x.quote(len, ar)?))),
-      Val::Proj(n, x) => Ok(Term::Proj(*n, ar.term(x.quote(len, ar)?))),
+    common::quote::<Kernel>(self, len, ar)
+  }
+  /// Returns if `self` and `other` are shallowly identical, i.e. they are the same variant with
+  /// the same scalars and point to the same children. This implies definitional equality and is
+  /// used as a constant-time fast path in [`Val::conv`].
+  pub fn ptr_eq(&self, other: &Self) -> bool {
+    match (self, other) {
+      (Val::Univ(v), Val::Univ(w)) => v == w,
+      (Val::Free(i), Val::Free(j)) => i == j,
+      (Val::Pi(t, v), Val::Pi(u, w)) => ptr::eq(*t, *u) && ptr::eq(*v, *w),
+      (Val::Fun(b), Val::Fun(c)) => ptr::eq(*b, *c),
+      (Val::App(f, xs), Val::App(g, ys)) => ptr::eq(*f, *g) && ptr::eq(*xs, *ys),
+      (Val::Sig(us), Val::Sig(vs)) => ptr::eq(*us, *vs),
+      (Val::Tup(bs), Val::Tup(cs)) => ptr::eq(*bs, *cs),
+      (Val::Init(n, x), Val::Init(m, y)) | (Val::Proj(n, x), Val::Proj(m, y)) => n == m && ptr::eq(*x, *y),
+      _ => false,
     }
   }
 
@@ -259,37 +476,7 @@ impl<'a> Val<'a> {
   ///
   /// - `self` and `other` are well-typed under a context with size `len` (to ensure termination).
   pub fn conv(&self, other: &Self, len: usize, ar: &'a Arena) -> Result<bool, EvalError<'a>> {
-    match (self, other) {
-      (Val::Univ(v), Val::Univ(w)) => Ok(v == w),
-      (Val::Free(i), Val::Free(j)) => Ok(i == j),
-      (Val::Pi(t, v), Val::Pi(u, w)) => Ok(
-        Val::conv(t, u, len, ar)?
-          && Val::conv(&v.apply(Val::Free(len), ar)?, &w.apply(Val::Free(len), ar)?, len + 1, ar)?,
-      ),
-      (Val::Fun(b), Val::Fun(c)) => {
-        Ok(Val::conv(&b.apply(Val::Free(len), ar)?, &c.apply(Val::Free(len), ar)?, len + 1, ar)?)
-      }
-      (Val::App(f, x), Val::App(g, y)) => Ok(Val::conv(f, g, len, ar)? && Val::conv(x, y, len, ar)?),
-      (Val::Sig(us), Val::Sig(vs)) if us.len() == vs.len() => {
-        for (u, v) in us.iter().zip(vs.iter()) {
-          if !Val::conv(&u.apply(Val::Free(len), ar)?, &v.apply(Val::Free(len), ar)?, len + 1, ar)? {
-            return Ok(false);
-          }
-        }
-        Ok(true)
-      }
-      (Val::Tup(bs), Val::Tup(cs)) if bs.len() == cs.len() => {
-        for (b, c) in bs.iter().zip(cs.iter()) {
-          if !Val::conv(b, c, len, ar)? {
-            return Ok(false);
-          }
-        }
-        Ok(true)
-      }
-      (Val::Init(n, x), Val::Init(m, y)) => Ok(n == m && Val::conv(x, y, len, ar)?),
-      (Val::Proj(n, x), Val::Proj(m, y)) => Ok(n == m && Val::conv(x, y, len, ar)?),
-      _ => Ok(false),
-    }
+    common::conv::<Kernel>(self, other, len, ar)
   }
 
   /// Given `self`, tries elimination as [`Val::Univ`].
@@ -320,28 +507,22 @@ impl<'a> Val<'a> {
 impl<'a> Term<'a> {
   /// Given universe `u`, returns the universe of its type.
   pub fn univ_univ(u: usize) -> Result<usize, TypeError<'a>> {
-    match u {
-      #[cfg(feature = "type_in_type")]
-      0 => Ok(0),
-      #[cfg(not(feature = "type_in_type"))]
-      0 => Ok(1),
-      _ => Err(TypeError::univ_form(u)),
-    }
+    common::univ_univ(u).ok_or_else(|| TypeError::univ_form(u))
   }
 
   /// Given universes `v` and `w`, returns the universe of Pi types from `v` to `w`.
   pub fn pi_univ(v: usize, w: usize) -> Result<usize, TypeError<'a>> {
-    Ok(max(v, w))
+    Ok(common::pi_univ(v, w))
   }
 
   /// Given universes `v` and `w`, returns the universe of Sigma types containing `v` and `w`.
   pub fn sig_univ(v: usize, w: usize) -> Result<usize, TypeError<'a>> {
-    Ok(max(v, w))
+    Ok(common::sig_univ(v, w))
   }
 
   /// Returns the universe of the unit type.
   pub fn unit_univ() -> Result<usize, TypeError<'a>> {
-    Ok(0)
+    Ok(common::unit_univ())
   }
 
   /// Given preterm `self`, returns the type of `self`. This is mutually recursive with
@@ -355,48 +536,56 @@ impl<'a> Term<'a> {
   /// - `ctx` is well-formed context.
   /// - `env` is well-formed environment.
   pub fn infer(&self, ctx: &Stack<'a>, env: &Stack<'a>, ar: &'a Arena) -> Result<Val<'a>, TypeError<'a>> {
+    self.infer_into::<TypeError>(ctx, env, ar)
+  }
+
+  /// Same as [`Term::infer`], but reports failures to the error sink `S`.
+  pub fn infer_into<S: Sink>(&self, ctx: &Stack<'a>, env: &Stack<'a>, ar: &'a Arena) -> Result<Val<'a>, S::Error<'a>> {
     match self {
-      // The garbage collection mark forces the subterm to be inferred inside a new arena.
-      Term::Gc(x) => x.infer(ctx, env, &Arena::new()).map(|v| v.relocate(ar)).map_err(|e| e.relocate(ar)),
+      // The garbage collection mark forces the subterm to be inferred inside a new arena region.
+      Term::Gc(x) => ar.region(|temp| {
+        let res = x.infer_into::<S>(ctx, env, temp);
+        ar.copy_in(|| res.map(|v| v.relocate(ar)).map_err(|e| S::relocate(e, ar)))
+      }),
       // The (univ) rule is used.
-      Term::Univ(v) => Ok(Val::Univ(Term::univ_univ(*v)?)),
+      Term::Univ(v) => Ok(Val::Univ(Term::univ_univ(*v).map_err(|e| S::error(|| e))?)),
       // The (var) rule is used.
       // Variables of values are in de Bruijn levels, so weakening is no-op.
-      Term::Var(ix) => ctx.get(*ix, ar).ok_or_else(|| TypeError::ctx_index(*ix, ctx.len())),
+      Term::Var(ix) => ctx.get(*ix, ar).ok_or_else(|| S::error(|| TypeError::ctx_index(*ix, ctx.len()))),
       // The (ann) rule is used.
       // To establish pre-conditions for `eval()` and `check()`, the type of `t` is checked first.
       Term::Ann(x, t) => {
-        let tt = t.infer(ctx, env, ar)?;
-        let _ = tt.as_univ(|tt| TypeError::type_expected(t, tt, ctx, env, ar))?;
+        let tt = t.infer_into::<S>(ctx, env, ar)?;
+        let _ = tt.as_univ(|tt| S::error(|| TypeError::type_expected(t, tt, ctx, env, ar)))?;
         let t = t.eval(env, ar)?;
-        x.check(t, ctx, env, ar)?;
+        x.check_into::<S>(t, ctx, env, ar)?;
         Ok(t)
       }
       // The (let) and (extend) rules are used.
       // The (ζ) rule is implicitly used on the value (in normal form) from the recursive call.
       Term::Let(v, x) => {
-        let vt = v.infer(ctx, env, ar)?;
+        let vt = v.infer_into::<S>(ctx, env, ar)?;
         let v = v.eval(env, ar)?;
-        let xt = x.infer(&ctx.extend(vt, ar), &env.extend(v, ar), ar)?;
+        let xt = x.infer_into::<S>(&ctx.extend(vt, ar), &env.extend(v, ar), ar)?;
         Ok(xt)
       }
       // The (Π form) and (extend) rules are used.
       Term::Pi(t, u) => {
-        let tt = t.infer(ctx, env, ar)?;
-        let v = tt.as_univ(|tt| TypeError::type_expected(t, tt, ctx, env, ar))?;
+        let tt = t.infer_into::<S>(ctx, env, ar)?;
+        let v = tt.as_univ(|tt| S::error(|| TypeError::type_expected(t, tt, ctx, env, ar)))?;
         let t = t.eval(env, ar)?;
         let x = Val::Free(env.len());
-        let ut = u.infer(&ctx.extend(t, ar), &env.extend(x, ar), ar)?;
-        let w = ut.as_univ(|ut| TypeError::type_expected(u, ut, ctx, env, ar))?;
-        Ok(Val::Univ(Term::pi_univ(v, w)?))
+        let ut = u.infer_into::<S>(&ctx.extend(t, ar), &env.extend(x, ar), ar)?;
+        let w = ut.as_univ(|ut| S::error(|| TypeError::type_expected(u, ut, ctx, env, ar)))?;
+        Ok(Val::Univ(Term::pi_univ(v, w).map_err(|e| S::error(|| e))?))
       }
       // Function abstractions must be enclosed in type annotations, or appear as an argument.
-      Term::Fun(_) => Err(TypeError::ann_expected(ar.term(*self))),
+      Term::Fun(_) => Err(S::error(|| TypeError::ann_expected(ar.term(*self)))),
       // The (Π elim) rule is used.
       Term::App(f, x) => {
-        let ft = f.infer(ctx, env, ar)?;
-        let (t, u) = ft.as_pi(|ft| TypeError::pi_expected(f, ft, ctx, env, ar))?;
-        x.check(*t, ctx, env, ar)?;
+        let ft = f.infer_into::<S>(ctx, env, ar)?;
+        let (t, u) = ft.as_pi(|ft| S::error(|| TypeError::pi_expected(f, ft, ctx, env, ar)))?;
+        x.check_into::<S>(*t, ctx, env, ar)?;
         Ok(u.apply(x.eval(env, ar)?, ar)?)
       }
       // The (Σ form), (⊤ form) and (extend) rules are used.
@@ -405,30 +594,32 @@ impl<'a> Term<'a> {
         for (i, u) in us.iter().enumerate() {
           cs[i] = Clos { env: env.clone(), body: u };
         }
-        let mut v = Term::unit_univ()?;
+        let mut v = Term::unit_univ().map_err(|e| S::error(|| e))?;
         for (i, u) in us.iter().enumerate() {
           let t = Val::Sig(&cs[..i]);
           let x = Val::Free(env.len());
-          let ut = u.infer(&ctx.extend(t, ar), &env.extend(x, ar), ar)?;
-          let w = ut.as_univ(|ut| TypeError::type_expected(u, ut, ctx, env, ar))?;
-          v = Term::sig_univ(v, w)?;
+          let ut = u.infer_into::<S>(&ctx.extend(t, ar), &env.extend(x, ar), ar)?;
+          let w = ut.as_univ(|ut| S::error(|| TypeError::type_expected(u, ut, ctx, env, ar)))?;
+          v = Term::sig_univ(v, w).map_err(|e| S::error(|| e))?;
         }
         Ok(Val::Univ(v))
       }
       // Tuple constructors must be enclosed in type annotations, or appear as an argument.
-      Term::Tup(_) => Err(TypeError::ann_expected(ar.term(*self))),
+      Term::Tup(_) => Err(S::error(|| TypeError::ann_expected(ar.term(*self)))),
       // The (Σ init) rule is used.
       Term::Init(n, x) => {
-        let xt = x.infer(ctx, env, ar)?;
-        let us = xt.as_sig(|xt| TypeError::sig_expected(x, xt, ctx, env, ar))?;
-        let m = us.len().checked_sub(*n).ok_or_else(|| TypeError::sig_init(*n, Val::Sig(us), ctx, env, ar))?;
+        let xt = x.infer_into::<S>(ctx, env, ar)?;
+        let us = xt.as_sig(|xt| S::error(|| TypeError::sig_expected(x, xt, ctx, env, ar)))?;
+        let m = us.len().checked_sub(*n);
+        let m = m.ok_or_else(|| S::error(|| TypeError::sig_init(*n, Val::Sig(us), ctx, env, ar)))?;
         Ok(Val::Sig(&us[..m]))
       }
       // The (Σ proj) rule is used.
       Term::Proj(n, x) => {
-        let xt = x.infer(ctx, env, ar)?;
-        let us = xt.as_sig(|xt| TypeError::sig_expected(x, xt, ctx, env, ar))?;
-        let i = us.len().checked_sub(n + 1).ok_or_else(|| TypeError::sig_proj(*n, Val::Sig(us), ctx, env, ar))?;
+        let xt = x.infer_into::<S>(ctx, env, ar)?;
+        let us = xt.as_sig(|xt| S::error(|| TypeError::sig_expected(x, xt, ctx, env, ar)))?;
+        let i = us.len().checked_sub(n + 1);
+        let i = i.ok_or_else(|| S::error(|| TypeError::sig_proj(*n, Val::Sig(us), ctx, env, ar)))?;
         Ok(us[i].apply(Term::Init(n + 1, x).eval(env, ar)?, ar)?)
       }
     }
@@ -444,29 +635,49 @@ impl<'a> Term<'a> {
   /// - `t` is well-typed under context `ctx` and environment `env`.
   /// - `t` has universe type under context `ctx` and environment `env`.
   pub fn check(&self, t: Val<'a>, ctx: &Stack<'a>, env: &Stack<'a>, ar: &'a Arena) -> Result<(), TypeError<'a>> {
+    self.check_into::<TypeError>(t, ctx, env, ar)
+  }
+
+  /// Same as [`Term::check`], but only returns if `self` has type `t`. Failures construct no
+  /// errors (see [`Sink`]), so a speculative check which fails allocates nothing for them.
+  pub fn check_ok(&self, t: Val<'a>, ctx: &Stack<'a>, env: &Stack<'a>, ar: &'a Arena) -> bool {
+    self.check_into::<()>(t, ctx, env, ar).is_ok()
+  }
+
+  /// Same as [`Term::check`], but reports failures to the error sink `S`.
+  pub fn check_into<S: Sink>(
+    &self,
+    t: Val<'a>,
+    ctx: &Stack<'a>,
+    env: &Stack<'a>,
+    ar: &'a Arena,
+  ) -> Result<(), S::Error<'a>> {
     match self {
-      // The garbage collection mark forces the subterm to be checked inside a new arena.
-      Term::Gc(x) => x.check(t, ctx, env, &Arena::new()).map_err(|e| e.relocate(ar)),
+      // The garbage collection mark forces the subterm to be checked inside a new arena region.
+      Term::Gc(x) => ar.region(|temp| {
+        let res = x.check_into::<S>(t, ctx, env, temp);
+        ar.copy_in(|| res.map_err(|e| S::relocate(e, ar)))
+      }),
       // The (let) and (extend) rules are used.
       // The (ζ) rule is implicitly inversely used on the `t` passed into the recursive call.
       Term::Let(v, x) => {
-        let vt = v.infer(ctx, env, ar)?;
+        let vt = v.infer_into::<S>(ctx, env, ar)?;
         let v = v.eval(env, ar)?;
-        x.check(t, &ctx.extend(vt, ar), &env.extend(v, ar), ar)?;
+        x.check_into::<S>(t, &ctx.extend(vt, ar), &env.extend(v, ar), ar)?;
         Ok(())
       }
       // The (Π intro) and (extend) rules is used.
       // By pre-conditions, `t` is already known to have universe type.
       Term::Fun(b) => {
         let x = Val::Free(env.len());
-        let (t, u) = t.as_pi(|t| TypeError::pi_ann_expected(t, ctx, env, ar))?;
-        b.check(u.apply(x, ar)?, &ctx.extend(*t, ar), &env.extend(x, ar), ar)?;
+        let (t, u) = t.as_pi(|t| S::error(|| TypeError::pi_ann_expected(t, ctx, env, ar)))?;
+        b.check_into::<S>(u.apply(x, ar)?, &ctx.extend(*t, ar), &env.extend(x, ar), ar)?;
         Ok(())
       }
       // The (∑ intro) and (extend) rules are used.
       // By pre-conditions, `t` is already known to have universe type.
       Term::Tup(bs) => {
-        let us = t.as_sig(|t| TypeError::sig_ann_expected(t, ctx, env, ar))?;
+        let us = t.as_sig(|t| S::error(|| TypeError::sig_ann_expected(t, ctx, env, ar)))?;
         if bs.len() == us.len() {
           let vs = ar.values(bs.len()).as_mut_ptr();
           for (i, b) in bs.iter().enumerate() {
@@ -474,22 +685,22 @@ impl<'a> Term<'a> {
             let t = Val::Sig(&us[..i]);
             // SAFETY: the borrowed range `&vs[..i]` is no longer modified.
             let a = Val::Tup(unsafe { from_raw_parts(vs, i) });
-            b.check(u.apply(a, ar)?, &ctx.extend(t, ar), &env.extend(a, ar), ar)?;
+            b.check_into::<S>(u.apply(a, ar)?, &ctx.extend(t, ar), &env.extend(a, ar), ar)?;
             let b = b.eval(&env.extend(a, ar), ar)?;
             // SAFETY: `i < bs.len()` which is the valid size of `vs`.
             unsafe { *vs.add(i) = b };
           }
           Ok(())
         } else {
-          Err(TypeError::tup_size_mismatch(ar.term(*self), bs.len(), us.len()))
+          Err(S::error(|| TypeError::tup_size_mismatch(ar.term(*self), bs.len(), us.len())))
         }
       }
       // The (conv) rule is used.
       // By pre-conditions, `t` is already known to have universe type.
       x => {
-        let xt = x.infer(ctx, env, ar)?;
+        let xt = x.infer_into::<S>(ctx, env, ar)?;
         let res = Val::conv(&xt, &t, env.len(), ar)?.then_some(());
-        res.ok_or_else(|| TypeError::type_mismatch(ar.term(*x), xt, t, ctx, env, ar))
+        res.ok_or_else(|| S::error(|| TypeError::type_mismatch(ar.term(*x), xt, t, ctx, env, ar)))
       }
     }
   }
@@ -3,7 +3,10 @@
 #![warn(clippy::all)]
 
 pub mod arena;
+pub mod common;
 pub mod elab;
 pub mod io;
 pub mod ir;
 pub mod kernel;
+pub mod profile;
+pub mod server;
@@ -1,31 +1,50 @@
+use std::fmt::Write as _;
 use std::io::Write;
-use std::thread::Builder;
-
-use zenith::arena::Arena;
-use zenith::io::Span;
-use zenith::ir::{Stack, Term, Val};
-
-/// Converts `pos` to line and column numbers.
-fn pos_to_line_col(pos: usize, lines: &[String]) -> (usize, usize) {
-  let mut remaining = pos;
-  for (i, line) in lines.iter().enumerate() {
-    if remaining < line.chars().count() {
-      return (i, remaining);
-    }
-    remaining -= line.chars().count();
+use std::panic::catch_unwind;
+use std::sync::atomic::{AtomicUsize, Ordering};
+use std::sync::mpsc::channel;
+use std::thread::{available_parallelism, scope, Builder};
+use std::time::{Duration, Instant};
+
+use zenith::arena::{Arena, Relocate};
+use zenith::elab::Globals;
+use zenith::io::{Json, Lexer, Span, Token};
+use zenith::ir::{Bound, Global, Machine, Name, Stack, Term, Val};
+use zenith::profile::Op;
+use zenith::server::{read_message, write_message, Server};
+
+/// # Line indices
+///
+/// Byte offsets at which input lines start, so that positions can be converted to line and column
+/// numbers without rescanning the input.
+struct LineIndex<'s> {
+  lines: &'s [String],
+  starts: Vec<usize>,
+}
+
+impl<'s> LineIndex<'s> {
+  /// Indexes `lines`, which are concatenated without separators to form the input.
+  fn new(lines: &'s [String]) -> Self {
+    let starts = lines.iter().scan(0, |start, line| Some(std::mem::replace(start, *start + line.len()))).collect();
+    Self { lines, starts }
   }
-  match lines.last() {
-    Some(line) => (lines.len() - 1, line.chars().count()),
-    None => (0, 0),
+
+  /// Converts byte offset `pos` to line and column (in characters) numbers.
+  fn line_col(&self, pos: usize) -> (usize, usize) {
+    let i = self.starts.partition_point(|start| *start <= pos).saturating_sub(1);
+    match self.lines.get(i) {
+      Some(line) => (i, line.char_indices().take_while(|(j, _)| self.starts[i] + j < pos).count()),
+      None => (0, 0),
+    }
   }
 }
 
 /// Prints a location indicator.
-fn print_location_indicator(start: usize, end: usize, lines: &[String]) {
+fn print_location_indicator(start: usize, end: usize, index: &LineIndex) {
   let end = end.max(start);
-  let (start_line, start_col) = pos_to_line_col(start, lines);
-  let (end_line, end_col) = pos_to_line_col(end, lines);
-  let line = lines.get(start_line).map_or("", |s| s.as_ref());
+  let (start_line, start_col) = index.line_col(start);
+  let (end_line, end_col) = index.line_col(end);
+  let line = index.lines.get(start_line).map_or("", |s| s.as_ref());
   if start_line == end_line {
     println!("|");
     println!("| {line}");
@@ -95,8 +114,23 @@ fn print_location_indicator(start: usize, end: usize, lines: &[String]) {
 /// ]
 ///   + 2 3
 /// ```
+///
+/// Inputs of the form `name ≔ term` are checked once and kept as global definitions, which can be
+/// referred to by later inputs:
+///
+/// ```term
+/// ℕ ≔ [A : Type, s : [a : A] → A, z : A] → A
+/// ```
+///
+/// ```term
+/// mul ≔ [n, m, A, s, z] ↦ n A (m A s) z : [n : ℕ, m : ℕ] → ℕ
+/// ```
 fn run_repl() -> std::io::Result<()> {
+  // Global definitions live in their own arena, which is never reset.
+  let gar = Arena::new();
+  let mut globals = Globals::new();
   let mut ar = Arena::new();
+  ar.set_threads(available_parallelism().map_or(1, |n| n.get()));
   loop {
     ar.reset();
 
@@ -123,23 +157,60 @@ fn run_repl() -> std::io::Result<()> {
       continue;
     }
 
-    let spans = match Span::lex(input.chars()) {
-      Ok(t) => t,
-      Err(e) => {
-        let (start, end) = e.position(input.chars().count());
-        println!("⨯ Error: {e}");
-        print_location_indicator(start, end, &lines);
-        println!();
-        continue;
-      }
-    };
+    let index = LineIndex::new(&lines);
+    let mut lookahead = Lexer::new(&input);
+    if let (Some(Span { tok: Token::Id(name), .. }), Some(Span { tok: Token::Def, .. })) =
+      (lookahead.next(), lookahead.next())
+    {
+      let term = match Term::parse(lookahead, &gar) {
+        Ok(t) => t,
+        Err(e) => {
+          let (start, end) = e.position(input.len());
+          println!("⨯ Error: {e}");
+          print_location_indicator(start, end, &index);
+          println!();
+          continue;
+        }
+      };
+      // Intermediate objects are allocated in a region, only the results are kept.
+      let temp = gar.region();
+      let ctx = Stack::new(&temp);
+      let env = Stack::new(&temp);
+      temp.set_gluing(true);
+      let res = term.infer_with(&globals, &ctx, &env, &temp);
+      temp.set_gluing(false);
+      // Globals are also used from other arenas, which do not share the metacontext of the region,
+      // so holes are replaced by their solutions.
+      let res = res.and_then(|(term, ty)| Ok((term.zonk(&temp)?, ty.zonk(&env, &temp)?)));
+      match res {
+        Ok((term, ty)) => {
+          let val = Machine::new().eval(temp.term(term), &env, &temp).unwrap();
+          let global = gar.copy_in(|| Global {
+            info: gar.bound(Bound::new(Name::new(name, &gar), &[], &gar)),
+            term: gar.relocate_term(&term),
+            ty: ty.relocate(&gar),
+            val: val.relocate(&gar),
+          });
+          globals.insert(gar.global(global));
+          println!("≔ {name}");
+        }
+        Err(e) => println!("⨯ Error: {e}"),
+      };
+      println!();
+      println!("  Globals: {} definitions, {} bytes", globals.len(), gar.byte_count());
+      println!();
+      continue;
+    }
 
-    let term = match Term::parse(spans.into_iter(), &ar) {
+    // The query is parsed in a region of `gar`, so that its names are interned in the same symbol
+    // table as those of global definitions, and compare equal to them.
+    let pr = gar.region();
+    let term = match Term::parse(Lexer::new(&input), &pr) {
       Ok(t) => t,
       Err(e) => {
-        let (start, end) = e.position(input.chars().count());
+        let (start, end) = e.position(input.len());
         println!("⨯ Error: {e}");
-        print_location_indicator(start, end, &lines);
+        print_location_indicator(start, end, &index);
         println!();
         continue;
       }
@@ -147,9 +218,14 @@ fn run_repl() -> std::io::Result<()> {
 
     let ctx = Stack::new(&ar);
     let env = Stack::new(&ar);
-    match term.infer(&ctx, &env, &ar) {
+    ar.set_gluing(true);
+    let res = term.infer_with(&globals, &ctx, &env, &ar);
+    ar.set_gluing(false);
+    match res {
       Ok((term, ty)) => {
-        let term = term.eval(&env, &ar).unwrap().quote(0, &ar).unwrap().check(ty, &ctx, &env, &ar).unwrap();
+        let mut machine = Machine::new();
+        let term = machine.eval(ar.term(term), &env, &ar).unwrap();
+        let term = machine.quote(&term, 0, &ar).unwrap().check(ty, &ctx, &env, &ar).unwrap();
         println!("≡ {term}");
         if ty.conv(&Val::Univ(1), 0, &ar).unwrap() {
           let ty = ty.quote(0, &ar).unwrap();
@@ -170,13 +246,208 @@ fn run_repl() -> std::io::Result<()> {
       ar.val_count(),
       ar.clos_count()
     );
-    println!("  Stack: {} lookups, {} average lookup length", ar.lookup_count(), ar.average_link_count());
+    if cfg!(feature = "profiling") {
+      println!("  Stack: {} lookups, {} average lookup length", ar.lookup_count(), ar.average_link_count());
+    }
     println!();
   }
 }
 
+/// # Check reports
+///
+/// Wall time of each phase of checking a file, arena counters after the last phase run, and the
+/// first error if any. With the `profiling` feature, also rule counts, the histogram of lookup
+/// lengths and folded stacks of time spent in each definition, see [`Profile`](zenith::profile::Profile).
+#[derive(Debug, Default)]
+struct Report {
+  file: String,
+  phases: Vec<(&'static str, Duration)>,
+  counters: Vec<(&'static str, f64)>,
+  rules: Vec<(Op, &'static str, usize)>,
+  lookups: Vec<usize>,
+  folded: Vec<u8>,
+  error: Option<String>,
+}
+
+impl Report {
+  /// Runs phase `name` and records its wall time, or the error it returns.
+  fn phase<T, E: std::fmt::Display>(&mut self, name: &'static str, f: impl FnOnce() -> Result<T, E>) -> Option<T> {
+    let start = Instant::now();
+    let res = f();
+    self.phases.push((name, start.elapsed()));
+    res.map_err(|e| self.error = Some(format!("{name}: {e}"))).ok()
+  }
+
+  /// Writes the report as a JSON object.
+  fn write_json(&self, out: &mut String) {
+    write!(out, "{{\"file\": {}, \"ok\": {}, \"error\": ", Json::String(self.file.clone()), self.error.is_none())
+      .unwrap();
+    match &self.error {
+      Some(e) => write!(out, "{}", Json::String(e.clone())).unwrap(),
+      None => out.push_str("null"),
+    }
+    out.push_str(", \"seconds\": {");
+    for (i, (name, time)) in self.phases.iter().enumerate() {
+      write!(out, "{}\"{name}\": {}", if i == 0 { "" } else { ", " }, time.as_secs_f64()).unwrap();
+    }
+    out.push_str("}, \"counters\": {");
+    for (i, (name, value)) in self.counters.iter().enumerate() {
+      write!(out, "{}\"{name}\": {value}", if i == 0 { "" } else { ", " }).unwrap();
+    }
+    out.push('}');
+    if !self.rules.is_empty() {
+      out.push_str(", \"rules\": {");
+      for (i, (op, variant, n)) in self.rules.iter().enumerate() {
+        write!(out, "{}\"{op:?}/{variant}\": {n}", if i == 0 { "" } else { ", " }).unwrap();
+      }
+      write!(out, "}}, \"lookup_lengths\": {:?}", self.lookups).unwrap();
+    }
+    out.push('}');
+  }
+}
+
+/// Checks a whole file, timing lexing, parsing, elaboration, evaluation and quotation separately.
+/// Large tuples are checked on up to `threads` worker threads.
+fn check_file(file: &str, threads: usize) -> Report {
+  let mut report = Report { file: file.to_string(), ..Report::default() };
+  let ar = Arena::new();
+  ar.set_threads(threads);
+  check_phases(&mut report, &ar);
+  if let Some(profile) = ar.profile() {
+    report.rules = profile.rule_counts();
+    report.lookups = profile.lookup_histogram();
+    profile.write_folded(file, &mut report.folded).unwrap();
+  }
+  report.counters = vec![
+    ("term_count", ar.term_count() as f64),
+    ("frame_count", ar.frame_count() as f64),
+    ("val_count", ar.val_count() as f64),
+    ("clos_count", ar.clos_count() as f64),
+    ("byte_count", ar.byte_count() as f64),
+    ("peak_bytes", ar.peak_bytes() as f64),
+    ("freed_bytes", ar.freed_bytes() as f64),
+  ];
+  // Stack lookups are only counted with the `profiling` feature.
+  if cfg!(feature = "profiling") {
+    report.counters.push(("lookup_count", ar.lookup_count() as f64));
+    report.counters.push(("average_link_count", ar.average_link_count() as f64));
+  }
+  report
+}
+
+/// Runs the phases of [`check_file`] until one of them fails.
+fn check_phases(report: &mut Report, ar: &Arena) -> Option<()> {
+  let file = report.file.clone();
+  let src = report.phase("read", || std::fs::read_to_string(file))?;
+  let spans = report.phase("lex", || Span::lex(&src))?;
+  let term = report.phase("parse", || Term::parse(spans.into_iter(), ar))?;
+  let (ctx, env) = (Stack::new(ar), Stack::new(ar));
+  ar.set_gluing(true);
+  let res = report.phase("elaborate", || term.infer(&ctx, &env, ar));
+  ar.set_gluing(false);
+  let (term, _) = res?;
+  let val = report.phase("eval", || term.eval(&env, ar))?;
+  report.phase("quote", || val.quote(0, ar))?;
+  Some(())
+}
+
+/// Checks `files` in parallel, one file per thread, and prints a JSON array of [`Report`]s to
+/// standard output. Returns whether all files were checked successfully. A file whose check
+/// panics gets a failed report, and does not affect the other files. With `--folded <path>`,
+/// folded stacks of all files (with file names as outermost frames) are written to `path`, which
+/// requires the `profiling` feature.
+///
+/// ```sh
+/// zenith check examples/first_order_logic.zt examples/long_env_eval.zkt
+/// zenith check --folded out.folded examples/first_order_logic.zt
+/// ```
+fn run_check(files: &[String], folded: Option<&str>) -> std::io::Result<bool> {
+  let next = AtomicUsize::new(0);
+  let cores = available_parallelism().map_or(1, |n| n.get());
+  let threads = cores.min(files.len());
+  let mut reports = scope(|s| {
+    let workers = (0..threads).map(|_| {
+      let worker = || {
+        let mut res = Vec::new();
+        loop {
+          let i = next.fetch_add(1, Ordering::Relaxed);
+          let Some(file) = files.get(i) else { break };
+          // A panic while checking one file is reported as its error, keeping the other reports.
+          let report = catch_unwind(|| check_file(file, cores / threads)).unwrap_or_else(|_| Report {
+            file: file.clone(),
+            error: Some("internal error: panicked".to_string()),
+            ..Report::default()
+          });
+          res.push((i, report));
+        }
+        res
+      };
+      Builder::new().stack_size(1024 * 1024 * 1024).spawn_scoped(s, worker).unwrap()
+    });
+    workers.collect::<Vec<_>>().into_iter().flat_map(|worker| worker.join().unwrap()).collect::<Vec<_>>()
+  });
+  reports.sort_by_key(|(i, _)| *i);
+  let reports = reports.into_iter().map(|(_, report)| report).collect::<Vec<_>>();
+  let mut out = String::from("[\n");
+  for (i, report) in reports.iter().enumerate() {
+    out.push_str("  ");
+    report.write_json(&mut out);
+    out.push_str(if i + 1 < reports.len() { ",\n" } else { "\n" });
+  }
+  out.push(']');
+  println!("{out}");
+  if let Some(path) = folded {
+    std::fs::write(path, reports.iter().flat_map(|report| report.folded.iter().copied()).collect::<Vec<_>>())?;
+  }
+  Ok(reports.iter().all(|report| report.error.is_none()))
+}
+
+/// Runs the language server on standard input and output, see [`Server`]. Messages are written by a
+/// separate thread, as they are sent by the threads of open documents.
+///
+/// ```sh
+/// zenith serve
+/// ```
+fn run_server() -> std::io::Result<()> {
+  let (out, messages) = channel::<Json>();
+  let writer = std::thread::spawn(move || {
+    let mut stdout = std::io::stdout().lock();
+    messages.into_iter().try_for_each(|msg| write_message(&mut stdout, &msg))
+  });
+  let mut server = Server::new(out);
+  let mut stdin = std::io::stdin().lock();
+  while let Some(msg) = read_message(&mut stdin)? {
+    if !server.handle(&msg) {
+      break;
+    }
+  }
+  drop(server);
+  writer.join().unwrap()
+}
+
 fn main() -> std::io::Result<()> {
-  // Due to heavy use of recursion, stack size limit is set to 1 GB.
-  Builder::new().stack_size(1024 * 1024 * 1024).spawn(run_repl)?.join().unwrap()?;
+  let args = std::env::args().skip(1).collect::<Vec<_>>();
+  match args.split_first() {
+    Some((cmd, args)) if cmd == "check" => {
+      let (folded, files) = match args {
+        [flag, path, files @ ..] if flag == "--folded" => (Some(path.as_str()), files),
+        files => (None, files),
+      };
+      if files.is_empty() {
+        eprintln!("usage: zenith check [--folded <path>] <files...>");
+        std::process::exit(2);
+      }
+      if folded.is_some() && Arena::new().profile().is_none() {
+        eprintln!("error: `--folded` requires the `profiling` feature");
+        std::process::exit(2);
+      }
+      if !run_check(files, folded)? {
+        std::process::exit(1);
+      }
+    }
+    Some((cmd, _)) if cmd == "serve" => run_server()?,
+    // Due to heavy use of recursion, stack size limit is set to 1 GB.
+    _ => Builder::new().stack_size(1024 * 1024 * 1024).spawn(run_repl)?.join().unwrap()?,
+  }
   Ok(())
 }
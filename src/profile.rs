@@ -0,0 +1,172 @@
+use std::cell::{Cell, RefCell};
+use std::collections::HashMap;
+use std::io::Write;
+use std::mem::take;
+use std::time::{Duration, Instant};
+
+/// # Profiled operations
+#[derive(Debug, Clone, Copy, PartialEq, Eq, Hash, PartialOrd, Ord)]
+pub enum Op {
+  Eval,
+  Infer,
+  Check,
+  Conv,
+}
+
+/// # Profiles
+///
+/// Counts and timings collected by an [`Arena`](crate::arena::Arena) with the `profiling` feature:
+/// the number of times each operation is applied to each variant of [`Term`](crate::ir::Term) or
+/// [`Val`](crate::ir::Val) (i.e. how often each rule is used), a histogram of stack lookup lengths,
+/// and the time spent checking each named `let` definition or tuple field, nested as they appear in
+/// the input. Without the feature, arenas record nothing, and the calls which would record into a
+/// profile compile to nothing.
+///
+/// Timings are kept as self times by stack of names, and can be written in the folded format read
+/// by flame graph tools, see [`Profile::write_folded`].
+///
+/// - See: <https://github.com/brendangregg/FlameGraph> (folded stacks)
+#[derive(Debug, Default)]
+pub struct Profile {
+  rules: RefCell<HashMap<(Op, &'static str), usize>>,
+  lookups: RefCell<Vec<usize>>,
+  links: Cell<Option<usize>>,
+  prefix: String,
+  scopes: RefCell<Vec<Scope>>,
+  roots: Cell<Duration>,
+  folded: RefCell<HashMap<String, Duration>>,
+}
+
+/// # Open timing scopes
+///
+/// Stack of names, start time and time spent in nested scopes.
+#[derive(Debug)]
+struct Scope {
+  path: String,
+  start: Instant,
+  nested: Duration,
+}
+
+impl Profile {
+  /// Creates a profile for a region or worker arena, whose scopes are nested in the currently open
+  /// scope of `self`.
+  pub fn child(&self) -> Self {
+    Self { prefix: self.path(), ..Self::default() }
+  }
+
+  /// Returns the stack of names of the currently open scope.
+  fn path(&self) -> String {
+    self.scopes.borrow().last().map_or_else(|| self.prefix.clone(), |scope| scope.path.clone())
+  }
+
+  /// Records an application of operation `op` to a term or value of variant `variant`.
+  pub fn rule(&self, op: Op, variant: &'static str) {
+    *self.rules.borrow_mut().entry((op, variant)).or_default() += 1;
+  }
+
+  /// Records the start of a stack lookup, ending the previous one.
+  pub fn lookup(&self) {
+    self.flush();
+    self.links.set(Some(0));
+  }
+
+  /// Records a link traversed in the current stack lookup.
+  pub fn link(&self) {
+    self.links.set(self.links.get().map(|n| n + 1));
+  }
+
+  /// Records the length of the pending lookup in the histogram.
+  fn flush(&self) {
+    if let Some(n) = self.links.take() {
+      let bucket = (usize::BITS - n.leading_zeros()) as usize;
+      let mut lookups = self.lookups.borrow_mut();
+      if lookups.len() <= bucket {
+        lookups.resize(bucket + 1, 0);
+      }
+      lookups[bucket] += 1;
+    }
+  }
+
+  /// Opens a timing scope named `name` inside the current one.
+  pub fn enter(&self, name: &str) {
+    let name = if name.is_empty() { "_" } else { name };
+    let path = match self.path() {
+      path if path.is_empty() => name.to_string(),
+      path => format!("{path};{name}"),
+    };
+    self.scopes.borrow_mut().push(Scope { path, start: Instant::now(), nested: Duration::ZERO });
+  }
+
+  /// Closes the current timing scope, attributing the time not spent in nested scopes to it.
+  pub fn exit(&self) {
+    let scope = self.scopes.borrow_mut().pop().unwrap();
+    let elapsed = scope.start.elapsed();
+    self.add(scope.path, elapsed.saturating_sub(scope.nested));
+    self.add_nested(elapsed);
+  }
+
+  /// Adds self time to a stack of names.
+  fn add(&self, path: String, time: Duration) {
+    *self.folded.borrow_mut().entry(path).or_default() += time;
+  }
+
+  /// Adds time spent in a nested scope to the current scope.
+  fn add_nested(&self, time: Duration) {
+    match self.scopes.borrow_mut().last_mut() {
+      Some(scope) => scope.nested += time,
+      None => self.roots.set(self.roots.get() + time),
+    }
+  }
+
+  /// Merges the profile of a region or worker arena into `self`.
+  pub fn merge(&self, other: Self) {
+    other.flush();
+    for (key, n) in other.rules.take() {
+      *self.rules.borrow_mut().entry(key).or_default() += n;
+    }
+    let mut lookups = self.lookups.borrow_mut();
+    for (i, n) in other.lookups.take().into_iter().enumerate() {
+      if lookups.len() <= i {
+        lookups.resize(i + 1, 0);
+      }
+      lookups[i] += n;
+    }
+    for (path, time) in other.folded.take() {
+      self.add(path, time);
+    }
+    self.add_nested(other.roots.get());
+  }
+
+  /// Returns the number of applications of each operation to each variant, most frequent first.
+  pub fn rule_counts(&self) -> Vec<(Op, &'static str, usize)> {
+    let mut res = self.rules.borrow().iter().map(|((op, variant), n)| (*op, *variant, *n)).collect::<Vec<_>>();
+    res.sort_by(|(op, variant, n), (op_, variant_, n_)| n_.cmp(n).then((op, variant).cmp(&(op_, variant_))));
+    res
+  }
+
+  /// Returns the histogram of stack lookup lengths: element `0` counts lookups traversing no links,
+  /// and element `i > 0` counts lookups traversing `2^(i-1)` to `2^i - 1` links.
+  pub fn lookup_histogram(&self) -> Vec<usize> {
+    self.flush();
+    self.lookups.borrow().clone()
+  }
+
+  /// Writes the self time (in nanoseconds) of each stack of names in the folded stack format, one
+  /// stack per line, with `root` as the outermost frame if not empty.
+  pub fn write_folded(&self, root: &str, out: &mut impl Write) -> std::io::Result<()> {
+    let mut stacks = self.folded.borrow().iter().map(|(path, time)| (path.clone(), *time)).collect::<Vec<_>>();
+    stacks.sort();
+    for (path, time) in stacks {
+      match root {
+        "" => writeln!(out, "{path} {}", time.as_nanos())?,
+        root => writeln!(out, "{root};{path} {}", time.as_nanos())?,
+      }
+    }
+    Ok(())
+  }
+
+  /// Discards everything recorded.
+  pub fn reset(&mut self) {
+    *self = Self { prefix: take(&mut self.prefix), ..Self::default() };
+  }
+}
@@ -0,0 +1,520 @@
+//! # Language server
+//!
+//! A long-running server for editors, speaking a subset of the Language Server Protocol (i.e.
+//! JSON-RPC messages framed by `Content-Length` headers): full text synchronisation, diagnostics
+//! and hover. Documents are blocks of top-level definitions `{ name ≔ term, … }`, checked
+//! incrementally by a [`Session`] in their own arenas, see [`Document`].
+//!
+//! - See: <https://microsoft.github.io/language-server-protocol/specifications/lsp/3.17/specification/>
+
+use std::cell::Cell;
+use std::collections::HashMap;
+use std::io::{BufRead, Write};
+use std::panic::{catch_unwind, AssertUnwindSafe};
+use std::sync::mpsc::{channel, Receiver, Sender};
+use std::thread::{available_parallelism, Builder};
+
+use crate::arena::Arena;
+use crate::elab::Session;
+use crate::io::{Json, Lexer, ParseError, Span, Token};
+use crate::ir::{Field, Global, Name, Named, Term};
+
+/// JSON-RPC error code for malformed messages.
+const PARSE_ERROR: f64 = -32700.0;
+
+/// JSON-RPC error code for unknown methods.
+const METHOD_NOT_FOUND: f64 = -32601.0;
+
+/// JSON-RPC error code for missing or malformed parameters.
+const INVALID_PARAMS: f64 = -32602.0;
+
+/// Size that document arenas may grow to before they are rebuilt, see [`run_document`].
+const REBUILD_BYTES: usize = 64 << 20;
+
+/// Stack size of document threads. Due to heavy use of recursion, it is much larger than usual,
+/// but bounded since every open document has its own thread.
+const DOCUMENT_STACK_SIZE: usize = 256 << 20;
+
+/// Maximum size of incoming messages, see [`read_message`].
+pub const MAX_MESSAGE_BYTES: usize = 64 << 20;
+
+/// # Documents
+///
+/// The text of a block of top-level definitions being edited, and the results of checking it. On
+/// each update, the whole text is lexed again (which is cheap), but only definitions whose source
+/// text changed are parsed again, and the [`Session`] only checks those and their dependents
+/// again. Preterms and results are allocated in the arena of the document, which only grows with
+/// the edited definitions.
+///
+/// Hover queries are answered from the types of checked definitions, without checking anything.
+/// Each type is printed once, and reused for as long as its definition is.
+#[derive(Debug)]
+pub struct Document<'b> {
+  ar: &'b Arena,
+  session: Session<'b>,
+  text: String,
+  parsed: HashMap<String, (&'b Field<'b>, &'b Term<'b, 'b, Named>)>,
+  defs: Vec<Def<'b>>,
+  printed: HashMap<*const Global<'b>, String>,
+}
+
+/// A definition in the current text: byte ranges of its name and of the whole definition, and the
+/// global definition it was checked into, if it was.
+#[derive(Debug, Clone, Copy)]
+struct Def<'b> {
+  name: (usize, usize),
+  span: (usize, usize),
+  global: Option<&'b Global<'b>>,
+}
+
+/// # Diagnostics
+///
+/// An error message attached to a range of a document. Positions are byte offsets.
+#[derive(Debug, Clone, PartialEq, Eq)]
+pub struct Diagnostic {
+  pub start: usize,
+  pub end: usize,
+  pub message: String,
+}
+
+impl Diagnostic {
+  fn parse_error(err: &ParseError, len: usize) -> Self {
+    let (start, end) = err.position(len);
+    Self { start, end, message: err.to_string() }
+  }
+}
+
+impl<'b> Document<'b> {
+  /// Creates an empty document allocating in the given arena.
+  pub fn new(ar: &'b Arena) -> Self {
+    let session = Session::new(ar);
+    Self { ar, session, text: String::new(), parsed: HashMap::new(), defs: Vec::new(), printed: HashMap::new() }
+  }
+
+  /// Returns the current text.
+  pub fn text(&self) -> &str {
+    &self.text
+  }
+
+  /// Returns the number of definitions checked (i.e. not reused) by the last update.
+  pub fn checked_count(&self) -> usize {
+    self.session.checked_count()
+  }
+
+  /// Replaces the text and checks it again. Definitions up to the first syntax error are checked,
+  /// and the errors found are returned.
+  pub fn update(&mut self, text: String) -> Vec<Diagnostic> {
+    let ar = self.ar;
+    self.text = text;
+    self.defs.clear();
+    let spans = Lexer::new(&self.text).collect::<Vec<_>>();
+    let (blocks, err) = split(&spans);
+    let mut diags = Vec::new();
+    diags.extend(err.map(|err| Diagnostic::parse_error(&err, self.text.len())));
+    let mut parsed = HashMap::new();
+    let mut defs = Vec::new();
+    for (name, body) in blocks {
+      let span = (name.start, body[body.len() - 1].end);
+      let src = &self.text[span.0..span.1];
+      let entry = match self.parsed.get(src) {
+        Some(entry) => *entry,
+        None => match parse_def(name, body, ar) {
+          Ok(entry) => entry,
+          Err(err) => {
+            // A syntax error supersedes the errors found after it.
+            diags = vec![Diagnostic::parse_error(&err, self.text.len())];
+            break;
+          }
+        },
+      };
+      parsed.insert(src.to_string(), entry);
+      self.defs.push(Def { name: (name.start, name.end), span, global: None });
+      defs.push((entry.0, *entry.1));
+    }
+    self.parsed = parsed;
+    let res = self.session.check(&defs).map(|_| ()).map_err(|err| err.to_string());
+    let mut globals = self.session.globals().iter();
+    for def in &mut self.defs {
+      def.global = globals.next();
+    }
+    if let Err(message) = res {
+      let def = self.defs.iter().find(|def| def.global.is_none()).unwrap();
+      diags.insert(0, Diagnostic { start: def.span.0, end: def.span.1, message });
+    }
+    diags
+  }
+
+  /// Returns the byte range of the name and the type of the checked definition at byte offset
+  /// `pos`, if there is one.
+  pub fn hover(&mut self, pos: usize) -> Option<(usize, usize, &str)> {
+    let ar = self.ar;
+    let def = self.defs.iter().find(|def| def.span.0 <= pos && pos <= def.span.1)?;
+    let global = def.global?;
+    let text = self.printed.entry(global).or_insert_with(|| {
+      // The quoted type is only needed for printing, so it is allocated in a region.
+      let temp = ar.region();
+      let name = global.info.name.as_str();
+      match global.ty.quote(0, &temp) {
+        Ok(ty) => format!("{name} : {ty}"),
+        Err(err) => format!("{name} : <{err}>"),
+      }
+    });
+    Some((def.name.0, def.name.1, text))
+  }
+}
+
+/// Splits the tokens of a block `{ name ≔ term, … }` into the names and bodies of its definitions.
+/// Stops at the first token which does not fit the block structure, and returns the error.
+fn split<'t, 's>(spans: &'t [Span<'s>]) -> (Vec<(Span<'s>, &'t [Span<'s>])>, Option<ParseError>) {
+  let at = |i: usize| spans.get(i).copied();
+  let mut defs = Vec::new();
+  let Some(Span { tok: Token::LeftBrace, .. }) = at(0) else { return (defs, Some(ParseError::unexpected(at(0)))) };
+  let mut i = 1;
+  if let Some(Span { tok: Token::RightBrace, .. }) = at(i) {
+    i += 1;
+  } else {
+    loop {
+      let name = match at(i) {
+        Some(span @ Span { tok: Token::Id(_), .. }) => span,
+        next => return (defs, Some(ParseError::unexpected(next))),
+      };
+      let Some(Span { tok: Token::Def, .. }) = at(i + 1) else {
+        return (defs, Some(ParseError::unexpected(at(i + 1))));
+      };
+      // The body extends to the next separator or closing bracket outside of any brackets.
+      let (start, mut j, mut depth) = (i + 2, i + 2, 0);
+      while let Some(span) = at(j) {
+        match span.tok {
+          Token::LeftParen | Token::LeftBracket | Token::LeftBrace => depth += 1,
+          Token::Sep | Token::RightParen | Token::RightBracket | Token::RightBrace if depth == 0 => break,
+          Token::RightParen | Token::RightBracket | Token::RightBrace => depth -= 1,
+          _ => {}
+        }
+        j += 1;
+      }
+      if j == start {
+        return (defs, Some(ParseError::unexpected(at(j))));
+      }
+      defs.push((name, &spans[start..j]));
+      match at(j) {
+        Some(Span { tok: Token::Sep, .. }) => i = j + 1,
+        Some(Span { tok: Token::RightBrace, .. }) => {
+          i = j + 1;
+          break;
+        }
+        next => return (defs, Some(ParseError::unexpected(next))),
+      }
+    }
+  }
+  match at(i) {
+    None => (defs, None),
+    next => (defs, Some(ParseError::unexpected(next))),
+  }
+}
+
+/// Parses a definition given the tokens of its name and body.
+fn parse_def<'b>(
+  name: Span,
+  body: &[Span],
+  ar: &'b Arena,
+) -> Result<(&'b Field<'b>, &'b Term<'b, 'b, Named>), ParseError> {
+  let name = match name.tok {
+    Token::Id("_") => Name::EMPTY,
+    Token::Id(x) => Name::new(x, ar),
+    _ => return Err(ParseError::unexpected(Some(name))),
+  };
+  // The parser stops at the first token which cannot continue the term, which is the last one
+  // pulled, unless all tokens have been pulled (and the end of input has been seen).
+  let pulled = Cell::new(0);
+  let tokens = std::iter::from_fn(|| {
+    pulled.set(pulled.get() + 1);
+    body.get(pulled.get() - 1).copied()
+  });
+  let term = Term::parse(tokens, ar)?;
+  match pulled.get() {
+    n if n > body.len() => Ok((ar.field(Field::new(name, &[], ar)), term)),
+    n => Err(ParseError::unexpected(Some(body[n - 1]))),
+  }
+}
+
+/// Converts a position (line, and column in UTF-16 code units) to a byte offset in `text`. Columns
+/// past the end of the line are clamped to it.
+pub fn offset(text: &str, line: usize, col: usize) -> usize {
+  let start = match line {
+    0 => 0,
+    _ => text.match_indices('\n').nth(line - 1).map_or(text.len(), |(i, _)| i + 1),
+  };
+  let mut units = 0;
+  for (i, c) in text[start..].char_indices() {
+    if units >= col || c == '\n' {
+      return start + i;
+    }
+    units += c.len_utf16();
+  }
+  text.len()
+}
+
+/// Converts a byte offset in `text` to a position (line, and column in UTF-16 code units).
+pub fn position(text: &str, offset: usize) -> (usize, usize) {
+  let before = &text[..offset.min(text.len())];
+  let start = before.rfind('\n').map_or(0, |i| i + 1);
+  (before.matches('\n').count(), before[start..].encode_utf16().count())
+}
+
+/// Converts a byte range in `text` to a range object.
+fn range(text: &str, start: usize, end: usize) -> Json {
+  let pos = |offset| {
+    let (line, col) = position(text, offset);
+    Json::object([("line", Json::Number(line as f64)), ("character", Json::Number(col as f64))])
+  };
+  Json::object([("start", pos(start)), ("end", pos(end))])
+}
+
+/// # Document jobs
+///
+/// Work sent to the thread of a document, see [`run_document`].
+#[derive(Debug)]
+enum Job {
+  Update { version: Json, text: String },
+  Hover { id: Json, line: usize, col: usize },
+}
+
+/// Runs the thread of document `uri`, which owns its arena and [`Document`], until the job channel
+/// is closed. Edits arriving while the document is being checked are coalesced, so that only the
+/// latest text is checked, and hovers are answered on that text.
+///
+/// Replaced objects are never freed from a document arena, so once it has grown several times
+/// larger than after the first check (and past [`REBUILD_BYTES`]), the document is checked again
+/// from scratch in a fresh arena. Large tuples are checked on worker threads, see
+/// [`Arena::set_threads`].
+///
+/// A panic while checking is reported as an internal error of the whole text, and the document is
+/// rebuilt empty in a fresh arena, so that later edits are still checked.
+fn run_document(uri: String, jobs: Receiver<Job>, out: Sender<Json>) {
+  let mut pending = None;
+  loop {
+    let ar = Arena::new();
+    ar.set_threads(available_parallelism().map_or(1, |n| n.get()));
+    let mut doc = Document::new(&ar);
+    let mut base = None;
+    loop {
+      let job = match pending.take() {
+        Some(job) => job,
+        None => match jobs.recv() {
+          Ok(job) => job,
+          Err(_) => return,
+        },
+      };
+      match job {
+        Job::Update { mut version, mut text } => {
+          let mut hovers = Vec::new();
+          while let Ok(job) = jobs.try_recv() {
+            match job {
+              Job::Update { version: v, text: t } => (version, text) = (v, t),
+              hover => hovers.push(hover),
+            }
+          }
+          let res = catch_unwind(AssertUnwindSafe(|| doc.update(text)));
+          let panicked = res.is_err();
+          let diags = res
+            .unwrap_or_else(|_| vec![Diagnostic { start: 0, end: 0, message: "internal error: panicked".to_string() }]);
+          let diags = diags.iter().map(|diag| {
+            Json::object([
+              ("range", range(doc.text(), diag.start, diag.end)),
+              ("severity", Json::Number(1.0)),
+              ("source", Json::String("zenith".to_string())),
+              ("message", Json::String(diag.message.clone())),
+            ])
+          });
+          let params = Json::object([
+            ("uri", Json::String(uri.clone())),
+            ("version", version.clone()),
+            ("diagnostics", Json::Array(diags.collect())),
+          ]);
+          let _ = out.send(notification("textDocument/publishDiagnostics", params));
+          for hover in hovers {
+            if let Job::Hover { id, line, col } = hover {
+              let res = if panicked { Json::Null } else { hover_result(&mut doc, line, col) };
+              let _ = out.send(response(id, res));
+            }
+          }
+          if panicked {
+            break;
+          }
+          let bytes = ar.byte_count();
+          if bytes > REBUILD_BYTES.max(4 * *base.get_or_insert(bytes)) {
+            pending = Some(Job::Update { version, text: doc.text().to_string() });
+            break;
+          }
+        }
+        Job::Hover { id, line, col } => {
+          let _ = out.send(response(id, hover_result(&mut doc, line, col)));
+        }
+      }
+    }
+  }
+}
+
+/// Returns the result of a hover request.
+fn hover_result(doc: &mut Document, line: usize, col: usize) -> Json {
+  let pos = offset(doc.text(), line, col);
+  let Some((start, end, text)) = doc.hover(pos) else { return Json::Null };
+  let (text, range) = (text.to_string(), range(doc.text(), start, end));
+  let contents = Json::object([("kind", Json::String("plaintext".to_string())), ("value", Json::String(text))]);
+  Json::object([("contents", contents), ("range", range)])
+}
+
+/// Creates a response message.
+fn response(id: Json, result: Json) -> Json {
+  Json::object([("jsonrpc", Json::String("2.0".to_string())), ("id", id), ("result", result)])
+}
+
+/// Creates an error response message.
+fn error(id: Json, code: f64, message: String) -> Json {
+  let error = Json::object([("code", Json::Number(code)), ("message", Json::String(message))]);
+  Json::object([("jsonrpc", Json::String("2.0".to_string())), ("id", id), ("error", error)])
+}
+
+/// Creates a notification message.
+fn notification(method: &str, params: Json) -> Json {
+  Json::object([
+    ("jsonrpc", Json::String("2.0".to_string())),
+    ("method", Json::String(method.to_string())),
+    ("params", params),
+  ])
+}
+
+/// # Language servers
+///
+/// Dispatches incoming messages, and sends responses and notifications to an output channel. Each
+/// open document is checked on its own thread (see `run_document`), so the dispatching thread
+/// never waits for elaboration, and documents are checked in parallel.
+#[derive(Debug)]
+pub struct Server {
+  out: Sender<Json>,
+  docs: HashMap<String, Sender<Job>>,
+}
+
+impl Server {
+  /// Creates a server sending its messages to `out`.
+  pub fn new(out: Sender<Json>) -> Self {
+    Self { out, docs: HashMap::new() }
+  }
+
+  /// Handles an incoming message. Returns `false` if the client asked the server to exit.
+  pub fn handle(&mut self, msg: &str) -> bool {
+    let msg = match Json::parse(msg) {
+      Ok(msg) => msg,
+      Err(err) => {
+        let _ = self.out.send(error(Json::Null, PARSE_ERROR, err.to_string()));
+        return true;
+      }
+    };
+    let method = msg.get("method").and_then(Json::as_str);
+    let params = msg.get("params").unwrap_or(&Json::Null);
+    let doc = params.get("textDocument");
+    let uri = doc.and_then(|doc| doc.get("uri")).and_then(Json::as_str);
+    let res = match (method, msg.get("id").cloned()) {
+      (Some("initialize"), Some(id)) => {
+        let capabilities = Json::object([("textDocumentSync", Json::Number(1.0)), ("hoverProvider", Json::Bool(true))]);
+        let info = Json::object([("name", Json::String("zenith".to_string()))]);
+        response(id, Json::object([("capabilities", capabilities), ("serverInfo", info)]))
+      }
+      (Some("shutdown"), Some(id)) => {
+        self.docs.clear();
+        response(id, Json::Null)
+      }
+      (Some("exit"), None) => {
+        self.docs.clear();
+        return false;
+      }
+      (Some("textDocument/didOpen"), None) => {
+        let text = doc.and_then(|doc| doc.get("text")).and_then(Json::as_str);
+        let version = doc.and_then(|doc| doc.get("version")).cloned().unwrap_or(Json::Null);
+        if let (Some(uri), Some(text)) = (uri, text) {
+          let (jobs, rx) = channel();
+          let (name, out) = (uri.to_string(), self.out.clone());
+          let thread = Builder::new().stack_size(DOCUMENT_STACK_SIZE).spawn(move || run_document(name, rx, out));
+          if thread.is_ok() {
+            let _ = jobs.send(Job::Update { version, text: text.to_string() });
+            self.docs.insert(uri.to_string(), jobs);
+          }
+        }
+        return true;
+      }
+      (Some("textDocument/didChange"), None) => {
+        // With full text synchronisation, the last change holds the whole text.
+        let changes = params.get("contentChanges").and_then(Json::as_array).unwrap_or(&[]);
+        let text = changes.last().and_then(|change| change.get("text")).and_then(Json::as_str);
+        let version = doc.and_then(|doc| doc.get("version")).cloned().unwrap_or(Json::Null);
+        if let (Some(jobs), Some(text)) = (uri.and_then(|uri| self.docs.get(uri)), text) {
+          let _ = jobs.send(Job::Update { version, text: text.to_string() });
+        }
+        return true;
+      }
+      (Some("textDocument/didClose"), None) => {
+        if let Some(uri) = uri {
+          self.docs.remove(uri);
+          let params = Json::object([("uri", Json::String(uri.to_string())), ("diagnostics", Json::Array(Vec::new()))]);
+          let _ = self.out.send(notification("textDocument/publishDiagnostics", params));
+        }
+        return true;
+      }
+      (Some("textDocument/hover"), Some(id)) => {
+        let pos = params.get("position");
+        let line = pos.and_then(|pos| pos.get("line")).and_then(Json::as_usize);
+        let col = pos.and_then(|pos| pos.get("character")).and_then(Json::as_usize);
+        match (uri, line, col) {
+          (Some(uri), Some(line), Some(col)) => match self.docs.get(uri) {
+            Some(jobs) => {
+              let _ = jobs.send(Job::Hover { id, line, col });
+              return true;
+            }
+            None => response(id, Json::Null),
+          },
+          _ => error(id, INVALID_PARAMS, "expected a document and a position".to_string()),
+        }
+      }
+      (Some(method), Some(id)) => error(id, METHOD_NOT_FOUND, format!("unknown method {method}")),
+      // Other notifications (e.g. `initialized`) and responses need no reply.
+      _ => return true,
+    };
+    let _ = self.out.send(res);
+    true
+  }
+}
+
+/// Reads a message framed by a `Content-Length` header. Returns [`None`] at the end of input, and
+/// an error if the message is larger than [`MAX_MESSAGE_BYTES`].
+pub fn read_message(input: &mut impl BufRead) -> std::io::Result<Option<String>> {
+  let mut len = None;
+  loop {
+    let mut line = String::new();
+    if input.read_line(&mut line)? == 0 {
+      return Ok(None);
+    }
+    match line.trim_end() {
+      "" if len.is_some() => break,
+      "" => return Err(std::io::Error::new(std::io::ErrorKind::InvalidData, "missing Content-Length header")),
+      line => {
+        if let Some(n) = line.strip_prefix("Content-Length:") {
+          len = n.trim().parse::<usize>().ok();
+        }
+      }
+    }
+  }
+  let len = len.unwrap();
+  if len > MAX_MESSAGE_BYTES {
+    return Err(std::io::Error::new(std::io::ErrorKind::InvalidData, "message too large"));
+  }
+  let mut buf = vec![0; len];
+  input.read_exact(&mut buf)?;
+  String::from_utf8(buf).map(Some).map_err(|err| std::io::Error::new(std::io::ErrorKind::InvalidData, err))
+}
+
+/// Writes a message framed by a `Content-Length` header.
+pub fn write_message(out: &mut impl Write, msg: &Json) -> std::io::Result<()> {
+  let body = msg.to_string();
+  write!(out, "Content-Length: {}\r\n\r\n{body}", body.len())?;
+  out.flush()
+}
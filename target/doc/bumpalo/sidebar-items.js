@@ -0,0 +1 @@
+window.SIDEBAR_ITEMS = {"struct":["AllocErr","Bump"]};
\ No newline at end of file
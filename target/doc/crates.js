@@ -0,0 +1,2 @@
+window.ALL_CRATES = ["bumpalo","zenith"];
+//{"start":21,"fragment_lengths":[9,9]}
\ No newline at end of file
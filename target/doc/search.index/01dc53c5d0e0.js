@@ -0,0 +1 @@
+rn_("AQIAOzAAAAEAAAUAAgD3DwQA2REAAAEAAbBAFMIAAWL0uQsAAAEAAQABAAEAAqBgAAAVC7AAEmACkG1zARASAABzgISgEAAAElwIBAM=")
\ No newline at end of file
@@ -0,0 +1 @@
+rn_("AQQA9AQVAAABAJEAAQATAQKggAAAFZhjaPW0EQAAAQABAAEAAQABAQA7MAAAAQAADQACAPgMCQBUFQMA8wACZXU7MAAAAQAAFQACADAGEwDSEgEA")
\ No newline at end of file
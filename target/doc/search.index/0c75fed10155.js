@@ -0,0 +1 @@
+rn_("AYACoDAAABWuoCAAABWsbG8TgwKgMAAAFa1jdwGAAqAwAAAVn6AgAAAVlGxv84MCY2YTgAKgEAAAE/NsdAEGAaEAAAAVr2kBWBUAABOBArBwFZUAFmVplwAAAYWgIAAAEqqwUBT+AJ6gMAAAFDURCBLyDA0AAAwHMQADBwCgMAAAFa1jb3f1KgcAAAEAAQABAOgK")
\ No newline at end of file
@@ -0,0 +1 @@
+rn_("AQAA9ZEMAAABAAEAAQABAAEIAaBAAAAVqmPz/BQAAAEAOgABAgGgMAAAFOV0OzAAAAEAAA4AAQCgEQ4AswCEoIAAABVPEMAEOzAAAAEAABoAAwCtBgsAAQgNAE8VAAA=")
\ No newline at end of file
@@ -0,0 +1 @@
+rn_("AQQA9FQVAAABAAEAAQABAgA7MAAAAQAABQABABsVBQABAwA7MAAAAQAABQABAEIVBQDzAQNjZXQ7MAAAAQAALQANAMYSAQAtFAMAyhQIANkUBQDsFAEA9BQDAP8UAQAOFQIAFRUDADMVAQA6FQMAjxUBAJoVAQA=")
\ No newline at end of file
@@ -0,0 +1 @@
+rn_("AYMCsAAT5AABsCAU0wABZWsTgAKwQBPmAAFicAECAPQ+FQAAAQABAAEA8wIBZfIRFQAAAQDzAQFkOzAAAAEAAAwAAQBwEQwAAYACoDAAABWuoCAAABWsbG8TgQKgMAAAFa1jd/OAAmxuAQMAOzAAAAEAAA0AAQA9Eg0AVwIAAIagUAAAFAOgQAAAFRSwMBVLAAERQQU7MAAAAQAAFQADAMQBDgBxDgQAARQBAA==")
\ No newline at end of file
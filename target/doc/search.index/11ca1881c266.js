@@ -0,0 +1 @@
+rn_("AQQA9FQVAAABAAEAAQABAgA7MAAAAQAABQABABsVBQABAwA7MAAAAQAABQABAEIVBQDzAQNjZXQ7MAAAAQAALQANAMYSAQAtFAMAyhQIANkUBQDsFAEA9BQDAP8UAQAOFQIAFRUDADMVAQA6FQMAjxUBAJoVAQDzAAFlOzAAAAEAAAcAAgDTDwMAuREDAAECAaAAAAAU7nM7MAAAAQAABQACAHwUAgDgFAIAg4CEsBAVBgABoBAAABWUoFAAABQmAKAJAYACoBAAABWfsAAVLAABbnMjgAKgIAAAElthbwEAhLBgFSMAAbAwFIEAAbAQEtIAAaAwAAAUgxBBEDswAAABAAAYAAIAiwwEAE0NEwDzAIQATAQ7MAAAAQAACgACANQCAAAuBwkA")
\ No newline at end of file
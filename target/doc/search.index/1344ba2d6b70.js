@@ -0,0 +1 @@
+rn_("AQADoHAAABWZsEAVlQAWoAAAABVPZWxzOzAAAAEAABsACgDXDwAA7w8EANARCAAXEgAAXRIAAKkSAADpEgQAJBQCACgVAACRFQAA")
\ No newline at end of file
@@ -0,0 +1 @@
+rn_("AQABoLAAABWdcwE6EgAAAQEA9NMUAAABAB4AAQDzAAFlOzAAAAEAABUAAQDdDBUAAQAA9OQTAAABAEwAAQCXAgCAhrAwEhQAPLAgFTgAELAwFL8A65BFBA==")
\ No newline at end of file
@@ -0,0 +1 @@
+rn_("AQUBoQAAABWvaQFYFQAAJwAAAMWwMBUsAAGwQBVLAAGwMBUuAAGwIBUMAAEACwAKOzAAAAEAABQAAgDIEgAA7hITABOAArBwFZUAFmVp")
\ No newline at end of file
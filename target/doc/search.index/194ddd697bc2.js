@@ -0,0 +1 @@
+rn_("AQIAOzAAAAEAAEUAAQA2FEUA8wABbTswAAABAABMAQEAHhBMAQEBAPUaDwAAAQABAAEAAQABAAD0fREAAAEAAQABAPMAAXM7MAAAAQAANAAIAKAMCgCYDgsAvxIDANUTCwDiEwEA7RMFACkUAwAZFQEAAQABoCAAABJLcDswAAABAAAFAAEAJwgFAAEAADswAAABAAC6AQIAVAh0AUETRQABAAA7MAAAAQAARwAHADgHNAAiEgMALhIFAAgTAQDQEwIA6hMBAKcVAQABA4SwMBUGAAGwMBUIAAGgMAAAFQqgQAAAFSsUAAPzFhIAAEMAAQB3DwCAyKBAAAAS3gCIrBg=")
\ No newline at end of file
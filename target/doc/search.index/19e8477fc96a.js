@@ -0,0 +1 @@
+rn_("AQAA9NMUAAABAB4AAQAjgAKwUBUjAAFkdBMAhLAwFIEAAbAQEtIAAaAwAAAUgxBBEDswAAABAAAuAAMAiwwEAN0MFQBNDRMA")
\ No newline at end of file
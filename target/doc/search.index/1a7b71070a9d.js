@@ -0,0 +1 @@
+rn_("AQQA9FQVAAABAAEAAQABAgA7MAAAAQAABQABABsVBQABAwA7MAAAAQAABQABAEIVBQABBAGhAAAAFa9pAVgVAADzAIQWAAQ7MAAAAQAAOAAPAOUPCQDGEgEA/BMAAC0UAwDKFAgA2RQFAOwUAQD0FAMA/xQBAA4VAgAVFQMAMxUBADoVAwCPFQEAmhUBAA==")
\ No newline at end of file
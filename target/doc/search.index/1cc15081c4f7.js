@@ -0,0 +1 @@
+rn_("AQAAOzAAAAEAAA0AAQCBEQ0AE4ECgBGPABABZHTzAAFlOzAAAAEAABsACADnAQcApgsEAE0MAwAHEAQAJhIBANcSAQDaEgAAABQAAAEEAPRUFQAAAQABAAEAAQIAOzAAAAEAAAUAAQAbFQUAAQMAOzAAAAEAAAUAAQBCFQUA8wQDY2V0OzAAAAEAACsADAAtFAMAyhQIANkUBQDsFAEA9BQDAP8UAQAOFQIAFRUDADMVAQA6FQMAjxUBAJoVAQAjgAKgQAAAEtxhZQEDAPMREgAAAQDHAAEAAPVKCAAAAQABAAEAAQABAwA7MAAAAQAABQACAK0SAwD0EwEA84ACbnQBAgD0vxIAAAEAAQABAPMAAXL1ygwAAAEAAQABAAEAI4ACoAAAABUBZHLHDgAAiKDgAAAVnaBQAAAS26CwAAAVnhWxBDswAAABAABYAAoATAAJAPQAGAA3AgsAkgUJAMAMBADJDgoArRIDALISBQD0EwQAwRQAAA==")
\ No newline at end of file
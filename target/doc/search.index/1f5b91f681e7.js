@@ -0,0 +1 @@
+rn_("AQAA9bkPAAABAAEAAQABAAECAPTDEgAAAQDcAgEAAQMA9OoTAAABALwBAQDzAAJwdjswAAABAAAJAAEAzwwJAAEEAPPgFAAAAQABALcAAADFoEAAABTBoEAAABUmAEMACTswAAABAABTAAoAJQcEAHQLMQCKDgQAtg4OABESAQAgEgEA2RIAAAcTAADkFAAASxUBAPMAAWUBmBUAAA==")
\ No newline at end of file
@@ -0,0 +1 @@
+rn_("AQUAOzAAAAEAAAUAAgDVFAMAKRUBACOBArAwE+wA+2ZtIwADoCAAABUooCAAAA/YaW9wOzAAAAEAAEsABwCrBQAAugwAAMQPAADYDwAANhRFAP4UAACcFQAA")
\ No newline at end of file
@@ -0,0 +1 @@
+rn_("AQMAOzAAAAEAADIAAQAOEzIAAQAA9ZQGAAABAAEAAQBVAQEEAPQEFQAAAQCRAAEAEwICoIAAABWYY2j1tBEAAAEAAQABAAEA84ADa2x3")
\ No newline at end of file
@@ -0,0 +1 @@
+rn_("AYACoDAAABWuoCAAABWsbG8TgwKgMAAAFa1jdwGAAqAwAAAVn6AgAAAVlGxvVwAAAIagMAAAEtugMAAAFLqgEAAAEqqgQAAAFN80EAM7MAAAAQAAFAAHAKkODABkDwAAuA8AAOQTAQADFAAAMRQBACUVAAA=")
\ No newline at end of file
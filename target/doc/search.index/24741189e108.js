@@ -0,0 +1 @@
+rn_("AYACoDAAABWuoCAAABWsbG8TgAKgMAAAFa1jdwEAhLAwFQYAAbAwFQgAAaAwAAAVCqBAAAAVKxQAA/MWEgAAQwABAAEAADswAAABAAAIAAEAYQ0IAPMAA2RlbDswAAABAAAJAAEAQwIJAA==")
\ No newline at end of file
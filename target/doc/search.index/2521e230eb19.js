@@ -0,0 +1 @@
+rn_("AQcAOzAAAAEAADIAAQBZFTIAAQMAOzAAAAEAADIAAQCEFDIA8wECaXQ7MAAAAQAA+gAEAJAMAABqDfcAnxUAAK4VAAA=")
\ No newline at end of file
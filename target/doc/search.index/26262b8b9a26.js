@@ -0,0 +1 @@
+rn_("AQMA8x4UAAABAAEAAQMAOzAAAAEAAAUAAgDLEgMAHBQBAPMAAmZ1OzAAAAEAAD0ABwCvByUAUgwJADYSAQBUEgIAChMCABkUAgAeFAIA")
\ No newline at end of file
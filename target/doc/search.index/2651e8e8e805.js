@@ -0,0 +1 @@
+rn_("AQEA9JwRAAABAAEAAQABgQKgQAAAFQGgAAAAEg9kZwEAAaAQAAAVAWU7MAAAAQAAHwAGAMAMBADJDgoArRIDALISBQD0EwQAwRQAAAECAPQ+FQAAAQABAAEA8wYBZfIRFQAAAQCjgISgAAAAEtygAAAAD/woACHzAANlaWw7MAAAAQAAYAAIAPYCJQAlBgkABwcJAN0HBABPCAQAgQwJAD8NBACBEQ0A")
\ No newline at end of file
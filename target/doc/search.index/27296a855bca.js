@@ -0,0 +1 @@
+rn_("AQEAOzAAAAEAAB0AAwCXDAMAdw4SAOASBgABgAKgEAAAEjqgEAAAEjhjbPMAAmF0OzAAAAEAABgAAwDiAhMAmAYAAOgUAwA=")
\ No newline at end of file
@@ -0,0 +1 @@
+rn_("AQAAOzAAAAEAABMAAgCKBgkA4gcJAAEAAPX9DgAAAQABAAEAAQDzAAFzOzAAAAEAAAsAAwCrCwkANBIAAMkSAADzgAJleQ==")
\ No newline at end of file
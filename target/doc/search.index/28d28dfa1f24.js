@@ -0,0 +1 @@
+rn_("AQACoHAAABWvoAAAABJebXM7MAAAAQAAKAAKAAEQBACXEQQA3hEEAA8SAADFEgAA/hMAAAUUEgAoFAAAxBQAADAVAQA=")
\ No newline at end of file
@@ -0,0 +1 @@
+rn_("AQIAOzAAAAEAAEUAAQA2FEUA8wABbTswAAABAABMAQEAHhBMAQEAAPR9EQAAAQABAAEA8wABczswAAABAAA0AAgAoAwKAJgOCwC/EgMA1RMLAOITAQDtEwUAKRQDABkVAQDzgAJydwEBAPV9DAAAAQABAAEATwbzAAJhbzswAAABAAAeAAIAJgMdAKoSAAA=")
\ No newline at end of file
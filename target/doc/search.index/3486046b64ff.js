@@ -0,0 +1 @@
+rn_("AQIBgBLUABABcwE5EgAAAQMAOzAAAAEAABIAAQAFFBIAI4ACoBAAABQnaXIBBAGgAAAAFU9z9ekSAAABAAEAAQABAAEEAPO3FAAAAQABAPMAhAQBDDswAAABAABAAAUATQIEABIGEgCZBhMA7gcSACwVAQA=")
\ No newline at end of file
@@ -0,0 +1 @@
+rn_("AYACoDAAABWuoCAAABWsbG8TgAKgMAAAFa1jdwEAhLAwFQYAAbAwFQgAAaAwAAAVCqBAAAAVKxQAA/MWEgAAQwABAPOAAmVs")
\ No newline at end of file
@@ -0,0 +1 @@
+rn_("AQQA9FQVAAABAAEAAQABAgA7MAAAAQAABQABABsVBQABAwA7MAAAAQAABQABAEIVBQDzBANjZXQ7MAAAAQAAKwAMAC0UAwDKFAgA2RQFAOwUAQD0FAMA/xQBAA4VAgAVFQMAMxUBADoVAwCPFQEAmhUBAA==")
\ No newline at end of file
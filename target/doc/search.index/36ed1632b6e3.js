@@ -0,0 +1 @@
+rn_("AQAAOzAAAAEAABIAAQCUDxIAAYACsAAT6AABsBASJgABZHgBBADzxxQAAAEAAQABAQGgIAAAE+F08l8SAACQAncCAADHoHAAABUyoDAAABLJoDAAABLKQEUICTswAAABAACgAAsAfQcdAOgLZADZDwsAGBIDAFISAQDLEgMA3xIAAAMTAQAcFAEA5RQAAC4VAQA=")
\ No newline at end of file
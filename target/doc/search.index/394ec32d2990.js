@@ -0,0 +1 @@
+rn_("AQABoQAAABWvaTswAAABAAAOAAYARA0IAMIUAQDjFAAAAhUAAFgVAACeFQAAAQQA938UAAABAM0AAQA/AAEAFgABBADzfBQAAAEAAQDzgQNjbHMBAAD19QkAAAEAAQABAAEAAQcAOzAAAAEAAAUAAgD4FAMANRUBAAEBADswAAABAABGAAIABhAAAGESRQABBgA7MAAAAQAABQACAPQUAwAzFQEAAQMAOzAAAAEAAAUAAQDtEwUA84ACcnjzAANlaW07MAAAAQAACgACAJsHCQD/EwAA8wACZXP1HwIAAAEAAQABAAEAAQIA88QPAAA6BZ4AAQMA9eMRAAABAAEAAQABAAEBADswAAABAABFAAEAhxNFAPMBAXTyOxIAAAEAAQMAOzAAAAEAAEUAAQBBE0UAAQQBoFAAABWcbAEYFAAA9w4AAIigMAAAFOQh8QQ7MAAAAQAAywASACEBXgBOAwkAigYJAL4GAADiBwkAfQwDAJcMCAANDRcAdw4SAJQOAwDPEgAA4BIGANUUAwApFQEAOBUAAEgVAACUFQAArBUAAA==")
\ No newline at end of file
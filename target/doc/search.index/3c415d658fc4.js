@@ -0,0 +1 @@
+rn_("AQIA9KkSAAB7AQEAbAEBBAD0KRQAAAEAAQABABMAAqAAAAARwWVyOzAAAAEAAA0AAQACDw0A8wACZWk7MAAAAQAADQACADUNCQB9EQMA")
\ No newline at end of file
@@ -0,0 +1 @@
+rn_("AQABsCAS1wABZTswAAABAAAeAAMAuQYEAA8IFwAGFQEAAQAA9ZEMAAABAAEAAQABAPMAAXQ7MAAAAQAAGgADAK0GCwABCA0ATxUAAAEAADswAAABAAAIAAEAYAwIAAEHADswAAABAAAyAAEAWRUyAAEDADswAAABAAAyAAEAhBQyAKMAhKBgAAAVmbAwE+IAAQgBBTswAAABAAD6AAQAkAwAAGoN9wCfFQAArhUAAGcKAADIoBAAAA+4sEAVlQAWoDAAABIVoDAAABLeAAULCzswAAABAAAlAA0AAwcDAFsLAADXDwAA7w8EAGsRBADQEQgAFxIAAF0SAACpEgAA6RIEACQUAgAoFQAAkRUAAA==")
\ No newline at end of file
@@ -0,0 +1 @@
+rn_("AQMAOzAAAAEAAEUAAQCHE0UAAQMAOzAAAAEAAEUAAQBBE0UAAQQBoFAAABWcbAEYFAAA8wADYWZpOzAAAAEAAA4ABACbDAQAlA4DANUUAwApFQEA")
\ No newline at end of file
@@ -0,0 +1 @@
+rn_("AQUAOzAAAAEAAAUAAgD0FAMAMxUBABOAAqAAAAAUAHB0AQMAOzAAAAEAAAkAAgDtEwUAKRQDAAGAAqBAAAAU46AQAAAS22JlswAEsCAVCAABZHJ2eDswAAABAAATAAIAyQYSANQTAAA=")
\ No newline at end of file
@@ -0,0 +1 @@
+rn_("AQAAOzAAAAEAABAAAgD0DwIAPRINAAEAAPUqBwAAAQABAAEA6AoBAAGgUAAAFO5jOzAAAAEAAAUAAgDaCwQAChUAAHOAhLAQEqwAJRAIDA==")
\ No newline at end of file
@@ -0,0 +1 @@
+rn_("AQAA9cUPAAABAAEAAQABAPMAAXM7MAAAAQAAFQAIAOMOCwAEFAAAfxQBAE0VAQCNFQEAlRUAAKQVAACrFQAAAQUAOzAAAAEAAA4ABgD4FAMANRUBAFAVAwCSFQEAohUBAKkVAABjgAOgYAAAFTJuc3Q=")
\ No newline at end of file
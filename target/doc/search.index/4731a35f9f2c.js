@@ -0,0 +1 @@
+rn_("AYACsBAUAQABsCAVGQABZXIBAAA7MAAAAQAACQABAOUPCQBTAAOgIAAAFABkZXI7MAAAAQAAIQABAB8PIQATAAKgYAAAFZFldjswAAABAAAKAAIA0wEJAA0TAAA=")
\ No newline at end of file
@@ -0,0 +1 @@
+rn_("AQADsEAVIQABoHAAABWvoAAAABJebG1zOzAAAAEAACgACgABEAQAlxEEAN4RBAAPEgAAxRIAAP4TAAAFFBIAKBQAAMQUAAAwFQEA")
\ No newline at end of file
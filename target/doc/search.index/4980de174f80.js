@@ -0,0 +1 @@
+rn_("AQIAOzAAAAEAAAUAAgCXEQQAxBQAAAEAADswAAABAAAXAAEA8REXAAEAAPW7DAAAAQABAAEAAQDzAAJkczswAAABAAAOAAEAqQ8OAGcAAICFoLAAABWvsAASrAAloDAAABUoGAEG")
\ No newline at end of file
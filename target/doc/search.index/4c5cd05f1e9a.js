@@ -0,0 +1 @@
+rn_("AQIAOzAAAAEAAAgAAgAuEgUA0BMCAAEBADswAAABAAAXAAEADQ0XAGMAA6AQAAASS2VscjswAAABAAAuAAIAngElANkCCAA=")
\ No newline at end of file
@@ -0,0 +1 @@
+rn_("AQAAOzAAAAEAABcAAQDxERcAAQAA98kJAAABAAEAAQA2CeoA+wABAAD1uwwAAAEAAQABAAEA8wADZGxzOzAAAAEAAA4AAQCpDw4A")
\ No newline at end of file
@@ -0,0 +1 @@
+rn_("AQEAOzAAAAEAADIAAQAOEzIAE4ACsFAVIQABZWcBAgA7MAAAAQAARQABADYURQABAQD17w4AAAEAAQABAAEA8wADZW1uOzAAAAEAAEwBAQAeEEwB")
\ No newline at end of file
@@ -0,0 +1 @@
+rn_("AQACoBAAABJYsAAUuwABZW87MAAAAQAACQABABAPCQABAAGgAAAAEl5zOzAAAAEAAB0ABAABEAQA3hEEAMUSAAAFFBIA84ACZ3Q=")
\ No newline at end of file
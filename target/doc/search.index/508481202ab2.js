@@ -0,0 +1 @@
+rn_("AQAAOzAAAAEAAAkAAgDzDAQAjw8EABOAAqAgAAAT/3N5AYECoEAAABUooCAAABTmdXYjgAKgMAAAFMBjbwEBADswAAABAAAlAAEAaQ8lAAEAADswAAABAAAVAAEA3QwVABOAArAwFL8A62tvlwMAAIagMAAAFa+g0AAAFasMCAc7MAAAAQAAGAAIABsHCQDZBwMAbwsEAOcSAAC6FAAA/BQBADcVAACvFQAA")
\ No newline at end of file
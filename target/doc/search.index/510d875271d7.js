@@ -0,0 +1 @@
+rn_("AYACoDAAABWuoCAAABWsbG8TgwKgMAAAFa1jdwGAAqAwAAAVn6AgAAAVlGxv84MCY2YTgAKgEAAAE/NsdAEFAaEAAAAVr2kBWBUAACcAAADFsDAVLAABsEAVSwABsDAVLgABsCAVDAABAAsACjswAAABAAAUAAIAyBIAAO4SEwATgQKwcBWVABZlaZcAAACFoCAAABKqsFAU/gCeoDAAABQ1EQgS8gwNAAAMBw==")
\ No newline at end of file
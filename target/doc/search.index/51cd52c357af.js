@@ -0,0 +1 @@
+rn_("AQMA8woTAAABAAEAAQMAOzAAAAEAAAUAAgAiEgMACBMBAAEDAPMgEgAAAQDmAAEDADswAAABAAAFAAIAHBIDAAUTAQABgwKwABQxAAGwIBTyAAFlaxOBArBAFDMAAWJwAQMAOzAAAAEAAAUAAgAYEgMAAxMBAAEHADswAAABAAAIAAIA2RQFAA4VAgABCgA7MAAAAQAABQACADoVAwCaFQEA8wCIsaEIOzAAAAEAAC8AAgBcAiUADBAJAA==")
\ No newline at end of file
@@ -0,0 +1 @@
+rn_("AYQCoDAAABWooCAAABWhcHYBAwGgQAAAFapj8/wUAAABADoA8wABbQHmFAAA84ECZG5DAAOgIAAAFRSgQAAAFShkdXY7MAAAAQAACQADAJQGAwDsBwAA4xEEAA==")
\ No newline at end of file
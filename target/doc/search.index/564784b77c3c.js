@@ -0,0 +1 @@
+rn_("AQQA9FQVAAABAAEAAQABAgA7MAAAAQAABQABABsVBQABAwA7MAAAAQAABQABAEIVBQDzBQNjZXQ7MAAAAQAAFgAGAMoUCAD/FAEAFRUDADoVAwCPFQEAmhUBAA==")
\ No newline at end of file
@@ -0,0 +1 @@
+rn_("AQQBoQAAABWvaQFYFQAA8wABYgH8EwAAJwAAAMWwMBUsAAGwQBVLAAGwMBUuAAGwIBUMAAEACwAKOzAAAAEAABoABQDoEQMAyBIAAO4SEwAnFQAAjBUAAA==")
\ No newline at end of file
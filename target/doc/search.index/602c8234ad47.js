@@ -0,0 +1 @@
+rn_("AQMA8xkUAAABAAEAIwACoAAAABIOaHU7MAAAAQAAcgAIANwGJQClBwkAUQwAABwSAwAoEgUABRMBAM0TAgBZFTIA")
\ No newline at end of file
@@ -0,0 +1 @@
+rn_("AQEDoHAAABWZsEAVlQAWoAAAABVPZWxzOjAAAAEAAAAAAAcAEAAAANcP6RLqEusS7BLtEiYUKBUBBAD06BQAAAEAAQABABcBAICFoAAAABQnoBAAABLeoHAAABUwFWAA")
\ No newline at end of file
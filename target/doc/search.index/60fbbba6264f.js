@@ -0,0 +1 @@
+rn_("AQABoAAAABTuczswAAABAAAdAAwAIRQCAHwUAgC3FAIAvhQBAMYUAwDgFAIAAxUCACMVAQBJFQEAlhUBAKUVAQCqFQAA")
\ No newline at end of file
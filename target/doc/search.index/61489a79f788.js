@@ -0,0 +1 @@
+rn_("AQIA9MMSAAABANwCAQABBAD0VBUAAAEAAQABAAEDAPTqEwAAAQC8AQEAAQMBoEAAABWqY/P8FAAAAQA6AAECAPQ+FQAAAQABAAEA8wEBZfIRFQAAAQABAQA7MAAAAQAABQABABsVBQAjgAKgAAAAEttkbwECADswAAABAAAFAAEAQhUFABOAArAwFSMAAWhvAQQBoQAAABWvafPjFAAAHwBWAHcfAADJoFAAABWZgE0kCjswAAABAACEABYAuwwEAM8MCQDlDwkASxIAAMYSAQDbEgEADhMyAOgTAQD8EwAALRQDAMoUCADZFAUA5hQAAOwUAQD0FAMA/xQCAA4VAgATFQUAMhUCADoVAwCPFQEAmhUBAA==")
\ No newline at end of file
@@ -0,0 +1 @@
+rn_("AQEAOzAAAAEAAAgAAgCbDAQAlA4DAAEDAaAwAAAU8WEB/RMAAPMAAWk7MAAAAQAAyQEFAAkKTAGHE0UAgRQBAIQUMgC7FAEAAYQCoDAAABWnoCAAABWgcHYBgAKgEAAAEt6gkAAAFZllbwGAhKBAAAAVA7AQFRMAH6BgAAAVjKAgAAAVMJQBAPMBAW47MAAAAQAABgACAI8OBABXEgEA9wEAAIagAAAAFO4QYQM7MAAAAQAAMQARABAPCQCPEQIApxIBALESAAAhFAIAfBQCALcUAgC+FAEAxhQDAOAUAgADFQIAIxUBAD4VAwBJFQEAlhUBAKUVAQCqFQAA")
\ No newline at end of file
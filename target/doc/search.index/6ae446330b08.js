@@ -0,0 +1 @@
+rn_("AYECoEAAABUooCAAABTmdXYjgAKgMAAAFMBjb4cAAACFsEAUvwDroDAAABWvoNAAABWroDAAABP/DAgGOzAAAAEAABcABwAbBwkA2QcDAG8LBADnEgAAuhQAAPwUAQA3FQAA")
\ No newline at end of file
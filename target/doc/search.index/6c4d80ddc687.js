@@ -0,0 +1 @@
+rn_("AQAAOzAAAAEAABIAAQCUDxIAAQQA88cUAAABAAEAJwIAAMewEBJfApCwIBImAAGgcAAAFTKgMAAAEsmgMAAAEspARQgJOzAAAAEAAIYABQB9Bx0A6AtkAN8SAADlFAAALhUBAA==")
\ No newline at end of file
@@ -0,0 +1 @@
+rn_("AQYAOzAAAAEAAAUAAgAtFAMA7BQBAAEAAaAgAAAT03b2XAwAAAEAAQABANYFlQABBwDzkhUAAAEAFgAjAQOgEAAAEt2gAAAAFZllbXM7MAAAAQAAEwACAKsMDgCkDgQApwEAgIWgUAAAFQKgAAAAEt4ICDE=")
\ No newline at end of file
@@ -0,0 +1 @@
+rn_("AYACoDAAABWuoCAAABWsbG8TgwKgMAAAFa1jdwGAAqAwAAAVn6AgAAAVlGxv8wACY2byZA8AAMEF8wABZfKrEgAAfAE=")
\ No newline at end of file
@@ -0,0 +1 @@
+rn_("AQEAOzAAAAEAAAcAAQAWEAcAAQAAOzAAAAEAAAkAAQAMEAkAE4ACsBASFwBGZ28BAgGgQAAAFZ5i81ESAAC6Ai4A84ADYWl0")
\ No newline at end of file
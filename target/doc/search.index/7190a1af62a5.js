@@ -0,0 +1 @@
+rn_("AQIBoAAAABTuczswAAABAAAdAAwAIRQCAHwUAgC3FAIAvhQBAMYUAwDgFAIAAxUCACMVAQBJFQEAlhUBAKUVAQCqFQAA")
\ No newline at end of file
@@ -0,0 +1 @@
+rn_("AQABsEAT4gABZfUDBwAAAQABAAEAVQQBhAKgMAAAFaigIAAAFaFwdgEDAaBAAAAVqmPz/BQAAAEAOgDzAAFtAeYUAADzgQJkbiOAAqBAAAAVKHV284ACbG4=")
\ No newline at end of file
@@ -0,0 +1 @@
+rn_("AQAA9cUPAAABAAEAAQABAPMBAXM7MAAAAQAAFQAIAOMOCwAEFAAAfxQBAE0VAQCNFQEAlRUAAKQVAACrFQAA8wABaQFbEgAA")
\ No newline at end of file
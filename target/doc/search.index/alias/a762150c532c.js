@@ -0,0 +1 @@
+rd_("")
\ No newline at end of file
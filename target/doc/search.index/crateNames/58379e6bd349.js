@@ -0,0 +1 @@
+rd_("gbumpalofzenith")
\ No newline at end of file
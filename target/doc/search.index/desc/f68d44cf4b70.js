@@ -0,0 +1 @@
+rd_("AhGarbage collection mark.000000000AcProfiled operations0000ChFunction types (bound variable info, parameter type, \xe2\x80\xa6CfFunction types (parameter type, <em>return type</em>).001000100010001000AoType annotations (value, type).000000000CiFunction applications (function, argument, dot-syntax \xe2\x80\xa60BkFunction applications (function, argument).CkFunction applications (head, arguments), with the whole \xe2\x80\xa62210221022102210CiReferences to <code>let</code>-bound definitions (value).0000AhApplication information.000CkFunction abstractions (bound variable info, <em>body</em>).BfFunction abstractions (<em>body</em>).001000100010001000jHypotheses0000ClLet expressions (bound variable info, value, <em>body</em>).BgLet expressions (value, <em>body</em>).10101010CjPosition of a field of a transparent binder: de Bruijn \xe2\x80\xa60000CjTuple types (field variable info, <em>element types</em>).0BeTuple types (<em>element types</em>).01100110011001100DbTuple constructors (field variable info, <em>element values</em>).CiTuple constructors (field variable info, element values).BmTuple constructors (<em>element values</em>).BdTuple constructors (element values).3210321032103210gValues.fValues0mValue handles211021102110110AoVariables in de Bruijn indices.000000000CaRecords a new allocation of <code>n</code> bytes.000EfApplies <code>self</code> to <code>x</code>. In the case of a redex, the (\xce\xb2) rule \xe2\x80\xa6EbApplies <code>f</code>, which is not a function abstraction, to <code>n</code> \xe2\x80\xa61010101DjReturns the values whose conclusions may unify with <code>goal</code>, \xe2\x80\xa6ClReturns the global definition with the given name, if it \xe2\x80\xa6CeReturns the position of the given name, if it exists.CiReturns the value at the given de Bruijn index, if it \xe2\x80\xa6000DfReturns the argument of the <code>k</code>-th application from the \xe2\x80\xa643EaReturns the value of field <code>key</code> if <code>self</code> is an object \xe2\x80\xa63222215403222215403222215403222BiReturns the number of values in the tree.BiReturns the number of global definitions.B`Returns the length of the stack.00BeReturns the length of an environment.B`Returns the number of arguments.43222104322210432221043222EcTokenises <code>input</code> into a list of <code>Span</code>. The list is only \xe2\x80\xa6CnTokenises <code>input</code> into a list of <code>Span</code>.10101010AgCreates an empty arena.AfCreates an empty tree.AgCreates an empty table.DiCreates a search over hypotheses <code>hyps</code>, allocating states \xe2\x80\xa6CgCreates an empty session allocating in the given arena.CaCreates a lexer at the start of <code>src</code>.BoCreates an empty index. This does not allocate.BhCreates a new machine with empty stacks.CeCreates a new bound variable info in the given arena.CeCreates a new field variable info in the given arena.AgCreates an empty stack.:00:BoCreates an empty spine. This does not allocate.;:987654CnReturns the name with given contents interned in the given \xe2\x80\xa6432<22<ChCreates an empty document allocating in the given arena.CjCreates a server sending its messages to <code>out</code>.3>=<;:9872654>44>103>=<;:9872654>44>103>=<;:9872654>44>10CfAllocates a new value, reusing an identical one if \xe2\x80\xa6ClAllocates a new value. Universes and free variables with \xe2\x80\xa6AfAllocates a new value.AbAllocates a value.321032103210321DaArguments of neutral applications, see <code>ValView::App</code>.000iClosures.hClosures0oClosure handles211021102110110AdCore term decoration0000D`Free variables in de Bruijn <em>levels</em> for cheap weakening.000000000BkTuple initial segments (truncation, tuple).0000000000000000000kJSON values000mOperand lists0000kArena marks0000AlHoles in unique identifiers.AhHoles (environment, id).10101010AhVariable and field names0000AbPrecedence levels.000000000BaTuple projections (index, tuple).0000000000000000000kError sinks00000kLexer spans000000000fTerms.eTerms0lTerm handles211021102110110AcUniverse in levels.0000000000000000000CmReturns the arguments of a neutral application, outermost \xe2\x80\xa6000CnRecords a (\xce\xb2) step, failing if the evaluation has to stop \xe2\x80\xa6000CmExtends the context with a new binder, updating the index \xe2\x80\xa60000AhAllocates a new closure.00AaBuilds a closure.111011101110111DhCreates a new frame on top of <code>prev</code>. This does not allocate.0000000000000AkSee <code>Val::conv</code>.EhReturns if <code>self</code> and <code>other</code> are definitionally equal. Can be \xe2\x80\xa60EfReturns if <code>self</code> and <code>other</code> are definitionally equal. Same \xe2\x80\xa6EdReturns if <code>x</code> and <code>y</code> are definitionally equal. Can be an \xe2\x80\xa63221032210322103221AlSee <code>Term::eval</code>.EbReduces <code>self</code> so that all <code>let</code>s are collected into the \xe2\x80\xa600DoReduces <code>x</code> so that all <code>let</code>s are collected into the \xe2\x80\xa62111021110211102111CmCloses the current timing scope, attributing the time not \xe2\x80\xa60000CiReturns the frame at the given de Bruijn index, if it \xe2\x80\xa60000AoReturns the argument unchanged.00000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000DgReturns the remaining number of (\xce\xb2) steps, or <code>None</code> if \xe2\x80\xa6000DkIndexes the variables of context <code>ctx</code> and the fields of its \xe2\x80\xa60000BaCalls <code>U::from(self)</code>.00000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000ClReturns all global definitions (including shadowed ones) \xe2\x80\xa60000CeRecords a link traversed in the current stack lookup.0000ClLoads all global definitions from a snapshot produced by \xe2\x80\xa60000BeBuilds a term of the common fragment.000BeReturns the current numbers of nodes.0000DhCreates a new hole of type <code>ty</code> under a context with size \xe2\x80\xa60000AaUnpacks the node.000000000CmReturns the binder information, environment and body of a \xe2\x80\xa6000CkReturns the peak number of bytes live in the arena, its \xe2\x80\xa6000EfReturns the previous frame, or <code>None</code> if <code>self</code> is the empty \xe2\x80\xa60000CbAdds the argument of the next application inwards.000DjRecords an application of operation <code>op</code> to a term or value \xe2\x80\xa60000CiSerialises all global definitions (including shadowed \xe2\x80\xa60000CgRecords a (\xce\xb2) step, i.e. a function body or binder \xe2\x80\xa6000CeAllocates a new term, reusing an identical one if \xe2\x80\xa6ClAllocates a new term. Universes and variables with small \xe2\x80\xa6AeAllocates a new term.AaAllocates a term.321032103210321AiReturns the current text.000CfViews <code>x</code> as a term of the common fragment.000DkReplaces holes in elaborated term <code>self</code> by their solutions, \xe2\x80\xa60EcReplaces holes in value <code>self</code> under environment <code>env</code> by \xe2\x80\xa6101010gArenas.A`Arena allocators00100010001000000DhBinder information of <code>let</code>s, function types and function \xe2\x80\xa6AbBinder information1010100BaReferences to global definitions.0000BbThe empty name (i.e. transparent).000CkElements of tuple types and constructors, together with \xe2\x80\xa6000AbEvaluation errors.000CbField information of tuple types and constructors.AaField information1010100CnApplications headed by definitions (folded spine, unfolded \xe2\x80\xa60000lName indices0000fLexers0000AeNamed term decoration0000AbApplication spines000AhEvaluation environments.AbLinked list stacks0mStack handles211021102110110AgProof search statistics0000lLexer tokens000000000lMemory usage000AmSee <code>Clos::apply</code>.EfInserts a new <code>let</code> around the body after the frozen <code>let</code>s, \xe2\x80\xa60DfExtends the frozen environment with <code>x</code> and reduces the \xe2\x80\xa6FeInserts a new <code>let</code> around the body of <code>c</code> after the frozen <code>let</code>\xe2\x80\xa63221032210322103221DcGiven <code>self</code>, tries elimination as <code>Val::Pi</code>.000000000BdAllocates a new bound variable info.0000CjReturns the number of bytes allocated in the arena itself.000CmChecks a block of definitions in order, each of which can \xe2\x80\xa6GaGiven preterm <code>self</code> and type <code>t</code>, checks if <code>self</code> has type <code>t</code>. \xe2\x80\xa6001000100010001000CiCreates a profile for a region or worker arena, whose \xe2\x80\xa6DjReturns the usage of a new arena nested in <code>self</code>, with the \xe2\x80\xa61010101B`Returns the length of the stack.0000ChReturns a reference to an empty index. This does not \xe2\x80\xa6CkCreates a new bound variable info with empty name (i.e. \xe2\x80\xa6CjCreates a new field variable info with empty name (for \xe2\x80\xa6ChReturns the binder information of variables bound by \xe2\x80\xa6321032103210321DdOpens a timing scope named <code>name</code> inside the current one.0000AgBuilds a tuple element.000CfMakes an error from the constructor of a typing error.00000BdAllocates a new field variable info.0000CiUnfolds all definitions at the head of <code>self</code>.DcUnfolds definitions at the head of <code>v</code>, before it is \xe2\x80\xa601001001001AkAllocates a new stack item.0AlAllocates a new stack frame.110110110110CjReturns the byte range of the name and the type of the \xe2\x80\xa6000CmReturns the index of fields of transparent binders in the \xe2\x80\xa60000EcGiven preterm <code>self</code>, returns the type of <code>self</code>. This is \xe2\x80\xa600000000000000CnReturns the limit on the number of bytes live in the arena \xe2\x80\xa6000CiCopies a reference-based term into the arena. Garbage \xe2\x80\xa60000DfMerges the profile of a region or worker arena into <code>self</code>.CkRecords the peak of a nested arena which is about to be \xe2\x80\xa61010101D`Parses a sequence of <code>Span</code> into a <code>Term</code>.ClParses a list of <code>Span</code> into a <code>Term</code>.CfParses a JSON document, which may be surrounded by \xe2\x80\xa621021021021BlPretty-prints a term under given precedence.AePretty-prints a term.10101010EaSearches for a term of type <code>goal</code> under context <code>ctx</code>. \xe2\x80\xa60000BfQuotes the value into the given arena.AlSee <code>Val::quote</code>.EfReduces well-typed <code>self</code> to eliminate <code>let</code>s and convert it \xe2\x80\xa6200EhReduces well-typed <code>v</code> to eliminate <code>let</code>s and convert it back \xe2\x80\xa6321311032131103213110321311DoCopies <code>self</code> into a reference-based term in arena <code>dst</code>.0000CfDeallocates all objects and resets all performance \xe2\x80\xa60AhDeallocates all objects.AmDiscards everything recorded.CkForgets all allocations in the arena and nested arenas, \xe2\x80\xa63321033210332103321BgRuns <code>f</code> with a fresh table.0000CiSplits a tuple element into its field information and \xe2\x80\xa6000BnReturns the statistics of all searches so far.0000CkAllocates a new array of terms with field info for writing.BkAllocates a new array of terms for writing.CbAllocates a new list of terms for writing with \xe2\x80\xa6BbAllocates tuple elements of terms.321032103210321DgReturns the value of <code>self</code>. If gluing is enabled, it is \xe2\x80\xa60000AhLinked list stack frames0000AbGlobal definitions0000AdProof search budgets0000AdLazily quoted values000000000mArena regions0000lProof search0000A`Language servers000CbValues outside the common fragment (e.g. glued \xe2\x80\xa6000DdGiven <code>self</code>, tries elimination as <code>Val::Sig</code>.000000000CdReturns the string if <code>self</code> is a string.BaReturns the contents of the name.101010A`Shared machinery0000EgWraps <code>self</code> as the value of a <code>let</code>-bound variable if gluing \xe2\x80\xa6DiWraps the value of a <code>let</code> before it is collected into the \xe2\x80\xa601001001001BcExtends the stack with a new value.0BhExtends an environment with a new value.11011011011DgReturns the number of nodes of <code>self</code> and its nesting depth.00BbAllocates a new global definition.0000BgReturns if glued evaluation is enabled.0000DiHandles an incoming message. Returns <code>false</code> if the client \xe2\x80\xa6000EfInserts <code>value</code> indexed by the conclusion of type <code>ty</code> under \xe2\x80\xa6CmAdds a global definition, shadowing any existing one with \xe2\x80\xa6CkReturns a new index with the given entries added. Later \xe2\x80\xa6210210210210ClRecords the start of a stack lookup, ending the previous \xe2\x80\xa60000BgCreates an object from key-value pairs.000ChConverts a position (line, and column in UTF-16 code \xe2\x80\xa6000EeReturns if <code>self</code> and <code>other</code> are shallowly identical, i.e. \xe2\x80\xa60EgReturns if <code>x</code> and <code>y</code> are shallowly identical, which implies \xe2\x80\xa611011011011CnCreates a new region, reusing memory of previously dropped \xe2\x80\xa60EeRuns <code>f</code> with a new region nested in <code>self</code>, which is freed \xe2\x80\xa6101010oLanguage server000AgAllocates a new string.0000CkReturns the interned copy of a string, allocating it on \xe2\x80\xa60000ClReplaces the text and checks it again. Definitions up to \xe2\x80\xa6000BnReturns the <code>i</code>-th value in a list.0000CgAllocates a new array of values with field info for \xe2\x80\xa6CiReturns the values in the stack from the top, i.e. in \xe2\x80\xa6BlAllocates a new array of values for writing.CcAllocates a new list of values for writing with \xe2\x80\xa6BcAllocates tuple elements of values.4321043210432104321CjCreates a new arena for use by another thread, reusing \xe2\x80\xa60000AbVariable bindings.AhGlobal definitions tableAaAbstract machineshProfilesAmIncremental checking sessionsBoTerms outside the common fragment (e.g. holes).kValue nodesAmValues of the common fragmentDeGiven <code>self</code>, tries elimination as <code>Val::Univ</code>.0DiMinimal local stand-in for the parts of the <code>bumpalo</code> 3.16 \xe2\x80\xa6AdAllocates a closure.AcCompact node layoutEfRuns <code>f</code>, which relocates objects from a region into <code>self</code>, \xe2\x80\xa6EhRuns <code>f</code>, which relocates objects into <code>self</code>, copying objects \xe2\x80\xa6DiReduces a garbage collection mark, evaluating <code>x</code> inside a \xe2\x80\xa6DiReturns the existing copy of <code>x</code>, or makes a new copy (and \xe2\x80\xa6CkReturns the global definitions of the last successfully \xe2\x80\xa6EgGiven universes <code>v</code> and <code>w</code>, returns the universe of Pi types \xe2\x80\xa600BmReturns the profile, if profiling is enabled.CnFrees all objects in a region or worker arena, keeping its \xe2\x80\xa6DhDeallocates all objects allocated since <code>mark</code> was taken. \xe2\x80\xa6BjAllocates a new array of interned strings.BmReturns the <code>i</code>-th term in a list.CkReturns the number of worker threads for parallel checking.DdReturns the name of the variant of <code>self</code>, for profiling.0gCalculiiDocumentsmLexing errors0A`Named variables.A`Relocation traitjTerm nodesAlTerms of the common fragmentCfReturns the elements if <code>self</code> is an array.EeReturns the number as a <code>usize</code> if <code>self</code> is a non-negative \xe2\x80\xa6FdSame as <code>Term::check</code>, but only returns if <code>self</code> has type <code>t</code>. \xe2\x80\xa60BeAllocates tuple elements of closures.CiAllocates a new array of closures with field info for \xe2\x80\xa6BnAllocates a new array of closures for writing.EgDecides conversion of <code>x</code> and <code>y</code> before they are compared as \xe2\x80\xa60BkReduces a term outside the common fragment.CkReturns if the bytes live in the arena and its base are \xe2\x80\xa6BiReturns if two fields have the same name.DgSame as <code>DiscrTree::get</code>, but with a goal already quoted \xe2\x80\xa6BbReturns if there are no arguments.AmReturns if the tree is empty.BkReturns if there are no global definitions.C`Returns if the name is empty (i.e. transparent).AnReturns if the stack is empty.00EkReturns unsolved hole <code>m</code> under <code>let</code>s binding <code>terms</code> \xe2\x80\xa6BfBuilds a value of the common fragment.DhConverts a byte offset in <code>text</code> to a position (line, and \xe2\x80\xa6BhClones <code>self</code> to given arena.BcClones an error to the given arena.01111111DhLimits the number of (\xce\xb2) steps (see <code>Arena::step</code>) which \xe2\x80\xa6EdGiven universes <code>v</code> and <code>w</code>, returns the universe of Sigma \xe2\x80\xa600ClReturns the error for an initial segment longer than the \xe2\x80\xa6CdReturns the error for a projection out of the tuple.CgViews <code>v</code> as a value of the common fragment.AdDiscrimination treesAbElaboration errorsAaEvaluation errors00kJSON errorsDnNamed projections. To preserve covariance w.r.t. <code>&#39;a</code>, this \xe2\x80\xa6mTyping errors0CfReturns the error for an out-of-range de Bruijn index.CfReturns the error for an out-of-range de Bruijn level.CcReturns if memoisation of quoted values is enabled.CiReturns the type of a hole, which is a term under its \xe2\x80\xa6BkQuotes a value outside the common fragment.DkSame as <code>quote</code> for values allocated in the arena, where the \xe2\x80\xa60ClSets or removes the limit on the number of bytes live in \xe2\x80\xa6BfReturns the universe of the unit type.00DjGiven universe <code>u</code>, returns the universe of its type, if it \xe2\x80\xa6D`Given universe <code>u</code>, returns the universe of its type.0BjReturns the number of values in the arena.00A`Term decorationskDiagnosticsAaForwarding tablesnParsing errors0CcReturns the number of bytes allocated in the arena.0CkReturns the number of bytes used by all nodes in the arena.CnReturns the limit on the number of bytes live in the arena \xe2\x80\xa60DgSame as <code>Term::check</code>, but reports failures to the error \xe2\x80\xa60EaSame as <code>Term::check</code>, but names not bound in <code>ctx</code> are \xe2\x80\xa6BlReturns the number of closures in the arena.00DcReplaces solved holes at the head of <code>self</code> by their \xe2\x80\xa6DgSame as <code>Term::infer</code>, but reports failures to the error \xe2\x80\xa60EaSame as <code>Term::infer</code>, but names not bound in <code>ctx</code> are \xe2\x80\xa6CmReturns the number of lookups in the memoisation table of \xe2\x80\xa6BoReturns the number of holes in the metacontext.CmReturns the size of the context a hole was created in, if \xe2\x80\xa6B`Allocates a new name index node.CkReturns the peak number of bytes live in the arena, the \xe2\x80\xa60DbEnables or disables glued evaluation of <code>let</code>-bound \xe2\x80\xa6BkSets the <code>i</code>-th value in a list.DeReturns the number of (\xce\xb2) steps taken, see <code>Arena::step</code>.BiReturns the number of terms in the arena.00DhReplaces a solved hole at the head of spine <code>self</code> by its \xe2\x80\xa6BjReturns the number of frames in the arena.0ClReturns the number of frames in the arena, excluding the \xe2\x80\xa6ClReturns the number of bytes freed by dropping regions of \xe2\x80\xa6CdReturns the value with the given name, if it exists.DjSame as <code>DiscrTree::insert</code>, but with a type already quoted \xe2\x80\xa6BmReturns if a hole exists and has been solved.CkReturns the number of applications of each operation to \xe2\x80\xa6BjSets the <code>i</code>-th term in a list.CmSets the number of worker threads for checking the fields \xe2\x80\xa6CjExtends the context with a new binder, using the given \xe2\x80\xa6CkReturns the number of bytes relocated from regions into \xe2\x80\xa6BhReturns the number of interning lookups.BdReturns the number of stack lookups.0ChRecords a rule used by <code>conv</code>, for profiling.0ChRecords a rule used by <code>eval</code>, for profiling.0DkRecords an application of operation <code>op</code> to a term or value, \xe2\x80\xa6DkReads a message framed by a <code>Content-Length</code> header. Returns \xe2\x80\xa6CjRelocates a value into the arena, copying it only once \xe2\x80\xa60CmAllocates a new value, reusing an identical one if it has \xe2\x80\xa6CjWrites the self time (in nanoseconds) of each stack of \xe2\x80\xa6oSnapshot errorsCgReturns the number of definitions checked (i.e. not \xe2\x80\xa60DkReturns the existing copy of slice <code>xs</code>, or makes a new copy \xe2\x80\xa6CnChecks if a name can be directly used as a named variable, \xe2\x80\xa6ClReturns the fraction of memoisation lookups which reused \xe2\x80\xa6CmReturns the solution of a hole, which is a term under its \xe2\x80\xa6EbRuns <code>f</code> in a timing scope named <code>name</code>, if profiling is \xe2\x80\xa6ClRelocates a closure into the arena, copying it only once \xe2\x80\xa60CiRelocates a term into the arena, copying it only once \xe2\x80\xa60DdEnables or disables hash-consing in <code>Arena::term</code> and \xe2\x80\xa6DcEnables or disables memoisation of <code>Val::quote</code> (and \xe2\x80\xa6ClAllocates a new term, reusing an identical one if it has \xe2\x80\xa6D`Writes a message framed by a <code>Content-Length</code> header.CmIncrements the stack lookup length counter for profiling, \xe2\x80\xa60CjRelocates a stack item into the arena, copying it only \xe2\x80\xa60ClSets or removes the limit on the number of bytes live in \xe2\x80\xa60CmReturns the fraction of interning lookups which reused an \xe2\x80\xa6ClReturns if the bytes live in the arena and the arenas it \xe2\x80\xa6CmReturns if the bytes live in the arena and the regions it \xe2\x80\xa6CfVersion of the snapshot format. Snapshots of other \xe2\x80\xa6CiIncrements the stack lookup counter for profiling, if \xe2\x80\xa60DiReturns the histogram of stack lookup lengths: element <code>0</code> \xe2\x80\xa6EhAdds to <code>res</code> the fields of the tuple of <code>len</code> fields bound to \xe2\x80\xa6DaMaximum size of incoming messages, see <code>read_message</code>.CkPresents a variable as a named variable and returns its \xe2\x80\xa6CjResolves a named variable to a core term and its type. \xe2\x80\xa6C`Checks the byte limit, before each value quoted.BlReturns the average length of stack lookups.0CkPresents a projection as a named projection and returns \xe2\x80\xa6ChResolves a named projection to a core term and its type.ChReturns the number of unsolved holes in the metacontext.")
\ No newline at end of file
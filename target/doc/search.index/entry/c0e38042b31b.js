@@ -0,0 +1 @@
+rd_("Ag[4622,14,5080,0,4649,0]Ag[4622,14,5080,0,4655,0]Ag[4622,14,5103,0,4637,0]Ag[4622,14,5103,0,4643,0]Ag[4622,14,5082,0,4650,0]Ag[4622,14,5082,0,4656,0]Ag[4622,14,5104,0,4638,0]Ag[4622,14,5104,0,4644,0]Ag[4622,14,5084,0,4651,0]Ag[4622,14,5084,0,4657,0]9876543210987654321098765432109876543210Ai[4622,15,244,3049,1945,0]Aj[4622,15,4532,3050,1946,0]Aj[4622,15,4464,4818,4811,0]21021021021Ai[4622,15,239,4546,3329,0]Ai[4622,15,4532,234,3330,0]101010101010101010Ac[4622,6,4699,0,0,0]000025Ah[4622,15,244,3049,698,0]25Ai[4622,15,4532,3050,699,0]Aj[4622,15,4667,4667,4810,0]Aj[4622,15,4667,4667,4661,0]7Aj[4622,15,4464,4818,4662,0]7:469321807:469321807:469321807:469321Ag[4622,14,4800,0,5444,0]Ag[4622,14,4801,0,5445,0]Ag[4622,14,5091,0,5443,0]21021021021Aj[4664,13,4665,4665,4779,0]Ai[4622,13,2098,4570,548,0]Ai[4622,13,239,4546,3329,0]Ai[4622,13,239,4697,1847,0]Ai[4622,13,244,3049,1834,0]Ai[4622,13,4532,234,3330,0]Ai[4622,13,4532,234,1848,0]Aj[4622,13,4667,4667,1947,0]Ai[4622,13,4667,4667,700,0]Aj[4622,13,4667,4667,1709,0]Aj[4622,13,4667,4667,3315,0]Aj[4622,13,4667,4667,1814,0]Aj[4622,13,4667,4667,1819,0]Ah[4622,13,4699,4699,91,0]<Ai[4622,13,239,2908,1799,0]<;:987654321Aj[4622,13,4574,4574,5160,0]>1=<;:987654320>1=<;:987654320>1=<;:987654320Ag[4622,14,5078,0,5373,0]0000Ac[4622,2,4623,0,0,0]000000000Ag[4622,14,5080,0,4787,0]Ag[4622,14,5103,0,4782,0]Ag[4622,14,5082,0,4788,0]Ag[4622,14,5104,0,4783,0]Ag[4622,14,5084,0,4789,0]43210432104321043210Ag[4622,14,5103,0,5457,0]Ag[4622,14,5104,0,5458,0]10101010Ag[4622,14,5103,0,4058,0]Ag[4622,14,5104,0,4059,0]10101010Ag[4622,14,5078,0,5338,0]Ag[4622,14,5078,0,4641,0]Ai[4622,14,244,3049,4035,0]Ag[4622,14,5103,0,4637,0]Ag[4622,14,5103,0,4643,0]Ag[4622,14,5103,0,5365,0]Ag[4622,14,5103,0,5166,0]Ag[4622,14,5103,0,5339,0]Ag[4622,14,5103,0,5398,0]Ag[4622,14,5103,0,5435,0]Ag[4622,14,5103,0,5369,0]Ag[4622,14,5104,0,4638,0]Ag[4622,14,5104,0,4644,0]Ag[4622,14,5104,0,5366,0]Ag[4622,14,5104,0,5167,0]Ag[4622,14,5104,0,5340,0]Ag[4622,14,5104,0,5399,0]Ag[4622,14,5104,0,5436,0]Ag[4622,14,5104,0,5370,0]Ag[4622,14,5078,0,5338,0]Ag[4622,14,5078,0,4641,0]Ai[4622,14,244,3049,4035,0]Ag[4622,14,5103,0,4637,0]Ag[4622,14,5103,0,4643,0]Ag[4622,14,5103,0,5365,0]Ag[4622,14,5103,0,5166,0]Ag[4622,14,5103,0,5339,0]Ag[4622,14,5103,0,5398,0]Ag[4622,14,5103,0,5435,0]Ag[4622,14,5103,0,5369,0]Ag[4622,14,5104,0,4638,0]Ag[4622,14,5104,0,4644,0]Ag[4622,14,5104,0,5366,0]Ag[4622,14,5104,0,5167,0]Ag[4622,14,5104,0,5340,0]Ag[4622,14,5104,0,5399,0]Ag[4622,14,5104,0,5436,0]Ag[4622,14,5104,0,5370,0]Ag[4622,14,5078,0,5338,0]Ag[4622,14,5078,0,4641,0]Ai[4622,14,244,3049,4035,0]Ag[4622,14,5103,0,4637,0]Ag[4622,14,5103,0,4643,0]Ag[4622,14,5103,0,5365,0]Ag[4622,14,5103,0,5166,0]Ag[4622,14,5103,0,5339,0]Ag[4622,14,5103,0,5398,0]Ag[4622,14,5103,0,5435,0]Ag[4622,14,5103,0,5369,0]Ag[4622,14,5104,0,4638,0]Ag[4622,14,5104,0,4644,0]Ag[4622,14,5104,0,5366,0]Ag[4622,14,5104,0,5167,0]Ag[4622,14,5104,0,5340,0]Ag[4622,14,5104,0,5399,0]Ag[4622,14,5104,0,5436,0]Ag[4622,14,5104,0,5370,0]Ag[4622,14,5078,0,5338,0]Ag[4622,14,5078,0,4641,0]Ai[4622,14,244,3049,4035,0]Ag[4622,14,5103,0,4637,0]Ag[4622,14,5103,0,4643,0]Ag[4622,14,5103,0,5365,0]Ag[4622,14,5103,0,5166,0]Ag[4622,14,5103,0,5339,0]Ag[4622,14,5103,0,5398,0]Ag[4622,14,5103,0,5435,0]Ag[4622,14,5103,0,5369,0]Ag[4622,14,5104,0,4638,0]Ag[4622,14,5104,0,4644,0]Ag[4622,14,5104,0,5366,0]Ag[4622,14,5104,0,5167,0]Ag[4622,14,5104,0,5340,0]Ag[4622,14,5104,0,5399,0]Ag[4622,14,5104,0,5436,0]Ag[4622,14,5104,0,5370,0]Ag[4622,14,5078,0,5338,0]Ag[4622,14,5078,0,4641,0]Ai[4622,14,244,3049,4035,0]Ag[4622,14,5103,0,4637,0]Ag[4622,14,5103,0,4643,0]Ag[4622,14,5103,0,5365,0]Ag[4622,14,5103,0,5166,0]Ag[4622,14,5103,0,5339,0]Ag[4622,14,5103,0,5398,0]Ag[4622,14,5103,0,5435,0]Ag[4622,14,5103,0,5369,0]Ag[4622,14,5104,0,4638,0]Ag[4622,14,5104,0,4644,0]Ag[4622,14,5104,0,5366,0]Ag[4622,14,5104,0,5167,0]Ag[4622,14,5104,0,5340,0]Ag[4622,14,5104,0,5399,0]Ag[4622,14,5104,0,5436,0]Ag[4622,14,5104,0,5370,0]Ai[4622,15,239,4546,3329,0]Ai[4622,15,244,3049,1945,0]Ai[4622,15,4532,234,3330,0]Aj[4622,15,4532,3050,1946,0]Aj[4622,15,4667,4667,4810,0]Aj[4622,15,4464,4818,4811,0]543210543210543210543214Ah[4622,15,244,3049,698,0]3Ai[4622,15,4532,3050,699,0]3Aj[4622,15,4667,4667,4661,0]3Aj[4622,15,4464,4818,4662,0]8362514083625140836251408362519379379379379379Aj[4622,17,4464,4818,4781,0]:0:0:0::8:8:8:8:851515151:948736251:948736251:948736251:948736251:9487362Af[4622,6,2098,4570,0,0]0000:876:876:876:876:87Ai[4622,15,239,4479,5164,0]Aj[4622,15,4532,4481,5165,0]10101010Ai[4622,15,244,3049,3313,0]Aj[4622,15,4532,3050,3314,0]10101010Ae[4622,8,244,3786,0,0]0000Ai[4622,15,239,4546,3329,0]?0?0?0?0?Ai[4622,15,244,3049,1945,0]<?;>:=90<?;>:=90<?;>:=90<?;>:=90<?;>:0<?;>:=90<?;>:=90<?;>:=90<?;>:=90<?;>:8Ae[4622,6,244,3049,0,0]Af[4622,6,4532,3050,0,0]Ac[4622,5,4667,0,0,0];210;210;210210Ai[4622,15,2098,4570,548,0]4Aj[4622,15,4532,3050,1946,0]Aj[4622,15,4667,4667,4810,0]Aj[4622,15,4464,4818,4811,0]3721037210372103721Aj[4622,13,4464,4464,3339,0]000Ah[4622,13,244,3049,698,0]Aj[4622,12,4464,4818,4781,0]1010101Ai[4622,13,239,4697,1847,0]Ai[4622,13,244,3049,1834,0]Ai[4622,13,4532,234,1848,0]Ah[4622,13,4699,4699,91,0]3210321032103210Ai[4622,14,239,4546,1916,0]Ag[4622,14,5162,0,5439,0]Ag[4622,14,5162,0,5461,0]Ai[4622,14,4532,234,1917,0]Ag[4622,14,5163,0,5440,0]Ag[4622,14,5163,0,5462,0]5Ag[4622,14,5091,0,4043,0]54321Aj[4622,14,4574,4574,5160,0]716543207165432071654320Ai[4622,14,244,3049,1707,0]Aj[4622,14,4532,3050,1708,0]10101010Ag[4622,14,5078,0,5102,0]Af[4622,14,5162,0,568,0]Ag[4622,14,5402,0,4807,0]Ag[4622,14,5103,0,5081,0]Ag[4622,14,5104,0,5083,0]Af[4622,14,5163,0,569,0]543210543210543210543210Ag[4622,14,5103,0,5457,0]Ag[4622,14,5104,0,5458,0]10101010Ag[4622,14,5103,0,5369,0]Ag[4622,14,5104,0,5370,0]10101010Cf[4664,13,4665,4665,4779,0,\"impl-Display-for-AllocErr\"]Cd[4664,13,4665,4665,4779,0,\"impl-Debug-for-AllocErr\"]Aj[4664,13,4665,4665,1689,0]Aj[4622,13,4464,4464,5161,0]Aj[4622,13,3371,3371,3195,0]Aj[4622,13,3371,3371,4084,0]Aj[4622,13,2098,3703,5077,0]Da[4622,13,2098,4478,5079,0,\"impl-Debug-for-ElabError%3C\'a,+\'b%3E\"]Dc[4622,13,2098,4478,5079,0,\"impl-Display-for-ElabError%3C\'_,+\'_%3E\"]Aj[4622,13,2098,4687,4628,0]Aj[4622,13,2098,4570,4092,0]Aj[4622,13,2098,4570,4042,0]Aj[4622,13,2098,4570,3320,0]Ai[4622,13,2098,4570,548,0]Aj[4622,13,2098,4702,4632,0]Cc[4622,13,239,4479,4802,0,\"impl-Debug-for-LexError\"]Ce[4622,13,239,4479,4802,0,\"impl-Display-for-LexError\"]Ce[4622,13,239,4479,5164,0,\"impl-Debug-for-ParseError\"]Cg[4622,13,239,4479,5164,0,\"impl-Display-for-ParseError\"]Ch[4622,13,239,4479,5403,0,\"impl-Debug-for-SnapshotError\"]Cj[4622,13,239,4479,5403,0,\"impl-Display-for-SnapshotError\"]Ai[4622,13,239,4546,3329,0]Ai[4622,13,239,4546,1916,0]Ai[4622,13,239,4546,3279,0]Ai[4622,13,239,4697,1847,0]Db[4622,13,244,4480,5087,0,\"impl-Display-for-EvalError%3C\'_,+\'_%3E\"]D`[4622,13,244,4480,5087,0,\"impl-Debug-for-EvalError%3C\'a,+\'b%3E\"]Co[4622,13,244,4480,4078,0,\"impl-Display-for-Quoted%3C\'_,+\'_%3E\"]Cm[4622,13,244,4480,4078,0,\"impl-Debug-for-Quoted%3C\'a,+\'b%3E\"]Dc[4622,13,244,4480,5106,0,\"impl-Debug-for-TypeError%3C\'a,+\'b,+T%3E\"]De[4622,13,244,4480,5106,0,\"impl-Display-for-TypeError%3C\'_,+\'_,+T%3E\"]Ai[4622,13,244,3786,3269,0]Ai[4622,13,244,4689,4629,0]Cg[4622,13,244,3049,1834,0,\"impl-Debug-for-Name%3C\'a%3E\"]Ci[4622,13,244,3049,1834,0,\"impl-Display-for-Name%3C\'_%3E\"]Ai[4622,13,244,3049,3211,0]Ai[4622,13,244,3049,3258,0]Ai[4622,13,244,3049,1732,0]Ai[4622,13,244,3049,3289,0]D`[4622,13,244,3049,1945,0,\"impl-Display-for-Term%3C\'_,+\'_,+T%3E\"]Cn[4622,13,244,3049,1945,0,\"impl-Debug-for-Term%3C\'a,+\'b,+T%3E\"]Ai[4622,13,244,3049,4035,0]Ah[4622,13,244,3049,698,0]Ai[4622,13,244,3049,1707,0]Ai[4622,13,244,3049,3313,0]Aj[4622,13,4532,3366,3196,0]Cm[4622,13,4532,4481,5088,0,\"impl-Debug-for-EvalError%3C\'a%3E\"]Co[4622,13,4532,4481,5088,0,\"impl-Display-for-EvalError%3C\'_%3E\"]Cj[4622,13,4532,4481,4079,0,\"impl-Debug-for-Quoted%3C\'a%3E\"]Cl[4622,13,4532,4481,4079,0,\"impl-Display-for-Quoted%3C\'_%3E\"]Co[4622,13,4532,4481,5107,0,\"impl-Display-for-TypeError%3C\'_%3E\"]Cm[4622,13,4532,4481,5107,0,\"impl-Debug-for-TypeError%3C\'a%3E\"]Cf[4622,13,4532,4481,4803,0,\"impl-Display-for-LexError\"]Cd[4622,13,4532,4481,4803,0,\"impl-Debug-for-LexError\"]Ch[4622,13,4532,4481,5165,0,\"impl-Display-for-ParseError\"]Cf[4622,13,4532,4481,5165,0,\"impl-Debug-for-ParseError\"]Ai[4622,13,4532,234,3330,0]Ai[4622,13,4532,234,1917,0]Ai[4622,13,4532,234,4624,0]Ai[4622,13,4532,234,1848,0]Ch[4622,13,4532,3050,1946,0,\"impl-Debug-for-Term%3C\'a%3E\"]Cj[4622,13,4532,3050,1946,0,\"impl-Display-for-Term%3C\'_%3E\"]Ai[4622,13,4532,3050,699,0]Aj[4622,13,4532,3050,1708,0]Aj[4622,13,4532,3050,3314,0]Aj[4622,13,4667,4667,1947,0]Ai[4622,13,4667,4667,700,0]Aj[4622,13,4667,4667,1709,0]Aj[4622,13,4667,4667,3315,0]Aj[4622,13,4667,4667,1814,0]Aj[4622,13,4667,4667,4810,0]Aj[4622,13,4667,4667,4661,0]Aj[4622,13,4667,4667,1819,0]Cg[4622,13,4667,4667,5089,0,\"impl-Display-for-EvalError\"]Ce[4622,13,4667,4667,5089,0,\"impl-Debug-for-EvalError\"]Aj[4622,13,4667,4667,3197,0]Ah[4622,13,4699,4699,91,0]Aj[4622,13,4699,4699,4631,0]Aj[4622,13,4464,4464,5161,0]Aj[4622,13,4464,4464,3339,0]Aj[4622,13,4464,4464,3293,0]Aj[4622,13,3371,3371,3195,0]Aj[4622,13,3371,3371,4084,0]Aj[4622,13,2098,3703,5077,0]Da[4622,13,2098,4478,5079,0,\"impl-Debug-for-ElabError%3C\'a,+\'b%3E\"]Dc[4622,13,2098,4478,5079,0,\"impl-Display-for-ElabError%3C\'_,+\'_%3E\"]Aj[4622,13,2098,4687,4628,0]Aj[4622,13,2098,4570,4092,0]Aj[4622,13,2098,4570,4042,0]Aj[4622,13,2098,4570,3320,0]Ai[4622,13,2098,4570,548,0]Aj[4622,13,2098,4702,4632,0]Cc[4622,13,239,4479,4802,0,\"impl-Debug-for-LexError\"]Ce[4622,13,239,4479,4802,0,\"impl-Display-for-LexError\"]Ce[4622,13,239,4479,5164,0,\"impl-Debug-for-ParseError\"]Cg[4622,13,239,4479,5164,0,\"impl-Display-for-ParseError\"]Cf[4622,13,239,4479,5092,0,\"impl-Display-for-JsonError\"]Cd[4622,13,239,4479,5092,0,\"impl-Debug-for-JsonError\"]Cj[4622,13,239,4479,5403,0,\"impl-Display-for-SnapshotError\"]Ch[4622,13,239,4479,5403,0,\"impl-Debug-for-SnapshotError\"]Bo[4622,13,239,2908,1799,0,\"impl-Debug-for-Json\"]Ca[4622,13,239,2908,1799,0,\"impl-Display-for-Json\"]Ai[4622,13,239,4546,3329,0]Ai[4622,13,239,4546,1916,0]Ai[4622,13,239,4546,3279,0]Ai[4622,13,239,4697,1847,0]D`[4622,13,244,4480,5087,0,\"impl-Debug-for-EvalError%3C\'a,+\'b%3E\"]Db[4622,13,244,4480,5087,0,\"impl-Display-for-EvalError%3C\'_,+\'_%3E\"]Co[4622,13,244,4480,4078,0,\"impl-Display-for-Quoted%3C\'_,+\'_%3E\"]Cm[4622,13,244,4480,4078,0,\"impl-Debug-for-Quoted%3C\'a,+\'b%3E\"]De[4622,13,244,4480,5106,0,\"impl-Display-for-TypeError%3C\'_,+\'_,+T%3E\"]Dc[4622,13,244,4480,5106,0,\"impl-Debug-for-TypeError%3C\'a,+\'b,+T%3E\"]Ai[4622,13,244,3786,3269,0]Ai[4622,13,244,4689,4629,0]Ci[4622,13,244,3049,1834,0,\"impl-Display-for-Name%3C\'_%3E\"]Cg[4622,13,244,3049,1834,0,\"impl-Debug-for-Name%3C\'a%3E\"]Ai[4622,13,244,3049,3211,0]Ai[4622,13,244,3049,3258,0]Ai[4622,13,244,3049,1732,0]Ai[4622,13,244,3049,3289,0]D`[4622,13,244,3049,1945,0,\"impl-Display-for-Term%3C\'_,+\'_,+T%3E\"]Cn[4622,13,244,3049,1945,0,\"impl-Debug-for-Term%3C\'a,+\'b,+T%3E\"]Ai[4622,13,244,3049,4035,0]Ah[4622,13,244,3049,698,0]Ai[4622,13,244,3049,1707,0]Ai[4622,13,244,3049,3313,0]Aj[4622,13,4532,3366,3196,0]Co[4622,13,4532,4481,5088,0,\"impl-Display-for-EvalError%3C\'_%3E\"]Cm[4622,13,4532,4481,5088,0,\"impl-Debug-for-EvalError%3C\'a%3E\"]Cl[4622,13,4532,4481,4079,0,\"impl-Display-for-Quoted%3C\'_%3E\"]Cj[4622,13,4532,4481,4079,0,\"impl-Debug-for-Quoted%3C\'a%3E\"]Cm[4622,13,4532,4481,5107,0,\"impl-Debug-for-TypeError%3C\'a%3E\"]Co[4622,13,4532,4481,5107,0,\"impl-Display-for-TypeError%3C\'_%3E\"]Cd[4622,13,4532,4481,4803,0,\"impl-Debug-for-LexError\"]Cf[4622,13,4532,4481,4803,0,\"impl-Display-for-LexError\"]Cf[4622,13,4532,4481,5165,0,\"impl-Debug-for-ParseError\"]Ch[4622,13,4532,4481,5165,0,\"impl-Display-for-ParseError\"]Ai[4622,13,4532,234,3330,0]Ai[4622,13,4532,234,1917,0]Ai[4622,13,4532,234,4624,0]Ai[4622,13,4532,234,1848,0]Ch[4622,13,4532,3050,1946,0,\"impl-Debug-for-Term%3C\'a%3E\"]Cj[4622,13,4532,3050,1946,0,\"impl-Display-for-Term%3C\'_%3E\"]Ai[4622,13,4532,3050,699,0]Aj[4622,13,4532,3050,1708,0]Aj[4622,13,4532,3050,3314,0]Aj[4622,13,4667,4667,1947,0]Ai[4622,13,4667,4667,700,0]Aj[4622,13,4667,4667,1709,0]Aj[4622,13,4667,4667,3315,0]Aj[4622,13,4667,4667,1814,0]Aj[4622,13,4667,4667,4810,0]Aj[4622,13,4667,4667,4661,0]Aj[4622,13,4667,4667,1819,0]Ce[4622,13,4667,4667,5089,0,\"impl-Debug-for-EvalError\"]Cg[4622,13,4667,4667,5089,0,\"impl-Display-for-EvalError\"]Aj[4622,13,4667,4667,3197,0]Ah[4622,13,4699,4699,91,0]Aj[4622,13,4699,4699,4631,0]Aj[4622,13,4574,4574,4786,0]Aj[4622,13,4574,4574,5160,0]Aj[4622,13,4574,4574,4097,0]Aj[4622,13,4464,4464,5161,0]Aj[4622,13,4464,4464,3339,0]Aj[4622,13,4464,4464,3293,0]Aj[4622,13,3371,3371,3195,0]Aj[4622,13,3371,3371,4084,0]Aj[4622,13,2098,3703,5077,0]Da[4622,13,2098,4478,5079,0,\"impl-Debug-for-ElabError%3C\'a,+\'b%3E\"]Dc[4622,13,2098,4478,5079,0,\"impl-Display-for-ElabError%3C\'_,+\'_%3E\"]Aj[4622,13,2098,4687,4628,0]Aj[4622,13,2098,4570,4092,0]Aj[4622,13,2098,4570,4042,0]Aj[4622,13,2098,4570,3320,0]Ai[4622,13,2098,4570,548,0]Aj[4622,13,2098,4702,4632,0]Cc[4622,13,239,4479,4802,0,\"impl-Debug-for-LexError\"]Ce[4622,13,239,4479,4802,0,\"impl-Display-for-LexError\"]Cg[4622,13,239,4479,5164,0,\"impl-Display-for-ParseError\"]Ce[4622,13,239,4479,5164,0,\"impl-Debug-for-ParseError\"]Cf[4622,13,239,4479,5092,0,\"impl-Display-for-JsonError\"]Cd[4622,13,239,4479,5092,0,\"impl-Debug-for-JsonError\"]Cj[4622,13,239,4479,5403,0,\"impl-Display-for-SnapshotError\"]Ch[4622,13,239,4479,5403,0,\"impl-Debug-for-SnapshotError\"]Bo[4622,13,239,2908,1799,0,\"impl-Debug-for-Json\"]Ca[4622,13,239,2908,1799,0,\"impl-Display-for-Json\"]Ai[4622,13,239,4546,3329,0]Ai[4622,13,239,4546,1916,0]Ai[4622,13,239,4546,3279,0]Ai[4622,13,239,4697,1847,0]D`[4622,13,244,4480,5087,0,\"impl-Debug-for-EvalError%3C\'a,+\'b%3E\"]Db[4622,13,244,4480,5087,0,\"impl-Display-for-EvalError%3C\'_,+\'_%3E\"]Co[4622,13,244,4480,4078,0,\"impl-Display-for-Quoted%3C\'_,+\'_%3E\"]Cm[4622,13,244,4480,4078,0,\"impl-Debug-for-Quoted%3C\'a,+\'b%3E\"]De[4622,13,244,4480,5106,0,\"impl-Display-for-TypeError%3C\'_,+\'_,+T%3E\"]Dc[4622,13,244,4480,5106,0,\"impl-Debug-for-TypeError%3C\'a,+\'b,+T%3E\"]Ai[4622,13,244,3786,3269,0]Ai[4622,13,244,4689,4629,0]Cg[4622,13,244,3049,1834,0,\"impl-Debug-for-Name%3C\'a%3E\"]Ci[4622,13,244,3049,1834,0,\"impl-Display-for-Name%3C\'_%3E\"]Ai[4622,13,244,3049,3211,0]Ai[4622,13,244,3049,3258,0]Ai[4622,13,244,3049,1732,0]Ai[4622,13,244,3049,3289,0]D`[4622,13,244,3049,1945,0,\"impl-Display-for-Term%3C\'_,+\'_,+T%3E\"]Cn[4622,13,244,3049,1945,0,\"impl-Debug-for-Term%3C\'a,+\'b,+T%3E\"]Ai[4622,13,244,3049,4035,0]Ah[4622,13,244,3049,698,0]Ai[4622,13,244,3049,1707,0]Ai[4622,13,244,3049,3313,0]Aj[4622,13,4532,3366,3196,0]Cm[4622,13,4532,4481,5088,0,\"impl-Debug-for-EvalError%3C\'a%3E\"]Co[4622,13,4532,4481,5088,0,\"impl-Display-for-EvalError%3C\'_%3E\"]Cj[4622,13,4532,4481,4079,0,\"impl-Debug-for-Quoted%3C\'a%3E\"]Cl[4622,13,4532,4481,4079,0,\"impl-Display-for-Quoted%3C\'_%3E\"]Cm[4622,13,4532,4481,5107,0,\"impl-Debug-for-TypeError%3C\'a%3E\"]Co[4622,13,4532,4481,5107,0,\"impl-Display-for-TypeError%3C\'_%3E\"]Cd[4622,13,4532,4481,4803,0,\"impl-Debug-for-LexError\"]Cf[4622,13,4532,4481,4803,0,\"impl-Display-for-LexError\"]Cf[4622,13,4532,4481,5165,0,\"impl-Debug-for-ParseError\"]Ch[4622,13,4532,4481,5165,0,\"impl-Display-for-ParseError\"]Ai[4622,13,4532,234,3330,0]Ai[4622,13,4532,234,1917,0]Ai[4622,13,4532,234,4624,0]Ai[4622,13,4532,234,1848,0]Ch[4622,13,4532,3050,1946,0,\"impl-Debug-for-Term%3C\'a%3E\"]Cj[4622,13,4532,3050,1946,0,\"impl-Display-for-Term%3C\'_%3E\"]Ai[4622,13,4532,3050,699,0]Aj[4622,13,4532,3050,1708,0]Aj[4622,13,4532,3050,3314,0]Aj[4622,13,4667,4667,1947,0]Ai[4622,13,4667,4667,700,0]Aj[4622,13,4667,4667,1709,0]Aj[4622,13,4667,4667,3315,0]Aj[4622,13,4667,4667,1814,0]Aj[4622,13,4667,4667,4810,0]Aj[4622,13,4667,4667,4661,0]Aj[4622,13,4667,4667,1819,0]Ce[4622,13,4667,4667,5089,0,\"impl-Debug-for-EvalError\"]Cg[4622,13,4667,4667,5089,0,\"impl-Display-for-EvalError\"]Aj[4622,13,4667,4667,3197,0]Ah[4622,13,4699,4699,91,0]Aj[4622,13,4699,4699,4631,0]Aj[4622,13,4574,4574,4786,0]Aj[4622,13,4574,4574,5160,0]Aj[4622,13,4574,4574,4097,0]Aj[4622,13,4464,4464,5161,0]Aj[4622,13,4464,4464,3339,0]Aj[4622,13,4464,4464,3293,0]Aj[4622,13,3371,3371,3195,0]Aj[4622,13,3371,3371,4084,0]Aj[4622,13,2098,3703,5077,0]Da[4622,13,2098,4478,5079,0,\"impl-Debug-for-ElabError%3C\'a,+\'b%3E\"]Dc[4622,13,2098,4478,5079,0,\"impl-Display-for-ElabError%3C\'_,+\'_%3E\"]Aj[4622,13,2098,4687,4628,0]Aj[4622,13,2098,4570,4092,0]Aj[4622,13,2098,4570,4042,0]Aj[4622,13,2098,4570,3320,0]Ai[4622,13,2098,4570,548,0]Aj[4622,13,2098,4702,4632,0]Cc[4622,13,239,4479,4802,0,\"impl-Debug-for-LexError\"]Ce[4622,13,239,4479,4802,0,\"impl-Display-for-LexError\"]Cg[4622,13,239,4479,5164,0,\"impl-Display-for-ParseError\"]Ce[4622,13,239,4479,5164,0,\"impl-Debug-for-ParseError\"]Cf[4622,13,239,4479,5092,0,\"impl-Display-for-JsonError\"]Cd[4622,13,239,4479,5092,0,\"impl-Debug-for-JsonError\"]Cj[4622,13,239,4479,5403,0,\"impl-Display-for-SnapshotError\"]Ch[4622,13,239,4479,5403,0,\"impl-Debug-for-SnapshotError\"]Bo[4622,13,239,2908,1799,0,\"impl-Debug-for-Json\"]Ca[4622,13,239,2908,1799,0,\"impl-Display-for-Json\"]Ai[4622,13,239,4546,3329,0]Ai[4622,13,239,4546,1916,0]Ai[4622,13,239,4546,3279,0]Ai[4622,13,239,4697,1847,0]D`[4622,13,244,4480,5087,0,\"impl-Debug-for-EvalError%3C\'a,+\'b%3E\"]Db[4622,13,244,4480,5087,0,\"impl-Display-for-EvalError%3C\'_,+\'_%3E\"]Co[4622,13,244,4480,4078,0,\"impl-Display-for-Quoted%3C\'_,+\'_%3E\"]Cm[4622,13,244,4480,4078,0,\"impl-Debug-for-Quoted%3C\'a,+\'b%3E\"]De[4622,13,244,4480,5106,0,\"impl-Display-for-TypeError%3C\'_,+\'_,+T%3E\"]Dc[4622,13,244,4480,5106,0,\"impl-Debug-for-TypeError%3C\'a,+\'b,+T%3E\"]Ai[4622,13,244,3786,3269,0]Ai[4622,13,244,4689,4629,0]Cg[4622,13,244,3049,1834,0,\"impl-Debug-for-Name%3C\'a%3E\"]Ci[4622,13,244,3049,1834,0,\"impl-Display-for-Name%3C\'_%3E\"]Ai[4622,13,244,3049,3211,0]Ai[4622,13,244,3049,3258,0]Ai[4622,13,244,3049,1732,0]Ai[4622,13,244,3049,3289,0]D`[4622,13,244,3049,1945,0,\"impl-Display-for-Term%3C\'_,+\'_,+T%3E\"]Cn[4622,13,244,3049,1945,0,\"impl-Debug-for-Term%3C\'a,+\'b,+T%3E\"]Ai[4622,13,244,3049,4035,0]Ah[4622,13,244,3049,698,0]Ai[4622,13,244,3049,1707,0]Ai[4622,13,244,3049,3313,0]Aj[4622,13,4532,3366,3196,0]Cm[4622,13,4532,4481,5088,0,\"impl-Debug-for-EvalError%3C\'a%3E\"]Co[4622,13,4532,4481,5088,0,\"impl-Display-for-EvalError%3C\'_%3E\"]Cj[4622,13,4532,4481,4079,0,\"impl-Debug-for-Quoted%3C\'a%3E\"]Cl[4622,13,4532,4481,4079,0,\"impl-Display-for-Quoted%3C\'_%3E\"]Cm[4622,13,4532,4481,5107,0,\"impl-Debug-for-TypeError%3C\'a%3E\"]Co[4622,13,4532,4481,5107,0,\"impl-Display-for-TypeError%3C\'_%3E\"]Cd[4622,13,4532,4481,4803,0,\"impl-Debug-for-LexError\"]Cf[4622,13,4532,4481,4803,0,\"impl-Display-for-LexError\"]Cf[4622,13,4532,4481,5165,0,\"impl-Debug-for-ParseError\"]Ch[4622,13,4532,4481,5165,0,\"impl-Display-for-ParseError\"]Ai[4622,13,4532,234,3330,0]Ai[4622,13,4532,234,1917,0]Ai[4622,13,4532,234,4624,0]Ai[4622,13,4532,234,1848,0]Ch[4622,13,4532,3050,1946,0,\"impl-Debug-for-Term%3C\'a%3E\"]Cj[4622,13,4532,3050,1946,0,\"impl-Display-for-Term%3C\'_%3E\"]Ai[4622,13,4532,3050,699,0]Aj[4622,13,4532,3050,1708,0]Aj[4622,13,4532,3050,3314,0]Aj[4622,13,4667,4667,1947,0]Ai[4622,13,4667,4667,700,0]Aj[4622,13,4667,4667,1709,0]Aj[4622,13,4667,4667,3315,0]Aj[4622,13,4667,4667,1814,0]Aj[4622,13,4667,4667,4810,0]Aj[4622,13,4667,4667,4661,0]Aj[4622,13,4667,4667,1819,0]Ce[4622,13,4667,4667,5089,0,\"impl-Debug-for-EvalError\"]Cg[4622,13,4667,4667,5089,0,\"impl-Display-for-EvalError\"]Aj[4622,13,4667,4667,3197,0]Ah[4622,13,4699,4699,91,0]Aj[4622,13,4699,4699,4631,0]Aj[4622,13,4574,4574,4786,0]Aj[4622,13,4574,4574,5160,0]Aj[4622,13,4574,4574,4097,0]Aj[4622,13,4464,4464,5161,0]Aj[4622,13,4464,4464,3339,0]Aj[4622,13,4464,4464,3293,0]Aj[4622,13,3371,3371,3195,0]Aj[4622,13,3371,3371,4084,0]Aj[4622,13,2098,3703,5077,0]Dc[4622,13,2098,4478,5079,0,\"impl-Display-for-ElabError%3C\'_,+\'_%3E\"]Da[4622,13,2098,4478,5079,0,\"impl-Debug-for-ElabError%3C\'a,+\'b%3E\"]Aj[4622,13,2098,4687,4628,0]Aj[4622,13,2098,4570,4092,0]Aj[4622,13,2098,4570,4042,0]Aj[4622,13,2098,4570,3320,0]Ai[4622,13,2098,4570,548,0]Aj[4622,13,2098,4702,4632,0]Cc[4622,13,239,4479,4802,0,\"impl-Debug-for-LexError\"]Ce[4622,13,239,4479,4802,0,\"impl-Display-for-LexError\"]Cg[4622,13,239,4479,5164,0,\"impl-Display-for-ParseError\"]Ce[4622,13,239,4479,5164,0,\"impl-Debug-for-ParseError\"]Cf[4622,13,239,4479,5092,0,\"impl-Display-for-JsonError\"]Cd[4622,13,239,4479,5092,0,\"impl-Debug-for-JsonError\"]Cj[4622,13,239,4479,5403,0,\"impl-Display-for-SnapshotError\"]Ch[4622,13,239,4479,5403,0,\"impl-Debug-for-SnapshotError\"]Ca[4622,13,239,2908,1799,0,\"impl-Display-for-Json\"]Bo[4622,13,239,2908,1799,0,\"impl-Debug-for-Json\"]Ai[4622,13,239,4546,3329,0]Ai[4622,13,239,4546,1916,0]Ai[4622,13,239,4546,3279,0]Ai[4622,13,239,4697,1847,0]D`[4622,13,244,4480,5087,0,\"impl-Debug-for-EvalError%3C\'a,+\'b%3E\"]Db[4622,13,244,4480,5087,0,\"impl-Display-for-EvalError%3C\'_,+\'_%3E\"]Cm[4622,13,244,4480,4078,0,\"impl-Debug-for-Quoted%3C\'a,+\'b%3E\"]Co[4622,13,244,4480,4078,0,\"impl-Display-for-Quoted%3C\'_,+\'_%3E\"]De[4622,13,244,4480,5106,0,\"impl-Display-for-TypeError%3C\'_,+\'_,+T%3E\"]Dc[4622,13,244,4480,5106,0,\"impl-Debug-for-TypeError%3C\'a,+\'b,+T%3E\"]Ai[4622,13,244,3786,3269,0]Ai[4622,13,244,4689,4629,0]Ci[4622,13,244,3049,1834,0,\"impl-Display-for-Name%3C\'_%3E\"]Cg[4622,13,244,3049,1834,0,\"impl-Debug-for-Name%3C\'a%3E\"]Ai[4622,13,244,3049,3211,0]Ai[4622,13,244,3049,3258,0]Ai[4622,13,244,3049,1732,0]Ai[4622,13,244,3049,3289,0]D`[4622,13,244,3049,1945,0,\"impl-Display-for-Term%3C\'_,+\'_,+T%3E\"]Cn[4622,13,244,3049,1945,0,\"impl-Debug-for-Term%3C\'a,+\'b,+T%3E\"]Ai[4622,13,244,3049,4035,0]Ah[4622,13,244,3049,698,0]Ai[4622,13,244,3049,1707,0]Ai[4622,13,244,3049,3313,0]Aj[4622,13,4532,3366,3196,0]Co[4622,13,4532,4481,5088,0,\"impl-Display-for-EvalError%3C\'_%3E\"]Cm[4622,13,4532,4481,5088,0,\"impl-Debug-for-EvalError%3C\'a%3E\"]Cj[4622,13,4532,4481,4079,0,\"impl-Debug-for-Quoted%3C\'a%3E\"]Cl[4622,13,4532,4481,4079,0,\"impl-Display-for-Quoted%3C\'_%3E\"]Cm[4622,13,4532,4481,5107,0,\"impl-Debug-for-TypeError%3C\'a%3E\"]Co[4622,13,4532,4481,5107,0,\"impl-Display-for-TypeError%3C\'_%3E\"]Cd[4622,13,4532,4481,4803,0,\"impl-Debug-for-LexError\"]Cf[4622,13,4532,4481,4803,0,\"impl-Display-for-LexError\"]Cf[4622,13,4532,4481,5165,0,\"impl-Debug-for-ParseError\"]Ch[4622,13,4532,4481,5165,0,\"impl-Display-for-ParseError\"]Ai[4622,13,4532,234,3330,0]Ai[4622,13,4532,234,1917,0]Ai[4622,13,4532,234,4624,0]Ai[4622,13,4532,234,1848,0]Ch[4622,13,4532,3050,1946,0,\"impl-Debug-for-Term%3C\'a%3E\"]Cj[4622,13,4532,3050,1946,0,\"impl-Display-for-Term%3C\'_%3E\"]Ai[4622,13,4532,3050,699,0]Aj[4622,13,4532,3050,1708,0]Aj[4622,13,4532,3050,3314,0]Aj[4622,13,4667,4667,1947,0]Ai[4622,13,4667,4667,700,0]Aj[4622,13,4667,4667,1709,0]Aj[4622,13,4667,4667,3315,0]Aj[4622,13,4667,4667,1814,0]Aj[4622,13,4667,4667,4810,0]Aj[4622,13,4667,4667,4661,0]Aj[4622,13,4667,4667,1819,0]Cg[4622,13,4667,4667,5089,0,\"impl-Display-for-EvalError\"]Ce[4622,13,4667,4667,5089,0,\"impl-Debug-for-EvalError\"]Aj[4622,13,4667,4667,3197,0]Ah[4622,13,4699,4699,91,0]Aj[4622,13,4699,4699,4631,0]Aj[4622,13,4574,4574,4786,0]Aj[4622,13,4574,4574,5160,0]Aj[4622,13,4574,4574,4097,0]Ag[4622,14,5103,0,4633,0]Ag[4622,14,5104,0,4634,0]10101010Aj[4622,13,2098,3703,5077,0]Aj[4622,13,2098,4687,4628,0]Ai[4622,13,244,3786,3269,0]Ai[4622,13,244,3049,3313,0]Aj[4622,13,4532,3050,3314,0]Aj[4622,13,4667,4667,3315,0]Aj[4622,12,4464,4818,4781,0]Aj[4622,13,4464,4464,3293,0]76Ai[4622,13,239,2908,1799,0]6543218706543218706543218706543875Ai[4622,14,244,4480,4078,0]Ag[4622,14,3295,0,1710,0]Ag[4622,14,5080,0,4787,0]Ag[4622,14,5080,0,4793,0]Ag[4622,14,5103,0,4782,0]9Aj[4622,14,4532,4481,4079,0]Ag[4622,14,3296,0,1711,0]Ag[4622,14,5082,0,4788,0]Ag[4622,14,5082,0,4794,0]Ag[4622,14,5104,0,4783,0]=Ag[4622,14,5084,0,4789,0]Ag[4622,14,5084,0,4795,0]Ag[4622,14,5084,0,4651,0]Ag[4622,14,5084,0,4657,0]Aj[4622,12,4464,4818,4781,0]Aj[4622,13,4464,4464,3293,0]Aj[4622,13,2098,3703,5077,0]Aj[4622,13,2098,4687,4628,0]Ai[4622,13,244,3049,3313,0]Ai[4622,14,244,4480,4078,0]Ag[4622,14,3295,0,1710,0]Ag[4622,14,5080,0,4787,0]Ag[4622,14,5080,0,4793,0]Ag[4622,14,5103,0,4782,0]Aj[4622,13,4532,3050,3314,0]Aj[4622,14,4532,4481,4079,0]Ag[4622,14,3296,0,1711,0]Ag[4622,14,5082,0,4788,0]Ag[4622,14,5082,0,4794,0]Ag[4622,14,5104,0,4783,0]Aj[4622,13,4667,4667,3315,0]Ag[4622,14,5084,0,4789,0]Ag[4622,14,5084,0,4795,0]Ag[4622,14,5084,0,4651,0]Ag[4622,14,5084,0,4657,0]Aj[4622,12,4464,4818,4781,0]Aj[4622,13,4464,4464,3293,0]Aj[4622,13,2098,3703,5077,0]Aj[4622,13,2098,4687,4628,0]Ai[4622,13,244,3049,3313,0]Ai[4622,14,244,4480,4078,0]Ag[4622,14,3295,0,1710,0]Ag[4622,14,5080,0,4787,0]Ag[4622,14,5080,0,4793,0]Ag[4622,14,5103,0,4782,0]Aj[4622,13,4532,3050,3314,0]Aj[4622,14,4532,4481,4079,0]Ag[4622,14,3296,0,1711,0]Ag[4622,14,5082,0,4788,0]Ag[4622,14,5082,0,4794,0]Ag[4622,14,5104,0,4783,0]Aj[4622,13,4667,4667,3315,0]Ag[4622,14,5084,0,4789,0]Ag[4622,14,5084,0,4795,0]Ag[4622,14,5084,0,4651,0]Ag[4622,14,5084,0,4657,0]Aj[4622,12,4464,4818,4781,0]Aj[4622,13,4464,4464,3293,0]Aj[4622,13,2098,3703,5077,0]Aj[4622,13,2098,4687,4628,0]Ai[4622,13,244,3049,3313,0]Ai[4622,14,244,4480,4078,0]Ag[4622,14,3295,0,1710,0]Ag[4622,14,5080,0,4787,0]Ag[4622,14,5080,0,4793,0]Ag[4622,14,5103,0,4782,0]Aj[4622,13,4532,3050,3314,0]Aj[4622,14,4532,4481,4079,0]Ag[4622,14,3296,0,1711,0]Ag[4622,14,5082,0,4788,0]Ag[4622,14,5082,0,4794,0]Ag[4622,14,5104,0,4783,0]Aj[4622,13,4667,4667,3315,0]Ag[4622,14,5084,0,4789,0]Ag[4622,14,5084,0,4795,0]Ag[4622,14,5084,0,4651,0]Ag[4622,14,5084,0,4657,0]Aj[4622,12,4464,4818,4781,0]Aj[4622,13,4464,4464,3293,0]Aj[4622,13,2098,3703,5077,0]Aj[4622,13,2098,4687,4628,0]Ai[4622,13,244,3049,3313,0]Ai[4622,14,244,4480,4078,0]Ag[4622,14,3295,0,1710,0]Ag[4622,14,5080,0,4787,0]Ag[4622,14,5080,0,4793,0]Ag[4622,14,5103,0,4782,0]Aj[4622,13,4532,3050,3314,0]Aj[4622,14,4532,4481,4079,0]Ag[4622,14,3296,0,1711,0]Ag[4622,14,5082,0,4788,0]Ag[4622,14,5082,0,4794,0]Ag[4622,14,5104,0,4783,0]Aj[4622,13,4667,4667,3315,0]Ag[4622,14,5084,0,4789,0]Ag[4622,14,5084,0,4795,0]Ag[4622,14,5084,0,4651,0]Ag[4622,14,5084,0,4657,0]Ai[4622,13,239,4546,1916,0]Ai[4622,13,4532,234,1917,0]10101010>84>84>84>84>84Aj[4664,13,4665,4665,1689,0]Aj[4622,13,3371,3371,3195,0]Aj[4622,13,2098,3703,5077,0]Aj[4622,13,2098,4687,4628,0]Aj[4622,13,2098,4570,4092,0]Aj[4622,13,2098,4702,4632,0]Ai[4622,13,239,4546,3279,0]Ai[4622,13,244,4480,4078,0]Ai[4622,13,244,3786,3269,0]Ai[4622,13,244,4689,4629,0]Ai[4622,13,244,3049,3211,0]Ai[4622,13,244,3049,3258,0]Ai[4622,13,244,3049,3313,0]Aj[4622,13,4532,3366,3196,0]Aj[4622,13,4532,4481,4079,0]Aj[4622,13,4532,3050,3314,0]Aj[4622,13,4667,4667,3315,0]Aj[4622,13,4667,4667,3197,0]Aj[4622,13,4464,4464,3293,0]Aj[4622,13,3371,3371,3195,0]Aj[4622,13,2098,3703,5077,0]Aj[4622,13,2098,4687,4628,0]Aj[4622,13,2098,4570,4092,0]Aj[4622,13,2098,4702,4632,0]Ai[4622,13,239,4546,3279,0]Ai[4622,13,244,4480,4078,0]Ai[4622,13,244,3786,3269,0]Ai[4622,13,244,4689,4629,0]Ai[4622,13,244,3049,1834,0]Ai[4622,13,244,3049,3211,0]Ai[4622,13,244,3049,3258,0]Ai[4622,13,244,3049,3313,0]Aj[4622,13,4532,3366,3196,0]Aj[4622,13,4532,4481,4079,0]Aj[4622,13,4532,3050,3314,0]Aj[4622,13,4667,4667,3315,0]Aj[4622,13,4667,4667,3197,0]Aj[4622,13,4574,4574,4786,0]Aj[4622,13,4574,4574,4097,0]Aj[4622,13,4464,4464,3293,0]Aj[4622,13,3371,3371,3195,0]Aj[4622,13,2098,3703,5077,0]Aj[4622,13,2098,4687,4628,0]Aj[4622,13,2098,4570,4092,0]Aj[4622,13,2098,4702,4632,0]Ai[4622,13,239,4546,3279,0]Ai[4622,13,244,4480,4078,0]Ai[4622,13,244,3786,3269,0]Ai[4622,13,244,4689,4629,0]Ai[4622,13,244,3049,1834,0]Ai[4622,13,244,3049,3211,0]Ai[4622,13,244,3049,3258,0]Ai[4622,13,244,3049,3313,0]Aj[4622,13,4532,3366,3196,0]Aj[4622,13,4532,4481,4079,0]Aj[4622,13,4532,3050,3314,0]Aj[4622,13,4667,4667,3315,0]Aj[4622,13,4667,4667,3197,0]Aj[4622,13,4574,4574,4786,0]Aj[4622,13,4574,4574,4097,0]Aj[4622,13,4464,4464,3293,0]Aj[4622,13,3371,3371,3195,0]Aj[4622,13,2098,3703,5077,0]Aj[4622,13,2098,4687,4628,0]Aj[4622,13,2098,4570,4092,0]Aj[4622,13,2098,4702,4632,0]Ai[4622,13,239,4546,3279,0]Ai[4622,13,244,4480,4078,0]Ai[4622,13,244,3786,3269,0]Ai[4622,13,244,4689,4629,0]Ai[4622,13,244,3049,1834,0]Ai[4622,13,244,3049,3211,0]Ai[4622,13,244,3049,3258,0]Ai[4622,13,244,3049,3313,0]Aj[4622,13,4532,3366,3196,0]Aj[4622,13,4532,4481,4079,0]Aj[4622,13,4532,3050,3314,0]Aj[4622,13,4667,4667,3315,0]Aj[4622,13,4667,4667,3197,0]Aj[4622,13,4574,4574,4786,0]Aj[4622,13,4574,4574,4097,0]Aj[4622,13,4464,4464,3293,0]Aj[4622,13,3371,3371,3195,0]Aj[4622,13,2098,3703,5077,0]Aj[4622,13,2098,4687,4628,0]Aj[4622,13,2098,4570,4092,0]Aj[4622,13,2098,4702,4632,0]Ai[4622,13,239,4546,3279,0]Ai[4622,13,244,4480,4078,0]Ai[4622,13,244,3786,3269,0]Ai[4622,13,244,4689,4629,0]Ai[4622,13,244,3049,1834,0]Ai[4622,13,244,3049,3211,0]Ai[4622,13,244,3049,3258,0]Ai[4622,13,244,3049,3313,0]Aj[4622,13,4532,3366,3196,0]Aj[4622,13,4532,4481,4079,0]Aj[4622,13,4532,3050,3314,0]Aj[4622,13,4667,4667,3315,0]Aj[4622,13,4667,4667,3197,0]Aj[4622,13,4574,4574,4786,0]Aj[4622,13,4574,4574,4097,0]Ag[4622,14,4800,0,5444,0]Ag[4622,14,5402,0,5097,0]Ag[4622,14,4801,0,5445,0]Ag[4622,14,5091,0,5443,0]321032103210321Ag[4622,14,5103,0,4633,0]Ag[4622,14,5104,0,4634,0]10101010Ai[4622,14,239,4546,1916,0]Ag[4622,14,5162,0,5461,0]Ai[4622,14,4532,234,1917,0]Ag[4622,14,5163,0,5462,0]3210321032103210Aj[4622,13,3371,3371,3195,0]Ai[4622,14,244,4480,4078,0]Ai[4622,14,244,3049,4035,0]Ag[4622,14,5080,0,4649,0]Ag[4622,14,5080,0,4655,0]Aj[4622,13,4532,3366,3196,0]Aj[4622,14,4532,4481,4079,0]Ag[4622,14,5082,0,4650,0]Ag[4622,14,5082,0,4656,0]Aj[4622,13,4667,4667,3197,0]Aj[4622,12,4464,4818,4781,0]:9876543210:9876543210:9876543210:987654321Aj[4622,17,4464,4818,4781,0]000Ai[4622,15,239,4697,1847,0]Ai[4622,15,4532,234,1848,0]101010101010101010Ai[4622,15,239,2908,1799,0]000Ac[4664,5,4665,0,0,0]4Ae[4622,5,244,3049,0,0]Af[4622,5,4532,3050,0,0]Ac[4622,5,4667,0,0,0]721072107210210Ai[4622,15,244,3049,3313,0]Aj[4622,15,4532,3050,3314,0]10101010Ah[4622,15,4699,4699,91,0]00005555500000Ah[4622,15,244,3049,698,0]Ai[4622,15,4532,3050,699,0]Aj[4622,15,4667,4667,4661,0]Aj[4622,15,4464,4818,4662,0]321032103210321Ai[4622,15,244,3049,1945,0]4Aj[4622,15,4532,3050,1946,0]4Aj[4622,15,4667,4667,4810,0]4Aj[4622,15,4464,4818,4811,0]4372615043726150437261504372615Ae[4622,6,239,2908,0,0]000Ai[4622,15,239,4546,3329,0]Ai[4622,15,4532,234,3330,0]10101010>>>>>>>>>>6:6:6:6:6:Ae[4622,5,244,3049,0,0]0000Ai[4622,15,239,2908,1799,0]000Ae[4622,6,239,4697,0,0]Ae[4622,6,4532,234,0,0]101010105Ai[4622,15,239,4697,1847,0];?Ai[4622,15,4532,234,1848,0];?:>9=71<Ah[4622,15,244,3049,698,0]1<Ai[4622,15,4532,3050,699,0]<Aj[4622,15,4667,4667,4661,0]<Aj[4622,15,4464,4818,4662,0];5Ai[4622,15,244,3049,1945,0]45Aj[4622,15,4532,3050,1946,0]4Aj[4622,15,4667,4667,4810,0]4Aj[4622,15,4464,4818,4811,0]4?9378261504?93782615Af[4622,10,244,4480,0,0]Ag[4622,10,4532,4481,0,0]1010Ae[4622,5,239,4546,0,0]Ae[4622,5,4532,234,0,0]10101010=<Aj[4622,17,4464,4818,4781,0]>Ae[4622,6,244,3049,0,0]Af[4622,6,4532,3050,0,0]?Ac[4622,5,4667,0,0,0]3Ai[4622,15,239,4697,1847,0]32Ai[4622,15,4532,234,1848,0]2514302514302432Ai[4622,15,239,4546,3329,0]Ai[4622,15,4532,234,3330,0]101010101010101010?Ah[4622,15,244,3049,698,0]?Ai[4622,15,4532,3050,699,0]?Aj[4622,15,4667,4667,4661,0]?Aj[4622,15,4464,4818,4662,0]Ai[4622,15,244,3049,1945,0]4Aj[4622,15,4532,3050,1946,0]4Aj[4622,15,4667,4667,4810,0]4Aj[4622,15,4464,4818,4811,0]43726150437261504372615Aj[4622,12,4464,4818,4781,0]0000000Ai[4622,13,244,3049,3313,0]0000Ai[4622,14,244,3049,1707,0]Aj[4622,14,4532,3050,1708,0]10101010Aj[4622,13,3371,3371,3195,0]Aj[4622,13,4532,3366,3196,0]Aj[4622,13,4667,4667,3197,0]62106210621062105Aj[4622,13,4532,3050,3314,0]760760760760Ai[4622,13,244,4689,4629,0]Ah[4622,13,244,3049,698,0]Ai[4622,13,4532,3050,699,0]Ai[4622,13,4667,4667,700,0]Af[4622,7,4464,4818,0,0]4321043210432104321Aj[4664,13,4665,4665,1689,0]Aj[4622,13,3371,3371,4084,0]0000Ac[4622,2,4623,0,0,0]00007Ai[4622,13,244,3049,1945,0]Aj[4622,13,4532,3050,1946,0]Aj[4622,13,4667,4667,1947,0]6:2106:2106:2106:210Aj[4622,13,4699,4699,4631,0]0000Ac[4622,7,4464,0,0,0]0000Aj[4664,13,4665,4665,4779,0]8Aj[4622,13,4464,4464,5161,0]Aj[4622,13,3371,3371,3195,0]9Aj[4622,13,2098,3703,5077,0]Ek[4622,13,2098,4478,5079,0,\"impl-From%3CEvalError%3C\'a,+\'b%3E%3E-for-ElabError%3C\'a,+\'b%3E\"]Aj[4622,13,2098,4478,5079,0]Fb[4622,13,2098,4478,5079,0,\"impl-From%3CTypeError%3C\'a,+\'b,+Named%3E%3E-for-ElabError%3C\'a,+\'b%3E\"]Aj[4622,13,2098,4687,4628,0]Aj[4622,13,2098,4570,4092,0]Aj[4622,13,2098,4570,4042,0]Aj[4622,13,2098,4570,3320,0]Ai[4622,13,2098,4570,548,0]Aj[4622,13,2098,4702,4632,0]Ai[4622,13,239,4479,4802,0]Ai[4622,13,239,4479,5164,0]0Ai[4622,13,239,4479,5403,0]Ai[4622,13,239,4546,3329,0]Ai[4622,13,239,4546,1916,0]Ai[4622,13,239,4546,3279,0]Ai[4622,13,239,4697,1847,0]Ai[4622,13,244,4480,5087,0]Ai[4622,13,244,4480,4078,0]Ai[4622,13,244,4480,5106,0]0Ai[4622,13,244,3786,3269,0]Ai[4622,13,244,4689,4629,0]Ai[4622,13,244,3049,1834,0]Ai[4622,13,244,3049,3211,0]Ai[4622,13,244,3049,3258,0]Ai[4622,13,244,3049,1732,0]Ai[4622,13,244,3049,3289,0]Ai[4622,13,244,3049,1945,0]Ai[4622,13,244,3049,4035,0]Ah[4622,13,244,3049,698,0]Ai[4622,13,244,3049,1707,0]Ai[4622,13,244,3049,3313,0]Ag[4622,14,5103,0,4058,0]Aj[4622,13,4532,3366,3196,0]Aj[4622,13,4532,4481,5088,0]Aj[4622,13,4532,4481,4079,0]Aj[4622,13,4532,4481,5107,0]0Aj[4622,13,4532,4481,4803,0]Aj[4622,13,4532,4481,5165,0]0Ai[4622,13,4532,234,3330,0]Ai[4622,13,4532,234,1917,0]Ai[4622,13,4532,234,4624,0]Ai[4622,13,4532,234,1848,0]Aj[4622,13,4532,3050,1946,0]Ai[4622,13,4532,3050,699,0]Aj[4622,13,4532,3050,1708,0]Aj[4622,13,4532,3050,3314,0]Ag[4622,14,5104,0,4059,0]Aj[4622,13,4667,4667,1947,0]Ai[4622,13,4667,4667,700,0]Aj[4622,13,4667,4667,1709,0]Aj[4622,13,4667,4667,3315,0]Aj[4622,13,4667,4667,1814,0]Aj[4622,13,4667,4667,4810,0]Aj[4622,13,4667,4667,4661,0]Aj[4622,13,4667,4667,1819,0]Aj[4622,13,4667,4667,5089,0]Aj[4622,13,4667,4667,3197,0]Ah[4622,13,4699,4699,91,0]Aj[4622,13,4699,4699,4631,0]Aj[4622,13,4464,4818,4811,0]Aj[4622,13,4464,4818,4662,0]Aj[4622,13,4464,4464,5161,0]Aj[4622,13,4464,4464,3339,0]Aj[4622,13,4464,4464,3293,0]Aj[4622,13,3371,3371,3195,0]Aj[4622,13,3371,3371,4084,0]Aj[4622,13,2098,3703,5077,0]Aj[4622,13,2098,4478,5079,0]Ek[4622,13,2098,4478,5079,0,\"impl-From%3CEvalError%3C\'a,+\'b%3E%3E-for-ElabError%3C\'a,+\'b%3E\"]Fb[4622,13,2098,4478,5079,0,\"impl-From%3CTypeError%3C\'a,+\'b,+Named%3E%3E-for-ElabError%3C\'a,+\'b%3E\"]Aj[4622,13,2098,4687,4628,0]Aj[4622,13,2098,4570,4092,0]Aj[4622,13,2098,4570,4042,0]Aj[4622,13,2098,4570,3320,0]Ai[4622,13,2098,4570,548,0]Aj[4622,13,2098,4702,4632,0]Ai[4622,13,239,4479,4802,0]Ai[4622,13,239,4479,5164,0]0Ai[4622,13,239,4479,5092,0]Ai[4622,13,239,4479,5403,0]Ai[4622,13,239,2908,1799,0]Ai[4622,13,239,4546,3329,0]Ai[4622,13,239,4546,1916,0]Ai[4622,13,239,4546,3279,0]Ai[4622,13,239,4697,1847,0]Ai[4622,13,244,4480,5087,0]Ai[4622,13,244,4480,4078,0]Ai[4622,13,244,4480,5106,0]0Ai[4622,13,244,3786,3269,0]Ai[4622,13,244,4689,4629,0]Ai[4622,13,244,3049,1834,0]Ai[4622,13,244,3049,3211,0]Ai[4622,13,244,3049,3258,0]Ai[4622,13,244,3049,1732,0]Ai[4622,13,244,3049,3289,0]Ai[4622,13,244,3049,1945,0]Ai[4622,13,244,3049,4035,0]Ah[4622,13,244,3049,698,0]Ai[4622,13,244,3049,1707,0]Ai[4622,13,244,3049,3313,0]Ag[4622,14,5103,0,4058,0]Aj[4622,13,4532,3366,3196,0]Aj[4622,13,4532,4481,5088,0]Aj[4622,13,4532,4481,4079,0]Aj[4622,13,4532,4481,5107,0]0Aj[4622,13,4532,4481,4803,0]Aj[4622,13,4532,4481,5165,0]0Ai[4622,13,4532,234,3330,0]Ai[4622,13,4532,234,1917,0]Ai[4622,13,4532,234,4624,0]Ai[4622,13,4532,234,1848,0]Aj[4622,13,4532,3050,1946,0]Ai[4622,13,4532,3050,699,0]Aj[4622,13,4532,3050,1708,0]Aj[4622,13,4532,3050,3314,0]Ag[4622,14,5104,0,4059,0]Aj[4622,13,4667,4667,1947,0]Ai[4622,13,4667,4667,700,0]Aj[4622,13,4667,4667,1709,0]Aj[4622,13,4667,4667,3315,0]Aj[4622,13,4667,4667,1814,0]Aj[4622,13,4667,4667,4810,0]Aj[4622,13,4667,4667,4661,0]Aj[4622,13,4667,4667,1819,0]Aj[4622,13,4667,4667,5089,0]Aj[4622,13,4667,4667,3197,0]Ah[4622,13,4699,4699,91,0]Aj[4622,13,4699,4699,4631,0]Aj[4622,13,4574,4574,4786,0]Aj[4622,13,4574,4574,5160,0]Aj[4622,13,4574,4574,4097,0]Aj[4622,13,4464,4818,4811,0]Aj[4622,13,4464,4818,4662,0]Aj[4622,13,4464,4464,5161,0]Aj[4622,13,4464,4464,3339,0]Aj[4622,13,4464,4464,3293,0]Aj[4622,13,3371,3371,3195,0]Aj[4622,13,3371,3371,4084,0]Aj[4622,13,2098,3703,5077,0]Aj[4622,13,2098,4478,5079,0]Ek[4622,13,2098,4478,5079,0,\"impl-From%3CEvalError%3C\'a,+\'b%3E%3E-for-ElabError%3C\'a,+\'b%3E\"]Fb[4622,13,2098,4478,5079,0,\"impl-From%3CTypeError%3C\'a,+\'b,+Named%3E%3E-for-ElabError%3C\'a,+\'b%3E\"]Aj[4622,13,2098,4687,4628,0]Aj[4622,13,2098,4570,4092,0]Aj[4622,13,2098,4570,4042,0]Aj[4622,13,2098,4570,3320,0]Ai[4622,13,2098,4570,548,0]Aj[4622,13,2098,4702,4632,0]Ai[4622,13,239,4479,4802,0]Ai[4622,13,239,4479,5164,0]0Ai[4622,13,239,4479,5092,0]Ai[4622,13,239,4479,5403,0]Ai[4622,13,239,2908,1799,0]Ai[4622,13,239,4546,3329,0]Ai[4622,13,239,4546,1916,0]Ai[4622,13,239,4546,3279,0]Ai[4622,13,239,4697,1847,0]Ai[4622,13,244,4480,5087,0]Ai[4622,13,244,4480,4078,0]Ai[4622,13,244,4480,5106,0]0Ai[4622,13,244,3786,3269,0]Ai[4622,13,244,4689,4629,0]Ai[4622,13,244,3049,1834,0]Ai[4622,13,244,3049,3211,0]Ai[4622,13,244,3049,3258,0]Ai[4622,13,244,3049,1732,0]Ai[4622,13,244,3049,3289,0]Ai[4622,13,244,3049,1945,0]Ai[4622,13,244,3049,4035,0]Ah[4622,13,244,3049,698,0]Ai[4622,13,244,3049,1707,0]Ai[4622,13,244,3049,3313,0]Ag[4622,14,5103,0,4058,0]Aj[4622,13,4532,3366,3196,0]Aj[4622,13,4532,4481,5088,0]Aj[4622,13,4532,4481,4079,0]Aj[4622,13,4532,4481,5107,0]0Aj[4622,13,4532,4481,4803,0]Aj[4622,13,4532,4481,5165,0]0Ai[4622,13,4532,234,3330,0]Ai[4622,13,4532,234,1917,0]Ai[4622,13,4532,234,4624,0]Ai[4622,13,4532,234,1848,0]Aj[4622,13,4532,3050,1946,0]Ai[4622,13,4532,3050,699,0]Aj[4622,13,4532,3050,1708,0]Aj[4622,13,4532,3050,3314,0]Ag[4622,14,5104,0,4059,0]Aj[4622,13,4667,4667,1947,0]Ai[4622,13,4667,4667,700,0]Aj[4622,13,4667,4667,1709,0]Aj[4622,13,4667,4667,3315,0]Aj[4622,13,4667,4667,1814,0]Aj[4622,13,4667,4667,4810,0]Aj[4622,13,4667,4667,4661,0]Aj[4622,13,4667,4667,1819,0]Aj[4622,13,4667,4667,5089,0]Aj[4622,13,4667,4667,3197,0]Ah[4622,13,4699,4699,91,0]Aj[4622,13,4699,4699,4631,0]Aj[4622,13,4574,4574,4786,0]Aj[4622,13,4574,4574,5160,0]Aj[4622,13,4574,4574,4097,0]Aj[4622,13,4464,4818,4811,0]Aj[4622,13,4464,4818,4662,0]Aj[4622,13,4464,4464,5161,0]Aj[4622,13,4464,4464,3339,0]Aj[4622,13,4464,4464,3293,0]Aj[4622,13,3371,3371,3195,0]Aj[4622,13,3371,3371,4084,0]Aj[4622,13,2098,3703,5077,0]Aj[4622,13,2098,4478,5079,0]Ek[4622,13,2098,4478,5079,0,\"impl-From%3CEvalError%3C\'a,+\'b%3E%3E-for-ElabError%3C\'a,+\'b%3E\"]Fb[4622,13,2098,4478,5079,0,\"impl-From%3CTypeError%3C\'a,+\'b,+Named%3E%3E-for-ElabError%3C\'a,+\'b%3E\"]Aj[4622,13,2098,4687,4628,0]Aj[4622,13,2098,4570,4092,0]Aj[4622,13,2098,4570,4042,0]Aj[4622,13,2098,4570,3320,0]Ai[4622,13,2098,4570,548,0]Aj[4622,13,2098,4702,4632,0]Ai[4622,13,239,4479,4802,0]Ai[4622,13,239,4479,5164,0]0Ai[4622,13,239,4479,5092,0]Ai[4622,13,239,4479,5403,0]Ai[4622,13,239,2908,1799,0]Ai[4622,13,239,4546,3329,0]Ai[4622,13,239,4546,1916,0]Ai[4622,13,239,4546,3279,0]Ai[4622,13,239,4697,1847,0]Ai[4622,13,244,4480,5087,0]Ai[4622,13,244,4480,4078,0]Ai[4622,13,244,4480,5106,0]0Ai[4622,13,244,3786,3269,0]Ai[4622,13,244,4689,4629,0]Ai[4622,13,244,3049,1834,0]Ai[4622,13,244,3049,3211,0]Ai[4622,13,244,3049,3258,0]Ai[4622,13,244,3049,1732,0]Ai[4622,13,244,3049,3289,0]Ai[4622,13,244,3049,1945,0]Ai[4622,13,244,3049,4035,0]Ah[4622,13,244,3049,698,0]Ai[4622,13,244,3049,1707,0]Ai[4622,13,244,3049,3313,0]Ag[4622,14,5103,0,4058,0]Aj[4622,13,4532,3366,3196,0]Aj[4622,13,4532,4481,5088,0]Aj[4622,13,4532,4481,4079,0]Aj[4622,13,4532,4481,5107,0]0Aj[4622,13,4532,4481,4803,0]Aj[4622,13,4532,4481,5165,0]0Ai[4622,13,4532,234,3330,0]Ai[4622,13,4532,234,1917,0]Ai[4622,13,4532,234,4624,0]Ai[4622,13,4532,234,1848,0]Aj[4622,13,4532,3050,1946,0]Ai[4622,13,4532,3050,699,0]Aj[4622,13,4532,3050,1708,0]Aj[4622,13,4532,3050,3314,0]Ag[4622,14,5104,0,4059,0]Aj[4622,13,4667,4667,1947,0]Ai[4622,13,4667,4667,700,0]Aj[4622,13,4667,4667,1709,0]Aj[4622,13,4667,4667,3315,0]Aj[4622,13,4667,4667,1814,0]Aj[4622,13,4667,4667,4810,0]Aj[4622,13,4667,4667,4661,0]Aj[4622,13,4667,4667,1819,0]Aj[4622,13,4667,4667,5089,0]Aj[4622,13,4667,4667,3197,0]Ah[4622,13,4699,4699,91,0]Aj[4622,13,4699,4699,4631,0]Aj[4622,13,4574,4574,4786,0]Aj[4622,13,4574,4574,5160,0]Aj[4622,13,4574,4574,4097,0]Aj[4622,13,4464,4818,4811,0]Aj[4622,13,4464,4818,4662,0]Aj[4622,13,4464,4464,5161,0]Aj[4622,13,4464,4464,3339,0]Aj[4622,13,4464,4464,3293,0]Aj[4622,13,3371,3371,3195,0]Aj[4622,13,3371,3371,4084,0]Aj[4622,13,2098,3703,5077,0]Ek[4622,13,2098,4478,5079,0,\"impl-From%3CEvalError%3C\'a,+\'b%3E%3E-for-ElabError%3C\'a,+\'b%3E\"]Fb[4622,13,2098,4478,5079,0,\"impl-From%3CTypeError%3C\'a,+\'b,+Named%3E%3E-for-ElabError%3C\'a,+\'b%3E\"]Aj[4622,13,2098,4478,5079,0]Aj[4622,13,2098,4687,4628,0]Aj[4622,13,2098,4570,4092,0]Aj[4622,13,2098,4570,4042,0]Aj[4622,13,2098,4570,3320,0]Ai[4622,13,2098,4570,548,0]Aj[4622,13,2098,4702,4632,0]Ai[4622,13,239,4479,4802,0]Ai[4622,13,239,4479,5164,0]0Ai[4622,13,239,4479,5092,0]Ai[4622,13,239,4479,5403,0]Ai[4622,13,239,2908,1799,0]Ai[4622,13,239,4546,3329,0]Ai[4622,13,239,4546,1916,0]Ai[4622,13,239,4546,3279,0]Ai[4622,13,239,4697,1847,0]Ai[4622,13,244,4480,5087,0]Ai[4622,13,244,4480,4078,0]Ai[4622,13,244,4480,5106,0]0Ai[4622,13,244,3786,3269,0]Ai[4622,13,244,4689,4629,0]Ai[4622,13,244,3049,1834,0]Ai[4622,13,244,3049,3211,0]Ai[4622,13,244,3049,3258,0]Ai[4622,13,244,3049,1732,0]Ai[4622,13,244,3049,3289,0]Ai[4622,13,244,3049,1945,0]Ai[4622,13,244,3049,4035,0]Ah[4622,13,244,3049,698,0]Ai[4622,13,244,3049,1707,0]Ai[4622,13,244,3049,3313,0]Ag[4622,14,5103,0,4058,0]Aj[4622,13,4532,3366,3196,0]Aj[4622,13,4532,4481,5088,0]Aj[4622,13,4532,4481,4079,0]Aj[4622,13,4532,4481,5107,0]0Aj[4622,13,4532,4481,4803,0]Aj[4622,13,4532,4481,5165,0]0Ai[4622,13,4532,234,3330,0]Ai[4622,13,4532,234,1917,0]Ai[4622,13,4532,234,4624,0]Ai[4622,13,4532,234,1848,0]Aj[4622,13,4532,3050,1946,0]Ai[4622,13,4532,3050,699,0]Aj[4622,13,4532,3050,1708,0]Aj[4622,13,4532,3050,3314,0]Ag[4622,14,5104,0,4059,0]Aj[4622,13,4667,4667,1947,0]Ai[4622,13,4667,4667,700,0]Aj[4622,13,4667,4667,1709,0]Aj[4622,13,4667,4667,3315,0]Aj[4622,13,4667,4667,1814,0]Aj[4622,13,4667,4667,4810,0]Aj[4622,13,4667,4667,4661,0]Aj[4622,13,4667,4667,1819,0]Aj[4622,13,4667,4667,5089,0]Aj[4622,13,4667,4667,3197,0]Ah[4622,13,4699,4699,91,0]Aj[4622,13,4699,4699,4631,0]Aj[4622,13,4574,4574,4786,0]Aj[4622,13,4574,4574,5160,0]Aj[4622,13,4574,4574,4097,0]Aj[4622,13,3371,3371,3195,0]000Ai[4622,13,2098,4570,548,0]Ai[4622,13,244,3049,1834,0]Aj[4622,13,4667,4667,1947,0]Ai[4622,13,4667,4667,700,0]Aj[4622,13,4667,4667,1709,0]Aj[4622,13,4667,4667,3315,0]Aj[4622,13,4667,4667,1814,0]<6543210<6543210<6543210<6543210<Aj[4622,13,2098,3703,5077,0]0000Ai[4622,14,244,3049,4035,0]Ai[4622,14,244,3049,1707,0]Ag[4622,14,3295,0,1710,0]210210210210Aj[4664,13,4665,4665,4779,0]Aj[4664,13,4665,4665,1689,0]Aj[4622,13,4464,4464,5161,0]>Aj[4622,13,3371,3371,4084,0]7Aj[4622,13,2098,4478,5079,0]Aj[4622,13,2098,4687,4628,0]Aj[4622,13,2098,4570,4092,0]Aj[4622,13,2098,4570,4042,0]Aj[4622,13,2098,4570,3320,0]Ai[4622,13,2098,4570,548,0]Aj[4622,13,2098,4702,4632,0]Ai[4622,13,239,4479,4802,0]Ai[4622,13,239,4479,5164,0]Ai[4622,13,239,4479,5403,0]Ai[4622,13,239,4546,3329,0]Ai[4622,13,239,4546,1916,0]Ai[4622,13,239,4546,3279,0]Ai[4622,13,239,4697,1847,0]Ai[4622,13,244,4480,5087,0]Ai[4622,13,244,4480,4078,0]Ai[4622,13,244,4480,5106,0]Ai[4622,13,244,3786,3269,0]Ai[4622,13,244,4689,4629,0]Ai[4622,13,244,3049,1834,0]Ai[4622,13,244,3049,3211,0]Ai[4622,13,244,3049,3258,0]Ai[4622,13,244,3049,1732,0]Ai[4622,13,244,3049,3289,0]Ai[4622,13,244,3049,1945,0]Ai[4622,13,244,3049,4035,0]Ah[4622,13,244,3049,698,0]Ai[4622,13,244,3049,1707,0]Ai[4622,13,244,3049,3313,0]Aj[4622,13,4532,3366,3196,0]Aj[4622,13,4532,4481,5088,0]Aj[4622,13,4532,4481,4079,0]Aj[4622,13,4532,4481,5107,0]Aj[4622,13,4532,4481,4803,0]Aj[4622,13,4532,4481,5165,0]Ai[4622,13,4532,234,3330,0]Ai[4622,13,4532,234,1917,0]Ai[4622,13,4532,234,4624,0]Ai[4622,13,4532,234,1848,0]Aj[4622,13,4532,3050,1946,0]Ai[4622,13,4532,3050,699,0]Aj[4622,13,4532,3050,1708,0]Aj[4622,13,4532,3050,3314,0]Aj[4622,13,4667,4667,1947,0]Ai[4622,13,4667,4667,700,0]Aj[4622,13,4667,4667,1709,0]Aj[4622,13,4667,4667,3315,0]Aj[4622,13,4667,4667,1814,0]Aj[4622,13,4667,4667,4810,0]Aj[4622,13,4667,4667,4661,0]Aj[4622,13,4667,4667,1819,0]Aj[4622,13,4667,4667,5089,0]Aj[4622,13,4667,4667,3197,0]Ah[4622,13,4699,4699,91,0]Aj[4622,13,4699,4699,4631,0]Aj[4622,13,4464,4818,4811,0]Aj[4622,13,4464,4818,4662,0]Aj[4622,13,4464,4464,5161,0]Aj[4622,13,4464,4464,3339,0]Aj[4622,13,4464,4464,3293,0]Aj[4622,13,3371,3371,3195,0]Aj[4622,13,3371,3371,4084,0]Aj[4622,13,2098,3703,5077,0]Aj[4622,13,2098,4478,5079,0]Aj[4622,13,2098,4687,4628,0]Aj[4622,13,2098,4570,4092,0]Aj[4622,13,2098,4570,4042,0]Aj[4622,13,2098,4570,3320,0]Ai[4622,13,2098,4570,548,0]Aj[4622,13,2098,4702,4632,0]Ai[4622,13,239,4479,4802,0]Ai[4622,13,239,4479,5164,0]Ai[4622,13,239,4479,5092,0]Ai[4622,13,239,4479,5403,0]Ai[4622,13,239,2908,1799,0]Ai[4622,13,239,4546,3329,0]Ai[4622,13,239,4546,1916,0]Ai[4622,13,239,4546,3279,0]Ai[4622,13,239,4697,1847,0]Ai[4622,13,244,4480,5087,0]Ai[4622,13,244,4480,4078,0]Ai[4622,13,244,4480,5106,0]Ai[4622,13,244,3786,3269,0]Ai[4622,13,244,4689,4629,0]Ai[4622,13,244,3049,1834,0]Ai[4622,13,244,3049,3211,0]Ai[4622,13,244,3049,3258,0]Ai[4622,13,244,3049,1732,0]Ai[4622,13,244,3049,3289,0]Ai[4622,13,244,3049,1945,0]Ai[4622,13,244,3049,4035,0]Ah[4622,13,244,3049,698,0]Ai[4622,13,244,3049,1707,0]Ai[4622,13,244,3049,3313,0]Aj[4622,13,4532,3366,3196,0]Aj[4622,13,4532,4481,5088,0]Aj[4622,13,4532,4481,4079,0]Aj[4622,13,4532,4481,5107,0]Aj[4622,13,4532,4481,4803,0]Aj[4622,13,4532,4481,5165,0]Ai[4622,13,4532,234,3330,0]Ai[4622,13,4532,234,1917,0]Ai[4622,13,4532,234,4624,0]Ai[4622,13,4532,234,1848,0]Aj[4622,13,4532,3050,1946,0]Ai[4622,13,4532,3050,699,0]Aj[4622,13,4532,3050,1708,0]Aj[4622,13,4532,3050,3314,0]Aj[4622,13,4667,4667,1947,0]Ai[4622,13,4667,4667,700,0]Aj[4622,13,4667,4667,1709,0]Aj[4622,13,4667,4667,3315,0]Aj[4622,13,4667,4667,1814,0]Aj[4622,13,4667,4667,4810,0]Aj[4622,13,4667,4667,4661,0]Aj[4622,13,4667,4667,1819,0]Aj[4622,13,4667,4667,5089,0]Aj[4622,13,4667,4667,3197,0]Ah[4622,13,4699,4699,91,0]Aj[4622,13,4699,4699,4631,0]Aj[4622,13,4574,4574,4786,0]Aj[4622,13,4574,4574,5160,0]Aj[4622,13,4574,4574,4097,0]Aj[4622,13,4464,4818,4811,0]Aj[4622,13,4464,4818,4662,0]Aj[4622,13,4464,4464,5161,0]Aj[4622,13,4464,4464,3339,0]Aj[4622,13,4464,4464,3293,0]Aj[4622,13,3371,3371,3195,0]Aj[4622,13,3371,3371,4084,0]Aj[4622,13,2098,3703,5077,0]Aj[4622,13,2098,4478,5079,0]Aj[4622,13,2098,4687,4628,0]Aj[4622,13,2098,4570,4092,0]Aj[4622,13,2098,4570,4042,0]Aj[4622,13,2098,4570,3320,0]Ai[4622,13,2098,4570,548,0]Aj[4622,13,2098,4702,4632,0]Ai[4622,13,239,4479,4802,0]Ai[4622,13,239,4479,5164,0]Ai[4622,13,239,4479,5092,0]Ai[4622,13,239,4479,5403,0]Ai[4622,13,239,2908,1799,0]Ai[4622,13,239,4546,3329,0]Ai[4622,13,239,4546,1916,0]Ai[4622,13,239,4546,3279,0]Ai[4622,13,239,4697,1847,0]Ai[4622,13,244,4480,5087,0]Ai[4622,13,244,4480,4078,0]Ai[4622,13,244,4480,5106,0]Ai[4622,13,244,3786,3269,0]Ai[4622,13,244,4689,4629,0]Ai[4622,13,244,3049,1834,0]Ai[4622,13,244,3049,3211,0]Ai[4622,13,244,3049,3258,0]Ai[4622,13,244,3049,1732,0]Ai[4622,13,244,3049,3289,0]Ai[4622,13,244,3049,1945,0]Ai[4622,13,244,3049,4035,0]Ah[4622,13,244,3049,698,0]Ai[4622,13,244,3049,1707,0]Ai[4622,13,244,3049,3313,0]Aj[4622,13,4532,3366,3196,0]Aj[4622,13,4532,4481,5088,0]Aj[4622,13,4532,4481,4079,0]Aj[4622,13,4532,4481,5107,0]Aj[4622,13,4532,4481,4803,0]Aj[4622,13,4532,4481,5165,0]Ai[4622,13,4532,234,3330,0]Ai[4622,13,4532,234,1917,0]Ai[4622,13,4532,234,4624,0]Ai[4622,13,4532,234,1848,0]Aj[4622,13,4532,3050,1946,0]Ai[4622,13,4532,3050,699,0]Aj[4622,13,4532,3050,1708,0]Aj[4622,13,4532,3050,3314,0]Aj[4622,13,4667,4667,1947,0]Ai[4622,13,4667,4667,700,0]Aj[4622,13,4667,4667,1709,0]Aj[4622,13,4667,4667,3315,0]Aj[4622,13,4667,4667,1814,0]Aj[4622,13,4667,4667,4810,0]Aj[4622,13,4667,4667,4661,0]Aj[4622,13,4667,4667,1819,0]Aj[4622,13,4667,4667,5089,0]Aj[4622,13,4667,4667,3197,0]Ah[4622,13,4699,4699,91,0]Aj[4622,13,4699,4699,4631,0]Aj[4622,13,4574,4574,4786,0]Aj[4622,13,4574,4574,5160,0]Aj[4622,13,4574,4574,4097,0]Aj[4622,13,4464,4818,4811,0]Aj[4622,13,4464,4818,4662,0]Aj[4622,13,4464,4464,5161,0]Aj[4622,13,4464,4464,3339,0]Aj[4622,13,4464,4464,3293,0]Aj[4622,13,3371,3371,3195,0]Aj[4622,13,3371,3371,4084,0]Aj[4622,13,2098,3703,5077,0]Aj[4622,13,2098,4478,5079,0]Aj[4622,13,2098,4687,4628,0]Aj[4622,13,2098,4570,4092,0]Aj[4622,13,2098,4570,4042,0]Aj[4622,13,2098,4570,3320,0]Ai[4622,13,2098,4570,548,0]Aj[4622,13,2098,4702,4632,0]Ai[4622,13,239,4479,4802,0]Ai[4622,13,239,4479,5164,0]Ai[4622,13,239,4479,5092,0]Ai[4622,13,239,4479,5403,0]Ai[4622,13,239,2908,1799,0]Ai[4622,13,239,4546,3329,0]Ai[4622,13,239,4546,1916,0]Ai[4622,13,239,4546,3279,0]Ai[4622,13,239,4697,1847,0]Ai[4622,13,244,4480,5087,0]Ai[4622,13,244,4480,4078,0]Ai[4622,13,244,4480,5106,0]Ai[4622,13,244,3786,3269,0]Ai[4622,13,244,4689,4629,0]Ai[4622,13,244,3049,1834,0]Ai[4622,13,244,3049,3211,0]Ai[4622,13,244,3049,3258,0]Ai[4622,13,244,3049,1732,0]Ai[4622,13,244,3049,3289,0]Ai[4622,13,244,3049,1945,0]Ai[4622,13,244,3049,4035,0]Ah[4622,13,244,3049,698,0]Ai[4622,13,244,3049,1707,0]Ai[4622,13,244,3049,3313,0]Aj[4622,13,4532,3366,3196,0]Aj[4622,13,4532,4481,5088,0]Aj[4622,13,4532,4481,4079,0]Aj[4622,13,4532,4481,5107,0]Aj[4622,13,4532,4481,4803,0]Aj[4622,13,4532,4481,5165,0]Ai[4622,13,4532,234,3330,0]Ai[4622,13,4532,234,1917,0]Ai[4622,13,4532,234,4624,0]Ai[4622,13,4532,234,1848,0]Aj[4622,13,4532,3050,1946,0]Ai[4622,13,4532,3050,699,0]Aj[4622,13,4532,3050,1708,0]Aj[4622,13,4532,3050,3314,0]Aj[4622,13,4667,4667,1947,0]Ai[4622,13,4667,4667,700,0]Aj[4622,13,4667,4667,1709,0]Aj[4622,13,4667,4667,3315,0]Aj[4622,13,4667,4667,1814,0]Aj[4622,13,4667,4667,4810,0]Aj[4622,13,4667,4667,4661,0]Aj[4622,13,4667,4667,1819,0]Aj[4622,13,4667,4667,5089,0]Aj[4622,13,4667,4667,3197,0]Ah[4622,13,4699,4699,91,0]Aj[4622,13,4699,4699,4631,0]Aj[4622,13,4574,4574,4786,0]Aj[4622,13,4574,4574,5160,0]Aj[4622,13,4574,4574,4097,0]Aj[4622,13,4464,4818,4811,0]Aj[4622,13,4464,4818,4662,0]Aj[4622,13,4464,4464,5161,0]Aj[4622,13,4464,4464,3339,0]Aj[4622,13,4464,4464,3293,0]Aj[4622,13,3371,3371,3195,0]Aj[4622,13,3371,3371,4084,0]Aj[4622,13,2098,3703,5077,0]Aj[4622,13,2098,4478,5079,0]Aj[4622,13,2098,4687,4628,0]Aj[4622,13,2098,4570,4092,0]Aj[4622,13,2098,4570,4042,0]Aj[4622,13,2098,4570,3320,0]Ai[4622,13,2098,4570,548,0]Aj[4622,13,2098,4702,4632,0]Ai[4622,13,239,4479,4802,0]Ai[4622,13,239,4479,5164,0]Ai[4622,13,239,4479,5092,0]Ai[4622,13,239,4479,5403,0]Ai[4622,13,239,2908,1799,0]Ai[4622,13,239,4546,3329,0]Ai[4622,13,239,4546,1916,0]Ai[4622,13,239,4546,3279,0]Ai[4622,13,239,4697,1847,0]Ai[4622,13,244,4480,5087,0]Ai[4622,13,244,4480,4078,0]Ai[4622,13,244,4480,5106,0]Ai[4622,13,244,3786,3269,0]Ai[4622,13,244,4689,4629,0]Ai[4622,13,244,3049,1834,0]Ai[4622,13,244,3049,3211,0]Ai[4622,13,244,3049,3258,0]Ai[4622,13,244,3049,1732,0]Ai[4622,13,244,3049,3289,0]Ai[4622,13,244,3049,1945,0]Ai[4622,13,244,3049,4035,0]Ah[4622,13,244,3049,698,0]Ai[4622,13,244,3049,1707,0]Ai[4622,13,244,3049,3313,0]Aj[4622,13,4532,3366,3196,0]Aj[4622,13,4532,4481,5088,0]Aj[4622,13,4532,4481,4079,0]Aj[4622,13,4532,4481,5107,0]Aj[4622,13,4532,4481,4803,0]Aj[4622,13,4532,4481,5165,0]Ai[4622,13,4532,234,3330,0]Ai[4622,13,4532,234,1917,0]Ai[4622,13,4532,234,4624,0]Ai[4622,13,4532,234,1848,0]Aj[4622,13,4532,3050,1946,0]Ai[4622,13,4532,3050,699,0]Aj[4622,13,4532,3050,1708,0]Aj[4622,13,4532,3050,3314,0]Aj[4622,13,4667,4667,1947,0]Ai[4622,13,4667,4667,700,0]Aj[4622,13,4667,4667,1709,0]Aj[4622,13,4667,4667,3315,0]Aj[4622,13,4667,4667,1814,0]Aj[4622,13,4667,4667,4810,0]Aj[4622,13,4667,4667,4661,0]Aj[4622,13,4667,4667,1819,0]Aj[4622,13,4667,4667,5089,0]Aj[4622,13,4667,4667,3197,0]Ah[4622,13,4699,4699,91,0]Aj[4622,13,4699,4699,4631,0]Aj[4622,13,4574,4574,4786,0]Aj[4622,13,4574,4574,5160,0]Aj[4622,13,4574,4574,4097,0]Aj[4622,13,2098,4687,4628,0]00004444400000Aj[4622,12,4464,4818,4781,0]00077777Aj[4622,13,3371,3371,3195,0]0000Ag[4622,14,5078,0,4626,0]Ag[4622,14,5078,0,5338,0]Ag[4622,14,5078,0,4641,0]Ag[4622,14,5162,0,5439,0]Ag[4622,14,5402,0,5410,0]Ag[4622,14,5402,0,4807,0]Ai[4622,14,244,3049,3211,0]Ai[4622,14,244,3049,3258,0]Ag[4622,14,5103,0,5523,0]Ag[4622,14,5163,0,5440,0]9876543210987654321098765432109876543210Ai[4622,13,239,4546,3279,0]0000Aj[4622,13,4667,4667,1947,0]Ai[4622,13,4667,4667,700,0]10101010>>>>Aj[4622,13,4464,4464,3339,0]000Aj[4622,12,4464,4464,4030,0]Ai[4622,13,244,3049,3313,0]Ag[4622,14,3295,0,1710,0]Aj[4622,13,4532,3050,3314,0]Ag[4622,14,3296,0,1711,0]43210432104321043210Aj[4622,13,4464,4464,3293,0]000Aj[4622,13,4699,4699,4631,0]0000Aj[4622,13,2098,4687,4628,0]0000Aj[4622,13,3371,3371,3195,0]0000Ag[4622,14,5078,0,5338,0]Ag[4622,14,5078,0,4641,0]Ai[4622,14,244,3049,4035,0]Ag[4622,14,5103,0,5328,0]Ag[4622,14,5103,0,5365,0]Ag[4622,14,5103,0,5166,0]Ag[4622,14,5103,0,5339,0]Ag[4622,14,5103,0,5369,0]Ag[4622,14,5103,0,5457,0]Ag[4622,14,5103,0,5523,0]Aj[4622,13,4532,3366,3196,0]Ag[4622,14,5104,0,5329,0]Ag[4622,14,5104,0,5366,0]Ag[4622,14,5104,0,5167,0]Ag[4622,14,5104,0,5340,0]Ag[4622,14,5104,0,5370,0]Ag[4622,14,5104,0,5458,0]Aj[4622,13,4667,4667,3197,0]Aj[4622,12,4464,4818,4781,0]Aj[4622,13,3371,3371,3195,0]Ag[4622,14,5078,0,5338,0]Ag[4622,14,5078,0,4641,0]Ai[4622,14,244,3049,4035,0]Ag[4622,14,5103,0,5328,0]Ag[4622,14,5103,0,5365,0]Ag[4622,14,5103,0,5166,0]Ag[4622,14,5103,0,5339,0]Ag[4622,14,5103,0,5369,0]Ag[4622,14,5103,0,5457,0]Ag[4622,14,5103,0,5523,0]Aj[4622,13,4532,3366,3196,0]Ag[4622,14,5104,0,5329,0]Ag[4622,14,5104,0,5366,0]Ag[4622,14,5104,0,5167,0]Ag[4622,14,5104,0,5340,0]Ag[4622,14,5104,0,5370,0]Ag[4622,14,5104,0,5458,0]Aj[4622,13,4667,4667,3197,0]Aj[4622,12,4464,4818,4781,0]Aj[4622,13,3371,3371,3195,0]Ag[4622,14,5078,0,5338,0]Ag[4622,14,5078,0,4641,0]Ai[4622,14,244,3049,4035,0]Ag[4622,14,5103,0,5328,0]Ag[4622,14,5103,0,5365,0]Ag[4622,14,5103,0,5166,0]Ag[4622,14,5103,0,5339,0]Ag[4622,14,5103,0,5369,0]Ag[4622,14,5103,0,5457,0]Ag[4622,14,5103,0,5523,0]Aj[4622,13,4532,3366,3196,0]Ag[4622,14,5104,0,5329,0]Ag[4622,14,5104,0,5366,0]Ag[4622,14,5104,0,5167,0]Ag[4622,14,5104,0,5340,0]Ag[4622,14,5104,0,5370,0]Ag[4622,14,5104,0,5458,0]Aj[4622,13,4667,4667,3197,0]Aj[4622,12,4464,4818,4781,0]Aj[4622,13,3371,3371,3195,0]Ag[4622,14,5078,0,5338,0]Ag[4622,14,5078,0,4641,0]Ai[4622,14,244,3049,4035,0]Ag[4622,14,5103,0,5328,0]Ag[4622,14,5103,0,5365,0]Ag[4622,14,5103,0,5166,0]Ag[4622,14,5103,0,5339,0]Ag[4622,14,5103,0,5369,0]Ag[4622,14,5103,0,5457,0]Ag[4622,14,5103,0,5523,0]Aj[4622,13,4532,3366,3196,0]Ag[4622,14,5104,0,5329,0]Ag[4622,14,5104,0,5366,0]Ag[4622,14,5104,0,5167,0]Ag[4622,14,5104,0,5340,0]Ag[4622,14,5104,0,5370,0]Ag[4622,14,5104,0,5458,0]Aj[4622,13,4667,4667,3197,0]Aj[4622,12,4464,4818,4781,0]Aj[4622,13,3371,3371,3195,0]Ag[4622,14,5078,0,5338,0]Ag[4622,14,5078,0,4641,0]Ai[4622,14,244,3049,4035,0]Ag[4622,14,5103,0,5328,0]Ag[4622,14,5103,0,5365,0]Ag[4622,14,5103,0,5166,0]Ag[4622,14,5103,0,5339,0]Ag[4622,14,5103,0,5369,0]Ag[4622,14,5103,0,5457,0]Ag[4622,14,5103,0,5523,0]Aj[4622,13,4532,3366,3196,0]Ag[4622,14,5104,0,5329,0]Ag[4622,14,5104,0,5366,0]Ag[4622,14,5104,0,5167,0]Ag[4622,14,5104,0,5340,0]Ag[4622,14,5104,0,5370,0]Ag[4622,14,5104,0,5458,0]Aj[4622,13,4667,4667,3197,0]Aj[4622,13,4574,4574,4786,0]000Ag[4622,14,5103,0,4812,0]Ag[4622,14,5104,0,4813,0]10101010Aj[4622,12,4464,4818,4781,0]000Ai[4622,13,244,3049,1945,0]0Ah[4622,13,244,3049,698,0]101010Aj[4622,17,4464,4818,4781,0]Ac[4622,5,3371,0,0,0]Af[4622,5,4532,3366,0,0]Ac[4622,5,4667,0,0,0]321032103210210Ai[4622,15,239,2908,1799,0]0004Ae[4622,5,244,3049,0,0]5050500Ah[4622,15,4699,4699,91,0]0000Ai[4622,15,244,3049,1945,0]0000Ai[4622,19,244,3049,1834,0]000888888Ai[4622,17,244,4480,1906,0]Aj[4622,17,4532,4481,1907,0]:10:10Ai[4622,15,2098,4570,548,0];06;06;06;066Ah[4622,15,244,3049,698,0]0000Ae[4622,5,244,3786,0,0]000077777Ae[4622,5,239,4546,0,0]0000Ai[4622,15,4532,234,4624,0]:0:0:0:0:Ac[4622,5,4464,0,0,0]000Aj[4622,17,4464,4818,4781,0]Ae[4622,6,244,3049,0,0]Af[4622,6,4532,3050,0,0]Ac[4622,5,4667,0,0,0]321032103210210Af[4622,5,2098,4570,0,0]0000Ae[4622,6,239,4546,0,0]Ae[4622,6,4532,234,0,0]10101010888887777Aj[4664,13,4665,4665,1689,0]Ai[4622,13,244,4689,4629,0]Ai[4622,13,244,3049,1707,0]Aj[4622,13,4532,3050,1708,0]Aj[4622,13,4667,4667,1709,0]Af[4622,7,4464,4818,0,0]4321043210432104321Ac[4622,2,4623,0,0,0]0000Ah[4622,13,244,3049,698,0]Ai[4622,13,4532,3050,699,0]10101010Ai[4622,14,244,3049,3211,0]Ai[4622,14,244,3049,3258,0]10101010Aj[4622,13,3371,3371,3195,0]0000Aj[4622,14,2098,4570,4042,0]Aj[4622,13,4464,4464,3339,0]1010101Aj[4622,13,2098,4702,4632,0]Ch[4622,13,244,3049,1945,0,\"impl-Term%3C\'a,+\'b,+Named%3E\"]Cg[4622,13,244,3049,1945,0,\"impl-Term%3C\'a,+\'b,+Core%3E\"]Aj[4622,13,4532,3050,1946,0]3120312031203210Aj[4622,13,4699,4699,4631,0]50505050Aj[4664,13,4665,4665,4779,0]Aj[4622,13,2098,4478,5079,0]Aj[4622,13,2098,4570,4042,0]Aj[4622,13,2098,4570,3320,0]Ai[4622,13,2098,4570,548,0]Ai[4622,13,239,4479,4802,0]Ai[4622,13,239,4479,5164,0]Ai[4622,13,239,4479,5403,0]Ai[4622,13,239,4546,3329,0]Ai[4622,13,239,4546,1916,0]Ai[4622,13,239,4546,3279,0]Ai[4622,13,239,4697,1847,0]Ai[4622,13,244,4480,5087,0]Ai[4622,13,244,4480,4078,0]Ai[4622,13,244,4480,5106,0]Ai[4622,13,244,3786,3269,0]Ai[4622,13,244,3049,1834,0]Ai[4622,13,244,3049,3211,0]Ai[4622,13,244,3049,3258,0]Ai[4622,13,244,3049,1732,0]Ai[4622,13,244,3049,3289,0]Ai[4622,13,244,3049,1945,0]Ah[4622,13,244,3049,698,0]Ai[4622,13,244,3049,1707,0]Ai[4622,13,244,3049,3313,0]Aj[4622,13,4532,4481,5088,0]Aj[4622,13,4532,4481,4079,0]Aj[4622,13,4532,4481,5107,0]Aj[4622,13,4532,4481,4803,0]Aj[4622,13,4532,4481,5165,0]Ai[4622,13,4532,234,3330,0]Ai[4622,13,4532,234,1917,0]Ai[4622,13,4532,234,4624,0]Ai[4622,13,4532,234,1848,0]Aj[4622,13,4532,3050,1946,0]Ai[4622,13,4532,3050,699,0]Aj[4622,13,4532,3050,1708,0]Aj[4622,13,4532,3050,3314,0]Aj[4622,13,4667,4667,1947,0]Ai[4622,13,4667,4667,700,0]Aj[4622,13,4667,4667,1709,0]Aj[4622,13,4667,4667,3315,0]Aj[4622,13,4667,4667,1814,0]Aj[4622,13,4667,4667,4810,0]Aj[4622,13,4667,4667,4661,0]Aj[4622,13,4667,4667,1819,0]Aj[4622,13,4667,4667,5089,0]Ah[4622,13,4699,4699,91,0]Aj[4622,13,2098,4478,5079,0]Aj[4622,13,2098,4570,4042,0]Aj[4622,13,2098,4570,3320,0]Ai[4622,13,2098,4570,548,0]Ai[4622,13,239,4479,4802,0]Ai[4622,13,239,4479,5164,0]Ai[4622,13,239,4479,5092,0]Ai[4622,13,239,4479,5403,0]Ai[4622,13,239,2908,1799,0]Ai[4622,13,239,4546,3329,0]Ai[4622,13,239,4546,1916,0]Ai[4622,13,239,4546,3279,0]Ai[4622,13,239,4697,1847,0]Ai[4622,13,244,4480,5087,0]Ai[4622,13,244,4480,4078,0]Ai[4622,13,244,4480,5106,0]Ai[4622,13,244,3786,3269,0]Ai[4622,13,244,3049,1834,0]Ai[4622,13,244,3049,3211,0]Ai[4622,13,244,3049,3258,0]Ai[4622,13,244,3049,1732,0]Ai[4622,13,244,3049,3289,0]Ai[4622,13,244,3049,1945,0]Ah[4622,13,244,3049,698,0]Ai[4622,13,244,3049,1707,0]Ai[4622,13,244,3049,3313,0]Aj[4622,13,4532,4481,5088,0]Aj[4622,13,4532,4481,4079,0]Aj[4622,13,4532,4481,5107,0]Aj[4622,13,4532,4481,4803,0]Aj[4622,13,4532,4481,5165,0]Ai[4622,13,4532,234,3330,0]Ai[4622,13,4532,234,1917,0]Ai[4622,13,4532,234,4624,0]Ai[4622,13,4532,234,1848,0]Aj[4622,13,4532,3050,1946,0]Ai[4622,13,4532,3050,699,0]Aj[4622,13,4532,3050,1708,0]Aj[4622,13,4532,3050,3314,0]Aj[4622,13,4667,4667,1947,0]Ai[4622,13,4667,4667,700,0]Aj[4622,13,4667,4667,1709,0]Aj[4622,13,4667,4667,3315,0]Aj[4622,13,4667,4667,1814,0]Aj[4622,13,4667,4667,4810,0]Aj[4622,13,4667,4667,4661,0]Aj[4622,13,4667,4667,1819,0]Aj[4622,13,4667,4667,5089,0]Ah[4622,13,4699,4699,91,0]Aj[4622,13,4574,4574,5160,0]Aj[4622,13,2098,4478,5079,0]Aj[4622,13,2098,4570,4042,0]Aj[4622,13,2098,4570,3320,0]Ai[4622,13,2098,4570,548,0]Ai[4622,13,239,4479,4802,0]Ai[4622,13,239,4479,5164,0]Ai[4622,13,239,4479,5092,0]Ai[4622,13,239,4479,5403,0]Ai[4622,13,239,2908,1799,0]Ai[4622,13,239,4546,3329,0]Ai[4622,13,239,4546,1916,0]Ai[4622,13,239,4546,3279,0]Ai[4622,13,239,4697,1847,0]Ai[4622,13,244,4480,5087,0]Ai[4622,13,244,4480,4078,0]Ai[4622,13,244,4480,5106,0]Ai[4622,13,244,3786,3269,0]Ai[4622,13,244,3049,1834,0]Ai[4622,13,244,3049,3211,0]Ai[4622,13,244,3049,3258,0]Ai[4622,13,244,3049,1732,0]Ai[4622,13,244,3049,3289,0]Ai[4622,13,244,3049,1945,0]Ah[4622,13,244,3049,698,0]Ai[4622,13,244,3049,1707,0]Ai[4622,13,244,3049,3313,0]Aj[4622,13,4532,4481,5088,0]Aj[4622,13,4532,4481,4079,0]Aj[4622,13,4532,4481,5107,0]Aj[4622,13,4532,4481,4803,0]Aj[4622,13,4532,4481,5165,0]Ai[4622,13,4532,234,3330,0]Ai[4622,13,4532,234,1917,0]Ai[4622,13,4532,234,4624,0]Ai[4622,13,4532,234,1848,0]Aj[4622,13,4532,3050,1946,0]Ai[4622,13,4532,3050,699,0]Aj[4622,13,4532,3050,1708,0]Aj[4622,13,4532,3050,3314,0]Aj[4622,13,4667,4667,1947,0]Ai[4622,13,4667,4667,700,0]Aj[4622,13,4667,4667,1709,0]Aj[4622,13,4667,4667,3315,0]Aj[4622,13,4667,4667,1814,0]Aj[4622,13,4667,4667,4810,0]Aj[4622,13,4667,4667,4661,0]Aj[4622,13,4667,4667,1819,0]Aj[4622,13,4667,4667,5089,0]Ah[4622,13,4699,4699,91,0]Aj[4622,13,4574,4574,5160,0]Aj[4622,13,2098,4478,5079,0]Aj[4622,13,2098,4570,4042,0]Aj[4622,13,2098,4570,3320,0]Ai[4622,13,2098,4570,548,0]Ai[4622,13,239,4479,4802,0]Ai[4622,13,239,4479,5164,0]Ai[4622,13,239,4479,5092,0]Ai[4622,13,239,4479,5403,0]Ai[4622,13,239,2908,1799,0]Ai[4622,13,239,4546,3329,0]Ai[4622,13,239,4546,1916,0]Ai[4622,13,239,4546,3279,0]Ai[4622,13,239,4697,1847,0]Ai[4622,13,244,4480,5087,0]Ai[4622,13,244,4480,4078,0]Ai[4622,13,244,4480,5106,0]Ai[4622,13,244,3786,3269,0]Ai[4622,13,244,3049,1834,0]Ai[4622,13,244,3049,3211,0]Ai[4622,13,244,3049,3258,0]Ai[4622,13,244,3049,1732,0]Ai[4622,13,244,3049,3289,0]Ai[4622,13,244,3049,1945,0]Ah[4622,13,244,3049,698,0]Ai[4622,13,244,3049,1707,0]Ai[4622,13,244,3049,3313,0]Aj[4622,13,4532,4481,5088,0]Aj[4622,13,4532,4481,4079,0]Aj[4622,13,4532,4481,5107,0]Aj[4622,13,4532,4481,4803,0]Aj[4622,13,4532,4481,5165,0]Ai[4622,13,4532,234,3330,0]Ai[4622,13,4532,234,1917,0]Ai[4622,13,4532,234,4624,0]Ai[4622,13,4532,234,1848,0]Aj[4622,13,4532,3050,1946,0]Ai[4622,13,4532,3050,699,0]Aj[4622,13,4532,3050,1708,0]Aj[4622,13,4532,3050,3314,0]Aj[4622,13,4667,4667,1947,0]Ai[4622,13,4667,4667,700,0]Aj[4622,13,4667,4667,1709,0]Aj[4622,13,4667,4667,3315,0]Aj[4622,13,4667,4667,1814,0]Aj[4622,13,4667,4667,4810,0]Aj[4622,13,4667,4667,4661,0]Aj[4622,13,4667,4667,1819,0]Aj[4622,13,4667,4667,5089,0]Ah[4622,13,4699,4699,91,0]Aj[4622,13,4574,4574,5160,0]Aj[4622,13,2098,4478,5079,0]Aj[4622,13,2098,4570,4042,0]Aj[4622,13,2098,4570,3320,0]Ai[4622,13,2098,4570,548,0]Ai[4622,13,239,4479,4802,0]Ai[4622,13,239,4479,5164,0]Ai[4622,13,239,4479,5092,0]Ai[4622,13,239,4479,5403,0]Ai[4622,13,239,2908,1799,0]Ai[4622,13,239,4546,3329,0]Ai[4622,13,239,4546,1916,0]Ai[4622,13,239,4546,3279,0]Ai[4622,13,239,4697,1847,0]Ai[4622,13,244,4480,5087,0]Ai[4622,13,244,4480,4078,0]Ai[4622,13,244,4480,5106,0]Ai[4622,13,244,3786,3269,0]Ai[4622,13,244,3049,1834,0]Ai[4622,13,244,3049,3211,0]Ai[4622,13,244,3049,3258,0]Ai[4622,13,244,3049,1732,0]Ai[4622,13,244,3049,3289,0]Ai[4622,13,244,3049,1945,0]Ah[4622,13,244,3049,698,0]Ai[4622,13,244,3049,1707,0]Ai[4622,13,244,3049,3313,0]Aj[4622,13,4532,4481,5088,0]Aj[4622,13,4532,4481,4079,0]Aj[4622,13,4532,4481,5107,0]Aj[4622,13,4532,4481,4803,0]Aj[4622,13,4532,4481,5165,0]Ai[4622,13,4532,234,3330,0]Ai[4622,13,4532,234,1917,0]Ai[4622,13,4532,234,4624,0]Ai[4622,13,4532,234,1848,0]Aj[4622,13,4532,3050,1946,0]Ai[4622,13,4532,3050,699,0]Aj[4622,13,4532,3050,1708,0]Aj[4622,13,4532,3050,3314,0]Aj[4622,13,4667,4667,1947,0]Ai[4622,13,4667,4667,700,0]Aj[4622,13,4667,4667,1709,0]Aj[4622,13,4667,4667,3315,0]Aj[4622,13,4667,4667,1814,0]Aj[4622,13,4667,4667,4810,0]Aj[4622,13,4667,4667,4661,0]Aj[4622,13,4667,4667,1819,0]Aj[4622,13,4667,4667,5089,0]Ah[4622,13,4699,4699,91,0]Aj[4622,13,4574,4574,5160,0]Aj[4622,12,4464,4464,4030,0]Ai[4622,13,244,3049,3313,0]=10=10=10=10=Aj[4622,13,3371,3371,4084,0]0000Ai[4622,13,244,3786,3269,0]Ai[4622,13,244,3049,3211,0]Ai[4622,13,244,3049,3258,0]Aj[4622,12,4464,4818,4781,0]321032103210321Ag[4622,14,5103,0,5523,0]0000Aj[4622,13,4699,4699,4631,0]00002222Ai[4622,12,244,4480,1906,0]Ai[4622,13,244,4480,5106,0]Aj[4622,12,4532,4481,1907,0]Aj[4622,13,4532,4481,5107,0]32103210Aj[4622,13,3371,3371,3195,0]0000Ah[4622,13,244,3049,698,0]Aj[4622,13,4464,4818,4781,0]010010010012Aj[4622,13,4532,3366,3196,0]Aj[4622,13,4667,4667,3197,0]410410410410Aj[4622,13,4574,4574,4786,0]000Ai[4622,13,244,3049,3313,0]Ag[4622,14,3295,0,1710,0]10101010Cg[4622,13,244,3049,1945,0,\"impl-Term%3C\'a,+\'b,+Core%3E\"]Ch[4622,13,244,3049,1945,0,\"impl-Term%3C\'a,+\'b,+Named%3E\"]Aj[4622,13,4532,3050,1946,0]120120120120Aj[4622,13,4464,4464,3339,0]Ag[4622,14,5080,0,5334,0]Ag[4622,14,5082,0,5335,0]210210210Aj[4622,13,4667,4667,1947,0]0000Aj[4622,13,4699,4699,4631,0]40404040Aj[4622,14,2098,4570,4042,0]0000Ai[4622,13,244,3049,1945,0]7Ai[4622,13,239,2908,1799,0]180180180181818181818Aj[4622,13,2098,4570,4092,0]0000Ai[4622,13,244,4480,4078,0]Ai[4622,13,244,4689,4629,0]Ah[4622,13,244,3049,698,0]Aj[4622,13,4532,4481,4079,0]Ai[4622,13,4532,3050,699,0]Ai[4622,13,4667,4667,700,0]Af[4622,7,4464,4818,0,0]654321065432106543210654321<<<<<Aj[4664,13,4665,4665,1689,0]Aj[4622,13,3371,3371,3195,0]Aj[4622,13,4532,3366,3196,0]Aj[4622,13,4667,4667,3197,0]?Aj[4622,13,4464,4464,3339,0]321Aj[4622,13,4699,4699,4631,0]143201432014320Aj[4622,13,4464,4464,5161,0]0000Aj[4622,12,4464,4818,4781,0]000Ai[4622,14,239,4546,1916,0]Ag[4622,14,5162,0,5439,0]Ag[4622,14,5162,0,5461,0]Ai[4622,14,4532,234,1917,0]Ag[4622,14,5163,0,5440,0]Ag[4622,14,5163,0,5462,0]5Ag[4622,14,5091,0,4043,0]54321Aj[4622,14,4574,4574,5160,0]716543207165432071654320Aj[4622,13,2098,4570,4092,0]0000?>=9?>=9?>=9?>=9?>=Ai[4622,13,244,3049,4035,0]Ag[4622,14,3295,0,1710,0]Ag[4622,14,3296,0,1711,0]210210210210Ad[4622,10,4464,0,0,0]0000Ae[4622,5,244,3049,0,0]0000Af[4622,5,2098,4570,0,0]0000Ai[4622,15,239,4479,5092,0]Ai[4622,15,239,2908,1799,0]1010100000Ai[4622,15,244,4480,5106,0]Aj[4622,15,4532,4481,5107,0]10101010Ae[4622,5,244,4480,0,0]Af[4622,5,4532,4481,0,0]10101010Ac[4622,5,3371,0,0,0]000077777Ac[4622,5,4574,0,0,0]0006666Aj[4622,17,4464,4818,4781,0]000Ah[4622,13,244,3049,698,0]Ai[4622,13,4532,3050,699,0]10101010Ai[4622,13,239,2908,1799,0]Ai[4622,13,244,3049,1834,0]101010Aj[4664,13,4665,4665,4779,0]Aj[4664,13,4665,4665,1689,0]Aj[4622,13,4464,4464,5161,0]Aj[4622,13,3371,3371,3195,0]Aj[4622,13,3371,3371,4084,0]Aj[4622,13,2098,3703,5077,0]Aj[4622,13,2098,4478,5079,0]Aj[4622,13,2098,4687,4628,0]Aj[4622,13,2098,4570,4092,0]Aj[4622,13,2098,4570,4042,0]Aj[4622,13,2098,4570,3320,0]Ai[4622,13,2098,4570,548,0]Aj[4622,13,2098,4702,4632,0]Ai[4622,13,239,4479,4802,0]Ai[4622,13,239,4479,5164,0]Ai[4622,13,239,4479,5403,0]Ai[4622,13,239,4546,3329,0]Ai[4622,13,239,4546,1916,0]Ai[4622,13,239,4546,3279,0]Ai[4622,13,239,4697,1847,0]Ai[4622,13,244,4480,5087,0]Ai[4622,13,244,4480,4078,0]Ai[4622,13,244,4480,5106,0]Ai[4622,13,244,3786,3269,0]Ai[4622,13,244,4689,4629,0]Ai[4622,13,244,3049,1834,0]Ai[4622,13,244,3049,3211,0]Ai[4622,13,244,3049,3258,0]Ai[4622,13,244,3049,1732,0]Ai[4622,13,244,3049,3289,0]Ai[4622,13,244,3049,1945,0]Ai[4622,13,244,3049,4035,0]Ah[4622,13,244,3049,698,0]Ai[4622,13,244,3049,1707,0]Ai[4622,13,244,3049,3313,0]Aj[4622,13,4532,3366,3196,0]Aj[4622,13,4532,4481,5088,0]Aj[4622,13,4532,4481,4079,0]Aj[4622,13,4532,4481,5107,0]Aj[4622,13,4532,4481,4803,0]Aj[4622,13,4532,4481,5165,0]Ai[4622,13,4532,234,3330,0]Ai[4622,13,4532,234,1917,0]Ai[4622,13,4532,234,4624,0]Ai[4622,13,4532,234,1848,0]Aj[4622,13,4532,3050,1946,0]Ai[4622,13,4532,3050,699,0]Aj[4622,13,4532,3050,1708,0]Aj[4622,13,4532,3050,3314,0]Aj[4622,13,4667,4667,1947,0]Ai[4622,13,4667,4667,700,0]Aj[4622,13,4667,4667,1709,0]Aj[4622,13,4667,4667,3315,0]Aj[4622,13,4667,4667,1814,0]Aj[4622,13,4667,4667,4810,0]Aj[4622,13,4667,4667,4661,0]Aj[4622,13,4667,4667,1819,0]Aj[4622,13,4667,4667,5089,0]Aj[4622,13,4667,4667,3197,0]Ah[4622,13,4699,4699,91,0]Aj[4622,13,4699,4699,4631,0]Aj[4622,13,4464,4818,4811,0]Aj[4622,13,4464,4818,4662,0]Aj[4622,13,4464,4464,5161,0]Aj[4622,13,4464,4464,3339,0]Aj[4622,13,4464,4464,3293,0]Aj[4622,13,3371,3371,3195,0]Aj[4622,13,3371,3371,4084,0]Aj[4622,13,2098,3703,5077,0]Aj[4622,13,2098,4478,5079,0]Aj[4622,13,2098,4687,4628,0]Aj[4622,13,2098,4570,4092,0]Aj[4622,13,2098,4570,4042,0]Aj[4622,13,2098,4570,3320,0]Ai[4622,13,2098,4570,548,0]Aj[4622,13,2098,4702,4632,0]Ai[4622,13,239,4479,4802,0]Ai[4622,13,239,4479,5164,0]Ai[4622,13,239,4479,5092,0]Ai[4622,13,239,4479,5403,0]Ai[4622,13,239,2908,1799,0]Ai[4622,13,239,4546,3329,0]Ai[4622,13,239,4546,1916,0]Ai[4622,13,239,4546,3279,0]Ai[4622,13,239,4697,1847,0]Ai[4622,13,244,4480,5087,0]Ai[4622,13,244,4480,4078,0]Ai[4622,13,244,4480,5106,0]Ai[4622,13,244,3786,3269,0]Ai[4622,13,244,4689,4629,0]Ai[4622,13,244,3049,1834,0]Ai[4622,13,244,3049,3211,0]Ai[4622,13,244,3049,3258,0]Ai[4622,13,244,3049,1732,0]Ai[4622,13,244,3049,3289,0]Ai[4622,13,244,3049,1945,0]Ai[4622,13,244,3049,4035,0]Ah[4622,13,244,3049,698,0]Ai[4622,13,244,3049,1707,0]Ai[4622,13,244,3049,3313,0]Aj[4622,13,4532,3366,3196,0]Aj[4622,13,4532,4481,5088,0]Aj[4622,13,4532,4481,4079,0]Aj[4622,13,4532,4481,5107,0]Aj[4622,13,4532,4481,4803,0]Aj[4622,13,4532,4481,5165,0]Ai[4622,13,4532,234,3330,0]Ai[4622,13,4532,234,1917,0]Ai[4622,13,4532,234,4624,0]Ai[4622,13,4532,234,1848,0]Aj[4622,13,4532,3050,1946,0]Ai[4622,13,4532,3050,699,0]Aj[4622,13,4532,3050,1708,0]Aj[4622,13,4532,3050,3314,0]Aj[4622,13,4667,4667,1947,0]Ai[4622,13,4667,4667,700,0]Aj[4622,13,4667,4667,1709,0]Aj[4622,13,4667,4667,3315,0]Aj[4622,13,4667,4667,1814,0]Aj[4622,13,4667,4667,4810,0]Aj[4622,13,4667,4667,4661,0]Aj[4622,13,4667,4667,1819,0]Aj[4622,13,4667,4667,5089,0]Aj[4622,13,4667,4667,3197,0]Ah[4622,13,4699,4699,91,0]Aj[4622,13,4699,4699,4631,0]Aj[4622,13,4574,4574,4786,0]Aj[4622,13,4574,4574,5160,0]Aj[4622,13,4574,4574,4097,0]Aj[4622,13,4464,4818,4811,0]Aj[4622,13,4464,4818,4662,0]Aj[4622,13,4464,4464,5161,0]Aj[4622,13,4464,4464,3339,0]Aj[4622,13,4464,4464,3293,0]Aj[4622,13,3371,3371,3195,0]Aj[4622,13,3371,3371,4084,0]Aj[4622,13,2098,3703,5077,0]Aj[4622,13,2098,4478,5079,0]Aj[4622,13,2098,4687,4628,0]Aj[4622,13,2098,4570,4092,0]Aj[4622,13,2098,4570,4042,0]Aj[4622,13,2098,4570,3320,0]Ai[4622,13,2098,4570,548,0]Aj[4622,13,2098,4702,4632,0]Ai[4622,13,239,4479,4802,0]Ai[4622,13,239,4479,5164,0]Ai[4622,13,239,4479,5092,0]Ai[4622,13,239,4479,5403,0]Ai[4622,13,239,2908,1799,0]Ai[4622,13,239,4546,3329,0]Ai[4622,13,239,4546,1916,0]Ai[4622,13,239,4546,3279,0]Ai[4622,13,239,4697,1847,0]Ai[4622,13,244,4480,5087,0]Ai[4622,13,244,4480,4078,0]Ai[4622,13,244,4480,5106,0]Ai[4622,13,244,3786,3269,0]Ai[4622,13,244,4689,4629,0]Ai[4622,13,244,3049,1834,0]Ai[4622,13,244,3049,3211,0]Ai[4622,13,244,3049,3258,0]Ai[4622,13,244,3049,1732,0]Ai[4622,13,244,3049,3289,0]Ai[4622,13,244,3049,1945,0]Ai[4622,13,244,3049,4035,0]Ah[4622,13,244,3049,698,0]Ai[4622,13,244,3049,1707,0]Ai[4622,13,244,3049,3313,0]Aj[4622,13,4532,3366,3196,0]Aj[4622,13,4532,4481,5088,0]Aj[4622,13,4532,4481,4079,0]Aj[4622,13,4532,4481,5107,0]Aj[4622,13,4532,4481,4803,0]Aj[4622,13,4532,4481,5165,0]Ai[4622,13,4532,234,3330,0]Ai[4622,13,4532,234,1917,0]Ai[4622,13,4532,234,4624,0]Ai[4622,13,4532,234,1848,0]Aj[4622,13,4532,3050,1946,0]Ai[4622,13,4532,3050,699,0]Aj[4622,13,4532,3050,1708,0]Aj[4622,13,4532,3050,3314,0]Aj[4622,13,4667,4667,1947,0]Ai[4622,13,4667,4667,700,0]Aj[4622,13,4667,4667,1709,0]Aj[4622,13,4667,4667,3315,0]Aj[4622,13,4667,4667,1814,0]Aj[4622,13,4667,4667,4810,0]Aj[4622,13,4667,4667,4661,0]Aj[4622,13,4667,4667,1819,0]Aj[4622,13,4667,4667,5089,0]Aj[4622,13,4667,4667,3197,0]Ah[4622,13,4699,4699,91,0]Aj[4622,13,4699,4699,4631,0]Aj[4622,13,4574,4574,4786,0]Aj[4622,13,4574,4574,5160,0]Aj[4622,13,4574,4574,4097,0]Aj[4622,13,4464,4818,4811,0]Aj[4622,13,4464,4818,4662,0]Aj[4622,13,4464,4464,5161,0]Aj[4622,13,4464,4464,3339,0]Aj[4622,13,4464,4464,3293,0]Aj[4622,13,3371,3371,3195,0]Aj[4622,13,3371,3371,4084,0]Aj[4622,13,2098,3703,5077,0]Aj[4622,13,2098,4478,5079,0]Aj[4622,13,2098,4687,4628,0]Aj[4622,13,2098,4570,4092,0]Aj[4622,13,2098,4570,4042,0]Aj[4622,13,2098,4570,3320,0]Ai[4622,13,2098,4570,548,0]Aj[4622,13,2098,4702,4632,0]Ai[4622,13,239,4479,4802,0]Ai[4622,13,239,4479,5164,0]Ai[4622,13,239,4479,5092,0]Ai[4622,13,239,4479,5403,0]Ai[4622,13,239,2908,1799,0]Ai[4622,13,239,4546,3329,0]Ai[4622,13,239,4546,1916,0]Ai[4622,13,239,4546,3279,0]Ai[4622,13,239,4697,1847,0]Ai[4622,13,244,4480,5087,0]Ai[4622,13,244,4480,4078,0]Ai[4622,13,244,4480,5106,0]Ai[4622,13,244,3786,3269,0]Ai[4622,13,244,4689,4629,0]Ai[4622,13,244,3049,1834,0]Ai[4622,13,244,3049,3211,0]Ai[4622,13,244,3049,3258,0]Ai[4622,13,244,3049,1732,0]Ai[4622,13,244,3049,3289,0]Ai[4622,13,244,3049,1945,0]Ai[4622,13,244,3049,4035,0]Ah[4622,13,244,3049,698,0]Ai[4622,13,244,3049,1707,0]Ai[4622,13,244,3049,3313,0]Aj[4622,13,4532,3366,3196,0]Aj[4622,13,4532,4481,5088,0]Aj[4622,13,4532,4481,4079,0]Aj[4622,13,4532,4481,5107,0]Aj[4622,13,4532,4481,4803,0]Aj[4622,13,4532,4481,5165,0]Ai[4622,13,4532,234,3330,0]Ai[4622,13,4532,234,1917,0]Ai[4622,13,4532,234,4624,0]Ai[4622,13,4532,234,1848,0]Aj[4622,13,4532,3050,1946,0]Ai[4622,13,4532,3050,699,0]Aj[4622,13,4532,3050,1708,0]Aj[4622,13,4532,3050,3314,0]Aj[4622,13,4667,4667,1947,0]Ai[4622,13,4667,4667,700,0]Aj[4622,13,4667,4667,1709,0]Aj[4622,13,4667,4667,3315,0]Aj[4622,13,4667,4667,1814,0]Aj[4622,13,4667,4667,4810,0]Aj[4622,13,4667,4667,4661,0]Aj[4622,13,4667,4667,1819,0]Aj[4622,13,4667,4667,5089,0]Aj[4622,13,4667,4667,3197,0]Ah[4622,13,4699,4699,91,0]Aj[4622,13,4699,4699,4631,0]Aj[4622,13,4574,4574,4786,0]Aj[4622,13,4574,4574,5160,0]Aj[4622,13,4574,4574,4097,0]Aj[4622,13,4464,4818,4811,0]Aj[4622,13,4464,4818,4662,0]Aj[4622,13,4464,4464,5161,0]Aj[4622,13,4464,4464,3339,0]Aj[4622,13,4464,4464,3293,0]Aj[4622,13,3371,3371,3195,0]Aj[4622,13,3371,3371,4084,0]Aj[4622,13,2098,3703,5077,0]Aj[4622,13,2098,4478,5079,0]Aj[4622,13,2098,4687,4628,0]Aj[4622,13,2098,4570,4092,0]Aj[4622,13,2098,4570,4042,0]Aj[4622,13,2098,4570,3320,0]Ai[4622,13,2098,4570,548,0]Aj[4622,13,2098,4702,4632,0]Ai[4622,13,239,4479,4802,0]Ai[4622,13,239,4479,5164,0]Ai[4622,13,239,4479,5092,0]Ai[4622,13,239,4479,5403,0]Ai[4622,13,239,2908,1799,0]Ai[4622,13,239,4546,3329,0]Ai[4622,13,239,4546,1916,0]Ai[4622,13,239,4546,3279,0]Ai[4622,13,239,4697,1847,0]Ai[4622,13,244,4480,5087,0]Ai[4622,13,244,4480,4078,0]Ai[4622,13,244,4480,5106,0]Ai[4622,13,244,3786,3269,0]Ai[4622,13,244,4689,4629,0]Ai[4622,13,244,3049,1834,0]Ai[4622,13,244,3049,3211,0]Ai[4622,13,244,3049,3258,0]Ai[4622,13,244,3049,1732,0]Ai[4622,13,244,3049,3289,0]Ai[4622,13,244,3049,1945,0]Ai[4622,13,244,3049,4035,0]Ah[4622,13,244,3049,698,0]Ai[4622,13,244,3049,1707,0]Ai[4622,13,244,3049,3313,0]Aj[4622,13,4532,3366,3196,0]Aj[4622,13,4532,4481,5088,0]Aj[4622,13,4532,4481,4079,0]Aj[4622,13,4532,4481,5107,0]Aj[4622,13,4532,4481,4803,0]Aj[4622,13,4532,4481,5165,0]Ai[4622,13,4532,234,3330,0]Ai[4622,13,4532,234,1917,0]Ai[4622,13,4532,234,4624,0]Ai[4622,13,4532,234,1848,0]Aj[4622,13,4532,3050,1946,0]Ai[4622,13,4532,3050,699,0]Aj[4622,13,4532,3050,1708,0]Aj[4622,13,4532,3050,3314,0]Aj[4622,13,4667,4667,1947,0]Ai[4622,13,4667,4667,700,0]Aj[4622,13,4667,4667,1709,0]Aj[4622,13,4667,4667,3315,0]Aj[4622,13,4667,4667,1814,0]Aj[4622,13,4667,4667,4810,0]Aj[4622,13,4667,4667,4661,0]Aj[4622,13,4667,4667,1819,0]Aj[4622,13,4667,4667,5089,0]Aj[4622,13,4667,4667,3197,0]Ah[4622,13,4699,4699,91,0]Aj[4622,13,4699,4699,4631,0]Aj[4622,13,4574,4574,4786,0]Aj[4622,13,4574,4574,5160,0]Aj[4622,13,4574,4574,4097,0]Ac[4622,2,4623,0,0,0]0000Ah[4622,13,244,3049,698,0]Aj[4622,13,4464,4818,4781,0]01001001001Ai[4622,13,244,3049,3313,0]Aj[4622,13,4532,3050,3314,0]Aj[4622,12,4464,4818,4781,0]21021021021Ai[4622,13,244,3049,1945,0]00Aj[4622,13,3371,3371,3195,0]0000000008888Aj[4622,13,2098,3703,5077,0]Aj[4622,13,2098,4687,4628,0]Ai[4622,13,244,3786,3269,0]210210210210:::::>>>>>Ai[4622,13,239,2908,1799,0]000Ac[4622,7,4574,0,0,0]000;Ai[4622,13,4532,3050,699,0]8<08<08<08<066Aj[4622,13,4532,3366,3196,0]707070>>>>7777777777Aj[4622,13,4574,4574,4786,0]000Aj[4622,13,4667,4667,3197,0]00009=20;9=20;9=20;9=20;9=2099999A`[4622,3,0,0,0,0]Ae[4622,6,4532,234,0,0]Aj[4622,15,2098,4478,5079,0]Af[4622,5,2098,4687,0,0]Ae[4622,5,244,4689,0,0]Ac[4622,5,4699,0,0,0]Af[4622,5,2098,4702,0,0]Ai[4622,15,244,4480,5106,0]Aj[4622,15,4532,4481,5107,0]10610Aj[4622,17,4464,4818,4781,0]Ai[4622,15,244,4480,5087,0]Aj[4622,15,4532,4481,5088,0]Aj[4622,15,4667,4667,5089,0]210Ac[4622,6,4667,0,0,0]Af[4622,6,4464,4818,0,0]Ah[4622,13,244,3049,698,0]Ai[4622,13,4532,3050,699,0]A`[4664,3,0,0,0,0]Aj[4622,12,4464,4818,4781,0]Ac[4622,2,4532,0,0,0]Aj[4622,13,3371,3371,3195,0]Aj[4622,13,4532,3366,3196,0]Aj[4664,13,4665,4665,1689,0]Aj[4622,13,4464,4464,5161,0]Aj[4622,13,4464,4464,3339,0]Aj[4622,13,4464,4464,3293,0]5Aj[4622,13,2098,3703,5077,0]Aj[4622,13,2098,4687,4628,0]Aj[4622,13,2098,4570,4042,0]Aj[4622,13,2098,4570,3320,0]Ai[4622,13,244,3786,3269,0]Ai[4622,13,244,4689,4629,0]:Aj[4622,13,4667,4667,3197,0]Aj[4622,13,4699,4699,4631,0]Aj[4622,14,2098,4570,3320,0]Aj[4622,12,4464,4818,4781,0]<Aj[4622,13,2098,4702,4632,0]Aj[4622,14,4574,4574,5160,0]Ai[4622,13,244,4480,5106,0]Aj[4622,13,4532,4481,5107,0]Ac[4622,7,4464,0,0,0]Ai[4622,13,244,3049,1945,0]Aj[4622,13,4532,3050,1946,0]Aj[4622,13,3371,3371,3195,0]Ac[4622,2,4623,0,0,0]1<1<1Aj[4664,13,4665,4665,4779,0]Aj[4664,13,4665,4665,1689,0]Aj[4622,13,4464,4818,4811,0]Aj[4622,13,4464,4818,4662,0]Aj[4622,13,4464,4464,5161,0]Aj[4622,13,4464,4464,3339,0]Aj[4622,13,4464,4464,3293,0]8Aj[4622,13,3371,3371,4084,0]Aj[4622,13,2098,3703,5077,0]Aj[4622,13,2098,4478,5079,0]Aj[4622,13,2098,4687,4628,0]Aj[4622,13,2098,4570,4092,0]Aj[4622,13,2098,4570,4042,0]Aj[4622,13,2098,4570,3320,0]Ai[4622,13,2098,4570,548,0]Aj[4622,13,2098,4702,4632,0]Ai[4622,13,239,4479,4802,0]Ai[4622,13,239,4479,5164,0]Ai[4622,13,239,4479,5092,0]Ai[4622,13,239,4479,5403,0]Ai[4622,13,239,2908,1799,0]Ai[4622,13,239,4546,3329,0]Ai[4622,13,239,4546,1916,0]Ai[4622,13,239,4546,3279,0]Ai[4622,13,239,4697,1847,0]Ai[4622,13,244,4480,5087,0]Ai[4622,13,244,4480,4078,0]Ai[4622,13,244,4480,5106,0]Ai[4622,13,244,3786,3269,0]Ai[4622,13,244,4689,4629,0]Ai[4622,13,244,3049,1834,0]Ai[4622,13,244,3049,3211,0]Ai[4622,13,244,3049,3258,0]Ai[4622,13,244,3049,1732,0]Ai[4622,13,244,3049,3289,0]Ai[4622,13,244,3049,1945,0]Ai[4622,13,244,3049,4035,0]Ah[4622,13,244,3049,698,0]Ai[4622,13,244,3049,1707,0]Ai[4622,13,244,3049,3313,0]Aj[4622,13,4532,3366,3196,0]Aj[4622,13,4532,4481,5088,0]Aj[4622,13,4532,4481,4079,0]Aj[4622,13,4532,4481,5107,0]Aj[4622,13,4532,4481,4803,0]Aj[4622,13,4532,4481,5165,0]Ai[4622,13,4532,234,3330,0]Ai[4622,13,4532,234,1917,0]Ai[4622,13,4532,234,4624,0]Ai[4622,13,4532,234,1848,0]Aj[4622,13,4532,3050,1946,0]Ai[4622,13,4532,3050,699,0]Aj[4622,13,4532,3050,1708,0]Aj[4622,13,4532,3050,3314,0]Aj[4622,13,4667,4667,1947,0]Ai[4622,13,4667,4667,700,0]Aj[4622,13,4667,4667,1709,0]Aj[4622,13,4667,4667,3315,0]Aj[4622,13,4667,4667,1814,0]Aj[4622,13,4667,4667,4810,0]Aj[4622,13,4667,4667,4661,0]Aj[4622,13,4667,4667,1819,0]Aj[4622,13,4667,4667,5089,0]Aj[4622,13,4667,4667,3197,0]Ah[4622,13,4699,4699,91,0]Aj[4622,13,4699,4699,4631,0]Aj[4622,13,4574,4574,4786,0]Aj[4622,13,4574,4574,5160,0]Aj[4622,13,4574,4574,4097,0]Ai[4622,13,244,3049,1945,0]Ah[4622,13,244,3049,698,0]Ag[4622,14,5402,0,5157,0]Ac[4664,5,4665,0,0,0]Ai[4622,15,239,4479,5403,0]Ag[4622,10,4464,4818,0,0]Ai[4622,15,244,4480,5106,0]Aj[4622,15,4532,4481,5107,0]Ac[4622,5,4574,0,0,0]Ai[4622,15,244,4480,5087,0]Aj[4622,15,4532,4481,5088,0]Aj[4622,15,4667,4667,5089,0]210Ae[4622,6,239,4479,0,0]Af[4622,6,4532,4481,0,0]Ai[4622,15,244,3049,1945,0]Ai[4622,17,244,3049,5159,0];Ad[4622,10,3371,0,0,0]Ac[4622,6,4667,0,0,0]Af[4622,6,4464,4818,0,0]<;Ai[4622,13,239,2908,1799,0]0Ai[4622,13,244,3049,1945,0]Aj[4622,13,4532,3050,1946,0]Aj[4622,12,4464,4818,4781,0]Aj[4622,13,3371,3371,3195,0]Aj[4622,13,4532,3366,3196,0]Aj[4622,13,4464,4818,4781,0]0Aj[4622,13,2098,4478,5079,0]4Aj[4622,13,4464,4464,3339,0]Aj[4622,14,2098,4570,3320,0]6Aj[4622,14,2098,4570,4042,0]Aj[4622,13,2098,3703,5077,0]Aj[4622,13,4464,4464,3293,0]1Aj[4622,13,2098,4687,4628,0]Ai[4622,13,244,3049,1834,0]Ai[4622,13,244,3049,3313,0]Aj[4622,13,4532,3050,3314,0]Aj[4622,13,4667,4667,3315,0]Ai[4622,13,244,3049,1945,0]?Ai[4622,13,239,4479,4802,0]Ai[4622,13,239,4479,5164,0]Aj[4622,13,4532,4481,4803,0]Aj[4622,13,4532,4481,5165,0]Ac[4622,7,4574,0,0,0]Aj[4622,12,3371,3371,4809,0]Aj[4622,13,2098,4478,5079,0]Ai[4622,12,244,4480,1906,0]Ai[4622,13,244,4480,5087,0]Ai[4622,13,244,4480,4078,0]De[4622,13,244,4480,5106,0,\"impl-Sink-for-TypeError%3C\'_,+\'_,+Core%3E\"]Fh[4622,13,244,4480,5106,0,\"impl-Relocate%3C\'a,+TypeError%3C\'a,+\'b,+T%3E%3E-for-TypeError%3C\'_,+\'b,+T%3E\"]<Ah[4622,13,244,3049,698,0]Ai[4622,13,244,3049,1707,0]Ai[4622,13,244,3049,3313,0]Aj[4622,12,4532,4481,1907,0]Aj[4622,13,4532,4481,5088,0]Aj[4622,13,4532,4481,4079,0]Cl[4622,13,4532,4481,5107,0,\"impl-Sink-for-TypeError%3C\'_%3E\"]Cc[4622,13,4532,4481,5107,0,\"impl-TypeError%3C\'a%3E\"]Aj[4622,13,4532,3050,1946,0]Ai[4622,13,4532,3050,699,0]Aj[4622,13,4532,3050,1708,0]Aj[4622,13,4532,3050,3314,0]Aj[4622,13,3371,3371,3195,0]Ai[4622,13,244,4480,5106,0]Aj[4622,13,4532,4481,5107,0]10Aj[4622,13,2098,4478,5079,0]21Ac[4622,7,4464,0,0,0]Ai[4622,13,244,3049,1945,0]9Aj[4664,13,4665,4665,4779,0]3Aj[4622,13,2098,4570,4042,0]Aj[4622,13,2098,4570,3320,0]Ai[4622,13,2098,4570,548,0]Ai[4622,13,239,4479,4802,0]Ai[4622,13,239,4479,5164,0]Ai[4622,13,239,4479,5092,0]Ai[4622,13,239,4479,5403,0]Ai[4622,13,239,2908,1799,0]Ai[4622,13,239,4546,3329,0]Ai[4622,13,239,4546,1916,0]Ai[4622,13,239,4546,3279,0]Ai[4622,13,239,4697,1847,0]Ai[4622,13,244,4480,5087,0]Ai[4622,13,244,4480,4078,0]Ai[4622,13,244,4480,5106,0]Ai[4622,13,244,3786,3269,0]Ai[4622,13,244,3049,1834,0]Ai[4622,13,244,3049,3211,0]Ai[4622,13,244,3049,3258,0]Ai[4622,13,244,3049,1732,0]Ai[4622,13,244,3049,3289,0]Ai[4622,13,244,3049,1945,0]Ah[4622,13,244,3049,698,0]Ai[4622,13,244,3049,1707,0]Ai[4622,13,244,3049,3313,0]Aj[4622,13,4532,4481,5088,0]Aj[4622,13,4532,4481,4079,0]Aj[4622,13,4532,4481,5107,0]Aj[4622,13,4532,4481,4803,0]Aj[4622,13,4532,4481,5165,0]Ai[4622,13,4532,234,3330,0]Ai[4622,13,4532,234,1917,0]Ai[4622,13,4532,234,4624,0]Ai[4622,13,4532,234,1848,0]Aj[4622,13,4532,3050,1946,0]Ai[4622,13,4532,3050,699,0]Aj[4622,13,4532,3050,1708,0]Aj[4622,13,4532,3050,3314,0]Aj[4622,13,4667,4667,1947,0]Ai[4622,13,4667,4667,700,0]Aj[4622,13,4667,4667,1709,0]Aj[4622,13,4667,4667,3315,0]Aj[4622,13,4667,4667,1814,0]Aj[4622,13,4667,4667,4810,0]Aj[4622,13,4667,4667,4661,0]Aj[4622,13,4667,4667,1819,0]Aj[4622,13,4667,4667,5089,0]Ah[4622,13,4699,4699,91,0]Aj[4622,13,4574,4574,5160,0]Aj[4664,13,4665,4665,4779,0]Aj[4664,13,4665,4665,1689,0]Aj[4622,13,4464,4818,4811,0]Aj[4622,13,4464,4818,4662,0]Aj[4622,13,4464,4464,5161,0]Aj[4622,13,4464,4464,3339,0]Aj[4622,13,4464,4464,3293,0]Aj[4622,13,3371,3371,3195,0]Aj[4622,13,3371,3371,4084,0]Aj[4622,13,2098,3703,5077,0]Aj[4622,13,2098,4478,5079,0]Aj[4622,13,2098,4687,4628,0]Aj[4622,13,2098,4570,4092,0]Aj[4622,13,2098,4570,4042,0]Aj[4622,13,2098,4570,3320,0]Ai[4622,13,2098,4570,548,0]Aj[4622,13,2098,4702,4632,0]Ai[4622,13,239,4479,4802,0]Ai[4622,13,239,4479,5164,0]Ai[4622,13,239,4479,5092,0]Ai[4622,13,239,4479,5403,0]Ai[4622,13,239,2908,1799,0]Ai[4622,13,239,4546,3329,0]Ai[4622,13,239,4546,1916,0]Ai[4622,13,239,4546,3279,0]Ai[4622,13,239,4697,1847,0]Ai[4622,13,244,4480,5087,0]Ai[4622,13,244,4480,4078,0]Ai[4622,13,244,4480,5106,0]Ai[4622,13,244,3786,3269,0]Ai[4622,13,244,4689,4629,0]Ai[4622,13,244,3049,1834,0]Ai[4622,13,244,3049,3211,0]Ai[4622,13,244,3049,3258,0]Ai[4622,13,244,3049,1732,0]Ai[4622,13,244,3049,3289,0]Ai[4622,13,244,3049,1945,0]Ai[4622,13,244,3049,4035,0]Ah[4622,13,244,3049,698,0]Ai[4622,13,244,3049,1707,0]Ai[4622,13,244,3049,3313,0]Aj[4622,13,4532,3366,3196,0]Aj[4622,13,4532,4481,5088,0]Aj[4622,13,4532,4481,4079,0]Aj[4622,13,4532,4481,5107,0]Aj[4622,13,4532,4481,4803,0]Aj[4622,13,4532,4481,5165,0]Ai[4622,13,4532,234,3330,0]Ai[4622,13,4532,234,1917,0]Ai[4622,13,4532,234,4624,0]Ai[4622,13,4532,234,1848,0]Aj[4622,13,4532,3050,1946,0]Ai[4622,13,4532,3050,699,0]Aj[4622,13,4532,3050,1708,0]Aj[4622,13,4532,3050,3314,0]Aj[4622,13,4667,4667,1947,0]Ai[4622,13,4667,4667,700,0]Aj[4622,13,4667,4667,1709,0]Aj[4622,13,4667,4667,3315,0]Aj[4622,13,4667,4667,1814,0]Aj[4622,13,4667,4667,4810,0]Aj[4622,13,4667,4667,4661,0]Aj[4622,13,4667,4667,1819,0]Aj[4622,13,4667,4667,5089,0]Aj[4622,13,4667,4667,3197,0]Ah[4622,13,4699,4699,91,0]Aj[4622,13,4699,4699,4631,0]Aj[4622,13,4574,4574,4786,0]Aj[4622,13,4574,4574,5160,0]Aj[4622,13,4574,4574,4097,0]Aj[4664,13,4665,4665,4779,0]Aj[4664,13,4665,4665,1689,0]Aj[4622,13,4464,4818,4811,0]Aj[4622,13,4464,4818,4662,0]Aj[4622,13,4464,4464,5161,0]Aj[4622,13,4464,4464,3339,0]Aj[4622,13,4464,4464,3293,0]Aj[4622,13,3371,3371,3195,0]Aj[4622,13,3371,3371,4084,0]Aj[4622,13,2098,3703,5077,0]Aj[4622,13,2098,4478,5079,0]Aj[4622,13,2098,4687,4628,0]Aj[4622,13,2098,4570,4092,0]Aj[4622,13,2098,4570,4042,0]Aj[4622,13,2098,4570,3320,0]Ai[4622,13,2098,4570,548,0]Aj[4622,13,2098,4702,4632,0]Ai[4622,13,239,4479,4802,0]Ai[4622,13,239,4479,5164,0]Ai[4622,13,239,4479,5092,0]Ai[4622,13,239,4479,5403,0]Ai[4622,13,239,2908,1799,0]Ai[4622,13,239,4546,3329,0]Ai[4622,13,239,4546,1916,0]Ai[4622,13,239,4546,3279,0]Ai[4622,13,239,4697,1847,0]Ai[4622,13,244,4480,5087,0]Ai[4622,13,244,4480,4078,0]Ai[4622,13,244,4480,5106,0]Ai[4622,13,244,3786,3269,0]Ai[4622,13,244,4689,4629,0]Ai[4622,13,244,3049,1834,0]Ai[4622,13,244,3049,3211,0]Ai[4622,13,244,3049,3258,0]Ai[4622,13,244,3049,1732,0]Ai[4622,13,244,3049,3289,0]Ai[4622,13,244,3049,1945,0]Ai[4622,13,244,3049,4035,0]Ah[4622,13,244,3049,698,0]Ai[4622,13,244,3049,1707,0]Ai[4622,13,244,3049,3313,0]Aj[4622,13,4532,3366,3196,0]Aj[4622,13,4532,4481,5088,0]Aj[4622,13,4532,4481,4079,0]Aj[4622,13,4532,4481,5107,0]Aj[4622,13,4532,4481,4803,0]Aj[4622,13,4532,4481,5165,0]Ai[4622,13,4532,234,3330,0]Ai[4622,13,4532,234,1917,0]Ai[4622,13,4532,234,4624,0]Ai[4622,13,4532,234,1848,0]Aj[4622,13,4532,3050,1946,0]Ai[4622,13,4532,3050,699,0]Aj[4622,13,4532,3050,1708,0]Aj[4622,13,4532,3050,3314,0]Aj[4622,13,4667,4667,1947,0]Ai[4622,13,4667,4667,700,0]Aj[4622,13,4667,4667,1709,0]Aj[4622,13,4667,4667,3315,0]Aj[4622,13,4667,4667,1814,0]Aj[4622,13,4667,4667,4810,0]Aj[4622,13,4667,4667,4661,0]Aj[4622,13,4667,4667,1819,0]Aj[4622,13,4667,4667,5089,0]Aj[4622,13,4667,4667,3197,0]Ah[4622,13,4699,4699,91,0]Aj[4622,13,4699,4699,4631,0]Aj[4622,13,4574,4574,4786,0]Aj[4622,13,4574,4574,5160,0]Aj[4622,13,4574,4574,4097,0]Aj[4622,12,4464,4818,4781,0]Ai[4622,13,244,4480,5087,0]Aj[4622,13,4532,4481,5088,0]2102Af[4622,5,2098,3703,0,0]Af[4622,6,2098,4478,0,0]Ai[4622,15,244,4480,5106,0]Aj[4622,15,4532,4481,5107,0]Ae[4622,6,244,4480,0,0]Af[4622,6,4532,4481,0,0]Ac[4622,6,4667,0,0,0]Ae[4622,6,239,4479,0,0]Ai[4622,15,239,4546,3329,0]Ai[4622,15,4532,234,3330,0]10Ai[4622,15,239,4479,5403,0]Ai[4622,15,244,3049,1945,0]Ai[4622,17,244,3049,5159,0]Ai[4622,15,244,4480,5087,0]Aj[4622,15,2098,4478,5079,0]:9Aj[4664,13,4665,4665,1689,0]Ai[4622,13,244,4480,5106,0]Aj[4622,13,4532,4481,5107,0]Aj[4622,12,4464,4818,4781,0]Ai[4622,13,244,4480,5087,0]Aj[4622,13,4532,4481,5088,0]210Aj[4622,14,2098,4570,3320,0]Ai[4622,13,239,4546,3279,0]Aj[4622,13,3371,3371,3195,0]05Aj[4622,13,4464,4818,4781,0]0Aj[4622,13,4464,4464,3339,0]Aj[4664,13,4665,4665,4779,0]Aj[4622,13,2098,4478,5079,0]Ai[4622,13,239,4479,4802,0]Ai[4622,13,239,4479,5164,0]Ai[4622,13,239,4479,5092,0]Ai[4622,13,239,4479,5403,0]Ai[4622,13,239,2908,1799,0]=Ai[4622,13,244,4480,4078,0]Ai[4622,13,244,4480,5106,0]Ai[4622,13,244,3049,1834,0]Ai[4622,13,244,3049,1945,0]Aj[4622,13,4532,4481,5088,0]Aj[4622,13,4532,4481,4079,0]Aj[4622,13,4532,4481,5107,0]Aj[4622,13,4532,4481,4803,0]Aj[4622,13,4532,4481,5165,0]Aj[4622,13,4532,3050,1946,0]Aj[4622,13,4667,4667,5089,0]Aj[4664,13,4665,4665,1689,0]Ac[4622,7,4464,0,0,0]93;6093Aj[4622,13,3371,3371,3195,0]Aj[4622,13,4532,3366,3196,0]Aj[4622,13,4667,4667,3197,0]Ai[4622,15,239,4479,5403,0]Af[4622,10,244,3049,0,0]Ac[4622,5,4574,0,0,0]Ac[4622,5,4464,0,0,0]Ae[4622,6,239,4479,0,0]Af[4622,6,4532,4481,0,0]Ai[4622,15,244,4480,5106,0]Aj[4622,15,4532,4481,5107,0]Ai[4622,15,239,4546,3329,0]Ai[4622,15,4532,234,3330,0]10>Aj[4664,13,4665,4665,4779,0]?Aj[4622,13,4464,4818,4811,0]Aj[4622,13,4464,4818,4662,0]Aj[4622,13,4464,4464,5161,0]Aj[4622,13,4464,4464,3339,0]Aj[4622,13,4464,4464,3293,0]Aj[4622,13,3371,3371,3195,0]Aj[4622,13,3371,3371,4084,0]Aj[4622,13,2098,3703,5077,0]Aj[4622,13,2098,4478,5079,0]Aj[4622,13,2098,4687,4628,0]Aj[4622,13,2098,4570,4092,0]Aj[4622,13,2098,4570,4042,0]Aj[4622,13,2098,4570,3320,0]Ai[4622,13,2098,4570,548,0]Aj[4622,13,2098,4702,4632,0]Ai[4622,13,239,4479,4802,0]Ai[4622,13,239,4479,5164,0]Ai[4622,13,239,4479,5092,0]Ai[4622,13,239,4479,5403,0]Ai[4622,13,239,2908,1799,0]Ai[4622,13,239,4546,3329,0]Ai[4622,13,239,4546,1916,0]Ai[4622,13,239,4546,3279,0]Ai[4622,13,239,4697,1847,0]Ai[4622,13,244,4480,5087,0]Ai[4622,13,244,4480,4078,0]Ai[4622,13,244,4480,5106,0]Ai[4622,13,244,3786,3269,0]Ai[4622,13,244,4689,4629,0]Ai[4622,13,244,3049,1834,0]Ai[4622,13,244,3049,3211,0]Ai[4622,13,244,3049,3258,0]Ai[4622,13,244,3049,1732,0]Ai[4622,13,244,3049,3289,0]Ai[4622,13,244,3049,1945,0]Ai[4622,13,244,3049,4035,0]Ah[4622,13,244,3049,698,0]Ai[4622,13,244,3049,1707,0]Ai[4622,13,244,3049,3313,0]Aj[4622,13,4532,3366,3196,0]Aj[4622,13,4532,4481,5088,0]Aj[4622,13,4532,4481,4079,0]Aj[4622,13,4532,4481,5107,0]Aj[4622,13,4532,4481,4803,0]Aj[4622,13,4532,4481,5165,0]Ai[4622,13,4532,234,3330,0]Ai[4622,13,4532,234,1917,0]Ai[4622,13,4532,234,4624,0]Ai[4622,13,4532,234,1848,0]Aj[4622,13,4532,3050,1946,0]Ai[4622,13,4532,3050,699,0]Aj[4622,13,4532,3050,1708,0]Aj[4622,13,4532,3050,3314,0]Aj[4622,13,4667,4667,1947,0]Ai[4622,13,4667,4667,700,0]Aj[4622,13,4667,4667,1709,0]Aj[4622,13,4667,4667,3315,0]Aj[4622,13,4667,4667,1814,0]Aj[4622,13,4667,4667,4810,0]Aj[4622,13,4667,4667,4661,0]Aj[4622,13,4667,4667,1819,0]Aj[4622,13,4667,4667,5089,0]Aj[4622,13,4667,4667,3197,0]Ah[4622,13,4699,4699,91,0]Aj[4622,13,4699,4699,4631,0]Aj[4622,13,4574,4574,4786,0]Aj[4622,13,4574,4574,5160,0]Aj[4622,13,4574,4574,4097,0]Aj[4622,13,3371,3371,3195,0]Aj[4622,13,4532,3366,3196,0]710Ai[4622,13,244,3049,1945,0]Aj[4622,13,4532,3050,1946,0]1Aj[4664,13,4665,4665,4779,0]Aj[4622,13,2098,4478,5079,0]Aj[4622,13,2098,4570,4042,0]Aj[4622,13,2098,4570,3320,0]Ai[4622,13,2098,4570,548,0]Ai[4622,13,239,4479,4802,0]Ai[4622,13,239,4479,5164,0]Ai[4622,13,239,4479,5092,0]Ai[4622,13,239,4479,5403,0]Ai[4622,13,239,2908,1799,0]Ai[4622,13,239,4546,3329,0]Ai[4622,13,239,4546,1916,0]Ai[4622,13,239,4546,3279,0]Ai[4622,13,239,4697,1847,0]Ai[4622,13,244,4480,5087,0]Ai[4622,13,244,4480,4078,0]Ai[4622,13,244,4480,5106,0]Ai[4622,13,244,3786,3269,0]Ai[4622,13,244,3049,1834,0]Ai[4622,13,244,3049,3211,0]Ai[4622,13,244,3049,3258,0]Ai[4622,13,244,3049,1732,0]Ai[4622,13,244,3049,3289,0]Ai[4622,13,244,3049,1945,0]Ah[4622,13,244,3049,698,0]Ai[4622,13,244,3049,1707,0]Ai[4622,13,244,3049,3313,0]Aj[4622,13,4532,4481,5088,0]Aj[4622,13,4532,4481,4079,0]Aj[4622,13,4532,4481,5107,0]Aj[4622,13,4532,4481,4803,0]Aj[4622,13,4532,4481,5165,0]Ai[4622,13,4532,234,3330,0]Ai[4622,13,4532,234,1917,0]Ai[4622,13,4532,234,4624,0]Ai[4622,13,4532,234,1848,0]Aj[4622,13,4532,3050,1946,0]Ai[4622,13,4532,3050,699,0]Aj[4622,13,4532,3050,1708,0]Aj[4622,13,4532,3050,3314,0]Aj[4622,13,4667,4667,1947,0]Ai[4622,13,4667,4667,700,0]Aj[4622,13,4667,4667,1709,0]Aj[4622,13,4667,4667,3315,0]Aj[4622,13,4667,4667,1814,0]Aj[4622,13,4667,4667,4810,0]Aj[4622,13,4667,4667,4661,0]Aj[4622,13,4667,4667,1819,0]Aj[4622,13,4667,4667,5089,0]Ah[4622,13,4699,4699,91,0]Aj[4622,13,4574,4574,5160,0]Aj[4622,13,3371,3371,3195,0]Aj[4622,13,4532,3366,3196,0]Aj[4622,13,4667,4667,3197,0]Ah[4622,13,244,3049,698,0]Ai[4622,13,244,3049,1945,0]Aj[4622,13,4532,3050,1946,0]1555554535543Ai[4622,13,239,4479,4802,0]Ai[4622,13,239,4479,5164,0]Ai[4622,13,239,4479,5092,0]Aj[4622,13,4532,4481,4803,0]Aj[4622,13,4532,4481,5165,0]Ai[4622,15,244,4480,5106,0]Aj[4622,15,4532,4481,5107,0]Ai[4622,15,239,4546,3329,0]Ai[4622,15,4532,234,3330,0]Ai[4622,15,244,4480,5087,0]Aj[4622,15,4532,4481,5088,0]Aj[4622,15,2098,4478,5079,0]65>Aj[4622,13,3371,3371,3195,0]Aj[4622,13,4532,3366,3196,0]Aj[4622,13,4667,4667,3197,0]2Ai[4622,13,244,3049,3313,0]Aj[4622,13,2098,3703,5077,0]4Ai[4622,13,244,4480,5087,0]Ai[4622,13,239,4697,1847,0]Ai[4622,13,244,3049,1834,0]Ai[4622,13,4532,234,1848,0]Ah[4622,13,4699,4699,91,0]Ai[4622,13,244,4480,5106,0]Aj[4622,13,4532,4481,5107,0]Aj[4622,13,4699,4699,4631,0]:<Ai[4622,15,239,4546,3329,0]Ai[4622,15,4532,234,3330,0]Ai[4622,15,244,4480,5106,0]Aj[4622,15,4532,4481,5107,0]10Aj[4622,15,2098,4478,5079,0]Aj[4664,13,4665,4665,1689,0]87?Aj[4622,13,3371,3371,3195,0]00Aj[4622,13,4532,3366,3196,0]Aj[4622,13,4464,4818,4781,0]0002Ac[4622,7,4574,0,0,0]32Aj[4622,13,2098,4478,5079,0]=<Ai[4622,13,239,4479,5164,0]Aj[4622,13,4532,4481,5165,0]6=:9Ae[4622,6,239,4479,0,0]Ai[4622,15,239,4479,4802,0]Ai[4622,15,239,4479,5164,0]Ai[4622,15,239,4479,5092,0]Ai[4622,15,239,4479,5403,0]Aj[4622,15,4532,4481,4803,0]Aj[4622,15,4532,4481,5165,0]2Aj[4622,13,2098,4702,4632,0]Aj[4622,13,4574,4574,4786,0]Aj[4622,13,4464,4464,5161,0]Ai[4622,13,244,3049,3313,0]Aj[4622,13,3371,3371,3195,0]0Ai[4622,13,244,4480,5087,0]Aj[4622,13,4532,4481,5088,0]22Aj[4622,13,4532,3366,3196,0]30333Ai[4622,13,244,4480,5106,0]Aj[4622,13,4532,4481,5107,0]10Aj[4622,13,2098,4478,5079,0]Aj[4664,13,4665,4665,1689,0]Ac[4622,7,4574,0,0,0]Ai[4622,15,244,4480,5106,0]Aj[4622,15,4532,4481,5107,0]Ai[4622,15,239,4479,5164,0]Aj[4622,15,4532,4481,5165,0]Ai[4622,15,239,4479,4802,0]Ai[4622,15,239,4479,5092,0]Aj[4622,15,4532,4481,4803,0]8?<?<?<Aj[4622,14,2098,4570,3320,0]76549Aj[4664,13,4665,4665,4779,0];Aj[4622,13,2098,4570,4042,0]Aj[4622,13,2098,4570,3320,0]Ai[4622,13,2098,4570,548,0]Ai[4622,13,239,4479,4802,0]Ai[4622,13,239,4479,5164,0]Ai[4622,13,239,4479,5092,0]Ai[4622,13,239,4479,5403,0]Ai[4622,13,239,2908,1799,0]Ai[4622,13,239,4546,3329,0]Ai[4622,13,239,4546,1916,0]Ai[4622,13,239,4546,3279,0]Ai[4622,13,239,4697,1847,0]Ai[4622,13,244,4480,5087,0]Ai[4622,13,244,4480,4078,0]Ai[4622,13,244,4480,5106,0]Ai[4622,13,244,3786,3269,0]Ai[4622,13,244,3049,1834,0]Ai[4622,13,244,3049,3211,0]Ai[4622,13,244,3049,3258,0]Ai[4622,13,244,3049,1732,0]Ai[4622,13,244,3049,3289,0]Ai[4622,13,244,3049,1945,0]Ah[4622,13,244,3049,698,0]Ai[4622,13,244,3049,1707,0]Ai[4622,13,244,3049,3313,0]Aj[4622,13,4532,4481,5088,0]Aj[4622,13,4532,4481,4079,0]Aj[4622,13,4532,4481,5107,0]Aj[4622,13,4532,4481,4803,0]Aj[4622,13,4532,4481,5165,0]Ai[4622,13,4532,234,3330,0]Ai[4622,13,4532,234,1917,0]Ai[4622,13,4532,234,4624,0]Ai[4622,13,4532,234,1848,0]Aj[4622,13,4532,3050,1946,0]Ai[4622,13,4532,3050,699,0]Aj[4622,13,4532,3050,1708,0]Aj[4622,13,4532,3050,3314,0]Aj[4622,13,4667,4667,1947,0]Ai[4622,13,4667,4667,700,0]Aj[4622,13,4667,4667,1709,0]Aj[4622,13,4667,4667,3315,0]Aj[4622,13,4667,4667,1814,0]Aj[4622,13,4667,4667,4810,0]Aj[4622,13,4667,4667,4661,0]Aj[4622,13,4667,4667,1819,0]Aj[4622,13,4667,4667,5089,0]Ah[4622,13,4699,4699,91,0]Aj[4622,13,4574,4574,5160,0]Aj[4622,13,3371,3371,3195,0]0Aj[4622,13,4532,3366,3196,0]Ai[4622,13,244,4480,5106,0]Aj[4622,13,4532,4481,5107,0]Af[4622,18,239,4878,0,0]Ai[4622,15,244,4480,5106,0]Aj[4664,13,4665,4665,1689,0]065Aj[4622,13,4699,4699,4631,0]Ai[4622,13,244,3049,1945,0]652Ad[4622,18,4574,0,0,0]3Ai[4622,13,244,3049,1834,0]087Aj[4622,12,4464,4818,4781,0];:119;55555")
\ No newline at end of file
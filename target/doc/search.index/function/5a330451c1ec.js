@@ -0,0 +1 @@
+rd_("Aa[\"{BDEbAOEb}\",[]]Aa[\"{BDEnAOEb}\",[]]Aa[\"{BDCjAOEb}\",[]]Aa[\"{BDDfAOEb}\",[]]Aa[\"{BDEdAOEb}\",[]]Aa[\"{BDF`AOEb}\",[]]Aa[\"{BDClAOEb}\",[]]Aa[\"{BDDhAOEb}\",[]]A`[\"{BDEfLHj}\",[]]A`[\"{BDFbLHj}\",[]]9876543210987654321098765432109876543210A`[\"{BJHhOMl}\",[]]A`[\"{BJHjOMl}\",[]]A`[\"{BJHfOMl}\",[]]21021021021Bf[\"{{{BH@h{BEEf}}{BH@h{BEEf}}}OMj}\",[]]Bd[\"{{{BH@h{DDh}}{BH@h{DDh}}}OMj}\",[]]Bf[\"{{{BH@h{AJ@b}}{BH@h{AJ@b}}}OMj}\",[]]Bd[\"{{{BH@h{NFn}}{BH@h{NFn}}}OMj}\",[]]Bd[\"{{{BH@h{NEd}}{BH@h{NEd}}}OMj}\",[]]Bf[\"{{{BH@h{AJ@d}}{BH@h{AJ@d}}}OMj}\",[]]Bd[\"{{{BH@h{NG`}}{BH@h{NG`}}}OMj}\",[]]Bd[\"{{{BH@h{OCf}}{BH@h{OCf}}}OMj}\",[]]Bd[\"{{{BH@h{EGh}}{BH@h{EGh}}}OMj}\",[]]Bd[\"{{{BH@h{MEj}}{BH@h{MEj}}}OMj}\",[]]Bf[\"{{{BH@h{AINf}}{BH@h{AINf}}}OMj}\",[]]Bd[\"{{{BH@h{NBl}}{BH@h{NBl}}}OMj}\",[]]Bd[\"{{{BH@h{NCf}}{BH@h{NCf}}}OMj}\",[]]Bb[\"{{{BH@h{Kf}}{BH@h{Kf}}}OMj}\",[]]<Bd[\"{{{BH@h{N@n}}{BH@h{N@n}}}OMj}\",[]]<;:987654321Bf[\"{{{BH@h{BHE`}}{BH@h{BHE`}}}OMj}\",[]]>1=<;:987654320>1=<;:987654320>1=<;:987654320Aa[\"{BIOjAOEb}\",[]]0000Aa[\"{BEFfAOEb}\",[]]Aa[\"{BEElAOEb}\",[]]Aa[\"{BEFhAOEb}\",[]]Aa[\"{BEEnAOEb}\",[]]A`[\"{BEFjLHj}\",[]]43210432104321043210Aa[\"{BJJbAOEb}\",[]]Aa[\"{BJJdAOEb}\",[]]10101010Aa[\"{AOKdAOEb}\",[]]Aa[\"{AOKfAOEb}\",[]]10101010Aa[\"{BIKdAOMl}\",[]]Aa[\"{BDDbAOMl}\",[]]A`[\"{AOHfEGd}\",[]]Aa[\"{BDCjAOMl}\",[]]Aa[\"{BDDfAOMl}\",[]]Aa[\"{BINjAOMl}\",[]]Aa[\"{BHElAOMl}\",[]]Aa[\"{BIKfAOMl}\",[]]Aa[\"{BJBlAOMl}\",[]]Aa[\"{BJGfAOMl}\",[]]Aa[\"{BIObAOMl}\",[]]Aa[\"{BDClAOMn}\",[]]Aa[\"{BDDhAOMn}\",[]]Aa[\"{BINlAOMn}\",[]]Aa[\"{BHEnAOMn}\",[]]Aa[\"{BIKhAOMn}\",[]]Aa[\"{BJBnAOMn}\",[]]Aa[\"{BJGhAOMn}\",[]]Aa[\"{BIOdAOMn}\",[]]Aa[\"{BIKdAOMl}\",[]]Aa[\"{BDDbAOMl}\",[]]A`[\"{AOHfEGd}\",[]]Aa[\"{BDCjAOMl}\",[]]Aa[\"{BDDfAOMl}\",[]]Aa[\"{BINjAOMl}\",[]]Aa[\"{BHElAOMl}\",[]]Aa[\"{BIKfAOMl}\",[]]Aa[\"{BJBlAOMl}\",[]]Aa[\"{BJGfAOMl}\",[]]Aa[\"{BIObAOMl}\",[]]Aa[\"{BDClAOMn}\",[]]Aa[\"{BDDhAOMn}\",[]]Aa[\"{BINlAOMn}\",[]]Aa[\"{BHEnAOMn}\",[]]Aa[\"{BIKhAOMn}\",[]]Aa[\"{BJBnAOMn}\",[]]Aa[\"{BJGhAOMn}\",[]]Aa[\"{BIOdAOMn}\",[]]Aa[\"{BIKdAOMl}\",[]]Aa[\"{BDDbAOMl}\",[]]A`[\"{AOHfEGd}\",[]]Aa[\"{BDCjAOMl}\",[]]Aa[\"{BDDfAOMl}\",[]]Aa[\"{BINjAOMl}\",[]]Aa[\"{BHElAOMl}\",[]]Aa[\"{BIKfAOMl}\",[]]Aa[\"{BJBlAOMl}\",[]]Aa[\"{BJGfAOMl}\",[]]Aa[\"{BIObAOMl}\",[]]Aa[\"{BDClAOMn}\",[]]Aa[\"{BDDhAOMn}\",[]]Aa[\"{BINlAOMn}\",[]]Aa[\"{BHEnAOMn}\",[]]Aa[\"{BIKhAOMn}\",[]]Aa[\"{BJBnAOMn}\",[]]Aa[\"{BJGhAOMn}\",[]]Aa[\"{BIOdAOMn}\",[]]Aa[\"{BIKdAOMl}\",[]]Aa[\"{BDDbAOMl}\",[]]A`[\"{AOHfEGd}\",[]]Aa[\"{BDCjAOMl}\",[]]Aa[\"{BDDfAOMl}\",[]]Aa[\"{BINjAOMl}\",[]]Aa[\"{BHElAOMl}\",[]]Aa[\"{BIKfAOMl}\",[]]Aa[\"{BJBlAOMl}\",[]]Aa[\"{BJGfAOMl}\",[]]Aa[\"{BIObAOMl}\",[]]Aa[\"{BDClAOMn}\",[]]Aa[\"{BDDhAOMn}\",[]]Aa[\"{BINlAOMn}\",[]]Aa[\"{BHEnAOMn}\",[]]Aa[\"{BIKhAOMn}\",[]]Aa[\"{BJBnAOMn}\",[]]Aa[\"{BJGhAOMn}\",[]]Aa[\"{BIOdAOMn}\",[]]Aa[\"{BIKdAOMl}\",[]]Aa[\"{BDDbAOMl}\",[]]A`[\"{AOHfEGd}\",[]]Aa[\"{BDCjAOMl}\",[]]Aa[\"{BDDfAOMl}\",[]]Aa[\"{BINjAOMl}\",[]]Aa[\"{BHElAOMl}\",[]]Aa[\"{BIKfAOMl}\",[]]Aa[\"{BJBlAOMl}\",[]]Aa[\"{BJGfAOMl}\",[]]Aa[\"{BIObAOMl}\",[]]Aa[\"{BDClAOMn}\",[]]Aa[\"{BDDhAOMn}\",[]]Aa[\"{BINlAOMn}\",[]]Aa[\"{BHEnAOMn}\",[]]Aa[\"{BIKhAOMn}\",[]]Aa[\"{BJBnAOMn}\",[]]Aa[\"{BJGhAOMn}\",[]]Aa[\"{BIOdAOMn}\",[]]Ao[\"{{{BH@h{AJAf}}AOEb}AHJd}\",[]]000Ca[\"{{EGdEGdOMj{BH@h{AHOf}}}{{AONl{EGdBGKn}}}}\",[]]Io[\"{{cAOEbi{BH@h{k}}}{{AONl{cg}}}{}{}{}{{AIGf{AOEb}{{AOKb{{AONl{{AOE`{ce}}g}}}}}}}{}}\",[\"Calculus::Val\",\"Calculus::Dot\",\"Calculus::Error\",\"\",\"Calculus::Arena\"]]1010101Be[\"{{{BH@h{NFn}}{BH@h{NFn}}}BEHl}\",[]]Be[\"{{{BH@h{NEd}}{BH@h{NEd}}}BEHl}\",[]]Be[\"{{{BH@h{NG`}}{BH@h{NG`}}}BEHl}\",[]]Bc[\"{{{BH@h{Kf}}{BH@h{Kf}}}BEHl}\",[]]3210321032103210A`[\"{NOhAOEb}\",[]]Aa[\"{BJGnAOEb}\",[]]Aa[\"{BJJjAOEb}\",[]]A`[\"{NOjAOEb}\",[]]Aa[\"{BJH`AOEb}\",[]]Aa[\"{BJJlAOEb}\",[]]5Aa[\"{AOIfAOEb}\",[]]54321Aa[\"{BHE`AOEb}\",[]]716543207165432071654320A`[\"{MEfAINb}\",[]]A`[\"{MEhAINd}\",[]]10101010Aa[\"{BGMlBGNd}\",[]]A`[\"{DG`BEHd}\",[]]Aa[\"{BEHnB@@d}\",[]]Aa[\"{BGKbBGKn}\",[]]Aa[\"{BGKfBGL`}\",[]]A`[\"{DGbBEHf}\",[]]543210543210543210543210Aa[\"{BJJbAOEb}\",[]]Aa[\"{BJJdAOEb}\",[]]10101010Aa[\"{BIObAOMl}\",[]]Aa[\"{BIOdAOMn}\",[]]10101010Bj[\"{{{BH@h{BEEf}}{BH@h{KEhBGLd}}}AONj}\",[]]0Bi[\"{{{BH@h{MCb}}{BH@h{KEhBGLd}}}AONj}\",[]]Bj[\"{{{BH@h{BHEb}}{BH@h{KEhBGLd}}}AONj}\",[]]Bj[\"{{{BH@h{AHOf}}{BH@h{KEhBGLd}}}AONj}\",[]]Bj[\"{{{BH@h{AONh}}{BH@h{KEhBGLd}}}AONj}\",[]]Cf[\"{{{BH@h{{BGJj{c}}}}{BH@h{KEhBGLd}}}AONjAIBn}\",[\"T\"]]Bj[\"{{{BH@h{BGJn}}{BH@h{KEhBGLd}}}AONj}\",[]]0Bj[\"{{{BH@h{BDBh}}{BH@h{KEhBGLd}}}AONj}\",[]]Bj[\"{{{BH@h{AOOh}}{BH@h{KEhBGLd}}}AONj}\",[]]Bj[\"{{{BH@h{AOId}}{BH@h{KEhBGLd}}}AONj}\",[]]Bj[\"{{{BH@h{AIO`}}{BH@h{KEhBGLd}}}AONj}\",[]]Bi[\"{{{BH@h{DDh}}{BH@h{KEhBGLd}}}AONj}\",[]]Bj[\"{{{BH@h{BDC`}}{BH@h{KEhBGLd}}}AONj}\",[]]Bj[\"{{{BH@h{BEHd}}{BH@h{KEhBGLd}}}AONj}\",[]]0Bj[\"{{{BH@h{BHEh}}{BH@h{KEhBGLd}}}AONj}\",[]]0Bj[\"{{{BH@h{BJCf}}{BH@h{KEhBGLd}}}AONj}\",[]]0Bj[\"{{{BH@h{AJ@b}}{BH@h{KEhBGLd}}}AONj}\",[]]Bi[\"{{{BH@h{NOh}}{BH@h{KEhBGLd}}}AONj}\",[]]Bj[\"{{{BH@h{AIIn}}{BH@h{KEhBGLd}}}AONj}\",[]]Bi[\"{{{BH@h{NFn}}{BH@h{KEhBGLd}}}AONj}\",[]]Bj[\"{{{BH@h{BGKn}}{BH@h{KEhBGLd}}}AONj}\",[]]0Bj[\"{{{BH@h{AOMl}}{BH@h{KEhBGLd}}}AONj}\",[]]0Cl[\"{{{BH@h{{BGNd{c}}}}{BH@h{KEhBGLd}}}AONj{AIBnBHDn}}\",[\"T\"]]Cf[\"{{{BH@h{{BGNd{c}}}}{BH@h{KEhBGLd}}}AONjBHDn}\",[\"T\"]]Bj[\"{{{BH@h{AIHj}}{BH@h{KEhBGLd}}}AONj}\",[]]Bj[\"{{{BH@h{BDBj}}{BH@h{KEhBGLd}}}AONj}\",[]]Bi[\"{{{BH@h{NEd}}{BH@h{KEhBGLd}}}AONj}\",[]]0Bj[\"{{{BH@h{AIAf}}{BH@h{KEhBGLd}}}AONj}\",[]]Bj[\"{{{BH@h{AIGd}}{BH@h{KEhBGLd}}}AONj}\",[]]Bi[\"{{{BH@h{MHh}}{BH@h{KEhBGLd}}}AONj}\",[]]Bj[\"{{{BH@h{AIKb}}{BH@h{KEhBGLd}}}AONj}\",[]]Ce[\"{{{BH@h{{OCb{c}}}}{BH@h{KEhBGLd}}}AONjBHDn}\",[\"T\"]]Ck[\"{{{BH@h{{OCb{c}}}}{BH@h{KEhBGLd}}}AONj{AIBnBHDn}}\",[\"T\"]]Bj[\"{{{BH@h{AOHf}}{BH@h{KEhBGLd}}}AONj}\",[]]Bi[\"{{{BH@h{EGd}}{BH@h{KEhBGLd}}}AONj}\",[]]Bi[\"{{{BH@h{MEf}}{BH@h{KEhBGLd}}}AONj}\",[]]Bj[\"{{{BH@h{AINb}}{BH@h{KEhBGLd}}}AONj}\",[]]Bj[\"{{{BH@h{AHOh}}{BH@h{KEhBGLd}}}AONj}\",[]]Bj[\"{{{BH@h{BGL`}}{BH@h{KEhBGLd}}}AONj}\",[]]0Bj[\"{{{BH@h{AOMn}}{BH@h{KEhBGLd}}}AONj}\",[]]0Bj[\"{{{BH@h{BGNf}}{BH@h{KEhBGLd}}}AONj}\",[]]0Bj[\"{{{BH@h{BEHf}}{BH@h{KEhBGLd}}}AONj}\",[]]0Bj[\"{{{BH@h{BHEj}}{BH@h{KEhBGLd}}}AONj}\",[]]0Bj[\"{{{BH@h{AJ@d}}{BH@h{KEhBGLd}}}AONj}\",[]]Bi[\"{{{BH@h{NOj}}{BH@h{KEhBGLd}}}AONj}\",[]]Bj[\"{{{BH@h{BDB`}}{BH@h{KEhBGLd}}}AONj}\",[]]Bi[\"{{{BH@h{NG`}}{BH@h{KEhBGLd}}}AONj}\",[]]Bi[\"{{{BH@h{OCd}}{BH@h{KEhBGLd}}}AONj}\",[]]0Bi[\"{{{BH@h{EGf}}{BH@h{KEhBGLd}}}AONj}\",[]]Bi[\"{{{BH@h{MEh}}{BH@h{KEhBGLd}}}AONj}\",[]]Bj[\"{{{BH@h{AINd}}{BH@h{KEhBGLd}}}AONj}\",[]]Bi[\"{{{BH@h{OCf}}{BH@h{KEhBGLd}}}AONj}\",[]]Bi[\"{{{BH@h{EGh}}{BH@h{KEhBGLd}}}AONj}\",[]]Bi[\"{{{BH@h{MEj}}{BH@h{KEhBGLd}}}AONj}\",[]]Bj[\"{{{BH@h{AINf}}{BH@h{KEhBGLd}}}AONj}\",[]]Bi[\"{{{BH@h{NBl}}{BH@h{KEhBGLd}}}AONj}\",[]]Bj[\"{{{BH@h{BEId}}{BH@h{KEhBGLd}}}AONj}\",[]]Bj[\"{{{BH@h{BDFj}}{BH@h{KEhBGLd}}}AONj}\",[]]Bi[\"{{{BH@h{NCf}}{BH@h{KEhBGLd}}}AONj}\",[]]Bj[\"{{{BH@h{BGLb}}{BH@h{KEhBGLd}}}AONj}\",[]]0Bj[\"{{{BH@h{AHOj}}{BH@h{KEhBGLd}}}AONj}\",[]]Bh[\"{{{BH@h{Kf}}{BH@h{KEhBGLd}}}AONj}\",[]]Bj[\"{{{BH@h{BDBn}}{BH@h{KEhBGLd}}}AONj}\",[]]Bj[\"{{{BH@h{BHEb}}{BH@h{KEhBGLd}}}AONj}\",[]]Bj[\"{{{BH@h{AJAf}}{BH@h{KEhBGLd}}}AONj}\",[]]Cf[\"{{{BH@h{{AIKj{c}}}}{BH@h{KEhBGLd}}}AONjAIBn}\",[\"T\"]]Bj[\"{{{BH@h{AHOf}}{BH@h{KEhBGLd}}}AONj}\",[]]Bj[\"{{{BH@h{AONh}}{BH@h{KEhBGLd}}}AONj}\",[]]Cf[\"{{{BH@h{{BGJj{c}}}}{BH@h{KEhBGLd}}}AONjAIBn}\",[\"T\"]]Bj[\"{{{BH@h{BGJn}}{BH@h{KEhBGLd}}}AONj}\",[]]0Bj[\"{{{BH@h{BDBh}}{BH@h{KEhBGLd}}}AONj}\",[]]Bj[\"{{{BH@h{AOOh}}{BH@h{KEhBGLd}}}AONj}\",[]]Bj[\"{{{BH@h{AOId}}{BH@h{KEhBGLd}}}AONj}\",[]]Bj[\"{{{BH@h{AIO`}}{BH@h{KEhBGLd}}}AONj}\",[]]Bi[\"{{{BH@h{DDh}}{BH@h{KEhBGLd}}}AONj}\",[]]Bj[\"{{{BH@h{BDC`}}{BH@h{KEhBGLd}}}AONj}\",[]]Bj[\"{{{BH@h{BEHd}}{BH@h{KEhBGLd}}}AONj}\",[]]0Bj[\"{{{BH@h{BHEh}}{BH@h{KEhBGLd}}}AONj}\",[]]0Bj[\"{{{BH@h{BGLh}}{BH@h{KEhBGLd}}}AONj}\",[]]0Bj[\"{{{BH@h{BJCf}}{BH@h{KEhBGLd}}}AONj}\",[]]0Bi[\"{{{BH@h{N@n}}{BH@h{KEhBGLd}}}AONj}\",[]]0Bj[\"{{{BH@h{AJ@b}}{BH@h{KEhBGLd}}}AONj}\",[]]Bi[\"{{{BH@h{NOh}}{BH@h{KEhBGLd}}}AONj}\",[]]Bj[\"{{{BH@h{AIIn}}{BH@h{KEhBGLd}}}AONj}\",[]]Bi[\"{{{BH@h{NFn}}{BH@h{KEhBGLd}}}AONj}\",[]]Bj[\"{{{BH@h{BGKn}}{BH@h{KEhBGLd}}}AONj}\",[]]0Bj[\"{{{BH@h{AOMl}}{BH@h{KEhBGLd}}}AONj}\",[]]0Cf[\"{{{BH@h{{BGNd{c}}}}{BH@h{KEhBGLd}}}AONjBHDn}\",[\"T\"]]Cl[\"{{{BH@h{{BGNd{c}}}}{BH@h{KEhBGLd}}}AONj{AIBnBHDn}}\",[\"T\"]]Bj[\"{{{BH@h{AIHj}}{BH@h{KEhBGLd}}}AONj}\",[]]Bj[\"{{{BH@h{BDBj}}{BH@h{KEhBGLd}}}AONj}\",[]]Bi[\"{{{BH@h{NEd}}{BH@h{KEhBGLd}}}AONj}\",[]]0Bj[\"{{{BH@h{AIAf}}{BH@h{KEhBGLd}}}AONj}\",[]]Bj[\"{{{BH@h{AIGd}}{BH@h{KEhBGLd}}}AONj}\",[]]Bi[\"{{{BH@h{MHh}}{BH@h{KEhBGLd}}}AONj}\",[]]Bj[\"{{{BH@h{AIKb}}{BH@h{KEhBGLd}}}AONj}\",[]]Ce[\"{{{BH@h{{OCb{c}}}}{BH@h{KEhBGLd}}}AONjBHDn}\",[\"T\"]]Ck[\"{{{BH@h{{OCb{c}}}}{BH@h{KEhBGLd}}}AONj{AIBnBHDn}}\",[\"T\"]]Bj[\"{{{BH@h{AOHf}}{BH@h{KEhBGLd}}}AONj}\",[]]Bi[\"{{{BH@h{EGd}}{BH@h{KEhBGLd}}}AONj}\",[]]Bi[\"{{{BH@h{MEf}}{BH@h{KEhBGLd}}}AONj}\",[]]Bj[\"{{{BH@h{AINb}}{BH@h{KEhBGLd}}}AONj}\",[]]Bj[\"{{{BH@h{AHOh}}{BH@h{KEhBGLd}}}AONj}\",[]]Bj[\"{{{BH@h{BGL`}}{BH@h{KEhBGLd}}}AONj}\",[]]0Bj[\"{{{BH@h{AOMn}}{BH@h{KEhBGLd}}}AONj}\",[]]0Bj[\"{{{BH@h{BGNf}}{BH@h{KEhBGLd}}}AONj}\",[]]0Bj[\"{{{BH@h{BEHf}}{BH@h{KEhBGLd}}}AONj}\",[]]0Bj[\"{{{BH@h{BHEj}}{BH@h{KEhBGLd}}}AONj}\",[]]0Bj[\"{{{BH@h{AJ@d}}{BH@h{KEhBGLd}}}AONj}\",[]]Bi[\"{{{BH@h{NOj}}{BH@h{KEhBGLd}}}AONj}\",[]]Bj[\"{{{BH@h{BDB`}}{BH@h{KEhBGLd}}}AONj}\",[]]Bi[\"{{{BH@h{NG`}}{BH@h{KEhBGLd}}}AONj}\",[]]Bi[\"{{{BH@h{OCd}}{BH@h{KEhBGLd}}}AONj}\",[]]0Bi[\"{{{BH@h{EGf}}{BH@h{KEhBGLd}}}AONj}\",[]]Bi[\"{{{BH@h{MEh}}{BH@h{KEhBGLd}}}AONj}\",[]]Bj[\"{{{BH@h{AINd}}{BH@h{KEhBGLd}}}AONj}\",[]]Bi[\"{{{BH@h{OCf}}{BH@h{KEhBGLd}}}AONj}\",[]]Bi[\"{{{BH@h{EGh}}{BH@h{KEhBGLd}}}AONj}\",[]]Bi[\"{{{BH@h{MEj}}{BH@h{KEhBGLd}}}AONj}\",[]]Bj[\"{{{BH@h{AINf}}{BH@h{KEhBGLd}}}AONj}\",[]]Bi[\"{{{BH@h{NBl}}{BH@h{KEhBGLd}}}AONj}\",[]]Bj[\"{{{BH@h{BEId}}{BH@h{KEhBGLd}}}AONj}\",[]]Bj[\"{{{BH@h{BDFj}}{BH@h{KEhBGLd}}}AONj}\",[]]Bi[\"{{{BH@h{NCf}}{BH@h{KEhBGLd}}}AONj}\",[]]Bj[\"{{{BH@h{BGLb}}{BH@h{KEhBGLd}}}AONj}\",[]]0Bj[\"{{{BH@h{AHOj}}{BH@h{KEhBGLd}}}AONj}\",[]]Bh[\"{{{BH@h{Kf}}{BH@h{KEhBGLd}}}AONj}\",[]]Bj[\"{{{BH@h{BDBn}}{BH@h{KEhBGLd}}}AONj}\",[]]Bj[\"{{{BH@h{BEFd}}{BH@h{KEhBGLd}}}AONj}\",[]]Bj[\"{{{BH@h{BHE`}}{BH@h{KEhBGLd}}}AONj}\",[]]Bj[\"{{{BH@h{B@@b}}{BH@h{KEhBGLd}}}AONj}\",[]]Bj[\"{{{BH@h{BHEb}}{BH@h{KEhBGLd}}}AONj}\",[]]Bj[\"{{{BH@h{AJAf}}{BH@h{KEhBGLd}}}AONj}\",[]]Cf[\"{{{BH@h{{AIKj{c}}}}{BH@h{KEhBGLd}}}AONjAIBn}\",[\"T\"]]Bj[\"{{{BH@h{AHOf}}{BH@h{KEhBGLd}}}AONj}\",[]]Bj[\"{{{BH@h{AONh}}{BH@h{KEhBGLd}}}AONj}\",[]]Cf[\"{{{BH@h{{BGJj{c}}}}{BH@h{KEhBGLd}}}AONjAIBn}\",[\"T\"]]Bj[\"{{{BH@h{BGJn}}{BH@h{KEhBGLd}}}AONj}\",[]]0Bj[\"{{{BH@h{BDBh}}{BH@h{KEhBGLd}}}AONj}\",[]]Bj[\"{{{BH@h{AOOh}}{BH@h{KEhBGLd}}}AONj}\",[]]Bj[\"{{{BH@h{AOId}}{BH@h{KEhBGLd}}}AONj}\",[]]Bj[\"{{{BH@h{AIO`}}{BH@h{KEhBGLd}}}AONj}\",[]]Bi[\"{{{BH@h{DDh}}{BH@h{KEhBGLd}}}AONj}\",[]]Bj[\"{{{BH@h{BDC`}}{BH@h{KEhBGLd}}}AONj}\",[]]Bj[\"{{{BH@h{BEHd}}{BH@h{KEhBGLd}}}AONj}\",[]]0Bj[\"{{{BH@h{BHEh}}{BH@h{KEhBGLd}}}AONj}\",[]]0Bj[\"{{{BH@h{BGLh}}{BH@h{KEhBGLd}}}AONj}\",[]]0Bj[\"{{{BH@h{BJCf}}{BH@h{KEhBGLd}}}AONj}\",[]]0Bi[\"{{{BH@h{N@n}}{BH@h{KEhBGLd}}}AONj}\",[]]0Bj[\"{{{BH@h{AJ@b}}{BH@h{KEhBGLd}}}AONj}\",[]]Bi[\"{{{BH@h{NOh}}{BH@h{KEhBGLd}}}AONj}\",[]]Bj[\"{{{BH@h{AIIn}}{BH@h{KEhBGLd}}}AONj}\",[]]Bi[\"{{{BH@h{NFn}}{BH@h{KEhBGLd}}}AONj}\",[]]Bj[\"{{{BH@h{BGKn}}{BH@h{KEhBGLd}}}AONj}\",[]]0Bj[\"{{{BH@h{AOMl}}{BH@h{KEhBGLd}}}AONj}\",[]]0Cf[\"{{{BH@h{{BGNd{c}}}}{BH@h{KEhBGLd}}}AONjBHDn}\",[\"T\"]]Cl[\"{{{BH@h{{BGNd{c}}}}{BH@h{KEhBGLd}}}AONj{AIBnBHDn}}\",[\"T\"]]Bj[\"{{{BH@h{AIHj}}{BH@h{KEhBGLd}}}AONj}\",[]]Bj[\"{{{BH@h{BDBj}}{BH@h{KEhBGLd}}}AONj}\",[]]Bi[\"{{{BH@h{NEd}}{BH@h{KEhBGLd}}}AONj}\",[]]0Bj[\"{{{BH@h{AIAf}}{BH@h{KEhBGLd}}}AONj}\",[]]Bj[\"{{{BH@h{AIGd}}{BH@h{KEhBGLd}}}AONj}\",[]]Bi[\"{{{BH@h{MHh}}{BH@h{KEhBGLd}}}AONj}\",[]]Bj[\"{{{BH@h{AIKb}}{BH@h{KEhBGLd}}}AONj}\",[]]Ce[\"{{{BH@h{{OCb{c}}}}{BH@h{KEhBGLd}}}AONjBHDn}\",[\"T\"]]Ck[\"{{{BH@h{{OCb{c}}}}{BH@h{KEhBGLd}}}AONj{AIBnBHDn}}\",[\"T\"]]Bj[\"{{{BH@h{AOHf}}{BH@h{KEhBGLd}}}AONj}\",[]]Bi[\"{{{BH@h{EGd}}{BH@h{KEhBGLd}}}AONj}\",[]]Bi[\"{{{BH@h{MEf}}{BH@h{KEhBGLd}}}AONj}\",[]]Bj[\"{{{BH@h{AINb}}{BH@h{KEhBGLd}}}AONj}\",[]]Bj[\"{{{BH@h{AHOh}}{BH@h{KEhBGLd}}}AONj}\",[]]Bj[\"{{{BH@h{BGL`}}{BH@h{KEhBGLd}}}AONj}\",[]]0Bj[\"{{{BH@h{AOMn}}{BH@h{KEhBGLd}}}AONj}\",[]]0Bj[\"{{{BH@h{BGNf}}{BH@h{KEhBGLd}}}AONj}\",[]]0Bj[\"{{{BH@h{BEHf}}{BH@h{KEhBGLd}}}AONj}\",[]]0Bj[\"{{{BH@h{BHEj}}{BH@h{KEhBGLd}}}AONj}\",[]]0Bj[\"{{{BH@h{AJ@d}}{BH@h{KEhBGLd}}}AONj}\",[]]Bi[\"{{{BH@h{NOj}}{BH@h{KEhBGLd}}}AONj}\",[]]Bj[\"{{{BH@h{BDB`}}{BH@h{KEhBGLd}}}AONj}\",[]]Bi[\"{{{BH@h{NG`}}{BH@h{KEhBGLd}}}AONj}\",[]]Bi[\"{{{BH@h{OCd}}{BH@h{KEhBGLd}}}AONj}\",[]]0Bi[\"{{{BH@h{EGf}}{BH@h{KEhBGLd}}}AONj}\",[]]Bi[\"{{{BH@h{MEh}}{BH@h{KEhBGLd}}}AONj}\",[]]Bj[\"{{{BH@h{AINd}}{BH@h{KEhBGLd}}}AONj}\",[]]Bi[\"{{{BH@h{OCf}}{BH@h{KEhBGLd}}}AONj}\",[]]Bi[\"{{{BH@h{EGh}}{BH@h{KEhBGLd}}}AONj}\",[]]Bi[\"{{{BH@h{MEj}}{BH@h{KEhBGLd}}}AONj}\",[]]Bj[\"{{{BH@h{AINf}}{BH@h{KEhBGLd}}}AONj}\",[]]Bi[\"{{{BH@h{NBl}}{BH@h{KEhBGLd}}}AONj}\",[]]Bj[\"{{{BH@h{BEId}}{BH@h{KEhBGLd}}}AONj}\",[]]Bj[\"{{{BH@h{BDFj}}{BH@h{KEhBGLd}}}AONj}\",[]]Bi[\"{{{BH@h{NCf}}{BH@h{KEhBGLd}}}AONj}\",[]]Bj[\"{{{BH@h{BGLb}}{BH@h{KEhBGLd}}}AONj}\",[]]0Bj[\"{{{BH@h{AHOj}}{BH@h{KEhBGLd}}}AONj}\",[]]Bh[\"{{{BH@h{Kf}}{BH@h{KEhBGLd}}}AONj}\",[]]Bj[\"{{{BH@h{BDBn}}{BH@h{KEhBGLd}}}AONj}\",[]]Bj[\"{{{BH@h{BEFd}}{BH@h{KEhBGLd}}}AONj}\",[]]Bj[\"{{{BH@h{BHE`}}{BH@h{KEhBGLd}}}AONj}\",[]]Bj[\"{{{BH@h{B@@b}}{BH@h{KEhBGLd}}}AONj}\",[]]Bj[\"{{{BH@h{BHEb}}{BH@h{KEhBGLd}}}AONj}\",[]]Bj[\"{{{BH@h{AJAf}}{BH@h{KEhBGLd}}}AONj}\",[]]Cf[\"{{{BH@h{{AIKj{c}}}}{BH@h{KEhBGLd}}}AONjAIBn}\",[\"T\"]]Bj[\"{{{BH@h{AHOf}}{BH@h{KEhBGLd}}}AONj}\",[]]Bj[\"{{{BH@h{AONh}}{BH@h{KEhBGLd}}}AONj}\",[]]Cf[\"{{{BH@h{{BGJj{c}}}}{BH@h{KEhBGLd}}}AONjAIBn}\",[\"T\"]]Bj[\"{{{BH@h{BGJn}}{BH@h{KEhBGLd}}}AONj}\",[]]0Bj[\"{{{BH@h{BDBh}}{BH@h{KEhBGLd}}}AONj}\",[]]Bj[\"{{{BH@h{AOOh}}{BH@h{KEhBGLd}}}AONj}\",[]]Bj[\"{{{BH@h{AOId}}{BH@h{KEhBGLd}}}AONj}\",[]]Bj[\"{{{BH@h{AIO`}}{BH@h{KEhBGLd}}}AONj}\",[]]Bi[\"{{{BH@h{DDh}}{BH@h{KEhBGLd}}}AONj}\",[]]Bj[\"{{{BH@h{BDC`}}{BH@h{KEhBGLd}}}AONj}\",[]]Bj[\"{{{BH@h{BEHd}}{BH@h{KEhBGLd}}}AONj}\",[]]0Bj[\"{{{BH@h{BHEh}}{BH@h{KEhBGLd}}}AONj}\",[]]0Bj[\"{{{BH@h{BGLh}}{BH@h{KEhBGLd}}}AONj}\",[]]0Bj[\"{{{BH@h{BJCf}}{BH@h{KEhBGLd}}}AONj}\",[]]0Bi[\"{{{BH@h{N@n}}{BH@h{KEhBGLd}}}AONj}\",[]]0Bj[\"{{{BH@h{AJ@b}}{BH@h{KEhBGLd}}}AONj}\",[]]Bi[\"{{{BH@h{NOh}}{BH@h{KEhBGLd}}}AONj}\",[]]Bj[\"{{{BH@h{AIIn}}{BH@h{KEhBGLd}}}AONj}\",[]]Bi[\"{{{BH@h{NFn}}{BH@h{KEhBGLd}}}AONj}\",[]]Bj[\"{{{BH@h{BGKn}}{BH@h{KEhBGLd}}}AONj}\",[]]0Bj[\"{{{BH@h{AOMl}}{BH@h{KEhBGLd}}}AONj}\",[]]0Cf[\"{{{BH@h{{BGNd{c}}}}{BH@h{KEhBGLd}}}AONjBHDn}\",[\"T\"]]Cl[\"{{{BH@h{{BGNd{c}}}}{BH@h{KEhBGLd}}}AONj{AIBnBHDn}}\",[\"T\"]]Bj[\"{{{BH@h{AIHj}}{BH@h{KEhBGLd}}}AONj}\",[]]Bj[\"{{{BH@h{BDBj}}{BH@h{KEhBGLd}}}AONj}\",[]]Bi[\"{{{BH@h{NEd}}{BH@h{KEhBGLd}}}AONj}\",[]]0Bj[\"{{{BH@h{AIAf}}{BH@h{KEhBGLd}}}AONj}\",[]]Bj[\"{{{BH@h{AIGd}}{BH@h{KEhBGLd}}}AONj}\",[]]Bi[\"{{{BH@h{MHh}}{BH@h{KEhBGLd}}}AONj}\",[]]Bj[\"{{{BH@h{AIKb}}{BH@h{KEhBGLd}}}AONj}\",[]]Ce[\"{{{BH@h{{OCb{c}}}}{BH@h{KEhBGLd}}}AONjBHDn}\",[\"T\"]]Ck[\"{{{BH@h{{OCb{c}}}}{BH@h{KEhBGLd}}}AONj{AIBnBHDn}}\",[\"T\"]]Bj[\"{{{BH@h{AOHf}}{BH@h{KEhBGLd}}}AONj}\",[]]Bi[\"{{{BH@h{EGd}}{BH@h{KEhBGLd}}}AONj}\",[]]Bi[\"{{{BH@h{MEf}}{BH@h{KEhBGLd}}}AONj}\",[]]Bj[\"{{{BH@h{AINb}}{BH@h{KEhBGLd}}}AONj}\",[]]Bj[\"{{{BH@h{AHOh}}{BH@h{KEhBGLd}}}AONj}\",[]]Bj[\"{{{BH@h{BGL`}}{BH@h{KEhBGLd}}}AONj}\",[]]0Bj[\"{{{BH@h{AOMn}}{BH@h{KEhBGLd}}}AONj}\",[]]0Bj[\"{{{BH@h{BGNf}}{BH@h{KEhBGLd}}}AONj}\",[]]0Bj[\"{{{BH@h{BEHf}}{BH@h{KEhBGLd}}}AONj}\",[]]0Bj[\"{{{BH@h{BHEj}}{BH@h{KEhBGLd}}}AONj}\",[]]0Bj[\"{{{BH@h{AJ@d}}{BH@h{KEhBGLd}}}AONj}\",[]]Bi[\"{{{BH@h{NOj}}{BH@h{KEhBGLd}}}AONj}\",[]]Bj[\"{{{BH@h{BDB`}}{BH@h{KEhBGLd}}}AONj}\",[]]Bi[\"{{{BH@h{NG`}}{BH@h{KEhBGLd}}}AONj}\",[]]Bi[\"{{{BH@h{OCd}}{BH@h{KEhBGLd}}}AONj}\",[]]0Bi[\"{{{BH@h{EGf}}{BH@h{KEhBGLd}}}AONj}\",[]]Bi[\"{{{BH@h{MEh}}{BH@h{KEhBGLd}}}AONj}\",[]]Bj[\"{{{BH@h{AINd}}{BH@h{KEhBGLd}}}AONj}\",[]]Bi[\"{{{BH@h{OCf}}{BH@h{KEhBGLd}}}AONj}\",[]]Bi[\"{{{BH@h{EGh}}{BH@h{KEhBGLd}}}AONj}\",[]]Bi[\"{{{BH@h{MEj}}{BH@h{KEhBGLd}}}AONj}\",[]]Bj[\"{{{BH@h{AINf}}{BH@h{KEhBGLd}}}AONj}\",[]]Bi[\"{{{BH@h{NBl}}{BH@h{KEhBGLd}}}AONj}\",[]]Bj[\"{{{BH@h{BEId}}{BH@h{KEhBGLd}}}AONj}\",[]]Bj[\"{{{BH@h{BDFj}}{BH@h{KEhBGLd}}}AONj}\",[]]Bi[\"{{{BH@h{NCf}}{BH@h{KEhBGLd}}}AONj}\",[]]Bj[\"{{{BH@h{BGLb}}{BH@h{KEhBGLd}}}AONj}\",[]]0Bj[\"{{{BH@h{AHOj}}{BH@h{KEhBGLd}}}AONj}\",[]]Bh[\"{{{BH@h{Kf}}{BH@h{KEhBGLd}}}AONj}\",[]]Bj[\"{{{BH@h{BDBn}}{BH@h{KEhBGLd}}}AONj}\",[]]Bj[\"{{{BH@h{BEFd}}{BH@h{KEhBGLd}}}AONj}\",[]]Bj[\"{{{BH@h{BHE`}}{BH@h{KEhBGLd}}}AONj}\",[]]Bj[\"{{{BH@h{B@@b}}{BH@h{KEhBGLd}}}AONj}\",[]]Bj[\"{{{BH@h{BHEb}}{BH@h{KEhBGLd}}}AONj}\",[]]Bj[\"{{{BH@h{AJAf}}{BH@h{KEhBGLd}}}AONj}\",[]]Cf[\"{{{BH@h{{AIKj{c}}}}{BH@h{KEhBGLd}}}AONjAIBn}\",[\"T\"]]Bj[\"{{{BH@h{AHOf}}{BH@h{KEhBGLd}}}AONj}\",[]]Bj[\"{{{BH@h{AONh}}{BH@h{KEhBGLd}}}AONj}\",[]]Cf[\"{{{BH@h{{BGJj{c}}}}{BH@h{KEhBGLd}}}AONjAIBn}\",[\"T\"]]Bj[\"{{{BH@h{BGJn}}{BH@h{KEhBGLd}}}AONj}\",[]]0Bj[\"{{{BH@h{BDBh}}{BH@h{KEhBGLd}}}AONj}\",[]]Bj[\"{{{BH@h{AOOh}}{BH@h{KEhBGLd}}}AONj}\",[]]Bj[\"{{{BH@h{AOId}}{BH@h{KEhBGLd}}}AONj}\",[]]Bj[\"{{{BH@h{AIO`}}{BH@h{KEhBGLd}}}AONj}\",[]]Bi[\"{{{BH@h{DDh}}{BH@h{KEhBGLd}}}AONj}\",[]]Bj[\"{{{BH@h{BDC`}}{BH@h{KEhBGLd}}}AONj}\",[]]Bj[\"{{{BH@h{BEHd}}{BH@h{KEhBGLd}}}AONj}\",[]]0Bj[\"{{{BH@h{BHEh}}{BH@h{KEhBGLd}}}AONj}\",[]]0Bj[\"{{{BH@h{BGLh}}{BH@h{KEhBGLd}}}AONj}\",[]]0Bj[\"{{{BH@h{BJCf}}{BH@h{KEhBGLd}}}AONj}\",[]]0Bi[\"{{{BH@h{N@n}}{BH@h{KEhBGLd}}}AONj}\",[]]0Bj[\"{{{BH@h{AJ@b}}{BH@h{KEhBGLd}}}AONj}\",[]]Bi[\"{{{BH@h{NOh}}{BH@h{KEhBGLd}}}AONj}\",[]]Bj[\"{{{BH@h{AIIn}}{BH@h{KEhBGLd}}}AONj}\",[]]Bi[\"{{{BH@h{NFn}}{BH@h{KEhBGLd}}}AONj}\",[]]Bj[\"{{{BH@h{BGKn}}{BH@h{KEhBGLd}}}AONj}\",[]]0Bj[\"{{{BH@h{AOMl}}{BH@h{KEhBGLd}}}AONj}\",[]]0Cf[\"{{{BH@h{{BGNd{c}}}}{BH@h{KEhBGLd}}}AONjBHDn}\",[\"T\"]]Cl[\"{{{BH@h{{BGNd{c}}}}{BH@h{KEhBGLd}}}AONj{AIBnBHDn}}\",[\"T\"]]Bj[\"{{{BH@h{AIHj}}{BH@h{KEhBGLd}}}AONj}\",[]]Bj[\"{{{BH@h{BDBj}}{BH@h{KEhBGLd}}}AONj}\",[]]Bi[\"{{{BH@h{NEd}}{BH@h{KEhBGLd}}}AONj}\",[]]0Bj[\"{{{BH@h{AIAf}}{BH@h{KEhBGLd}}}AONj}\",[]]Bj[\"{{{BH@h{AIGd}}{BH@h{KEhBGLd}}}AONj}\",[]]Bi[\"{{{BH@h{MHh}}{BH@h{KEhBGLd}}}AONj}\",[]]Bj[\"{{{BH@h{AIKb}}{BH@h{KEhBGLd}}}AONj}\",[]]Ce[\"{{{BH@h{{OCb{c}}}}{BH@h{KEhBGLd}}}AONjBHDn}\",[\"T\"]]Ck[\"{{{BH@h{{OCb{c}}}}{BH@h{KEhBGLd}}}AONj{AIBnBHDn}}\",[\"T\"]]Bj[\"{{{BH@h{AOHf}}{BH@h{KEhBGLd}}}AONj}\",[]]Bi[\"{{{BH@h{EGd}}{BH@h{KEhBGLd}}}AONj}\",[]]Bi[\"{{{BH@h{MEf}}{BH@h{KEhBGLd}}}AONj}\",[]]Bj[\"{{{BH@h{AINb}}{BH@h{KEhBGLd}}}AONj}\",[]]Bj[\"{{{BH@h{AHOh}}{BH@h{KEhBGLd}}}AONj}\",[]]Bj[\"{{{BH@h{BGL`}}{BH@h{KEhBGLd}}}AONj}\",[]]0Bj[\"{{{BH@h{AOMn}}{BH@h{KEhBGLd}}}AONj}\",[]]0Bj[\"{{{BH@h{BGNf}}{BH@h{KEhBGLd}}}AONj}\",[]]0Bj[\"{{{BH@h{BEHf}}{BH@h{KEhBGLd}}}AONj}\",[]]0Bj[\"{{{BH@h{BHEj}}{BH@h{KEhBGLd}}}AONj}\",[]]0Bj[\"{{{BH@h{AJ@d}}{BH@h{KEhBGLd}}}AONj}\",[]]Bi[\"{{{BH@h{NOj}}{BH@h{KEhBGLd}}}AONj}\",[]]Bj[\"{{{BH@h{BDB`}}{BH@h{KEhBGLd}}}AONj}\",[]]Bi[\"{{{BH@h{NG`}}{BH@h{KEhBGLd}}}AONj}\",[]]Bi[\"{{{BH@h{OCd}}{BH@h{KEhBGLd}}}AONj}\",[]]0Bi[\"{{{BH@h{EGf}}{BH@h{KEhBGLd}}}AONj}\",[]]Bi[\"{{{BH@h{MEh}}{BH@h{KEhBGLd}}}AONj}\",[]]Bj[\"{{{BH@h{AINd}}{BH@h{KEhBGLd}}}AONj}\",[]]Bi[\"{{{BH@h{OCf}}{BH@h{KEhBGLd}}}AONj}\",[]]Bi[\"{{{BH@h{EGh}}{BH@h{KEhBGLd}}}AONj}\",[]]Bi[\"{{{BH@h{MEj}}{BH@h{KEhBGLd}}}AONj}\",[]]Bj[\"{{{BH@h{AINf}}{BH@h{KEhBGLd}}}AONj}\",[]]Bi[\"{{{BH@h{NBl}}{BH@h{KEhBGLd}}}AONj}\",[]]Bj[\"{{{BH@h{BEId}}{BH@h{KEhBGLd}}}AONj}\",[]]Bj[\"{{{BH@h{BDFj}}{BH@h{KEhBGLd}}}AONj}\",[]]Bi[\"{{{BH@h{NCf}}{BH@h{KEhBGLd}}}AONj}\",[]]Bj[\"{{{BH@h{BGLb}}{BH@h{KEhBGLd}}}AONj}\",[]]0Bj[\"{{{BH@h{AHOj}}{BH@h{KEhBGLd}}}AONj}\",[]]Bh[\"{{{BH@h{Kf}}{BH@h{KEhBGLd}}}AONj}\",[]]Bj[\"{{{BH@h{BDBn}}{BH@h{KEhBGLd}}}AONj}\",[]]Bj[\"{{{BH@h{BEFd}}{BH@h{KEhBGLd}}}AONj}\",[]]Bj[\"{{{BH@h{BHE`}}{BH@h{KEhBGLd}}}AONj}\",[]]Bj[\"{{{BH@h{B@@b}}{BH@h{KEhBGLd}}}AONj}\",[]]Aa[\"{BDCbAOEb}\",[]]Aa[\"{BDCdAOEb}\",[]]10101010Ej[\"{{{BH@h{{BGJj{c}}}}EGd{BH@h{AINb}}{BH@h{AHOf}}}{{AONl{{EJj{{BH@h{c}}}}BGKn}}}{}}\",[\"T\"]]C`[\"{{{BH@h{BDBh}}NEd}{{AOK`{{BH@h{AOHf}}}}}}\",[]]Bg[\"{{{BH@h{AIHj}}NEd}{{AOK`{DJd}}}}\",[]]D`[\"{{{BH@h{AINb}}AOEb{BH@h{AHOf}}}{{AOK`{{AOE`{AIAfEGd}}}}}}\",[]]Cd[\"{{{BH@h{AINd}}AOEb{BH@h{AHOh}}}{{AOK`{EGf}}}}\",[]]Bk[\"{{AINfLHj{BH@h{AHOj}}}{{AOK`{EGh}}}}\",[]]Fe[\"{{{BH@h{c}}AOEb{BH@h{e}}}{{AOK`{g}}}{}{}{}}\",[\"Calculus::Stack\",\"Calculus::Arena\",\"Calculus::Val\"]]Bg[\"{{{BH@h{{AIKj{c}}}}AOEb}cMGn}\",[\"T\"]]76Cf[\"{{{BH@h{N@n}}{BH@h{LF`}}}{{AOK`{{BH@h{N@n}}}}}}\",[]]6543218706543218706543218706543Be[\"{{{BH@h{{BGJj{c}}}}}AOEb{}}\",[\"T\"]]Ak[\"{{{BH@h{BDBh}}}AOEb}\",[]]Ak[\"{{{BH@h{AINb}}}AOEb}\",[]]Aa[\"{AOMlAOEb}\",[]]A`[\"{MElAOEb}\",[]]Aa[\"{BEFfAOEb}\",[]]Aa[\"{BEGbAOEb}\",[]]Aa[\"{BEElAOEb}\",[]]Ak[\"{{{BH@h{AINd}}}AOEb}\",[]]Aa[\"{AOMnAOEb}\",[]]A`[\"{MEnAOEb}\",[]]Aa[\"{BEFhAOEb}\",[]]Aa[\"{BEGdAOEb}\",[]]Aa[\"{BEEnAOEb}\",[]]An[\"{{AINf{BH@h{AHOj}}}LHj}\",[]]A`[\"{BEFjLHj}\",[]]A`[\"{BEGfLHj}\",[]]A`[\"{BDEfLHj}\",[]]A`[\"{BDFbLHj}\",[]]Bk[\"{{{BH@h{c}}}AOEb{}}\",[\"Calculus::Stack\"]]Bf[\"{{{BH@h{{AIKj{c}}}}}AOEbMGn}\",[\"T\"]]Be[\"{{{BH@h{{BGJj{c}}}}}AOEb{}}\",[\"T\"]]Ak[\"{{{BH@h{BDBh}}}AOEb}\",[]]Ak[\"{{{BH@h{AINb}}}AOEb}\",[]]Aa[\"{AOMlAOEb}\",[]]A`[\"{MElAOEb}\",[]]Aa[\"{BEFfAOEb}\",[]]Aa[\"{BEGbAOEb}\",[]]Aa[\"{BEElAOEb}\",[]]Ak[\"{{{BH@h{AINd}}}AOEb}\",[]]Aa[\"{AOMnAOEb}\",[]]A`[\"{MEnAOEb}\",[]]Aa[\"{BEFhAOEb}\",[]]Aa[\"{BEGdAOEb}\",[]]Aa[\"{BEEnAOEb}\",[]]An[\"{{AINf{BH@h{AHOj}}}LHj}\",[]]A`[\"{BEFjLHj}\",[]]A`[\"{BEGfLHj}\",[]]A`[\"{BDEfLHj}\",[]]A`[\"{BDFbLHj}\",[]]Bk[\"{{{BH@h{c}}}AOEb{}}\",[\"Calculus::Stack\"]]Bf[\"{{{BH@h{{AIKj{c}}}}}AOEbMGn}\",[\"T\"]]Be[\"{{{BH@h{{BGJj{c}}}}}AOEb{}}\",[\"T\"]]Ak[\"{{{BH@h{BDBh}}}AOEb}\",[]]Ak[\"{{{BH@h{AINb}}}AOEb}\",[]]Aa[\"{AOMlAOEb}\",[]]A`[\"{MElAOEb}\",[]]Aa[\"{BEFfAOEb}\",[]]Aa[\"{BEGbAOEb}\",[]]Aa[\"{BEElAOEb}\",[]]Ak[\"{{{BH@h{AINd}}}AOEb}\",[]]Aa[\"{AOMnAOEb}\",[]]A`[\"{MEnAOEb}\",[]]Aa[\"{BEFhAOEb}\",[]]Aa[\"{BEGdAOEb}\",[]]Aa[\"{BEEnAOEb}\",[]]An[\"{{AINf{BH@h{AHOj}}}LHj}\",[]]A`[\"{BEFjLHj}\",[]]A`[\"{BEGfLHj}\",[]]A`[\"{BDEfLHj}\",[]]A`[\"{BDFbLHj}\",[]]Bk[\"{{{BH@h{c}}}AOEb{}}\",[\"Calculus::Stack\"]]Bf[\"{{{BH@h{{AIKj{c}}}}}AOEbMGn}\",[\"T\"]]Be[\"{{{BH@h{{BGJj{c}}}}}AOEb{}}\",[\"T\"]]Ak[\"{{{BH@h{BDBh}}}AOEb}\",[]]Ak[\"{{{BH@h{AINb}}}AOEb}\",[]]Aa[\"{AOMlAOEb}\",[]]A`[\"{MElAOEb}\",[]]Aa[\"{BEFfAOEb}\",[]]Aa[\"{BEGbAOEb}\",[]]Aa[\"{BEElAOEb}\",[]]Ak[\"{{{BH@h{AINd}}}AOEb}\",[]]Aa[\"{AOMnAOEb}\",[]]A`[\"{MEnAOEb}\",[]]Aa[\"{BEFhAOEb}\",[]]Aa[\"{BEGdAOEb}\",[]]Aa[\"{BEEnAOEb}\",[]]An[\"{{AINf{BH@h{AHOj}}}LHj}\",[]]A`[\"{BEFjLHj}\",[]]A`[\"{BEGfLHj}\",[]]A`[\"{BDEfLHj}\",[]]A`[\"{BDFbLHj}\",[]]Bk[\"{{{BH@h{c}}}AOEb{}}\",[\"Calculus::Stack\"]]Bf[\"{{{BH@h{{AIKj{c}}}}}AOEbMGn}\",[\"T\"]]Be[\"{{{BH@h{{BGJj{c}}}}}AOEb{}}\",[\"T\"]]Ak[\"{{{BH@h{BDBh}}}AOEb}\",[]]Ak[\"{{{BH@h{AINb}}}AOEb}\",[]]Aa[\"{AOMlAOEb}\",[]]A`[\"{MElAOEb}\",[]]Aa[\"{BEFfAOEb}\",[]]Aa[\"{BEGbAOEb}\",[]]Aa[\"{BEElAOEb}\",[]]Ak[\"{{{BH@h{AINd}}}AOEb}\",[]]Aa[\"{AOMnAOEb}\",[]]A`[\"{MEnAOEb}\",[]]Aa[\"{BEFhAOEb}\",[]]Aa[\"{BEGdAOEb}\",[]]Aa[\"{BEEnAOEb}\",[]]An[\"{{AINf{BH@h{AHOj}}}LHj}\",[]]A`[\"{BEFjLHj}\",[]]A`[\"{BEGfLHj}\",[]]A`[\"{BDEfLHj}\",[]]A`[\"{BDFbLHj}\",[]]Bn[\"{{{BH@h{LF`}}}{{AONl{{EJj{NOh}}BEHd}}}}\",[]]Cj[\"{c{{AONl{{EJj{NOj}}BEHf}}}{{BEGn{}{{N@f{OMl}}}}}}\",[\"\"]]10101010>84>84>84>84>84n[\"{{}MCb}\",[]]o[\"{{}AHOf}\",[]]Ak[\"{{}{{BGJj{c}}}{}}\",[\"T\"]]o[\"{{}BDBh}\",[]]Cb[\"{{{BH@h{{BGJj{DDh}}}}AOId{BH@h{AHOf}}}AOOh}\",[]]Ak[\"{{{BH@h{AHOf}}}BDC`}\",[]]Aj[\"{{{BH@h{LF`}}}AIIn}\",[]]Af[\"{{EGdAOEb}AOMl}\",[]]o[\"{{}AIHj}\",[]]o[\"{{}BDBj}\",[]]Ci[\"{{NEd{BH@h{{ANLj{{BH@h{LF`}}}}}}{BH@h{AHOf}}}AIAf}\",[]]Ci[\"{{NEd{BH@h{{ANLj{{BH@h{LF`}}}}}}{BH@h{AHOf}}}AIGd}\",[]]Ak[\"{{{BH@h{AHOf}}}AINb}\",[]]o[\"{{}AHOh}\",[]]Af[\"{{EGfAOEb}AOMn}\",[]]Ak[\"{{{BH@h{AHOh}}}AINd}\",[]]Ak[\"{{{BH@h{AHOj}}}AINf}\",[]]o[\"{{}AHOj}\",[]]Al[\"{{}{{AIKj{c}}}MGn}\",[\"T\"]]o[\"{{}AHOf}\",[]]Ak[\"{{}{{BGJj{c}}}{}}\",[\"T\"]]o[\"{{}BDBh}\",[]]Cb[\"{{{BH@h{{BGJj{DDh}}}}AOId{BH@h{AHOf}}}AOOh}\",[]]Ak[\"{{{BH@h{AHOf}}}BDC`}\",[]]Aj[\"{{{BH@h{LF`}}}AIIn}\",[]]Af[\"{{EGdAOEb}AOMl}\",[]]o[\"{{}AIHj}\",[]]o[\"{{}BDBj}\",[]]Be[\"{{{BH@h{LF`}}{BH@h{AHOf}}}NEd}\",[]]Ci[\"{{NEd{BH@h{{ANLj{{BH@h{LF`}}}}}}{BH@h{AHOf}}}AIAf}\",[]]Ci[\"{{NEd{BH@h{{ANLj{{BH@h{LF`}}}}}}{BH@h{AHOf}}}AIGd}\",[]]Ak[\"{{{BH@h{AHOf}}}AINb}\",[]]o[\"{{}AHOh}\",[]]Af[\"{{EGfAOEb}AOMn}\",[]]Ak[\"{{{BH@h{AHOh}}}AINd}\",[]]Ak[\"{{{BH@h{AHOj}}}AINf}\",[]]o[\"{{}AHOj}\",[]]Ak[\"{{{BH@h{AHOf}}}BEFd}\",[]]Aj[\"{{{AOOj{N@n}}}B@@b}\",[]]Al[\"{{}{{AIKj{c}}}MGn}\",[\"T\"]]o[\"{{}AHOf}\",[]]Ak[\"{{}{{BGJj{c}}}{}}\",[\"T\"]]o[\"{{}BDBh}\",[]]Cb[\"{{{BH@h{{BGJj{DDh}}}}AOId{BH@h{AHOf}}}AOOh}\",[]]Ak[\"{{{BH@h{AHOf}}}BDC`}\",[]]Aj[\"{{{BH@h{LF`}}}AIIn}\",[]]Af[\"{{EGdAOEb}AOMl}\",[]]o[\"{{}AIHj}\",[]]o[\"{{}BDBj}\",[]]Be[\"{{{BH@h{LF`}}{BH@h{AHOf}}}NEd}\",[]]Ci[\"{{NEd{BH@h{{ANLj{{BH@h{LF`}}}}}}{BH@h{AHOf}}}AIAf}\",[]]Ci[\"{{NEd{BH@h{{ANLj{{BH@h{LF`}}}}}}{BH@h{AHOf}}}AIGd}\",[]]Ak[\"{{{BH@h{AHOf}}}AINb}\",[]]o[\"{{}AHOh}\",[]]Af[\"{{EGfAOEb}AOMn}\",[]]Ak[\"{{{BH@h{AHOh}}}AINd}\",[]]Ak[\"{{{BH@h{AHOj}}}AINf}\",[]]o[\"{{}AHOj}\",[]]Ak[\"{{{BH@h{AHOf}}}BEFd}\",[]]Aj[\"{{{AOOj{N@n}}}B@@b}\",[]]Al[\"{{}{{AIKj{c}}}MGn}\",[\"T\"]]o[\"{{}AHOf}\",[]]Ak[\"{{}{{BGJj{c}}}{}}\",[\"T\"]]o[\"{{}BDBh}\",[]]Cb[\"{{{BH@h{{BGJj{DDh}}}}AOId{BH@h{AHOf}}}AOOh}\",[]]Ak[\"{{{BH@h{AHOf}}}BDC`}\",[]]Aj[\"{{{BH@h{LF`}}}AIIn}\",[]]Af[\"{{EGdAOEb}AOMl}\",[]]o[\"{{}AIHj}\",[]]o[\"{{}BDBj}\",[]]Be[\"{{{BH@h{LF`}}{BH@h{AHOf}}}NEd}\",[]]Ci[\"{{NEd{BH@h{{ANLj{{BH@h{LF`}}}}}}{BH@h{AHOf}}}AIAf}\",[]]Ci[\"{{NEd{BH@h{{ANLj{{BH@h{LF`}}}}}}{BH@h{AHOf}}}AIGd}\",[]]Ak[\"{{{BH@h{AHOf}}}AINb}\",[]]o[\"{{}AHOh}\",[]]Af[\"{{EGfAOEb}AOMn}\",[]]Ak[\"{{{BH@h{AHOh}}}AINd}\",[]]Ak[\"{{{BH@h{AHOj}}}AINf}\",[]]o[\"{{}AHOj}\",[]]Ak[\"{{{BH@h{AHOf}}}BEFd}\",[]]Aj[\"{{{AOOj{N@n}}}B@@b}\",[]]Al[\"{{}{{AIKj{c}}}MGn}\",[\"T\"]]o[\"{{}AHOf}\",[]]Ak[\"{{}{{BGJj{c}}}{}}\",[\"T\"]]o[\"{{}BDBh}\",[]]Cb[\"{{{BH@h{{BGJj{DDh}}}}AOId{BH@h{AHOf}}}AOOh}\",[]]Ak[\"{{{BH@h{AHOf}}}BDC`}\",[]]Aj[\"{{{BH@h{LF`}}}AIIn}\",[]]Af[\"{{EGdAOEb}AOMl}\",[]]o[\"{{}AIHj}\",[]]o[\"{{}BDBj}\",[]]Be[\"{{{BH@h{LF`}}{BH@h{AHOf}}}NEd}\",[]]Ci[\"{{NEd{BH@h{{ANLj{{BH@h{LF`}}}}}}{BH@h{AHOf}}}AIAf}\",[]]Ci[\"{{NEd{BH@h{{ANLj{{BH@h{LF`}}}}}}{BH@h{AHOf}}}AIGd}\",[]]Ak[\"{{{BH@h{AHOf}}}AINb}\",[]]o[\"{{}AHOh}\",[]]Af[\"{{EGfAOEb}AOMn}\",[]]Ak[\"{{{BH@h{AHOh}}}AINd}\",[]]Ak[\"{{{BH@h{AHOj}}}AINf}\",[]]o[\"{{}AHOj}\",[]]Ak[\"{{{BH@h{AHOf}}}BEFd}\",[]]Aj[\"{{{AOOj{N@n}}}B@@b}\",[]]Aa[\"{BJHhAOEb}\",[]]Aa[\"{BGMbAOEb}\",[]]Aa[\"{BJHjAOEb}\",[]]Aa[\"{BJHfAOEb}\",[]]321032103210321Aa[\"{BDCbAOEb}\",[]]Aa[\"{BDCdAOEb}\",[]]10101010A`[\"{NOhAJ@b}\",[]]Aa[\"{BJJjB@@d}\",[]]A`[\"{NOjAJ@d}\",[]]Aa[\"{BJJlAJ@d}\",[]]3210321032103210Bg[\"{{{BH@h{AHOf}}EGd}{{BH@h{EGd}}}}\",[]]A`[\"{AOMlEGd}\",[]]A`[\"{AOHfEGd}\",[]]Aa[\"{BDEbAOMl}\",[]]Aa[\"{BDEnAOMl}\",[]]Bg[\"{{{BH@h{AHOh}}EGf}{{BH@h{EGf}}}}\",[]]A`[\"{AOMnEGf}\",[]]Aa[\"{BDEdAOMn}\",[]]Aa[\"{BDF`AOMn}\",[]]Ba[\"{{{BH@h{KEhAHOj}}BDFj}EGh}\",[]]De[\"{{{BH@h{c}}e}{{BH@h{e}}}{}{}}\",[\"Calculus::Arena\",\"Calculus::Val\"]]:9876543210:9876543210:9876543210:987654321Fj[\"{c{{`{{BKCl{}{{N@f{{AOE`{{BH@h{e}}g}}}}}}}}}{}{}{}}\",[\"Calculus::Args\",\"Calculus::Val\",\"Calculus::Dot\"]]000Dj[\"{{{BH@h{c}}}{{AONl{AHJde}}}{}{}}\",[\"Calculus::Arena\",\"Calculus::Error\"]]000Cf[\"{{{BH@h{AINb}}{BH@h{AIAf}}EGd{BH@h{AHOf}}}AINb}\",[]]0000A`[\"{MEfBH@h}\",[]]A`[\"{MEhBH@h}\",[]]10101010Bg[\"{{{BH@h{AHOf}}MEf}{{BH@h{MEf}}}}\",[]]Bg[\"{{{BH@h{AHOh}}MEh}{{BH@h{MEh}}}}\",[]]Bd[\"{{{BH@h{KEhAHOj}}AINfOCf}MEj}\",[]]Fd[\"{{ce{BH@h{g}}}i{}{}{}{}}\",[\"Calculus::Bound\",\"Calculus::Stack\",\"Calculus::Term\",\"Calculus::Clos\"]]321032103210321Bj[\"{{{BH@h{AINb}}{BH@h{AIAf}}EGd}AINb}\",[]]An[\"{{{BH@h{AINd}}EGf}AINd}\",[]]E`[\"{{{BH@h{c}}eg}c{}{}{}}\",[\"Calculus::Stack\",\"Calculus::Bound\",\"Calculus::Val\"]]21021021021Ea[\"{{{BH@h{KEhBDBj}}{BH@h{EGd}}{BH@h{EGd}}AOEb{BH@h{AHOf}}}{{AONl{OMjBGKn}}}}\",[]]Db[\"{{{BH@h{EGd}}{BH@h{EGd}}AOEb{BH@h{AHOf}}}{{AONl{OMjBGKn}}}}\",[]]Db[\"{{{BH@h{EGf}}{BH@h{EGf}}AOEb{BH@h{AHOh}}}{{AONl{OMjBGL`}}}}\",[]]Cd[\"{{EGhEGhLHj{BH@h{KEhAHOj}}}{{AONl{OMjBGLb}}}}\",[]]Bh[\"{{BH@hBH@hAOEbBH@h}{{AONl{OMj}}}}\",[]]4321043210432104321Am[\"{{{BH@h{KEhMCb}}}AHJd}\",[]]An[\"{{{BH@h{KEhAONh}}}AHJd}\",[]]0000Ee[\"{{{BH@h{KEhBDBj}}{BH@h{{OCb{MHh}}}}{BH@h{AINb}}{BH@h{AHOf}}}{{AONl{EGdBGKn}}}}\",[]]Df[\"{{{BH@h{{OCb{MHh}}}}{BH@h{AINb}}{BH@h{AHOf}}}{{AONl{EGdBGKn}}}}\",[]]Co[\"{{{BH@h{OCd}}{BH@h{AINd}}{BH@h{AHOh}}}{{AONl{EGfBGL`}}}}\",[]]Cb[\"{{OCfAINf{BH@h{KEhAHOj}}}{{AONl{EGhBGLb}}}}\",[]]Ak[\"{{BH@hBH@hBH@h}AONl}\",[]]4321043210432104321Ak[\"{{{BH@h{BDBn}}}AHJd}\",[]]0000Cj[\"{{{BH@h{c}}AOEbe}{{AOK`{{BH@h{c}}}}}AOGlAIGf}\",[\"S\",\"\"]]0000A`[\"{cc{}}\",[\"T\"]]00000Aa[\"{BGKnBGJn}\",[]]1Ak[\"{{{BGNd{AIKb}}}BGJn}\",[]]22222222Aa[\"{BEHdBHEh}\",[]]3333333Ao[\"{BGKn{{BGNd{c}}}BHDn}\",[\"T\"]]4444444444444Aa[\"{AOKdAOEb}\",[]]5555Aa[\"{BGL`BGNf}\",[]]66Aa[\"{BEHfBHEj}\",[]]77777777Aa[\"{AOKfAOEb}\",[]]8888888888888888888887688888888588888888848888888888888388882818888888880888888888888888888888888768888888588888888884888888888888838888281888888888088888888888888888888888876888888858888888888488888888888883888828188888888808888888888888888888888876888888888588888888848888888888888388882881888888880888888888888888Be[\"{{{BH@h{AHOf}}}{{AOK`{AOEb}}}}\",[]]000Bo[\"{{{BH@h{DDh}}{BH@h{KEhc}}}AHJdAOHh}\",[\"__H\"]]Bo[\"{{{BH@h{NEd}}{BH@h{KEhc}}}AHJdAOHh}\",[\"__H\"]]Bo[\"{{{BH@h{OCf}}{BH@h{KEhc}}}AHJdAOHh}\",[\"__H\"]]Bo[\"{{{BH@h{EGh}}{BH@h{KEhc}}}AHJdAOHh}\",[\"__H\"]]Bo[\"{{{BH@h{MEj}}{BH@h{KEhc}}}AHJdAOHh}\",[\"__H\"]]C`[\"{{{BH@h{AINf}}{BH@h{KEhc}}}AHJdAOHh}\",[\"__H\"]]Bo[\"{{{BH@h{NBl}}{BH@h{KEhc}}}AHJdAOHh}\",[\"__H\"]]Bn[\"{{{BH@h{Kf}}{BH@h{KEhc}}}AHJdAOHh}\",[\"__H\"]]7Bm[\"{{{BH@h{NEd}}{BH@h{KEhc}}}AHJdAOHh}\",[\"H\"]]654321806543218065432180654321Dh[\"{{{BH@h{AINb}}{BH@h{AINb}}{BH@h{AHOf}}}{{AONl{{BGJj{DDh}}BGKn}}}}\",[]]0000Aa[\"{AOHfBH@h}\",[]]A`[\"{MEfBH@h}\",[]]A`[\"{MElBH@h}\",[]]210210210210Aa[\"{{}c{}}\",[\"U\"]]00000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000Ck[\"{{{BH@h{BDBh}}}{{`{{BEGn{}{{N@f{{BH@h{AOHf}}}}}}}}}}\",[]]0000Ak[\"{{{BH@h{BDBn}}}AHJd}\",[]]0000Dn[\"{{{BH@h{KEhBDBh}}{BH@h{{ANLj{C@b}}}}OMj{BH@h{AHOf}}}{{AONl{AOEbBJCf}}}}\",[]]0000AIm[\"{{{BEIf{{BEEj{}{{NOl{c}}{EEb{e}}{MCd{g}}{AIKl{i}}{AHMd{k}}{AIDb{m}}{AI@d{o}}{AIEh{Aa}}{CJh{Ac}}{AICh{Ae}}{LOh{Ag}}{BDDn{Ai}}{B@A`{Ak}}}}}}}cMGnMGnAIBbAIBb{}{}MGnMGnMGn{}MGn{}{}}\",[\"Calculus::Term\",\"Calculus::Val\",\"Calculus::Clos\",\"Calculus::Stack\",\"Calculus::Arena\",\"Calculus::Error\",\"Calculus::Bound\",\"Calculus::Field\",\"Calculus::Dot\",\"Calculus::Entry\",\"Calculus::Args\",\"Calculus::TermExt\",\"Calculus::ValExt\"]]000Aj[\"{{{BH@h{AHOj}}}NCf}\",[]]0000Ca[\"{{{BH@h{AHOf}}AOEb{BH@h{{OCb{MHh}}}}}AOEb}\",[]]0000A`[\"{BDBdNEd}\",[]]A`[\"{BIKdNEd}\",[]]A`[\"{BDDbNEd}\",[]]Aa[\"{BJGnB@@d}\",[]]Aa[\"{BJDdB@@d}\",[]]Aa[\"{BEHnB@@d}\",[]]A`[\"{AIAfNEd}\",[]]A`[\"{AIGdNEd}\",[]]A`[\"{BKBfNEd}\",[]]Aa[\"{BJH`B@@d}\",[]]9876543210987654321098765432109876543210Bg[\"{{{BH@h{KEhAIIn}}}{{AOK`{NOh}}}}\",[]]0000An[\"{{OCf{BH@h{AHOj}}}BEId}\",[]]An[\"{{EGh{BH@h{AHOj}}}BDFj}\",[]]10101010Gn[\"{{{BH@h{c}}}{{AOE`{e{BH@h{g}}{BH@h{i}}}}}{}{}{}{}}\",[\"Calculus::Clos\",\"Calculus::Bound\",\"Calculus::Stack\",\"Calculus::Term\"]]000Ak[\"{{{BH@h{AJAf}}}AOEb}\",[]]000Bm[\"{{{BH@h{AOGl}}}{{AOK`{{BH@h{AOGl}}}}}}\",[]]Bm[\"{{{BH@h{AINb}}}{{AOK`{{BH@h{AINb}}}}}}\",[]]A`[\"{MElBH@h}\",[]]Bm[\"{{{BH@h{AINd}}}{{AOK`{{BH@h{AINd}}}}}}\",[]]A`[\"{MEnBH@h}\",[]]43210432104321043210Bj[\"{{{BH@h{KEh{AIKj{c}}}}c}AHJdMGn}\",[\"T\"]]000Bh[\"{{{BH@h{BDBn}}Kf{BH@h{LF`}}}AHJd}\",[]]0000Bo[\"{{{BH@h{BDBh}}}{{AONl{{EJj{C@b}}BJCf}}}}\",[]]0000Aj[\"{{{BH@h{AHOf}}}OMj}\",[]]000Ch[\"{{{BH@h{AHOf}}{OCb{c}}}{{BH@h{{OCb{c}}}}}BHDn}\",[\"T\"]]Aa[\"{BIKdBH@h}\",[]]Aa[\"{BDDbBH@h}\",[]]Aa[\"{AOHfBH@h}\",[]]Aa[\"{BIJ`BH@h}\",[]]Aa[\"{BINjBH@h}\",[]]Aa[\"{BHElBH@h}\",[]]Aa[\"{BIKfBH@h}\",[]]Aa[\"{BIObBH@h}\",[]]Aa[\"{BJJbBH@h}\",[]]Aa[\"{BKBfBH@h}\",[]]Bg[\"{{{BH@h{AHOh}}OCd}{{BH@h{OCd}}}}\",[]]Aa[\"{BIJbBH@h}\",[]]Aa[\"{BINlBH@h}\",[]]Aa[\"{BHEnBH@h}\",[]]Aa[\"{BIKhBH@h}\",[]]Aa[\"{BIOdBH@h}\",[]]Aa[\"{BJJdBH@h}\",[]]Ba[\"{{{BH@h{KEhAHOj}}BEId}OCf}\",[]]Df[\"{{{BH@h{c}}e}{{BH@h{e}}}{}{}}\",[\"Calculus::Arena\",\"Calculus::Term\"]]Ch[\"{{{BH@h{AHOf}}{OCb{c}}}{{BH@h{{OCb{c}}}}}BHDn}\",[\"T\"]]Aa[\"{BIKdBH@h}\",[]]Aa[\"{BDDbBH@h}\",[]]Aa[\"{AOHfBH@h}\",[]]Aa[\"{BIJ`BH@h}\",[]]Aa[\"{BINjBH@h}\",[]]Aa[\"{BHElBH@h}\",[]]Aa[\"{BIKfBH@h}\",[]]Aa[\"{BIObBH@h}\",[]]Aa[\"{BJJbBH@h}\",[]]Aa[\"{BKBfBH@h}\",[]]Bg[\"{{{BH@h{AHOh}}OCd}{{BH@h{OCd}}}}\",[]]Aa[\"{BIJbBH@h}\",[]]Aa[\"{BINlBH@h}\",[]]Aa[\"{BHEnBH@h}\",[]]Aa[\"{BIKhBH@h}\",[]]Aa[\"{BIOdBH@h}\",[]]Aa[\"{BJJdBH@h}\",[]]Ba[\"{{{BH@h{KEhAHOj}}BEId}OCf}\",[]]Df[\"{{{BH@h{c}}e}{{BH@h{e}}}{}{}}\",[\"Calculus::Arena\",\"Calculus::Term\"]]Ch[\"{{{BH@h{AHOf}}{OCb{c}}}{{BH@h{{OCb{c}}}}}BHDn}\",[\"T\"]]Aa[\"{BIKdBH@h}\",[]]Aa[\"{BDDbBH@h}\",[]]Aa[\"{AOHfBH@h}\",[]]Aa[\"{BIJ`BH@h}\",[]]Aa[\"{BINjBH@h}\",[]]Aa[\"{BHElBH@h}\",[]]Aa[\"{BIKfBH@h}\",[]]Aa[\"{BIObBH@h}\",[]]Aa[\"{BJJbBH@h}\",[]]Aa[\"{BKBfBH@h}\",[]]Bg[\"{{{BH@h{AHOh}}OCd}{{BH@h{OCd}}}}\",[]]Aa[\"{BIJbBH@h}\",[]]Aa[\"{BINlBH@h}\",[]]Aa[\"{BHEnBH@h}\",[]]Aa[\"{BIKhBH@h}\",[]]Aa[\"{BIOdBH@h}\",[]]Aa[\"{BJJdBH@h}\",[]]Ba[\"{{{BH@h{KEhAHOj}}BEId}OCf}\",[]]Df[\"{{{BH@h{c}}e}{{BH@h{e}}}{}{}}\",[\"Calculus::Arena\",\"Calculus::Term\"]]Ch[\"{{{BH@h{AHOf}}{OCb{c}}}{{BH@h{{OCb{c}}}}}BHDn}\",[\"T\"]]Aa[\"{BIKdBH@h}\",[]]Aa[\"{BDDbBH@h}\",[]]Aa[\"{AOHfBH@h}\",[]]Aa[\"{BIJ`BH@h}\",[]]Aa[\"{BINjBH@h}\",[]]Aa[\"{BHElBH@h}\",[]]Aa[\"{BIKfBH@h}\",[]]Aa[\"{BIObBH@h}\",[]]Aa[\"{BJJbBH@h}\",[]]Aa[\"{BKBfBH@h}\",[]]Bg[\"{{{BH@h{AHOh}}OCd}{{BH@h{OCd}}}}\",[]]Aa[\"{BIJbBH@h}\",[]]Aa[\"{BINlBH@h}\",[]]Aa[\"{BHEnBH@h}\",[]]Aa[\"{BIKhBH@h}\",[]]Aa[\"{BIOdBH@h}\",[]]Aa[\"{BJJdBH@h}\",[]]Ba[\"{{{BH@h{KEhAHOj}}BEId}OCf}\",[]]Df[\"{{{BH@h{c}}e}{{BH@h{e}}}{}{}}\",[\"Calculus::Arena\",\"Calculus::Term\"]]Ch[\"{{{BH@h{AHOf}}{OCb{c}}}{{BH@h{{OCb{c}}}}}BHDn}\",[\"T\"]]Aa[\"{BIKdBH@h}\",[]]Aa[\"{BDDbBH@h}\",[]]Aa[\"{AOHfBH@h}\",[]]Aa[\"{BIJ`BH@h}\",[]]Aa[\"{BINjBH@h}\",[]]Aa[\"{BHElBH@h}\",[]]Aa[\"{BIKfBH@h}\",[]]Aa[\"{BIObBH@h}\",[]]Aa[\"{BJJbBH@h}\",[]]Aa[\"{BKBfBH@h}\",[]]Bg[\"{{{BH@h{AHOh}}OCd}{{BH@h{OCd}}}}\",[]]Aa[\"{BIJbBH@h}\",[]]Aa[\"{BINlBH@h}\",[]]Aa[\"{BHEnBH@h}\",[]]Aa[\"{BIKhBH@h}\",[]]Aa[\"{BIOdBH@h}\",[]]Aa[\"{BJJdBH@h}\",[]]Ba[\"{{{BH@h{KEhAHOj}}BEId}OCf}\",[]]Bd[\"{{{BH@h{BEFd}}}{{BH@h{LF`}}}}\",[]]000Aa[\"{BEIhAOEb}\",[]]Aa[\"{BEIjAOEb}\",[]]10101010AJg[\"{{{BH@h{c}}}{{BEIf{{BEEj{}{{NOl{c}}{EEb{e}}{MCd{g}}{AIKl{i}}{AHMd{k}}{AIDb{m}}{AI@d{o}}{AIEh{Aa}}{CJh{Ac}}{AICh{Ae}}{LOh{Ag}}{BDDn{Ai}}{B@A`{Ak}}}}}}}MGnMGnAIBbAIBb{}{}MGnMGnMGn{}MGn{}{}}\",[\"Calculus::Term\",\"Calculus::Val\",\"Calculus::Clos\",\"Calculus::Stack\",\"Calculus::Arena\",\"Calculus::Error\",\"Calculus::Bound\",\"Calculus::Field\",\"Calculus::Dot\",\"Calculus::Entry\",\"Calculus::Args\",\"Calculus::TermExt\",\"Calculus::ValExt\"]]000Da[\"{{{BH@h{{OCb{MHh}}}}{BH@h{AHOf}}}{{AONl{{OCb{MHh}}BGJn}}}}\",[]]0Co[\"{{{BH@h{EGd}}{BH@h{AINb}}{BH@h{AHOf}}}{{AONl{EGdBGJn}}}}\",[]]101010Bj[\"{{{BH@h{MCb}}c}{{BH@h{KEhc}}}{}}\",[\"T\"]]De[\"{{{BH@h{KEhBDBj}}{BH@h{MEf}}EGd{BH@h{AHOf}}}{{AONl{EGdBGKn}}}}\",[]]Cf[\"{{{BH@h{MEf}}EGd{BH@h{AHOf}}}{{AONl{EGdBGKn}}}}\",[]]Cf[\"{{{BH@h{MEh}}EGf{BH@h{AHOh}}}{{AONl{EGfBGL`}}}}\",[]]Ca[\"{{MEjEGh{BH@h{KEhAHOj}}}{{AONl{EGhBGLb}}}}\",[]]Ag[\"{{BH@hBH@h}AONl}\",[]]4321043210432104321Eh[\"{{EGde}{{AONl{{AOE`{{BH@h{EGd}}{BH@h{MEf}}}}c}}}{}{{AOGb{EGd}{{AOKb{c}}}}}}\",[\"E\",\"\"]]Eh[\"{{EGfe}{{AONl{{AOE`{{BH@h{EGf}}{BH@h{MEh}}}}c}}}{}{{AOGb{EGf}{{AOKb{c}}}}}}\",[\"E\",\"\"]]10101010Aa[\"{AIAfBH@h}\",[]]Aa[\"{AIGdBH@h}\",[]]10101010Bi[\"{{{BH@h{AHOf}}AIAf}{{BH@h{AIAf}}}}\",[]]0000Aa[\"{AOIdAOEb}\",[]]Ak[\"{{{BH@h{AJAf}}}AOEb}\",[]]1010101Fc[\"{{{BH@h{KEhBDC`}}{BH@h{{ANLj{{AOE`{{BH@h{AIGd}}{OCb{AIKb}}}}}}}}}{{AONl{{BH@h{BDBh}}BGJn}}}}\",[]]Em[\"{{{BH@h{{OCb{AIKb}}}}EGd{BH@h{AINb}}{BH@h{AINb}}{BH@h{AHOf}}}{{AONl{{OCb{MHh}}BGJn}}}}\",[]]Fd[\"{{{BH@h{{OCb{MHh}}}}EGd{BH@h{AINb}}{BH@h{AINb}}{BH@h{AHOf}}}{{AONl{{OCb{AIKb}}{BGNd{MHh}}}}}}\",[]]Do[\"{{{BH@h{OCd}}EGf{BH@h{AINd}}{BH@h{AINd}}{BH@h{AHOh}}}{{AONl{AHJdBGNf}}}}\",[]]3120312031203210Ak[\"{{{BH@h{BDBn}}}BDBn}\",[]]Ak[\"{{{BH@h{AJAf}}}AJAf}\",[]]1010101Ak[\"{{{BH@h{BEEf}}}BEEf}\",[]]Ak[\"{{{BH@h{BGJn}}}BGJn}\",[]]Ak[\"{{{BH@h{AOId}}}AOId}\",[]]Ak[\"{{{BH@h{AIO`}}}AIO`}\",[]]Ai[\"{{{BH@h{DDh}}}DDh}\",[]]Ak[\"{{{BH@h{BEHd}}}BEHd}\",[]]Ak[\"{{{BH@h{BHEh}}}BHEh}\",[]]Ak[\"{{{BH@h{BJCf}}}BJCf}\",[]]Ak[\"{{{BH@h{AJ@b}}}AJ@b}\",[]]Ai[\"{{{BH@h{NOh}}}NOh}\",[]]Ak[\"{{{BH@h{AIIn}}}AIIn}\",[]]Ai[\"{{{BH@h{NFn}}}NFn}\",[]]Ak[\"{{{BH@h{BGKn}}}BGKn}\",[]]Ak[\"{{{BH@h{AOMl}}}AOMl}\",[]]Cd[\"{{{BH@h{{BGNd{c}}}}}{{BGNd{c}}}{AIBbBHDn}}\",[\"T\"]]Ak[\"{{{BH@h{AIHj}}}AIHj}\",[]]Ai[\"{{{BH@h{NEd}}}NEd}\",[]]Ak[\"{{{BH@h{AIAf}}}AIAf}\",[]]Ak[\"{{{BH@h{AIGd}}}AIGd}\",[]]Ai[\"{{{BH@h{MHh}}}MHh}\",[]]Ak[\"{{{BH@h{AIKb}}}AIKb}\",[]]Cb[\"{{{BH@h{{OCb{c}}}}}{{OCb{c}}}{AIBbBHDn}}\",[\"T\"]]Ai[\"{{{BH@h{EGd}}}EGd}\",[]]Ai[\"{{{BH@h{MEf}}}MEf}\",[]]Ak[\"{{{BH@h{AINb}}}AINb}\",[]]Ak[\"{{{BH@h{BGL`}}}BGL`}\",[]]Ak[\"{{{BH@h{AOMn}}}AOMn}\",[]]Ak[\"{{{BH@h{BGNf}}}BGNf}\",[]]Ak[\"{{{BH@h{BEHf}}}BEHf}\",[]]Ak[\"{{{BH@h{BHEj}}}BHEj}\",[]]Ak[\"{{{BH@h{AJ@d}}}AJ@d}\",[]]Ai[\"{{{BH@h{NOj}}}NOj}\",[]]Ak[\"{{{BH@h{BDB`}}}BDB`}\",[]]Ai[\"{{{BH@h{NG`}}}NG`}\",[]]Ai[\"{{{BH@h{OCd}}}OCd}\",[]]Ai[\"{{{BH@h{EGf}}}EGf}\",[]]Ai[\"{{{BH@h{MEh}}}MEh}\",[]]Ak[\"{{{BH@h{AINd}}}AINd}\",[]]Ai[\"{{{BH@h{OCf}}}OCf}\",[]]Ai[\"{{{BH@h{EGh}}}EGh}\",[]]Ai[\"{{{BH@h{MEj}}}MEj}\",[]]Ak[\"{{{BH@h{AINf}}}AINf}\",[]]Ai[\"{{{BH@h{NBl}}}NBl}\",[]]Ak[\"{{{BH@h{BEId}}}BEId}\",[]]Ak[\"{{{BH@h{BDFj}}}BDFj}\",[]]Ai[\"{{{BH@h{NCf}}}NCf}\",[]]Ak[\"{{{BH@h{BGLb}}}BGLb}\",[]]Ag[\"{{{BH@h{Kf}}}Kf}\",[]]Ak[\"{{{BH@h{BGJn}}}BGJn}\",[]]Ak[\"{{{BH@h{AOId}}}AOId}\",[]]Ak[\"{{{BH@h{AIO`}}}AIO`}\",[]]Ai[\"{{{BH@h{DDh}}}DDh}\",[]]Ak[\"{{{BH@h{BEHd}}}BEHd}\",[]]Ak[\"{{{BH@h{BHEh}}}BHEh}\",[]]Ak[\"{{{BH@h{BGLh}}}BGLh}\",[]]Ak[\"{{{BH@h{BJCf}}}BJCf}\",[]]Ai[\"{{{BH@h{N@n}}}N@n}\",[]]Ak[\"{{{BH@h{AJ@b}}}AJ@b}\",[]]Ai[\"{{{BH@h{NOh}}}NOh}\",[]]Ak[\"{{{BH@h{AIIn}}}AIIn}\",[]]Ai[\"{{{BH@h{NFn}}}NFn}\",[]]Ak[\"{{{BH@h{BGKn}}}BGKn}\",[]]Ak[\"{{{BH@h{AOMl}}}AOMl}\",[]]Cd[\"{{{BH@h{{BGNd{c}}}}}{{BGNd{c}}}{AIBbBHDn}}\",[\"T\"]]Ak[\"{{{BH@h{AIHj}}}AIHj}\",[]]Ai[\"{{{BH@h{NEd}}}NEd}\",[]]Ak[\"{{{BH@h{AIAf}}}AIAf}\",[]]Ak[\"{{{BH@h{AIGd}}}AIGd}\",[]]Ai[\"{{{BH@h{MHh}}}MHh}\",[]]Ak[\"{{{BH@h{AIKb}}}AIKb}\",[]]Cb[\"{{{BH@h{{OCb{c}}}}}{{OCb{c}}}{AIBbBHDn}}\",[\"T\"]]Ai[\"{{{BH@h{EGd}}}EGd}\",[]]Ai[\"{{{BH@h{MEf}}}MEf}\",[]]Ak[\"{{{BH@h{AINb}}}AINb}\",[]]Ak[\"{{{BH@h{BGL`}}}BGL`}\",[]]Ak[\"{{{BH@h{AOMn}}}AOMn}\",[]]Ak[\"{{{BH@h{BGNf}}}BGNf}\",[]]Ak[\"{{{BH@h{BEHf}}}BEHf}\",[]]Ak[\"{{{BH@h{BHEj}}}BHEj}\",[]]Ak[\"{{{BH@h{AJ@d}}}AJ@d}\",[]]Ai[\"{{{BH@h{NOj}}}NOj}\",[]]Ak[\"{{{BH@h{BDB`}}}BDB`}\",[]]Ai[\"{{{BH@h{NG`}}}NG`}\",[]]Ai[\"{{{BH@h{OCd}}}OCd}\",[]]Ai[\"{{{BH@h{EGf}}}EGf}\",[]]Ai[\"{{{BH@h{MEh}}}MEh}\",[]]Ak[\"{{{BH@h{AINd}}}AINd}\",[]]Ai[\"{{{BH@h{OCf}}}OCf}\",[]]Ai[\"{{{BH@h{EGh}}}EGh}\",[]]Ai[\"{{{BH@h{MEj}}}MEj}\",[]]Ak[\"{{{BH@h{AINf}}}AINf}\",[]]Ai[\"{{{BH@h{NBl}}}NBl}\",[]]Ak[\"{{{BH@h{BEId}}}BEId}\",[]]Ak[\"{{{BH@h{BDFj}}}BDFj}\",[]]Ai[\"{{{BH@h{NCf}}}NCf}\",[]]Ak[\"{{{BH@h{BGLb}}}BGLb}\",[]]Ag[\"{{{BH@h{Kf}}}Kf}\",[]]Ak[\"{{{BH@h{BHE`}}}BHE`}\",[]]Ak[\"{{{BH@h{BGJn}}}BGJn}\",[]]Ak[\"{{{BH@h{AOId}}}AOId}\",[]]Ak[\"{{{BH@h{AIO`}}}AIO`}\",[]]Ai[\"{{{BH@h{DDh}}}DDh}\",[]]Ak[\"{{{BH@h{BEHd}}}BEHd}\",[]]Ak[\"{{{BH@h{BHEh}}}BHEh}\",[]]Ak[\"{{{BH@h{BGLh}}}BGLh}\",[]]Ak[\"{{{BH@h{BJCf}}}BJCf}\",[]]Ai[\"{{{BH@h{N@n}}}N@n}\",[]]Ak[\"{{{BH@h{AJ@b}}}AJ@b}\",[]]Ai[\"{{{BH@h{NOh}}}NOh}\",[]]Ak[\"{{{BH@h{AIIn}}}AIIn}\",[]]Ai[\"{{{BH@h{NFn}}}NFn}\",[]]Ak[\"{{{BH@h{BGKn}}}BGKn}\",[]]Ak[\"{{{BH@h{AOMl}}}AOMl}\",[]]Cd[\"{{{BH@h{{BGNd{c}}}}}{{BGNd{c}}}{AIBbBHDn}}\",[\"T\"]]Ak[\"{{{BH@h{AIHj}}}AIHj}\",[]]Ai[\"{{{BH@h{NEd}}}NEd}\",[]]Ak[\"{{{BH@h{AIAf}}}AIAf}\",[]]Ak[\"{{{BH@h{AIGd}}}AIGd}\",[]]Ai[\"{{{BH@h{MHh}}}MHh}\",[]]Ak[\"{{{BH@h{AIKb}}}AIKb}\",[]]Cb[\"{{{BH@h{{OCb{c}}}}}{{OCb{c}}}{AIBbBHDn}}\",[\"T\"]]Ai[\"{{{BH@h{EGd}}}EGd}\",[]]Ai[\"{{{BH@h{MEf}}}MEf}\",[]]Ak[\"{{{BH@h{AINb}}}AINb}\",[]]Ak[\"{{{BH@h{BGL`}}}BGL`}\",[]]Ak[\"{{{BH@h{AOMn}}}AOMn}\",[]]Ak[\"{{{BH@h{BGNf}}}BGNf}\",[]]Ak[\"{{{BH@h{BEHf}}}BEHf}\",[]]Ak[\"{{{BH@h{BHEj}}}BHEj}\",[]]Ak[\"{{{BH@h{AJ@d}}}AJ@d}\",[]]Ai[\"{{{BH@h{NOj}}}NOj}\",[]]Ak[\"{{{BH@h{BDB`}}}BDB`}\",[]]Ai[\"{{{BH@h{NG`}}}NG`}\",[]]Ai[\"{{{BH@h{OCd}}}OCd}\",[]]Ai[\"{{{BH@h{EGf}}}EGf}\",[]]Ai[\"{{{BH@h{MEh}}}MEh}\",[]]Ak[\"{{{BH@h{AINd}}}AINd}\",[]]Ai[\"{{{BH@h{OCf}}}OCf}\",[]]Ai[\"{{{BH@h{EGh}}}EGh}\",[]]Ai[\"{{{BH@h{MEj}}}MEj}\",[]]Ak[\"{{{BH@h{AINf}}}AINf}\",[]]Ai[\"{{{BH@h{NBl}}}NBl}\",[]]Ak[\"{{{BH@h{BEId}}}BEId}\",[]]Ak[\"{{{BH@h{BDFj}}}BDFj}\",[]]Ai[\"{{{BH@h{NCf}}}NCf}\",[]]Ak[\"{{{BH@h{BGLb}}}BGLb}\",[]]Ag[\"{{{BH@h{Kf}}}Kf}\",[]]Ak[\"{{{BH@h{BHE`}}}BHE`}\",[]]Ak[\"{{{BH@h{BGJn}}}BGJn}\",[]]Ak[\"{{{BH@h{AOId}}}AOId}\",[]]Ak[\"{{{BH@h{AIO`}}}AIO`}\",[]]Ai[\"{{{BH@h{DDh}}}DDh}\",[]]Ak[\"{{{BH@h{BEHd}}}BEHd}\",[]]Ak[\"{{{BH@h{BHEh}}}BHEh}\",[]]Ak[\"{{{BH@h{BGLh}}}BGLh}\",[]]Ak[\"{{{BH@h{BJCf}}}BJCf}\",[]]Ai[\"{{{BH@h{N@n}}}N@n}\",[]]Ak[\"{{{BH@h{AJ@b}}}AJ@b}\",[]]Ai[\"{{{BH@h{NOh}}}NOh}\",[]]Ak[\"{{{BH@h{AIIn}}}AIIn}\",[]]Ai[\"{{{BH@h{NFn}}}NFn}\",[]]Ak[\"{{{BH@h{BGKn}}}BGKn}\",[]]Ak[\"{{{BH@h{AOMl}}}AOMl}\",[]]Cd[\"{{{BH@h{{BGNd{c}}}}}{{BGNd{c}}}{AIBbBHDn}}\",[\"T\"]]Ak[\"{{{BH@h{AIHj}}}AIHj}\",[]]Ai[\"{{{BH@h{NEd}}}NEd}\",[]]Ak[\"{{{BH@h{AIAf}}}AIAf}\",[]]Ak[\"{{{BH@h{AIGd}}}AIGd}\",[]]Ai[\"{{{BH@h{MHh}}}MHh}\",[]]Ak[\"{{{BH@h{AIKb}}}AIKb}\",[]]Cb[\"{{{BH@h{{OCb{c}}}}}{{OCb{c}}}{AIBbBHDn}}\",[\"T\"]]Ai[\"{{{BH@h{EGd}}}EGd}\",[]]Ai[\"{{{BH@h{MEf}}}MEf}\",[]]Ak[\"{{{BH@h{AINb}}}AINb}\",[]]Ak[\"{{{BH@h{BGL`}}}BGL`}\",[]]Ak[\"{{{BH@h{AOMn}}}AOMn}\",[]]Ak[\"{{{BH@h{BGNf}}}BGNf}\",[]]Ak[\"{{{BH@h{BEHf}}}BEHf}\",[]]Ak[\"{{{BH@h{BHEj}}}BHEj}\",[]]Ak[\"{{{BH@h{AJ@d}}}AJ@d}\",[]]Ai[\"{{{BH@h{NOj}}}NOj}\",[]]Ak[\"{{{BH@h{BDB`}}}BDB`}\",[]]Ai[\"{{{BH@h{NG`}}}NG`}\",[]]Ai[\"{{{BH@h{OCd}}}OCd}\",[]]Ai[\"{{{BH@h{EGf}}}EGf}\",[]]Ai[\"{{{BH@h{MEh}}}MEh}\",[]]Ak[\"{{{BH@h{AINd}}}AINd}\",[]]Ai[\"{{{BH@h{OCf}}}OCf}\",[]]Ai[\"{{{BH@h{EGh}}}EGh}\",[]]Ai[\"{{{BH@h{MEj}}}MEj}\",[]]Ak[\"{{{BH@h{AINf}}}AINf}\",[]]Ai[\"{{{BH@h{NBl}}}NBl}\",[]]Ak[\"{{{BH@h{BEId}}}BEId}\",[]]Ak[\"{{{BH@h{BDFj}}}BDFj}\",[]]Ai[\"{{{BH@h{NCf}}}NCf}\",[]]Ak[\"{{{BH@h{BGLb}}}BGLb}\",[]]Ag[\"{{{BH@h{Kf}}}Kf}\",[]]Ak[\"{{{BH@h{BHE`}}}BHE`}\",[]]Ak[\"{{{BH@h{BGJn}}}BGJn}\",[]]Ak[\"{{{BH@h{AOId}}}AOId}\",[]]Ak[\"{{{BH@h{AIO`}}}AIO`}\",[]]Ai[\"{{{BH@h{DDh}}}DDh}\",[]]Ak[\"{{{BH@h{BEHd}}}BEHd}\",[]]Ak[\"{{{BH@h{BHEh}}}BHEh}\",[]]Ak[\"{{{BH@h{BGLh}}}BGLh}\",[]]Ak[\"{{{BH@h{BJCf}}}BJCf}\",[]]Ai[\"{{{BH@h{N@n}}}N@n}\",[]]Ak[\"{{{BH@h{AJ@b}}}AJ@b}\",[]]Ai[\"{{{BH@h{NOh}}}NOh}\",[]]Ak[\"{{{BH@h{AIIn}}}AIIn}\",[]]Ai[\"{{{BH@h{NFn}}}NFn}\",[]]Ak[\"{{{BH@h{BGKn}}}BGKn}\",[]]Ak[\"{{{BH@h{AOMl}}}AOMl}\",[]]Cd[\"{{{BH@h{{BGNd{c}}}}}{{BGNd{c}}}{AIBbBHDn}}\",[\"T\"]]Ak[\"{{{BH@h{AIHj}}}AIHj}\",[]]Ai[\"{{{BH@h{NEd}}}NEd}\",[]]Ak[\"{{{BH@h{AIAf}}}AIAf}\",[]]Ak[\"{{{BH@h{AIGd}}}AIGd}\",[]]Ai[\"{{{BH@h{MHh}}}MHh}\",[]]Ak[\"{{{BH@h{AIKb}}}AIKb}\",[]]Cb[\"{{{BH@h{{OCb{c}}}}}{{OCb{c}}}{AIBbBHDn}}\",[\"T\"]]Ai[\"{{{BH@h{EGd}}}EGd}\",[]]Ai[\"{{{BH@h{MEf}}}MEf}\",[]]Ak[\"{{{BH@h{AINb}}}AINb}\",[]]Ak[\"{{{BH@h{BGL`}}}BGL`}\",[]]Ak[\"{{{BH@h{AOMn}}}AOMn}\",[]]Ak[\"{{{BH@h{BGNf}}}BGNf}\",[]]Ak[\"{{{BH@h{BEHf}}}BEHf}\",[]]Ak[\"{{{BH@h{BHEj}}}BHEj}\",[]]Ak[\"{{{BH@h{AJ@d}}}AJ@d}\",[]]Ai[\"{{{BH@h{NOj}}}NOj}\",[]]Ak[\"{{{BH@h{BDB`}}}BDB`}\",[]]Ai[\"{{{BH@h{NG`}}}NG`}\",[]]Ai[\"{{{BH@h{OCd}}}OCd}\",[]]Ai[\"{{{BH@h{EGf}}}EGf}\",[]]Ai[\"{{{BH@h{MEh}}}MEh}\",[]]Ak[\"{{{BH@h{AINd}}}AINd}\",[]]Ai[\"{{{BH@h{OCf}}}OCf}\",[]]Ai[\"{{{BH@h{EGh}}}EGh}\",[]]Ai[\"{{{BH@h{MEj}}}MEj}\",[]]Ak[\"{{{BH@h{AINf}}}AINf}\",[]]Ai[\"{{{BH@h{NBl}}}NBl}\",[]]Ak[\"{{{BH@h{BEId}}}BEId}\",[]]Ak[\"{{{BH@h{BDFj}}}BDFj}\",[]]Ai[\"{{{BH@h{NCf}}}NCf}\",[]]Ak[\"{{{BH@h{BGLb}}}BGLb}\",[]]Ag[\"{{{BH@h{Kf}}}Kf}\",[]]Ak[\"{{{BH@h{BHE`}}}BHE`}\",[]]Ak[\"{{{BH@h{AOGl}}}AOEb}\",[]]Ak[\"{{{BH@h{AINb}}}AOEb}\",[]]Ak[\"{{{BH@h{AINd}}}AOEb}\",[]]210210210210Be[\"{{{BH@h{AONh}}}{{BH@h{AHOf}}}}\",[]]0000Ai[\"{{}{{BH@h{AIHj}}}}\",[]]Ai[\"{{}{{BH@h{AIAf}}}}\",[]]Ai[\"{{}{{BH@h{AIGd}}}}\",[]]Ao[\"{{}c{}}\",[\"Calculus::Bound\"]]321032103210321A`[\"{BKBfNEd}\",[]]0000Bf[\"{{{BH@h{BDBn}}{BH@h{LF`}}}AHJd}\",[]]0000Ck[\"{{ce}g{}{}{}}\",[\"Calculus::Field\",\"X\",\"Calculus::Entry\"]]000Cl[\"{ce{{AOGb{}{{AOKb{{BGNd{MHh}}}}}}}{}}\",[\"\",\"Sink::Error\"]]0Ce[\"{ce{{AOGb{}{{AOKb{BGNf}}}}}{}}\",[\"\",\"Sink::Error\"]]011001100Bi[\"{{{BH@h{AHOf}}AIGd}{{BH@h{AIGd}}}}\",[]]0000o[\"{EGdEGd}\",[]]Al[\"{cc{}}\",[\"Calculus::Val\"]]01001001001Bi[\"{{{BH@h{AHOf}}AINb}{{BH@h{AINb}}}}\",[]]Bi[\"{{{BH@h{AHOh}}AINd}{{BH@h{AINd}}}}\",[]]Be[\"{{{BH@h{KEhAHOj}}AINfEGh}AINf}\",[]]210210210210Dc[\"{{{BH@h{KEhBEFd}}AOEb}{{AOK`{{AOE`{AOEbAOEb{BH@h{LF`}}}}}}}}\",[]]000Bm[\"{{{BH@h{AINb}}}{{AOK`{{BH@h{AIHj}}}}}}\",[]]A`[\"{MElAOK`}\",[]]10101010Fl[\"{{{BH@h{{OCb{MHh}}}}{BH@h{AINb}}{BH@h{AINb}}{BH@h{AHOf}}}{{AONl{{AOE`{{OCb{AIKb}}EGd}}{BGNd{MHh}}}}}}\",[]]Fe[\"{{{BH@h{{OCb{AIKb}}}}{BH@h{AINb}}{BH@h{AINb}}{BH@h{AHOf}}}{{AONl{{AOE`{{OCb{MHh}}EGd}}BGJn}}}}\",[]]Dk[\"{{{BH@h{OCd}}{BH@h{AINd}}{BH@h{AINd}}{BH@h{AHOh}}}{{AONl{EGfBGNf}}}}\",[]]120120120120Be[\"{{{BH@h{AJAf}}}{{AOK`{AOEb}}}}\",[]]Aa[\"{BIJlAOEb}\",[]]Aa[\"{BIJnAOEb}\",[]]210210210Bh[\"{{{BH@h{OCd}}{BH@h{KEhAHOj}}}OCf}\",[]]0000Ao[\"{{{BH@h{BDBn}}BDBn}AHJd}\",[]]Bg[\"{{{BH@h{AJAf}}{BH@h{AJAf}}}AHJd}\",[]]1010101Aa[\"{AOIdAOEb}\",[]]0000Ea[\"{{c{BH@h{AHOf}}}{{AONl{{BH@h{{OCb{AIKb}}}}BHEh}}}{{BEGn{}{{N@f{NOh}}}}}}\",[\"\"]]Di[\"{{c{BH@h{AHOh}}}{{AONl{{BH@h{OCd}}BHEj}}}{{BEGn{}{{N@f{NOj}}}}}}\",[\"\"]]Bg[\"{{{BH@h{LF`}}}{{AONl{N@nBGLh}}}}\",[]]21021021021Ch[\"{{{BH@h{{OCb{c}}}}{BH@h{KEhBGLd}}NFn}AONjBHDn}\",[\"T\"]]Ea[\"{{{BH@h{OCd}}{BH@h{KEhBGLd}}{BH@h{KEhAOEb}}{BH@h{KEh{EJj{BDB`}}}}NG`}AONj}\",[]]10101010Ee[\"{{{BH@h{KEhAOOh}}EGd{BH@h{AINb}}{BH@h{AINb}}}{{AONl{{AOK`{{OCb{MHh}}}}BGJn}}}}\",[]]0000Ck[\"{{{BH@h{AOMl}}{BH@h{AHOf}}}{{AONl{{OCb{MHh}}BGKn}}}}\",[]]Dm[\"{{{BH@h{KEhBDBj}}{BH@h{EGd}}AOEb{BH@h{AHOf}}}{{AONl{{OCb{MHh}}BGKn}}}}\",[]]Cn[\"{{{BH@h{EGd}}AOEb{BH@h{AHOf}}}{{AONl{{OCb{MHh}}BGKn}}}}\",[]]Cd[\"{{{BH@h{AOMn}}{BH@h{AHOh}}}{{AONl{OCdBGL`}}}}\",[]]Cg[\"{{{BH@h{EGf}}AOEb{BH@h{AHOh}}}{{AONl{OCdBGL`}}}}\",[]]Ca[\"{{EGhLHj{BH@h{KEhAHOj}}}{{AONl{OCfBGLb}}}}\",[]]Ak[\"{{BH@hAOEbBH@h}AONl}\",[]]654321065432106543210654321Bi[\"{{OCf{BH@h{AHOj}}{BH@h{AHOh}}}OCd}\",[]]0000Am[\"{{{BH@h{KEhMCb}}}AHJd}\",[]]An[\"{{{BH@h{KEhAHOf}}}AHJd}\",[]]An[\"{{{BH@h{KEhAHOh}}}AHJd}\",[]]An[\"{{{BH@h{KEhAHOj}}}AHJd}\",[]]An[\"{{{BH@h{KEhBDBn}}}AHJd}\",[]]Ak[\"{{{BH@h{AJAf}}}AHJd}\",[]]4321043210432104321Cf[\"{{{BH@h{BHEb}}e}c{}{{AOGb{}{{AOKb{c}}}}}}\",[\"T\",\"\"]]0000Ee[\"{{{BH@h{c}}}{{AOE`{e{BH@h{g}}}}}{}{}{}}\",[\"Calculus::Entry\",\"Calculus::Field\",\"X\"]]000A`[\"{NOhAOEb}\",[]]Aa[\"{BJGnAOEb}\",[]]Aa[\"{BJJjAOEb}\",[]]A`[\"{NOjAOEb}\",[]]Aa[\"{BJH`AOEb}\",[]]Aa[\"{BJJlAOEb}\",[]]5Aa[\"{AOIfAOEb}\",[]]54321Aa[\"{BHE`AOEb}\",[]]716543207165432071654320Ak[\"{{{BH@h{AOOh}}}AIO`}\",[]]0000Ec[\"{{{BH@h{AHOf}}AOEb}{{BH@h{KEh{ANLj{{AOE`{{BH@h{AIGd}}{OCb{c}}}}}}}}}BHDn}\",[\"T\"]]Cc[\"{{{BH@h{AHOh}}AOEb}{{BH@h{KEh{ANLj{OCd}}}}}}\",[]]B`[\"{{{BH@h{KEhAHOj}}LHj}NBl}\",[]]Ee[\"{{{BH@h{c}}AOEb}{{BH@h{KEh{ANLj{e}}}}}{}{}}\",[\"Calculus::Arena\",\"Calculus::Entry\"]]321032103210321Bf[\"{{{BH@h{AOHf}}{BH@h{AHOf}}}EGd}\",[]]o[\"{MElEGd}\",[]]o[\"{MEnEGf}\",[]]210210210210Fa[\"{{EGde}{{AONl{{BH@h{{ANLj{{AOE`{{BH@h{AIGd}}MEf}}}}}}c}}}{}{{AOGb{EGd}{{AOKb{c}}}}}}\",[\"E\",\"\"]]Dm[\"{{EGfe}{{AONl{{BH@h{{ANLj{MEh}}}}c}}}{}{{AOGb{EGf}{{AOKb{c}}}}}}\",[\"E\",\"\"]]10101010Bk[\"{{{BH@h{N@n}}}{{AOK`{{BH@h{LF`}}}}}}\",[]]Bc[\"{{{BH@h{NEd}}}{{BH@h{LF`}}}}\",[]]101010Am[\"{BH@h{{BH@h{c}}}{}}\",[\"T\"]]00000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000Am[\"{{EGd{BH@h{AHOf}}}EGd}\",[]]Ck[\"{{c{BH@h{e}}}c{}{}}\",[\"Calculus::Val\",\"Calculus::Arena\"]]01001001001Cf[\"{{{BH@h{AINb}}{BH@h{AIAf}}EGd{BH@h{AHOf}}}AINb}\",[]]Bj[\"{{{BH@h{AINd}}EGf{BH@h{AHOh}}}AINd}\",[]]Fm[\"{{{BH@h{c}}eg{BH@h{i}}}c{}{}{}{}}\",[\"Calculus::Stack\",\"Calculus::Bound\",\"Calculus::Val\",\"Calculus::Arena\"]]21021021021Cd[\"{{{BH@h{{OCb{c}}}}}{{AOE`{AOEbAOEb}}}BHDn}\",[\"T\"]]00Bi[\"{{{BH@h{AHOf}}AOHf}{{BH@h{AOHf}}}}\",[]]0000Aj[\"{{{BH@h{AHOf}}}OMj}\",[]]0000Bh[\"{{{BH@h{KEhB@@b}}{BH@h{LF`}}}OMj}\",[]]000Eb[\"{{{BH@h{KEh{BGJj{c}}}}EGd{BH@h{AINb}}c{BH@h{AHOf}}}{{AONl{AHJdBGKn}}}{}}\",[\"T\"]]Bj[\"{{{BH@h{KEhBDBh}}{BH@h{AOHf}}}AHJd}\",[]]Dk[\"{{{BH@h{AIHj}}c{BH@h{AHOf}}}AIHj{{BINd{}{{N@f{{AOE`{NEdDJd}}}}}}}}\",[\"\"]]210210210210Ak[\"{{{BH@h{BDBn}}}AHJd}\",[]]0000Ch[\"{cN@n{{BINd{}{{N@f{{AOE`{{BH@h{LF`}}N@n}}}}}}}}\",[\"\"]]000Bb[\"{{{BH@h{LF`}}AOEbAOEb}AOEb}\",[]]000Bd[\"{{{BH@h{EGd}}{BH@h{EGd}}}OMj}\",[]]Bd[\"{{{BH@h{EGf}}{BH@h{EGf}}}OMj}\",[]]Ca[\"{{{BH@h{c}}{BH@h{c}}}OMj{}}\",[\"Calculus::Val\"]]21021021021Ak[\"{{{BH@h{AHOf}}}AONh}\",[]]0Db[\"{{{BH@h{AHOh}}e}c{}{{AOGb{{BH@h{AHOh}}}{{AOKb{c}}}}}}\",[\"T\",\"\"]]101010Bo[\"{{{BH@h{AHOf}}{BH@h{LF`}}}{{BH@h{LF`}}}}\",[]]000000000Bk[\"{{{BH@h{KEhBEFd}}B@@d}{{EJj{BHE`}}}}\",[]]000B`[\"{{{BH@h{AHOj}}NBlLHj}EGh}\",[]]0000Dg[\"{{{BH@h{AHOf}}AOEb}{{BH@h{KEh{ANLj{{AOE`{{BH@h{AIGd}}EGd}}}}}}}}\",[]]Cb[\"{{{BH@h{AINb}}}{{`{{BEGn{}{{N@f{EGd}}}}}}}}\",[]]Cc[\"{{{BH@h{AHOh}}AOEb}{{BH@h{KEh{ANLj{EGf}}}}}}\",[]]B`[\"{{{BH@h{KEhAHOj}}LHj}NBl}\",[]]Ee[\"{{{BH@h{c}}AOEb}{{BH@h{KEh{ANLj{e}}}}}{}{}}\",[\"Calculus::Arena\",\"Calculus::Entry\"]]4321043210432104321Ak[\"{{{BH@h{AHOf}}}AHOf}\",[]]0000Cn[\"{{EGde}{{AONl{AOEbc}}}{}{{AOGb{EGd}{{AOKb{c}}}}}}\",[\"E\",\"\"]]Cn[\"{{EGfe}{{AONl{AOEbc}}}{}{{AOGb{EGf}{{AOKb{c}}}}}}\",[\"E\",\"\"]]Df[\"{{{BH@h{c}}e}{{BH@h{e}}}{}{}}\",[\"Calculus::Arena\",\"Calculus::Clos\"]]Cf[\"{{{BH@h{AHOf}}e}c{}{{AOGb{}{{AOKb{c}}}}}}\",[\"T\",\"\"]]Cf[\"{{{BH@h{AHOh}}e}c{}{{AOGb{}{{AOKb{c}}}}}}\",[\"T\",\"\"]]n[\"{{}MCb}\",[]]o[\"{{}BHEb}\",[]]o[\"{{}AJAf}\",[]]Al[\"{{}{{AIKj{c}}}MGn}\",[\"T\"]]o[\"{{}AHOf}\",[]]Ak[\"{{}{{BGJj{c}}}{}}\",[\"T\"]]o[\"{{}BDBh}\",[]]o[\"{{}AOId}\",[]]o[\"{{}AIO`}\",[]]o[\"{{}AIHj}\",[]]o[\"{{}BDBj}\",[]]o[\"{{}AHOh}\",[]]o[\"{{}AHOj}\",[]]o[\"{{}BDBn}\",[]]Aa[\"{AIO`AOEb}\",[]]Ib[\"{{{BH@h{c}}{BH@h{e}}{BH@h{g}}}{{AONl{ik}}}{}{}{}{}{}}\",[\"Calculus::Term\",\"Calculus::Stack\",\"Calculus::Arena\",\"Calculus::Val\",\"Calculus::Error\"]]Ej[\"{{{BH@h{BHEb}}C@b{BH@h{c}}g}{{BH@h{e}}}{}{}{{AOGb{}{{AOKb{{BH@h{e}}}}}}}}\",[\"S\",\"T\",\"\"]]Be[\"{{{BH@h{BDC`}}}{{BH@h{BDBh}}}}\",[]]Aa[\"{BHE`B@@d}\",[]]Be[\"{{AOEbAOEb}{{BGNd{c}}}BHDn}\",[\"T\"]]Ag[\"{{AOEbAOEb}BGNf}\",[]]Ag[\"{{AOEbAOEb}AOEb}\",[]]Ca[\"{{AOEbAOEb}{{AONl{AOEb{BGNd{c}}}}}BHDn}\",[\"T\"]]Be[\"{{AOEbAOEb}{{AONl{AOEbBGNf}}}}\",[]]Bm[\"{{{BH@h{AHOf}}}{{AOK`{{BH@h{BDBn}}}}}}\",[]]Ao[\"{{{BH@h{AHOf}}AHOf}AHJd}\",[]]Ba[\"{{{BH@h{KEhAHOj}}NCf}AHJd}\",[]]Do[\"{{{BH@h{AHOf}}{BH@h{{ANLj{{BH@h{LF`}}}}}}}{{BH@h{{ANLj{{BH@h{LF`}}}}}}}}\",[]]B`[\"{{{BH@h{AHOj}}NBlLHj}OCf}\",[]]Ak[\"{{{BH@h{AHOf}}}AOEb}\",[]]Aa[\"{BH@hB@@n}\",[]]000000000000000000000000000000000000000000000000000000000000000000000Bo[\"{{{BH@h{{OCb{c}}}}}{{BH@h{LF`}}}BHDn}\",[\"T\"]]Bc[\"{{{BH@h{EGd}}}{{BH@h{LF`}}}}\",[]]A`[\"{BHDjLHj}\",[]]Cc[\"{{{BH@h{N@n}}}{{AOK`{{BH@h{{ANLj{N@n}}}}}}}}\",[]]Bd[\"{{{BH@h{N@n}}}{{AOK`{AOEb}}}}\",[]]Dg[\"{{{BH@h{{OCb{MHh}}}}EGd{BH@h{AINb}}{BH@h{AINb}}{BH@h{AHOf}}}OMj}\",[]]D`[\"{{{BH@h{OCd}}EGf{BH@h{AINd}}{BH@h{AINd}}{BH@h{AHOh}}}OMj}\",[]]Ee[\"{{{BH@h{c}}AOEb}{{BH@h{KEh{ANLj{e}}}}}{}{}}\",[\"Calculus::Arena\",\"Calculus::Entry\"]]Dg[\"{{{BH@h{AHOf}}AOEb}{{BH@h{KEh{ANLj{{AOE`{{BH@h{AIGd}}MEf}}}}}}}}\",[]]Cc[\"{{{BH@h{AHOh}}AOEb}{{BH@h{KEh{ANLj{MEh}}}}}}\",[]]Gi[\"{{{BH@h{c}}{BH@h{c}}AOEb{BH@h{e}}}{{AONl{{AOK`{OMj}}g}}}{}{}{}}\",[\"Calculus::Val\",\"Calculus::Arena\",\"Calculus::Error\"]]0A`[\"{NEdBGJn}\",[]]Hm[\"{{c{BH@h{e}}{BH@h{g}}}{{AONl{ik}}}{}{}{}{}{}}\",[\"Calculus::TermExt\",\"Calculus::Stack\",\"Calculus::Arena\",\"Calculus::Val\",\"Calculus::Error\"]]Aj[\"{{{BH@h{AJAf}}}OMj}\",[]]Aa[\"{AIO`AOEb}\",[]]Bc[\"{{cc}OMj{}}\",[\"Calculus::Field\"]]Aa[\"{AOIdAOEb}\",[]]Em[\"{{{BH@h{{BGJj{c}}}}{BH@h{{OCb{MHh}}}}{BH@h{AINb}}{BH@h{AHOf}}}{{EJj{{BH@h{c}}}}}{}}\",[\"T\"]]Be[\"{{{BH@h{{AIKj{c}}}}}OMjMGn}\",[\"T\"]]Bd[\"{{{BH@h{{BGJj{c}}}}}OMj{}}\",[\"T\"]]Aj[\"{{{BH@h{BDBh}}}OMj}\",[]]Ai[\"{{{BH@h{NEd}}}OMj}\",[]]Aj[\"{{{BH@h{AINb}}}OMj}\",[]]Aj[\"{{{BH@h{AINd}}}OMj}\",[]]A`[\"{AINfOMj}\",[]]Ck[\"{{AOEb{EJj{{OCb{c}}}}{BH@h{AHOf}}}{{OCb{c}}}BHDn}\",[\"T\"]]AIm[\"{{{BDFl{{BEEj{}{{NOl{c}}{EEb{e}}{MCd{g}}{AIKl{i}}{AHMd{k}}{AIDb{m}}{AI@d{o}}{AIEh{Aa}}{CJh{Ac}}{AICh{Ae}}{LOh{Ag}}{BDDn{Ai}}{B@A`{Ak}}}}}}}eMGnMGnAIBbAIBb{}{}MGnMGnMGn{}MGn{}{}}\",[\"Calculus::Term\",\"Calculus::Val\",\"Calculus::Clos\",\"Calculus::Stack\",\"Calculus::Arena\",\"Calculus::Error\",\"Calculus::Bound\",\"Calculus::Field\",\"Calculus::Dot\",\"Calculus::Entry\",\"Calculus::Args\",\"Calculus::TermExt\",\"Calculus::ValExt\"]]Bm[\"{{{BH@h{BEHd}}AOEb}{{AOE`{AOEbAOEb}}}}\",[]]Bm[\"{{{BH@h{BHEh}}AOEb}{{AOE`{AOEbAOEb}}}}\",[]]Bm[\"{{{BH@h{BEHf}}AOEb}{{AOE`{AOEbAOEb}}}}\",[]]Bm[\"{{{BH@h{BHEj}}AOEb}{{AOE`{AOEbAOEb}}}}\",[]]Bl[\"{{{BH@h{LF`}}AOEb}{{AOE`{AOEbAOEb}}}}\",[]]Bi[\"{{{BH@h{BEIb}}{BH@h{AHOf}}}c{}}\",[\"T\"]]Bg[\"{{{BH@h{BGJn}}{BH@h{AHOf}}}BGJn}\",[]]C`[\"{{{BH@h{c}}{BH@h{AHOf}}}c{}}\",[\"Sink::Error\"]]Bg[\"{{{BH@h{BGKn}}{BH@h{AHOf}}}BGKn}\",[]]Bg[\"{{{BH@h{AOMl}}{BH@h{AHOf}}}AOMl}\",[]]2Cj[\"{{{BH@h{{BGNd{c}}}}{BH@h{AHOf}}}{{BGNd{c}}}BHDn}\",[\"T\"]]Ch[\"{{{BH@h{{OCb{c}}}}{BH@h{AHOf}}}{{OCb{c}}}BHDn}\",[\"T\"]]Be[\"{{{BH@h{EGd}}{BH@h{AHOf}}}EGd}\",[]]Be[\"{{{BH@h{MEf}}{BH@h{AHOf}}}MEf}\",[]]Bg[\"{{{BH@h{AINb}}{BH@h{AHOf}}}AINb}\",[]]Bh[\"{{c{BH@h{AHOh}}}c{}}\",[\"Sink::Error\"]]Ao[\"{{BGL`{BH@h{AHOh}}}BGL`}\",[]]Bg[\"{{{BH@h{AOMn}}{BH@h{AHOh}}}AOMn}\",[]]2Ao[\"{{BGNf{BH@h{AHOh}}}BGNf}\",[]]Be[\"{{{BH@h{OCd}}{BH@h{AHOh}}}OCd}\",[]]Be[\"{{{BH@h{EGf}}{BH@h{AHOh}}}EGf}\",[]]Be[\"{{{BH@h{MEh}}{BH@h{AHOh}}}MEh}\",[]]Bg[\"{{{BH@h{AINd}}{BH@h{AHOh}}}AINd}\",[]]Bg[\"{{{BH@h{AHOf}}{AOK`{AOEb}}}AHJd}\",[]]Be[\"{{AOEbAOEb}{{BGNd{c}}}BHDn}\",[\"T\"]]Ag[\"{{AOEbAOEb}BGNf}\",[]]Dh[\"{{AOEbEGd{BH@h{AINb}}{BH@h{AINb}}{BH@h{AHOf}}}{{BGNd{c}}}BHDn}\",[\"T\"]]Cj[\"{{AOEbEGf{BH@h{AINd}}{BH@h{AINd}}{BH@h{AHOh}}}BGNf}\",[]]Dl[\"{{NEd{BH@h{{OCb{AIKb}}}}EGd{BH@h{AINb}}{BH@h{AINb}}{BH@h{AHOf}}}BGJn}\",[]]21Ag[\"{{AOEbAOEb}AOEb}\",[]]Ca[\"{{AOEbAOEb}{{AONl{AOEb{BGNd{c}}}}}BHDn}\",[\"T\"]]Be[\"{{AOEbAOEb}{{AONl{AOEbBGNf}}}}\",[]]Ac[\"{BH@hc{}}\",[\"T\"]]00000000000000000000000000000000000000000000000000B`[\"{c{{AONl{e}}}{}{}}\",[\"U\",\"T\"]]000000000000000000000000000000000000000000000000000000000000000000000Ak[\"{{}{{AONl{c}}}{}}\",[\"U\"]]000000000000000000000000000000000000000000000000000000000000000000000G`[\"{{AOEbc{BH@h{e}}{BH@h{g}}}i{}{}{}{}}\",[\"Calculus::Val\",\"Calculus::Stack\",\"Calculus::Arena\",\"Calculus::Error\"]]Bn[\"{{AOEbEGd{BH@h{AINb}}{BH@h{AHOf}}}BGKn}\",[]]Bn[\"{{AOEbEGf{BH@h{AINd}}{BH@h{AHOh}}}BGL`}\",[]]210AJg[\"{{{BH@h{c}}}{{BDFl{{BEEj{}{{NOl{e}}{EEb{c}}{MCd{g}}{AIKl{i}}{AHMd{k}}{AIDb{m}}{AI@d{o}}{AIEh{Aa}}{CJh{Ac}}{AICh{Ae}}{LOh{Ag}}{BDDn{Ai}}{B@A`{Ak}}}}}}}MGnMGnAIBbAIBb{}{}MGnMGnMGn{}MGn{}{}}\",[\"Calculus::Val\",\"Calculus::Term\",\"Calculus::Clos\",\"Calculus::Stack\",\"Calculus::Arena\",\"Calculus::Error\",\"Calculus::Bound\",\"Calculus::Field\",\"Calculus::Dot\",\"Calculus::Entry\",\"Calculus::Args\",\"Calculus::TermExt\",\"Calculus::ValExt\"]]Ca[\"{{{BH@h{MCb}}{BH@h{LF`}}}{{BH@h{KEhLF`}}}}\",[]]?>Bg[\"{{AOEbAOEb}c{}}\",[\"Calculus::Error\"]]Ag[\"{{AOEbAOEb}BGKn}\",[]]Ag[\"{{AOEbAOEb}BGL`}\",[]]210Aa[\"{AIO`AOEb}\",[]]Aa[\"{{}c{}}\",[\"I\"]]Aj[\"{{{BH@h{AHOf}}}OMj}\",[]]Cg[\"{{{BH@h{AHOf}}AOEb}{{AOK`{{BH@h{{OCb{MHh}}}}}}}}\",[]]Gd[\"{{cAOEb{BH@h{e}}}{{AONl{gi}}}{}{}{}{}}\",[\"Calculus::ValExt\",\"Calculus::Arena\",\"Calculus::Term\",\"Calculus::Error\"]]Ha[\"{{{BH@h{c}}AOEb{BH@h{e}}}{{AONl{{BH@h{g}}i}}}{}{}{}{}}\",[\"Calculus::Val\",\"Calculus::Arena\",\"Calculus::Term\",\"Calculus::Error\"]]0Bg[\"{{{BH@h{AJAf}}{AOK`{AOEb}}}AHJd}\",[]]Aa[\"{BH@hB@@d}\",[]]000000000000000000Cf[\"{{{BH@h{MCb}}c}{{AONl{{BH@h{KEhc}}BEEf}}}{}}\",[\"T\"]]o[\"{{}AOEb}\",[]]Bi[\"{{}{{AONl{AOEb{BGNd{c}}}}}BHDn}\",[\"T\"]]Am[\"{{}{{AONl{AOEbBGNf}}}}\",[]]Ao[\"{AOEb{{BGNd{c}}}BHDn}\",[\"T\"]]Aa[\"{AOEbBGNf}\",[]]Ak[\"{AOEb{{AOK`{AOEb}}}}\",[]]Bk[\"{AOEb{{AONl{AOEb{BGNd{c}}}}}BHDn}\",[\"T\"]]Ao[\"{AOEb{{AONl{AOEbBGNf}}}}\",[]]Ak[\"{{{BH@h{AHOf}}}AOEb}\",[]]Ak[\"{{{BH@h{AHOh}}}AOEb}\",[]]Ak[\"{{{BH@h{AHOj}}}AOEb}\",[]]Dc[\"{{{BH@h{MCb}}e}{{BH@h{KEhc}}}{}{{AOGb{}{{AOKb{c}}}}}}\",[\"T\",\"F\"]]Bi[\"{{{BH@h{KEh}}}{{BH@h{KEhc}}}{}}\",[\"T\"]]000000000000000000000000000000000000000000000000000000000000000000000432Be[\"{{{BH@h{AHOf}}}{{AOK`{AOEb}}}}\",[]]Be[\"{{{BH@h{AHOh}}}{{AOK`{AOEb}}}}\",[]]Ei[\"{{{BH@h{{OCb{MHh}}}}EGd{BH@h{AINb}}{BH@h{AINb}}{BH@h{AHOf}}}{{AONl{{OCb{AIKb}}}}}}\",[]]Dk[\"{{{BH@h{OCd}}EGf{BH@h{AINd}}{BH@h{AINd}}{BH@h{AHOh}}}{{AONl{AHJd}}}}\",[]]Fi[\"{{{BH@h{{OCb{AIKb}}}}EGd{BH@h{BDBh}}{BH@h{AINb}}{BH@h{AINb}}{BH@h{AHOf}}}{{AONl{{OCb{MHh}}BGJn}}}}\",[]]Bd[\"{{BH@h{BH@h{KEhc}}}AHJd{}}\",[\"T\"]]00000000000000000000000000000000000000000000000000:98Bk[\"{{EGd{BH@h{AHOf}}}{{AONl{EGdBGKn}}}}\",[]]Fa[\"{{{BH@h{{OCb{MHh}}}}{BH@h{AINb}}{BH@h{AINb}}{BH@h{AHOf}}}{{AONl{{AOE`{{OCb{AIKb}}EGd}}}}}}\",[]]Dg[\"{{{BH@h{OCd}}{BH@h{AINd}}{BH@h{AINd}}{BH@h{AHOh}}}{{AONl{EGf}}}}\",[]]Ga[\"{{{BH@h{{OCb{AIKb}}}}{BH@h{BDBh}}{BH@h{AINb}}{BH@h{AINb}}{BH@h{AHOf}}}{{AONl{{AOE`{{OCb{MHh}}EGd}}BGJn}}}}\",[]]>>Bi[\"{{{BH@h{AHOf}}AOEb}{{AOK`{AOEb}}}}\",[]]Bi[\"{{{BH@h{AHOf}}AIHj}{{BH@h{AIHj}}}}\",[]]Ak[\"{{{BH@h{AHOf}}}AOEb}\",[]]Ak[\"{{{BH@h{AHOh}}}AOEb}\",[]]An[\"{{{BH@h{AHOf}}OMj}AHJd}\",[]]Bg[\"{{{BH@h{KEhAHOj}}NBlLHjEGh}AHJd}\",[]]332Ak[\"{{{BH@h{AHOj}}}AOEb}\",[]]Bf[\"{{{AOK`{{AOE`{AOEbOMl}}}}}BEHd}\",[]]Aj[\"{{{AOK`{NOh}}}BHEh}\",[]]Bf[\"{{{AOK`{{AOE`{AOEbOMl}}}}}BGLh}\",[]]Bf[\"{{{AOK`{{AOE`{AOEbOMl}}}}}BEHf}\",[]]Aj[\"{{{AOK`{NOj}}}BHEj}\",[]]?9859Eg[\"{{{BH@h{AINb}}NEd{BH@h{AINb}}{BH@h{AHOf}}}{{AOK`{{AOE`{AOEb{AOK`{AOEb}}EGd}}}}}}\",[]]Ec[\"{{{BH@h{KEh{BGJj{c}}}}{BH@h{{OCb{MHh}}}}{BH@h{AINb}}c{BH@h{AHOf}}}AHJd{}}\",[\"T\"]]An[\"{{{BH@h{AHOf}}AOEb}OMj}\",[]]o[\"{{}BGKn}\",[]]Bo[\"{{{BH@h{NFn}}{BH@h{NFn}}}{{AOK`{BEHl}}}}\",[]]Bo[\"{{{BH@h{NEd}}{BH@h{NEd}}}{{AOK`{BEHl}}}}\",[]]Bo[\"{{{BH@h{NG`}}{BH@h{NG`}}}{{AOK`{BEHl}}}}\",[]]Bm[\"{{{BH@h{Kf}}{BH@h{Kf}}}{{AOK`{BEHl}}}}\",[]]Ed[\"{{{BH@h{{OCb{c}}}}EGd{BH@h{AINb}}{BH@h{AINb}}{BH@h{AHOf}}}{{BGNd{c}}}BHDn}\",[\"T\"]]Da[\"{{{BH@h{OCd}}EGf{BH@h{AINd}}{BH@h{AINd}}{BH@h{AHOh}}}BGNf}\",[]]Ci[\"{{{BH@h{BDBn}}}{{EJj{{AOE`{Kf{BH@h{LF`}}AOEb}}}}}}\",[]]Bg[\"{{{BH@h{KEhAHOj}}NBlLHjOCf}AHJd}\",[]]Ao[\"{{{BH@h{AHOf}}AOEb}AHJd}\",[]]Bg[\"{{{BH@h{MCb}}AOHj}{{BDBl{C@b}}}}\",[]]Bm[\"{{{BH@h{{OCb{c}}}}}{{BGNd{c}}}BHDn}\",[\"T\"]]Aj[\"{{{BH@h{OCd}}}BGNf}\",[]]Dj[\"{{{BH@h{AINb}}{BH@h{AIAf}}EGd{AOK`{{BH@h{AIHj}}}}{BH@h{AHOf}}}AINb}\",[]]Ak[\"{{{BH@h{AHOf}}}AOEb}\",[]]00Ak[\"{{{BH@h{AHOh}}}AOEb}\",[]]Df[\"{{{BH@h{c}}{BH@h{e}}}AHJd{}{}}\",[\"Calculus::Val\",\"Calculus::Arena\"]]0Dg[\"{{{BH@h{c}}{BH@h{e}}}AHJd{}{}}\",[\"Calculus::Term\",\"Calculus::Arena\"]]0Co[\"{{{BH@h{AHOf}}Kfc}AHJd{{AOGb{}{{AOKb{{BH@h{LF`}}}}}}}}\",[\"\"]]Cc[\"{{{BH@h{KEhc}}}{{AONn{{AOK`{B@@d}}}}}BDBb}\",[\"\"]]Bo[\"{{{BH@h{AHOf}}{BH@h{EGd}}}{{BH@h{EGd}}}}\",[]]Bo[\"{{{BH@h{AHOh}}{BH@h{EGf}}}{{BH@h{EGf}}}}\",[]]Dl[\"{{NEd{BH@h{{OCb{AIKb}}}}EGd{BH@h{AINb}}{BH@h{AINb}}{BH@h{AHOf}}}BGJn}\",[]]Ed[\"{{{BH@h{{OCb{c}}}}EGd{BH@h{AINb}}{BH@h{AINb}}{BH@h{AHOf}}}{{BGNd{c}}}BHDn}\",[\"T\"]]Da[\"{{{BH@h{OCd}}EGf{BH@h{AINd}}{BH@h{AINd}}{BH@h{AHOh}}}BGNf}\",[]]Ak[\"{{B@@dAOEbAOEb}BHEh}\",[]]Ak[\"{{B@@dAOEbAOEb}BHEj}\",[]]Bg[\"{{{BH@h{AHOf}}EGd}{{BH@h{EGd}}}}\",[]]Db[\"{{{BH@h{BDBn}}{BH@h{LF`}}{BH@h{KEhc}}}{{AONn{AHJd}}}AJAh}\",[\"\"]]Ak[\"{{{BH@h{BDC`}}}AOEb}\",[]]Ak[\"{{{BH@h{BEFd}}}AOEb}\",[]]Gb[\"{{{BH@h{BHEb}}C@b{BH@h{{ANLj{c}}}}g}{{BH@h{{ANLj{e}}}}}{}{}{{AOGb{}{{AOKb{{BH@h{{ANLj{e}}}}}}}}}}\",[\"S\",\"T\",\"\"]]De[\"{{{BH@h{AINb}}AOEb{AOK`{AOEb}}NEd{BH@h{AINb}}{BH@h{AHOf}}}OMj}\",[]]Aj[\"{{{BH@h{AHOf}}}FKb}\",[]]Cg[\"{{{BH@h{AHOf}}AOEb}{{AOK`{{BH@h{{OCb{MHh}}}}}}}}\",[]]Aa[\"{AOEbBGKn}\",[]]Aa[\"{AOEbBGL`}\",[]]Da[\"{{{BH@h{AHOf}}{BH@h{LF`}}e}c{}{{AOGb{}{{AOKb{c}}}}}}\",[\"T\",\"\"]]Bo[\"{{{BH@h{AHOf}}{BH@h{MEf}}}{{BH@h{MEf}}}}\",[]]Bo[\"{{{BH@h{AHOh}}{BH@h{MEh}}}{{BH@h{MEh}}}}\",[]]D`[\"{{{BH@h{AHOf}}{BH@h{{OCb{c}}}}}{{BH@h{{OCb{c}}}}}BHDn}\",[\"T\"]]Bo[\"{{{BH@h{AHOh}}{BH@h{OCd}}}{{BH@h{OCd}}}}\",[]]An[\"{{{BH@h{AHOf}}OMj}AHJd}\",[]]0Ch[\"{{{BH@h{AHOf}}{OCb{c}}}{{BH@h{{OCb{c}}}}}BHDn}\",[\"T\"]]Ed[\"{{{BH@h{{OCb{c}}}}EGd{BH@h{AINb}}{BH@h{AINb}}{BH@h{AHOf}}}{{BGNd{c}}}BHDn}\",[\"T\"]]Da[\"{{{BH@h{OCd}}EGf{BH@h{AINd}}{BH@h{AINd}}{BH@h{AHOh}}}BGNf}\",[]]Eg[\"{{{BH@h{{OCb{c}}}}EGdEGd{BH@h{AINb}}{BH@h{AINb}}{BH@h{AHOf}}}{{BGNd{c}}}BHDn}\",[\"T\"]]Dd[\"{{{BH@h{OCd}}EGfEGf{BH@h{AINd}}{BH@h{AINd}}{BH@h{AHOh}}}BGNf}\",[]]Aa[\"{AOEbBGJn}\",[]]A`[\"{AOEbMCb}\",[]]Cf[\"{{{BH@h{KEhc}}{BH@h{N@n}}}{{AONn{AHJd}}}AJAh}\",[\"\"]]Aj[\"{{{BH@h{MCb}}}AOEb}\",[]]Ak[\"{{{BH@h{AHOf}}}AHJd}\",[]]Ak[\"{{{BH@h{AHOh}}}AHJd}\",[]]Ca[\"{{{BH@h{AHOf}}{BH@h{AINb}}}{{BH@h{AINb}}}}\",[]]Ca[\"{{{BH@h{AHOh}}{BH@h{AINd}}}{{BH@h{AINd}}}}\",[]]Bg[\"{{{BH@h{AHOf}}{AOK`{AOEb}}}AHJd}\",[]]Bg[\"{{{BH@h{AHOh}}{AOK`{AOEb}}}AHJd}\",[]]Aa[\"{AIO`AOEb}\",[]]7Ba[\"{{BH@h{BDK`{KEhC@b}}}AHJd}\",[]]00000000000000000000000000000000000000000000000000Aj[\"{{{BH@h{AHOf}}}FKb}\",[]]Aj[\"{{{BH@h{AHOf}}}OMj}\",[]]Aj[\"{{{BH@h{AHOh}}}OMj}\",[]]Dd[\"{{EGd{BH@h{AINb}}{BH@h{AINb}}{BH@h{AHOf}}}{{BGNd{c}}}BHDn}\",[\"T\"]]Cf[\"{{EGf{BH@h{AINd}}{BH@h{AINd}}{BH@h{AHOh}}}BGNf}\",[]]n[\"{{}LHj}\",[]]Dc[\"{{{BH@h{MCb}}{BH@h{{ANLj{c}}}}}{{BH@h{KEh{ANLj{c}}}}}MGn}\",[\"T\"]]Bd[\"{{{BH@h{MCb}}}{{AOK`{AOEb}}}}\",[]]?>Bd[\"{{{BH@h{BDBn}}}{{EJj{AOEb}}}}\",[]]Dd[\"{{{BH@h{{OCb{c}}}}AOEbAOEb{BH@h{KEh{EJj{AOEb}}}}}AHJdBHDn}\",[\"T\"]]65Cc[\"{{{BH@h{MCb}}AOHj}{{AONl{{BDBl{C@b}}BEEf}}}}\",[]]o[\"{{}AOEb}\",[]]Dd[\"{{{BH@h{MCb}}{BH@h{{ANLj{c}}}}}{{BH@h{KEh{ANLj{c}}}}}AIBb}\",[\"T\"]]Eo[\"{{AOEb{AOK`{AOEb}}{BH@h{AINb}}{BH@h{AINb}}{BH@h{AHOf}}}{{AONl{{AOE`{{OCb{AIKb}}EGd}}}}}}\",[]]Fi[\"{{{BH@h{NEd}}{BH@h{BDBh}}{BH@h{AINb}}{BH@h{AINb}}{BH@h{AHOf}}}{{AONl{{AOE`{{OCb{MHh}}EGd}}BGJn}}}}\",[]]Ce[\"{{{BH@h{{OCb{c}}}}AOEbAOEb}{{BGNd{c}}}BHDn}\",[\"T\"]]Bb[\"{{{BH@h{OCd}}AOEbAOEb}BGNf}\",[]]Dj[\"{{{BH@h{c}}}{{AONl{AHJde}}}{}{}}\",[\"Calculus::Arena\",\"Calculus::Error\"]]Aj[\"{{{BH@h{AHOf}}}FKb}\",[]]Aj[\"{{{BH@h{AHOh}}}FKb}\",[]]Gc[\"{{AOEb{BH@h{{OCb{MHh}}}}{OCb{AIKb}}EGd{BH@h{AINb}}{BH@h{AINb}}{BH@h{AHOf}}}{{AONl{{AOE`{{OCb{AIKb}}EGd}}}}}}\",[]]Gm[\"{{{BH@h{NEd}}{BH@h{{OCb{AIKb}}}}{OCb{MHh}}EGd{BH@h{AINb}}{BH@h{AINb}}{BH@h{AHOf}}}{{AONl{{AOE`{{OCb{MHh}}EGd}}BGJn}}}}\",[]]Cc[\"{{{BH@h{{OCb{c}}}}NEdNEd}{{BGNd{c}}}BHDn}\",[\"T\"]]Ak[\"{{{BH@h{AHOf}}}AOEb}\",[]]Bf[\"{{{BH@h{MCb}}{AOK`{AOEb}}}AHJd}\",[]]Cg[\"{{{BH@h{MCb}}AOEbc}{{BH@h{KEh{ANLj{c}}}}}MGn}\",[\"T\"]]Ec[\"{{{BH@h{MCb}}AOEbe}{{BH@h{KEh{ANLj{c}}}}}{}{{AIGf{AOEb}{{AOKb{c}}}}}}\",[\"T\",\"F\"]]D`[\"{{{BH@h{MCb}}AOEb{BH@h{c}}}{{BH@h{KEh{ANLj{c}}}}}AIBb}\",[\"T\"]]Aj[\"{{{BH@h{MCb}}}AOEb}\",[]]")
\ No newline at end of file
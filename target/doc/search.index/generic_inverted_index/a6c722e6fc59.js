@@ -0,0 +1 @@
+rb_("RE5uADswAAABAABRAQYACQpMAXoOAAB+DgAAgg4AAIYOAAD9EwAAOzAAAAEAANMBMQCuBQAAwAUAANUFAADqBQAA/wUAAFQIBQBbCAAAXQgHAGYIBgBuCAwAfAgDAIEIAQCECAcAjQgUAKQIBwCtCAgAtwgMAMUIAwDKCAAAzAgIANYIFwDwCAYA+AgJAAMJDAARCQMAFgkAABgJCAAiCRcAPAkGAEQJCQBPCQwAXQkDAGIJAABkCQgAbgkWAIcJCACRCQgAmwkMAKkJAwCuCQEAsQkHALoJDgCqDgEArQ4BALAOAQCzDgEAQhIAAA4TMgCHE0UAOzAAAAEAAKIBDwA+BQAAUwUAAGgFAAB9BQAAvgUAANMFAADoBQAA/QUAAJQOAwAeEEwBQBIAAN0SAABBE0UA9hMAAPkTAAA6MAAAAQAAAAAAFQAQAAAAKwVABVUFagV/BW0ItggCCU4JmglxEXIRdBF1EXcReBF6EXsR4RL5EvwSHBQ7MAAAAQAAqAApAD8FAABUBQAAaQUAAH4FAABPBgAAWgYAAGUGAABwBgAA2QcDAPEHAAD1BwAA+QcAAP0HAAADCAAABggAAAkIAAAMCAAA/QsAABEMAAAlDAAAOQwAAJoOAQCeDgEAog4BAMQRAADHEQAAyhEAAM0RAAA5EgAAUhIAAOASAADuEgAA8BIAAPMSAAADEwAA9BMAABoUAAA2FEUAhBQyAAYVAwCkFQAAOjAAAAEAAAAAABEAEAAAAAgFEQUaBSMFDA2YDpkOnA6dDqAOoQ5lD2YPZw9oD6cSHxT/FDswAAABAABWACYABwUAABAFAAAZBQAAIgUAAM0JJwDWCwMAeA0AAH8NAACpDQAAsA0AANsNAADiDQAADQ4AABQOAAA/DgAARg4AAF8PBACXDwAAmw8AAJ8PAACjDwAAgxEAAIYRAACJEQAAjBEAAI8RAgD1EQAA+hEAAP8RAAAEEgAAOxIBAFUSAADUEgAACxMAAM0TAADQEwAAABQAAAsVAAA6MAAAAQAAAAAAMAAQAAAAXwN3A4ADqQOsA8cD0QP9AwAEGwQlBFEEVARvBHkEpQSoBMMEzQSTBZUFlwWZBZsF1QfWB9cH2Ae1C7YLtwu4C+oL/gsSDCYMOgy5EboRuxG8EdoS9BL1EhgUMhU5FaIVqRU6MAAAAQAAAAAAIgAQAAAAdgOBA8gD0gMcBCYEcAR6BMQEzgRPCFAIUQhSCFMIEA8SDxQPFg8YD9IR1BHWEdgRNhI3EkwS5xIBFAIUNRQKFSsVLhWsFTowAAABAAAAAAAKABAAAAADDwYPCQ8MDw8PFBWPFZQVmhWfFa4VOjAAAAEAAAAAABMAEAAAAAIPBQ8IDwsPDg8NEA8QERATEBUQohGlEagRqxGuEdcS2BIFEwgTmRUHlA8AAJgPAACcDwAAoA8AAKQPAABNEgAArRUAADowAAABAAAAAAAYABAAAAABBQkFEgUbBSQFKw0sDS0NLg0vDTANMQ0yDTMNNA2gEaMRphGpEawR3xLlFOwUDxUzFQYMEAAADhAAABAQAAASEAAAFBAAADUVAAABJRUAAATaAgAA3AIAAN4CAADgAgAAAAAAAAAAAAAAAAAAAAAAAAAAAAAFZgsAAGcLAABoCwAAaQsAAOgSAAAFXAwAAF0MAABeDAAAXwwAANMTAABBTG0AAAA7MAAAAQAASQACAJQOAwBBE0UAOjAAAAEAAAAAAAcAEAAAAHERchF0EXURdxF4EXoRexE6MAAAAQAAAAAAHwAQAAAATwZaBmUGcAbZB9oH2wfcB/EH9Qf5B/0HAwgGCAkIDAj9CxEMJQw5DJoOmw6eDp8Oog6jDjkSBhUHFQgVCRWkFTswAAABAAAJAAQAmA4BAJwOAQCgDgEAZQ8DADowAAABAAAAAAAaABAAAAAHBRAFGQUiBV8PYA9hD2IPYw+XD5sPnw+jD4MRhhGJEYwR9RH6Ef8RBBI7EjwS1BLNE9ATABQ7MAAAAQAACAADANUHAwC1CwMA2hIAADowAAABAAAAAAAPABAAAABPCFAIUQhSCFMI0hHUEdYR2BE2EjcSTBIBFAIUNRQrFQAHDRAAAA8QAAAREAAAExAAABUQAADXEgAA2BIAAAJNEgAArRUAADswAAABAAAJAAEAKw0JAAUMEAAADhAAABAQAAASEAAAFBAAAAElFQAABNoCAADcAgAA3gIAAOACAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAVmCwAAZwsAAGgLAABpCwAA6BIAAAVcDAAAXQwAAF4MAABfDAAA0xMAAE9lAAAABJQOAACVDgAAlg4AAJcOAAAAOjAAAAEAAAAAAAcAEAAAAPEH9Qf5B/0HAwgGCAkIDAgEZQ8AAGYPAABnDwAAaA8AADowAAABAAAAAAAKABAAAAAHBRAFGQUiBYMRhhGJEYwRzRPQEwAUOzAAAAEAAAgAAwDVBwMAtQsDANoSAAADTBIAAAEUAAACFAAAAALXEgAA2BIAAAFNEgAAAAABJRUAAATaAgAA3AIAAN4CAADgAgAAAAAAAAAAAAAAAAAAAAAAAAAAAAAFZgsAAGcLAABoCwAAaQsAAOgSAAAFXAwAAF0MAABeDAAAXwwAANMTAABKawAAAAAABPEHAAD1BwAA+QcAAP0HAAAAB4MRAACGEQAAiREAAIwRAADNEwAA0BMAAAAUAAAFtQsAALYLAAC3CwAAuAsAANoSAAADTBIAAAEUAAACFAAAAAAAAAAABNoCAADcAgAA3gIAAOACAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAVmCwAAZwsAAGgLAABpCwAA6BIAAAVcDAAAXQwAAF4MAABfDAAA0xMAAEZnAAAAAAAAAAAB2hIAAAFMEgAAAAAAAAAABNoCAADcAgAA3gIAAOACAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAVmCwAAZwsAAGgLAABpCwAA6BIAAAVcDAAAXQwAAF4MAABfDAAA0xMAAERvAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAVmCwAAZwsAAGgLAABpCwAA6BIAAAVcDAAAXQwAAF4MAABfDAAA0xMAADAwMDAwMDA=")
\ No newline at end of file
@@ -0,0 +1 @@
+rd_("an0000000000000000000000000000000000000000000000000b()b->bGc0000000000000bId000000000bIx000000000bOp0000bPi00000000000000000000000000000000000000000000000b[]bch0000000000000beq0000000000000000000000000000000000000000000000000000000000000000000000000bid0000bio00000bir0000bix000000000000000000000000bsz000000000bto000000000bty0000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000bu8cAnn0000000000000000000000000000cApp0000000000000000000000000000000000000cDef00000000000000cDot000000000cEnv000000000cExt0000000cFun00000000000000000000000000000000000000000000000cHyp0000cLet000000000000000000cLex00000000000cNil000000000cPos0000cSep000000000cSig0000000000000000000000000000000000000cTup0000000000000000000000000000000000000cVal0000000000000000000cVar00000000000000000000000cVeccadd000capp00000000ccmp0000000000000000000cend0000000000000000000000000000000000000cenv000000000cerr00000000000000000000000000000cesz000000000cety000000000cf32cfmt00000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000cfst000000000cget00000000000000000000000000000000000000000clen000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000clex000000000clvl00000000000000cmutcnew00000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000cpos000000000000000000csnd000000000cstrctok0000000000000000000cu32cval00000000000000000000000000000000000000000000000000000dArgs0000dAtom000000000dBody000000000dBool000dBumpdClos0000000000000000000dCons00000000000dConv0000dCopydCore0000dEval0000dFree000000000000000000dInit0000000000000000000000000000000000000dItemdJson000dKind000000000dList0000dMark0000dMeta000000000dName0000dNull000dPrec000000000dProj0000000000000000000000000000000000000000000000000000dSink00000dSpan000000000dTerm00000000000000000000000000000dType000000000dUnit000000000dUniv0000000000000000000000000000000000000dargs000dbeta000dbind0000dbody000000000dbooldchardclos000000000000000000dcons0000000000000dconv00000000000000000000000ddrop00000delab0000deval00000000000000000000000dexit0000dfind0000dfrom000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000dfuel000dhash000000000000000000000000000000000000000dhyps0000dinfo00000000000000dinto00000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000diter0000djsondlink0000dload0000dmake000dmark0000dmeta0000dname0000000000000000000000000000000000000000000000000dnext0000dnode000000000dopen000dpeak000dprev000000000000000000000000dpush000drule0000dsave0000dstep000dterm0000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000dtext000dunitduniv000000000dview000dzonk00000000eArena0000000000000000000eArray000eBound000000000eCheck0000eCloneeConst0000eDebugeEMPTY000eEntry0000eError0000000000eField00000000000000eFnMuteGlued0000eIndex0000eInfer0000eLexer0000eNamed000000000eSpine000eStack000000000000000000000eStats0000eToken000000000eTuple0000eUsage000eWriteealloceapply00000000000000000000000earena00000eas_pi000000000eattrs000000000ebound0000ebytes00000000echeck0000000000000000000echild00000000eclone0000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000edepth00000000000000ederef0000ediscreempty000000000000000000eename0000eenter0000eentry000eerror00000000000efield0000eforce000000000000eframe00000000000000ehover000eindex0000000000einfer00000000000000elimit00000000000elower0000emerge00000000enodes0000eparse0000000000000eprint000000000eprove0000equote000000000000000000000000000000000eraise0000ereset000000000000000000000000escope0000esliceesplit000estart0000000000000000000000000000000000000estats0000eterms000000000000000000etupleeusizeevalue00000000000000fFnOncefFrames0000fGlobal0000fHasherfLayoutfLimits0000fNumber00000000fObject000fOptionfOutputfPiForm00000000000fQuoted000000000fRegion0000fResult00fSearch0000fSenderfServer000fString0000fTypeIdfValExt0000fas_sig000000000fas_str0000000fborrow00000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000fcommon0000fdefine000000000000ferrors000fextend0000000000000fextent00fglobal0000fgluing0000fhandle000finsert00000000000000fkernel0000flookup0000fobject000foffset000fparserfptr_eq0000000000000fregion00000000fsearchfserver000fstring0000fsymbol0000fupdate000fval_at0000fvalues00000000000000000000000fworker0000fzenithgBindinggBufReadgCtxName0gGlobalsgMachinegNonNullgProfilegSessiongSigForm000gSigInit000gSigName0gSigProj000gTermExt0gTupInit00000gTupProj00000gValNodegValViewgas_univ0gbumpalogclosuregcompactgcopy_in0gdefault0000000000000gdroppedgeval_gcgforwardgglobals0gmachinegmessagegpi_form0gpi_univ00gpointergprintergprofile0greclaimgreleasegsessiongstringsgterm_atgthreadsgtype_id000000000000000000000000000000000000000000000000000000000000000000000gvariant0gversionhAllocErrhBadMagichCalculushCtxIndex000hDocumenthEnvIndex00000hGenLevel00000hIteratorhLexError000hNamedVar0hOrderinghRejected0hRelocatehTermNodehTermViewhUnivForm000has_arrayhas_usizehcalculushcheck_ok0hclosures00hconv_ext0hctx_nameheval_exthexceededhexpandedhfield_eqhfrontierhget_termhis_empty000000hlet_metahmake_valhposition0000hrelocate0000000000000000000hset_fuelhsig_form0hsig_init0hsig_namehsig_proj0hsig_univ00hsnapshothto_owned00000000000000000000000000000000000000000000000000htry_from000000000000000000000000000000000000000000000000000000000000000000000htry_into000000000000000000000000000000000000000000000000000000000000000000000htup_init00htup_proj00hview_valiDiscrTreeiElabError0iEvalError000000000iFormatteriJsonError0iLeftBrace0iLeftParen0iMalformed0iNamedProj0iOutOfFueliTypeError00000ialloc_strictx_index0ienv_index00igen_level00igeneratediinto_iterimemoisingimeta_typeiquote_extiquote_ref0ireferenceiset_limitito_string000000000000000000itry_allociunit_univ00iuniv_form0iuniv_univ00ival_count00jBadVersion0jDecorationjDiagnosticjForwardingjParseError000jPiExpected000jRightBrace0jRightParen0jalloc_withjborrow_mut000000000000000000000000000000000000000000000000000000000000000000000jbyte_count00jbyte_limit0jcheck_into0jcheck_withjclone_into00000000000000000000000000000000000000000000000000jclos_count00jforce_metajinfer_into0jinfer_withjmemo_countjmeta_countjmeta_scopejname_indexjpeak_bytes0jset_gluingjset_val_atjstep_countjterm_count00junexpected0000kAnnExpected000kLeftBracket0kOutOfMemory000kSigExpected00000kforce_spinekframe_count00kfreed_byteskget_by_namekinsert_termkmeta_solvedkout_of_fuelkpartial_cmp000kpi_expected0krule_countskset_term_atkset_threadslIntoIteratorlRightBracket0lTypeExpected000lTypeMismatch000lUnsolvedMeta0lalloc_layoutlann_expected0lbind_indexedlcopied_byteslintern_countllookup_count0lprofile_conv0lprofile_eval0lprofile_rulelread_messagelrelocate_val0lsig_expected00lundefined_id0lval_internedlwrite_foldedmPiAnnExpected000mSnapshotError0mUnexpectedEof00000mUnknownGlobal0mchecked_count0mforward_slicemis_name_validmmemo_hit_ratemmeta_solutionmout_of_memory0mprofile_scopemrelocate_clos0mrelocate_term0mset_interningmset_memoisingmterm_internedmtype_expected0mtype_mismatch0munsolved_metamwith_capacitymwrite_messagenSigAnnExpected000nUndefinedIdent000nUnexpectedChar00000nchunk_capacityninc_link_count0nrelocate_frame0nset_byte_limit0ntranspositionsoTupSizeMismatch000oUnexpectedToken000oallocated_bytesoclone_to_uninit00000000000000000000000000000000000000000000000000ointern_hit_rateoover_byte_limit0opi_ann_expected0A`SNAPSHOT_VERSIONA`TupFieldMismatch0A`alloc_slice_copyA`allocation_limitA`inc_lookup_count0A`lookup_histogramA`mentioned_fieldsA`sig_ann_expected0A`try_alloc_layoutAaExactSizeIteratorAaMAX_MESSAGE_BYTESAaalloc_slice_cloneAapresent_named_varAaresolve_named_varAatup_size_mismatch0Aawithin_byte_limitAbaverage_link_count0Abpresent_named_projAbresolve_named_projAbtup_field_mismatchAcunsolved_meta_countAdset_allocation_limitAealloc_slice_fill_copyAealloc_slice_fill_withAfalloc_slice_fill_cloneBballocated_bytes_including_metadata")
\ No newline at end of file
@@ -0,0 +1 @@
+rd_("an0000000000000000000000000000000000000000000000000b()b->bgc0000000000000bid000000000bix000000000bop0000bpi00000000000000000000000000000000000000000000000b[]bch0000000000000beq000000000000000000000000000000000000000000000000000000000000000000000000066666bio00000bir00007777777777777777777777777bsz000000000bto000000000bty0000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000bu8cann0000000000000000000000000000capp0000000000000000000000000000000000000cdef00000000000000cdot000000000cenv000000000cext0000000cfun00000000000000000000000000000000000000000000000chyp0000clet000000000000000000clex00000000000cnil000000000cpos0000csep000000000csig0000000000000000000000000000000000000ctup0000000000000000000000000000000000000cval0000000000000000000cvar00000000000000000000000cveccadd000capp00000000ccmp0000000000000000000cend0000000000000000000000000000000000000cenv000000000cerr00000000000000000000000000000cesz000000000cety000000000cf32cfmt00000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000cfst000000000cget00000000000000000000000000000000000000000clen000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000clex000000000clvl00000000000000cmutcnew00000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000cpos000000000000000000csnd000000000cstrctok0000000000000000000cu32cval00000000000000000000000000000000000000000000000000000dargs0000datom000000000dbody000000000dbool000dbumpdclos0000000000000000000dcons00000000000dconv0000dcopydcore0000deval0000dfree000000000000000000dinit0000000000000000000000000000000000000ditemdjson000dkind000000000dlist0000dmark0000dmeta000000000dname0000dnull000dprec000000000dproj0000000000000000000000000000000000000000000000000000dsink00000dspan000000000dterm00000000000000000000000000000dtype000000000dunit000000000duniv0000000000000000000000000000000000000dargs000dbeta000dbind0000dbody000000000dbooldchardclos000000000000000000dcons0000000000000dconv00000000000000000000000ddrop00000delab0000deval00000000000000000000000dexit0000dfind0000dfrom000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000dfuel000dhash000000000000000000000000000000000000000dhyps0000dinfo00000000000000dinto00000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000diter0000djsondlink0000dload0000dmake000dmark0000dmeta0000dname0000000000000000000000000000000000000000000000000dnext0000dnode000000000dopen000dpeak000dprev000000000000000000000000dpush000drule0000dsave0000dstep000dterm0000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000dtext000dunitduniv000000000dview000dzonk00000000earena0000000000000000000earray000ebound000000000echeck0000ecloneeconst0000edebugeempty000eentry0000eerror0000000000efield00000000000000efnmuteglued0000eindex0000einfer0000elexer0000enamed000000000espine000estack000000000000000000000estats0000etoken000000000etuple0000eusage000ewriteealloceapply00000000000000000000000earena00000daspi000000000eattrs000000000ebound0000ebytes00000000echeck0000000000000000000echild00000000eclone0000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000edepth00000000000000ederef0000ediscreempty000000000000000000eename0000eenter0000eentry000eerror00000000000efield0000eforce000000000000eframe00000000000000ehover000eindex0000000000einfer00000000000000elimit00000000000elower0000emerge00000000enodes0000eparse0000000000000eprint000000000eprove0000equote000000000000000000000000000000000eraise0000ereset000000000000000000000000escope0000esliceesplit000estart0000000000000000000000000000000000000estats0000eterms000000000000000000etupleeusizeevalue00000000000000ffnoncefframes0000fglobal0000fhasherflayoutflimits0000fnumber00000000fobject000foptionfoutputfpiform00000000000fquoted000000000fregion0000fresult00fsearch0000fsenderfserver000fstring0000ftypeidfvalext0000eassig000000000easstr0000000fborrow00000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000fcommon0000fdefine000000000000ferrors000fextend0000000000000fextent00fglobal0000fgluing0000fhandle000finsert00000000000000fkernel0000flookup0000fobject000foffset000fparsereptreq0000000000000fregion00000000fsearchfserver000fstring0000fsymbol0000fupdate000evalat0000fvalues00000000000000000000000fworker0000fzenithgbindinggbufreadgctxname0gglobalsgmachinegnonnullgprofilegsessiongsigform000gsiginit000gsigname0gsigproj000gtermext0gtupinit00000gtupproj00000gvalnodegvalviewfasuniv0gbumpalogclosuregcompactfcopyin0gdefault0000000000000gdroppedfevalgcgforwardgglobals0gmachinegmessagefpiform0fpiuniv00gpointergprintergprofile0greclaimgreleasegsessiongstringsftermatgthreadsftypeid000000000000000000000000000000000000000000000000000000000000000000000gvariant0gversionhallocerrhbadmagichcalculushctxindex000hdocumenthenvindex00000hgenlevel00000hiteratorhlexerror000hnamedvar0horderinghrejected0hrelocatehtermnodehtermviewhunivform000gasarraygasusize?gcheckok0hclosures00gconvext0gctxnamegevalexthexceededhexpandedgfieldeqhfrontierggettermgisempty000000gletmetagmakevalhposition0000hrelocate0000000000000000000gsetfuelgsigform0gsiginit0gsignamegsigproj0gsiguniv00hsnapshotgtoowned00000000000000000000000000000000000000000000000000gtryfrom000000000000000000000000000000000000000000000000000000000000000000000gtryinto000000000000000000000000000000000000000000000000000000000000000000000gtupinit00gtupproj00gviewvalidiscrtreeielaberror0ievalerror000000000iformatterijsonerror0ileftbrace0ileftparen0imalformed0inamedproj0ioutoffuelitypeerror00000hallocstrhctxindex0henvindex00hgenlevel00igeneratedhintoiterimemoisinghmetatypehquoteexthquoteref0ireferencehsetlimithtostring000000000000000000htryallochunituniv00hunivform0hunivuniv00hvalcount00jbadversion0jdecorationjdiagnosticjforwardingjparseerror000jpiexpected000jrightbrace0jrightparen0iallocwithiborrowmut000000000000000000000000000000000000000000000000000000000000000000000ibytecount00ibytelimit0icheckinto0icheckwithicloneinto00000000000000000000000000000000000000000000000000icloscount00iforcemetaiinferinto0iinferwithimemocountimetacountimetascopeinameindexipeakbytes0isetgluinghsetvalatistepcountitermcount00junexpected0000kannexpected000kleftbracket0koutofmemory000ksigexpected00000jforcespinejframecount00jfreedbytesigetbynamejinserttermjmetasolvedioutoffueljpartialcmp000jpiexpected0jrulecountsisettermatjsetthreadslintoiteratorlrightbracket0ltypeexpected000ltypemismatch000lunsolvedmeta0kalloclayoutkannexpected0kbindindexedkcopiedbyteskinterncountklookupcount0kprofileconv0kprofileeval0kprofilerulekreadmessagekrelocateval0ksigexpected00kundefinedid0kvalinternedkwritefoldedmpiannexpected000msnapshoterror0munexpectedeof00000munknownglobal0lcheckedcount0lforwardslicekisnamevalidkmemohitratelmetasolutionkoutofmemory0lprofilescopelrelocateclos0lrelocateterm0lsetinterninglsetmemoisinglterminternedltypeexpected0ltypemismatch0lunsolvedmetalwithcapacitylwritemessagensigannexpected000nundefinedident000nunexpectedchar00000mchunkcapacitylinclinkcount0mrelocateframe0lsetbytelimit0ntranspositionsotupsizemismatch000ounexpectedtoken000nallocatedbytesmclonetouninit00000000000000000000000000000000000000000000000000minternhitratemoverbytelimit0mpiannexpected0osnapshotversionA`tupfieldmismatch0nallocslicecopyoallocationlimitninclookupcount0olookuphistogramomentionedfieldsnsigannexpected0ntryalloclayoutAaexactsizeiteratoromaxmessagebytesoallocslicecloneopresentnamedvaroresolvenamedvarotupsizemismatch0owithinbytelimitA`averagelinkcount0A`presentnamedprojA`resolvenamedprojA`tupfieldmismatchAaunsolvedmetacountAbsetallocationlimitAballocslicefillcopyAballocslicefillwithAcallocslicefillcloneAoallocatedbytesincludingmetadata")
\ No newline at end of file
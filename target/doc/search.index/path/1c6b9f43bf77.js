@@ -0,0 +1 @@
+rd_("f[1,\"\"]0Bg[6,\"zenith::profile\",\"zenith::profile\"]1Ad[2,\"zenith::kernel\"]l[2,\"zenith\"]03g[17,\"\"]Bi[6,\"zenith::elab\",\"zenith::elab::search\"]Am[15,\"zenith::io::ParseError\"]Ba[15,\"zenith::kernel::ParseError\"]Bd[8,\"zenith::ir\",\"zenith::ir::index\"]4Bc[6,\"zenith::ir\",\"zenith::ir::term\"]Bk[6,\"zenith::kernel\",\"zenith::kernel::term\"]Cg[5,\"zenith::kernel::compact\",\"zenith::kernel::compact\"]Am[5,\"alloc::vec\",\"alloc::vec\"]<f[0,\"\"]==9Ag[5,\"bumpalo\",\"bumpalo\"]:Bc[5,\"zenith::ir\",\"zenith::ir::term\"]Bk[5,\"zenith::kernel\",\"zenith::kernel::term\"]5Ah[15,\"zenith::ir::Stack\"]Al[15,\"zenith::kernel::Stack\"]Bb[10,\"core::marker\",\"core::marker\"]4?Bc[6,\"zenith::io\",\"zenith::io::json\"]995Bf[6,\"zenith::io\",\"zenith::io::printer\"]Bi[6,\"zenith::kernel\",\"zenith::kernel::io\"]Bf[10,\"zenith::ir\",\"zenith::ir::errors\"]Bn[10,\"zenith::kernel\",\"zenith::kernel::errors\"]Be[5,\"zenith::io\",\"zenith::io::parser\"]Bi[5,\"zenith::kernel\",\"zenith::kernel::io\"]g[17,\"\"]Bc[6,\"zenith::ir\",\"zenith::ir::term\"]Bk[6,\"zenith::kernel\",\"zenith::kernel::term\"]Cg[5,\"zenith::kernel::compact\",\"zenith::kernel::compact\"]f[1,\"\"]0l[2,\"zenith\"]A`[2,\"zenith::io\"]A`[2,\"zenith::ir\"]Ad[2,\"zenith::kernel\"]48Bc[5,\"zenith::arena\",\"zenith::arena\"]Bl[5,\"zenith::kernel\",\"zenith::kernel::arena\"]7:Bc[5,\"zenith::ir\",\"zenith::ir::term\"]B`[10,\"core::clone\",\"core::clone\"]Al[10,\"core::fmt\",\"core::fmt\"]===2Al[10,\"core::ops\",\"core::ops\"]Bd[5,\"zenith::ir\",\"zenith::ir::index\"]Be[5,\"zenith::io\",\"zenith::io::parser\"]5Be[5,\"zenith::common\",\"zenith::common\"]g[17,\"\"];:Bc[6,\"zenith::ir\",\"zenith::ir::term\"]Bk[6,\"zenith::kernel\",\"zenith::kernel::term\"]Cg[5,\"zenith::kernel::compact\",\"zenith::kernel::compact\"]Bi[5,\"zenith::elab\",\"zenith::elab::search\"]Be[6,\"zenith::io\",\"zenith::io::parser\"]Bi[6,\"zenith::kernel\",\"zenith::kernel::io\"]7Ah[10,\"std::io\",\"std::io\"]Ad[2,\"zenith::kernel\"]l[2,\"zenith\"]Ab[2,\"zenith::elab\"]A`[2,\"zenith::ir\"]f[1,\"\"]00Al[10,\"core::ops\",\"core::ops\"]Bf[10,\"zenith::common\",\"zenith::common\"]Bc[5,\"zenith::ir\",\"zenith::ir::term\"]An[10,\"core::hash\",\"core::hash\"]Bo[5,\"core::alloc::layout\",\"core::alloc::layout\"]=Al[15,\"zenith::io::JsonError\"]Ba[6,\"core::option\",\"core::option\"]g[17,\"\"]Al[15,\"zenith::ir::TypeError\"]B`[15,\"zenith::kernel::TypeError\"]Be[5,\"zenith::ir\",\"zenith::ir::errors\"]Bm[5,\"zenith::kernel\",\"zenith::kernel::errors\"]Bc[5,\"zenith::arena\",\"zenith::arena\"]Ak[8,\"core::fmt\",\"core::fmt\"]Ba[6,\"core::result\",\"core::result\"]Be[8,\"std::io::error\",\"std::io::error\"]Bi[5,\"zenith::elab\",\"zenith::elab::search\"]Bg[5,\"std::sync::mpsc\",\"std::sync::mpsc\"]Be[5,\"zenith::server\",\"zenith::server\"]Bc[5,\"alloc::string\",\"alloc::string\"]Ak[5,\"core::any\",\"core::any\"]=l[2,\"zenith\"]Ab[2,\"zenith::elab\"]A`[2,\"zenith::io\"]A`[2,\"zenith::ir\"]Ad[2,\"zenith::kernel\"]4234f[3,\"\"]Bi[6,\"zenith::kernel\",\"zenith::kernel::io\"]Ah[10,\"std::io\",\"std::io\"]An[15,\"zenith::elab::ElabError\"]Bj[5,\"zenith::elab\",\"zenith::elab::globals\"]Bf[5,\"zenith::ir\",\"zenith::ir::machine\"]Bo[5,\"core::ptr::non_null\",\"core::ptr::non_null\"]Bg[5,\"zenith::profile\",\"zenith::profile\"]Bj[5,\"zenith::elab\",\"zenith::elab::session\"]Al[15,\"zenith::ir::TypeError\"]B`[15,\"zenith::kernel::TypeError\"]10710g[17,\"\"]Al[15,\"zenith::ir::EvalError\"]B`[15,\"zenith::kernel::EvalError\"]Bi[15,\"zenith::kernel::compact::EvalError\"]210Cg[6,\"zenith::kernel::compact\",\"zenith::kernel::compact\"]Bo[6,\"zenith::common\",\"zenith::common::calculus\"]f[3,\"\"]Ad[2,\"zenith::kernel\"]Ab[2,\"zenith::elab\"]A`[2,\"zenith::ir\"]f[1,\"\"]A`[2,\"zenith::io\"]l[2,\"zenith\"]4Ag[5,\"bumpalo\",\"bumpalo\"]C`[10,\"zenith::common\",\"zenith::common::calculus\"]Al[15,\"zenith::ir::TypeError\"]B`[15,\"zenith::kernel::TypeError\"]Be[5,\"zenith::server\",\"zenith::server\"]Al[15,\"zenith::ir::EvalError\"]B`[15,\"zenith::kernel::EvalError\"]Bi[15,\"zenith::kernel::compact::EvalError\"]210Db[10,\"core::iter::traits::iterator\",\"core::iter::traits::iterator\"]:>Be[6,\"zenith::io\",\"zenith::io::errors\"]Bm[6,\"zenith::kernel\",\"zenith::kernel::errors\"]Ak[6,\"core::cmp\",\"core::cmp\"]B`[15,\"zenith::io::SnapshotError\"]Bd[10,\"zenith::arena\",\"zenith::arena\"]Cg[6,\"zenith::kernel::compact\",\"zenith::kernel::compact\"]Bo[6,\"zenith::common\",\"zenith::common::calculus\"]=<Ad[2,\"zenith::common\"]A`[2,\"zenith::io\"]Bh[5,\"zenith::elab\",\"zenith::elab::discr\"]Ab[2,\"zenith::elab\"]Bi[6,\"zenith::elab\",\"zenith::elab::errors\"]A`[2,\"zenith::ir\"]Al[15,\"zenith::ir::TypeError\"]Ad[2,\"zenith::kernel\"]B`[15,\"zenith::kernel::TypeError\"]Am[2,\"zenith::kernel::compact\"]Be[6,\"zenith::ir\",\"zenith::ir::errors\"]Bm[6,\"zenith::kernel\",\"zenith::kernel::errors\"]=Ak[5,\"core::fmt\",\"core::fmt\"];Be[6,\"zenith::io\",\"zenith::io::errors\"]B`[15,\"zenith::io::SnapshotError\"]An[15,\"zenith::elab::ElabError\"]:854f[1,\"\"]2Bd[10,\"zenith::ir\",\"zenith::ir::term\"]Be[5,\"zenith::server\",\"zenith::server\"]Be[5,\"zenith::common\",\"zenith::common\"]A`[2,\"zenith::io\"]=79><><Al[15,\"zenith::ir::EvalError\"]B`[15,\"zenith::kernel::EvalError\"]7Al[15,\"zenith::ir::TypeError\"]?D`[10,\"core::iter::traits::collect\",\"core::iter::traits::collect\"]1B`[15,\"zenith::kernel::TypeError\"]20:205<;20Am[15,\"zenith::io::ParseError\"]Ba[15,\"zenith::kernel::ParseError\"]Al[15,\"zenith::io::JsonError\"]Ak[15,\"zenith::io::LexError\"]Ao[15,\"zenith::kernel::LexError\"]75437Df[10,\"core::iter::traits::exact_size\",\"core::iter::traits::exact_size\"]")
\ No newline at end of file
@@ -0,0 +1 @@
+rr_('{"normalizedName":{"I":"AAJuawAAOzAAAAEAAAgAAQBgDAgAAAEHADswAAABAAAFAAIAUBUDAKIVAQAAA2l0aAAAAQ4SAAAAUgABAqBwAAAVnW5pbQDyqA8AACgD8gACAGVvADswAAABAAATAAIADQEJAEQDCQABAQA7MAAAAQAAMgABAA4TMgATgAKwUBUhAAFlZwECADswAAABAABFAAEANhRFAAEBAPXvDgAAAQABAAEAAQABAgKgIAAAFCigQAAAFSVpcwFNEgAAAAZlc3NhZ2UAAAE5FQAAAAAFb2xkZWQAAAEUFQAAAPIDaXRlAgBmbQELDQAAAAAEcmtlcgAA9QkSAAABAAEAAQABAAAACm5ieXRlbGltaXQAAAGkFQAAAAAHYXBhY2l0eQAAATgVAAAA8gJ0aAIAY2kA9DUUAABOADoA8AD2BwAAAwWgIAAAE9Npb3JhZW1udgA7MAAAAQAAuAEFAKwFZQBcDAMAHhBMATUSAADKEgAAAQMA8x4UAAABAAEAAQAAOzAAAAEAAA4AAQCcBQ4AAQMAOzAAAAEAAAUAAgDLEgMAHBQBAAEDADswAAABAAAIAAIAshIFAPYTAgAAAmFsAAAB0xMAAADyAXcBAHb0XAwAAAEAAQABAPI1EgAAlQDygAEBZW4BhAKgMAAAFaigIAAAFaFwdgEAADswAAABAAAIAAIAuBIFAPkTAgABAwGgQAAAFapj8/wUAAABADoA8wABbQHmFAAAAANpb24AAAGpEgAA8yQUAAABAGwBEgABArCwFaUAAbCAFY0AAXNhYgA7MAAAAQAACwADAMUOAwD9DwMA2hEDAOYBAAACBMAAAAAC1LAQEtcAAWNyZGxueAA7MAAAAQAACQACAN8LBAAaDwQAAANhbnQAAPKnEgAAAQAA8gABAGk7MAAAAQAAFwABALwCFwD0wxIAAAEA3AIBAAADaWV3AAABNRIAAAAAAAAAOzAAAAEAABcAAQDxERcAAPIBZQEAczswAAABAAAOAAEAqQ8OAAAAA29kZQAAATQSAAAAAAZ0ZXJuZWQAAAETFQAAABKAAQGgAAAAFSZuZAEDADswAAABAAAJAAEA1xMJAAABdAAA9QcQAAABAAEAAQABAAHaEgAA8oABAXhyAARvdW50AADzIRQAAAEAAQAACAEAAPXsEQAAAQABAAEAAQABxRQAAPYHAAAHAaAQAAASTGFjZWludXZnOzAAAAEAAEkAAgCoAhMARQY1ADswAAABAAAiAAYAxAYEADIIFwDoEgAA0xMAAAgVAQAMFQEA8oACAGxy8gCDgxEBACAICAA7MAAAAQAAiQANAN0BCQAcAwkAuQYEAK8HJQAPCBcAvQsYAFIMCQA2EgEAVBICAAoTAgAZFAIAHhQCAAYVAQABAQGAEtQAEAFzATkSAAABAAA7MAAAAQAACQABAOUPCQATAgOgIAAAFACwIBQBAAFkZXI7MAAAAQAAIQABAB8PIQABAAGgIAAAEjhhAZgGAAABAgA7MAAAAQAACAABAMoPCABTgAOgIAAAErFiZXABAgA7MAAAAQAABQACAJcRBADEFAAAAQAA9NYLAAABAAEAAQAAAnplAAABqA8AAAHQEgAAAAJnZQAA9AcNAAABAAEAAQAA8gACAWFpaADyrBIAACUAAQsAOzAAAAEAAAUAAgBQFQMAohUBAAEDADswAAABAAAIAAIALhIFANATAgABAQA7MAAAAQAABQACAAINBACnDwAAAQMAOzAAAAEAAAgAAgAoEgUAzRMCAAEMAPOSFQAAAQAWAAEEAPQEFQAAAQCRAAEAAANhdGUAAPToEQAAAQABAAEAAHYPAACBh6CAAAAVmAgAAKSJAgA7MAAAAQAAKgACAIICJQC0EQQACAQAAAGqFQAAAPIJb2x2ZWRtZXRhAQBj8/wUAAABADoAAAAJb3duZ2xvYmFsAADyIRUAAAEAABKAAQGgcAAAFUhuYwECADswAAABAAAyAAEAWRUyAAADbml2AADzHhQAAAEAAQAAAANvcm0AADswAAABAAAFAAIAyxIDABwUAQAA8gACAGZ1OzAAAAEAAC8AAgCvByUAUgwJADswAAABAAANAAUANhIBAFQSAgAKEwIAGRQCAB4UAgAIAQAA8xkUAAABAAEAAPIAAQB1OzAAAAEAAAoAAgClBwkAUQwAAADygAIBdHZuAARva2VuAAD0VBUAAAEAAQABAAAAAm9mAAA7MAAAAQAABQABABsVBQAAAANoYXIAADswAAABAAAFAAEAQhUFAADyB3hwZWN0ZWQDAGNldPXKFAAAAQABAAEAAQAAAAJudAAA9D4VAAABAAEAAQAA8gdmaW5lZGlkAQBl8hEVAAABAADyAAEAZQA7MAAAAQAADgACAIEMCQA/DQQA9gEAAAUBYPu7piZPZGVpa3N0ADswAAABAAAvAAEA7wEvAMahA4AFCuMgAAAGRMAAAAABgKCwAAAVr0zZdpj5GqBAAAASEKAAAAAMlj/95F0AuyEXA9nBZDM4bnBzZGVmZ2lsbW9ydAEDAPMREgAAAQDHAAEEADswAAABAAAFAAIArRIDAPQTAQDzgAJpbgGAAqAwAAAUxaBQAAAVkWFlAQEAOzAAAAEAAAkAAQA1DQkAAQABoBAAABTvYfLfEgAABgLzAQFtAeETAABTgAOgUAAAFPBlaHIBAAGgoAAAFZ1pOzAAAAEAAA8ABADzDAQAjw8EAMUPBADuFAAAAQMA9OYTAAABAEwAAQATgAKgEAAAD9hhdQGEAqAwAAAVp6AgAAAVoHB2AYECoGAAABUxoBAAABLnbXQBAQA7MAAAAQAADgAGAPgUAwA1FQEAUBUDAJIVAQCiFQEAqRUAAAGAAqAwAAAU5LBgFU0AAW50AQIA9NMUAAABAB4AAQABAAD05BMAAAEATAABAPOCAmVr84ACcnkAB2lzbWF0Y2gAADswAAABAAAFAAIA+BQDADUVAQAAAAFkAAA7MAAAAQAARgACAAYQAABhEkUAAAAGcGVjdGVkAAA7MAAAAQAABQACAPQUAwAzFQEAAAADcm9yAAA7MAAAAQAABQABAO0TBQAA8oACAHJ4+hgDAGVpbTswAAABAAAJAAEAmwcJAAH/EwAA8gABAHA7MAAAAQAAXgABACEBXgA7MAAAAQAAKQAGAE4DCQCXDAMAdw4SAOASBgA4FQAASBUAAAECAPMZFAAAAQABAAALaXplbWlzbWF0Y2gAADswAAABAAAFAAIAUBUDAKIVAQAAAANyb2oAADswAAABAAAIAAIALhIFANATAgAACAIAADswAAABAAAFAAIAAg0EAKcPAAAAAANuaXQAADswAAABAAAIAAIAKBIFAM0TAgAAAAxpZWxkbWlzbWF0Y2gAAPOSFQAAAQAWAADyAIWAIIkCOzAAAAEAACUAAQCCAiUAAPKAAQFwbgEAADswAAABAAAJAAEANQ0JAAECAaAAAAASXnM7MAAAAQAAHAADAAEQBADeEQQABRQSAAEAADswAAABAAANAAEAwhENACOAAqAAAAAT1GVxAANudG8AADswAAABAABFAAEAhxNFAAAAA3JvbQAAOzAAAAEAAEUAAQBBE0UAAAAFYXlvdXQAAAGcFQAAAPIEbGxvYwEAbAEYFAAAAPIAAwBhZmkAOzAAAAEAAAgAAgCbDAQAlA4DAAAKc3Bvc2l0aW9ucwAAAU8VAAAAEoABAbAQFScAZW508gACA2F5ZWlzADswAAABAAAJAAMALwYAABYQBwDzEwAAAQUAOzAAAAEAADIAAQBZFTIAAQAAOzAAAAEAAAkAAQCABgkAAQMBoDAAABTxYQH9EwAAAQUAOzAAAAEAAAUAAgDVFAMAKRUBACOAArAwE+wA+2ZtAAV0cmluZwAAOzAAAAEAABIAAQAFFBIAAAAEd25lZAAAOzAAAAEAADIAAQAOEzIAAAABbgAAOzAAAAEAAAkAAQD4DAkA9FQVAAABAAEAAQDyAAEAZTswAAABAAATAAEAMAYTAAD2FgAAg4agMAAAFZiAEr4jMKwARAJgEQk7MAAAAQAACQABABcBCQA7MAAAAQAAyQEFAAkKTAGHE0UAgRQBAIQUMgC7FAEAAARlYWRzAAABYBIAAAHwFAAAEgABAqBwAAAVOKCgAAAVpHJjaQA7MAAAAQAAEwAGAGIODgAOEgAANRQAAIMUAAC9FAAArRUAAAEAAaEAAAAVr2k7MAAAAQAADgAGAEQNCADCFAEA4xQAAAIVAABYFQAAnhUAAAEAAaBAAAAUxmP05AsAAAEAAQABAAEAADswAAABAAANAAEAgRENABOAAoARjwAQAWR0AQABoFAAABU5ZQECBwAAAQQA938UAAABAM0AAQA/AAEAFgABgAKgQAAAFRSwMBVLAAFvcgEDAPN8FAAAAQABACOAArAgFSwAAWxvCCIAAPRNDAAAAQABAAEAAAGAhKBAAAAVA7AQFRMAH6BgAAAVjKAgAAAVMJQBAAEDAPO+EgAAMwKsAAgpAAAByhIAAAAAAAAAOzAAAAEAABIAAQCUDxIAAAgoAAAByRIAAAAAB250ZXJuZWQAAAEyFQAAAAACeHQAAPImEgAAAQAACCMAAPPHFAAAAQABAAAIBQAAAV8SAAAB7xQAAPIAx8BARQgJOzAAAAEAAIIAAgB9Bx0A6AtkAPTfEgAABgJJAAEAtgAAAAEEsBAUAQABsCAVGQABbWFlbnIAOzAAAAEAAA0ABQBWCwQAjw4EAFcSAQDhEwAA/RMAAHZ+AADCyxp7cQcKnaAgAAAUALAwFS4AAbAgFQwAAQAAgCAADy4LADswAAABAAA9AAcACw0AAB8PIQDoEQMAyBIAAO4SEwAnFQAAjBUAAPYb/gDGzlCEgSAqsqAwAAATAqBQAAAUxGBgD8ux8qBAAAAUBAAkkETAWS4rADswAAABAACdAz0A0wEJAOcBBwAkAhIAWQPRAasFAADcBiUAEQcEAKUHCQBKCAQApgsEAE0MBACRDAQAugwAAOMOCwAQDwkARg8YAGUPKQDEDwAA0w8DANgPAAD0DwIABxAEAI8RAgCgEQ4AuREHAOwRBAAcEgMAJhIHADoSAAA9Eg0AXxIAAKcSAQCxEgAA1xIBANoSAAAFEwEADRMAAM0TAgAAFAAABBQAACEUAgA2FEoAtxQCAL4UAQDFFAQA0xQBAOAUAgDvFAAA8hQBAP4UAAADFQIAIxUBAD4VAwBJFQEATRUBAFkVMgCNFQEAlRUCAJwVAACkFQIAqhUBAAEBAPP0DwAAAQABAFGAhACwIBI2AAF4oDAAABLQACgDAQQAOzAAAAEAAA4ABgD4FAMANRUBAFAVAwCSFQEAohUBAKkVAAABAQKwQBUZAAGgYAAAFZFldgENEwAAIwACoBAAAA/DZW87MAAAAQAAKwACAM0JJwDWCwMAAAAAADswAAABAAAJAAEADQEJADswAAABAAAJAAEARAMJAAAEbWJvbAAA9eMRAAABAAEAAQABAAAAAm5nAQDAAAAAEl5zOzAAAAEAAAkAAgABEAQA3hEEADswAAABAAASAAEABRQSAPIAAQBpAS8GAAA7MAAAAQAACAACABYQBwDzEwAACAMAAAHGFAAAAPIBcAEAY/TkCwAAAQABAAEAAAABcwAAOzAAAAEAAAkAAgDzDAQAjw8EAAAIBQAAOzAAAAEAACUAAQBpDyUAAAABawAAOzAAAAEAABUAAQDdDBUAAPKAAwBjcnR2AAAAAwKgEAAAFCegQAAAFZhhZXJpbwA7MAAAAQAAEwADAPcECQARBwQAkQwEAAACaXQAAPRlDwAAAQABAAEAAAgaAAD02QwAAAEAAQABAAHfFAAA8gABAG4AOzAAAAEAAAkAAQArDQkACBEAADswAAABAAAJAAEAcwcJAABygAMBoHAAABVPYWlsbwAAAAA7MAAAAQAACQABACUGCQAAAAZlcnNpb24AAAGRFQAAAAAEcnJvcgAA8hkVAAABAADyBHNob3QCAGV2AQ0TAAAAEoABAaBgAAAVJnBt8oACAGFkAYACoDAAABWuoCAAABWsbG8TgwKgMAAAFa1jdwGAAqAwAAAVn6AgAAAVlGxv8gNpY2UAAmNmAWQPAAABJRUAACEBAqBwAAAVncVpbfKoDwAAKAMBAwGgAAAAFU9z9ekSAAABAAEAAQABAAEBAPYXEgAARgBMAHsBAQBsAQAAAAA7MAAAAQAABQABAG0HBQAAEoABAqDgAAAVr7AAE/4BM2tjZwguAADzChMAAAEAAQAACCIAADswAAABAAAFAAIAIhIDAAgTAQAAAANhbWUAAPMgEgAAAQDmAAAIIgAAOzAAAAEAAAUAAgAcEgMABRMBAAAIMwAAOzAAAAEAAAUAAgAYEgMAAxMBAAAILwAAOzAAAAEAAAgAAgDZFAUADhUCAAAACm5uZXhwZWN0ZWQAADswAAABAAAFAAIAOhUDAJoVAQAA8gCHgDGhCDswAAABAAAlAAEAXAIlADswAAABAAAJAAEADBAJAPKAAgNnbm90egEDADswAAABAAAGAAEA4BIGAAEEAPQpFAAAAQABAAEAAARhbGF0AAABxRQAAAAABXJlYWRzAAAB8BQAAAAABHJtYXQAAAHvFAAAAPKAAgBlaAAIZW1vaXNpbmcAAAExFQAAAAAEaW1pdAAAAQQUAAAAAAhudGVybmluZwAAATAVAAAAAAVsdWluZwAAAcQUAAAAAAN1ZWwAAAECEwAAAAAIeXRlbGltaXQAAPJNFQAAAQAAAA5sbG9jYXRpb25saW1pdAAAAasVAAAA8gDJwMBYBgoAOzAAAAEAABwAAgBGDxgAvREDAAAEc2lvbgAA8hcSAABGAAABAAGgMAAAFOV0OzAAAAEAAA4AAQCgEQ4AAAJlcgAAOzAAAAEAAAcAAgD9DwMA2hEDAADyAAEBdnQAAcERAAAAAAAAOzAAAAEAAAkAAQBSAgkAAAGFAqAwAAAVp6AgAAAVoHB2CAAAAAH8DwAAAPKAAQFkdAADcmNoAAA7MAAAAQAABQACAPcPBADZEQAAAPIAhoIBoAcQEAAAOzAAAAEAABMAAwACDw0AQQ8EAFwSAAABAAGgMAAAE9R0AXYOAAABAgDztxQAAAEAAQAIGgAA9V8PAAABAAEAAQABAPLAFAAAawDygAEBcHXygAEBb3IBAQGgQAAAFZ5i9wcNAAABAAEAAQBHBboCLgAIAAAA9d8LAAABAAEAAQABAAAygAECoDAAABLPdmdy9v8EAIqFdWsE06J7cS5UVE+XFanEgFAKADswAAABAADXACEATQIEABIGEgB7BgQAmQYfANUHAwDuByAA9QkEAPMMBAA1DQkARA0IAP0OBACPDxcAuQ8EAMUPBAB9EQMA8REXABMSAABOEgEAXhIAAGASAACsEgAA0RIAANQSAgDCFAEA4xQAAO4UAADwFAAAAhUAACwVAQBPFQAAWBUAAJkVAACeFQAAEYAC7KAgAAAUvWFpAQIAOzAAAAEAAAcAAgD9DwMA2hEDAAEFAPToFAAAAQABAAEAEwADoCAAABPUoDAAABTlaXJ0OzAAAAEAADQAAgBpDyUAoBEOAAEAAPWvEQAAAQABAAEAAQAjgAKwABUTAB9kbCOAhKBAAAAVA6BgAAAVjKAgAAAVMJQBAAEBAPUJEgAAAQABAAEAAQDzAAFlOzAAAAEAAAkAAgAWBwQAagsEAAEAADswAAABAAAIAAIAewYEANUHAwABAAA7MAAAAQAACAABAPQOCADzgAJlcwEAA6BAAAASxaAgAAAUKKBAAAAVJWVpcwFNEgAAAQAAOzAAAAEAAAUAAgD3DwQA2REAAAEAAqAwAAAUuqBAAAAU321zOzAAAAEAAAwAAQCpDgwA84ACZWgABW91bnRzAAAB7hQAAADyAmxlAQBj9doLAAABAAEAAQABAAEKFQAAAQECoFAAABUUoGAAABU5Zm0BCw0AAAAEYXJlbgAA8jMUAAABAAAAAmV0AADy8hQAAAEAACKDcmFjAgDQABQxAAFla/KCaHQCAGJwkoABA7AgEqcAAVAFV84CFWdhbnQBAAA7MAAAAQAAGAABAL0LGAABAAA7MAAAAQAAGQACAGkMEwAlDQUAEwACoBAAABQDYWP05hMAAAEATAABAAEAAaBQAAAU42Q7MAAAAQAAEwACAMkGEgDUEwAAAAJsdAAA8/QPAAABAAEAAAACYXIAAAGhFQAAAAgdAAABqBUAAADyiGx2ZW5hbWVkAgBwdgGGAqAwAAAVp6AgAAAVoHB2AAAAADswAAABAAAYAAEARg8YAADygAEBdG7yAAMAZW91APPUEgAAAQABAAhiAADyDBUAAAEAAAADZXJtAADyLhUAAAEAAAAEcmFtZQAA8ksVAAABAAAAA2xvcwAA8iwVAAABAADyBGNhdGUEAGNmdHY7MAAAAQAAFAACAMgSAADuEhMAAAADYXNlAAABXBIAAADygAIAZW8ABWVjdGVkAADyxhIAAAEAAAhnAAA7MAAAAQAADQACAO8PBADQEQgAAAAFcmVuY2UAAAEDFAAAAPIAAQBlADswAAABAAAGAAIAcQ4EAAEUAQAAA2FpbQAAAVsSAAAA8gABAGwAOzAAAAEAAAkAAQAuBwkACHMAAAELFQAAABpSAQGwABJgApBtcwABEBIAAPAAx8QAAgQGBwgPFxitGkCZAgEABEgIADswAAABAAAFAAIAvwYEADkSAAABAAD1fQwAAAEAAQABAE8GAQEA874SAAAzAqwAAQABoAAAABP8ZPInFQAAZQBTgAOgIAAAFCZlaW8BAAD1uQ8AAAEAAQABAAEAAQQA8+AUAAABAAEA8wACY3M7MAAAAQAAEAACALYODgBLFQEA8wABZQGYFQAA8YACystlawACc2UAAPVBDwAAAQABAAEAAQAAtgYAgIGGsKAVpQABoKAAABVPAAEARDBE9l4cAMTOsIAVjQABNu0WMrbjGU3daXvCKpTPSPtMPEFdZY/EPLBG/zT8QEQABIATnVsAOzAAAAEAANMAIgDvAAQAvAIXACYDHQAvBgAA7QcAAFYLBACgDAoAxQwJAHYOAACPDgQAmA4LAMUOAwDUDg4A7w4EAMMPAADKDwgA/A8EABYQBwDBEQAA2hEDAAkSBABXEgEAqhIAAL4SBgDeEgAA1RMOAO0TBgD9EwAAKRQDAPEUAAAZFQEAQhUFAJ0VAACgFQEAAAJlZgAA8gEUAAABAAAIPwAAAQAUAAAAAAAAADswAAABAAAJAAEA5Q8JAADyA290ZQMAZGVyOzAAAAEAACEAAQAfDyEAAPIAAQB1ADswAAABAABYAAMAmgBJAMIRDQDdEgAAAQABsBASOwABafO+BgAA1g4YAAEKADswAAABAAAFAAIAUBUDAKIVAQABAgKwQBUZAAGgYAAAFZFldgENEwAA8wACaGn19QkAAAEAAQABAAEAAQAAOzAAAAEAABcAAQANDRcAAQEA9GUPAAABAAEAAQABAAA7MAAAAQAABQACAAINBACnDwAA84ADZWl5AQMA9OgRAAABAAEAAQABBAD1xhQAAD4AAQCRAAEAAAFoAAD01gsAAAEAAQABAAASgAEBoAAAAA/Yc3QBAAA7MAAAAQAAHQADAJcMAwB3DhIA4BIGAAEAADswAAABAAAOAAEAYg4OAAACZXEAADswAAABAAANAAEAwhENAACygAEDoCAAAA/XcmhpeQgcAAD1Gg8AAAEAAQABAAEAAAAAAAA7MAAAAQAANAABADgHNAA7MAAAAQAAEgAGACISAwAuEgUACBMBANATAgDqEwEApxUBAAAEY29wZQAAASsVAAAAAAN1bGUAAAEKFQAAAAADdmFsAADyCBUAAAEAAAADb252AADyBhUAAAEAAPIDaWxlhIAUAAPzFhIAAEMAAQAA8oADAGZqdghiAQDnIAAAElhlOzAAAAEAAAkAAQAQDwkAAAAAAAA7MAAAAQAAGAABAL0LGAAACBsAAAGgFQAAAAgbAAABpxUAAADyiGVudG5hbWVkAgBwdgAAAAA7MAAAAQAACQABAC4HCQAA8oADAGNzdvKAAwBlaW8ABHRpb24AAaAAAAAVT3P16RIAAAEAAQABAAEAAPIAAQBpOzAAAAEAABcAAgBNAgQAEgYSAAAABG50ZXIAAAFXEgAAAPKAAgBpcwEBADswAAABAAAIAAIAKBIFAM0TAgABAAD12QwAAAEAAQABAAMI84ACZWkIPgAA81QSAAABAAEAAAg7AAA7MAAAAQAADQACANkPCwBSEgEAAAhmAAA7MAAAAQAABQACAC0UAwDsFAEAABKAAQGgUAAAFQJ4ZAg7AAA7MAAAAQAABQACABUVAwCPFQEAAPIABAFhZWZ1bjswAAABAAAvAAEAWwAvADswAAABAAAJAAEAKw0JAAEAAPS1CwAAAQABAAEAAQcAOzAAAAEAAAUAAgD4FAMANRUBAAEBADswAAABAABGAAIABhAAAGESRQABBgA7MAAAAQAABQACAPQUAwAzFQEAAQMAOzAAAAEAAAUAAQDtEwUA84ACcngABHl0ZXMAAPLCFAAAAQAA+ksBAGL0uQsAAAEAAQABAACWBwAAgYZ9GWgLcvqgAAAAEksBAAAcMQAAOzAAAAEAABEABQCbBwkAXw8EAP8TAADAFAAAKxUAAAEAAaAgAAAS3GQ7MAAAAQAACQABAHMHCQABgAKwIBU4ABCgAAAAEjppdAEBAPTmEwAAAQBMAAEAAAZpYWxjbXAAAPToFAAAAQABAAEAAAhIAAD0KRQAAAEAAQABAAAaEwIAwAAAABHBZXI7MAAAAQAADQABAAIPDQAA8oACAXN0ZbKAAQOgEAAAEjhyY2xu9p8GAIeIATp9oU2+oIAAABWYTFzQXx6aEUENrIhCADswAAABAACQAAsAVgAEAJ4BJQAfAgQAUgIJAIICJQDZAhwAmAYAACcIBQDkCwMAtBEEAOgUAwABAgD1axEAAAEAAQABAAEAEwACoDAAABI6bXA7MAAAAQAAxAEDAIAGCQBUCHQBQRNFAAEAADswAAABAABHAAcAOAc0ACISAwAuEgUACBMBANATAgDqEwEApxUBAAECAaAwAAAU8WEB/RMAAEOAA6AwAAASV7AwE/4BM25zdAEBAPVhCwAAAQABAAEAAQAIOAAA8o0VAAABAADyAAEAYgD0xQ4AAAEAAQABAPoBAQByAPUaDwAAAQABAAEAAQABAwA7MAAAAQAAMgABAFkVMgABAAA7MAAAAQAADgACAIEMCQA/DQQAM4ADYPu7piZPZGl0AAJ1dAAAAdgPAAAAAAVlbW9yeQAAOzAAAAEAAAUAAgDVFAMAKRUBAAAIPQAA8uwTAAD7AADygWYCAGZt8gACAG9wAPPEDwAAOgWeAPKAAQF0bgEAADswAAABAAAFAAIA1RQDACkVAQABAwKgIAAAFCigQAAAFSVpcwFNEgAAAQAA9H0RAAABAAEAAQABAgEa/iQaVFVtOzAAAAEAAEwBAQAeEEwBAQACoEAAABPhsBAT6AABYWU7MAAAAQAAGQAGANkPCwAYEgMAUhIBAMsSAwADEwEAHBQBAAECAPUJEgAAAQABAAEAAQABAAD1vwYAAAEAAQABAAEAAQECoDAAABS6oEAAABTfbXM7MAAAAQAADAABAKkODAAABWVyaW5nAAABxRIAAADWPwAAgYmgQAAAFCYIAAAVFFMAOzAAAAEAADcACgCgDAoAmA4LAL4SBADVEwsA4hMBAO0TBQApFAMA8RQAABkVAQCdFQAACCYAAAHXDwAAAAAAAAD0tQsAAAEAAQABAADyAAEAbgA7MAAAAQAABgADAF8PBADAFAAAKxUAADQBAAACAwACoHAAABUCoCAAABJLXWV0aXB59VYAAAABAAEAAQABADswAAABAAAFAAEAJwgFAAEChLAwFQYAAbAwFQgAAaAwAAAVCqBAAAAVKxQAA/MWEgAAQwABAAg1AAD0vREAAAEAAQABAAASgAEBsCAT7AD7c3UyAAECTIyHbIBJZmltADswAAABAAAFAAEAGxUFAAEBAYASEwOwAXM7MAAAAQAACwADAL4PBACSEQQAIRUBAAADZWN0AAA7MAAAAQAABwACANMPAwC5EQMAAPKAAQFqYQAAxs8Sl8/o6MVusnkbyxci1YHkUktR9P9XSuIY0eH4V7Yi1kcS+90Y6Q6CF2AQgUVOiJEnZ+MfiXegMAAAFZigYAAAFSc3woGUmqkGQ3NxUtkKN7IETARRzrIaTJUwoKrj56c8qJ6zLpAhOyw9vQI0hgRrZP9HMaNfnyxQAPv3lHSACKAMQPMfEwA7MAAAAQAA6QEIAOkABQAXAQkA+glbATgSAACHE0UAgRQBAIQUMgC7FAEAAQQAOzAAAAEAAAgAAgCyEgUA9hMCACMAArAgEtcAAWVpOzAAAAEAADIABQDdAQkAHAMJALkGBAAPCBcABhUBAAEHADswAAABAAARAAYAzxQDAP8UAQAVFQMAOhUDAI8VAQCaFQEAEwACoCAAABIVZXU7MAAAAQAAHAABAIEBHAABAwA7MAAAAQAACAACALgSBQD5EwIAE4ACsDAVlQAWZWkBAwD0SRUAAAEAWwABACOAAqBgAAAVSGFvEwACsJAVIQABY247MAAAAQAAEwADAG0HBQBcCwQAYAwIAAEAADswAAABAAAOAAEA+gkOAAEBArAwFLsAAaAwAAAUvWl3OzAAAAEAABMAAgDFDAQA1A4OAPOAAmVvAYADsHAVSQABsJAVlgABoMAAABWvaW91I4ADsAAPuARLoDAAABUDZWxvAANiZXIAADswAAABAAAIAAEAyg8IAAAAAWwAAPQqBwAAAQABAAEAARUSAADygAIAbG0AA3VsbAAAARUSAAAAEoABAaAQAAAPuG5jAAAAAPX9DgAAAQABAAEAAQAA+gsBAHM7MAAAAQAACQABAKsLCQDyNBIAAJUAMoACAqAwAAAUJ7BwFSEAAWRuc3cBAQA7MAAAAQAAMgABAFkVMgAjgAKgAAAAFTBnaQAAAAA7MAAAAQAACQABAEMCCQAAMoABA2AsgjStRyYmK4uaJmxudHYBBwA7MAAAAQAAMgABAFkVMgABgAKgMAAAE/ywIBPiAAFhcgEDADswAAABAAAyAAEAhBQyAAECAPQ+FQAAAQABAAEA8wEBZfIRFQAAAQAjAAKgUAAAFZlmaTswAAABAAA0AAMADhMyABMVAAAyFQAAAAAAAPWmCwAAAQABAAEAAQAAEoABAVZHhLd8PHRwAAAAADswAAABAABlAAEArAVlAADwAIKFAAEDBsoHCAAAMAgJBQA7MAAAAQAADgEJAJAMAADZDAMAag33AHARDAAUEgAAUBIAAN8UAACfFQAArhUAAAEEArBAFRkAAaBgAAAVkWV2AQ0TAAAABG5kZXgAAAHBFAAAAAgcAADywxIAAAEA8qAVAAABAAgcAADy6hMAAAEA8qcVAAABAPIAAgBwdjswAAABAAAJAAEAzwwJAAA6AwIBoEAAABUmZGl2OzAAAAEAADYAAgAlBwQAdAsxADowAAABAAAAAAALABAAAACKDosOjA6NDo4OERISEiASIRLZEgcT5BTyAAEBbXAAOzAAAAEAABkAAgBpDBMAJQ0FAPaVJQDFzaCAAAAVpCZR6OjoBUc6m4or/aBgAAAVjKAgAAAMug1Vzzrp7maTNBpmmUBEEASAOw8LOzAAAAEAADEAAQAAADEAOzAAAAEAAPsAFwCBARwA7wEvACsFZgADBwMAcwcJAFsLAAC1CwMA+AwJANcPAADvDwQAaxEEANARCAAXEgAAOxIBAF0SAACpEgAA6RIEAOYTAQAkFAIAMxQBACgVAABUFQMAkRUAAAEAADswAAABAACdAQEAWQOdAQEAADswAAABAAASAAEAlA8SAAEBADswAAABAAAFAAIA1RQDACkVAQABAAD1axEAAAEAAQABAAEAhwEAgIWgQAAAFL6gYAAAFSewQBP+ATOEIQEBBADzxxQAAAEAAQABAQD14xEAAAEAAQABAAEAAQEAOzAAAAEAAAgAAQDKDwgA84ACZW8IYgAAAasFAAA7MAAAAQAARgACALoMAAA2FEUAAQIA9MMSAAABANwCAQABAwD06hMAAAEAvAEBAPMAAnB2OzAAAAEAAAsAAgDPDAkA6BMBAAADeXBlAAAB/xMAAAAAAmVkAAAB5hQAAAAIHwAAASgVAAAA+ooCAHV2AANvcGUAAAHAFAAAAPKAAgBjbwhrAAABvxQAAAGqFQAAcgFhAwGgMAAAFa9jc3RkOzAAAAEAAA4AAgAbBwkAbwsEAPXnEgAA0wFCAAEAOgAAA2FnZQABoEAAABWeYgFREgAA8gsVAAAuAPIAAQBzAPW5DwAAAQABAAEAAQAAAmdlAAA7MAAAAQAACAABAPQOCAAAAApvbmVkZmllbGRzAAABmRUAAAD6CgEAaQABsRIAAAAEc2luZwAAAf4TAAABMRUAAAAGaXRyYXRlAAABJxUAAAAIBwAAAb4UAAAA8IFvAwEAAQIaY2hpcvQHAADFxQAEBgcJvBGgQAAAFMGgQAAAFSawEBImAAEAAIwDAEMAKAA7MAAAAQAAUwAKACUHBAB0CzEAig4EALYODgAREgEAIBIBANkSAAAHEwAA5BQAAEsVAQABAAJrq8o9w32gIAAAE+FjdPJfEgAAkAIADG1lc3NhZ2VieXRlcwAAAZ4VAAAACCYAADswAAABAAAJAAIAFgcEAGoLBAAAAAZmb3JtZWQAAPLoEwAAAQAACEsAAAHoEgAAAPoUAQB29GYLAAABAAEAAQAAAARoaW5lAADyFBIAADwAAPYFAICFgqAgAAASqwQMIUAABPTVAADDygAIHR4hQjMt6iLUeqAwAAASySInKWqFW8olJqAwAAASykAEAASAQTwLADswAAABAABoAhEAgAYJAAIHAAB9Bx0AVAh0AegLZADZDwsAGBIDAFISAQBbEgAAyxIDAN8SAAADEwEAQRNFABwUAQDlFAAALhUBAJgVAAABAAA7MAAAAQAAEAACAPQPAgA9Eg0AAQcA85IVAAABABYAAYACoAAAABUUoAAAABLdZHEzAAOgAAAAFZllbXM7MAAAAQAAHAADAKsMDgBhDQgApA4EAAECAPMhFAAAAQABACOAAqAQAAAVrHB1AQEA9OgUAAABAAEAAQBjgISgMAAAFa6wMBKsACUAWAgBgAIEEdX2UQwe1LJss/pkbgAAAAA7MAAAAQAADgABAJwFDgAAMoABAqAgAAASNWxlaQECAYAS1AAQAXMBORIAAAEEAPO3FAAAAQABAPMAAmN1OzAAAAEAACgAAwCZBhMA7gcSACwVAQABAgGAEhMDsAFzOzAAAAEAAAsAAwC+DwQAkhEEACEVAQAIXAAA9e8OAAABAAEAAQABAAAACGlzdG9ncmFtAAABmBUAAAAICQAA8gQVAAABAPKWFQAAAQDyA2t1cAIAY2j1tBEAAAEAAQABAAEAAAhHAAD1YQsAAAEAAQABAAEAAPYEAACDhFENh1Jx1yUh4jDrGQFAEAYgAgABOBIAAAEAAPRlDwAAAQABAAEAAQECd8HlmVTZW4W/eDHPY2byZA8AAMEFCA8AAPURBwAAAQABAAEAAQAAAQQA9EkVAAABAFsAAQDyAAABY/VcCwAAAQABAAEAAQAAEoABAaBQAAAVE2t0AAAAAPXFDwAAAQABAAEAAQAA+nwBAHM7MAAAAQAACwABAOMOCwA6MAAAAQAAAAAACQAQAAAABBR/FIAUTRVOFY0VjhWVFaQVqxX2AgCAg4OgAAAAFSYAMAIMAAQBAgA7MAAAAQAACAACALgSBQD5EwIAAQIAOzAAAAEAAAkAAQDXEwkAE4ACoCAAABUKcnUBgQKwEBUGAAGgMAAAFO5udQEAADswAAABAAAFAAIABxAEANoSAAAAAm9yAAD0vxIAAAEAAQABAADyAXIBAHL1ygwAAAEAAQABAAEAAPIAAQFldDswAAABAAAVAAIANwILAJIFCQAAAANldGEAAAHnEgAAAPIAAQBtOzAAAAEAABIAAQAkAhIAAAAAAAA7MAAAAQAAZgABACsFZgAACGAAAPLmEwAAAQAACCoAAPLTFAAAAQAAKuACANAAE+QAAWVr+ocCAGJw9ioAAMTGoCAAABJcsDAVCAABoEAAABUrAAgIIkAFgAkAOzAAAAEAABIABwDaCwQAAg0EAKcPAACcEQMAFhIAAFkSAQAKFQAAAQAAOzAAAAEAAAUAAgDsEQQAxRQAAAEAAbBAE9UAAWX1LQgAAAEAAQABAAEAAANvdXQAAAHEDwAA8v4UAACeALKAAQOgEAAAElt5Yml09AcJAMXLAAQUHScqLrBQE+gAAaAQAAASTAx1/tEBVaAwAAASNIASEwOwATFJgN4XT4CgMAAAFa3oQEQQCAAbClcAOzAAAAEAALUAGQBDAgkAqAITAJwFDgBFBjUAlAYDAMQGBAAqBwMA7AcAADIIFwDJCQMAvg8EAJIRBACvEQQA4xEEABUSAAC4EgUA6BIAAAITAADTEwAA7BMAAPkTAgDnFAAACBUBAAwVAQAhFQEAAQECQfXYZCSWoIAAABWYY2j1tBEAAAEAAQABAAEAAAAAADswAAABAAAJAAEABwcJAAASgW4BAbAQFIEAAWR0AQAA9NMUAAABAB4AAQABAAA7MAAAAQAADQACAPgMCQBUFQMAAAJlbAAA9a8RAAABAAEAAQABAADyAAEAbgD1CRIAAAEAAQABAAEA1gAAAAEEsFAVIwABoCAAABLocmRudHYA9GYLAAABAAEAAQC0BAAAgoYABbBAFMIAAYewkBUhAAGwEBLSAAEHoDAAABSDEAEABmAYADswAAABAABmAAsAMAYTABYHBABtBwUAXAsEAGoLBAC5CwMAYAwIAIsMBADdDBUATQ0TANISAQABAgGwEBLGAAFlOzAAAAEAAAcAAgDTDwMAuREDAAg6AADy4hMAAAEAAPICb24BAGX1AwcAAAEAAQABAFUEAPIAAQFzZQA7MAAAAQAARwAHADgHNAAiEgMALhIFAAgTAQDQEwIA6hMBAKcVAQABAwDzVBIAAAEAAQABAwA7MAAAAQAADQACANkPCwBSEgEAAQgAOzAAAAEAAAUAAgAVFQMAjxUBABOAArAAEqcAAW50AQMA9OgUAAABAAEAAQBjgAOgYAAAFCdnbG4AAAAAOzAAAAEAACIAAgBMAAkA9AAYAAABAwDzGRQAAAEAAQABAAD1xQ8AAAEAAQABAAEAAQIBoAAAABVPc/XpEgAAAQABAAEAAQABAAKgcAAAFTigoAAAFaRjafUOEgAAJwJOADoA8AAAA3RvcgAAAb4SAADy8RQAAKwA8gABAGH1VgsAAAEAAQABAAEAAf0TAAAAAAABoFAAABU5ZQECBwAAADIAAgGgUAAAFRRtcmYAAQsNAAB2AwAAgYawMBUnAGWwABU4ABAQAACAAUsAOzAAAAEAAJEAEgDcBiUApQcJAEoIBABRDAAA4w4LAGUPAwAcEgMAKBIFAAUTAQDNEwIABBQAAH8UAQBNFQEAWRUyAI0VAQCVFQAApBUAAKsVAAABAAGgQAAAFZhv9REHAAABAAEAAQABAAEBAaAwAAAT1HQBdg4AAAAIYW1ldmFsaWQAAAEmFQAAAAADcHR5AAA7MAAAAQAABgABAOASBgAA8gABAG0A9UEPAAABAAEAAQABAHYCAIACBLAgE/4BM1XHD4ZRm2VuY2ltdAAAAAD17wAAAAEAAQABAAEAAAAAAAETRLota3BuOzAAAAEAAAUAAQDpAAUAAPEAAT9jOzAAAAEAAAoAAgBtBwUAXAsEAPECAY9l8hEVAAABAPMAAWQ7MAAAAQAAEwAFANkMAwBwEQwAFBIAAFASAADfFAAACAIAAAHxFAAAAPIDdGVyAQBhAf0TAAAA8gABAGk7MAAAAQAATAEBAAkKTAE7MAAAAQAAfAAEAIcTRQCBFAEAhBQyALsUAQAIIAAAAYwVAAAACBYAAAEDFQAAADKAAgKwEBUTAB+gIAAAFTBjaGVp+hEBAG4A8lcSAAABAPIAAgBlbwA7MAAAAQAACQABABAPCQAIaAAAAeUUAAAA8gNlcnQBAHQ7MAAAAQAADgABAKARDgAACA8AADswAAABAAAlAAEA3AYlADswAAABAABBAAUAHBIDACgSBQAFEwEAzRMCAFkVMgAAAAAAOzAAAAEAAA4AAQD6CQ4AAAADaXRoAAABvRQAAAAAA250bwAA8rsUAAABAAD6BQIAaXc7MAAAAQAAEwACAMUMBADUDg4AAPKAAgBlbwGBAqBAAAAVAaAAAAASD2RnAAF4AAGgEAAAFQFlOzAAAAEAAA8AAgDADAQAyQ4KADswAAABAAAPAAQArRIDALISBQD0EwQAwRQAAPIAAQFlaQA7MAAAAQAAEwADAAcHCQDdBwQATwgEAAAJb2t1cGNvdW50AADylhUAAAEAAAAHbmtjb3VudAAA8kkVAAABAAA6tQIBoMAAABWvaW919isAAIaEoIAAABWkKNKN+h8kLAEGUgQAAPI7EgAAAQDwAAABqGU7MAAAAQAADgACAEIACQDkAAQAOzAAAAEAAEkABAAGEAAAYRJFABEVAQAmFQAA9k8EAMfKbeE/gU3YbJ625qiwUc1Sw1evJHQRieEIeJpt7cYlJiYri5omcTjUAbz9AAKYI0AdBowAOzAAAAEAADkAAgBbAC8AKw0JAAGDArAAFDEAAbAgFPIAAWVrE4ACsEAUMwABYnABgAKggAAAFaSwABIUADxiZQEBADswAAABAAAIAAEAYQ0IADOAhKBgAAAVmLBAFScAZQAoBgEBhLBgFSMAAbAwFIEAAbAQEtIAAaAwAAAUgxBBEDswAAABAAAYAAIAiwwEAE0NEwATgAKgAAAAD8NjcgAAAAD19QkAAAEAAQABAAEAAPIBcAEAc/UfAgAAAQABAAEAAQAAAQACsEAVGQABoGAAABWRZXYBDRMAAAglAAD0xQ4AAAEAAQABAADygAEBdnQBAAA7MAAAAQAABgACAO0HAABCFQUACGUBAOcgAAAPw2U7MAAAAQAAJwABAM0JJwAAAANkbGUAAPScEQAAAQABAAEAAPKAAgFuc3J2CwAAg4agcAAAFTiwQBJgApCgoAAAFUgBQEAUAQ0AOzAAAAEAAGIAEQCMAA0AzQknANYLAwBiDg4A9w8EANkRAAAOEgAANRQAAIMUAAC9FAAA+BQDADUVAQBQFQMAkhUBAKIVAQCpFQAArRUAAAEDAPMKEwAAAQABAAEAADswAAABAAAJAAMAewYEANUHAwBeEgAAAQMAOzAAAAEAAAUAAgAiEgMACBMBAAECAPMgEgAAAQDmABOAAqBAAAAUJ2FvAQEAOzAAAAEAAA0AAgDvDwQA0BEIAAECADswAAABAAAFAAIAHBIDAAUTAQBjgAOgAAAAEqtjbm8RgQIYsEAUMwABYnABAwA7MAAAAQAABQACABgSAwADEwEAAQoAOzAAAAEAAAUAAgA6FQMAmhUBAAACbmcAAPWXEQAAAQABAAEAAQABxBQAAAglAAD1uwwAAAEAAQABAAEAAPKAAgBlaQAAAADzExIAADsAAQAA8gNiYWwBAHM7MAAAAQAACQACAL4PBACSEQQA8iEVAAABAPKAAgBvdQEGADswAAABAAAIAAIA2RQFAA4VAgAIEAAAAd8SAAAAAAV5bmFtZQAAAeQUAAAA8gACAGJ0OzAAAAEAACkAAQABBSkAAAAEZXZlbAAAOzAAAAEAAAgAAgC4EgUA+RMCAAAABXJhdGVkAAAB/BMAAADygAIAZWw2AQAAAgOgQAAAFZ6wgBWlAAFudGJseAA7MAAAAQAADwAFAAcNAwD0DggAURIAAAsVAAA5FQAAAAAAADswAAABAAANAAEANAANAAFMEgAA9rcBAIOKoHAAABWvoCAAABWYFAgAobELADswAAABAABZAA0AXAIlAJYMAAABEAQADBAJAJcRBADeEQQADxIAAMUSAAD+EwAABRQSACgUAADEFAAAMBUBAAGDArAAE+QAAbAgFNMAAWVrE4ACsEAT5gABYnABAgD0vREAAAEAAQABABOAArAgE+wA+3N1AQEDoDAAABQDsDAUuwABoDAAABS9ZWl3OzAAAAEAABMAAgDFDAQA1A4OAAEDADswAAABAAANAAEAPRINAAAAAAA7MAAAAQAALwABAO8BLwAACAsAAPTJCQAAAQABAAEA8wITAADqAPsA8oACAGVuAQEA9L0RAAABAAEAAQAAAAAAOzAAAAEAAAkAAQD3BAkAAPKAAQF0ZQAEdGllcgAAAd4SAAAAAAAAADswAAABAAB0AQEAVAh0ATswAAABAABFAAEAQRNFAPKAAgBtbgAFYnl0ZXMAAAHjFAAAAPIAAQBkOzAAAAEAABIAAQDJBhIAABKAAQGgEAAAEhBlYQAAAAD1uQ8AAAEAAQABAAEAAAgZAADz4BQAAAEAAQAA8gJtZQIAY3M7MAAAAQAADgABALYODgDySxUAAAEA8oADAGFlbwAEbGljZQAAASUVAAAACAwAAAEoFAAAAPIDYXJkAgBpcwFNEgAAAAAEdHRlcgAAAeETAAAAEgABAbAQE+gAAWFlADswAAABAAAZAAYA2Q8LABgSAwBSEgEAyxIDAAMTAQAcFAEAAARwaW5lAAAB3xQAAAAIMAAAAboUAAAA+jwCAG1zOzAAAAEAAAwAAQCpDgwAAPKAAwBjbXcSAAEBoDAAABUUcmwAOzAAAAEAAA4AAQD6CQ4AAANuY2UAAAG4DwAAAAhiAAABugwAAADygAIAbW8BBAA7MAAAAQAABQACANUUAwApFQEAAAAAADswAAABAACdAQEAWQOdAQDygAEBdGXxAAFsZDswAAABAAAMAAEAcBEMAAAAAAD1TwgAAAEAAQABAAEAAPKAAQFkZSACbGQBAucQAAAS3cegAAAAFZllbXM7MAAAAQAAEwACAKsMDgCkDgQAADKAAgE2CAt1x9Zlbmzm/wAAyMTjIAAAA1gEQJwFQAwAAgA7MAAAAQAAGwAEAMQBDgBxDgQAARQBABsVBQABAAGgIAAAE9N2OzAAAAEAAGsABACsBWUAXAwDADUSAADKEgAAAQEAOzAAAAEAAA4AAQBiDg4AIwACoEAAABTGY3Q7MAAAAQAADQACAFICCQDkCwMAAQEAOzAAAAEAAAUAAQAbFQUAAQEAOzAAAAEAADIAAQCEFDIAI4ACoCAAABTBZHQBAAA7MAAAAQAARgACAAYQAABhEkUAM4ADoGAAABWdZG50AQMAOzAAAAEAAA0AAgDvDwQA0BEIAAGAAqAQAAAMlqAwAAAVnnV5AQIA9L8SAAABAAEAAQDzAAFy9coMAAABAAEAAQABACOAAqAAAAAVAWRyAAAAAPOPEQAAAQABAAAAAAAAOzAAAAEAAA0AAQCBEQ0AAPqvAgBkdPIAAQBlOzAAAAEAAAcAAQDnAQcAOzAAAAEAABMABwCmCwQATQwDAAcQBAAmEgEA1xIBANoSAAAAFAAAAARuZGVkAAAB3BIAAAASgAEBNn3/TzhKYWUIIwAA9UoIAAABAAEAAQABAAAABWVlZGVkAAAB2xIAAAAADmN0c2l6ZWl0ZXJhdG9yAAABnRUAAADyAAUBYWNpcHRlADswAAABAAA1AAgANwILAJIFCQDADAQAyQ4KAK0SAwCyEgUA9BMEAMEUAAABAQA7MAAAAQAACAACALgSBQD5EwIAAANyb3IAADswAAABAAAJAAEA1xMJAAASgAIA50AAABLacngaFAIB5jAAABJMoBAAABUmZWdpOzAAAAEAABwAAgDEBgQAMggXAPXoEgAAIAIBAAMAAQDyAAEBYWUAOzAAAAEAABgAAQC9CxgAAQIBoBAAABTvYQHfEgAAE4ACoFAAABTwZWgBBgA7MAAAAQAAMgABAFkVMgABgQKgMAAAFOSwYBVNAAFudAAAAAA7MAAAAQAACQABAE4DCQAAVmAAAMHLauRGMwsIsCAVLgABoDAAABMCoFAAABTEoIAAABUwoEAAABQEHlCfRuzgoEAAABTFAAAAQMBcFgoAOzAAAAEAAF0ABgAkAhIAAQUpAEYPGAC9EQMA0xQBAPIUAQABAgDz9A8AAAEAAQABAgGgQAAAFZ5i81ESAAC6Ai4AE4ACsCASFwBGYWkBiAKgMAAAFaigIAAAFaFwdgEAADswAAABAAAYAAEARg8YACOAAnMKKIBNT250AAAAADswAAABAAAJAAEARAMJAABWDQAAgYegMAAAFSuhAAAAFa+gMAAAFN8AAIAUwQoAOzAAAAEAADMACgBEDQgA/Q4EALkPBADxERcA1BICAMIUAQDjFAAAAhUAAFgVAACeFQAAAQMA9KkSAAB7AQEAbAEBgQKgAAAAEsWwEBS7AAFndAEBADswAAABAAAIAAEA9A4IAAEAADswAAABAAAGAAIAcQ4EAAEUAQATgAKgIAAAFANmbgGAAqAQAAAT/Hy/bV6BdWVvI4ACsKAVpQABZ3QAAAAA9H0RAAABAAEAAQAA+iUBAHM7MAAAAQAAFgACAKAMCgCYDgsAOzAAAAEAAB0ABgC/EgMA1RMLAOITAQDtEwUAKRQDABkVAQDyAAEAbzswAAABAAAdAAEAJgMdAAGqEgAAthMAAMHMsIAVjQABbE2A3caHXPmFmbeiO8XY8oOgoCAAABUKNrwqRcoeoDAAABS9AACAAMBUDB8AOzAAAAEAAEkAEABWCwQAxQwJAI8OBADFDgMA1A4OAO8OBADDDwAAyg8IAPwPBADBEQAA2hEDAAkSBABXEgEA3hIAAOETAAD9EwAAAAAAADswAAABAABJAAEAmgBJADswAAABAAAOAAIAwhENAN0SAAABBAA7MAAAAQAACAACALgSBQD5EwIACGAAADswAAABAAAIAAIAshIFAPYTAgAA8gABAGk7MAAAAQAAEwACAN0BCQAcAwkAAAABeQAAOzAAAAEAAAgAAgCbDAQAlA4DAAAIAgAA9Y8OAAABAAEAAQABAAAyAAICoKAAABWZY7Cw63b1ZXJpbgA7MAAAAQAABwADAI8RAgCxEgAAPhUDAAAAAAGgEAAAD/xlOzAAAAEAACUAAQD2AiUAOzAAAAEAAA0AAQCBEQ0AAYACoDAAABWooCAAABWhcHb6DgABZPWKDgAAAQABAAEAAQAA8gABAG0AOzAAAAEAABkAAgBpDBMAJQ0FAPYIAADExKAQAAAUA6BQAAAT/KAgAAASDkACAAoARQIAADswAAABAAB8AAYAKwVmALULAwD4DAkA5hMBADMUAQBUFQMAAYCEoEAAABS+oGAAABUnsEAT/gEzBehOvrBLhAEBAQYAOzAAAAEAAAsABAD4FAMANRUBAFAVAwCiFQEAAYACoEAAABU5oBAAABS6c3QAAnR5AAA7MAAAAQAAFgACAJcMAwB3DhIAOzAAAAEAAAYAAQDgEgYA8gABA3BlaW8AAQIHAAABBASwMBUsAAGwQBVLAAGwMBUuAAGwIBUMAAFjZnR2OzAAAAEAABQAAgDIEgAA7hITAAECAPd/FAAAAQDNAAEAPwABABYAE4ACsGAVpQABbW4BAAOgEAAAEt0YJfF6AtGgAAAAFZllbXM7MAAAAQAAEwACAKsMDgCkDgQACDoAAPLVEwAAAQAA8gFiAQBl9S0IAAABAAEAAQABAAC2AQAAAQSgMAAAElxhZGVpbwA7MAAAAQAAFAAHAMkJAwCvEQQAuBIFAAITAADsEwAA+RMCAOcUAAAAAMnMRg0ubgqRG03BJnHUTC8LXtwXdN6BBwSoaiiiB3Jxdv1d/oQxZbU4Y7vzPhFF++kUbn//tMGsAdxTxdDgcvX5ftWxEcoYgcJmYUiaefeIP+ZP4/epEFHHAbPvVpyqHOLjQYF7iq9nsFASxgABUc5z8IxbApOcR993FtNq6oS1AADOK8DfMBAAOzAAAAEAAEMCNQC/BgQAyQYSACUHBACbBwkAZgsDAHQLMQCrCwkA2gsJAJAMAADZDAMAAg0JAGoN9wCKDgQAqQ4bAPQOCAACDw0AGg8rAF8PBQCnDxEAcBEMAJwRAwDoEQMAERIBABQSAAAWEgAAIBIBADQSAAA5EgAAUBIBAFkSAQBcEgAAyBIBANASAADZEgAA7hITAAcTAADUEwAA5BMBAP8TAAADFAAAMRQBAMAUAADfFAAA5BQAAAoVAQAlFQAAJxUAACsVAAA5FQAASxUBAIwVAACfFQAArhUAAAEAADswAAABAAATAAIAigYJAOIHCQABAQD0wxIAAAEA3AIBABOAArBQFCQAAWFlAQQA9FQVAAABAAEAAQABAAGgMAAAFSVs82ASAACQAqkAAQYA85IVAAABABYAAQEBoEAAABWqY/P8FAAAAQA6ACOAAqBAAAAVC3N0Y4ADoDAAABKrYWVpAQEA9JwRAAABAAEAAQABAAD01QIAAAEAAQABAAECADswAAABAAAFAAEAQhUFABOAArAwFSMAAWhvAQQBoQAAABWvafPjFAAAHwBWAAEAAPToEQAAAQABAAEAI4ECoAAAABWvYWUIYQAAAUsSAAAA8gJvcAEAcDswAAABAAAFAAEAJwgFAAAAAAAAOzAAAAEAAAkAAQDTAQkAAAAFdW1lbnQAAAGxEgAAAPKAAgBjdAEAAaBwAAAVr23yDxIAABkCI4ACoEAAABUBZGcBAAFF9jvL64Jl8hEVAAABAAADcmVlAAAB1BMAAADyAmNyAQB0AXYOAAAAAAdnbm9zdGljAAABJxQAAADygAICYXNkbgEAAaAQAAAVAWU7MAAAAQAAHwAGAMAMBADJDgoArRIDALISBQD0EwQAwRQAAAEAAPX9DgAAAQABAAEAAQABAQD0PhUAAAEAAQABAAh2AAD1cQ4AAAEAAQABAAEAABIAAQGgIAAAEsVlaQAB/A8AAAACdGgAADswAAABAAAOAAEAYg4OAADwAm5lAAHiZDswAAABAAAMAAEAcBEMAAAAA3VsdAAAOzAAAAEAAA0AAQA9Eg0AAPIAAgBhaTswAAABAAAOAAEAxAEOAAAAB29yYXRpb24AAAEmFAAAAAACdWcAAAGWDAAAAPRtAADFxgABAgUGgBLbABI4CHGgAAAAEt0JCoAJoAAAAlghADswAAABAAALAAMAqwsJADQSAADJEgAA9m8PAMTMoFAAABWZQszwCjU/AESQAMALJksAOzAAAAEAAGYBKQBCAAkA5AAEANUCAwD2AiUAJQYJAAcHCQDdBwQATwgEAGELBACBDAkAqwwOALsMBADPDAkAPw0EAGENCACkDgQA5Q8JAAYQAACBEQ0AEBIAAEsSAABNEgAAYRJFAMYSAQDbEgEADhMyAOgTAQD8EwAALRQDAMoUCADZFAUA5hQAAOwUAQD0FAMA/xQCAA4VCgAmFQAAMhUCADoVAwCPFQEAmhUBAAGAArAgEqwAJaAwAAASsWxtAYMCd8HlmVTZW4W/eDHPY2YTgAKgEAAAE/NsdAADYW1lAADzERIAAAEAxwAACBMAADswAAABAAAFAAIArRIDAPQTAQAA8oACAGluEgABAg+rR/xDOqCwAAAVnXhlcwA7MAAAAQAACAADANMPAwC5EQMAOhIAAAAAAAD1vwYAAAEAAQABAAEAABKAAQGgQAAAFCZlYQEAADswAAABAAAGAAMAXw8EAMAUAAArFQAAAAABAPbgEjsAAWkBvgYAAPKUFQAAGAAAB2VkYnl0ZXMAAAECFQAAAPKAAgFpeWUAAnh0AADy1xIAAAEAAPIAAQBlOzAAAAEAABwAAgC5BgQADwgXAPIGFQAAAQAAAAAA9ZEMAAABAAEAAQABAADyAAEAdDswAAABAAAZAAIArQYLAAEIDQAA8oACAHN2AANhY3QAAAE6EgAAAAhMAAD1axEAAAEAAQABAAEAAPKAAgBtcPYAAIAEAXGQoa9ipW1ucHJ1CDoAADswAAABAAATAAEA4gITAPToFAAAAQABAAEAAYACoBAAABJbsDAU/gCeaXkAAAAA89QSAAABAAEAAPICcmUBAHMBORIAAAAILgAA87cUAAABAAEAAPIAAgBjdTswAAABAAAmAAIAmQYTAO4HEgDyLBUAAAEAAAdvdW5pbml0AAA7MAAAAQAAMgABAFkVMgAACEQAADswAAABAAAyAAEAhBQyAAD6GgIAaXQ7MAAAAQAA+AACAJAMAABqDfcA8p8VAAAPADKAAgGwgBWWAAFuc28ygAEDsHAVSQABoMAAABWvb2FpdQAKbmtjYXBhY2l0eQAAAUgVAAAACDwAADswAAABAAAIAAEAYQ0IAAASgAEBsBASFAA8bG4ISQAAAYMUAAAACAQAAPKBFAAAAQAAAAZkY291bnQAAPIjFQAAAQAAsgJja4SA9rAS0gABEEEQOzAAAAEAABgAAgCLDAQATQ0TAAAIIgAAAe0HAAA7MAAAAQAABQABAEIVBQDyAISAEQEIOzAAAAEAAA0AAQCMAA0AOzAAAAEAABQACAD3DwQA2REAAPgUAwA1FQEAUBUDAJIVAQCiFQEAqRUAAAAFY3VsdXMAAPKsEgAAJQAAEoABArBQFTgAEBg2awf3e2xwdPbDAACGhyIbWZOzv7AgFTgAEBnoR3/Jai0vqxpGTqAwAAAUNYFYBBAFGwA7MAAAAQAAHQAIADQADQDUAgAALgcJAAwNAABMEgAAqxIAABgUAAAnFAAAAQMAOzAAAAEAAAcAAgDTDwMAuREDAAAAAAGhAAAAFa9pOzAAAAEAAAgAAQBEDQgA9sIUAAABACAAHwBWAEYAAARpbWl0AADyfxQAAAEA9U0VAAABAD8AAQAWAAgMAADzfBQAAAEAAQAA+ooDAGNscxKAAQGgMAAAFOR0bgACbG8AAAE4EgAAAPoRAQBhAZgGAAAAAARyZWFkAAABEBIAAAAygAIBoAAAAAyWZm1nAQAA9eMRAAABAAEAAQABAAACbmQAADswAAABAAAOAAIAgQwJAD8NBAAACDcAADswAAABAABFAAEANhRFAADyA3JvdwEAbTswAAABAABMAQEAHhBMAQAIMQAA9ZQGAAABAAEAAQBVAQAILwAAOzAAAAEAABMAAgCKBgkA4gcJAADygAQBZG9ydWwABGV4ZWQAAAEBFQAAABq6AgDAAAAAEg9kZ/oGAQBp9d0HAAABAAEAAQABAAABAAGwIBPVAAFyOzAAAAEAAAgAAQDKDwgAAAFhAAD02QcAAAEAAQABAADygAEBdHIBAAGAEhMDsAFzOzAAAAEAAAsAAwC+DwQAkhEEACEVAQAABmVyc2lvbgAA8iQUAAABAAAABGFnaWMAAAGrEgAAAPKAAgBtdvKAAQFkbPYHAACGgk6HLux44RFBSAACAQD1LQgAAAEAAQABAAEAAQIA88QPAAA6BZ4A8wABb/V9DAAAAQABAAEATwYBAgA7MAAAAQAADQABAD0SDQABAAGgIAAAEuh29GYLAAABAAEAAQAjAAKwQBTCAAFiZfS5CwAAAQABAAEAAQEA9UEPAAABAAEAAQABACOAAqAAAAASW21zAQACoEAAABWesIAVpQABYmz3Bw0AAAEAAQABAEcFugIuABOAA6AQAAASq6BQAAAUJ2VpbgAMYWdlbGlua2NvdW50AADypRUAAAEAAPoPAQByAPXfCwAAAQABAAEAAQABAAA7MAAAAQAACQACAPMMBACPDwQAAQIBsEAVlQAWbAEmFAAAAAFzAAA7MAAAAQAACQABADUNCQAAEoABAaAQAAAT4XJlAAAAADswAAABAAAJAAEAgAYJAAASgAEBgBK+IzCsbXI2BgAAgoagAAAAFa9rq8o9w31gJGMB5MygIAAAE/8AQAQVAUIAOjAAAAEAAAAAAAcAEAAAAOwR7RHuEe8R8BFfEsUU7xQBgQKgQAAAFSigIAAAFOZ1dgEAAaAQAAAPw2U7MAAAAQAAJwABAM0JJwAAA2l6ZQAAAdASAAAAAAJpdgAA8jYSAAABAADygAIAbnMIFwAAOzAAAAEAAAcAAQAWEAcAAAABZwAAOzAAAAEAAAkAAQAMEAkAAPKAAgBpdAABaQAAOzAAAAEAAAkAAQArDQkAAAAEcnJheQAAAc8SAAAA9gwAgISEoDAAABTAoAAAABJcAYAKlEAAAQABRVN41vHCaTswAAABAAAlAAEAaQ8lAAEBAm8yjEvdGKAAAAARwWVyOzAAAAEAAA0AAQACDw0AAQAAOzAAAAEAAAkAAgAWBwQAagsEAAEAAqAgAAAUKKBAAAAVJWlzAU0SAAABAQA7MAAAAQAABQACAPcPBADZEQAAAAJheQAA9H0MAAABAAEAAQABzxIAAAgHAAA7MAAAAQAACAACAHsGBADVBwMAAAAAAAA7MAAAAQAAGQACAGkMEwAlDQUAAPoPAQBhAPTmEwAAAQBMAAEA9h0AAIOGsDASpwABUAABDAUGADswAAABAAAiAAUAvAIXAO0HAADDEgEAQhUFAKAVAQABAwKwQBUZAAGgYAAAFZFldgENEwAACBIAADswAAABAAAXAAEADQ0XAADyAAEAbDswAAABAAAuAAIAngElANkCCAAAUoABArBAFTgAEHBhcyGAAqAQAAAS3JRlbAAHeHBlY3RlZAAAOzAAAAEAAAUAAgDPFAMA/xQBADswAAABAAALAAQAFRUDADoVAwCPFQEAmhUBAPIAAQBlOzAAAAEAABwAAQCBARwAADIAAQOgkAAAFU+wABKnAAFuZHN0ADswAAABAAAJAAEAcwcJAAEAADswAAABAAAXAAEA8REXAPMBAXM7MAAAAQAADgABAKkPDgABgAKgAAAAFSagYAAAFRNkbgEBADswAAABAAAFAAIABxAEANoSAAAjgAIwF9MrHA5yeAEDAPMhFAAAAQABACOAA1BUQ2pAqLAwEqwAJW1vdQEBADswAAABAAAFAAIA7BEEAMUUAAAIJAAAATUUAAAACAAAAAGtFQAAAAACcHkAAAGsFQAAAAADb25lAAABrhUAAADygAIAbG/yg2lsbAIAY3cIAgAAAZQVAAAACAIAAAGfFQAAAPKAAgBsb/KDaWNlAgBjZhKAAgDnIAAAE/NsdAAFYXlvdXQAAAH+FAAAAZwVAAAAAnJyAAABqhIAAAAAB29ubGltaXQAAAGVFQAAAasVAAAAEG5jbHVkaW5nbWV0YWRhdGEAAAGvFQAAAPIGZGJ5dGVzAQBpAVgVAAAA+tgCAGVp8gJvY4WAEQgSAQwNAAABGBQAAPZEAADBy7BQE+gAAaAQAAASTKAwAAASNKAAAAASOIASEwOwAaAwAAASNQAAAgBAXRgNADswAAABAAB4AAsAqAITAEUGNQDEBgQAMggXAL4PBACSEQQA6BIAANMTAAAIFQEADBUBACEVAQABgAKgMAAAEqugUAAAFQthZQAAAAD01QIAAAEAAQABAABWAAAAAQSgIAAAFa+wABJgApCwYBQkAAFkYW1zdgA7MAAAAQAABQACAGELBAAQEgAA9s8VAMjJW5n32x9+FB+w5SlSH1uR9oHnoMAAABWeAAKqC4BRBWQAOzAAAAEAADIACgAbBwkA2QcDAG8LBABpDBMAJQ0FAOcSAAC6FAAA/BQBADcVAACvFQAAAIAbCOKQAAAAMuPgAAAAM+XQAAAAi3HqOidWJ2U++gc+RycuMpkBQCwqETG95hGgshfHdFMxX6pBeQ1BFDJ4lVLzHx+OXUp7dclnaA+Bbs5QBHBLNT01y27kBrQ0FXIxMe18CXF9dw/6MTD5ht/0Ky8OplDiNQH2REQ9ZSwi2RYXwn92XKKIZw1c819oFWz8NF2UUSEcZRBeelXkk2m7PVmKUOCgq6AAAAAAMrAAA1gC7LAQA1gC7KAAAAABgKAAAAAAM6AAAAAAixzBUIHE9zlOwy0pkCgtW2FiY2RlZmdoaWprbG1ub3BxcnN0dXZ3eikyMzg+XXh5","N":"AEK`","E":"OjAAAAAAAAA=","H":"2G+3Pbdj"},"crateNames":{"N":"b","E":"OjAAAAAAAAA=","H":"WDeea9NJ"},"name":{"N":"AEK`","E":"OjAAAAAAAAA=","H":"uCtO6XtT"},"path":{"N":"Oa","E":"OzAAAAEAAL4UgAAAADEANAAlAFsALwCMAFwA6gADAO8AAwD0AIsAgQFRANQBTgAkAhIAOQIXAFICVQCpAg8AvAIXANUCggBZA1ECrAWCADAGEwBFBjUAfAYbAJoGDwCvBg4AvwYDAMQGPQADBwIABwcNABYHAwAbBw0AKgcLADgHOABzBwcAfgcZAJsHUADuB0IAMggoA1wLiwDqC2YAUgwWAGoMDwB9DAMAggwHAIsMBACRDAQAlwwDAJwMAwChDAkArAwMALsMCADFDAgAzwwIANkMAgDgDA8A8wwDAPgMBwACDQcADA0YACYNAwArDUoBdw5RAMoOmQBlD0EAqQ8OALkPAwC+DwMAxQ8DAMsPCwDbDxEA7w8DAPcPAwD9DwIAAhADAAgQZgFwEQwAgRExALQRDADCERYA2hECAN4RLwASEgAAGhIBAB4SAQAhEgAAJBIBACcSAAArEgIAMRICADYSAQA5EgAAOxISAE8SAABREgUAWRIAAFsSAQBeEksAqxIAAK8SAQC1EgIAuxICAMMSAQDHEgAAzRIDANISOgAOE8UA3BMBAOQTAwDpEwMA8BMAAPMTDwAEFB8AJRQAAC8UnwDRFAMA1xQBANwUFADyFAEA9hQBAPoUAQD9FBcAFxUBABsVBQAiFRcAPBUBAEAVAQBFFQoAUhUBAFYVOwCTFQkAnhURAA==","H":"HGufQ793"},"entry":{"N":"AEAg","E":"OjAAAAEAAAAAAJgAEAAAADIAMwCLAOkAgAHTATcCOAKoAtQCWAOrBS8GRAZ7BpkGrQauBr4GAgd9B+wH7QdbC+gL6QtRDGkMgQyQDJYMmwygDKsMugzdDN4M3wwLDSUNdg7JDmQPpw+oD7gPww/ED8oP1w/YD9kP2g/0D/UP9g/8DwEQBhAHEH0RfhF/EYARwRHZERASERIVEhgSGRIcEh0SIBIiEiMSJhIoEikSKhIuEi8SMBJOElASVxJYEl0SrRKuErISsxK0ErgSuRK6Er4SvxLAEsUSxhLLEswS0RINE9UT1xPYE9kT2hPbE+ET4hPoE+0T7hPvEwMUJBQpFCoULRQuFM8U0BTVFNYU2RTaFNsU8RT0FPUU+BT5FPwUFRUWFRkVIRU6FTsVPhU/FUIVQxVEFVAVURVUFVUVkhWdFQ==","H":"wOOAQrMb"},"desc":{"N":"HOe","E":"OzAAAAEAALoMWgEAADMANgAAADkAAAA8AAAAPwAAAEIAEwBbAAAAXgAAAGEABABoAAAAawAEAHIAAAB1AAQAfAAAAH8ABACGAAAAiQD4AIMBAACFAQIAiQEAAIsBAgCPAQAAkQECAJUBAACXAQIAmwEAAJ0BAACiAQMAqgEDALIBAwC6AQMAwgECAMYBAQDJAQEAzAEBAM8BAQDSAQIA1gEAANgBAADaAQAA3AETAPIBAAD1AQQA/AEAAP8BBAAGAgAACQIEABACAAATAgQAGgIAAB0CAQAmAgEAKgIBAC4CAQAyAgEANgIWAFICCQBgAgMAaAIDAHACAwB4AgMAgAIBAIYCAwCOAgMAlgIDAJ4CAwCmAgIAvAIAAL8CAgDEAgIAyQICAM4CAgDTAgEA4gIeAi4FBAA0BQQAOgUDAEMFBABJBQQATwUDAFgFBABeBQQAZAUDAG0FBABzBQQAeQUDAIIFBACIBQQAjgUDAJwFEACzBQAAugUAAMUFAADNBQAA2gUAAOIFAADvBQAA9wUAAAQGAAAMBgAAEgYyAEYGAwBLBgIAUQYDAFYGAgBcBgMAYQYCAGcGAwBsBgIAcgYDAHcGAgB7BgAAgAYZAK0GEQDEBgQAywYBAM8GAQDTBgEA1wYBANsGAADgBgMA6AYDAPAGAwD4BgMAAAcCAAcHCQAqBwMAOAcBADwHAAA/BwUARwcAAEoHBQBSBwAAVQcFAF0HAABgBwUAaAcAAGsHAQB9BwIAgQcAAIQHAACHBwAAigcAAI0HAACQBwAAkwcAAJYHAACbBxMAswcDALsHAwDDBwMAywcDANMHAQDiBwsAJwgKAFoIAABcCAAAZQgAAG0IAAB7CAAAgAgAAIMIAACMCAAAoggBAKwIAAC2CAAAxAgAAMkIAADLCAAA1QgAAO4IAQD3CAAAAgkAABAJAAAVCQAAFwkAACEJAAA6CQEAQwkAAE4JAABcCQAAYQkAAGMJAABtCQAAhQkBAJAJAACaCQAAqAkAAK0JAACwCQAAuQkAAM0JJwD6CQ4AWwsAAHQLNgC+CwMAwwsDAMgLAwDNCwMA0gsDAOgLAQDrCwkA9gsFAP8LCQAKDAUAEwwJAB4MBQAnDAkAMgwFADsMCQBGDAUAUQwKAGkMAAB9DAQAiwwFAJYMAACbDAAAoAwAAKMMAQCmDAEAqQwDAK4MAACxDAAAtAwAALcMAAC6DAAAxQwEAM8MAADRDAAA0wwAANUMAADXDAAA3QwCAAINBAALDQEAJQ0FADUNCQBEDQAARg0AAEgNAABKDQAATA0AAGoN9wBjDgEAZg4BAGkOAQBsDgEAbw4HAIoOBACZDgAAmw4AAJ0OAACfDgAAoQ4AAKMOAADJDgAAyw4AAM0OAADPDgAA0Q4AANMOAADkDgEA5w4BAOoOAQDtDgEA/Q4EAEYPAABkDwAAaQ8lAKcPAQCqDwEArQ8BALAPAQCzDwEAtg8CAMMPAQDKDxoA9A8CAPwPAAABEAYAHhBMAX0RAwCvEQQAwREAANkRAAAOEgAAEBICABUSAAAYEg4AKBILAD0SDgBOEgAAUBIDAFcSAQBaEgAAXRIAAGESRQCpEgIArRIDALISDgDEEgMAyxIDANESAADZEgAA3BIAAN4SAADpEgMA7xIAAPESBwD8EgAAAxMGAA0TvwDOEwEA0RMBANUTAADXEwYA4RMBAOQTBQDrEwUA8xMCAPcTAQD6EwMAAxQAAAUUEwAcFAEAJBQBACkUAQAtFE4AhBQyAMoUFADnFAYA8RQPAA4VBAAVFQQAGxUHACkVAQAzFQUAOhUOAE8VPACPFQEAkhUDAJoVAwCfFQAAohUBAKkVAACrFQQA","H":"9o1Ez0tw"},"function":{"N":"A@Jk","E":"OzAAAAEAAAQFLgAyAFkA6QAKAIABVAFYAwAAqwUAAC8GAABEBgAAewZZAewHAQAtCAQAWwsAAOgLAQBRDAAAaQyiACUNBQB2DgAAyQ4AAGQPAACnDwEAuA9TAGsRBAB9EQMArxEEAMERAADZEQQADhInADgSAAA6EgAAThIAAFASAABXEgEAWhIAAF0SAACqEiQA0RIAAA0TAADUEx4AAxQAACQUEADPFA8A8RQMABUVDQA6FQ0AUBUHAJIVAQCdFQAA","H":"WjMEUcHs"},"type":{"N":"Lc","E":"OzAAAAEAAOwUbQAAADEANAAlAFsALwCMAPMAgQFRANQBTgAkAhIAOQIXAFICVQCpAg8AvAIXANUCggBZA1ECrAWCADAGEwBFBjUAfAYbAJoGDwCvBg4AvwYDAMQGPQADBwIABwcNABYHAwAbBw0AKgcLADgHQgB+BxkAmwdQAO4HYgRSDBYAagwPAH0MAwCCDAcAiwwEAJEMBACXDAMAnAwDAKEMCQCsDAwAuwwIAMUMCADPDAgA2QwCAN4MEQDzDAMA+AwHAAINBwAMDVcCZQ9BAKkPDgC5DwMAvg8DAMUPAwDLDwsA2w8RAO8PAwD3DwMA/Q8CAAIQAwAIEAYCEhIAABoSAQAeEgEAIRIAACQSAQAnEgAAKxICADESAgA2EiAAWBJRAKsSAACvEgEAtRICALsSAgC/EgEAwxIBAMcSAADNEgYB1RMAANcTAADZEwAA2xMCAOITAADkEwMA6RMDAO4TAgDzEw8ABBQfACUUAAApFAEALxSfANEUAwDXFAEA3BQUAPIUAQD2FAEA+hQBAP0UFwAXFQIAGxUFACIVFwA8FQEAQBUBAEUVCgBSFQEAVhU7AJMVCQCeFREA","H":"Ef10Cl4w"},"alias":{"N":"`","E":"OzAAAAEAAK8VAQAAAK8V","H":"p2IVDFMs"},"generic_inverted_index":{"N":"m","E":"OjAAAAAAAAA=","H":"psci5vxZ"}}')
\ No newline at end of file
@@ -0,0 +1 @@
+rd_("AOg[\"AAAAAAADyhQAAMwUAADNFAAAAAABvBEAAAAAAa4RAAAAAAFdDQAAAAHgAgAA\",\"AAAAOjAAAAEAAAAAAAcAEAAAAE4IYAtaD7gRSRVKFZYVlxU6MAAAAQAAAAAADQAQAAAA2AInCCwI/A5GD1sPXA9dD14PWxLEFPAUMBUxFTswAAABAABzAAwA3AcAAJMOAAD7DgAAXBIAAAITAAAEFAAAhBQyAAYVAwBNFQEAWRUyAKQVAACrFQAAOjAAAAEAAAAAAAcAEAAAAN4LaA+tEekS6hLrEuwS7RI7MAAAAQAACwAFAO0JBwDZCwAAkREAAMUUAADvFAAABNgHAAC4CwAA7hQAADkVAAACKAUAAAoVAAAEyA4AAAUSAADVEgAAFBUAAAKCFAAAmRUAAAJgDQAApA8AAAUzDQAANA0AAKwRAADkFAAA5RQAAAMUEAAAuxQAAKAVAAAB4A4AAALhDgAAoRUAAAG9FAAAAacVAAAAAagVAAA=\"]Ic[\"AAAAAAACog4AAKMOAAACoA4AAKEOAAADYw8AADsSAAA8EgAAAAdTCAAA2BEAADYSAAA3EgAANRQAAAoVAAArFQAAAAEVEAAAAk0SAACtFQAAAjMNAAA0DQAAARQQAAABJRUAAAHgAgAA\",\"\"]Eg[\"AAAAAWAOAAAAAuIAAAD1AgAAA/IEAADeCwAA6xQAAAH0CQAAAAEKFQAA\",\"AAAAAWAOAAAAAAAAAe4UAAA=\"]Lc[\"AAAAAAAAAAACCAYAAAkGAAAAA14SAACUFQAAnxUAAAABZQsAAAABXQ0AAAElFQAA\",\"AAAAAAAAAc8SAAAGow8AAKUPAAAEEgAABxIAANQSAADWEgAAAAGsFQAABgUSAABeEgAA1RIAAJQVAACfFQAArhUAAAEVEAAAAqQPAACtFQAAAAEUEAAAASUVAAA=\"]Ek[\"AAAAAAA7MAAAAQAAMgABAFkVMgAAAAAAAAACZQsAAE0SAAAAAAElFQAA\",\"AAAAAAAB/hQAAAHjCwAAAZwVAAA=\"]Hg[\"AAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAJpCwAA6BIAAA==\",\"AAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAACXwwAANMTAAA=\"]Dk[\"AAAAATMOAAAAAdUAAAABrwQAAAIBBgAA7QkAAA==\",\"AAAAATMOAAAAAAAAAAAB+QkAAA==\"]Bg[\"AAAAAAAAAAAAAAAAAAAAAAAAAT8DAAA=\",\"\"]Bg[\"AAAAAAAAAAAAAAAAAAAAAAAAAUMDAAA=\",\"\"]Bo[\"AAAAAAAAAAAAAAABrhEAAA==\",\"AAAAAAABJwUAAA==\"]4AOg[\"AAABtQ4AAAIEBgAARw4AAAJ8EQAAqBIAAARxBgAAzhEAAPYSAAATFQAABdAEAAANCAAAuhQAAN8UAAAMFQAAAs4TAADREwAABOECAADhBwAAIg0AAI0RAAADaAwAAD0PAAA2EgAAAyQIAACPFQAAmhUAAAUhDQAA0hIAAAUTAAAIEwAAARUAAAM8DwAABxMAAA4VAAA6MAAAAQAAAAAACAAQAAAAJAUjCDMNHg+sEYEU7BQPFTMVA14NAAAUEAAANRUAAAFfDQAAAYMUAAAAAacVAAAAAagVAAA=\",\"AAABtQ4AAAFHDgAAAXwRAAAEcQYAALUPAAD2EgAAExUAAAQGEgAAuhQAAN8UAAAMFQAAAALhAgAAIg0AAAIoBQAAaAwAAAJHCAAABRIAAAEhDQAAAANGCAAAMw0AAOQUAAACuxQAAKAVAAAB4A4AAALhDgAAoRUAAAG9FAAABW8BAAByBgAAcwYAALYPAACnFQAAAAGoFQAA\"]A@o[\"AAAAAgwGAABUDgAAAQ4IAAADdgYAAM8RAAD/EgAAA+QEAACOEQAADRUAAALPEwAA0hMAAAQjDQAAPw8AAJAVAACbFQAAAzcSAAAGEwAACRMAAAUlCAAA0xIAAO0UAAAQFQAANBUAAAMVEAAAghQAADYVAAABYA0AAAE0DQAA\",\"AAAAAVQOAAAAAnYGAAD/EgAAAQ0VAAACKQUAAAcSAAABIw0AAAFICAAAAbwUAAAB4g4AAAABNA0AAAAAAAACdwYAALcPAAA=\"]Gg[\"AAAAAVgOAAABtAsAAAHdAAAAAugEAADEDgAAAvAJAADFFAAAAiQNAABADwAAASYIAAA=\",\"AAAAAVgOAAAAAnoGAADwEQAAASoFAAAAAkkIAAAkDQAA\"]Fk[\"AAAAAAAAAAAAAecSAAAAAZkVAAAAAAEZDwAA\",\"AAAAAAGYFQAAAAOaBQAA4wsAAOsRAAAAApsFAADuFAAAAAAAAAIkBQAA3xIAAA==\"]Bc[\"\",\"AAAABCcVAACMFQAApRUAAKYVAAA=\"]AOk[\"AAAAAAcnCAAALAgAAEYPAABbDwAAXA8AAF0PAABeDwAAOzAAAAEAALEACQB6BgAAqgsAAEwMAACmDwAACBIAAFwSAAA2FEUAhBQyAFkVMgA7MAAAAQAAVgAMAFkDAgCjBAEApgQBAKkEGQDFBAcAzwQnAAAIAADEDgAA8w4AAJ8RAACtEQAA6xEAADswAAABAAALAAUA7QkHANkLAADFFAAA7xQAAAsVAAA6MAAAAQAAAAAABwAQAAAApQSoBMMEzQRJCCQNQA85FQTEBAAAzgQAACYIAAAYDwAAAsgOAAAUFQAAAiENAACZFQAAAmULAAA8DwAABSMIAABGCAAAHg8AAKwRAADlFAAAAl0NAAAZDwAA\",\"AAAAAAA7MAAAAQAARQABADYURQABDA0AAAejDwAApQ8AAAQSAAAHEgAA1BIAANYSAADzEwAAARgUAAACNRQAAKwVAAAFBRIAANUSAACUFQAAnxUAAK4VAAAAAqQPAACtFQAA\"]Lo[\"AAAAAQMGAAAABAcGAACTDgAADQ8AAMARAAAGmgUAAN4LAACfEQAA4hEAAOcRAADtEgAAAiYFAADzEwAAAwgGAAAJBgAAvBEAAAIKFQAAKxUAAAJeEgAAFBUAAA==\",\"AAAAAANQDAAAHRAAAKgSAAABHBAAAAPiEQAA5xEAAKcSAAAB8xMAAAHuFAAAAALIDgAAXhIAAA==\"]Ig[\"AAAAAAAEpg8AAPARAAAIEgAAXxIAAAEqBQAAAsUUAADvFAAAAUAPAAABJggAAA==\",\"AAAAAAGNBQAAAAAAAAAAAAAAAAAAAZEVAAA6MAAAAQAAAAAACAAQAAAAMAAxAAwBjgWPBZAFkQWqBakS\"]<Ic[\"AAAAA0gVAABYFQAArxUAAAMnCAAARg8AAJUVAAAC/hQAAKsVAAACWwMAAAwNAAAC8xMAAJwVAAABGBQAAAI1FAAArBUAAAOUFQAAnxUAAK4VAAAAAa0VAAA=\",\"AAKsBQAAPRIAAAE4FQAA\"]=Ic[\"AAAAAUgOAAAAAv4HAAD3EgAAAtEEAAAsFQAAAAEiDQAAAAABIQ0AAAAAAAAAAAMkAwAA6gcAAAcKAAA=\",\"AAAAAUgOAAAAAv4HAAD3EgAAASwVAAAAAAAB1RIAAAAAATMNAAABFBAAAA==\"]Hc[\"AAAAAVUOAAAAAv8HAAAAEwAAAuUEAAAtFQAAAAEjDQAAAAAAAAAAAAAAAiUDAADrBwAA\",\"AAAAAVUOAAAAAv8HAAAAEwAAAS0VAAAB1hIAAAAAAAEVEAAAAAE0DQAA\"]Dc[\"AAAAAVkOAAAAAd4AAAAB6QQAAAHxCQAAASQNAAA=\",\"AAAAAVkOAAAAAAEACAAA\"]Ck[\"AAAAAAAAAAAAAAAAAAAAAAAABYMFAAAICgAA0wsAANMOAAC2DwAA\",\"\"]Cc[\"AAAAAAAAAAAAAAAAAAAAAAAAA4kFAADVCwAAtw8AAA==\",\"\"]Mg[\"AAAAAAACfgUAAOASAAABIwUAAAHZCwAAAAGsFQAAAZQVAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAJpCwAA6BIAAAJfDAAA0xMAAA==\",\"AAAAAv0FAABAEgAAAAABIwUAAAAAAawVAAABlBUAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAmkLAADoEgAAAl8MAADTEwAA\"]Oc[\"AAAAAUQOAAAAAAPLBAAAoA4AAKEOAAABcwsAAAABZwwAAAFHCAAAAdISAAAABEYIAADfEgAAgRQAAOUUAAABuxQAAAFfDQAAAeEOAAAAAacVAAAAAagVAAA=\",\"AAAAAUQOAAAAAAAC/xMAACgVAAABOw8AAAJnDAAAPQ8AAAAAATwPAAABHg8AAAFeDQAAAl8NAADgDgAAA+EOAACDFAAAoRUAAAG9FAAAAAABqBUAAA==\"]Do[\"AAAAAAAAAAACmwUAALwRAAAAAQ8PAAACDg8AAK4RAAA=\",\"AAAAAAAAAQYSAAABWgsAAAHYBwAA\"]Gg[\"AAAAAhEGAAA4DgAAAdASAAAC1gAAABwQAAADuQQAALoEAADPEgAAASYFAAACvBEAADkVAAA=\",\"AAAAATgOAAAAAQ0PAAABzxIAAAEmBQAAAbwRAAA=\"]Eg[\"AAAAAVsOAAAAA+AAAADwEQAAXxIAAAHrBAAAA/MJAADFFAAA7xQAAA==\",\"AAAAAVsOAAAAAqYPAAAIEgAA\"]Cg[\"AAAAAV4OAAAAAuEAAABcEgAAAe4EAAA=\",\"AAAAAm4LAABeDgAA\"]Mo[\"AAAB2RIAAAJBDgAA4xIAAAEdEAAAA9kAAADzAgAAJwUAAATHBAAAyAQAACUFAADpFAAAAe4JAAADCAYAAAkGAACpFQAAAAACrhEAACYVAAACBxMAAA4VAAAB5BQAAAAAAaEVAAAAAAABqBUAAA==\",\"AAAAAUEOAAAAAQcGAAAAAAAAAAAAAAAAAAA7MAAAAQAABgADAJwLAgCiCwIAjg4AAA==\"]Dc[\"AAAAATwOAAAAAtgAAADyAgAAAr4EAADoFAAAAAABGA8AAA==\",\"AAAAATwOAAA=\"]Dg[\"AAAAAVIOAAAAAtsAAAD0AgAAAuEEAADqFAAAAAAAAAAAAAEZDwAA\",\"AAAAAVIOAAA=\"]Fc[\"AAAAAjoOAADLFAAAAAABvAQAAAAAAAABDg8AAAAAAAAAAAMUAwAAQAYAAIcPAAA=\",\"AAAAAToOAAAAAaoLAAABmgUAAA==\"]Eo[\"AAAAAlAOAADOFAAAAAAB3wQAAAAAAAEPDwAAAAAAAAAAAAMYAwAAQgYAAIsPAAA=\",\"AAAAAVAOAAAAAAAAAZsFAAA=\"]Hg[\"AAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAJpCwAA6BIAAA==\",\"AAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAACXwwAANMTAAA=\"]AIo[\"AAAAAAAAAqcSAAD/FAAAA3MLAABGDgAAkREAAAbNBAAAOgwAAPUSAAAyFQAAohUAAKkVAAAFzgQAAGcMAAAYDwAA5xIAAC4VAAABRwgAAALSEgAAmRUAAAIHEwAADhUAAAdGCAAA3xIAAIEUAADlFAAA7BQAAA8VAAAzFQAABF0NAABeDQAAuxQAADUVAAACXw0AAOAOAAAC4Q4AAIMUAAABvRQAAAGnFQAAAAGoFQAA\",\"AAAAAAAAAANGDgAA/xMAACgVAAAEOgwAADsPAAD1EgAAMhUAAARnDAAAPQ8AAOcSAAAuFQAAAAEODwAAAjwPAACkDwAAAh4PAACBFAAAA14NAAC7FAAAoBUAAAJfDQAA4A4AAAPhDgAAgxQAAKEVAAABvRQAAAGnFQAAAAGoFQAA\"]Lg[\"AAAAAlMOAAAAFQAAAANFDAAA/hIAAKMVAAAE4gQAAOMEAADzDgAALxUAAAAAAUgIAAAF0xIAALwUAADtFAAAEBUAADQVAAAD4g4AAIIUAAA2FQAAAWANAAAAARkPAAA=\",\"AAAAAVMOAAAAAkUMAAD+EgAAAkUPAAAvFQAAAj4PAAClDwAAAT8PAAAAAQ8PAAA=\"]Fk[\"AAAAAVcOAAABswsAAAHcAAAAA+cEAAAACAAARQ8AAALvCQAA7xQAAAFJCAAA\",\"AAAAAVcOAAAAAkwMAABfEgAAAfMOAAAAAUAPAAA=\"]Ng[\"AAAAAAPEFAAAMBUAADEVAAAAAAAB4QIAAAAAAAFlCwAA\",\"AAAB5hIAADowAAABAAAAAAAKABAAAADnC5sR2xLdEuIS4xLkEuUS/hONFY4VAuESAADmFAAAOzAAAAEAABMABACaAAAA1QAOAM0RAgDgEgAAAiIIAACfEQAAAAABJggAAAMkCAAAJQgAANMSAAAE0hIAANcSAADYEgAAJhUAAAABIwgAAA==\"]Eg[\"AAAAAAADyhQAAMwUAADNFAAAAAABmwUAAA==\",\"AAAAAAAAAAAAAAAAAAAAAAAAA5cAAACYAAAAmQAAAA==\"]ABc[\"\",\"AAAAOjAAAAEAAAAAAAcAEAAAAE4IYAtaD7gRSRVKFZYVlxU6MAAAAQAAAAAADQAQAAAA2AInCCwI/A5GD1sPXA9dD14PWxLEFPAUMBUxFTswAAABAABzAAwA3AcAAJMOAAD7DgAAXBIAAAITAAAEFAAAhBQyAAYVAwBNFQEAWRUyAKQVAACrFQAAAt4LAACtEQAAOzAAAAEAAAoABADtCQcA2QsAAMUUAADvFAAAATkVAAABChUAAAEUFQAAAoIUAACZFQAAAWANAAACrBEAAOUUAAA=\"]6BJk[\"AAAAOjAAAAEAAAAAABwAEAAAAAIGCgYQBucLmxHXEQ0SYBL+EyEUfBS3FL4UvxTCFMYUxxTgFOMUAhUDFQQVJxVJFYwVjRWWFaUVqhU6MAAAAQAAAAAACQAQAAAAzAlbD3wRWxJ/FMQU5hTwFDAVMRU6MAAAAQAAAAAAFgAQAAAABwZxBv4HQw2oDsIOtQ+WEVkS7hLvEvAS8RLyEvMS9hL3EvgSAhPAFMEUExVNFTowAAABAAAAAAAHABAAAACmBOIR5xG6FN8UDBUsFUsVBwEGAABzCwAAOxIAAM4TAADREwAA/xMAACgVAAA6MAAAAQAAAAAACgAQAAAA4QIIBgkG4Qc6DCINOw+NEfQS9RIyFTowAAABAAAAAAAHABAAAAAoBWcMaAw9D+cSChUrFS4VOjAAAAEAAAAAAAcAEAAAACQIRwj5CQUSXhLVEo8VmhU6MAAAAQAAAAAABwAQAAAAIQ0OD64R0hIFEwgTARUmFQVlCwAAPA8AAKQPAAAHEwAADhUAADowAAABAAAAAAAKABAAAAAkBSMIRgisEd8SgRTkFOUU7BQPFTMVBF4NAAC7FAAANRUAAKAVAAACXw0AAOAOAAAD4Q4AAIMUAAChFQAAAb0UAAABpxUAAAABqBUAAA==\",\"AAL+BQAAQRIAAAABDRIAAAF1DgAA\"]AEo[\"AAAAOjAAAAEAAAAAAAsAEAAAAA0GIhR9FLgUwxTIFOEUBRVKFY4VlxWmFQZcDwAA+RIAAPoSAAD8EgAA/RIAAIAUAAA6MAAAAQAAAAAACQAQAAAAdgb/B0UMww77Ev4S/xIAEwETThUH0wQAAEUPAACOEQAADRUAAC0VAAAvFQAATBUAADowAAABAAAAAAAHABAAAAApBT4PpQ8HEjwS1hLPE9ITBCMNAAA/DwAAkBUAAJsVAAAESAgAANgRAAAGEwAACRMAAAclCAAADw8AANMSAAC8FAAA7RQAABAVAAA0FQAAA+IOAACCFAAANhUAAAFgDQAA\",\"AAILBgAASBIAAA==\"]Lg[\"AAAABw4GAABuCwAAIxQAAH4UAAC5FAAAyRQAAOIUAAAEjQUAALMLAAC0CwAAXQ8AAAd6BgAATAwAAKYPAADwEQAACBIAAFwSAABfEgAABvEEAAAqBQAAAAgAAMQOAADzDgAARQ8AAALFFAAA7xQAAANJCAAAJA0AAEAPAAABJggAAA==\",\"AAIPBgAASRIAAA==\"]9Gk[\"AAAAAUIOAAAAAUMNAAACyQQAAA0IAAAAAuEHAACNEQAAAAABARUAAAAAAAAAAAKiCwAAPQ0AAA==\",\"AAABiA4AAAFCDgAAAAFDDQAAAAABCAYAAAEoBQAA\"]Jo[\"AAAAAAAAAAI/DgAARg4AAAAAAp8VAACuFQAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAACaQsAAOgSAAA=\",\"AAAAAAAAAAI/DgAARg4AAAAAAp8VAACuFQAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAl8MAADTEwAA\"]Bk[\"AAAAAAAAAAACpQQAAKgEAAACxAQAAM4EAAA=\",\"\"]<<<Hc[\"AAAAAUMOAAAAAagOAAABygQAAAAAAAAAAAABXQ0AAAAAAAKjCwAAPg0AAA==\",\"AAABiQ4AAAFDDgAAAAGoDgAAAAABCQYAAAACBRIAANUSAAAAAaQPAAAAARQQAAA=\"]Bo[\"AAAAAAAAAAAAAVMIAAAAAAGtFQAAAAAAAeACAAA=\",\"\"]Fo[\"AAAAAUAOAAAAAicFAADBFAAAAcUEAAAAAAAAAq4RAAABFQAA\",\"AAIFBgAARhIAAAGHDgAAAUAOAAAAAtIOAADBFAAAAAAAAAABrhEAAA==\"]Cc[\"AAAAATsOAAAAAaoLAAABvQQAAA==\",\"AAAAAgMGAAA7DgAA\"]Jk[\"AAAAAoYJAABFDgAAAAABzAQAAAAAAAAAAgcTAAAOFQAAAAJdDQAAXg0AAAHgDgAAAYMUAAABvRQAAAGnFQAAAAGoFQAA\",\"AAAAAUUOAAAAAAAAAAAAAQ4PAAAAAYEUAAACuxQAAKAVAAABXw0AAAHhDgAAAAGnFQAAAAA=\"]Co[\"AAAAAAACfgUAAOASAAABIwUAAAHZCwAAAaUEAAA=\",\"AAAAAv0FAABAEgAA\"]Hg[\"AAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAJpCwAA6BIAAA==\",\"AAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAACXwwAANMTAAA=\"]AHc[\"AAAABIEFAABJDgAAbw4AAOQSAAAABNILAADCDgAA0g4AAPgSAAAE0gQAAA0IAAAGEgAASxUAAALOEwAA0RMAAALhBwAAjREAAAIoBQAAaAwAAARHCAAA+QkAAI8VAACaFQAABdISAAAFEwAACBMAAAEVAAAmFQAAAgcTAAAOFQAAOjAAAAEAAAAAAAoAEAAAACQFRggeD6wR3xKBFOQU5RTsFA8VMxUEXg0AALsUAAA1FQAAoBUAAAJfDQAA4A4AAAPhDgAAgxQAAKEVAAABvRQAAAGnFQAAAAGoFQAA\",\"AAAAAgoGAABJDgAAAAPSCwAAwg4AAPgSAAACDQgAAEsVAAAAAuEHAACNEQAAAAABARUAAAAAAAAAAAEkAwAA\"]Ok[\"AAAABIcFAABWDgAAcA4AAOUSAAABDggAAAPUCwAAww4AAAETAAAD5gQAAI4RAABMFQAAAykFAADPEwAA0hMAAAKQFQAAmxUAAANICAAABhMAAAkTAAAF0xIAALwUAADtFAAAEBUAADQVAAAD4g4AAIIUAAA2FQAAAWANAAA=\",\"AAAAAg0GAABWDgAAAQ4IAAAD1AsAAMMOAAABEwAAAo4RAABMFQAAAAAAAAAAAAAAAAABJQMAAA==\"]Fg[\"AAAB5hIAAAFaDgAAAY0FAAAB3wAAAATqBAAAKgUAAAAIAADEDgAAAfIJAAABSQgAAA==\",\"AAAAAg4GAABaDgAAAAABxA4AAA==\"]Ek[\"AAAAATIOAAAAAAGuBAAAAAAAAAAAAAAAAAAESxIAANwSAAD8EwAATxUAAA==\",\"AAFFEgAAAAIyDgAAkw8AAA==\"]Dg[\"AAAAATkOAAAAAdcAAAABuwQAAA==\",\"AAAAATkOAAAAAAAAAAAAAAAAAAAAAAFABgAA\"]Do[\"AAAAAU8OAAAAAdoAAAAB3gQAAA==\",\"AAAAAU8OAAAAAAAAAAAAAAAAAAAAAAJCBgAAQwYAAA==\"]Eg[\"AAAABbwLAABLDQAAaA0AAFoPAADbEgAAAtgCAADsDgAAAvsOAAAEFAAAAaQEAAA=\",\"AAE/EgAAAAFoDQAA\"]Bc[\"AAAAAAAAAAABORUAAAABFBUAAA==\",\"\"]Lc[\"AAAAAAAAAAACCAYAAAkGAAAAA14SAACUFQAAnxUAAAABZQsAAAABXQ0AAAElFQAA\",\"AAAAAAAAAc8SAAAGow8AAKUPAAAEEgAABxIAANQSAADWEgAAAAGsFQAABgUSAABeEgAA1RIAAJQVAACfFQAArhUAAAEVEAAAAqQPAACtFQAAAAEUEAAAASUVAAA=\"]Ni[\"AAAAAAADyhQAAMwUAADNFAAAAAABvBEAAAAAAa4RAAAAAAFdDQAAAAHgAgAA\",\"AAAAAAAAOzAAAAEAAAUAAgBoDwAA6RIEAAGREQAAA9gHAAC4CwAA7hQAAAEoBQAAA8gOAAAFEgAA1RIAAAABpA8AAAMzDQAANA0AAOQUAAADFBAAALsUAACgFQAAAeAOAAAC4Q4AAKEVAAABvRQAAAGnFQAAAAGoFQAA\",1]CLo[\"AAAFHRQAACkVAAAqFQAANxUAADgVAAA6MAAAAQAAAAAADQAQAAAABAYMBlMSVBIEEwoT9RP2E/cT+BP5E/oT+xMeFDowAAABAAAAAAAHABAAAADYAjoPHBQgFOYU8BQRFRIVOjAAAAEAAAAAAA8AEAAAAMARUhJWEgITAxMME/QTBBTAFMoUzBTNFE0VThWjFasVOjAAAAEAAAAAAAcAEAAAACMFIgjpEuoS6xLsEu0SHxQ6MAAAAQAAAAAAEwAQAAAAIgUpBXMLow+lDwQSBxJVEtQS1hILE80TzhPPE9AT0RPSE/8TABQoFQI/DwAAohUAADowAAABAAAAAAAIABAAAAAoBVMIPQ/nEgYTCRMBFAIUrBUGJAgAACUIAADIDgAABRIAANUSAACuFQAABtcSAADYEgAABRMAAAgTAAAmFQAAmRUAAAM8DwAApA8AAK0VAAABIwgAAAIZDwAAoBUAAAAB4AIAAAABpxUAAAAA\",\"AAEZFAAAADowAAABAAAAAAAsABAAAAB9BYAFgQWHBbwLSw1uDm8OcA5UEmASChMbFB4UIRQiFCMUfBR9FH4UtxS4FLkUvhS/FMIUwxTGFMcUyBTJFOAU4RTiFOMUAhUDFQQVBRUjFSQVSBVYFaoVrxU6MAAAAQAAAAAACAAQAAAAfwXMCewO0BIgFH8UgBSVFZgVBn4FAADAEQAAVhIAAAwTAAAaFAAAwBQAADswAAABAAAFAAIA6RIEAB8UAAAEcwsAAJERAABVEgAACxMAAAHuFAAAAjYSAAA3EgAAAcgOAAAAAWULAAAB5BQAAAAAAAGeFQAAOzAAAAEAAEMAGQAoAAcA6AAAAAgBAwAVAQEAHwEBABQDBwBMAwEA/wQBAIIFBACIBQQAqAUBACEGAwAtBgEAqAkAALkJAABaDAEATA0AAO0OAQABDwAAhw8HAEsSAADcEgAA3hIAAPwTAABPFQAA\"]Hc[\"AAAAAAACog4AAKMOAAACoA4AAKEOAAADYw8AADsSAAA8EgAAAAbYEQAANhIAADcSAAA1FAAAChUAACsVAAAAARUQAAABTRIAAAIzDQAANA0AAAEUEAAAASUVAAA=\",\"\"]Co[\"AAAAAW4OAAAAAdELAAAAAAABUwgAAA==\",\"AAAAAAAB0QsAAAAAAAFTCAAA\"]Fg[\"AAAAAAACtQ8AAJYRAAACzwQAAK0RAAAAAAAAAAAAAAAAAARvAQAAcwYAAAYKAAA9DAAA\",\"AAAAAAABlhEAAAElBQAAAVoLAAA=\"]Bg[\"AAAAAAAAADswAAABAAAHAAEA7QkHAA==\",\"\"]Ao[\"AAAAAAAB/hQAAAABnBUAAA==\",\"\"]Ec[\"AAAAATEOAAAAAAGtBAAAAQEGAAAAAAAAAAAAAAAAA0wNAAABDwAA3hIAAA==\",\"AAFEEgAAAAExDgAA\"]Bk[\"AAAAAAAAAAAAAAAAAAAAAAAAAhUDAACIDwAA\",\"\"]ADa[\"AAAAAssUAADOFAAAADowAAABAAAAAAAHABAAAAACEwQUyhTMFM0UTRVOFasVAAAAAAACARUAACYVAAAAAAGgFQAAAAA=\",\"AAAAAR4UAAAGzAkAAOwOAADQEgAAfxQAAIAUAACVFQAAOjAAAAEAAAAAAAgAEAAAACcFqgvRC9IL1AvSDhwQWRLAFAclBQAAKgUAAM8SAADoFAAA6RQAAOoUAADrFAAABiIFAAAmBQAAKQUAAP8TAAALFQAAKBUAAAACKAUAAFMIAAAByA4AAALXEgAA2BIAAAACHg8AAOQUAAAAAAAAAdMOAAA=\",1]Ho[\"AAAAAAACog4AAKMOAAACoA4AAKEOAAADYw8AADsSAAA8EgAAAAbYEQAANhIAADcSAAA1FAAAChUAACsVAAAAARUQAAACTRIAAK0VAAACMw0AADQNAAABFBAAAAElFQAAAeACAAA=\",\"\"]Bk[\"AAAAAAAAAAAAAAAAAAAAAAAAAh8BAACoCQAA\",\"\"]Bk[\"AAAAAAAAAAAAAAAAAAAAAAAAAiABAAC5CQAA\",\"\"]Ic[\"AAAAAT4OAAAAAfISAAACwQQAAMIEAAAAATsPAAAAAAAAAAAAAAACggUAAHIGAAA=\",\"AAAAAgQGAAA+DgAAAAHyEgAAAAAAAAAAAAAAAAAAOzAAAAEAAAwABABtAQEAcAEHAFYDAAB0BgEA\"]Ho[\"AAAAAUsOAAAAAfsSAAAC1gQAANcEAAABPg8AAAAAAAAAAAAAAAACiAUAAHcGAAA=\",\"AAAAAgwGAABLDgAAAAH7EgAAAAAAAAAAAAAAAAAAOzAAAAEAAAoAAwB4AQcAVwMAAHgGAQA=\"]Bo[\"AAAAAAIsCAAAdQ4AAAABpwQAAA==\",\"AAAAAdcRAAA=\"]Gc[\"\",\"AAAAAAAAOzAAAAEAAFAABgBZAwIAowQBAKYEAQCpBBkAxQQHAM8EJwAABKUEAACoBAAAwwQAAM0EAAADxAQAAM4EAAAYDwAAAAAAAAEZDwAA\"]B@e[\"AAAAAAAAAAAAAAAAAAAAAAHgAgAA\",\"AAA7MAAAAQAARQABAIcTRQA7MAAAAQAARwADACANAABBE0UAGxQAAANFCAAAOg8AACAUAAAG3AcAAA0PAABWEgAADBMAABoUAACkFQAABpoFAAAiCAAA4wsAAB8UAAC6FAAA3xQAAAU+DwAAVRIAAAsTAAAAFAAAnBUAADowAAABAAAAAAAKABAAAADhApsFSQgiDSMNJA07Dz8PQA/aEhgUOjAAAAEAAAAAAAkAEAAAACYISAhnDGgMPQ82EjcSTBIBFAIUBiQIAAAlCAAARwgAAPkJAAAPDwAAvBQAAAchDQAA4g4AAA4PAAAVEAAA1xIAANgSAACCFAAAA2ULAABgDQAAPA8AADowAAABAAAAAAAHABAAAAAkBSMIRggzDTQNHg+sEYEUBV0NAABeDQAAFBAAALsUAACgFQAAAl8NAADgDgAABOACAADhDgAAgxQAAKEVAAABvRQAAAGnFQAAAAGoFQAA\",1]Bi[\"\",\"AAAAAAAAAAELFQAAATkVAAAAARQVAAA=\",1]Ck[\"AAAAAZMPAAAAAAGsBAAAAAAAAAAAAR4PAAA=\",\"AAAAAAAAAAEBBgAA\"]Ac[\"AAAAAREGAAA=\",\"\"]Bg[\"AAAAAAAAAvYEAACfEQAA\",\"AAAAAREGAAA=\"]Gk[\"AAAAAAIRFQAAEhUAAAAB6xEAAA==\",\"AAA7MAAAAQAAEgABAAUUEgAAAAAAAQsVAAAAAAAAAAAAAAAAB0ADAABBBgAAnwsAAKALAAChCwAApQsAAFESAAA=\"]Ao[\"\",\"AAA7MAAAAQAARQABAGESRQA=\"]Hg[\"AAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAJpCwAA6BIAAA==\",\"AAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAACXwwAANMTAAA=\"]Cg[\"AAAAAVEOAAAAAAHgBAAAAAAAAAAAAAEZDwAA\",\"AAAAAVEOAAA=\"]Ag[\"AAAAAAAAAAELFQAA\",\"\"]Bg[\"AAAAAAAAAAAAAAAAAAAAAAAAAZwLAAA=\",\"\"]Hg[\"AAAAAoAFAADiEgAAAAAEqwQAACUFAADjCwAArREAAAFaCwAAAAAAAAFlCwAAAAAAAoMUAAChFQAAAb0UAAA=\",\"AAIABgAAQxIAAAAAAU8SAAAAAAAAAAAAAAABXQ0AAA==\"]Dg[\"AAAAAAAAAcYEAAAAAAAAASENAAABPA8AAAIjCAAARggAAA==\",\"AAIGBgAARxIAAA==\"]Ao[\"\",\"AAAAAAAB/hQAAAABnBUAAA==\"]Fo[\"AAAABE4IAABgCwAAaQ0AALgRAAAD/A4AAF4PAACYFQAAAZMOAAAC8wQAAN4LAAAAAe4UAAAAARQVAAA=\",\"AAFKEgAAAAFpDQAAAAFZEgAA\"]Co[\"AAAAASMVAAABTxIAAAABsAQAAAAAAAAAAAABXQ0AAA==\",\"AAAAAQIGAAA=\"]Bk[\"AAAAAAAAAAAAAAAAAAAAAAAAAv8EAAAtBgAA\",\"\"]Bk[\"AAAAAAAAAAAAAAAAAAAAAAAAAgAFAAAuBgAA\",\"\"]Bk[\"AAAAAAAAAAAAAAAAAAAAAAAAAioAAABwAQAA\",\"\"]Bk[\"AAAAAAAAAAAAAAAAAAAAAAAAAi4AAAB4AQAA\",\"\"]Cc[\"AAAAAAAAAAAAAAAAAAAAAAAAA24BAACeCwAAPAwAAA==\",\"\"]Bk[\"AAAAAAAAAAAAAAAAAAAAAAAAAisAAABxAQAA\",\"\"]Bk[\"AAAAAAAAAAAAAAAAAAAAAAAAAi8AAAB5AQAA\",\"\"]?Bk[\"AAAAAAAAAAAAAAAAAAAAAAAAAigAAAB0BgAA\",\"\"]Bk[\"AAAAAAAAAAAAAAAAAAAAAAAAAiwAAAB4BgAA\",\"\"]Bk[\"AAAAAAAAAAAAAAAAAAAAAAAAAjAAAACQBQAA\",\"\"]Bk[\"AAAAAAAAAAAAAAAAAAAAAAAAAikAAAB1BgAA\",\"\"]Bk[\"AAAAAAAAAAAAAAAAAAAAAAAAAi0AAAB5BgAA\",\"\"]Bk[\"AAAAAAAAAAAAAAAAAAAAAAAAAjEAAACRBQAA\",\"\"]Cg[\"AAAAAV0OAAAAAXoGAAAB7QQAAA==\",\"AAAAAV0OAAABtAsAAA==\"]Gk[\"AAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAHoEgAA\",\"AAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAB0xMAAA==\"]Be[\"AAAAAAA7MAAAAQAAMgABAFkVMgA=\",\"\",1]Dc[\"AAAAAWoNAAAAAZoAAAACWQMAAFoDAAA=\",\"AAAAAWoNAAAAAAABnBUAAAEYFAAA\"]Hg[\"AAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAJpCwAA6BIAAA==\",\"AAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAACXwwAANMTAAA=\"]Bk[\"AAAAAAAAAAAAAAAAAAAAAAAAAgkBAACGBQAA\",\"\"]Bk[\"AAAAAAAAAAAAAAAAAAAAAAAAAgsBAACMBQAA\",\"\"]Co[\"AAAAASQVAAABUAwAAAAC9AQAAOsRAAAAAAAByA4AAA==\",\"AAAAARAGAAA=\"]Bk[\"AAAAAAAAAAAAAAAAAAAAAAAAAggBAACEBQAA\",\"\"]Bk[\"AAAAAAAAAAAAAAAAAAAAAAAAAgoBAACKBQAA\",\"\"]Bk[\"AAAAAAAAAAAAAAAAAAAAAAAAAgwBAACOBQAA\",\"\"]Bk[\"AAAAAAAAAAAAAAAAAAAAAAAAAoUFAACoBQAA\",\"\"]Bk[\"AAAAAAAAAAAAAAAAAAAAAAAAAosFAACpBQAA\",\"\"]Bk[\"AAAAAAAAAAAAAAAAAAAAAAAAAo8FAACqBQAA\",\"\"]Co[\"AAAAAAAAAAABmwUAAAABDw8AAAEODwAA\",\"AAAAAAAAAQYSAAABWgsAAA==\"]Ek[\"AAABkAkAAAE0DgAAAAADsQQAALIEAADpEgAA\",\"AAAAATQOAAAAAcoUAAABmgUAAAAAAAAAAAAAAAAAAT8DAAA=\"]Ek[\"AAABsAkAAAFNDgAAAAAD2gQAANsEAADrEgAA\",\"AAAAAU0OAAAAAc0UAAAAAAGbBQAAAAAAAAAAAAAAAUMDAAA=\"]Ck[\"\",\"AAAAAAAE8gIAAPMCAAD0AgAA9QIAAAToFAAA6RQAAOoUAADrFAAA\"]Bk[\"AAAAAAAAAAAAAAAAAAAAAAAAAkADAAChCwAA\",\"\"]Ag[\"AAAAAAAB7hIAAA==\",\"\"]Cg[\"AAAAAVwOAAAAAUwMAAAB7AQAAA==\",\"AAAAAVwOAAABswsAAA==\"]Gk[\"AAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAFpCwAA\",\"AAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAABXwwAAA==\"]Bg[\"AAAAAAAAAAAAAAAAAAAAAAAAAVoMAAA=\",\"\"]Bg[\"AAAAAAAAAAAAAAAAAAAAAAAAAVsMAAA=\",\"\"]Fg[\"AAAAAAJ/BQAA4RIAAAAAAQEGAAABqAQAAAAAAAAEJAUAAKwRAADfEgAA5RQAAA==\",\"AAAC/wUAAEISAAAAAAAAAAAAAfkJAAA=\"]Jc[\"AAAAATAOAAAAAe8SAAACqQQAAKoEAAA=\",\"AAADhQkAANkSAAA3FQAAAoYJAAAwDgAAAAHvEgAAAAAAAmcMAABoDAAAAAACBxMAAA4VAAABHg8AAAJdDQAAXg0AAAHgDgAAAoMUAAChFQAAAb0UAAAAAAGoFQAA\"]Bg[\"AAAAAAAAAAAAAAAAAAAAAAAAAUEDAAA=\",\"\"]Bg[\"AAAAAAAAAAAAAAAAAAAAAAAAAUIDAAA=\",\"\"]Lo[\"AAABhQkAAAE9DgAAAZoJAAAB8RIAAAK/BAAAwAQAAA==\",\"AAHnFAAAASkVAAADPQ4AAPcTAAD6EwAAAAHxEgAAAroUAADfFAAAAs4TAADREwAAA+ECAAAiDQAAOw8AAAE9DwAAAyQIAABHCAAA+QkAAAEhDQAAATwPAAAEJAUAACMIAABGCAAArBEAAAAAAAABQQMAAA==\"]Hk[\"AAABrQkAAAFKDgAAAfoSAAAAAtQEAADVBAAA\",\"AAABKhUAAANKDgAA+BMAAPsTAAAB+hIAAAAAAz4PAADPEwAA0hMAAAIjDQAAPw8AAAFICAAAASUIAAAAAAAAAAAAAUIDAAA=\"]Dk[\"AAAAAV8OAAAAAALvBAAA8AQAAA==\",\"AAAAAV8OAAAAAAAAA0kIAAAkDQAAQA8AAAEmCAAA\"]Gc[\"AAAAAAAAOzAAAAEAAFAABgBZAwIAowQBAKYEAQCpBBkAxQQHAM8EJwAABKUEAACoBAAAwwQAAM0EAAADxAQAAM4EAAAYDwAAAAAAAAEZDwAA\",\"\"]Ck[\"AAAAATYOAAAAAAK1BAAAtgQAAA==\",\"AAAAATYOAAAAAg0PAADMFAAA\"]Bg[\"AAAAAAAAAAAAAAAAAAAAAAAAASMGAAA=\",\"\"]Bg[\"AAAAAAAAAAAAAAAAAAAAAAAAAT4DAAA=\",\"\"]Mo[\"AAAAAYYJAAAAAAKgDgAAoQ4AAAE/DgAAAsMEAAD0EgAAAcQEAAA=\",\"AAAAAAKaCQAAHBQAAARSEgAAAxMAAPQTAAAaFAAAAh8UAAD/FAAAAz8OAABVEgAACxMAAAP0EgAAohUAAKkVAAAAAo8VAACaFQAAAgUTAAAIEwAAAAPsFAAADxUAADMVAAABNRUAAAFfDQAAAeEOAAAAAT4DAAAAAA==\"]Ko[\"AAAAAUwOAAAB/RIAAAKiDgAAow4AAALYBAAA2QQAAA==\",\"AAACrQkAAB0UAAAGTA4AAFMSAAAEEwAA9RMAABsUAAAAFQAAAv0SAAAgFAAAA1YSAAAMEwAAoxUAAAAAApAVAACbFQAAAgYTAAAJEwAAA+0UAAAQFQAANBUAAALiDgAANhUAAAFgDQAA\"]HGm[\"AAA7MAAAAQAAiwADAGESRQAOEzIABRQSADswAAABAADDADEAfQUAAIAFAQCHBQAAAgYBAAoGAAANBgEAEAYAAE4IAABgCwAAbgsAALwLAADnCwAAIA0AAEsNAABoDQIAMA4OAEAOBQBHDhoAbg4CAFoPAACTDwAAHhABACcRQwCbEQAAuBEAANcRAAANEgAAYBIAANsSAADiEgMA/hMAACEUAgB8FAIAtxQCAL4UAQDCFAEAxhQDAOAUAwAAFQAAAhUDACMVAQAnFQAASBUCAFgVAACMFQIAlhUBAKUVAQCqFQAArxUAADowAAABAAAAAAApABAAAADYAn8FjQUOCCcILAhFCMwJswu0C1AMdQ7sDvwOOg9GD1sPXA9dD14PHRB6EXsRfBFPElsSqBLQEuES+RL6EvwS/RJ/FIAUxBTmFPAUMBUxFZUVmBU7MAAAAQAABgE1AJoAAADVAA4A8gIDACcFAAB+BQAABwYAAHAGAQB2BgAAegYAANwHAAD9BwIADAgAAKoLAADRCwEA1AsAADkMAABFDAAATAwAAEMNAACTDgAAqA4AAMIOAQDSDgAA+w4AAA0PAACmDwAAtQ8AABwQAACWEQAAwBEAAM0RAgDwEQAACBIAADkSAABZEgAAXBIAAF8SAADgEgAA7hIFAPYSAgD7EgAA/hIEAAQUAAA2FEUAhBQyAMAUAQD+FAAABhUDABMVAABNFQEAWRUyAKMVAQCrFQAAOzAAAAEAAHoAJgBZAwIAowQBAKYEAQCpBBkAxQQHAM8EJwAjBQAAJQUAACoFAACaBQAAAAgAAA0IAAAiCAAA3gsAAOMLAAAMDQAAxA4AAPMOAABFDwAAaA8AAI4RAACfEQAArREAAOIRAADnEQAA6xEAAAYSAACnEgAAzxIAAOkSBAC6FAAA3xQAAOgUAwD/FAAADBUBACwVAQAvFQAASxUBADowAAABAAAAAAAqABAAAAAiBSYFKQUBBu0J7gnvCfAJ8QnyCfMJ9AlaC3ML2Qs/DkYOPg9jD6MPpQ+MEZERBBIHEjsSPBLUEtYSzRPOE88T0BPRE9IT8xP/EwAUxRTvFAsVKBWcFTowAAABAAAAAAAdABAAAADhAqUEqATDBM0ECAYJBuEHSQi4CzoMIg0jDSQNOw8/D0APjRG8EdoS9BL1EhgU7hQyFTkVkBWbFaIVqRU6MAAAAQAAAAAAFQAQAAAAxATOBCgFJghICFMIZwxoDBgPPQ/YEUwS5xIGEwkTARQCFDUUChUrFS4VrBU6MAAAAQAAAAAAEwAQAAAAJAglCEcI+QnIDg8PBRJeEtMS1RK8FO0UEBUUFTQVjxWUFZoVnxWuFTowAAABAAAAAAANABAAAAAhDeIODg+uEdIS1xLYEgUTCBOCFAEVJhU2FZkVOjAAAAEAAAAAAAcAEAAAAGULYA08D6QPTRIHEw4VrRU6MAAAAQAAAAAACwAQAAAAJAUjCEYIHg+sEd8SgRTkFOUU7BQPFTMVBl0NAABeDQAAGQ8AALsUAAA1FQAAoBUAAANfDQAA4A4AACUVAAAE4AIAAOEOAACDFAAAoRUAAAG9FAAAAacVAAAAAagVAAAAAAAAAAAAAAAAAAAAAAAAAAJfDAAA0xMAAA==\",\"AAADhw4AAIgOAACJDgAAOzAAAAEAAEUAAgAeEAEAJxFDAAVQDAAAdQ4AAB0QAABPEgAAqBIAADswAAABAABaABIAcAYBAHYGAAD+BwEA0QsBANQLAAA5DAAARQwAAEMNAACoDgAAwg4BANIOAAAcEAAAlhEAADkSAABZEgAANhRFAMEUAAATFQAAOjAAAAEAAAAAAA0AEAAAACUFDA1oD+IR5xGnEs8SDBUNFSwVLRUvFUsVTBU6MAAAAQAAAAAACgAQAAAAJgVaC6MPpQ8EEgcS1BLWEvMT/xMoFQbYBwAAuAsAADoMAAAYFAAA7hQAADIVAAAGUwgAAAEUAAACFAAANRQAAC4VAACsFQAAOjAAAAEAAAAAAAcAEAAAAMgODw8FEl4S1RKUFZ8VrhUCDg8AABUQAAADpA8AAE0SAACtFQAABCQFAAAzDQAANA0AAN8SAAACXQ0AABQQAAABJRUAAAAAOzAAAAEAABgABwDqBwEABgoCANMLAADVCwAAOwwJAEYMBQA9DQEA\",1]Bg[\"AAAAAAAAAAAAAAAAAAAAAAAAAakSAAA=\",\"\"]ADg[\"AAAAAAAAAqcSAAD/FAAAAz8OAABGDgAAkREAADowAAABAAAAAAAHABAAAADDBM0EOgz0EvUSMhWiFakVBcQEAADOBAAAGA8AAOcSAAAuFQAAAAGZFQAAAAPsFAAADxUAADMVAAABNRUAAA==\",\"AAAAAAKaCQAAHBQAAARSEgAAAxMAAPQTAAAaFAAAAh8UAAD/FAAABD8OAABGDgAAVRIAAAsTAAAGOgwAAPQSAAD1EgAAMhUAAKIVAACpFQAAAucSAAAuFQAAAo8VAACaFQAAAgUTAAAIEwAAAaQPAAAD7BQAAA8VAAAzFQAAATUVAAA=\"]Eg[\"AAAAAWEOAAAAAeMAAAAB9QQAAAAAAAAAAAAAAAAAAxsDAACODwAAURIAAA==\",\"AAAAAWEOAAAAAAHrEQAA\"]Ck[\"AAAAAAAAAaMEAAABYw8AAAAAAAABTRIAAAAAASUVAAA=\",\"AAE+EgAA\"]Ec[\"AAAAATUOAAAAAAOzBAAAtAQAAOoSAAA=\",\"AAABkAkAAAI1DgAAyxQAAAERFQAAAAAAAAAAAQ4PAAA=\"]Ec[\"AAAAAU4OAAAAAAPcBAAA3QQAAOwSAAA=\",\"AAABsAkAAAJODgAAzhQAAAESFQAAAAAAAAABDw8AAA==\"]Bk[\"AAAAAAAAAAAAAAAAAAAAAAAAAnMBAABADAAA\",\"\"]Bk[\"AAAAAAAAAAAAAAAAAAAAAAAAAnsBAABIDAAA\",\"\"]Bg[\"AAAAAAAAAAAAAAAAAAAAAAAAAT4MAAA=\",\"\"]Bg[\"AAAAAAAAAAAAAAAAAAAAAAAAAUYMAAA=\",\"\"]Bg[\"AAAAAAAAAAAAAAAAAAAAAAAAAe0OAAA=\",\"\"]Bg[\"AAAAAAAAAAAAAAAAAAAAAAAAAe4OAAA=\",\"\"]Cc[\"AAAAAAAAAAAAAAAAAAAAAAAAA20BAACdCwAAOwwAAA==\",\"\"]Bk[\"AAAAAAAAAAAAAAAAAAAAAAAAAnQBAABBDAAA\",\"\"]Bk[\"AAAAAAAAAAAAAAAAAAAAAAAAAnwBAABJDAAA\",\"\"]Bc[\"AAAAAAAAAAABvBEAAAAAAa4RAAA=\",\"\"]Bk[\"AAAAAAAAAAAAAAAAAAAAAAAAAnIBAAA/DAAA\",\"\"]Bk[\"AAAAAAAAAAAAAAAAAAAAAAAAAnoBAABHDAAA\",\"\"]Cc[\"AAAAAAAAAAAAAAAAAAAAAAAAA3cBAABWAwAAQgwAAA==\",\"\"]Cc[\"AAAAAAAAAAAAAAAAAAAAAAAAA38BAABXAwAASgwAAA==\",\"\"]Bg[\"AAAAAAAAAAAAAAAAAAAAAAAAAegAAAA=\",\"\"]Bg[\"AAAAAAAAAAAAAAAAAAAAAAAAAXUBAAA=\",\"\"]Bg[\"AAAAAAAAAAAAAAAAAAAAAAAAAX0BAAA=\",\"\"]Dg[\"AAAAATcOAAAAAAK3BAAAuAQAAA==\",\"AAAAATcOAAAAAAHjCwAAAAAAAAABZQsAAA==\"]Bg[\"AAAAAAAAAAAAAAAAAAAAAAAAAaALAAA=\",\"\"]Bg[\"AAAAAAAAAAAAAAAAAAAAAAAAAXYBAAA=\",\"\"]Bg[\"AAAAAAAAAAAAAAAAAAAAAAAAAX4BAAA=\",\"\"]Cc[\"AAAAAAAAAAAAAAAAAAAAAAAAAxYDAACfCwAAiQ8AAA==\",\"\"]Cc[\"AAAAAAAAAAAAAAAAAAAAAAAAAxkDAAClCwAAjA8AAA==\",\"\"]Bk[\"AAAAAAAAAAAAAAAAAAAAAAAAApcAAAAhBgAA\",\"\"]Bk[\"AAAAAAAAAAAAAAAAAAAAAAAAApgAAAAiBgAA\",\"\"]Bk[\"AAAAAAAAAAAAAAAAAAAAAAAAApkAAAAkBgAA\",\"\"]Cc[\"AAAAAAAAAAAAAAAAAAAAAAAAAxUBAABMAwAAQwwAAA==\",\"\"]Cc[\"AAAAAAAAAAAAAAAAAAAAAAAAAxYBAABNAwAASwwAAA==\",\"\"]Cc[\"AAAAAAAAAAAAAAAAAAAAAAAAAxcDAABBBgAAig8AAA==\",\"\"]Cc[\"AAAAAAAAAAAAAAAAAAAAAAAAAxoDAABDBgAAjQ8AAA==\",\"\"]Cc[\"AAAAAAAAAAAAAAAAAAAAAAAAA6QLAABEDAAAjg4AAA==\",\"\"]Ak[\"\",\"AAAAAAAAAAAB2AcAAA==\"]")
\ No newline at end of file
@@ -0,0 +1,2 @@
+createSrcSidebar('[["bumpalo",["",[],["lib.rs"]]],["zenith",["",[["common",[],["calculus.rs"]],["elab",[],["discr.rs","errors.rs","globals.rs","search.rs","session.rs","term.rs"]],["io",[],["errors.rs","json.rs","parser.rs","printer.rs","snapshot.rs"]],["ir",[],["errors.rs","index.rs","machine.rs","schedule.rs","term.rs"]],["kernel",[],["arena.rs","compact.rs","errors.rs","io.rs","term.rs"]]],["arena.rs","common.rs","elab.rs","io.rs","ir.rs","kernel.rs","lib.rs","profile.rs","server.rs"]]],["zenith",["",[["common",[],["calculus.rs"]],["elab",[],["discr.rs","errors.rs","globals.rs","search.rs","session.rs","term.rs"]],["io",[],["errors.rs","json.rs","parser.rs","printer.rs","snapshot.rs"]],["ir",[],["errors.rs","index.rs","machine.rs","term.rs"]],["kernel",[],["arena.rs","compact.rs","errors.rs","io.rs","term.rs"]]],["arena.rs","common.rs","elab.rs","io.rs","ir.rs","kernel.rs","lib.rs","profile.rs","server.rs"]]],["zenith",["",[["elab",[],["discr.rs","errors.rs","globals.rs","search.rs","session.rs","term.rs"]],["io",[],["errors.rs","parser.rs","printer.rs","snapshot.rs"]],["ir",[],["errors.rs","index.rs","machine.rs","term.rs"]],["kernel",[],["arena.rs","compact.rs","errors.rs","io.rs","term.rs"]]],["arena.rs","common.rs","elab.rs","io.rs","ir.rs","kernel.rs","lib.rs","profile.rs"]]]]');
+//{"start":19,"fragment_lengths":[30,445,431,379]}
\ No newline at end of file
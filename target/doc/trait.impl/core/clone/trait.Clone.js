@@ -0,0 +1,9 @@
+(function() {
+    var implementors = Object.fromEntries([["bumpalo",[["impl <a class=\"trait\" href=\"https://doc.rust-lang.org/nightly/core/clone/trait.Clone.html\" title=\"trait core::clone::Clone\">Clone</a> for <a class=\"struct\" href=\"bumpalo/struct.AllocErr.html\" title=\"struct bumpalo::AllocErr\">AllocErr</a>"]]],["zenith",[["impl <a class=\"trait\" href=\"https://doc.rust-lang.org/nightly/core/clone/trait.Clone.html\" title=\"trait core::clone::Clone\">Clone</a> for <a class=\"enum\" href=\"zenith/elab/enum.Hyp.html\" title=\"enum zenith::elab::Hyp\">Hyp</a>"],["impl <a class=\"trait\" href=\"https://doc.rust-lang.org/nightly/core/clone/trait.Clone.html\" title=\"trait core::clone::Clone\">Clone</a> for <a class=\"enum\" href=\"zenith/io/enum.Json.html\" title=\"enum zenith::io::Json\">Json</a>"],["impl <a class=\"trait\" href=\"https://doc.rust-lang.org/nightly/core/clone/trait.Clone.html\" title=\"trait core::clone::Clone\">Clone</a> for <a class=\"enum\" href=\"zenith/io/enum.JsonError.html\" title=\"enum zenith::io::JsonError\">JsonError</a>"],["impl <a class=\"trait\" href=\"https://doc.rust-lang.org/nightly/core/clone/trait.Clone.html\" title=\"trait core::clone::Clone\">Clone</a> for <a class=\"enum\" href=\"zenith/io/enum.LexError.html\" title=\"enum zenith::io::LexError\">LexError</a>"],["impl <a class=\"trait\" href=\"https://doc.rust-lang.org/nightly/core/clone/trait.Clone.html\" title=\"trait core::clone::Clone\">Clone</a> for <a class=\"enum\" href=\"zenith/io/enum.ParseError.html\" title=\"enum zenith::io::ParseError\">ParseError</a>"],["impl <a class=\"trait\" href=\"https://doc.rust-lang.org/nightly/core/clone/trait.Clone.html\" title=\"trait core::clone::Clone\">Clone</a> for <a class=\"enum\" href=\"zenith/io/enum.Prec.html\" title=\"enum zenith::io::Prec\">Prec</a>"],["impl <a class=\"trait\" href=\"https://doc.rust-lang.org/nightly/core/clone/trait.Clone.html\" title=\"trait core::clone::Clone\">Clone</a> for <a class=\"enum\" href=\"zenith/io/enum.SnapshotError.html\" title=\"enum zenith::io::SnapshotError\">SnapshotError</a>"],["impl <a class=\"trait\" href=\"https://doc.rust-lang.org/nightly/core/clone/trait.Clone.html\" title=\"trait core::clone::Clone\">Clone</a> for <a class=\"enum\" href=\"zenith/kernel/compact/enum.EvalError.html\" title=\"enum zenith::kernel::compact::EvalError\">EvalError</a>"],["impl <a class=\"trait\" href=\"https://doc.rust-lang.org/nightly/core/clone/trait.Clone.html\" title=\"trait core::clone::Clone\">Clone</a> for <a class=\"enum\" href=\"zenith/kernel/compact/enum.TermNode.html\" title=\"enum zenith::kernel::compact::TermNode\">TermNode</a>"],["impl <a class=\"trait\" href=\"https://doc.rust-lang.org/nightly/core/clone/trait.Clone.html\" title=\"trait core::clone::Clone\">Clone</a> for <a class=\"enum\" href=\"zenith/kernel/compact/enum.ValNode.html\" title=\"enum zenith::kernel::compact::ValNode\">ValNode</a>"],["impl <a class=\"trait\" href=\"https://doc.rust-lang.org/nightly/core/clone/trait.Clone.html\" title=\"trait core::clone::Clone\">Clone</a> for <a class=\"enum\" href=\"zenith/kernel/enum.Binding.html\" title=\"enum zenith::kernel::Binding\">Binding</a>"],["impl <a class=\"trait\" href=\"https://doc.rust-lang.org/nightly/core/clone/trait.Clone.html\" title=\"trait core::clone::Clone\">Clone</a> for <a class=\"enum\" href=\"zenith/kernel/enum.LexError.html\" title=\"enum zenith::kernel::LexError\">LexError</a>"],["impl <a class=\"trait\" href=\"https://doc.rust-lang.org/nightly/core/clone/trait.Clone.html\" title=\"trait core::clone::Clone\">Clone</a> for <a class=\"enum\" href=\"zenith/kernel/enum.ParseError.html\" title=\"enum zenith::kernel::ParseError\">ParseError</a>"],["impl <a class=\"trait\" href=\"https://doc.rust-lang.org/nightly/core/clone/trait.Clone.html\" title=\"trait core::clone::Clone\">Clone</a> for <a class=\"enum\" href=\"zenith/kernel/enum.Prec.html\" title=\"enum zenith::kernel::Prec\">Prec</a>"],["impl <a class=\"trait\" href=\"https://doc.rust-lang.org/nightly/core/clone/trait.Clone.html\" title=\"trait core::clone::Clone\">Clone</a> for <a class=\"enum\" href=\"zenith/kernel/enum.Token.html\" title=\"enum zenith::kernel::Token\">Token</a>"],["impl <a class=\"trait\" href=\"https://doc.rust-lang.org/nightly/core/clone/trait.Clone.html\" title=\"trait core::clone::Clone\">Clone</a> for <a class=\"enum\" href=\"zenith/profile/enum.Op.html\" title=\"enum zenith::profile::Op\">Op</a>"],["impl <a class=\"trait\" href=\"https://doc.rust-lang.org/nightly/core/clone/trait.Clone.html\" title=\"trait core::clone::Clone\">Clone</a> for <a class=\"struct\" href=\"zenith/elab/struct.Limits.html\" title=\"struct zenith::elab::Limits\">Limits</a>"],["impl <a class=\"trait\" href=\"https://doc.rust-lang.org/nightly/core/clone/trait.Clone.html\" title=\"trait core::clone::Clone\">Clone</a> for <a class=\"struct\" href=\"zenith/elab/struct.Stats.html\" title=\"struct zenith::elab::Stats\">Stats</a>"],["impl <a class=\"trait\" href=\"https://doc.rust-lang.org/nightly/core/clone/trait.Clone.html\" title=\"trait core::clone::Clone\">Clone</a> for <a class=\"struct\" href=\"zenith/ir/struct.Core.html\" title=\"struct zenith::ir::Core\">Core</a>"],["impl <a class=\"trait\" href=\"https://doc.rust-lang.org/nightly/core/clone/trait.Clone.html\" title=\"trait core::clone::Clone\">Clone</a> for <a class=\"struct\" href=\"zenith/ir/struct.Named.html\" title=\"struct zenith::ir::Named\">Named</a>"],["impl <a class=\"trait\" href=\"https://doc.rust-lang.org/nightly/core/clone/trait.Clone.html\" title=\"trait core::clone::Clone\">Clone</a> for <a class=\"struct\" href=\"zenith/kernel/compact/struct.Clos.html\" title=\"struct zenith::kernel::compact::Clos\">Clos</a>"],["impl <a class=\"trait\" href=\"https://doc.rust-lang.org/nightly/core/clone/trait.Clone.html\" title=\"trait core::clone::Clone\">Clone</a> for <a class=\"struct\" href=\"zenith/kernel/compact/struct.List.html\" title=\"struct zenith::kernel::compact::List\">List</a>"],["impl <a class=\"trait\" href=\"https://doc.rust-lang.org/nightly/core/clone/trait.Clone.html\" title=\"trait core::clone::Clone\">Clone</a> for <a class=\"struct\" href=\"zenith/kernel/compact/struct.Mark.html\" title=\"struct zenith::kernel::compact::Mark\">Mark</a>"],["impl <a class=\"trait\" href=\"https://doc.rust-lang.org/nightly/core/clone/trait.Clone.html\" title=\"trait core::clone::Clone\">Clone</a> for <a class=\"struct\" href=\"zenith/kernel/compact/struct.Stack.html\" title=\"struct zenith::kernel::compact::Stack\">Stack</a>"],["impl <a class=\"trait\" href=\"https://doc.rust-lang.org/nightly/core/clone/trait.Clone.html\" title=\"trait core::clone::Clone\">Clone</a> for <a class=\"struct\" href=\"zenith/kernel/compact/struct.Term.html\" title=\"struct zenith::kernel::compact::Term\">Term</a>"],["impl <a class=\"trait\" href=\"https://doc.rust-lang.org/nightly/core/clone/trait.Clone.html\" title=\"trait core::clone::Clone\">Clone</a> for <a class=\"struct\" href=\"zenith/kernel/compact/struct.Val.html\" title=\"struct zenith::kernel::compact::Val\">Val</a>"],["impl <a class=\"trait\" href=\"https://doc.rust-lang.org/nightly/core/clone/trait.Clone.html\" title=\"trait core::clone::Clone\">Clone</a> for <a class=\"struct\" href=\"zenith/kernel/struct.Span.html\" title=\"struct zenith::kernel::Span\">Span</a>"],["impl <a class=\"trait\" href=\"https://doc.rust-lang.org/nightly/core/clone/trait.Clone.html\" title=\"trait core::clone::Clone\">Clone</a> for <a class=\"struct\" href=\"zenith/server/struct.Diagnostic.html\" title=\"struct zenith::server::Diagnostic\">Diagnostic</a>"],["impl&lt;'a&gt; <a class=\"trait\" href=\"https://doc.rust-lang.org/nightly/core/clone/trait.Clone.html\" title=\"trait core::clone::Clone\">Clone</a> for <a class=\"enum\" href=\"zenith/kernel/enum.EvalError.html\" title=\"enum zenith::kernel::EvalError\">EvalError</a>&lt;'a&gt;"],["impl&lt;'a&gt; <a class=\"trait\" href=\"https://doc.rust-lang.org/nightly/core/clone/trait.Clone.html\" title=\"trait core::clone::Clone\">Clone</a> for <a class=\"enum\" href=\"zenith/kernel/enum.Stack.html\" title=\"enum zenith::kernel::Stack\">Stack</a>&lt;'a&gt;"],["impl&lt;'a&gt; <a class=\"trait\" href=\"https://doc.rust-lang.org/nightly/core/clone/trait.Clone.html\" title=\"trait core::clone::Clone\">Clone</a> for <a class=\"enum\" href=\"zenith/kernel/enum.Term.html\" title=\"enum zenith::kernel::Term\">Term</a>&lt;'a&gt;"],["impl&lt;'a&gt; <a class=\"trait\" href=\"https://doc.rust-lang.org/nightly/core/clone/trait.Clone.html\" title=\"trait core::clone::Clone\">Clone</a> for <a class=\"enum\" href=\"zenith/kernel/enum.TypeError.html\" title=\"enum zenith::kernel::TypeError\">TypeError</a>&lt;'a&gt;"],["impl&lt;'a&gt; <a class=\"trait\" href=\"https://doc.rust-lang.org/nightly/core/clone/trait.Clone.html\" title=\"trait core::clone::Clone\">Clone</a> for <a class=\"enum\" href=\"zenith/kernel/enum.Val.html\" title=\"enum zenith::kernel::Val\">Val</a>&lt;'a&gt;"],["impl&lt;'a&gt; <a class=\"trait\" href=\"https://doc.rust-lang.org/nightly/core/clone/trait.Clone.html\" title=\"trait core::clone::Clone\">Clone</a> for <a class=\"struct\" href=\"zenith/ir/struct.Name.html\" title=\"struct zenith::ir::Name\">Name</a>&lt;'a&gt;"],["impl&lt;'a&gt; <a class=\"trait\" href=\"https://doc.rust-lang.org/nightly/core/clone/trait.Clone.html\" title=\"trait core::clone::Clone\">Clone</a> for <a class=\"struct\" href=\"zenith/kernel/struct.Clos.html\" title=\"struct zenith::kernel::Clos\">Clos</a>&lt;'a&gt;"],["impl&lt;'a&gt; <a class=\"trait\" href=\"https://doc.rust-lang.org/nightly/core/clone/trait.Clone.html\" title=\"trait core::clone::Clone\">Clone</a> for <a class=\"struct\" href=\"zenith/kernel/struct.Quoted.html\" title=\"struct zenith::kernel::Quoted\">Quoted</a>&lt;'a&gt;"],["impl&lt;'a, 'b&gt; <a class=\"trait\" href=\"https://doc.rust-lang.org/nightly/core/clone/trait.Clone.html\" title=\"trait core::clone::Clone\">Clone</a> for <a class=\"enum\" href=\"zenith/elab/enum.ElabError.html\" title=\"enum zenith::elab::ElabError\">ElabError</a>&lt;'a, 'b&gt;"],["impl&lt;'a, 'b&gt; <a class=\"trait\" href=\"https://doc.rust-lang.org/nightly/core/clone/trait.Clone.html\" title=\"trait core::clone::Clone\">Clone</a> for <a class=\"enum\" href=\"zenith/ir/enum.EvalError.html\" title=\"enum zenith::ir::EvalError\">EvalError</a>&lt;'a, 'b&gt;"],["impl&lt;'a, 'b&gt; <a class=\"trait\" href=\"https://doc.rust-lang.org/nightly/core/clone/trait.Clone.html\" title=\"trait core::clone::Clone\">Clone</a> for <a class=\"enum\" href=\"zenith/ir/enum.Stack.html\" title=\"enum zenith::ir::Stack\">Stack</a>&lt;'a, 'b&gt;"],["impl&lt;'a, 'b&gt; <a class=\"trait\" href=\"https://doc.rust-lang.org/nightly/core/clone/trait.Clone.html\" title=\"trait core::clone::Clone\">Clone</a> for <a class=\"enum\" href=\"zenith/ir/enum.Val.html\" title=\"enum zenith::ir::Val\">Val</a>&lt;'a, 'b&gt;"],["impl&lt;'a, 'b&gt; <a class=\"trait\" href=\"https://doc.rust-lang.org/nightly/core/clone/trait.Clone.html\" title=\"trait core::clone::Clone\">Clone</a> for <a class=\"struct\" href=\"zenith/ir/struct.Clos.html\" title=\"struct zenith::ir::Clos\">Clos</a>&lt;'a, 'b&gt;"],["impl&lt;'a, 'b&gt; <a class=\"trait\" href=\"https://doc.rust-lang.org/nightly/core/clone/trait.Clone.html\" title=\"trait core::clone::Clone\">Clone</a> for <a class=\"struct\" href=\"zenith/ir/struct.Index.html\" title=\"struct zenith::ir::Index\">Index</a>&lt;'a, 'b&gt;"],["impl&lt;'a, 'b&gt; <a class=\"trait\" href=\"https://doc.rust-lang.org/nightly/core/clone/trait.Clone.html\" title=\"trait core::clone::Clone\">Clone</a> for <a class=\"struct\" href=\"zenith/ir/struct.Quoted.html\" title=\"struct zenith::ir::Quoted\">Quoted</a>&lt;'a, 'b&gt;"],["impl&lt;'a, 'b, T: <a class=\"trait\" href=\"https://doc.rust-lang.org/nightly/core/clone/trait.Clone.html\" title=\"trait core::clone::Clone\">Clone</a> + <a class=\"trait\" href=\"zenith/ir/trait.Decoration.html\" title=\"trait zenith::ir::Decoration\">Decoration</a>&gt; <a class=\"trait\" href=\"https://doc.rust-lang.org/nightly/core/clone/trait.Clone.html\" title=\"trait core::clone::Clone\">Clone</a> for <a class=\"enum\" href=\"zenith/ir/enum.Term.html\" title=\"enum zenith::ir::Term\">Term</a>&lt;'a, 'b, T&gt;<div class=\"where\">where\n    T::<a class=\"associatedtype\" href=\"zenith/ir/trait.Decoration.html#associatedtype.NamedVar\" title=\"type zenith::ir::Decoration::NamedVar\">NamedVar</a>: <a class=\"trait\" href=\"https://doc.rust-lang.org/nightly/core/clone/trait.Clone.html\" title=\"trait core::clone::Clone\">Clone</a>,\n    T::<a class=\"associatedtype\" href=\"zenith/ir/trait.Decoration.html#associatedtype.NamedProj\" title=\"type zenith::ir::Decoration::NamedProj\">NamedProj</a>: <a class=\"trait\" href=\"https://doc.rust-lang.org/nightly/core/clone/trait.Clone.html\" title=\"trait core::clone::Clone\">Clone</a>,</div>"],["impl&lt;'a, 'b, T: <a class=\"trait\" href=\"https://doc.rust-lang.org/nightly/core/clone/trait.Clone.html\" title=\"trait core::clone::Clone\">Clone</a> + <a class=\"trait\" href=\"zenith/ir/trait.Decoration.html\" title=\"trait zenith::ir::Decoration\">Decoration</a>&gt; <a class=\"trait\" href=\"https://doc.rust-lang.org/nightly/core/clone/trait.Clone.html\" title=\"trait core::clone::Clone\">Clone</a> for <a class=\"enum\" href=\"zenith/ir/enum.TypeError.html\" title=\"enum zenith::ir::TypeError\">TypeError</a>&lt;'a, 'b, T&gt;"],["impl&lt;'b&gt; <a class=\"trait\" href=\"https://doc.rust-lang.org/nightly/core/clone/trait.Clone.html\" title=\"trait core::clone::Clone\">Clone</a> for <a class=\"struct\" href=\"zenith/ir/struct.Bound.html\" title=\"struct zenith::ir::Bound\">Bound</a>&lt;'b&gt;"],["impl&lt;'b&gt; <a class=\"trait\" href=\"https://doc.rust-lang.org/nightly/core/clone/trait.Clone.html\" title=\"trait core::clone::Clone\">Clone</a> for <a class=\"struct\" href=\"zenith/ir/struct.Field.html\" title=\"struct zenith::ir::Field\">Field</a>&lt;'b&gt;"],["impl&lt;'s&gt; <a class=\"trait\" href=\"https://doc.rust-lang.org/nightly/core/clone/trait.Clone.html\" title=\"trait core::clone::Clone\">Clone</a> for <a class=\"enum\" href=\"zenith/io/enum.Token.html\" title=\"enum zenith::io::Token\">Token</a>&lt;'s&gt;"],["impl&lt;'s&gt; <a class=\"trait\" href=\"https://doc.rust-lang.org/nightly/core/clone/trait.Clone.html\" title=\"trait core::clone::Clone\">Clone</a> for <a class=\"struct\" href=\"zenith/io/struct.Lexer.html\" title=\"struct zenith::io::Lexer\">Lexer</a>&lt;'s&gt;"],["impl&lt;'s&gt; <a class=\"trait\" href=\"https://doc.rust-lang.org/nightly/core/clone/trait.Clone.html\" title=\"trait core::clone::Clone\">Clone</a> for <a class=\"struct\" href=\"zenith/io/struct.Span.html\" title=\"struct zenith::io::Span\">Span</a>&lt;'s&gt;"]]],["zenith",[["impl <a class=\"trait\" href=\"https://doc.rust-lang.org/nightly/core/clone/trait.Clone.html\" title=\"trait core::clone::Clone\">Clone</a> for <a class=\"enum\" href=\"zenith/elab/enum.Hyp.html\" title=\"enum zenith::elab::Hyp\">Hyp</a>"],["impl <a class=\"trait\" href=\"https://doc.rust-lang.org/nightly/core/clone/trait.Clone.html\" title=\"trait core::clone::Clone\">Clone</a> for <a class=\"enum\" href=\"zenith/io/enum.LexError.html\" title=\"enum zenith::io::LexError\">LexError</a>"],["impl <a class=\"trait\" href=\"https://doc.rust-lang.org/nightly/core/clone/trait.Clone.html\" title=\"trait core::clone::Clone\">Clone</a> for <a class=\"enum\" href=\"zenith/io/enum.ParseError.html\" title=\"enum zenith::io::ParseError\">ParseError</a>"],["impl <a class=\"trait\" href=\"https://doc.rust-lang.org/nightly/core/clone/trait.Clone.html\" title=\"trait core::clone::Clone\">Clone</a> for <a class=\"enum\" href=\"zenith/io/enum.Prec.html\" title=\"enum zenith::io::Prec\">Prec</a>"],["impl <a class=\"trait\" href=\"https://doc.rust-lang.org/nightly/core/clone/trait.Clone.html\" title=\"trait core::clone::Clone\">Clone</a> for <a class=\"enum\" href=\"zenith/io/enum.SnapshotError.html\" title=\"enum zenith::io::SnapshotError\">SnapshotError</a>"],["impl <a class=\"trait\" href=\"https://doc.rust-lang.org/nightly/core/clone/trait.Clone.html\" title=\"trait core::clone::Clone\">Clone</a> for <a class=\"enum\" href=\"zenith/kernel/compact/enum.EvalError.html\" title=\"enum zenith::kernel::compact::EvalError\">EvalError</a>"],["impl <a class=\"trait\" href=\"https://doc.rust-lang.org/nightly/core/clone/trait.Clone.html\" title=\"trait core::clone::Clone\">Clone</a> for <a class=\"enum\" href=\"zenith/kernel/compact/enum.TermNode.html\" title=\"enum zenith::kernel::compact::TermNode\">TermNode</a>"],["impl <a class=\"trait\" href=\"https://doc.rust-lang.org/nightly/core/clone/trait.Clone.html\" title=\"trait core::clone::Clone\">Clone</a> for <a class=\"enum\" href=\"zenith/kernel/compact/enum.ValNode.html\" title=\"enum zenith::kernel::compact::ValNode\">ValNode</a>"],["impl <a class=\"trait\" href=\"https://doc.rust-lang.org/nightly/core/clone/trait.Clone.html\" title=\"trait core::clone::Clone\">Clone</a> for <a class=\"enum\" href=\"zenith/kernel/enum.Binding.html\" title=\"enum zenith::kernel::Binding\">Binding</a>"],["impl <a class=\"trait\" href=\"https://doc.rust-lang.org/nightly/core/clone/trait.Clone.html\" title=\"trait core::clone::Clone\">Clone</a> for <a class=\"enum\" href=\"zenith/kernel/enum.LexError.html\" title=\"enum zenith::kernel::LexError\">LexError</a>"],["impl <a class=\"trait\" href=\"https://doc.rust-lang.org/nightly/core/clone/trait.Clone.html\" title=\"trait core::clone::Clone\">Clone</a> for <a class=\"enum\" href=\"zenith/kernel/enum.ParseError.html\" title=\"enum zenith::kernel::ParseError\">ParseError</a>"],["impl <a class=\"trait\" href=\"https://doc.rust-lang.org/nightly/core/clone/trait.Clone.html\" title=\"trait core::clone::Clone\">Clone</a> for <a class=\"enum\" href=\"zenith/kernel/enum.Prec.html\" title=\"enum zenith::kernel::Prec\">Prec</a>"],["impl <a class=\"trait\" href=\"https://doc.rust-lang.org/nightly/core/clone/trait.Clone.html\" title=\"trait core::clone::Clone\">Clone</a> for <a class=\"enum\" href=\"zenith/kernel/enum.Token.html\" title=\"enum zenith::kernel::Token\">Token</a>"],["impl <a class=\"trait\" href=\"https://doc.rust-lang.org/nightly/core/clone/trait.Clone.html\" title=\"trait core::clone::Clone\">Clone</a> for <a class=\"enum\" href=\"zenith/profile/enum.Op.html\" title=\"enum zenith::profile::Op\">Op</a>"],["impl <a class=\"trait\" href=\"https://doc.rust-lang.org/nightly/core/clone/trait.Clone.html\" title=\"trait core::clone::Clone\">Clone</a> for <a class=\"struct\" href=\"zenith/elab/struct.Limits.html\" title=\"struct zenith::elab::Limits\">Limits</a>"],["impl <a class=\"trait\" href=\"https://doc.rust-lang.org/nightly/core/clone/trait.Clone.html\" title=\"trait core::clone::Clone\">Clone</a> for <a class=\"struct\" href=\"zenith/elab/struct.Stats.html\" title=\"struct zenith::elab::Stats\">Stats</a>"],["impl <a class=\"trait\" href=\"https://doc.rust-lang.org/nightly/core/clone/trait.Clone.html\" title=\"trait core::clone::Clone\">Clone</a> for <a class=\"struct\" href=\"zenith/ir/struct.Core.html\" title=\"struct zenith::ir::Core\">Core</a>"],["impl <a class=\"trait\" href=\"https://doc.rust-lang.org/nightly/core/clone/trait.Clone.html\" title=\"trait core::clone::Clone\">Clone</a> for <a class=\"struct\" href=\"zenith/ir/struct.Named.html\" title=\"struct zenith::ir::Named\">Named</a>"],["impl <a class=\"trait\" href=\"https://doc.rust-lang.org/nightly/core/clone/trait.Clone.html\" title=\"trait core::clone::Clone\">Clone</a> for <a class=\"struct\" href=\"zenith/kernel/compact/struct.Clos.html\" title=\"struct zenith::kernel::compact::Clos\">Clos</a>"],["impl <a class=\"trait\" href=\"https://doc.rust-lang.org/nightly/core/clone/trait.Clone.html\" title=\"trait core::clone::Clone\">Clone</a> for <a class=\"struct\" href=\"zenith/kernel/compact/struct.List.html\" title=\"struct zenith::kernel::compact::List\">List</a>"],["impl <a class=\"trait\" href=\"https://doc.rust-lang.org/nightly/core/clone/trait.Clone.html\" title=\"trait core::clone::Clone\">Clone</a> for <a class=\"struct\" href=\"zenith/kernel/compact/struct.Mark.html\" title=\"struct zenith::kernel::compact::Mark\">Mark</a>"],["impl <a class=\"trait\" href=\"https://doc.rust-lang.org/nightly/core/clone/trait.Clone.html\" title=\"trait core::clone::Clone\">Clone</a> for <a class=\"struct\" href=\"zenith/kernel/compact/struct.Stack.html\" title=\"struct zenith::kernel::compact::Stack\">Stack</a>"],["impl <a class=\"trait\" href=\"https://doc.rust-lang.org/nightly/core/clone/trait.Clone.html\" title=\"trait core::clone::Clone\">Clone</a> for <a class=\"struct\" href=\"zenith/kernel/compact/struct.Term.html\" title=\"struct zenith::kernel::compact::Term\">Term</a>"],["impl <a class=\"trait\" href=\"https://doc.rust-lang.org/nightly/core/clone/trait.Clone.html\" title=\"trait core::clone::Clone\">Clone</a> for <a class=\"struct\" href=\"zenith/kernel/compact/struct.Val.html\" title=\"struct zenith::kernel::compact::Val\">Val</a>"],["impl <a class=\"trait\" href=\"https://doc.rust-lang.org/nightly/core/clone/trait.Clone.html\" title=\"trait core::clone::Clone\">Clone</a> for <a class=\"struct\" href=\"zenith/kernel/struct.Span.html\" title=\"struct zenith::kernel::Span\">Span</a>"],["impl&lt;'a&gt; <a class=\"trait\" href=\"https://doc.rust-lang.org/nightly/core/clone/trait.Clone.html\" title=\"trait core::clone::Clone\">Clone</a> for <a class=\"enum\" href=\"zenith/kernel/enum.EvalError.html\" title=\"enum zenith::kernel::EvalError\">EvalError</a>&lt;'a&gt;"],["impl&lt;'a&gt; <a class=\"trait\" href=\"https://doc.rust-lang.org/nightly/core/clone/trait.Clone.html\" title=\"trait core::clone::Clone\">Clone</a> for <a class=\"enum\" href=\"zenith/kernel/enum.Stack.html\" title=\"enum zenith::kernel::Stack\">Stack</a>&lt;'a&gt;"],["impl&lt;'a&gt; <a class=\"trait\" href=\"https://doc.rust-lang.org/nightly/core/clone/trait.Clone.html\" title=\"trait core::clone::Clone\">Clone</a> for <a class=\"enum\" href=\"zenith/kernel/enum.Term.html\" title=\"enum zenith::kernel::Term\">Term</a>&lt;'a&gt;"],["impl&lt;'a&gt; <a class=\"trait\" href=\"https://doc.rust-lang.org/nightly/core/clone/trait.Clone.html\" title=\"trait core::clone::Clone\">Clone</a> for <a class=\"enum\" href=\"zenith/kernel/enum.TypeError.html\" title=\"enum zenith::kernel::TypeError\">TypeError</a>&lt;'a&gt;"],["impl&lt;'a&gt; <a class=\"trait\" href=\"https://doc.rust-lang.org/nightly/core/clone/trait.Clone.html\" title=\"trait core::clone::Clone\">Clone</a> for <a class=\"enum\" href=\"zenith/kernel/enum.Val.html\" title=\"enum zenith::kernel::Val\">Val</a>&lt;'a&gt;"],["impl&lt;'a&gt; <a class=\"trait\" href=\"https://doc.rust-lang.org/nightly/core/clone/trait.Clone.html\" title=\"trait core::clone::Clone\">Clone</a> for <a class=\"struct\" href=\"zenith/ir/struct.Name.html\" title=\"struct zenith::ir::Name\">Name</a>&lt;'a&gt;"],["impl&lt;'a&gt; <a class=\"trait\" href=\"https://doc.rust-lang.org/nightly/core/clone/trait.Clone.html\" title=\"trait core::clone::Clone\">Clone</a> for <a class=\"struct\" href=\"zenith/kernel/struct.Clos.html\" title=\"struct zenith::kernel::Clos\">Clos</a>&lt;'a&gt;"],["impl&lt;'a&gt; <a class=\"trait\" href=\"https://doc.rust-lang.org/nightly/core/clone/trait.Clone.html\" title=\"trait core::clone::Clone\">Clone</a> for <a class=\"struct\" href=\"zenith/kernel/struct.Quoted.html\" title=\"struct zenith::kernel::Quoted\">Quoted</a>&lt;'a&gt;"],["impl&lt;'a, 'b&gt; <a class=\"trait\" href=\"https://doc.rust-lang.org/nightly/core/clone/trait.Clone.html\" title=\"trait core::clone::Clone\">Clone</a> for <a class=\"enum\" href=\"zenith/elab/enum.ElabError.html\" title=\"enum zenith::elab::ElabError\">ElabError</a>&lt;'a, 'b&gt;"],["impl&lt;'a, 'b&gt; <a class=\"trait\" href=\"https://doc.rust-lang.org/nightly/core/clone/trait.Clone.html\" title=\"trait core::clone::Clone\">Clone</a> for <a class=\"enum\" href=\"zenith/ir/enum.EvalError.html\" title=\"enum zenith::ir::EvalError\">EvalError</a>&lt;'a, 'b&gt;"],["impl&lt;'a, 'b&gt; <a class=\"trait\" href=\"https://doc.rust-lang.org/nightly/core/clone/trait.Clone.html\" title=\"trait core::clone::Clone\">Clone</a> for <a class=\"enum\" href=\"zenith/ir/enum.Stack.html\" title=\"enum zenith::ir::Stack\">Stack</a>&lt;'a, 'b&gt;"],["impl&lt;'a, 'b&gt; <a class=\"trait\" href=\"https://doc.rust-lang.org/nightly/core/clone/trait.Clone.html\" title=\"trait core::clone::Clone\">Clone</a> for <a class=\"enum\" href=\"zenith/ir/enum.Val.html\" title=\"enum zenith::ir::Val\">Val</a>&lt;'a, 'b&gt;"],["impl&lt;'a, 'b&gt; <a class=\"trait\" href=\"https://doc.rust-lang.org/nightly/core/clone/trait.Clone.html\" title=\"trait core::clone::Clone\">Clone</a> for <a class=\"struct\" href=\"zenith/ir/struct.Clos.html\" title=\"struct zenith::ir::Clos\">Clos</a>&lt;'a, 'b&gt;"],["impl&lt;'a, 'b&gt; <a class=\"trait\" href=\"https://doc.rust-lang.org/nightly/core/clone/trait.Clone.html\" title=\"trait core::clone::Clone\">Clone</a> for <a class=\"struct\" href=\"zenith/ir/struct.Index.html\" title=\"struct zenith::ir::Index\">Index</a>&lt;'a, 'b&gt;"],["impl&lt;'a, 'b&gt; <a class=\"trait\" href=\"https://doc.rust-lang.org/nightly/core/clone/trait.Clone.html\" title=\"trait core::clone::Clone\">Clone</a> for <a class=\"struct\" href=\"zenith/ir/struct.Quoted.html\" title=\"struct zenith::ir::Quoted\">Quoted</a>&lt;'a, 'b&gt;"],["impl&lt;'a, 'b, T: <a class=\"trait\" href=\"https://doc.rust-lang.org/nightly/core/clone/trait.Clone.html\" title=\"trait core::clone::Clone\">Clone</a> + <a class=\"trait\" href=\"zenith/ir/trait.Decoration.html\" title=\"trait zenith::ir::Decoration\">Decoration</a>&gt; <a class=\"trait\" href=\"https://doc.rust-lang.org/nightly/core/clone/trait.Clone.html\" title=\"trait core::clone::Clone\">Clone</a> for <a class=\"enum\" href=\"zenith/ir/enum.Term.html\" title=\"enum zenith::ir::Term\">Term</a>&lt;'a, 'b, T&gt;<div class=\"where\">where\n    T::<a class=\"associatedtype\" href=\"zenith/ir/trait.Decoration.html#associatedtype.NamedVar\" title=\"type zenith::ir::Decoration::NamedVar\">NamedVar</a>: <a class=\"trait\" href=\"https://doc.rust-lang.org/nightly/core/clone/trait.Clone.html\" title=\"trait core::clone::Clone\">Clone</a>,\n    T::<a class=\"associatedtype\" href=\"zenith/ir/trait.Decoration.html#associatedtype.NamedProj\" title=\"type zenith::ir::Decoration::NamedProj\">NamedProj</a>: <a class=\"trait\" href=\"https://doc.rust-lang.org/nightly/core/clone/trait.Clone.html\" title=\"trait core::clone::Clone\">Clone</a>,</div>"],["impl&lt;'a, 'b, T: <a class=\"trait\" href=\"https://doc.rust-lang.org/nightly/core/clone/trait.Clone.html\" title=\"trait core::clone::Clone\">Clone</a> + <a class=\"trait\" href=\"zenith/ir/trait.Decoration.html\" title=\"trait zenith::ir::Decoration\">Decoration</a>&gt; <a class=\"trait\" href=\"https://doc.rust-lang.org/nightly/core/clone/trait.Clone.html\" title=\"trait core::clone::Clone\">Clone</a> for <a class=\"enum\" href=\"zenith/ir/enum.TypeError.html\" title=\"enum zenith::ir::TypeError\">TypeError</a>&lt;'a, 'b, T&gt;"],["impl&lt;'b&gt; <a class=\"trait\" href=\"https://doc.rust-lang.org/nightly/core/clone/trait.Clone.html\" title=\"trait core::clone::Clone\">Clone</a> for <a class=\"struct\" href=\"zenith/ir/struct.Bound.html\" title=\"struct zenith::ir::Bound\">Bound</a>&lt;'b&gt;"],["impl&lt;'b&gt; <a class=\"trait\" href=\"https://doc.rust-lang.org/nightly/core/clone/trait.Clone.html\" title=\"trait core::clone::Clone\">Clone</a> for <a class=\"struct\" href=\"zenith/ir/struct.Field.html\" title=\"struct zenith::ir::Field\">Field</a>&lt;'b&gt;"],["impl&lt;'s&gt; <a class=\"trait\" href=\"https://doc.rust-lang.org/nightly/core/clone/trait.Clone.html\" title=\"trait core::clone::Clone\">Clone</a> for <a class=\"enum\" href=\"zenith/io/enum.Token.html\" title=\"enum zenith::io::Token\">Token</a>&lt;'s&gt;"],["impl&lt;'s&gt; <a class=\"trait\" href=\"https://doc.rust-lang.org/nightly/core/clone/trait.Clone.html\" title=\"trait core::clone::Clone\">Clone</a> for <a class=\"struct\" href=\"zenith/io/struct.Lexer.html\" title=\"struct zenith::io::Lexer\">Lexer</a>&lt;'s&gt;"],["impl&lt;'s&gt; <a class=\"trait\" href=\"https://doc.rust-lang.org/nightly/core/clone/trait.Clone.html\" title=\"trait core::clone::Clone\">Clone</a> for <a class=\"struct\" href=\"zenith/io/struct.Span.html\" title=\"struct zenith::io::Span\">Span</a>&lt;'s&gt;"]]]]);
+    if (window.register_implementors) {
+        window.register_implementors(implementors);
+    } else {
+        window.pending_implementors = implementors;
+    }
+})()
+//{"start":57,"fragment_lengths":[267,14492,13722]}
\ No newline at end of file
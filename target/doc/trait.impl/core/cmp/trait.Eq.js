@@ -0,0 +1,9 @@
+(function() {
+    var implementors = Object.fromEntries([["bumpalo",[["impl <a class=\"trait\" href=\"https://doc.rust-lang.org/nightly/core/cmp/trait.Eq.html\" title=\"trait core::cmp::Eq\">Eq</a> for <a class=\"struct\" href=\"bumpalo/struct.AllocErr.html\" title=\"struct bumpalo::AllocErr\">AllocErr</a>"]]],["zenith",[["impl <a class=\"trait\" href=\"https://doc.rust-lang.org/nightly/core/cmp/trait.Eq.html\" title=\"trait core::cmp::Eq\">Eq</a> for <a class=\"enum\" href=\"zenith/elab/enum.Hyp.html\" title=\"enum zenith::elab::Hyp\">Hyp</a>"],["impl <a class=\"trait\" href=\"https://doc.rust-lang.org/nightly/core/cmp/trait.Eq.html\" title=\"trait core::cmp::Eq\">Eq</a> for <a class=\"enum\" href=\"zenith/io/enum.Prec.html\" title=\"enum zenith::io::Prec\">Prec</a>"],["impl <a class=\"trait\" href=\"https://doc.rust-lang.org/nightly/core/cmp/trait.Eq.html\" title=\"trait core::cmp::Eq\">Eq</a> for <a class=\"enum\" href=\"zenith/kernel/enum.Prec.html\" title=\"enum zenith::kernel::Prec\">Prec</a>"],["impl <a class=\"trait\" href=\"https://doc.rust-lang.org/nightly/core/cmp/trait.Eq.html\" title=\"trait core::cmp::Eq\">Eq</a> for <a class=\"enum\" href=\"zenith/kernel/enum.Token.html\" title=\"enum zenith::kernel::Token\">Token</a>"],["impl <a class=\"trait\" href=\"https://doc.rust-lang.org/nightly/core/cmp/trait.Eq.html\" title=\"trait core::cmp::Eq\">Eq</a> for <a class=\"enum\" href=\"zenith/profile/enum.Op.html\" title=\"enum zenith::profile::Op\">Op</a>"],["impl <a class=\"trait\" href=\"https://doc.rust-lang.org/nightly/core/cmp/trait.Eq.html\" title=\"trait core::cmp::Eq\">Eq</a> for <a class=\"struct\" href=\"zenith/ir/struct.Name.html\" title=\"struct zenith::ir::Name\">Name</a>&lt;'_&gt;"],["impl <a class=\"trait\" href=\"https://doc.rust-lang.org/nightly/core/cmp/trait.Eq.html\" title=\"trait core::cmp::Eq\">Eq</a> for <a class=\"struct\" href=\"zenith/kernel/compact/struct.Clos.html\" title=\"struct zenith::kernel::compact::Clos\">Clos</a>"],["impl <a class=\"trait\" href=\"https://doc.rust-lang.org/nightly/core/cmp/trait.Eq.html\" title=\"trait core::cmp::Eq\">Eq</a> for <a class=\"struct\" href=\"zenith/kernel/compact/struct.List.html\" title=\"struct zenith::kernel::compact::List\">List</a>"],["impl <a class=\"trait\" href=\"https://doc.rust-lang.org/nightly/core/cmp/trait.Eq.html\" title=\"trait core::cmp::Eq\">Eq</a> for <a class=\"struct\" href=\"zenith/kernel/compact/struct.Mark.html\" title=\"struct zenith::kernel::compact::Mark\">Mark</a>"],["impl <a class=\"trait\" href=\"https://doc.rust-lang.org/nightly/core/cmp/trait.Eq.html\" title=\"trait core::cmp::Eq\">Eq</a> for <a class=\"struct\" href=\"zenith/kernel/compact/struct.Stack.html\" title=\"struct zenith::kernel::compact::Stack\">Stack</a>"],["impl <a class=\"trait\" href=\"https://doc.rust-lang.org/nightly/core/cmp/trait.Eq.html\" title=\"trait core::cmp::Eq\">Eq</a> for <a class=\"struct\" href=\"zenith/kernel/compact/struct.Term.html\" title=\"struct zenith::kernel::compact::Term\">Term</a>"],["impl <a class=\"trait\" href=\"https://doc.rust-lang.org/nightly/core/cmp/trait.Eq.html\" title=\"trait core::cmp::Eq\">Eq</a> for <a class=\"struct\" href=\"zenith/kernel/compact/struct.Val.html\" title=\"struct zenith::kernel::compact::Val\">Val</a>"],["impl <a class=\"trait\" href=\"https://doc.rust-lang.org/nightly/core/cmp/trait.Eq.html\" title=\"trait core::cmp::Eq\">Eq</a> for <a class=\"struct\" href=\"zenith/server/struct.Diagnostic.html\" title=\"struct zenith::server::Diagnostic\">Diagnostic</a>"],["impl&lt;'s&gt; <a class=\"trait\" href=\"https://doc.rust-lang.org/nightly/core/cmp/trait.Eq.html\" title=\"trait core::cmp::Eq\">Eq</a> for <a class=\"enum\" href=\"zenith/io/enum.Token.html\" title=\"enum zenith::io::Token\">Token</a>&lt;'s&gt;"]]],["zenith",[["impl <a class=\"trait\" href=\"https://doc.rust-lang.org/nightly/core/cmp/trait.Eq.html\" title=\"trait core::cmp::Eq\">Eq</a> for <a class=\"enum\" href=\"zenith/elab/enum.Hyp.html\" title=\"enum zenith::elab::Hyp\">Hyp</a>"],["impl <a class=\"trait\" href=\"https://doc.rust-lang.org/nightly/core/cmp/trait.Eq.html\" title=\"trait core::cmp::Eq\">Eq</a> for <a class=\"enum\" href=\"zenith/io/enum.Prec.html\" title=\"enum zenith::io::Prec\">Prec</a>"],["impl <a class=\"trait\" href=\"https://doc.rust-lang.org/nightly/core/cmp/trait.Eq.html\" title=\"trait core::cmp::Eq\">Eq</a> for <a class=\"enum\" href=\"zenith/kernel/enum.Prec.html\" title=\"enum zenith::kernel::Prec\">Prec</a>"],["impl <a class=\"trait\" href=\"https://doc.rust-lang.org/nightly/core/cmp/trait.Eq.html\" title=\"trait core::cmp::Eq\">Eq</a> for <a class=\"enum\" href=\"zenith/kernel/enum.Token.html\" title=\"enum zenith::kernel::Token\">Token</a>"],["impl <a class=\"trait\" href=\"https://doc.rust-lang.org/nightly/core/cmp/trait.Eq.html\" title=\"trait core::cmp::Eq\">Eq</a> for <a class=\"enum\" href=\"zenith/profile/enum.Op.html\" title=\"enum zenith::profile::Op\">Op</a>"],["impl <a class=\"trait\" href=\"https://doc.rust-lang.org/nightly/core/cmp/trait.Eq.html\" title=\"trait core::cmp::Eq\">Eq</a> for <a class=\"struct\" href=\"zenith/ir/struct.Name.html\" title=\"struct zenith::ir::Name\">Name</a>&lt;'_&gt;"],["impl <a class=\"trait\" href=\"https://doc.rust-lang.org/nightly/core/cmp/trait.Eq.html\" title=\"trait core::cmp::Eq\">Eq</a> for <a class=\"struct\" href=\"zenith/kernel/compact/struct.Clos.html\" title=\"struct zenith::kernel::compact::Clos\">Clos</a>"],["impl <a class=\"trait\" href=\"https://doc.rust-lang.org/nightly/core/cmp/trait.Eq.html\" title=\"trait core::cmp::Eq\">Eq</a> for <a class=\"struct\" href=\"zenith/kernel/compact/struct.List.html\" title=\"struct zenith::kernel::compact::List\">List</a>"],["impl <a class=\"trait\" href=\"https://doc.rust-lang.org/nightly/core/cmp/trait.Eq.html\" title=\"trait core::cmp::Eq\">Eq</a> for <a class=\"struct\" href=\"zenith/kernel/compact/struct.Mark.html\" title=\"struct zenith::kernel::compact::Mark\">Mark</a>"],["impl <a class=\"trait\" href=\"https://doc.rust-lang.org/nightly/core/cmp/trait.Eq.html\" title=\"trait core::cmp::Eq\">Eq</a> for <a class=\"struct\" href=\"zenith/kernel/compact/struct.Stack.html\" title=\"struct zenith::kernel::compact::Stack\">Stack</a>"],["impl <a class=\"trait\" href=\"https://doc.rust-lang.org/nightly/core/cmp/trait.Eq.html\" title=\"trait core::cmp::Eq\">Eq</a> for <a class=\"struct\" href=\"zenith/kernel/compact/struct.Term.html\" title=\"struct zenith::kernel::compact::Term\">Term</a>"],["impl <a class=\"trait\" href=\"https://doc.rust-lang.org/nightly/core/cmp/trait.Eq.html\" title=\"trait core::cmp::Eq\">Eq</a> for <a class=\"struct\" href=\"zenith/kernel/compact/struct.Val.html\" title=\"struct zenith::kernel::compact::Val\">Val</a>"],["impl&lt;'s&gt; <a class=\"trait\" href=\"https://doc.rust-lang.org/nightly/core/cmp/trait.Eq.html\" title=\"trait core::cmp::Eq\">Eq</a> for <a class=\"enum\" href=\"zenith/io/enum.Token.html\" title=\"enum zenith::io::Token\">Token</a>&lt;'s&gt;"]]]]);
+    if (window.register_implementors) {
+        window.register_implementors(implementors);
+    } else {
+        window.pending_implementors = implementors;
+    }
+})()
+//{"start":57,"fragment_lengths":[254,3486,3226]}
\ No newline at end of file
@@ -0,0 +1,9 @@
+(function() {
+    var implementors = Object.fromEntries([["zenith",[["impl <a class=\"trait\" href=\"https://doc.rust-lang.org/nightly/core/convert/trait.From.html\" title=\"trait core::convert::From\">From</a>&lt;<a class=\"enum\" href=\"zenith/io/enum.LexError.html\" title=\"enum zenith::io::LexError\">LexError</a>&gt; for <a class=\"enum\" href=\"zenith/io/enum.ParseError.html\" title=\"enum zenith::io::ParseError\">ParseError</a>"],["impl <a class=\"trait\" href=\"https://doc.rust-lang.org/nightly/core/convert/trait.From.html\" title=\"trait core::convert::From\">From</a>&lt;<a class=\"enum\" href=\"zenith/ir/enum.EvalError.html\" title=\"enum zenith::ir::EvalError\">EvalError</a>&lt;'_, '_&gt;&gt; for <a class=\"primitive\" href=\"https://doc.rust-lang.org/nightly/std/primitive.unit.html\">()</a>"],["impl <a class=\"trait\" href=\"https://doc.rust-lang.org/nightly/core/convert/trait.From.html\" title=\"trait core::convert::From\">From</a>&lt;<a class=\"enum\" href=\"zenith/kernel/enum.EvalError.html\" title=\"enum zenith::kernel::EvalError\">EvalError</a>&lt;'_&gt;&gt; for <a class=\"primitive\" href=\"https://doc.rust-lang.org/nightly/std/primitive.unit.html\">()</a>"],["impl <a class=\"trait\" href=\"https://doc.rust-lang.org/nightly/core/convert/trait.From.html\" title=\"trait core::convert::From\">From</a>&lt;<a class=\"enum\" href=\"zenith/kernel/enum.LexError.html\" title=\"enum zenith::kernel::LexError\">LexError</a>&gt; for <a class=\"enum\" href=\"zenith/kernel/enum.ParseError.html\" title=\"enum zenith::kernel::ParseError\">ParseError</a>"],["impl&lt;'a&gt; <a class=\"trait\" href=\"https://doc.rust-lang.org/nightly/core/convert/trait.From.html\" title=\"trait core::convert::From\">From</a>&lt;<a class=\"enum\" href=\"zenith/kernel/enum.EvalError.html\" title=\"enum zenith::kernel::EvalError\">EvalError</a>&lt;'a&gt;&gt; for <a class=\"enum\" href=\"zenith/kernel/enum.TypeError.html\" title=\"enum zenith::kernel::TypeError\">TypeError</a>&lt;'a&gt;"],["impl&lt;'a, 'b&gt; <a class=\"trait\" href=\"https://doc.rust-lang.org/nightly/core/convert/trait.From.html\" title=\"trait core::convert::From\">From</a>&lt;<a class=\"enum\" href=\"zenith/ir/enum.EvalError.html\" title=\"enum zenith::ir::EvalError\">EvalError</a>&lt;'a, 'b&gt;&gt; for <a class=\"enum\" href=\"zenith/elab/enum.ElabError.html\" title=\"enum zenith::elab::ElabError\">ElabError</a>&lt;'a, 'b&gt;"],["impl&lt;'a, 'b&gt; <a class=\"trait\" href=\"https://doc.rust-lang.org/nightly/core/convert/trait.From.html\" title=\"trait core::convert::From\">From</a>&lt;<a class=\"enum\" href=\"zenith/ir/enum.TypeError.html\" title=\"enum zenith::ir::TypeError\">TypeError</a>&lt;'a, 'b, <a class=\"struct\" href=\"zenith/ir/struct.Named.html\" title=\"struct zenith::ir::Named\">Named</a>&gt;&gt; for <a class=\"enum\" href=\"zenith/elab/enum.ElabError.html\" title=\"enum zenith::elab::ElabError\">ElabError</a>&lt;'a, 'b&gt;"],["impl&lt;'a, 'b, T: <a class=\"trait\" href=\"zenith/ir/trait.Decoration.html\" title=\"trait zenith::ir::Decoration\">Decoration</a>&gt; <a class=\"trait\" href=\"https://doc.rust-lang.org/nightly/core/convert/trait.From.html\" title=\"trait core::convert::From\">From</a>&lt;<a class=\"enum\" href=\"zenith/ir/enum.EvalError.html\" title=\"enum zenith::ir::EvalError\">EvalError</a>&lt;'a, 'b&gt;&gt; for <a class=\"enum\" href=\"zenith/ir/enum.TypeError.html\" title=\"enum zenith::ir::TypeError\">TypeError</a>&lt;'a, 'b, T&gt;"]]],["zenith",[["impl <a class=\"trait\" href=\"https://doc.rust-lang.org/nightly/core/convert/trait.From.html\" title=\"trait core::convert::From\">From</a>&lt;<a class=\"enum\" href=\"zenith/io/enum.LexError.html\" title=\"enum zenith::io::LexError\">LexError</a>&gt; for <a class=\"enum\" href=\"zenith/io/enum.ParseError.html\" title=\"enum zenith::io::ParseError\">ParseError</a>"],["impl <a class=\"trait\" href=\"https://doc.rust-lang.org/nightly/core/convert/trait.From.html\" title=\"trait core::convert::From\">From</a>&lt;<a class=\"enum\" href=\"zenith/kernel/enum.LexError.html\" title=\"enum zenith::kernel::LexError\">LexError</a>&gt; for <a class=\"enum\" href=\"zenith/kernel/enum.ParseError.html\" title=\"enum zenith::kernel::ParseError\">ParseError</a>"],["impl&lt;'a&gt; <a class=\"trait\" href=\"https://doc.rust-lang.org/nightly/core/convert/trait.From.html\" title=\"trait core::convert::From\">From</a>&lt;<a class=\"enum\" href=\"zenith/kernel/enum.EvalError.html\" title=\"enum zenith::kernel::EvalError\">EvalError</a>&lt;'a&gt;&gt; for <a class=\"enum\" href=\"zenith/kernel/enum.TypeError.html\" title=\"enum zenith::kernel::TypeError\">TypeError</a>&lt;'a&gt;"],["impl&lt;'a, 'b&gt; <a class=\"trait\" href=\"https://doc.rust-lang.org/nightly/core/convert/trait.From.html\" title=\"trait core::convert::From\">From</a>&lt;<a class=\"enum\" href=\"zenith/ir/enum.EvalError.html\" title=\"enum zenith::ir::EvalError\">EvalError</a>&lt;'a, 'b&gt;&gt; for <a class=\"enum\" href=\"zenith/elab/enum.ElabError.html\" title=\"enum zenith::elab::ElabError\">ElabError</a>&lt;'a, 'b&gt;"],["impl&lt;'a, 'b&gt; <a class=\"trait\" href=\"https://doc.rust-lang.org/nightly/core/convert/trait.From.html\" title=\"trait core::convert::From\">From</a>&lt;<a class=\"enum\" href=\"zenith/ir/enum.TypeError.html\" title=\"enum zenith::ir::TypeError\">TypeError</a>&lt;'a, 'b, <a class=\"struct\" href=\"zenith/ir/struct.Named.html\" title=\"struct zenith::ir::Named\">Named</a>&gt;&gt; for <a class=\"enum\" href=\"zenith/elab/enum.ElabError.html\" title=\"enum zenith::elab::ElabError\">ElabError</a>&lt;'a, 'b&gt;"],["impl&lt;'a, 'b, T: <a class=\"trait\" href=\"zenith/ir/trait.Decoration.html\" title=\"trait zenith::ir::Decoration\">Decoration</a>&gt; <a class=\"trait\" href=\"https://doc.rust-lang.org/nightly/core/convert/trait.From.html\" title=\"trait core::convert::From\">From</a>&lt;<a class=\"enum\" href=\"zenith/ir/enum.EvalError.html\" title=\"enum zenith::ir::EvalError\">EvalError</a>&lt;'a, 'b&gt;&gt; for <a class=\"enum\" href=\"zenith/ir/enum.TypeError.html\" title=\"enum zenith::ir::TypeError\">TypeError</a>&lt;'a, 'b, T&gt;"]]]]);
+    if (window.register_implementors) {
+        window.register_implementors(implementors);
+    } else {
+        window.pending_implementors = implementors;
+    }
+})()
+//{"start":57,"fragment_lengths":[3418,2665]}
\ No newline at end of file
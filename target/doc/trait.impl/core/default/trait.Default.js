@@ -0,0 +1,9 @@
+(function() {
+    var implementors = Object.fromEntries([["bumpalo",[["impl <a class=\"trait\" href=\"https://doc.rust-lang.org/nightly/core/default/trait.Default.html\" title=\"trait core::default::Default\">Default</a> for <a class=\"struct\" href=\"bumpalo/struct.Bump.html\" title=\"struct bumpalo::Bump\">Bump</a>"]]],["zenith",[["impl <a class=\"trait\" href=\"https://doc.rust-lang.org/nightly/core/default/trait.Default.html\" title=\"trait core::default::Default\">Default</a> for <a class=\"struct\" href=\"zenith/arena/struct.Arena.html\" title=\"struct zenith::arena::Arena\">Arena</a>"],["impl <a class=\"trait\" href=\"https://doc.rust-lang.org/nightly/core/default/trait.Default.html\" title=\"trait core::default::Default\">Default</a> for <a class=\"struct\" href=\"zenith/common/struct.Forwarding.html\" title=\"struct zenith::common::Forwarding\">Forwarding</a>"],["impl <a class=\"trait\" href=\"https://doc.rust-lang.org/nightly/core/default/trait.Default.html\" title=\"trait core::default::Default\">Default</a> for <a class=\"struct\" href=\"zenith/common/struct.Usage.html\" title=\"struct zenith::common::Usage\">Usage</a>"],["impl <a class=\"trait\" href=\"https://doc.rust-lang.org/nightly/core/default/trait.Default.html\" title=\"trait core::default::Default\">Default</a> for <a class=\"struct\" href=\"zenith/elab/struct.Limits.html\" title=\"struct zenith::elab::Limits\">Limits</a>"],["impl <a class=\"trait\" href=\"https://doc.rust-lang.org/nightly/core/default/trait.Default.html\" title=\"trait core::default::Default\">Default</a> for <a class=\"struct\" href=\"zenith/elab/struct.Stats.html\" title=\"struct zenith::elab::Stats\">Stats</a>"],["impl <a class=\"trait\" href=\"https://doc.rust-lang.org/nightly/core/default/trait.Default.html\" title=\"trait core::default::Default\">Default</a> for <a class=\"struct\" href=\"zenith/ir/struct.Index.html\" title=\"struct zenith::ir::Index\">Index</a>&lt;'_, '_&gt;"],["impl <a class=\"trait\" href=\"https://doc.rust-lang.org/nightly/core/default/trait.Default.html\" title=\"trait core::default::Default\">Default</a> for <a class=\"struct\" href=\"zenith/kernel/compact/struct.Arena.html\" title=\"struct zenith::kernel::compact::Arena\">Arena</a>"],["impl <a class=\"trait\" href=\"https://doc.rust-lang.org/nightly/core/default/trait.Default.html\" title=\"trait core::default::Default\">Default</a> for <a class=\"struct\" href=\"zenith/kernel/struct.Arena.html\" title=\"struct zenith::kernel::Arena\">Arena</a>"],["impl <a class=\"trait\" href=\"https://doc.rust-lang.org/nightly/core/default/trait.Default.html\" title=\"trait core::default::Default\">Default</a> for <a class=\"struct\" href=\"zenith/profile/struct.Profile.html\" title=\"struct zenith::profile::Profile\">Profile</a>"],["impl&lt;'a, 'b&gt; <a class=\"trait\" href=\"https://doc.rust-lang.org/nightly/core/default/trait.Default.html\" title=\"trait core::default::Default\">Default</a> for <a class=\"struct\" href=\"zenith/ir/struct.Machine.html\" title=\"struct zenith::ir::Machine\">Machine</a>&lt;'a, 'b&gt;"],["impl&lt;'b&gt; <a class=\"trait\" href=\"https://doc.rust-lang.org/nightly/core/default/trait.Default.html\" title=\"trait core::default::Default\">Default</a> for <a class=\"struct\" href=\"zenith/elab/struct.Globals.html\" title=\"struct zenith::elab::Globals\">Globals</a>&lt;'b&gt;"],["impl&lt;T&gt; <a class=\"trait\" href=\"https://doc.rust-lang.org/nightly/core/default/trait.Default.html\" title=\"trait core::default::Default\">Default</a> for <a class=\"struct\" href=\"zenith/elab/struct.DiscrTree.html\" title=\"struct zenith::elab::DiscrTree\">DiscrTree</a>&lt;T&gt;"],["impl&lt;T: <a class=\"trait\" href=\"https://doc.rust-lang.org/nightly/core/marker/trait.Copy.html\" title=\"trait core::marker::Copy\">Copy</a>&gt; <a class=\"trait\" href=\"https://doc.rust-lang.org/nightly/core/default/trait.Default.html\" title=\"trait core::default::Default\">Default</a> for <a class=\"struct\" href=\"zenith/common/struct.Spine.html\" title=\"struct zenith::common::Spine\">Spine</a>&lt;T&gt;"]]],["zenith",[["impl <a class=\"trait\" href=\"https://doc.rust-lang.org/nightly/core/default/trait.Default.html\" title=\"trait core::default::Default\">Default</a> for <a class=\"struct\" href=\"zenith/arena/struct.Arena.html\" title=\"struct zenith::arena::Arena\">Arena</a>"],["impl <a class=\"trait\" href=\"https://doc.rust-lang.org/nightly/core/default/trait.Default.html\" title=\"trait core::default::Default\">Default</a> for <a class=\"struct\" href=\"zenith/common/struct.Forwarding.html\" title=\"struct zenith::common::Forwarding\">Forwarding</a>"],["impl <a class=\"trait\" href=\"https://doc.rust-lang.org/nightly/core/default/trait.Default.html\" title=\"trait core::default::Default\">Default</a> for <a class=\"struct\" href=\"zenith/elab/struct.Limits.html\" title=\"struct zenith::elab::Limits\">Limits</a>"],["impl <a class=\"trait\" href=\"https://doc.rust-lang.org/nightly/core/default/trait.Default.html\" title=\"trait core::default::Default\">Default</a> for <a class=\"struct\" href=\"zenith/elab/struct.Stats.html\" title=\"struct zenith::elab::Stats\">Stats</a>"],["impl <a class=\"trait\" href=\"https://doc.rust-lang.org/nightly/core/default/trait.Default.html\" title=\"trait core::default::Default\">Default</a> for <a class=\"struct\" href=\"zenith/ir/struct.Index.html\" title=\"struct zenith::ir::Index\">Index</a>&lt;'_, '_&gt;"],["impl <a class=\"trait\" href=\"https://doc.rust-lang.org/nightly/core/default/trait.Default.html\" title=\"trait core::default::Default\">Default</a> for <a class=\"struct\" href=\"zenith/kernel/compact/struct.Arena.html\" title=\"struct zenith::kernel::compact::Arena\">Arena</a>"],["impl <a class=\"trait\" href=\"https://doc.rust-lang.org/nightly/core/default/trait.Default.html\" title=\"trait core::default::Default\">Default</a> for <a class=\"struct\" href=\"zenith/kernel/struct.Arena.html\" title=\"struct zenith::kernel::Arena\">Arena</a>"],["impl <a class=\"trait\" href=\"https://doc.rust-lang.org/nightly/core/default/trait.Default.html\" title=\"trait core::default::Default\">Default</a> for <a class=\"struct\" href=\"zenith/profile/struct.Profile.html\" title=\"struct zenith::profile::Profile\">Profile</a>"],["impl&lt;'a, 'b&gt; <a class=\"trait\" href=\"https://doc.rust-lang.org/nightly/core/default/trait.Default.html\" title=\"trait core::default::Default\">Default</a> for <a class=\"struct\" href=\"zenith/ir/struct.Machine.html\" title=\"struct zenith::ir::Machine\">Machine</a>&lt;'a, 'b&gt;"],["impl&lt;'b&gt; <a class=\"trait\" href=\"https://doc.rust-lang.org/nightly/core/default/trait.Default.html\" title=\"trait core::default::Default\">Default</a> for <a class=\"struct\" href=\"zenith/elab/struct.Globals.html\" title=\"struct zenith::elab::Globals\">Globals</a>&lt;'b&gt;"],["impl&lt;T&gt; <a class=\"trait\" href=\"https://doc.rust-lang.org/nightly/core/default/trait.Default.html\" title=\"trait core::default::Default\">Default</a> for <a class=\"struct\" href=\"zenith/elab/struct.DiscrTree.html\" title=\"struct zenith::elab::DiscrTree\">DiscrTree</a>&lt;T&gt;"]]]]);
+    if (window.register_implementors) {
+        window.register_implementors(implementors);
+    } else {
+        window.pending_implementors = implementors;
+    }
+})()
+//{"start":57,"fragment_lengths":[265,3763,3074]}
\ No newline at end of file
@@ -0,0 +1,9 @@
+(function() {
+    var implementors = Object.fromEntries([["bumpalo",[["impl <a class=\"trait\" href=\"https://doc.rust-lang.org/nightly/core/fmt/trait.Display.html\" title=\"trait core::fmt::Display\">Display</a> for <a class=\"struct\" href=\"bumpalo/struct.AllocErr.html\" title=\"struct bumpalo::AllocErr\">AllocErr</a>"]]],["zenith",[["impl <a class=\"trait\" href=\"https://doc.rust-lang.org/nightly/core/fmt/trait.Display.html\" title=\"trait core::fmt::Display\">Display</a> for <a class=\"enum\" href=\"zenith/elab/enum.ElabError.html\" title=\"enum zenith::elab::ElabError\">ElabError</a>&lt;'_, '_&gt;"],["impl <a class=\"trait\" href=\"https://doc.rust-lang.org/nightly/core/fmt/trait.Display.html\" title=\"trait core::fmt::Display\">Display</a> for <a class=\"enum\" href=\"zenith/io/enum.Json.html\" title=\"enum zenith::io::Json\">Json</a>"],["impl <a class=\"trait\" href=\"https://doc.rust-lang.org/nightly/core/fmt/trait.Display.html\" title=\"trait core::fmt::Display\">Display</a> for <a class=\"enum\" href=\"zenith/io/enum.JsonError.html\" title=\"enum zenith::io::JsonError\">JsonError</a>"],["impl <a class=\"trait\" href=\"https://doc.rust-lang.org/nightly/core/fmt/trait.Display.html\" title=\"trait core::fmt::Display\">Display</a> for <a class=\"enum\" href=\"zenith/io/enum.LexError.html\" title=\"enum zenith::io::LexError\">LexError</a>"],["impl <a class=\"trait\" href=\"https://doc.rust-lang.org/nightly/core/fmt/trait.Display.html\" title=\"trait core::fmt::Display\">Display</a> for <a class=\"enum\" href=\"zenith/io/enum.ParseError.html\" title=\"enum zenith::io::ParseError\">ParseError</a>"],["impl <a class=\"trait\" href=\"https://doc.rust-lang.org/nightly/core/fmt/trait.Display.html\" title=\"trait core::fmt::Display\">Display</a> for <a class=\"enum\" href=\"zenith/io/enum.SnapshotError.html\" title=\"enum zenith::io::SnapshotError\">SnapshotError</a>"],["impl <a class=\"trait\" href=\"https://doc.rust-lang.org/nightly/core/fmt/trait.Display.html\" title=\"trait core::fmt::Display\">Display</a> for <a class=\"enum\" href=\"zenith/ir/enum.EvalError.html\" title=\"enum zenith::ir::EvalError\">EvalError</a>&lt;'_, '_&gt;"],["impl <a class=\"trait\" href=\"https://doc.rust-lang.org/nightly/core/fmt/trait.Display.html\" title=\"trait core::fmt::Display\">Display</a> for <a class=\"enum\" href=\"zenith/kernel/compact/enum.EvalError.html\" title=\"enum zenith::kernel::compact::EvalError\">EvalError</a>"],["impl <a class=\"trait\" href=\"https://doc.rust-lang.org/nightly/core/fmt/trait.Display.html\" title=\"trait core::fmt::Display\">Display</a> for <a class=\"enum\" href=\"zenith/kernel/enum.EvalError.html\" title=\"enum zenith::kernel::EvalError\">EvalError</a>&lt;'_&gt;"],["impl <a class=\"trait\" href=\"https://doc.rust-lang.org/nightly/core/fmt/trait.Display.html\" title=\"trait core::fmt::Display\">Display</a> for <a class=\"enum\" href=\"zenith/kernel/enum.LexError.html\" title=\"enum zenith::kernel::LexError\">LexError</a>"],["impl <a class=\"trait\" href=\"https://doc.rust-lang.org/nightly/core/fmt/trait.Display.html\" title=\"trait core::fmt::Display\">Display</a> for <a class=\"enum\" href=\"zenith/kernel/enum.ParseError.html\" title=\"enum zenith::kernel::ParseError\">ParseError</a>"],["impl <a class=\"trait\" href=\"https://doc.rust-lang.org/nightly/core/fmt/trait.Display.html\" title=\"trait core::fmt::Display\">Display</a> for <a class=\"enum\" href=\"zenith/kernel/enum.Term.html\" title=\"enum zenith::kernel::Term\">Term</a>&lt;'_&gt;"],["impl <a class=\"trait\" href=\"https://doc.rust-lang.org/nightly/core/fmt/trait.Display.html\" title=\"trait core::fmt::Display\">Display</a> for <a class=\"enum\" href=\"zenith/kernel/enum.TypeError.html\" title=\"enum zenith::kernel::TypeError\">TypeError</a>&lt;'_&gt;"],["impl <a class=\"trait\" href=\"https://doc.rust-lang.org/nightly/core/fmt/trait.Display.html\" title=\"trait core::fmt::Display\">Display</a> for <a class=\"struct\" href=\"zenith/ir/struct.Name.html\" title=\"struct zenith::ir::Name\">Name</a>&lt;'_&gt;"],["impl <a class=\"trait\" href=\"https://doc.rust-lang.org/nightly/core/fmt/trait.Display.html\" title=\"trait core::fmt::Display\">Display</a> for <a class=\"struct\" href=\"zenith/ir/struct.Quoted.html\" title=\"struct zenith::ir::Quoted\">Quoted</a>&lt;'_, '_&gt;"],["impl <a class=\"trait\" href=\"https://doc.rust-lang.org/nightly/core/fmt/trait.Display.html\" title=\"trait core::fmt::Display\">Display</a> for <a class=\"struct\" href=\"zenith/kernel/struct.Quoted.html\" title=\"struct zenith::kernel::Quoted\">Quoted</a>&lt;'_&gt;"],["impl&lt;T: <a class=\"trait\" href=\"zenith/ir/trait.Decoration.html\" title=\"trait zenith::ir::Decoration\">Decoration</a>&gt; <a class=\"trait\" href=\"https://doc.rust-lang.org/nightly/core/fmt/trait.Display.html\" title=\"trait core::fmt::Display\">Display</a> for <a class=\"enum\" href=\"zenith/ir/enum.Term.html\" title=\"enum zenith::ir::Term\">Term</a>&lt;'_, '_, T&gt;"],["impl&lt;T: <a class=\"trait\" href=\"zenith/ir/trait.Decoration.html\" title=\"trait zenith::ir::Decoration\">Decoration</a>&gt; <a class=\"trait\" href=\"https://doc.rust-lang.org/nightly/core/fmt/trait.Display.html\" title=\"trait core::fmt::Display\">Display</a> for <a class=\"enum\" href=\"zenith/ir/enum.TypeError.html\" title=\"enum zenith::ir::TypeError\">TypeError</a>&lt;'_, '_, T&gt;"]]],["zenith",[["impl <a class=\"trait\" href=\"https://doc.rust-lang.org/nightly/core/fmt/trait.Display.html\" title=\"trait core::fmt::Display\">Display</a> for <a class=\"enum\" href=\"zenith/elab/enum.ElabError.html\" title=\"enum zenith::elab::ElabError\">ElabError</a>&lt;'_, '_&gt;"],["impl <a class=\"trait\" href=\"https://doc.rust-lang.org/nightly/core/fmt/trait.Display.html\" title=\"trait core::fmt::Display\">Display</a> for <a class=\"enum\" href=\"zenith/io/enum.LexError.html\" title=\"enum zenith::io::LexError\">LexError</a>"],["impl <a class=\"trait\" href=\"https://doc.rust-lang.org/nightly/core/fmt/trait.Display.html\" title=\"trait core::fmt::Display\">Display</a> for <a class=\"enum\" href=\"zenith/io/enum.ParseError.html\" title=\"enum zenith::io::ParseError\">ParseError</a>"],["impl <a class=\"trait\" href=\"https://doc.rust-lang.org/nightly/core/fmt/trait.Display.html\" title=\"trait core::fmt::Display\">Display</a> for <a class=\"enum\" href=\"zenith/io/enum.SnapshotError.html\" title=\"enum zenith::io::SnapshotError\">SnapshotError</a>"],["impl <a class=\"trait\" href=\"https://doc.rust-lang.org/nightly/core/fmt/trait.Display.html\" title=\"trait core::fmt::Display\">Display</a> for <a class=\"enum\" href=\"zenith/ir/enum.EvalError.html\" title=\"enum zenith::ir::EvalError\">EvalError</a>&lt;'_, '_&gt;"],["impl <a class=\"trait\" href=\"https://doc.rust-lang.org/nightly/core/fmt/trait.Display.html\" title=\"trait core::fmt::Display\">Display</a> for <a class=\"enum\" href=\"zenith/kernel/compact/enum.EvalError.html\" title=\"enum zenith::kernel::compact::EvalError\">EvalError</a>"],["impl <a class=\"trait\" href=\"https://doc.rust-lang.org/nightly/core/fmt/trait.Display.html\" title=\"trait core::fmt::Display\">Display</a> for <a class=\"enum\" href=\"zenith/kernel/enum.EvalError.html\" title=\"enum zenith::kernel::EvalError\">EvalError</a>&lt;'_&gt;"],["impl <a class=\"trait\" href=\"https://doc.rust-lang.org/nightly/core/fmt/trait.Display.html\" title=\"trait core::fmt::Display\">Display</a> for <a class=\"enum\" href=\"zenith/kernel/enum.LexError.html\" title=\"enum zenith::kernel::LexError\">LexError</a>"],["impl <a class=\"trait\" href=\"https://doc.rust-lang.org/nightly/core/fmt/trait.Display.html\" title=\"trait core::fmt::Display\">Display</a> for <a class=\"enum\" href=\"zenith/kernel/enum.ParseError.html\" title=\"enum zenith::kernel::ParseError\">ParseError</a>"],["impl <a class=\"trait\" href=\"https://doc.rust-lang.org/nightly/core/fmt/trait.Display.html\" title=\"trait core::fmt::Display\">Display</a> for <a class=\"enum\" href=\"zenith/kernel/enum.Term.html\" title=\"enum zenith::kernel::Term\">Term</a>&lt;'_&gt;"],["impl <a class=\"trait\" href=\"https://doc.rust-lang.org/nightly/core/fmt/trait.Display.html\" title=\"trait core::fmt::Display\">Display</a> for <a class=\"enum\" href=\"zenith/kernel/enum.TypeError.html\" title=\"enum zenith::kernel::TypeError\">TypeError</a>&lt;'_&gt;"],["impl <a class=\"trait\" href=\"https://doc.rust-lang.org/nightly/core/fmt/trait.Display.html\" title=\"trait core::fmt::Display\">Display</a> for <a class=\"struct\" href=\"zenith/ir/struct.Name.html\" title=\"struct zenith::ir::Name\">Name</a>&lt;'_&gt;"],["impl <a class=\"trait\" href=\"https://doc.rust-lang.org/nightly/core/fmt/trait.Display.html\" title=\"trait core::fmt::Display\">Display</a> for <a class=\"struct\" href=\"zenith/ir/struct.Quoted.html\" title=\"struct zenith::ir::Quoted\">Quoted</a>&lt;'_, '_&gt;"],["impl <a class=\"trait\" href=\"https://doc.rust-lang.org/nightly/core/fmt/trait.Display.html\" title=\"trait core::fmt::Display\">Display</a> for <a class=\"struct\" href=\"zenith/kernel/struct.Quoted.html\" title=\"struct zenith::kernel::Quoted\">Quoted</a>&lt;'_&gt;"],["impl&lt;T: <a class=\"trait\" href=\"zenith/ir/trait.Decoration.html\" title=\"trait zenith::ir::Decoration\">Decoration</a>&gt; <a class=\"trait\" href=\"https://doc.rust-lang.org/nightly/core/fmt/trait.Display.html\" title=\"trait core::fmt::Display\">Display</a> for <a class=\"enum\" href=\"zenith/ir/enum.Term.html\" title=\"enum zenith::ir::Term\">Term</a>&lt;'_, '_, T&gt;"],["impl&lt;T: <a class=\"trait\" href=\"zenith/ir/trait.Decoration.html\" title=\"trait zenith::ir::Decoration\">Decoration</a>&gt; <a class=\"trait\" href=\"https://doc.rust-lang.org/nightly/core/fmt/trait.Display.html\" title=\"trait core::fmt::Display\">Display</a> for <a class=\"enum\" href=\"zenith/ir/enum.TypeError.html\" title=\"enum zenith::ir::TypeError\">TypeError</a>&lt;'_, '_, T&gt;"]]]]);
+    if (window.register_implementors) {
+        window.register_implementors(implementors);
+    } else {
+        window.pending_implementors = implementors;
+    }
+})()
+//{"start":57,"fragment_lengths":[269,5060,4559]}
\ No newline at end of file
@@ -0,0 +1,9 @@
+(function() {
+    var implementors = Object.fromEntries([["bumpalo",[["impl !<a class=\"trait\" href=\"https://doc.rust-lang.org/nightly/core/marker/trait.Freeze.html\" title=\"trait core::marker::Freeze\">Freeze</a> for <a class=\"struct\" href=\"bumpalo/struct.Bump.html\" title=\"struct bumpalo::Bump\">Bump</a>",1,["bumpalo::Bump"]],["impl <a class=\"trait\" href=\"https://doc.rust-lang.org/nightly/core/marker/trait.Freeze.html\" title=\"trait core::marker::Freeze\">Freeze</a> for <a class=\"struct\" href=\"bumpalo/struct.AllocErr.html\" title=\"struct bumpalo::AllocErr\">AllocErr</a>",1,["bumpalo::AllocErr"]]]],["zenith",[["impl !<a class=\"trait\" href=\"https://doc.rust-lang.org/nightly/core/marker/trait.Freeze.html\" title=\"trait core::marker::Freeze\">Freeze</a> for <a class=\"struct\" href=\"zenith/arena/struct.Arena.html\" title=\"struct zenith::arena::Arena\">Arena</a>",1,["zenith::arena::Arena"]],["impl !<a class=\"trait\" href=\"https://doc.rust-lang.org/nightly/core/marker/trait.Freeze.html\" title=\"trait core::marker::Freeze\">Freeze</a> for <a class=\"struct\" href=\"zenith/common/struct.Forwarding.html\" title=\"struct zenith::common::Forwarding\">Forwarding</a>",1,["zenith::common::Forwarding"]],["impl !<a class=\"trait\" href=\"https://doc.rust-lang.org/nightly/core/marker/trait.Freeze.html\" title=\"trait core::marker::Freeze\">Freeze</a> for <a class=\"struct\" href=\"zenith/common/struct.Usage.html\" title=\"struct zenith::common::Usage\">Usage</a>",1,["zenith::common::Usage"]],["impl !<a class=\"trait\" href=\"https://doc.rust-lang.org/nightly/core/marker/trait.Freeze.html\" title=\"trait core::marker::Freeze\">Freeze</a> for <a class=\"struct\" href=\"zenith/kernel/struct.Arena.html\" title=\"struct zenith::kernel::Arena\">Arena</a>",1,["zenith::kernel::arena::Arena"]],["impl !<a class=\"trait\" href=\"https://doc.rust-lang.org/nightly/core/marker/trait.Freeze.html\" title=\"trait core::marker::Freeze\">Freeze</a> for <a class=\"struct\" href=\"zenith/profile/struct.Profile.html\" title=\"struct zenith::profile::Profile\">Profile</a>",1,["zenith::profile::Profile"]],["impl <a class=\"trait\" href=\"https://doc.rust-lang.org/nightly/core/marker/trait.Freeze.html\" title=\"trait core::marker::Freeze\">Freeze</a> for <a class=\"enum\" href=\"zenith/elab/enum.Hyp.html\" title=\"enum zenith::elab::Hyp\">Hyp</a>",1,["zenith::elab::search::Hyp"]],["impl <a class=\"trait\" href=\"https://doc.rust-lang.org/nightly/core/marker/trait.Freeze.html\" title=\"trait core::marker::Freeze\">Freeze</a> for <a class=\"enum\" href=\"zenith/io/enum.Json.html\" title=\"enum zenith::io::Json\">Json</a>",1,["zenith::io::json::Json"]],["impl <a class=\"trait\" href=\"https://doc.rust-lang.org/nightly/core/marker/trait.Freeze.html\" title=\"trait core::marker::Freeze\">Freeze</a> for <a class=\"enum\" href=\"zenith/io/enum.JsonError.html\" title=\"enum zenith::io::JsonError\">JsonError</a>",1,["zenith::io::errors::JsonError"]],["impl <a class=\"trait\" href=\"https://doc.rust-lang.org/nightly/core/marker/trait.Freeze.html\" title=\"trait core::marker::Freeze\">Freeze</a> for <a class=\"enum\" href=\"zenith/io/enum.LexError.html\" title=\"enum zenith::io::LexError\">LexError</a>",1,["zenith::io::errors::LexError"]],["impl <a class=\"trait\" href=\"https://doc.rust-lang.org/nightly/core/marker/trait.Freeze.html\" title=\"trait core::marker::Freeze\">Freeze</a> for <a class=\"enum\" href=\"zenith/io/enum.ParseError.html\" title=\"enum zenith::io::ParseError\">ParseError</a>",1,["zenith::io::errors::ParseError"]],["impl <a class=\"trait\" href=\"https://doc.rust-lang.org/nightly/core/marker/trait.Freeze.html\" title=\"trait core::marker::Freeze\">Freeze</a> for <a class=\"enum\" href=\"zenith/io/enum.Prec.html\" title=\"enum zenith::io::Prec\">Prec</a>",1,["zenith::io::printer::Prec"]],["impl <a class=\"trait\" href=\"https://doc.rust-lang.org/nightly/core/marker/trait.Freeze.html\" title=\"trait core::marker::Freeze\">Freeze</a> for <a class=\"enum\" href=\"zenith/io/enum.SnapshotError.html\" title=\"enum zenith::io::SnapshotError\">SnapshotError</a>",1,["zenith::io::errors::SnapshotError"]],["impl <a class=\"trait\" href=\"https://doc.rust-lang.org/nightly/core/marker/trait.Freeze.html\" title=\"trait core::marker::Freeze\">Freeze</a> for <a class=\"enum\" href=\"zenith/kernel/compact/enum.EvalError.html\" title=\"enum zenith::kernel::compact::EvalError\">EvalError</a>",1,["zenith::kernel::compact::EvalError"]],["impl <a class=\"trait\" href=\"https://doc.rust-lang.org/nightly/core/marker/trait.Freeze.html\" title=\"trait core::marker::Freeze\">Freeze</a> for <a class=\"enum\" href=\"zenith/kernel/compact/enum.TermNode.html\" title=\"enum zenith::kernel::compact::TermNode\">TermNode</a>",1,["zenith::kernel::compact::TermNode"]],["impl <a class=\"trait\" href=\"https://doc.rust-lang.org/nightly/core/marker/trait.Freeze.html\" title=\"trait core::marker::Freeze\">Freeze</a> for <a class=\"enum\" href=\"zenith/kernel/compact/enum.ValNode.html\" title=\"enum zenith::kernel::compact::ValNode\">ValNode</a>",1,["zenith::kernel::compact::ValNode"]],["impl <a class=\"trait\" href=\"https://doc.rust-lang.org/nightly/core/marker/trait.Freeze.html\" title=\"trait core::marker::Freeze\">Freeze</a> for <a class=\"enum\" href=\"zenith/kernel/enum.Binding.html\" title=\"enum zenith::kernel::Binding\">Binding</a>",1,["zenith::kernel::io::Binding"]],["impl <a class=\"trait\" href=\"https://doc.rust-lang.org/nightly/core/marker/trait.Freeze.html\" title=\"trait core::marker::Freeze\">Freeze</a> for <a class=\"enum\" href=\"zenith/kernel/enum.LexError.html\" title=\"enum zenith::kernel::LexError\">LexError</a>",1,["zenith::kernel::errors::LexError"]],["impl <a class=\"trait\" href=\"https://doc.rust-lang.org/nightly/core/marker/trait.Freeze.html\" title=\"trait core::marker::Freeze\">Freeze</a> for <a class=\"enum\" href=\"zenith/kernel/enum.ParseError.html\" title=\"enum zenith::kernel::ParseError\">ParseError</a>",1,["zenith::kernel::errors::ParseError"]],["impl <a class=\"trait\" href=\"https://doc.rust-lang.org/nightly/core/marker/trait.Freeze.html\" title=\"trait core::marker::Freeze\">Freeze</a> for <a class=\"enum\" href=\"zenith/kernel/enum.Prec.html\" title=\"enum zenith::kernel::Prec\">Prec</a>",1,["zenith::kernel::io::Prec"]],["impl <a class=\"trait\" href=\"https://doc.rust-lang.org/nightly/core/marker/trait.Freeze.html\" title=\"trait core::marker::Freeze\">Freeze</a> for <a class=\"enum\" href=\"zenith/kernel/enum.Token.html\" title=\"enum zenith::kernel::Token\">Token</a>",1,["zenith::kernel::io::Token"]],["impl <a class=\"trait\" href=\"https://doc.rust-lang.org/nightly/core/marker/trait.Freeze.html\" title=\"trait core::marker::Freeze\">Freeze</a> for <a class=\"enum\" href=\"zenith/profile/enum.Op.html\" title=\"enum zenith::profile::Op\">Op</a>",1,["zenith::profile::Op"]],["impl <a class=\"trait\" href=\"https://doc.rust-lang.org/nightly/core/marker/trait.Freeze.html\" title=\"trait core::marker::Freeze\">Freeze</a> for <a class=\"struct\" href=\"zenith/elab/struct.Limits.html\" title=\"struct zenith::elab::Limits\">Limits</a>",1,["zenith::elab::search::Limits"]],["impl <a class=\"trait\" href=\"https://doc.rust-lang.org/nightly/core/marker/trait.Freeze.html\" title=\"trait core::marker::Freeze\">Freeze</a> for <a class=\"struct\" href=\"zenith/elab/struct.Stats.html\" title=\"struct zenith::elab::Stats\">Stats</a>",1,["zenith::elab::search::Stats"]],["impl <a class=\"trait\" href=\"https://doc.rust-lang.org/nightly/core/marker/trait.Freeze.html\" title=\"trait core::marker::Freeze\">Freeze</a> for <a class=\"struct\" href=\"zenith/ir/struct.Core.html\" title=\"struct zenith::ir::Core\">Core</a>",1,["zenith::ir::term::Core"]],["impl <a class=\"trait\" href=\"https://doc.rust-lang.org/nightly/core/marker/trait.Freeze.html\" title=\"trait core::marker::Freeze\">Freeze</a> for <a class=\"struct\" href=\"zenith/ir/struct.Named.html\" title=\"struct zenith::ir::Named\">Named</a>",1,["zenith::ir::term::Named"]],["impl <a class=\"trait\" href=\"https://doc.rust-lang.org/nightly/core/marker/trait.Freeze.html\" title=\"trait core::marker::Freeze\">Freeze</a> for <a class=\"struct\" href=\"zenith/kernel/compact/struct.Arena.html\" title=\"struct zenith::kernel::compact::Arena\">Arena</a>",1,["zenith::kernel::compact::Arena"]],["impl <a class=\"trait\" href=\"https://doc.rust-lang.org/nightly/core/marker/trait.Freeze.html\" title=\"trait core::marker::Freeze\">Freeze</a> for <a class=\"struct\" href=\"zenith/kernel/compact/struct.Clos.html\" title=\"struct zenith::kernel::compact::Clos\">Clos</a>",1,["zenith::kernel::compact::Clos"]],["impl <a class=\"trait\" href=\"https://doc.rust-lang.org/nightly/core/marker/trait.Freeze.html\" title=\"trait core::marker::Freeze\">Freeze</a> for <a class=\"struct\" href=\"zenith/kernel/compact/struct.List.html\" title=\"struct zenith::kernel::compact::List\">List</a>",1,["zenith::kernel::compact::List"]],["impl <a class=\"trait\" href=\"https://doc.rust-lang.org/nightly/core/marker/trait.Freeze.html\" title=\"trait core::marker::Freeze\">Freeze</a> for <a class=\"struct\" href=\"zenith/kernel/compact/struct.Mark.html\" title=\"struct zenith::kernel::compact::Mark\">Mark</a>",1,["zenith::kernel::compact::Mark"]],["impl <a class=\"trait\" href=\"https://doc.rust-lang.org/nightly/core/marker/trait.Freeze.html\" title=\"trait core::marker::Freeze\">Freeze</a> for <a class=\"struct\" href=\"zenith/kernel/compact/struct.Stack.html\" title=\"struct zenith::kernel::compact::Stack\">Stack</a>",1,["zenith::kernel::compact::Stack"]],["impl <a class=\"trait\" href=\"https://doc.rust-lang.org/nightly/core/marker/trait.Freeze.html\" title=\"trait core::marker::Freeze\">Freeze</a> for <a class=\"struct\" href=\"zenith/kernel/compact/struct.Term.html\" title=\"struct zenith::kernel::compact::Term\">Term</a>",1,["zenith::kernel::compact::Term"]],["impl <a class=\"trait\" href=\"https://doc.rust-lang.org/nightly/core/marker/trait.Freeze.html\" title=\"trait core::marker::Freeze\">Freeze</a> for <a class=\"struct\" href=\"zenith/kernel/compact/struct.Val.html\" title=\"struct zenith::kernel::compact::Val\">Val</a>",1,["zenith::kernel::compact::Val"]],["impl <a class=\"trait\" href=\"https://doc.rust-lang.org/nightly/core/marker/trait.Freeze.html\" title=\"trait core::marker::Freeze\">Freeze</a> for <a class=\"struct\" href=\"zenith/kernel/struct.Span.html\" title=\"struct zenith::kernel::Span\">Span</a>",1,["zenith::kernel::io::Span"]],["impl <a class=\"trait\" href=\"https://doc.rust-lang.org/nightly/core/marker/trait.Freeze.html\" title=\"trait core::marker::Freeze\">Freeze</a> for <a class=\"struct\" href=\"zenith/server/struct.Diagnostic.html\" title=\"struct zenith::server::Diagnostic\">Diagnostic</a>",1,["zenith::server::Diagnostic"]],["impl <a class=\"trait\" href=\"https://doc.rust-lang.org/nightly/core/marker/trait.Freeze.html\" title=\"trait core::marker::Freeze\">Freeze</a> for <a class=\"struct\" href=\"zenith/server/struct.Server.html\" title=\"struct zenith::server::Server\">Server</a>",1,["zenith::server::Server"]],["impl&lt;'a&gt; <a class=\"trait\" href=\"https://doc.rust-lang.org/nightly/core/marker/trait.Freeze.html\" title=\"trait core::marker::Freeze\">Freeze</a> for <a class=\"enum\" href=\"zenith/kernel/enum.EvalError.html\" title=\"enum zenith::kernel::EvalError\">EvalError</a>&lt;'a&gt;",1,["zenith::kernel::errors::EvalError"]],["impl&lt;'a&gt; <a class=\"trait\" href=\"https://doc.rust-lang.org/nightly/core/marker/trait.Freeze.html\" title=\"trait core::marker::Freeze\">Freeze</a> for <a class=\"enum\" href=\"zenith/kernel/enum.Stack.html\" title=\"enum zenith::kernel::Stack\">Stack</a>&lt;'a&gt;",1,["zenith::kernel::term::Stack"]],["impl&lt;'a&gt; <a class=\"trait\" href=\"https://doc.rust-lang.org/nightly/core/marker/trait.Freeze.html\" title=\"trait core::marker::Freeze\">Freeze</a> for <a class=\"enum\" href=\"zenith/kernel/enum.Term.html\" title=\"enum zenith::kernel::Term\">Term</a>&lt;'a&gt;",1,["zenith::kernel::term::Term"]],["impl&lt;'a&gt; <a class=\"trait\" href=\"https://doc.rust-lang.org/nightly/core/marker/trait.Freeze.html\" title=\"trait core::marker::Freeze\">Freeze</a> for <a class=\"enum\" href=\"zenith/kernel/enum.TypeError.html\" title=\"enum zenith::kernel::TypeError\">TypeError</a>&lt;'a&gt;",1,["zenith::kernel::errors::TypeError"]],["impl&lt;'a&gt; <a class=\"trait\" href=\"https://doc.rust-lang.org/nightly/core/marker/trait.Freeze.html\" title=\"trait core::marker::Freeze\">Freeze</a> for <a class=\"enum\" href=\"zenith/kernel/enum.Val.html\" title=\"enum zenith::kernel::Val\">Val</a>&lt;'a&gt;",1,["zenith::kernel::term::Val"]],["impl&lt;'a&gt; <a class=\"trait\" href=\"https://doc.rust-lang.org/nightly/core/marker/trait.Freeze.html\" title=\"trait core::marker::Freeze\">Freeze</a> for <a class=\"struct\" href=\"zenith/ir/struct.Name.html\" title=\"struct zenith::ir::Name\">Name</a>&lt;'a&gt;",1,["zenith::ir::term::Name"]],["impl&lt;'a&gt; <a class=\"trait\" href=\"https://doc.rust-lang.org/nightly/core/marker/trait.Freeze.html\" title=\"trait core::marker::Freeze\">Freeze</a> for <a class=\"struct\" href=\"zenith/kernel/struct.Clos.html\" title=\"struct zenith::kernel::Clos\">Clos</a>&lt;'a&gt;",1,["zenith::kernel::term::Clos"]],["impl&lt;'a&gt; <a class=\"trait\" href=\"https://doc.rust-lang.org/nightly/core/marker/trait.Freeze.html\" title=\"trait core::marker::Freeze\">Freeze</a> for <a class=\"struct\" href=\"zenith/kernel/struct.Quoted.html\" title=\"struct zenith::kernel::Quoted\">Quoted</a>&lt;'a&gt;",1,["zenith::kernel::errors::Quoted"]],["impl&lt;'a, 'b&gt; <a class=\"trait\" href=\"https://doc.rust-lang.org/nightly/core/marker/trait.Freeze.html\" title=\"trait core::marker::Freeze\">Freeze</a> for <a class=\"enum\" href=\"zenith/elab/enum.ElabError.html\" title=\"enum zenith::elab::ElabError\">ElabError</a>&lt;'a, 'b&gt;",1,["zenith::elab::errors::ElabError"]],["impl&lt;'a, 'b&gt; <a class=\"trait\" href=\"https://doc.rust-lang.org/nightly/core/marker/trait.Freeze.html\" title=\"trait core::marker::Freeze\">Freeze</a> for <a class=\"enum\" href=\"zenith/ir/enum.EvalError.html\" title=\"enum zenith::ir::EvalError\">EvalError</a>&lt;'a, 'b&gt;",1,["zenith::ir::errors::EvalError"]],["impl&lt;'a, 'b&gt; <a class=\"trait\" href=\"https://doc.rust-lang.org/nightly/core/marker/trait.Freeze.html\" title=\"trait core::marker::Freeze\">Freeze</a> for <a class=\"enum\" href=\"zenith/ir/enum.Stack.html\" title=\"enum zenith::ir::Stack\">Stack</a>&lt;'a, 'b&gt;",1,["zenith::ir::term::Stack"]],["impl&lt;'a, 'b&gt; <a class=\"trait\" href=\"https://doc.rust-lang.org/nightly/core/marker/trait.Freeze.html\" title=\"trait core::marker::Freeze\">Freeze</a> for <a class=\"enum\" href=\"zenith/ir/enum.Val.html\" title=\"enum zenith::ir::Val\">Val</a>&lt;'a, 'b&gt;",1,["zenith::ir::term::Val"]],["impl&lt;'a, 'b&gt; <a class=\"trait\" href=\"https://doc.rust-lang.org/nightly/core/marker/trait.Freeze.html\" title=\"trait core::marker::Freeze\">Freeze</a> for <a class=\"struct\" href=\"zenith/ir/struct.Clos.html\" title=\"struct zenith::ir::Clos\">Clos</a>&lt;'a, 'b&gt;",1,["zenith::ir::term::Clos"]],["impl&lt;'a, 'b&gt; <a class=\"trait\" href=\"https://doc.rust-lang.org/nightly/core/marker/trait.Freeze.html\" title=\"trait core::marker::Freeze\">Freeze</a> for <a class=\"struct\" href=\"zenith/ir/struct.Index.html\" title=\"struct zenith::ir::Index\">Index</a>&lt;'a, 'b&gt;",1,["zenith::ir::index::Index"]],["impl&lt;'a, 'b&gt; <a class=\"trait\" href=\"https://doc.rust-lang.org/nightly/core/marker/trait.Freeze.html\" title=\"trait core::marker::Freeze\">Freeze</a> for <a class=\"struct\" href=\"zenith/ir/struct.Machine.html\" title=\"struct zenith::ir::Machine\">Machine</a>&lt;'a, 'b&gt;",1,["zenith::ir::machine::Machine"]],["impl&lt;'a, 'b&gt; <a class=\"trait\" href=\"https://doc.rust-lang.org/nightly/core/marker/trait.Freeze.html\" title=\"trait core::marker::Freeze\">Freeze</a> for <a class=\"struct\" href=\"zenith/ir/struct.Quoted.html\" title=\"struct zenith::ir::Quoted\">Quoted</a>&lt;'a, 'b&gt;",1,["zenith::ir::errors::Quoted"]],["impl&lt;'a, 'b, T&gt; <a class=\"trait\" href=\"https://doc.rust-lang.org/nightly/core/marker/trait.Freeze.html\" title=\"trait core::marker::Freeze\">Freeze</a> for <a class=\"enum\" href=\"zenith/ir/enum.Term.html\" title=\"enum zenith::ir::Term\">Term</a>&lt;'a, 'b, T&gt;<div class=\"where\">where\n    &lt;T as <a class=\"trait\" href=\"zenith/ir/trait.Decoration.html\" title=\"trait zenith::ir::Decoration\">Decoration</a>&gt;::<a class=\"associatedtype\" href=\"zenith/ir/trait.Decoration.html#associatedtype.NamedVar\" title=\"type zenith::ir::Decoration::NamedVar\">NamedVar</a>: <a class=\"trait\" href=\"https://doc.rust-lang.org/nightly/core/marker/trait.Freeze.html\" title=\"trait core::marker::Freeze\">Freeze</a>,\n    &lt;T as <a class=\"trait\" href=\"zenith/ir/trait.Decoration.html\" title=\"trait zenith::ir::Decoration\">Decoration</a>&gt;::<a class=\"associatedtype\" href=\"zenith/ir/trait.Decoration.html#associatedtype.NamedProj\" title=\"type zenith::ir::Decoration::NamedProj\">NamedProj</a>: <a class=\"trait\" href=\"https://doc.rust-lang.org/nightly/core/marker/trait.Freeze.html\" title=\"trait core::marker::Freeze\">Freeze</a>,</div>",1,["zenith::ir::term::Term"]],["impl&lt;'a, 'b, T&gt; <a class=\"trait\" href=\"https://doc.rust-lang.org/nightly/core/marker/trait.Freeze.html\" title=\"trait core::marker::Freeze\">Freeze</a> for <a class=\"enum\" href=\"zenith/ir/enum.TypeError.html\" title=\"enum zenith::ir::TypeError\">TypeError</a>&lt;'a, 'b, T&gt;",1,["zenith::ir::errors::TypeError"]],["impl&lt;'a, C&gt; <a class=\"trait\" href=\"https://doc.rust-lang.org/nightly/core/marker/trait.Freeze.html\" title=\"trait core::marker::Freeze\">Freeze</a> for <a class=\"enum\" href=\"zenith/common/enum.TermView.html\" title=\"enum zenith::common::TermView\">TermView</a>&lt;'a, C&gt;<div class=\"where\">where\n    &lt;C as <a class=\"trait\" href=\"zenith/common/trait.Calculus.html\" title=\"trait zenith::common::Calculus\">Calculus</a>&lt;'a&gt;&gt;::<a class=\"associatedtype\" href=\"zenith/common/trait.Calculus.html#associatedtype.Bound\" title=\"type zenith::common::Calculus::Bound\">Bound</a>: <a class=\"trait\" href=\"https://doc.rust-lang.org/nightly/core/marker/trait.Freeze.html\" title=\"trait core::marker::Freeze\">Freeze</a>,\n    &lt;C as <a class=\"trait\" href=\"zenith/common/trait.Calculus.html\" title=\"trait zenith::common::Calculus\">Calculus</a>&lt;'a&gt;&gt;::<a class=\"associatedtype\" href=\"zenith/common/trait.Calculus.html#associatedtype.Dot\" title=\"type zenith::common::Calculus::Dot\">Dot</a>: <a class=\"trait\" href=\"https://doc.rust-lang.org/nightly/core/marker/trait.Freeze.html\" title=\"trait core::marker::Freeze\">Freeze</a>,\n    &lt;C as <a class=\"trait\" href=\"zenith/common/trait.Calculus.html\" title=\"trait zenith::common::Calculus\">Calculus</a>&lt;'a&gt;&gt;::<a class=\"associatedtype\" href=\"zenith/common/trait.Calculus.html#associatedtype.TermExt\" title=\"type zenith::common::Calculus::TermExt\">TermExt</a>: <a class=\"trait\" href=\"https://doc.rust-lang.org/nightly/core/marker/trait.Freeze.html\" title=\"trait core::marker::Freeze\">Freeze</a>,</div>",1,["zenith::common::calculus::TermView"]],["impl&lt;'a, C&gt; <a class=\"trait\" href=\"https://doc.rust-lang.org/nightly/core/marker/trait.Freeze.html\" title=\"trait core::marker::Freeze\">Freeze</a> for <a class=\"enum\" href=\"zenith/common/enum.ValView.html\" title=\"enum zenith::common::ValView\">ValView</a>&lt;'a, C&gt;<div class=\"where\">where\n    &lt;C as <a class=\"trait\" href=\"zenith/common/trait.Calculus.html\" title=\"trait zenith::common::Calculus\">Calculus</a>&lt;'a&gt;&gt;::<a class=\"associatedtype\" href=\"zenith/common/trait.Calculus.html#associatedtype.Args\" title=\"type zenith::common::Calculus::Args\">Args</a>: <a class=\"trait\" href=\"https://doc.rust-lang.org/nightly/core/marker/trait.Freeze.html\" title=\"trait core::marker::Freeze\">Freeze</a>,\n    &lt;C as <a class=\"trait\" href=\"zenith/common/trait.Calculus.html\" title=\"trait zenith::common::Calculus\">Calculus</a>&lt;'a&gt;&gt;::<a class=\"associatedtype\" href=\"zenith/common/trait.Calculus.html#associatedtype.ValExt\" title=\"type zenith::common::Calculus::ValExt\">ValExt</a>: <a class=\"trait\" href=\"https://doc.rust-lang.org/nightly/core/marker/trait.Freeze.html\" title=\"trait core::marker::Freeze\">Freeze</a>,</div>",1,["zenith::common::calculus::ValView"]],["impl&lt;'b&gt; <a class=\"trait\" href=\"https://doc.rust-lang.org/nightly/core/marker/trait.Freeze.html\" title=\"trait core::marker::Freeze\">Freeze</a> for <a class=\"struct\" href=\"zenith/elab/struct.Globals.html\" title=\"struct zenith::elab::Globals\">Globals</a>&lt;'b&gt;",1,["zenith::elab::globals::Globals"]],["impl&lt;'b&gt; <a class=\"trait\" href=\"https://doc.rust-lang.org/nightly/core/marker/trait.Freeze.html\" title=\"trait core::marker::Freeze\">Freeze</a> for <a class=\"struct\" href=\"zenith/elab/struct.Session.html\" title=\"struct zenith::elab::Session\">Session</a>&lt;'b&gt;",1,["zenith::elab::session::Session"]],["impl&lt;'b&gt; <a class=\"trait\" href=\"https://doc.rust-lang.org/nightly/core/marker/trait.Freeze.html\" title=\"trait core::marker::Freeze\">Freeze</a> for <a class=\"struct\" href=\"zenith/ir/struct.Bound.html\" title=\"struct zenith::ir::Bound\">Bound</a>&lt;'b&gt;",1,["zenith::ir::term::Bound"]],["impl&lt;'b&gt; <a class=\"trait\" href=\"https://doc.rust-lang.org/nightly/core/marker/trait.Freeze.html\" title=\"trait core::marker::Freeze\">Freeze</a> for <a class=\"struct\" href=\"zenith/ir/struct.Field.html\" title=\"struct zenith::ir::Field\">Field</a>&lt;'b&gt;",1,["zenith::ir::term::Field"]],["impl&lt;'b&gt; <a class=\"trait\" href=\"https://doc.rust-lang.org/nightly/core/marker/trait.Freeze.html\" title=\"trait core::marker::Freeze\">Freeze</a> for <a class=\"struct\" href=\"zenith/ir/struct.Global.html\" title=\"struct zenith::ir::Global\">Global</a>&lt;'b&gt;",1,["zenith::ir::term::Global"]],["impl&lt;'b&gt; <a class=\"trait\" href=\"https://doc.rust-lang.org/nightly/core/marker/trait.Freeze.html\" title=\"trait core::marker::Freeze\">Freeze</a> for <a class=\"struct\" href=\"zenith/server/struct.Document.html\" title=\"struct zenith::server::Document\">Document</a>&lt;'b&gt;",1,["zenith::server::Document"]],["impl&lt;'p&gt; !<a class=\"trait\" href=\"https://doc.rust-lang.org/nightly/core/marker/trait.Freeze.html\" title=\"trait core::marker::Freeze\">Freeze</a> for <a class=\"struct\" href=\"zenith/arena/struct.Region.html\" title=\"struct zenith::arena::Region\">Region</a>&lt;'p&gt;",1,["zenith::arena::Region"]],["impl&lt;'s&gt; <a class=\"trait\" href=\"https://doc.rust-lang.org/nightly/core/marker/trait.Freeze.html\" title=\"trait core::marker::Freeze\">Freeze</a> for <a class=\"enum\" href=\"zenith/io/enum.Token.html\" title=\"enum zenith::io::Token\">Token</a>&lt;'s&gt;",1,["zenith::io::parser::Token"]],["impl&lt;'s&gt; <a class=\"trait\" href=\"https://doc.rust-lang.org/nightly/core/marker/trait.Freeze.html\" title=\"trait core::marker::Freeze\">Freeze</a> for <a class=\"struct\" href=\"zenith/io/struct.Lexer.html\" title=\"struct zenith::io::Lexer\">Lexer</a>&lt;'s&gt;",1,["zenith::io::parser::Lexer"]],["impl&lt;'s&gt; <a class=\"trait\" href=\"https://doc.rust-lang.org/nightly/core/marker/trait.Freeze.html\" title=\"trait core::marker::Freeze\">Freeze</a> for <a class=\"struct\" href=\"zenith/io/struct.Span.html\" title=\"struct zenith::io::Span\">Span</a>&lt;'s&gt;",1,["zenith::io::parser::Span"]],["impl&lt;'t, 'a&gt; <a class=\"trait\" href=\"https://doc.rust-lang.org/nightly/core/marker/trait.Freeze.html\" title=\"trait core::marker::Freeze\">Freeze</a> for <a class=\"struct\" href=\"zenith/elab/struct.Search.html\" title=\"struct zenith::elab::Search\">Search</a>&lt;'t, 'a&gt;",1,["zenith::elab::search::Search"]],["impl&lt;T&gt; <a class=\"trait\" href=\"https://doc.rust-lang.org/nightly/core/marker/trait.Freeze.html\" title=\"trait core::marker::Freeze\">Freeze</a> for <a class=\"struct\" href=\"zenith/common/struct.Spine.html\" title=\"struct zenith::common::Spine\">Spine</a>&lt;T&gt;<div class=\"where\">where\n    T: <a class=\"trait\" href=\"https://doc.rust-lang.org/nightly/core/marker/trait.Freeze.html\" title=\"trait core::marker::Freeze\">Freeze</a>,</div>",1,["zenith::common::Spine"]],["impl&lt;T&gt; <a class=\"trait\" href=\"https://doc.rust-lang.org/nightly/core/marker/trait.Freeze.html\" title=\"trait core::marker::Freeze\">Freeze</a> for <a class=\"struct\" href=\"zenith/elab/struct.DiscrTree.html\" title=\"struct zenith::elab::DiscrTree\">DiscrTree</a>&lt;T&gt;",1,["zenith::elab::discr::DiscrTree"]]]],["zenith",[["impl !<a class=\"trait\" href=\"https://doc.rust-lang.org/nightly/core/marker/trait.Freeze.html\" title=\"trait core::marker::Freeze\">Freeze</a> for <a class=\"struct\" href=\"zenith/arena/struct.Arena.html\" title=\"struct zenith::arena::Arena\">Arena</a>",1,["zenith::arena::Arena"]],["impl !<a class=\"trait\" href=\"https://doc.rust-lang.org/nightly/core/marker/trait.Freeze.html\" title=\"trait core::marker::Freeze\">Freeze</a> for <a class=\"struct\" href=\"zenith/common/struct.Forwarding.html\" title=\"struct zenith::common::Forwarding\">Forwarding</a>",1,["zenith::common::Forwarding"]],["impl !<a class=\"trait\" href=\"https://doc.rust-lang.org/nightly/core/marker/trait.Freeze.html\" title=\"trait core::marker::Freeze\">Freeze</a> for <a class=\"struct\" href=\"zenith/kernel/struct.Arena.html\" title=\"struct zenith::kernel::Arena\">Arena</a>",1,["zenith::kernel::arena::Arena"]],["impl !<a class=\"trait\" href=\"https://doc.rust-lang.org/nightly/core/marker/trait.Freeze.html\" title=\"trait core::marker::Freeze\">Freeze</a> for <a class=\"struct\" href=\"zenith/profile/struct.Profile.html\" title=\"struct zenith::profile::Profile\">Profile</a>",1,["zenith::profile::Profile"]],["impl <a class=\"trait\" href=\"https://doc.rust-lang.org/nightly/core/marker/trait.Freeze.html\" title=\"trait core::marker::Freeze\">Freeze</a> for <a class=\"enum\" href=\"zenith/elab/enum.Hyp.html\" title=\"enum zenith::elab::Hyp\">Hyp</a>",1,["zenith::elab::search::Hyp"]],["impl <a class=\"trait\" href=\"https://doc.rust-lang.org/nightly/core/marker/trait.Freeze.html\" title=\"trait core::marker::Freeze\">Freeze</a> for <a class=\"enum\" href=\"zenith/io/enum.LexError.html\" title=\"enum zenith::io::LexError\">LexError</a>",1,["zenith::io::errors::LexError"]],["impl <a class=\"trait\" href=\"https://doc.rust-lang.org/nightly/core/marker/trait.Freeze.html\" title=\"trait core::marker::Freeze\">Freeze</a> for <a class=\"enum\" href=\"zenith/io/enum.ParseError.html\" title=\"enum zenith::io::ParseError\">ParseError</a>",1,["zenith::io::errors::ParseError"]],["impl <a class=\"trait\" href=\"https://doc.rust-lang.org/nightly/core/marker/trait.Freeze.html\" title=\"trait core::marker::Freeze\">Freeze</a> for <a class=\"enum\" href=\"zenith/io/enum.Prec.html\" title=\"enum zenith::io::Prec\">Prec</a>",1,["zenith::io::printer::Prec"]],["impl <a class=\"trait\" href=\"https://doc.rust-lang.org/nightly/core/marker/trait.Freeze.html\" title=\"trait core::marker::Freeze\">Freeze</a> for <a class=\"enum\" href=\"zenith/io/enum.SnapshotError.html\" title=\"enum zenith::io::SnapshotError\">SnapshotError</a>",1,["zenith::io::errors::SnapshotError"]],["impl <a class=\"trait\" href=\"https://doc.rust-lang.org/nightly/core/marker/trait.Freeze.html\" title=\"trait core::marker::Freeze\">Freeze</a> for <a class=\"enum\" href=\"zenith/kernel/compact/enum.EvalError.html\" title=\"enum zenith::kernel::compact::EvalError\">EvalError</a>",1,["zenith::kernel::compact::EvalError"]],["impl <a class=\"trait\" href=\"https://doc.rust-lang.org/nightly/core/marker/trait.Freeze.html\" title=\"trait core::marker::Freeze\">Freeze</a> for <a class=\"enum\" href=\"zenith/kernel/compact/enum.TermNode.html\" title=\"enum zenith::kernel::compact::TermNode\">TermNode</a>",1,["zenith::kernel::compact::TermNode"]],["impl <a class=\"trait\" href=\"https://doc.rust-lang.org/nightly/core/marker/trait.Freeze.html\" title=\"trait core::marker::Freeze\">Freeze</a> for <a class=\"enum\" href=\"zenith/kernel/compact/enum.ValNode.html\" title=\"enum zenith::kernel::compact::ValNode\">ValNode</a>",1,["zenith::kernel::compact::ValNode"]],["impl <a class=\"trait\" href=\"https://doc.rust-lang.org/nightly/core/marker/trait.Freeze.html\" title=\"trait core::marker::Freeze\">Freeze</a> for <a class=\"enum\" href=\"zenith/kernel/enum.Binding.html\" title=\"enum zenith::kernel::Binding\">Binding</a>",1,["zenith::kernel::io::Binding"]],["impl <a class=\"trait\" href=\"https://doc.rust-lang.org/nightly/core/marker/trait.Freeze.html\" title=\"trait core::marker::Freeze\">Freeze</a> for <a class=\"enum\" href=\"zenith/kernel/enum.LexError.html\" title=\"enum zenith::kernel::LexError\">LexError</a>",1,["zenith::kernel::errors::LexError"]],["impl <a class=\"trait\" href=\"https://doc.rust-lang.org/nightly/core/marker/trait.Freeze.html\" title=\"trait core::marker::Freeze\">Freeze</a> for <a class=\"enum\" href=\"zenith/kernel/enum.ParseError.html\" title=\"enum zenith::kernel::ParseError\">ParseError</a>",1,["zenith::kernel::errors::ParseError"]],["impl <a class=\"trait\" href=\"https://doc.rust-lang.org/nightly/core/marker/trait.Freeze.html\" title=\"trait core::marker::Freeze\">Freeze</a> for <a class=\"enum\" href=\"zenith/kernel/enum.Prec.html\" title=\"enum zenith::kernel::Prec\">Prec</a>",1,["zenith::kernel::io::Prec"]],["impl <a class=\"trait\" href=\"https://doc.rust-lang.org/nightly/core/marker/trait.Freeze.html\" title=\"trait core::marker::Freeze\">Freeze</a> for <a class=\"enum\" href=\"zenith/kernel/enum.Token.html\" title=\"enum zenith::kernel::Token\">Token</a>",1,["zenith::kernel::io::Token"]],["impl <a class=\"trait\" href=\"https://doc.rust-lang.org/nightly/core/marker/trait.Freeze.html\" title=\"trait core::marker::Freeze\">Freeze</a> for <a class=\"enum\" href=\"zenith/profile/enum.Op.html\" title=\"enum zenith::profile::Op\">Op</a>",1,["zenith::profile::Op"]],["impl <a class=\"trait\" href=\"https://doc.rust-lang.org/nightly/core/marker/trait.Freeze.html\" title=\"trait core::marker::Freeze\">Freeze</a> for <a class=\"struct\" href=\"zenith/elab/struct.Limits.html\" title=\"struct zenith::elab::Limits\">Limits</a>",1,["zenith::elab::search::Limits"]],["impl <a class=\"trait\" href=\"https://doc.rust-lang.org/nightly/core/marker/trait.Freeze.html\" title=\"trait core::marker::Freeze\">Freeze</a> for <a class=\"struct\" href=\"zenith/elab/struct.Stats.html\" title=\"struct zenith::elab::Stats\">Stats</a>",1,["zenith::elab::search::Stats"]],["impl <a class=\"trait\" href=\"https://doc.rust-lang.org/nightly/core/marker/trait.Freeze.html\" title=\"trait core::marker::Freeze\">Freeze</a> for <a class=\"struct\" href=\"zenith/ir/struct.Core.html\" title=\"struct zenith::ir::Core\">Core</a>",1,["zenith::ir::term::Core"]],["impl <a class=\"trait\" href=\"https://doc.rust-lang.org/nightly/core/marker/trait.Freeze.html\" title=\"trait core::marker::Freeze\">Freeze</a> for <a class=\"struct\" href=\"zenith/ir/struct.Named.html\" title=\"struct zenith::ir::Named\">Named</a>",1,["zenith::ir::term::Named"]],["impl <a class=\"trait\" href=\"https://doc.rust-lang.org/nightly/core/marker/trait.Freeze.html\" title=\"trait core::marker::Freeze\">Freeze</a> for <a class=\"struct\" href=\"zenith/kernel/compact/struct.Arena.html\" title=\"struct zenith::kernel::compact::Arena\">Arena</a>",1,["zenith::kernel::compact::Arena"]],["impl <a class=\"trait\" href=\"https://doc.rust-lang.org/nightly/core/marker/trait.Freeze.html\" title=\"trait core::marker::Freeze\">Freeze</a> for <a class=\"struct\" href=\"zenith/kernel/compact/struct.Clos.html\" title=\"struct zenith::kernel::compact::Clos\">Clos</a>",1,["zenith::kernel::compact::Clos"]],["impl <a class=\"trait\" href=\"https://doc.rust-lang.org/nightly/core/marker/trait.Freeze.html\" title=\"trait core::marker::Freeze\">Freeze</a> for <a class=\"struct\" href=\"zenith/kernel/compact/struct.List.html\" title=\"struct zenith::kernel::compact::List\">List</a>",1,["zenith::kernel::compact::List"]],["impl <a class=\"trait\" href=\"https://doc.rust-lang.org/nightly/core/marker/trait.Freeze.html\" title=\"trait core::marker::Freeze\">Freeze</a> for <a class=\"struct\" href=\"zenith/kernel/compact/struct.Mark.html\" title=\"struct zenith::kernel::compact::Mark\">Mark</a>",1,["zenith::kernel::compact::Mark"]],["impl <a class=\"trait\" href=\"https://doc.rust-lang.org/nightly/core/marker/trait.Freeze.html\" title=\"trait core::marker::Freeze\">Freeze</a> for <a class=\"struct\" href=\"zenith/kernel/compact/struct.Stack.html\" title=\"struct zenith::kernel::compact::Stack\">Stack</a>",1,["zenith::kernel::compact::Stack"]],["impl <a class=\"trait\" href=\"https://doc.rust-lang.org/nightly/core/marker/trait.Freeze.html\" title=\"trait core::marker::Freeze\">Freeze</a> for <a class=\"struct\" href=\"zenith/kernel/compact/struct.Term.html\" title=\"struct zenith::kernel::compact::Term\">Term</a>",1,["zenith::kernel::compact::Term"]],["impl <a class=\"trait\" href=\"https://doc.rust-lang.org/nightly/core/marker/trait.Freeze.html\" title=\"trait core::marker::Freeze\">Freeze</a> for <a class=\"struct\" href=\"zenith/kernel/compact/struct.Val.html\" title=\"struct zenith::kernel::compact::Val\">Val</a>",1,["zenith::kernel::compact::Val"]],["impl <a class=\"trait\" href=\"https://doc.rust-lang.org/nightly/core/marker/trait.Freeze.html\" title=\"trait core::marker::Freeze\">Freeze</a> for <a class=\"struct\" href=\"zenith/kernel/struct.Span.html\" title=\"struct zenith::kernel::Span\">Span</a>",1,["zenith::kernel::io::Span"]],["impl&lt;'a&gt; <a class=\"trait\" href=\"https://doc.rust-lang.org/nightly/core/marker/trait.Freeze.html\" title=\"trait core::marker::Freeze\">Freeze</a> for <a class=\"enum\" href=\"zenith/kernel/enum.EvalError.html\" title=\"enum zenith::kernel::EvalError\">EvalError</a>&lt;'a&gt;",1,["zenith::kernel::errors::EvalError"]],["impl&lt;'a&gt; <a class=\"trait\" href=\"https://doc.rust-lang.org/nightly/core/marker/trait.Freeze.html\" title=\"trait core::marker::Freeze\">Freeze</a> for <a class=\"enum\" href=\"zenith/kernel/enum.Stack.html\" title=\"enum zenith::kernel::Stack\">Stack</a>&lt;'a&gt;",1,["zenith::kernel::term::Stack"]],["impl&lt;'a&gt; <a class=\"trait\" href=\"https://doc.rust-lang.org/nightly/core/marker/trait.Freeze.html\" title=\"trait core::marker::Freeze\">Freeze</a> for <a class=\"enum\" href=\"zenith/kernel/enum.Term.html\" title=\"enum zenith::kernel::Term\">Term</a>&lt;'a&gt;",1,["zenith::kernel::term::Term"]],["impl&lt;'a&gt; <a class=\"trait\" href=\"https://doc.rust-lang.org/nightly/core/marker/trait.Freeze.html\" title=\"trait core::marker::Freeze\">Freeze</a> for <a class=\"enum\" href=\"zenith/kernel/enum.TypeError.html\" title=\"enum zenith::kernel::TypeError\">TypeError</a>&lt;'a&gt;",1,["zenith::kernel::errors::TypeError"]],["impl&lt;'a&gt; <a class=\"trait\" href=\"https://doc.rust-lang.org/nightly/core/marker/trait.Freeze.html\" title=\"trait core::marker::Freeze\">Freeze</a> for <a class=\"enum\" href=\"zenith/kernel/enum.Val.html\" title=\"enum zenith::kernel::Val\">Val</a>&lt;'a&gt;",1,["zenith::kernel::term::Val"]],["impl&lt;'a&gt; <a class=\"trait\" href=\"https://doc.rust-lang.org/nightly/core/marker/trait.Freeze.html\" title=\"trait core::marker::Freeze\">Freeze</a> for <a class=\"struct\" href=\"zenith/ir/struct.Name.html\" title=\"struct zenith::ir::Name\">Name</a>&lt;'a&gt;",1,["zenith::ir::term::Name"]],["impl&lt;'a&gt; <a class=\"trait\" href=\"https://doc.rust-lang.org/nightly/core/marker/trait.Freeze.html\" title=\"trait core::marker::Freeze\">Freeze</a> for <a class=\"struct\" href=\"zenith/kernel/struct.Clos.html\" title=\"struct zenith::kernel::Clos\">Clos</a>&lt;'a&gt;",1,["zenith::kernel::term::Clos"]],["impl&lt;'a&gt; <a class=\"trait\" href=\"https://doc.rust-lang.org/nightly/core/marker/trait.Freeze.html\" title=\"trait core::marker::Freeze\">Freeze</a> for <a class=\"struct\" href=\"zenith/kernel/struct.Quoted.html\" title=\"struct zenith::kernel::Quoted\">Quoted</a>&lt;'a&gt;",1,["zenith::kernel::errors::Quoted"]],["impl&lt;'a, 'b&gt; <a class=\"trait\" href=\"https://doc.rust-lang.org/nightly/core/marker/trait.Freeze.html\" title=\"trait core::marker::Freeze\">Freeze</a> for <a class=\"enum\" href=\"zenith/elab/enum.ElabError.html\" title=\"enum zenith::elab::ElabError\">ElabError</a>&lt;'a, 'b&gt;",1,["zenith::elab::errors::ElabError"]],["impl&lt;'a, 'b&gt; <a class=\"trait\" href=\"https://doc.rust-lang.org/nightly/core/marker/trait.Freeze.html\" title=\"trait core::marker::Freeze\">Freeze</a> for <a class=\"enum\" href=\"zenith/ir/enum.EvalError.html\" title=\"enum zenith::ir::EvalError\">EvalError</a>&lt;'a, 'b&gt;",1,["zenith::ir::errors::EvalError"]],["impl&lt;'a, 'b&gt; <a class=\"trait\" href=\"https://doc.rust-lang.org/nightly/core/marker/trait.Freeze.html\" title=\"trait core::marker::Freeze\">Freeze</a> for <a class=\"enum\" href=\"zenith/ir/enum.Stack.html\" title=\"enum zenith::ir::Stack\">Stack</a>&lt;'a, 'b&gt;",1,["zenith::ir::term::Stack"]],["impl&lt;'a, 'b&gt; <a class=\"trait\" href=\"https://doc.rust-lang.org/nightly/core/marker/trait.Freeze.html\" title=\"trait core::marker::Freeze\">Freeze</a> for <a class=\"enum\" href=\"zenith/ir/enum.Val.html\" title=\"enum zenith::ir::Val\">Val</a>&lt;'a, 'b&gt;",1,["zenith::ir::term::Val"]],["impl&lt;'a, 'b&gt; <a class=\"trait\" href=\"https://doc.rust-lang.org/nightly/core/marker/trait.Freeze.html\" title=\"trait core::marker::Freeze\">Freeze</a> for <a class=\"struct\" href=\"zenith/ir/struct.Clos.html\" title=\"struct zenith::ir::Clos\">Clos</a>&lt;'a, 'b&gt;",1,["zenith::ir::term::Clos"]],["impl&lt;'a, 'b&gt; <a class=\"trait\" href=\"https://doc.rust-lang.org/nightly/core/marker/trait.Freeze.html\" title=\"trait core::marker::Freeze\">Freeze</a> for <a class=\"struct\" href=\"zenith/ir/struct.Index.html\" title=\"struct zenith::ir::Index\">Index</a>&lt;'a, 'b&gt;",1,["zenith::ir::index::Index"]],["impl&lt;'a, 'b&gt; <a class=\"trait\" href=\"https://doc.rust-lang.org/nightly/core/marker/trait.Freeze.html\" title=\"trait core::marker::Freeze\">Freeze</a> for <a class=\"struct\" href=\"zenith/ir/struct.Machine.html\" title=\"struct zenith::ir::Machine\">Machine</a>&lt;'a, 'b&gt;",1,["zenith::ir::machine::Machine"]],["impl&lt;'a, 'b&gt; <a class=\"trait\" href=\"https://doc.rust-lang.org/nightly/core/marker/trait.Freeze.html\" title=\"trait core::marker::Freeze\">Freeze</a> for <a class=\"struct\" href=\"zenith/ir/struct.Quoted.html\" title=\"struct zenith::ir::Quoted\">Quoted</a>&lt;'a, 'b&gt;",1,["zenith::ir::errors::Quoted"]],["impl&lt;'a, 'b, T&gt; <a class=\"trait\" href=\"https://doc.rust-lang.org/nightly/core/marker/trait.Freeze.html\" title=\"trait core::marker::Freeze\">Freeze</a> for <a class=\"enum\" href=\"zenith/ir/enum.Term.html\" title=\"enum zenith::ir::Term\">Term</a>&lt;'a, 'b, T&gt;<div class=\"where\">where\n    &lt;T as <a class=\"trait\" href=\"zenith/ir/trait.Decoration.html\" title=\"trait zenith::ir::Decoration\">Decoration</a>&gt;::<a class=\"associatedtype\" href=\"zenith/ir/trait.Decoration.html#associatedtype.NamedVar\" title=\"type zenith::ir::Decoration::NamedVar\">NamedVar</a>: <a class=\"trait\" href=\"https://doc.rust-lang.org/nightly/core/marker/trait.Freeze.html\" title=\"trait core::marker::Freeze\">Freeze</a>,\n    &lt;T as <a class=\"trait\" href=\"zenith/ir/trait.Decoration.html\" title=\"trait zenith::ir::Decoration\">Decoration</a>&gt;::<a class=\"associatedtype\" href=\"zenith/ir/trait.Decoration.html#associatedtype.NamedProj\" title=\"type zenith::ir::Decoration::NamedProj\">NamedProj</a>: <a class=\"trait\" href=\"https://doc.rust-lang.org/nightly/core/marker/trait.Freeze.html\" title=\"trait core::marker::Freeze\">Freeze</a>,</div>",1,["zenith::ir::term::Term"]],["impl&lt;'a, 'b, T&gt; <a class=\"trait\" href=\"https://doc.rust-lang.org/nightly/core/marker/trait.Freeze.html\" title=\"trait core::marker::Freeze\">Freeze</a> for <a class=\"enum\" href=\"zenith/ir/enum.TypeError.html\" title=\"enum zenith::ir::TypeError\">TypeError</a>&lt;'a, 'b, T&gt;",1,["zenith::ir::errors::TypeError"]],["impl&lt;'b&gt; <a class=\"trait\" href=\"https://doc.rust-lang.org/nightly/core/marker/trait.Freeze.html\" title=\"trait core::marker::Freeze\">Freeze</a> for <a class=\"struct\" href=\"zenith/elab/struct.Globals.html\" title=\"struct zenith::elab::Globals\">Globals</a>&lt;'b&gt;",1,["zenith::elab::globals::Globals"]],["impl&lt;'b&gt; <a class=\"trait\" href=\"https://doc.rust-lang.org/nightly/core/marker/trait.Freeze.html\" title=\"trait core::marker::Freeze\">Freeze</a> for <a class=\"struct\" href=\"zenith/elab/struct.Session.html\" title=\"struct zenith::elab::Session\">Session</a>&lt;'b&gt;",1,["zenith::elab::session::Session"]],["impl&lt;'b&gt; <a class=\"trait\" href=\"https://doc.rust-lang.org/nightly/core/marker/trait.Freeze.html\" title=\"trait core::marker::Freeze\">Freeze</a> for <a class=\"struct\" href=\"zenith/ir/struct.Bound.html\" title=\"struct zenith::ir::Bound\">Bound</a>&lt;'b&gt;",1,["zenith::ir::term::Bound"]],["impl&lt;'b&gt; <a class=\"trait\" href=\"https://doc.rust-lang.org/nightly/core/marker/trait.Freeze.html\" title=\"trait core::marker::Freeze\">Freeze</a> for <a class=\"struct\" href=\"zenith/ir/struct.Field.html\" title=\"struct zenith::ir::Field\">Field</a>&lt;'b&gt;",1,["zenith::ir::term::Field"]],["impl&lt;'b&gt; <a class=\"trait\" href=\"https://doc.rust-lang.org/nightly/core/marker/trait.Freeze.html\" title=\"trait core::marker::Freeze\">Freeze</a> for <a class=\"struct\" href=\"zenith/ir/struct.Global.html\" title=\"struct zenith::ir::Global\">Global</a>&lt;'b&gt;",1,["zenith::ir::term::Global"]],["impl&lt;'p&gt; !<a class=\"trait\" href=\"https://doc.rust-lang.org/nightly/core/marker/trait.Freeze.html\" title=\"trait core::marker::Freeze\">Freeze</a> for <a class=\"struct\" href=\"zenith/arena/struct.Region.html\" title=\"struct zenith::arena::Region\">Region</a>&lt;'p&gt;",1,["zenith::arena::Region"]],["impl&lt;'s&gt; <a class=\"trait\" href=\"https://doc.rust-lang.org/nightly/core/marker/trait.Freeze.html\" title=\"trait core::marker::Freeze\">Freeze</a> for <a class=\"enum\" href=\"zenith/io/enum.Token.html\" title=\"enum zenith::io::Token\">Token</a>&lt;'s&gt;",1,["zenith::io::parser::Token"]],["impl&lt;'s&gt; <a class=\"trait\" href=\"https://doc.rust-lang.org/nightly/core/marker/trait.Freeze.html\" title=\"trait core::marker::Freeze\">Freeze</a> for <a class=\"struct\" href=\"zenith/io/struct.Lexer.html\" title=\"struct zenith::io::Lexer\">Lexer</a>&lt;'s&gt;",1,["zenith::io::parser::Lexer"]],["impl&lt;'s&gt; <a class=\"trait\" href=\"https://doc.rust-lang.org/nightly/core/marker/trait.Freeze.html\" title=\"trait core::marker::Freeze\">Freeze</a> for <a class=\"struct\" href=\"zenith/io/struct.Span.html\" title=\"struct zenith::io::Span\">Span</a>&lt;'s&gt;",1,["zenith::io::parser::Span"]],["impl&lt;'t, 'a&gt; <a class=\"trait\" href=\"https://doc.rust-lang.org/nightly/core/marker/trait.Freeze.html\" title=\"trait core::marker::Freeze\">Freeze</a> for <a class=\"struct\" href=\"zenith/elab/struct.Search.html\" title=\"struct zenith::elab::Search\">Search</a>&lt;'t, 'a&gt;",1,["zenith::elab::search::Search"]],["impl&lt;T&gt; <a class=\"trait\" href=\"https://doc.rust-lang.org/nightly/core/marker/trait.Freeze.html\" title=\"trait core::marker::Freeze\">Freeze</a> for <a class=\"struct\" href=\"zenith/elab/struct.DiscrTree.html\" title=\"struct zenith::elab::DiscrTree\">DiscrTree</a>&lt;T&gt;",1,["zenith::elab::discr::DiscrTree"]]]]]);
+    if (window.register_implementors) {
+        window.register_implementors(implementors);
+    } else {
+        window.pending_implementors = implementors;
+    }
+})()
+//{"start":57,"fragment_lengths":[564,24260,19071]}
\ No newline at end of file
@@ -0,0 +1 @@
+window.SIDEBAR_ITEMS = {"struct":["Arena","Region"],"trait":["Relocate"]};
\ No newline at end of file
@@ -0,0 +1 @@
+window.SIDEBAR_ITEMS = {"enum":["TermView","ValView"],"fn":["apply","conv","eval","find","pi_univ","quote","sig_univ","unit_univ","univ_univ"],"struct":["Forwarding","Spine","Usage"],"trait":["Calculus","Frames"]};
\ No newline at end of file
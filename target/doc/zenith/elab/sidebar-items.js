@@ -0,0 +1 @@
+window.SIDEBAR_ITEMS = {"enum":["ElabError","Hyp"],"struct":["DiscrTree","Globals","Limits","Search","Session","Stats"]};
\ No newline at end of file
@@ -0,0 +1 @@
+window.SIDEBAR_ITEMS = {"constant":["SNAPSHOT_VERSION"],"enum":["Json","JsonError","LexError","ParseError","Prec","SnapshotError","Token"],"struct":["Lexer","Span"]};
\ No newline at end of file
@@ -0,0 +1 @@
+window.SIDEBAR_ITEMS = {"enum":["EvalError","Stack","Term","TypeError","Val"],"struct":["Bound","Clos","Core","Field","Global","Index","Machine","Name","Named","Quoted"],"trait":["Decoration","Sink"],"type":["Pos"]};
\ No newline at end of file
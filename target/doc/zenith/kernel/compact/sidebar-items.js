@@ -0,0 +1 @@
+window.SIDEBAR_ITEMS = {"enum":["EvalError","TermNode","ValNode"],"struct":["Arena","Clos","List","Mark","Stack","Term","Val"]};
\ No newline at end of file
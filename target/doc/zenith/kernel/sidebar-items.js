@@ -0,0 +1 @@
+window.SIDEBAR_ITEMS = {"enum":["Binding","EvalError","LexError","ParseError","Prec","Stack","Term","Token","TypeError","Val"],"mod":["compact"],"struct":["Arena","Clos","Quoted","Span"],"trait":["Sink"]};
\ No newline at end of file
@@ -0,0 +1 @@
+window.SIDEBAR_ITEMS = {"enum":["Op"],"struct":["Profile"]};
\ No newline at end of file
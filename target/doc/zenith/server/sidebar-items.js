@@ -0,0 +1 @@
+window.SIDEBAR_ITEMS = {"constant":["MAX_MESSAGE_BYTES"],"fn":["offset","position","read_message","write_message"],"struct":["Diagnostic","Document","Server"]};
\ No newline at end of file
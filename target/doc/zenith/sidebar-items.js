@@ -0,0 +1 @@
+window.SIDEBAR_ITEMS = {"mod":["arena","common","elab","io","ir","kernel","profile","server"]};
\ No newline at end of file
@@ -1,25 +1,28 @@
-use zenith::arena::Arena;
-use zenith::io::Span;
-use zenith::ir::{Stack, Term, TypeError};
+use std::panic::{catch_unwind, AssertUnwindSafe};
+use zenith::arena::{Arena, Relocate};
+use zenith::elab::{DiscrTree, ElabError, Globals, Limits, Search, Session};
+use zenith::io::{Json, Lexer, SnapshotError, Span, Token};
+use zenith::ir::{Bound, EvalError, Field, Global, Machine, Name, Stack, Term, TypeError, Val};
+use zenith::server::{read_message, Document, Server};
 
 fn check<'b>(x: &str, t: &str, ctx: &Stack<'_, 'b>, env: &Stack<'_, 'b>, ar: &'b Arena) {
-  let t = Term::parse(Span::lex(t.chars()).unwrap().into_iter(), ar).unwrap();
+  let t = Term::parse(Lexer::new(t), ar).unwrap();
   let (t, tt) = t.infer(ctx, env, ar).unwrap();
   tt.as_univ(|tt| TypeError::type_expected(&t, tt, ctx, env, ar)).unwrap();
   let t = t.eval(env, ar).unwrap();
-  let x = Term::parse(Span::lex(x.chars()).unwrap().into_iter(), ar).unwrap();
+  let x = Term::parse(Lexer::new(x), ar).unwrap();
   let _ = x.check(t, ctx, env, ar).unwrap();
 }
 
 fn check_and_eval<'b>(x: &str, y: &str, t: &str, ctx: &Stack<'_, 'b>, env: &Stack<'_, 'b>, ar: &'b Arena) {
-  let t = Term::parse(Span::lex(t.chars()).unwrap().into_iter(), ar).unwrap();
+  let t = Term::parse(Lexer::new(t), ar).unwrap();
   let (t, tt) = t.infer(ctx, env, ar).unwrap();
   tt.as_univ(|tt| TypeError::type_expected(&t, tt, ctx, env, ar)).unwrap();
   let t = t.eval(env, ar).unwrap();
-  let x = Term::parse(Span::lex(x.chars()).unwrap().into_iter(), ar).unwrap();
+  let x = Term::parse(Lexer::new(x), ar).unwrap();
   let x = x.check(t, ctx, env, ar).unwrap();
   let x = x.eval(env, ar).unwrap();
-  let y = Term::parse(Span::lex(y.chars()).unwrap().into_iter(), ar).unwrap();
+  let y = Term::parse(Lexer::new(y), ar).unwrap();
   let y = y.check(t, ctx, env, ar).unwrap();
   let y = y.eval(env, ar).unwrap();
   assert!(x.conv(&y, ctx.len(), ar).unwrap());
@@ -162,3 +165,813 @@ fn test_check_first_order_logic_de_morgan_proof() {
     &ar,
   )
 }
+
+#[test]
+fn test_stack_lookup() {
+  let ar = Arena::new();
+  let mut env = Stack::new(&ar);
+  for i in 0..1000 {
+    env = env.extend(Bound::empty(), Val::Univ(i), &ar);
+    assert_eq!(env.len(), i + 1);
+  }
+  for ix in 0..1000 {
+    assert!(matches!(env.get(ix, &ar), Some((_, Val::Univ(v))) if v == 999 - ix));
+  }
+  assert!(env.get(1000, &ar).is_none());
+}
+
+#[test]
+fn test_multi_apply() {
+  let ar = Arena::new();
+  let (mut ctx, mut env) = (Stack::new(&ar), Stack::new(&ar));
+  for (i, name) in ["A", "w", "x", "y", "z"].into_iter().enumerate() {
+    let info = ar.bound(Bound::new(Name::new(name, &ar), &[], &ar));
+    ctx = ctx.extend(info, if i == 0 { Val::Univ(0) } else { Val::Free(0) }, &ar);
+    env = env.extend(info, Val::Free(i), &ar);
+  }
+  let k = r"([a, b, c, d] ↦ c : [a : A, b : A, c : A, d : A] → A)";
+  let (x, _) = Term::parse(Lexer::new(&format!("{k} w x y z")), &ar).unwrap().infer(&ctx, &env, &ar).unwrap();
+  let (clos_count, frame_count) = (ar.clos_count(), ar.frame_count());
+  // Saturated calls bind all arguments without building intermediate closures.
+  assert!(matches!(x.eval(&env, &ar).unwrap(), Val::Free(3)));
+  assert_eq!((ar.clos_count(), ar.frame_count()), (clos_count + 1, frame_count + 3));
+  // Partial applications stop at the last argument.
+  let (y, _) = Term::parse(Lexer::new(&format!("{k} w x")), &ar).unwrap().infer(&ctx, &env, &ar).unwrap();
+  let y = y.eval(&env, &ar).unwrap();
+  assert!(matches!(y, Val::Fun(_)));
+  assert_eq!(y.quote(5, &ar).unwrap().to_string(), r"[c, d] ↦ @^1");
+}
+
+#[test]
+fn test_fuel() {
+  let ar = Arena::new();
+  let (ctx, env) = (Stack::new(&ar), Stack::new(&ar));
+  let x = r"
+    [
+      ℕ ≔ [A : Type, s : [a : A] → A, z : A] → A,
+      mul ≔ [n, m, A, s, z] ↦ n A (m A s) z : [n : ℕ, m : ℕ] → ℕ,
+      5 ≔ [A, s, z] ↦ s (s (s (s (s z)))) : ℕ
+    ]
+      mul 5 5
+    ";
+  let (x, _) = Term::parse(Lexer::new(x), &ar).unwrap().infer(&ctx, &env, &ar).unwrap();
+  let steps = ar.step_count();
+  x.eval(&env, &ar).unwrap().quote(0, &ar).unwrap();
+  let steps = ar.step_count() - steps;
+  // Evaluation stops with a distinct error once the fuel runs out.
+  ar.set_fuel(Some(steps - 1));
+  assert!(matches!(x.eval(&env, &ar).and_then(|v| v.quote(0, &ar)), Err(EvalError::OutOfFuel)));
+  assert_eq!(ar.fuel(), Some(0));
+  // Steps taken in regions are charged to the parent.
+  ar.set_fuel(Some(steps));
+  let gc = Term::Gc(ar.term(x));
+  gc.eval(&env, &ar).unwrap().quote(0, &ar).unwrap();
+  assert_eq!(ar.fuel(), Some(0));
+  ar.set_fuel(None);
+  // The machine takes the same steps, and is bounded by the same limits.
+  let mut machine = Machine::new();
+  let x = ar.term(x);
+  let steps = ar.step_count();
+  machine.eval(x, &env, &ar).and_then(|v| machine.quote(&v, 0, &ar)).unwrap();
+  let steps = ar.step_count() - steps;
+  ar.set_fuel(Some(steps - 1));
+  assert!(matches!(machine.eval(x, &env, &ar).and_then(|v| machine.quote(&v, 0, &ar)), Err(EvalError::OutOfFuel)));
+  ar.set_fuel(None);
+  ar.set_byte_limit(Some(ar.byte_count()));
+  assert!(matches!(
+    machine.eval(x, &env, &ar).and_then(|v| machine.quote(&v, 0, &ar)),
+    Err(EvalError::OutOfMemory { .. })
+  ));
+  ar.set_byte_limit(None);
+  // Binder bodies with different shapes are told apart without instantiating either closure.
+  let t = r"[A : Type, s : [a : A] → A] → A";
+  let u = r"[A : Type] → {a : A}";
+  let t = Term::parse(Lexer::new(t), &ar).unwrap().infer(&ctx, &env, &ar).unwrap().0.eval(&env, &ar).unwrap();
+  let u = Term::parse(Lexer::new(u), &ar).unwrap().infer(&ctx, &env, &ar).unwrap().0.eval(&env, &ar).unwrap();
+  let steps = ar.step_count();
+  assert!(!t.conv(&u, 0, &ar).unwrap());
+  assert_eq!(ar.step_count(), steps);
+}
+
+#[test]
+#[cfg(feature = "profiling")]
+fn test_profile() {
+  use zenith::profile::Op;
+  let ar = Arena::new();
+  let x = "[T ≔ [X : Type, x : X] → X, id ≔ ([X, x] ↦ x : T)] ({a ≔ id, b ≔ id} : {a : T, b : T})";
+  let (x, _) = Term::parse(Lexer::new(x), &ar).unwrap().infer(&Stack::new(&ar), &Stack::new(&ar), &ar).unwrap();
+  x.eval(&Stack::new(&ar), &ar).unwrap();
+  let profile = ar.profile().unwrap();
+  let rules = profile.rule_counts();
+  assert!(rules.iter().any(|(op, variant, n)| (*op, *variant) == (Op::Check, "Tup") && *n == 1));
+  assert!(rules.iter().any(|(op, variant, _)| (*op, *variant) == (Op::Eval, "Fun")));
+  assert_eq!(profile.lookup_histogram().iter().sum::<usize>(), ar.lookup_count());
+  let mut folded = Vec::new();
+  profile.write_folded("root", &mut folded).unwrap();
+  let folded = String::from_utf8(folded).unwrap();
+  let stacks = folded.lines().map(|line| line.rsplit_once(' ').unwrap().0).collect::<Vec<_>>();
+  assert_eq!(stacks, ["root;T", "root;a", "root;b", "root;id"]);
+}
+
+#[test]
+fn test_interning() {
+  let ar = Arena::new();
+  ar.set_interning(true);
+  let (ctx, env) = (Stack::new(&ar), Stack::new(&ar));
+  check_and_eval(
+    r"[A, x] ↦ x",
+    r"[B, y] ↦ [id ≔ [X, x] ↦ x : [X : Type, x : X] → X] id B (id B y)",
+    r"[A : Type, x : A] → A",
+    &ctx,
+    &env,
+    &ar,
+  );
+  let x = Term::parse(Lexer::new(r"[X : Type, F : [x : X] → Type, x : X] → F x"), &ar);
+  let (x, _) = x.unwrap().infer(&ctx, &env, &ar).unwrap();
+  let x = x.eval(&env, &ar).unwrap();
+  let y = ar.term(x.quote(0, &ar).unwrap());
+  let z = ar.term(x.quote(0, &ar).unwrap());
+  assert!(std::ptr::eq(y, z));
+  assert!(ar.intern_hit_rate() > 0.0);
+}
+
+#[test]
+fn test_memoising() {
+  let ar = Arena::new();
+  let (ctx, env) = (Stack::new(&ar), Stack::new(&ar));
+  let x = r"[A, f, a] ↦ [x ≔ f a a, y ≔ f x x, z ≔ f y y] f z z : [A : Type, f : [a : A, b : A] → A, a : A] → A";
+  let (x, _) = Term::parse(Lexer::new(x), &ar).unwrap().infer(&ctx, &env, &ar).unwrap();
+  let x = x.eval(&env, &ar).unwrap();
+  let expected = x.quote(0, &ar).unwrap().to_string();
+  assert_eq!(ar.memo_count(), 0);
+  // SAFETY: all values quoted below are allocated in `ar` or its regions.
+  unsafe { ar.set_memoising(true) };
+  assert_eq!(x.quote(0, &ar).unwrap().to_string(), expected);
+  assert_eq!(Machine::new().quote(&x, 0, &ar).unwrap().to_string(), expected);
+  assert!(ar.memo_hit_rate() > 0.0);
+  // Values freed with a region do not share quoted forms with later ones at the same addresses.
+  let quote = |i| {
+    let temp = ar.region();
+    format!("{:?}", Val::App(temp.val(Val::Univ(i)), temp.val(Val::Univ(i)), false).quote(0, &ar).unwrap())
+  };
+  assert_ne!(quote(10), quote(11));
+  // Quoted forms of holes are not reused once they are solved.
+  let m = ar.meta(0, &Term::Univ(1));
+  let v = ar.val(Val::Meta(ar.frame(Stack::new(&ar)), m));
+  let w = Val::App(v, v, false);
+  assert!(matches!(w.quote(0, &ar).unwrap(), Term::App(Term::Meta(n), _, _) if *n == m));
+  assert!(v.conv(&Val::Univ(0), 0, &ar).unwrap());
+  assert!(matches!(w.quote(0, &ar).unwrap(), Term::App(Term::Univ(0), _, _)));
+}
+
+#[test]
+fn test_lazy_errors() {
+  let ar = Arena::new();
+  let (ctx, env) = (Stack::new(&ar), Stack::new(&ar));
+  let t = Term::parse(Lexer::new(r"[A : Type, B : Type, a : A] → B"), &ar).unwrap();
+  let (t, _) = t.infer(&ctx, &env, &ar).unwrap();
+  let t = t.eval(&env, &ar).unwrap();
+  let x = Term::parse(Lexer::new(r"[A, B, a] ↦ a : [A : Type, B : Type, a : A] → A"), &ar).unwrap();
+  let (Term::Ann(x, _), _) = x.infer(&ctx, &env, &ar).unwrap() else { unreachable!() };
+  // Types in payloads are not quoted until displayed, and the offending term is a variable, which
+  // is shared instead of allocated.
+  let count = ar.term_count();
+  assert!(!x.check_ok(t, &ctx, &env, &ar));
+  assert_eq!(ar.term_count(), count);
+  let Err(TypeError::TypeMismatch { ty, ety, .. }) = x.check(t, &ctx, &env, &ar) else { panic!() };
+  assert_eq!((ty.to_string(), ety.to_string()), ("@^2".to_owned(), "@^1".to_owned()));
+  // Failures inside inferred subterms (here, the argument of an application) construct no errors
+  // either: checking with errors builds the same subterms, plus the offending term of the error.
+  let t = Term::parse(Lexer::new(r"[A : Type, B : Type, a : A, g : [a : A] → A, f : [b : B] → B] → B"), &ar).unwrap();
+  let (t, _) = t.infer(&ctx, &env, &ar).unwrap();
+  let t = t.eval(&env, &ar).unwrap();
+  let x = Term::parse(
+    Lexer::new(r"[A, B, a, g, f] ↦ f (g a) : [A : Type, B : Type, a : A, g : [a : A] → A, f : [b : A] → B] → B"),
+    &ar,
+  );
+  let (Term::Ann(x, _), _) = x.unwrap().infer(&ctx, &env, &ar).unwrap() else { unreachable!() };
+  let count = ar.term_count();
+  assert!(!x.check_ok(t, &ctx, &env, &ar));
+  let built = ar.term_count() - count;
+  assert!(matches!(x.check(t, &ctx, &env, &ar), Err(TypeError::TypeMismatch { .. })));
+  assert_eq!(ar.term_count(), count + 2 * built + 1);
+}
+
+#[test]
+fn test_holes() {
+  let ar = Arena::new();
+  let (ctx, env) = (Stack::new(&ar), Stack::new(&ar));
+  // Implicit arguments are solved by pattern unification, also under `let`s and tuples.
+  check_and_eval(
+    r"[id ≔ [X, x] ↦ x : [X : Type, x : X] → X] [A, a] ↦ ({b ≔ id _ (id _ a), c ≔ id _ b} : {b : A, c : A})::c",
+    r"[A, a] ↦ a",
+    r"[A : Type, a : A] → A",
+    &ctx,
+    &env,
+    &ar,
+  );
+  let x = Term::parse(Lexer::new(r"[id ≔ [X, x] ↦ x : [X : Type, x : X] → X] [A, a] ↦ id _ a"), &ar).unwrap();
+  let t = Term::parse(Lexer::new(r"[A : Type, a : A] → A"), &ar).unwrap().infer(&ctx, &env, &ar).unwrap().0;
+  let t = t.eval(&env, &ar).unwrap();
+  let x = x.check(t, &ctx, &env, &ar).unwrap().zonk(&ar).unwrap();
+  assert!(x.check_ok(t, &ctx, &env, &ar));
+  // Holes which are not determined by the context remain unsolved.
+  let x = Term::parse(Lexer::new(r"[A] ↦ (_ : Type)"), &ar).unwrap();
+  let t = Term::parse(Lexer::new(r"[A : Type] → Type"), &ar).unwrap().infer(&ctx, &env, &ar).unwrap().0;
+  let x = x.check(t.eval(&env, &ar).unwrap(), &ctx, &env, &ar).unwrap();
+  let unsolved = ar.unsolved_meta_count();
+  assert!(matches!(x.zonk(&ar), Err(ElabError::UnsolvedMeta { .. })));
+  // Solutions must not mention the hole itself, or variables out of its scope.
+  let m = ar.meta(0, ar.term(Term::Univ(0)));
+  let hole = Term::Meta(m).eval(&env, &ar).unwrap();
+  let pi = Term::Pi(Bound::empty(), ar.term(Term::Meta(m)), &Term::Univ(0)).eval(&env, &ar).unwrap();
+  assert!(!hole.conv(&pi, 0, &ar).unwrap());
+  assert!(!hole.conv(&Val::Free(0), 1, &ar).unwrap());
+  assert_eq!(ar.unsolved_meta_count(), unsolved + 1);
+  let pi = Term::Pi(Bound::empty(), &Term::Univ(0), &Term::Var(0)).eval(&env, &ar).unwrap();
+  assert!(hole.conv(&pi, 0, &ar).unwrap());
+  assert_eq!(ar.unsolved_meta_count(), unsolved);
+  assert!(hole.conv(&pi, 0, &ar).unwrap() && Machine::new().conv(&hole, &pi, 0, &ar).unwrap());
+  // Types of holes are copied into the arena.
+  let short = Arena::new();
+  let m = ar.meta(0, short.term(Term::Univ(7)));
+  drop(short);
+  assert!(matches!(unsafe { ar.meta_type(m) }, Some(Term::Univ(7))));
+  // Solved holes are unfolded inside spines.
+  let id = Term::Fun(Bound::empty(), &Term::Var(0)).eval(&env, &ar).unwrap();
+  let m = ar.meta(0, ar.term(Term::Univ(1)));
+  let app = Term::App(ar.term(Term::Meta(m)), &Term::Univ(0), false).eval(&env, &ar).unwrap();
+  assert!(Term::Meta(m).eval(&env, &ar).unwrap().conv(&id, 0, &ar).unwrap());
+  assert!(app.conv(&Val::Univ(0), 0, &ar).unwrap() && Machine::new().conv(&app, &Val::Univ(0), 0, &ar).unwrap());
+  // Variables occurring more than once in the substitution cannot be referred to.
+  let env2 = Stack::new(&ar).extend(Bound::empty(), Val::Free(0), &ar).extend(Bound::empty(), Val::Free(0), &ar);
+  let hole = Term::Meta(ar.meta(2, ar.term(Term::Univ(0)))).eval(&env2, &ar).unwrap();
+  assert!(!hole.conv(&Val::Free(0), 1, &ar).unwrap());
+  // Holes solved during a failed conversion check are forgotten.
+  let env2 = Stack::new(&ar).extend(Bound::empty(), Val::Free(0), &ar).extend(Bound::empty(), Val::Free(1), &ar);
+  let m = ar.meta(0, ar.term(Term::Univ(1)));
+  let x = Term::App(ar.term(Term::App(&Term::Var(0), ar.term(Term::Meta(m)), false)), &Term::Var(0), false);
+  let y = Term::App(ar.term(Term::App(&Term::Var(0), &Term::Univ(0), false)), &Term::Var(1), false);
+  let (x, y) = (x.eval(&env2, &ar).unwrap(), y.eval(&env2, &ar).unwrap());
+  assert!(!x.conv(&y, 2, &ar).unwrap() && !ar.meta_solved(m));
+  assert!(!Machine::new().conv(&x, &y, 2, &ar).unwrap() && !ar.meta_solved(m));
+}
+
+#[test]
+fn test_discr_tree() {
+  let ar = Arena::new();
+  let sig = r"
+    {
+      Prop : Type, ⊢ : [p : Prop] → Type, ⊤ : Prop, ∧ : [p : Prop, q : Prop] → Prop, ∨ : [p : Prop, q : Prop] → Prop,
+      ⊤intro : ⊢ ⊤,
+      ∧intro : [p : Prop, q : Prop, hp : ⊢ p, hq : ⊢ q] → ⊢ (∧ p q),
+      ∧left : [p : Prop, q : Prop, h : ⊢ (∧ p q)] → ⊢ p,
+      ∨inl : [p : Prop, q : Prop, h : ⊢ p] → ⊢ (∨ p q),
+      ∨∧ : [p : Prop, q : Prop, h : ⊢ (∧ p q)] → ⊢ (∨ (∧ p q) p)
+    }
+    ";
+  let (sig, _) = Term::parse(Lexer::new(sig), &ar).unwrap().infer(&Stack::new(&ar), &Stack::new(&ar), &ar).unwrap();
+  let Val::Sig(us) = sig.eval(&Stack::new(&ar), &ar).unwrap() else { panic!() };
+  let env = Stack::new(&ar).extend(Bound::empty(), Val::Free(0), &ar);
+  // Fields are indexed as they are added, so earlier ones are seen under shorter tuple types.
+  let mut tree = DiscrTree::new();
+  for i in 5..us.len() {
+    let ctx = Stack::new(&ar).bind(Bound::empty(), Val::Sig(&us[..=i]), &ar);
+    let (_, _, ty) = ctx.get_by_name(us[i].0.name, &env, &ar).unwrap();
+    tree.insert(ty, &ctx, us[i].0.name.as_str(), &ar).unwrap();
+  }
+  assert_eq!(tree.len(), 5);
+  let ctx = Stack::new(&ar).bind(Bound::empty(), Val::Sig(us), &ar);
+  let get = |goal: &str| {
+    let (goal, _) = Term::parse(Lexer::new(goal), &ar).unwrap().infer(&ctx, &env, &ar).unwrap();
+    let mut res = tree.get(goal.eval(&env, &ar).unwrap(), &ctx, &ar).unwrap().into_iter().copied().collect::<Vec<_>>();
+    res.sort();
+    res
+  };
+  let sorted = |mut names: Vec<&'static str>| {
+    names.sort();
+    names
+  };
+  assert_eq!(get("⊢ ⊤"), sorted(vec!["⊤intro", "∧left"]));
+  assert_eq!(get("⊢ (∧ ⊤ ⊤)"), sorted(vec!["∧intro", "∧left"]));
+  assert_eq!(get("⊢ (∨ ⊤ ⊤)"), sorted(vec!["∧left", "∨inl"]));
+  assert_eq!(get("⊢ (∨ (∧ ⊤ ⊤) ⊤)"), sorted(vec!["∧left", "∨inl", "∨∧"]));
+  // Holes in goals match anything.
+  assert_eq!(get("⊢ (∨ _ ⊤)"), sorted(vec!["∧left", "∨inl", "∨∧"]));
+  assert_eq!(get("⊢ (_ : Prop)").len(), 5);
+  assert!(get("Prop").is_empty());
+}
+
+#[test]
+fn test_search() {
+  let ar = Arena::new();
+  let sig = r"
+    {
+      Prop : Type, ⊢ : [p : Prop] → Type, ⊤ : Prop, ∧ : [p : Prop, q : Prop] → Prop, p : Prop, q : Prop,
+      ⊤intro : ⊢ ⊤,
+      ∧intro : [p : Prop, q : Prop, hp : ⊢ p, hq : ⊢ q] → ⊢ (∧ p q),
+      ∧left : [p : Prop, q : Prop, h : ⊢ (∧ p q)] → ⊢ p,
+      ∧right : [p : Prop, q : Prop, h : ⊢ (∧ p q)] → ⊢ q
+    }
+    ";
+  let (sig, _) = Term::parse(Lexer::new(sig), &ar).unwrap().infer(&Stack::new(&ar), &Stack::new(&ar), &ar).unwrap();
+  let sig = sig.eval(&Stack::new(&ar), &ar).unwrap();
+  let ctx = Stack::new(&ar).bind(Bound::empty(), sig, &ar);
+  let env = Stack::new(&ar).extend(Bound::empty(), Val::Free(0), &ar);
+  let hyps = DiscrTree::hyps(&ctx, &env, &ar).unwrap();
+  assert_eq!(hyps.len(), 10);
+  let goal = |goal: &str| {
+    let (goal, _) = Term::parse(Lexer::new(goal), &ar).unwrap().infer(&ctx, &env, &ar).unwrap();
+    goal.eval(&env, &ar).unwrap()
+  };
+  let metas = (ar.meta_count(), ar.unsolved_meta_count());
+  let mut search = Search::new(&hyps, Limits::default(), &ar);
+  for t in ["⊢ (∧ ⊤ (∧ ⊤ ⊤))", "[h : ⊢ (∧ p q)] → ⊢ (∧ q p)", "[h : ⊢ p, h : ⊢ q] → ⊢ (∧ (∧ q p) ⊤)"]
+  {
+    let proof = search.prove(goal(t), &ctx, &env).unwrap().unwrap();
+    assert!(proof.check_ok(goal(t), &ctx, &env, &ar), "{t}");
+  }
+  // Holes in the goal are left unsolved.
+  let m = ar.meta_count();
+  assert!(search.prove(goal("⊢ _"), &ctx, &env).unwrap().is_some());
+  assert!(!ar.meta_solved(m));
+  // Search gives up once the budget is exhausted.
+  let mut search = Search::new(&hyps, Limits { nodes: 50, ..Limits::default() }, &ar);
+  assert!(search.prove(goal("⊢ p"), &ctx, &env).unwrap().is_none());
+  assert!(search.stats().expanded <= 50 && search.stats().generated > 0);
+  assert_eq!((ar.meta_count(), ar.unsolved_meta_count()), (metas.0 + 1, metas.1 + 1));
+}
+
+#[test]
+fn test_arena_regions() {
+  let ar = Arena::new();
+  let (x_info, a_info) =
+    (ar.bound(Bound::new(Name::new("X", &ar), &[], &ar)), ar.bound(Bound::new(Name::new("a", &ar), &[], &ar)));
+  let ctx = Stack::new(&ar).extend(x_info, Val::Univ(0), &ar).extend(a_info, Val::Free(0), &ar);
+  let env = Stack::new(&ar).extend(x_info, Val::Free(0), &ar).extend(a_info, Val::Free(1), &ar);
+  let x = r"
+    [
+      ℕ ≔ [A : Type, s : [a : A] → A, z : A] → A,
+      mul ≔ [n, m, A, s, z] ↦ n A (m A s) z : [n : ℕ, m : ℕ] → ℕ,
+      10 ≔ [A, s, z] ↦ s (s (s (s (s (s (s (s (s (s z))))))))) : ℕ
+    ]
+      mul 10 (mul 10 10) X ([a] ↦ a) a
+    ";
+  let (x, _) = Term::parse(Lexer::new(x), &ar).unwrap().infer(&ctx, &env, &ar).unwrap();
+  let x = Term::Gc(ar.term(x));
+  let before = ar.byte_count();
+  let y = x.eval(&env, &ar).unwrap();
+  let z = x.eval(&env, &ar).unwrap();
+  // Only the results are copied out of the regions, all intermediate values are freed.
+  assert_eq!(ar.byte_count(), before + ar.copied_bytes());
+  assert!(ar.freed_bytes() > ar.copied_bytes());
+  assert!(matches!((y, z), (Val::Free(1), Val::Free(1))));
+  // The peak includes the intermediate values of the regions.
+  assert!(ar.peak_bytes() > ar.byte_count());
+  // Regions count the bytes live in their parent towards the limit.
+  let limit = ar.byte_count() + (ar.peak_bytes() - ar.byte_count()) / 2;
+  ar.set_byte_limit(Some(limit));
+  assert!(matches!(x.eval(&env, &ar), Err(EvalError::OutOfMemory { limit: l }) if l == limit));
+  // Holes cannot be created in the parent while a region is alive, since the region numbers its
+  // own holes from there.
+  let temp = ar.region();
+  assert!(catch_unwind(AssertUnwindSafe(|| ar.meta(0, &Term::Univ(0)))).is_err());
+  drop(temp);
+  assert_eq!(ar.meta(0, &Term::Univ(0)), ar.meta_count() - 1);
+}
+
+#[test]
+fn test_relocate_shared_values() {
+  let temp = Arena::new();
+  let mut x = Val::Univ(0);
+  for _ in 0..64 {
+    let values = temp.values(2);
+    values.fill((Field::empty(), x));
+    x = Val::Tup(values);
+  }
+  let ar = Arena::new();
+  // Copying the tuple as a tree would create 2^64 nodes.
+  let _ = ar.copy_in(|| x.relocate(&ar));
+  assert_eq!(ar.val_count(), 64 * 2);
+}
+
+#[test]
+fn test_globals() {
+  let gar = Arena::new();
+  let mut globals = Globals::new();
+  let defs = [
+    ("ℕ", r"[A : Type, s : [a : A] → A, z : A] → A"),
+    ("mul", r"[n, m, A, s, z] ↦ n A (m A s) z : [n : ℕ, m : ℕ] → ℕ"),
+    ("10", r"[A, s, z] ↦ s (s (s (s (s (s (s (s (s (s z))))))))) : ℕ"),
+    ("100", r"mul 10 10"),
+  ];
+  for (name, x) in defs {
+    let (ctx, env) = (Stack::new(&gar), Stack::new(&gar));
+    let x = Term::parse(Lexer::new(x), &gar).unwrap();
+    let (x, ty) = x.infer_with(&globals, &ctx, &env, &gar).unwrap();
+    let val = x.eval(&env, &gar).unwrap();
+    let info = gar.bound(Bound::new(Name::new(name, &gar), &[], &gar));
+    globals.insert(gar.global(Global { info, term: gar.term(x), ty, val }));
+  }
+  for _ in 0..2 {
+    // Queries are checked in regions of `gar`, whose names compare equal to those of globals.
+    let ar = gar.region();
+    let (ctx, env) = (Stack::new(&ar), Stack::new(&ar));
+    let t = Term::parse(Lexer::new(r"[P : [n : ℕ] → Type, h : P 100] → P (mul 10 10)"), &ar);
+    let (t, _) = t.unwrap().infer_with(&globals, &ctx, &env, &ar).unwrap();
+    let t = t.eval(&env, &ar).unwrap();
+    let x = Term::parse(Lexer::new(r"[P, h] ↦ h"), &ar).unwrap();
+    let _ = x.check_with(t, &globals, &ctx, &env, &ar).unwrap();
+    // Global definitions are not re-checked.
+    assert!(ar.term_count() < 100);
+  }
+}
+
+#[test]
+fn test_session() {
+  let gar = Arena::new();
+  let mut session = Session::new(&gar);
+  let mut check = |src: &str| {
+    let Term::Tup(defs) = Term::parse(Lexer::new(src), &gar).unwrap() else { panic!() };
+    session.check(defs).map(|globals| globals.len()).map_err(|e| e.to_string())?;
+    Ok::<_, String>(session.checked_count())
+  };
+  let block = |ten: &str, last: &str| {
+    format!(
+      r"{{ ℕ ≔ [A : Type, s : [a : A] → A, z : A] → A, mul ≔ [n, m, A, s, z] ↦ n A (m A s) z : [n : ℕ, m : ℕ] → ℕ,
+      10 ≔ {ten} : ℕ, 100 ≔ mul 10 10, id ≔ [x] ↦ x : [x : ℕ] → ℕ, {last} }}"
+    )
+  };
+  let ten = r"[A, s, z] ↦ s (s (s (s (s (s (s (s (s (s z)))))))))";
+  assert_eq!(check(&block(ten, "p ≔ [P, h] ↦ h : [P : [n : ℕ] → Type, h : P 100] → P (mul 10 10)")), Ok(6));
+  // Unchanged definitions are reused.
+  assert_eq!(check(&block(ten, "p ≔ [P, h] ↦ h : [P : [n : ℕ] → Type, h : P 100] → P (mul 10 10)")), Ok(0));
+  // Edited definitions are checked again, together with their dependents.
+  let ten = r"[A, s, z] ↦ s (s (s (s (s (s (s (s (s (s (s z))))))))))";
+  assert_eq!(check(&block(ten, "p ≔ [P, h] ↦ h : [P : [n : ℕ] → Type, h : P 100] → P (mul 10 10)")), Ok(3));
+  assert!(check(&block(ten, "p ≔ [P, h] ↦ h : [P : [n : ℕ] → Type, h : P 100] → P (mul 10 id)")).is_err());
+  assert_eq!(check(&block(ten, "q ≔ 100")), Ok(1));
+  // Holes are solved inside the region of each definition, and replaced by their solutions.
+  assert_eq!(check(&block(ten, "q ≔ [P, h] ↦ h : [P : [n : ℕ] → Type, h : P 100] → P (id _)")), Ok(1));
+  assert_eq!(check(&block(ten, "q ≔ (_ : ℕ)")).map_err(|e| e.starts_with("unsolved hole")), Err(true));
+  // Definitions removed from the block are forgotten.
+  assert_eq!(check(&block(ten, "q ≔ 100")), Ok(1));
+  assert_eq!(check(&block(ten, "r ≔ 100")), Ok(1));
+  assert_eq!(check(&block(ten, "q ≔ 100")), Ok(1));
+}
+
+#[test]
+fn test_snapshot() {
+  let gar = Arena::new();
+  let mut globals = Globals::new();
+  let defs = [
+    ("ℕ", r"[A : Type, s : [a : A] → A, z : A] → A"),
+    ("mul", r"[n, m, A, s, z] ↦ n A (m A s) z : [n : ℕ, m : ℕ] → ℕ"),
+    ("10", r"[A, s, z] ↦ s (s (s (s (s (s (s (s (s (s z))))))))) : ℕ"),
+    ("100", r"mul 10 10"),
+    ("pair", r"{fst ≔ 10, snd ≔ 100} : {fst : ℕ, snd : ℕ}"),
+  ];
+  for (name, x) in defs {
+    let (ctx, env) = (Stack::new(&gar), Stack::new(&gar));
+    let x = Term::parse(Lexer::new(x), &gar).unwrap();
+    let (x, ty) = x.infer_with(&globals, &ctx, &env, &gar).unwrap();
+    let val = x.eval(&env, &gar).unwrap();
+    let info = gar.bound(Bound::new(Name::new(name, &gar), &["simp"], &gar));
+    globals.insert(gar.global(Global { info, term: gar.term(x), ty, val }));
+  }
+  let bytes = globals.save().unwrap();
+  for trusted in [false, true] {
+    let gar = Arena::new();
+    let mut globals = Globals::new();
+    assert_eq!(globals.load(&bytes, trusted, &gar).unwrap(), defs.len());
+    assert_eq!(globals.get(Name::new("pair", &gar)).unwrap().info.attrs, ["simp"]);
+    let ar = gar.region();
+    let (ctx, env) = (Stack::new(&ar), Stack::new(&ar));
+    let t = Term::parse(Lexer::new(r"[P : [n : ℕ] → Type, h : P pair::snd] → P (mul 10 10)"), &ar);
+    let (t, _) = t.unwrap().infer_with(&globals, &ctx, &env, &ar).unwrap();
+    let t = t.eval(&env, &ar).unwrap();
+    let x = Term::parse(Lexer::new(r"[P, h] ↦ h"), &ar).unwrap();
+    let _ = x.check_with(t, &globals, &ctx, &env, &ar).unwrap();
+    // Saving again gives the same bytes.
+    assert_eq!(globals.save().unwrap(), bytes);
+  }
+  // Corrupted or truncated snapshots are rejected.
+  let gar = Arena::new();
+  assert!(Globals::new().load(b"ZSNQ\x01\0\0\0", false, &gar).is_err());
+  assert!(Globals::new().load(&bytes[..bytes.len() - 1], false, &gar).is_err());
+  // The first record after the header is the universe `Type`, shared by all definitions.
+  let mut forged = bytes.clone();
+  assert_eq!(forged[8..10], [1, 0]);
+  forged[9] = 1;
+  assert!(Globals::new().load(&forged, false, &gar).is_err());
+  // Stored types must agree with their definitions, here claiming `Type : [A : Type] → A`.
+  let mut forged = Globals::new();
+  let (ctx, env) = (Stack::new(&gar), Stack::new(&gar));
+  let (x, _) = Term::parse(Lexer::new(r"Type"), &gar).unwrap().infer(&ctx, &env, &gar).unwrap();
+  let (t, _) = Term::parse(Lexer::new(r"[A : Type] → A"), &gar).unwrap().infer(&ctx, &env, &gar).unwrap();
+  let (ty, val) = (t.eval(&env, &gar).unwrap(), x.eval(&env, &gar).unwrap());
+  let info = gar.bound(Bound::new(Name::new("type", &gar), &[], &gar));
+  let global = gar.global(Global { info, term: gar.term(x), ty, val });
+  // Shadowed definitions are counted too.
+  forged.insert(global);
+  forged.insert(global);
+  assert_eq!((forged.len(), forged.iter().count()), (2, 2));
+  let bytes = forged.save().unwrap();
+  assert!(matches!(Globals::new().load(&bytes, false, &gar), Err(SnapshotError::Rejected { .. })));
+  assert_eq!(Globals::new().load(&bytes, true, &gar).unwrap(), 2);
+}
+
+#[test]
+fn test_lexer() {
+  let src = "[α ≔ x^12] α::β := Type -> {}";
+  let spans = Lexer::new(src).map(|Span { tok, start, end }| (tok, &src[start..end])).collect::<Vec<_>>();
+  assert_eq!(
+    spans,
+    [
+      (Token::LeftBracket, "["),
+      (Token::Id("α"), "α"),
+      (Token::Def, "≔"),
+      (Token::Id("x"), "x"),
+      (Token::Ix(12), "^12"),
+      (Token::RightBracket, "]"),
+      (Token::Id("α"), "α"),
+      (Token::Proj, "::"),
+      (Token::Id("β"), "β"),
+      (Token::Def, ":="),
+      (Token::Type, "Type"),
+      (Token::Pi, "->"),
+      (Token::LeftBrace, "{"),
+      (Token::RightBrace, "}"),
+    ]
+  );
+  // Positions of errors are byte offsets.
+  let ar = Arena::new();
+  let err = Term::parse(Lexer::new("[α : Type] ↦ α"), &ar).unwrap_err();
+  assert_eq!(err.position(0), (12, 15));
+}
+
+#[test]
+fn test_symbols() {
+  let ar = Arena::new();
+  let x = ar.symbol("x");
+  let bytes = ar.byte_count();
+  // Identical strings are stored only once per arena, and regions use the table of their parent.
+  assert!(std::ptr::eq(x, ar.symbol(&String::from("x"))));
+  assert!(std::ptr::eq(x, ar.region().symbol("x")));
+  assert_eq!(ar.byte_count(), bytes);
+  let y = ar.region().symbol("y").as_ptr();
+  assert_eq!(y, ar.symbol("y").as_ptr());
+  // Names compare by address.
+  assert_eq!(Name::new(x, &ar), Name::new("x", &ar));
+  assert_ne!(Name::new(x, &ar), Name::new("y", &ar));
+  assert_eq!(Name::new("", &ar), Name::EMPTY);
+  // The table is freed with the arena.
+  let mut other = Arena::new();
+  other.symbol("z");
+  let bytes = other.byte_count();
+  other.reset();
+  other.symbol("z");
+  assert_eq!(other.byte_count(), bytes);
+  let t = Term::parse(Lexer::new("[A : Type, a : A, b : A] → A"), &ar).unwrap();
+  // All occurrences of `A` share the same string.
+  let Term::Pi(info, _, u) = t else { panic!() };
+  let Term::Pi(_, Term::NamedVar(a, _), _) = u else { panic!() };
+  assert!(std::ptr::eq(info.name.as_str(), a.as_str()));
+}
+
+#[test]
+fn test_name_index() {
+  let ar = Arena::new();
+  let env = Stack::new(&ar);
+  let bound = |name: &str| ar.bound(Bound::new(Name::new(name, &ar), &[], &ar));
+  let fields = (0..1000).map(|i| format!("f{i} : X")).collect::<Vec<_>>().join(", ");
+  let t = format!("{{a : X, b : X, {fields}, a : X}}");
+  // Contexts built by `bind` are indexed, and those built by `extend` are scanned linearly.
+  let (ctx, linear) =
+    (Stack::new(&ar).bind(bound("X"), Val::Univ(0), &ar), Stack::new(&ar).extend(bound("X"), Val::Univ(0), &ar));
+  let env = env.extend(bound("X"), Val::Free(0), &ar);
+  let (t, _) = Term::parse(Lexer::new(&t), &ar).unwrap().infer(&ctx, &env, &ar).unwrap();
+  let t = t.eval(&env, &ar).unwrap();
+  let (ctx, linear) = (ctx.bind(Bound::empty(), t, &ar), linear.extend(Bound::empty(), t, &ar));
+  let env = env.extend(Bound::empty(), Val::Free(1), &ar);
+  let (ctx, linear) = (ctx.bind(bound("y"), Val::Free(0), &ar), linear.extend(bound("y"), Val::Free(0), &ar));
+  let env = env.extend(bound("y"), Val::Free(2), &ar);
+  for name in ["X", "y", "a", "b", "f0", "f999", "z"] {
+    let name = Name::new(name, &ar);
+    let (res, expected) = (ctx.get_by_name(name, &env, &ar), linear.get_by_name(name, &env, &ar));
+    assert_eq!(res.map(|(ix, proj, _)| (ix, proj)), expected.map(|(ix, proj, _)| (ix, proj)));
+  }
+  assert_eq!(ctx.get_by_name(Name::new("a", &ar), &env, &ar).map(|(ix, proj, _)| (ix, proj)), Some((1, Some(0))));
+  assert!(ctx.is_name_valid(1, Some(1001), Name::new("b", &ar), &env, &ar));
+  // The first `a` is shadowed by the last field.
+  assert!(!ctx.is_name_valid(1, Some(1002), Name::new("a", &ar), &env, &ar));
+  assert!(!linear.is_name_valid(1, Some(1002), Name::new("a", &ar), &env, &ar));
+  // Indexed lookups do not scan the fields. Lookups are only counted with the `profiling` feature.
+  #[cfg(feature = "profiling")]
+  {
+    let temp = Arena::new();
+    let _ = ctx.get_by_name(Name::new("f0", &ar), &env, &temp);
+    assert!(temp.average_link_count() < 4.0);
+  }
+}
+
+#[test]
+fn test_parallel_tuple_check() {
+  let ar = Arena::new();
+  let (ctx, env) = (Stack::new(&ar), Stack::new(&ar));
+  let fields = |f: &dyn Fn(usize) -> String| (0..64).map(f).collect::<Vec<_>>().join(", ");
+  let t = format!("{{{}}}", fields(&|i| format!("f{i} : [X : Type, x : X] → X")));
+  let x = format!("{{{}}}", fields(&|i| format!("f{i} ≔ [X, x] ↦ x")));
+  let (t, _) = Term::parse(Lexer::new(&t), &ar).unwrap().infer(&ctx, &env, &ar).unwrap();
+  let t = t.eval(&env, &ar).unwrap();
+  let x = Term::parse(Lexer::new(&x), &ar).unwrap().check(t, &ctx, &env, &ar).unwrap();
+  ar.set_threads(4);
+  let _ = x.check(t, &ctx, &env, &ar).unwrap();
+  assert!(ar.freed_bytes() > 0);
+  // Replaces the body of one field with `X`, which is ill-typed.
+  let Term::Tup(bs) = x else { unreachable!() };
+  let ys = ar.terms(bs.len());
+  ys.copy_from_slice(bs);
+  let Term::Fun(i, Term::Fun(j, _)) = ys[42].1 else { unreachable!() };
+  ys[42].1 = Term::Fun(i, ar.term(Term::Fun(j, ar.term(Term::Var(1)))));
+  assert!(matches!(Term::Tup(ys).check(t, &ctx, &env, &ar), Err(TypeError::TypeMismatch { .. })));
+}
+
+#[test]
+fn test_parallel_elaboration() {
+  let ar = Arena::new();
+  let (ctx, env) = (Stack::new(&ar), Stack::new(&ar));
+  let fields = |f: &dyn Fn(usize) -> String| (0..64).map(f).collect::<Vec<_>>().join(", ");
+  // Every field mentions `A` in its type, and every other field refers to the one before it.
+  let t = format!("[X : Type] → {{A : Type, {}}}", fields(&|i| format!("f{i} : [x : A] → A")));
+  let x = |bad: &[usize]| {
+    let body = |i| match i {
+      _ if bad.contains(&i) => format!("f{i} ≔ [x] ↦ g{i}"),
+      _ if i % 2 == 1 => format!("f{i} ≔ [x] ↦ f{} x", i - 1),
+      _ => format!("f{i} ≔ [x] ↦ x"),
+    };
+    Term::parse(Lexer::new(&format!("[X] ↦ {{A ≔ X, {}}}", fields(&body))), &ar).unwrap()
+  };
+  let (t, _) = Term::parse(Lexer::new(&t), &ar).unwrap().infer(&ctx, &env, &ar).unwrap();
+  let t = t.eval(&env, &ar).unwrap();
+  let expected = x(&[]).check(t, &ctx, &env, &ar).unwrap().eval(&env, &ar).unwrap();
+  let err = x(&[41, 20]).check(t, &ctx, &env, &ar).unwrap_err().to_string();
+  assert!(err.contains("g20"));
+  ar.set_threads(4);
+  let freed = ar.freed_bytes();
+  let res = x(&[]).check(t, &ctx, &env, &ar).unwrap().eval(&env, &ar).unwrap();
+  assert!(ar.freed_bytes() > freed);
+  assert!(res.conv(&expected, 0, &ar).unwrap());
+  // The error of the first ill-typed field is reported, as when checking in order.
+  assert_eq!(x(&[41, 20]).check(t, &ctx, &env, &ar).unwrap_err().to_string(), err);
+}
+
+#[test]
+fn test_parallel_first_order_logic() {
+  let ar = Arena::new();
+  ar.set_threads(2);
+  let src = std::fs::read_to_string(concat!(env!("CARGO_MANIFEST_DIR"), "/examples/first_order_logic.zt")).unwrap();
+  let (ctx, env) = (Stack::new(&ar), Stack::new(&ar));
+  ar.set_gluing(true);
+  let _ = Term::parse(Lexer::new(&src), &ar).unwrap().infer(&ctx, &env, &ar).unwrap();
+  // The lemmas only refer to the fields of the structure, so they are checked on workers.
+  assert!(ar.freed_bytes() > 0);
+}
+
+#[test]
+fn test_check_glued_definitions() {
+  let ar = Arena::new();
+  ar.set_gluing(true);
+  // Without glued values, this would normalise a numeral with a million applications.
+  check(
+    r"
+    [X, Q] ↦ [
+      Nat ≔ [f : [x : X] → X, x : X] → X,
+      mul ≔ [a, b, f] ↦ a (b f) : [a : Nat, b : Nat] → Nat,
+      n10 ≔ [f, x] ↦ f (f (f (f (f (f (f (f (f (f x))))))))) : Nat,
+      n1k ≔ mul n10 (mul n10 n10),
+      n1M ≔ mul n1k n1k,
+      p ≔ ([h] ↦ h : [h : Q n1M] → Q (mul n1k n1k))
+    ]
+      X
+    ",
+    r"[X : Type, Q : [n : [f : [x : X] → X, x : X] → X] → Type] → Type",
+    &Stack::new(&ar),
+    &Stack::new(&ar),
+    &ar,
+  );
+}
+
+#[test]
+fn test_machine_small_stack() {
+  let numeral = |n: &str| {
+    format!(
+      r"
+      [
+        ℕ ≔ [A : Type, s : [a : A] → A, z : A] → A,
+        mul ≔ [n, m, A, s, z] ↦ n A (m A s) z : [n : ℕ, m : ℕ] → ℕ,
+        10 ≔ [A, s, z] ↦ s (s (s (s (s (s (s (s (s (s z))))))))) : ℕ,
+        100 ≔ mul 10 10,
+        1000 ≔ mul 10 100
+      ]
+        {n}
+      "
+    )
+  };
+  let (x, y) = (numeral("mul 1000 100"), numeral("mul 100 1000"));
+  // The recursive evaluator would need a stack frame for each of the 100000 applications.
+  std::thread::Builder::new()
+    .stack_size(1024 * 1024)
+    .spawn(move || {
+      let ar = Arena::new();
+      let (ctx, env) = (Stack::new(&ar), Stack::new(&ar));
+      let mut machine = Machine::new();
+      let (x, _) = Term::parse(Lexer::new(&x), &ar).unwrap().infer(&ctx, &env, &ar).unwrap();
+      let (y, _) = Term::parse(Lexer::new(&y), &ar).unwrap().infer(&ctx, &env, &ar).unwrap();
+      let x = machine.eval(ar.term(x), &env, &ar).unwrap();
+      let y = machine.eval(ar.term(y), &env, &ar).unwrap();
+      assert!(machine.conv(&x, &y, 0, &ar).unwrap());
+      let mut x = &machine.quote(&x, 0, &ar).unwrap();
+      let mut count = 0;
+      while let Term::Fun(_, b) | Term::App(_, b, _) = x {
+        count += 1;
+        x = b;
+      }
+      assert!(matches!(x, Term::Var(0)));
+      assert_eq!(count, 100003);
+    })
+    .unwrap()
+    .join()
+    .unwrap();
+}
+
+#[test]
+fn test_document() {
+  let ar = Arena::new();
+  let mut doc = Document::new(&ar);
+  let text =
+    "{ ℕ ≔ [A : Type, s : [a : A] → A, z : A] → A, 0 ≔ [A, s, z] ↦ z : ℕ, id ≔ [A, a] ↦ a : [A : Type, a : A] → A }";
+  assert_eq!(doc.update(text.to_string()), []);
+  assert_eq!(doc.checked_count(), 3);
+  let pos = text.find("0 ≔").unwrap();
+  let (start, end, ty) = doc.hover(pos + 5).unwrap();
+  assert_eq!((start, end), (pos, pos + 1));
+  assert!(ty.starts_with("0 : "));
+  // Only the edited definition is checked again.
+  let text = text.replace("[A, a] ↦ a", "[A, b] ↦ b");
+  assert_eq!(doc.update(text.clone()), []);
+  assert_eq!(doc.checked_count(), 1);
+  // Errors are attached to the definitions they occur in, and earlier definitions are kept.
+  let text = text.replace("↦ z : ℕ", "↦ s : ℕ");
+  let diags = doc.update(text.clone());
+  let start = text.find("0 ≔").unwrap();
+  assert_eq!(diags.len(), 1);
+  assert_eq!((diags[0].start, diags[0].end), (start, text.find(", id").unwrap()));
+  assert!(doc.hover(text.find("ℕ ≔").unwrap()).is_some());
+  assert!(doc.hover(start).is_none());
+  let diags = doc.update("{ a ≔ Type) }".to_string());
+  assert_eq!(diags.len(), 1);
+  assert_eq!(diags[0].start, "{ a ≔ Type".len());
+  assert!(doc.hover(2).is_some());
+}
+
+#[test]
+fn test_server() {
+  let msg = r#"{"a": [1, -2.5e1, true, null], "b": "\"\\\né😀"}"#;
+  let json = Json::parse(msg).unwrap();
+  assert_eq!(json.get("b").and_then(Json::as_str), Some("\"\\\né😀"));
+  assert_eq!(Json::parse(&json.to_string()).unwrap(), json);
+  assert!(Json::parse("[1, 2").is_err());
+  let mut input = "Content-Length: 4\r\n\r\nnull".as_bytes();
+  assert_eq!(read_message(&mut input).unwrap().as_deref(), Some("null"));
+  assert_eq!(read_message(&mut input).unwrap(), None);
+  let mut input = "Content-Length: 18446744073709551615\r\n\r\nnull".as_bytes();
+  assert!(read_message(&mut input).is_err());
+
+  let (out, rx) = std::sync::mpsc::channel();
+  let recv = || rx.recv_timeout(std::time::Duration::from_secs(60)).unwrap();
+  let mut server = Server::new(out);
+  assert!(server.handle(r#"{"jsonrpc": "2.0", "id": 1, "method": "initialize", "params": {}}"#));
+  assert_eq!(
+    recv().get("result").and_then(|res| res.get("capabilities")).and_then(|c| c.get("hoverProvider")),
+    Some(&Json::Bool(true))
+  );
+  let open = r#"{"jsonrpc": "2.0", "method": "textDocument/didOpen", "params": {"textDocument":
+    {"uri": "file:///a.zt", "version": 1, "text": "{\n  id ≔ [A, a] ↦ a : [A : Type, a : A] → A,\n  x ≔ id\n}"}}}"#;
+  assert!(server.handle(open));
+  let diags = recv();
+  assert_eq!(diags.get("method").and_then(Json::as_str), Some("textDocument/publishDiagnostics"));
+  assert_eq!(diags.get("params").and_then(|p| p.get("diagnostics")), Some(&Json::Array(Vec::new())));
+  let hover = r#"{"jsonrpc": "2.0", "id": 2, "method": "textDocument/hover", "params":
+    {"textDocument": {"uri": "file:///a.zt"}, "position": {"line": 2, "character": 2}}}"#;
+  assert!(server.handle(hover));
+  let res = recv();
+  assert_eq!(res.get("id"), Some(&Json::Number(2.0)));
+  let res = res.get("result").unwrap();
+  assert!(res.get("contents").and_then(|c| c.get("value")).and_then(Json::as_str).unwrap().starts_with("x : "));
+  let start = res.get("range").and_then(|r| r.get("start")).unwrap();
+  assert_eq!((start.get("line"), start.get("character")), (Some(&Json::Number(2.0)), Some(&Json::Number(2.0))));
+  assert!(server.handle(r#"{"jsonrpc": "2.0", "id": 3, "method": "unknown"}"#));
+  assert!(recv().get("error").is_some());
+  assert!(!server.handle(r#"{"jsonrpc": "2.0", "method": "exit"}"#));
+}
@@ -1,4 +1,4 @@
-use zenith::kernel::{Arena, Span, Stack, Term};
+use zenith::kernel::{Arena, Clos, EvalError, Span, Stack, Term, Val};
 
 fn check<'a>(x: &str, t: &str, ctx: &Stack<'a>, env: &Stack<'a>, ar: &'a Arena) {
   let t = Term::parse(Span::lex(t.chars()).unwrap().into_iter(), ar).unwrap();
@@ -156,3 +156,151 @@ fn test_check_first_order_logic_de_morgan_proof() {
     &ar,
   )
 }
+
+#[test]
+fn test_stack_lookup() {
+  let ar = Arena::new();
+  let mut env = Stack::new(&ar);
+  for i in 0..1000 {
+    env = env.extend(Val::Univ(i), &ar);
+    assert_eq!(env.len(), i + 1);
+  }
+  for ix in 0..1000 {
+    assert!(matches!(env.get(ix, &ar), Some(Val::Univ(v)) if v == 999 - ix));
+  }
+  assert!(env.get(1000, &ar).is_none());
+}
+
+#[test]
+fn test_relocate_shared_stack() {
+  let temp = Arena::new();
+  let mut env = Stack::new(&temp);
+  for i in 0..1000 {
+    env = env.extend(Val::Univ(i), &temp);
+  }
+  let body = temp.term(Term::Var(0));
+  let values = temp.values(1000);
+  for value in values.iter_mut() {
+    *value = Val::Fun(temp.clos(Clos { env: env.clone(), body }));
+  }
+  let ar = Arena::new();
+  let x = ar.copy_in(|| Val::Tup(values).relocate(&ar));
+  // All closures share the same environment, which is copied only once.
+  assert_eq!(ar.frame_count(), 1000);
+  assert!(matches!(x, Val::Tup(xs) if xs.len() == 1000));
+}
+
+#[test]
+fn test_check_ok() {
+  let ar = Arena::new();
+  let t = Term::parse(Span::lex(r"[A : Type, B : Type, a : A] → B".chars()).unwrap().into_iter(), &ar).unwrap();
+  let t = t.eval(&Stack::new(&ar), &ar).unwrap();
+  let x = Term::parse(Span::lex(r"[A, B, a] ↦ a".chars()).unwrap().into_iter(), &ar).unwrap();
+  assert!(!x.check_ok(t, &Stack::new(&ar), &Stack::new(&ar), &ar));
+  let err = x.check(t, &Stack::new(&ar), &Stack::new(&ar), &ar).unwrap_err();
+  assert_eq!(err.to_string(), "term @^0 has type @^2, but the expected type is @^1");
+  // Failed checks construct no errors, so the offending term is not allocated.
+  let x = Term::parse(Span::lex(r"[A, B, a] ↦ (a : A)".chars()).unwrap().into_iter(), &ar).unwrap();
+  let count = ar.term_count();
+  assert!(!x.check_ok(t, &Stack::new(&ar), &Stack::new(&ar), &ar));
+  assert_eq!(ar.term_count(), count);
+  assert!(x.check(t, &Stack::new(&ar), &Stack::new(&ar), &ar).is_err());
+  assert!(ar.term_count() > count);
+  // Nor are terms failing inside inferred subterms.
+  let x = Term::parse(Span::lex(r"[A, B, a] ↦ (((a : A) : B) : B)".chars()).unwrap().into_iter(), &ar).unwrap();
+  let count = ar.term_count();
+  assert!(!x.check_ok(t, &Stack::new(&ar), &Stack::new(&ar), &ar));
+  assert_eq!(ar.term_count(), count);
+  assert!(x.check(t, &Stack::new(&ar), &Stack::new(&ar), &ar).is_err());
+  assert!(ar.term_count() > count);
+}
+
+#[test]
+fn test_compact_eval_quote_conv() {
+  use zenith::kernel::compact;
+  let srcs = [
+    r"[id ≔ [X, x] ↦ x : [X : Type, x : X] → X] [A] ↦ id ([a : A] → A) (id A)",
+    r"[P, Q, h] ↦ {hq ≔ h^0, hp ≔ h^1, hr := (h^0)}",
+    r"[A : Type, B : [a : A] → Type] → {a : A, b : B a, c : {x : A}}",
+    r"[ℕ ≔ [A : Type, s : [a : A] → A, z : A] → A,
+      mul ≔ [n, m, A, s, z] ↦ n A (m A s) z : [n : ℕ, m : ℕ] → ℕ,
+      5 ≔ [A, s, z] ↦ s (s (s (s (s z)))) : ℕ]
+      mul 5 5",
+  ];
+  for src in srcs {
+    let ar = Arena::new();
+    let x = Term::parse(Span::lex(src.chars()).unwrap().into_iter(), &ar).unwrap();
+    let expected = x.eval(&Stack::new(&ar), &ar).unwrap().quote(0, &ar).unwrap();
+    let mut car = compact::Arena::new();
+    let cx = compact::Term::lower(x, &mut car);
+    let v = cx.eval(compact::Stack::new(&car), &mut car).unwrap();
+    let y = v.quote(0, &mut car).unwrap();
+    assert_eq!(y.raise(&car, &ar).to_string(), expected.to_string());
+    // Values evaluated separately are convertible, and so is the normal form.
+    let w = cx.eval(compact::Stack::new(&car), &mut car).unwrap();
+    let z = y.eval(compact::Stack::new(&car), &mut car).unwrap();
+    assert!(v.conv(w, 0, &mut car).unwrap() && v.conv(z, 0, &mut car).unwrap());
+  }
+}
+
+#[test]
+fn test_app_spine() {
+  let ar = Arena::new();
+  let mut env = Stack::new(&ar);
+  for i in 0..4 {
+    env = env.extend(Val::Free(i), &ar);
+  }
+  let x = Term::parse(Span::lex(r"@^3 @^2 @^1 @^0".chars()).unwrap().into_iter(), &ar).unwrap();
+  let count = ar.val_count();
+  let v = x.eval(&env, &ar).unwrap();
+  // The neutral application is stored as one spine, and its head is shared.
+  assert!(matches!(v, Val::App(Val::Free(0), xs) if xs.len() == 3));
+  assert_eq!(ar.val_count(), count + 3);
+  assert_eq!(v.quote(4, &ar).unwrap().to_string(), x.to_string());
+  let y = Term::parse(Span::lex(r"([a] ↦ @^4 @^3 a) @^1".chars()).unwrap().into_iter(), &ar).unwrap();
+  let w = y.eval(&env, &ar).unwrap();
+  assert!(!v.conv(&w, 4, &ar).unwrap());
+  let z = Term::parse(Span::lex(r"([a] ↦ @^4 @^3 a) @^1 @^0".chars()).unwrap().into_iter(), &ar).unwrap();
+  assert!(v.conv(&z.eval(&env, &ar).unwrap(), 4, &ar).unwrap());
+  // Saturated calls bind all arguments without building intermediate closures.
+  let k = Term::parse(Span::lex(r"([a, b, c, d] ↦ c) @^3 @^2 @^1 @^0".chars()).unwrap().into_iter(), &ar).unwrap();
+  let (clos_count, frame_count) = (ar.clos_count(), ar.frame_count());
+  assert!(matches!(k.eval(&env, &ar).unwrap(), Val::Free(2)));
+  assert_eq!((ar.clos_count(), ar.frame_count()), (clos_count + 1, frame_count + 3));
+  // Long spines keep their arguments in order.
+  let args = (0..20).map(|i| format!(" @^{}", i % 4)).collect::<String>();
+  let x = Term::parse(Span::lex(format!("@^3{args}").chars()).unwrap().into_iter(), &ar).unwrap();
+  assert_eq!(x.eval(&env, &ar).unwrap().quote(4, &ar).unwrap().to_string(), x.to_string());
+}
+
+#[test]
+fn test_byte_limit() {
+  let ar = Arena::new();
+  let x = r"
+    [
+      ℕ ≔ [A : Type, s : [a : A] → A, z : A] → A,
+      mul ≔ [n, m, A, s, z] ↦ n A (m A s) z : [n : ℕ, m : ℕ] → ℕ,
+      10 ≔ [A, s, z] ↦ s (s (s (s (s (s (s (s (s (s z))))))))) : ℕ
+    ]
+      mul 10 10
+    ";
+  let x = Term::parse(Span::lex(x.chars()).unwrap().into_iter(), &ar).unwrap();
+  fn normalise<'a>(x: &Term<'a>, ar: &'a Arena) -> Result<Term<'a>, EvalError<'a>> {
+    x.eval(&Stack::new(ar), ar)?.quote(0, ar)
+  }
+  // Regions are freed afterwards, but their allocations count towards the peak.
+  let before = ar.byte_count();
+  let peak = ar.region(|temp| {
+    normalise(x, temp).unwrap();
+    temp.peak_bytes()
+  });
+  assert_eq!(ar.byte_count(), before);
+  assert_eq!(ar.peak_bytes(), peak);
+  assert!(peak > before);
+  // Regions count the bytes live in their parent towards the limit.
+  let limit = before + (peak - before) / 2;
+  ar.set_byte_limit(Some(limit));
+  assert!(ar.region(|temp| matches!(normalise(x, temp), Err(EvalError::OutOfMemory { limit: l }) if l == limit)));
+  ar.set_byte_limit(None);
+  assert!(ar.region(|temp| normalise(x, temp).is_ok()));
+}